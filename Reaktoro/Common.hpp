@@ -19,8 +19,10 @@
 
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/ArraySerialization.hpp>
+#include <Reaktoro/Common/AllocationCounter.hpp>
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
@@ -30,17 +32,21 @@
 #include <Reaktoro/Common/Macros.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Common/MemoryUsage.hpp>
 #include <Reaktoro/Common/Meta.hpp>
 #include <Reaktoro/Common/MolalityUtils.hpp>
 #include <Reaktoro/Common/MoleFractionUtils.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Common/TableStream.hpp>
 #include <Reaktoro/Common/TableUtils.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
@@ -18,13 +18,17 @@
 // pybind11 includes
 #include <Reaktoro/pybind11.hxx>
 
+void exportAllocationCounter(py::module& m);
 void exportConstants(py::module& m);
 void exportInterpolationUtils(py::module& m);
 void exportMemoization(py::module& m);
+void exportMemoryUsage(py::module& m);
 void exportParseUtils(py::module& m);
+void exportProfiler(py::module& m);
 void exportStringList(py::module& m);
 void exportStringUtils(py::module& m);
 void exportTable(py::module& m);
+void exportTableStream(py::module& m);
 void exportTimeUtils(py::module& m);
 void exportTypes(py::module& m);
 void exportUnits(py::module& m);
@@ -32,13 +36,17 @@ void exportWarnings(py::module& m);
 
 void exportCommon(py::module& m)
 {
+    exportAllocationCounter(m);
     exportConstants(m);
     exportInterpolationUtils(m);
     exportMemoization(m);
+    exportMemoryUsage(m);
     exportParseUtils(m);
+    exportProfiler(m);
     exportStringList(m);
     exportStringUtils(m);
     exportTable(m);
+    exportTableStream(m);
     exportTimeUtils(m);
     exportTypes(m);
     exportUnits(m);
@@ -0,0 +1,112 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "AllocationCounter.hpp"
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+
+#if defined(REAKTORO_ENABLE_ALLOCATION_COUNTING) && defined(__GLIBC__)
+#define REAKTORO_ALLOCATION_COUNTING_SUPPORTED 1
+#endif
+
+namespace Reaktoro {
+namespace detail {
+
+/// The running totals of the heap allocations in the current thread.
+/// The initial-exec TLS model ensures accessing these values from `malloc` never allocates memory itself.
+#ifdef REAKTORO_ALLOCATION_COUNTING_SUPPORTED
+__attribute__((tls_model("initial-exec")))
+#endif
+thread_local std::uint64_t allocationCount = 0;
+
+#ifdef REAKTORO_ALLOCATION_COUNTING_SUPPORTED
+__attribute__((tls_model("initial-exec")))
+#endif
+thread_local std::uint64_t allocationBytes = 0;
+
+/// Return the running totals of the heap allocations in the current thread.
+auto allocationTotals() -> AllocationStats
+{
+    return { allocationCount, allocationBytes };
+}
+
+} // namespace detail
+
+auto AllocationStats::operator+=(AllocationStats const& other) -> AllocationStats&
+{
+    allocations += other.allocations;
+    bytes += other.bytes;
+    return *this;
+}
+
+AllocationCounter::AllocationCounter()
+: mstart(detail::allocationTotals())
+{}
+
+auto AllocationCounter::reset() -> void
+{
+    mstart = detail::allocationTotals();
+}
+
+auto AllocationCounter::stats() const -> AllocationStats
+{
+    const auto totals = detail::allocationTotals();
+    return { totals.allocations - mstart.allocations, totals.bytes - mstart.bytes };
+}
+
+auto AllocationCounter::supported() -> bool
+{
+#ifdef REAKTORO_ALLOCATION_COUNTING_SUPPORTED
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace Reaktoro
+
+#ifdef REAKTORO_ALLOCATION_COUNTING_SUPPORTED
+
+// The allocation functions of glibc called by the replacements below
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t num, std::size_t size);
+extern "C" void* __libc_realloc(void* ptr, std::size_t size);
+
+extern "C" void* malloc(std::size_t size)
+{
+    Reaktoro::detail::allocationCount += 1;
+    Reaktoro::detail::allocationBytes += size;
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(std::size_t num, std::size_t size)
+{
+    Reaktoro::detail::allocationCount += 1;
+    Reaktoro::detail::allocationBytes += num * size;
+    return __libc_calloc(num, size);
+}
+
+extern "C" void* realloc(void* ptr, std::size_t size)
+{
+    Reaktoro::detail::allocationCount += 1;
+    Reaktoro::detail::allocationBytes += size;
+    return __libc_realloc(ptr, size);
+}
+
+#endif // REAKTORO_ALLOCATION_COUNTING_SUPPORTED
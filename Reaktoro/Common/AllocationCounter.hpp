@@ -0,0 +1,73 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The number of heap allocations and the number of bytes allocated in them.
+struct AllocationStats
+{
+    /// The number of heap allocations.
+    Index allocations = 0;
+
+    /// The total number of bytes requested in the heap allocations.
+    Index bytes = 0;
+
+    /// Self addition of another AllocationStats instance to this one.
+    auto operator+=(AllocationStats const& other) -> AllocationStats&;
+};
+
+/// Used to count the heap allocations in the current thread since its construction.
+/// Heap allocations are only counted if Reaktoro is built with the CMake
+/// option `REAKTORO_ENABLE_ALLOCATION_COUNTING` on Linux with glibc (check
+/// with @ref supported), in which case the functions `malloc`, `calloc` and
+/// `realloc` are replaced by ones that increment thread-local counters
+/// before calling those of glibc. This covers the allocations of Eigen
+/// matrices and arrays as well as those of `operator new`. This option is
+/// meant for diagnostic builds only, and the counted allocations are
+/// otherwise always zero. A typical use is to check that a steady-state hot
+/// path performs no heap allocations:
+/// ~~~{.cpp}
+/// AllocationCounter counter;
+/// solver.solve(state); // or any other operation
+/// assert(counter.stats().allocations == 0);
+/// ~~~
+class AllocationCounter
+{
+public:
+    /// Construct an AllocationCounter object and start counting heap allocations in the current thread.
+    AllocationCounter();
+
+    /// Restart counting heap allocations in the current thread.
+    auto reset() -> void;
+
+    /// Return the heap allocations in the current thread since construction or the last call to @ref reset.
+    auto stats() const -> AllocationStats;
+
+    /// Return true if heap allocations are counted in this build of Reaktoro.
+    static auto supported() -> bool;
+
+private:
+    /// The running totals of the heap allocations in the current thread when counting started.
+    AllocationStats mstart;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,40 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/AllocationCounter.hpp>
+using namespace Reaktoro;
+
+void exportAllocationCounter(py::module& m)
+{
+    py::class_<AllocationStats>(m, "AllocationStats")
+        .def(py::init<>())
+        .def_readwrite("allocations", &AllocationStats::allocations, "The number of heap allocations.")
+        .def_readwrite("bytes", &AllocationStats::bytes, "The total number of bytes requested in the heap allocations.")
+        .def(py::self += py::self)
+        ;
+
+    py::class_<AllocationCounter>(m, "AllocationCounter")
+        .def(py::init<>())
+        .def("reset", &AllocationCounter::reset, "Restart counting heap allocations in the current thread.")
+        .def("stats", &AllocationCounter::stats, "Return the heap allocations in the current thread since construction or the last call to reset.")
+        .def_static("supported", &AllocationCounter::supported, "Return true if heap allocations are counted in this build of Reaktoro.")
+        ;
+}
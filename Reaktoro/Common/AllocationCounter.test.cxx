@@ -0,0 +1,56 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/AllocationCounter.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing AllocationCounter", "[AllocationCounter]")
+{
+    AllocationCounter counter;
+
+    ArrayXd a = ArrayXd::Zero(100);
+
+    if(!AllocationCounter::supported())
+    {
+        CHECK( counter.stats().allocations == 0 );
+        CHECK( counter.stats().bytes == 0 );
+        return;
+    }
+
+    CHECK( counter.stats().allocations >= 1 );
+    CHECK( counter.stats().bytes >= 100 * sizeof(double) );
+
+    counter.reset();
+
+    a.setConstant(1.0); // no allocation in operations on preallocated storage
+    a += 2.0 * a;
+
+    CHECK( counter.stats().allocations == 0 );
+    CHECK( counter.stats().bytes == 0 );
+
+    AllocationStats stats;
+    stats += AllocationStats{ 2, 16 };
+    stats += AllocationStats{ 1, 8 };
+
+    CHECK( stats.allocations == 3 );
+    CHECK( stats.bytes == 24 );
+}
@@ -0,0 +1,77 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// Write a value of trivially copyable type to a binary stream.
+template<typename T>
+auto writeBinary(std::ostream& out, T const& value) -> void
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Write a string to a binary stream (its length followed by its characters).
+inline auto writeBinary(std::ostream& out, String const& value) -> void
+{
+    writeBinary(out, std::uint64_t(value.size()));
+    out.write(value.data(), value.size());
+}
+
+/// Write a contiguous block of values of trivially copyable type to a binary stream.
+template<typename T>
+auto writeBinary(std::ostream& out, T const* values, std::size_t size) -> void
+{
+    out.write(reinterpret_cast<const char*>(values), size * sizeof(T));
+}
+
+/// Read a value of trivially copyable type from a binary stream.
+template<typename T>
+auto readBinary(std::istream& in, T& value) -> void
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+/// Read a string from a binary stream (its length followed by its characters).
+inline auto readBinary(std::istream& in, String& value) -> void
+{
+    std::uint64_t size = 0;
+    readBinary(in, size);
+    value.resize(size);
+    in.read(value.data(), size);
+}
+
+/// Read a contiguous block of values of trivially copyable type from a binary stream.
+template<typename T>
+auto readBinary(std::istream& in, T* values, std::size_t size) -> void
+{
+    in.read(reinterpret_cast<char*>(values), size * sizeof(T));
+}
+
+} // namespace detail
+} // namespace Reaktoro
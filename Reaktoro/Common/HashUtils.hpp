@@ -18,7 +18,9 @@
 #pragma once
 
 // C++ includes
+#include <cstdint>
 #include <functional>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -54,6 +56,67 @@ auto hashVector(Vec const& vec) -> std::size_t
     return seed;
 }
 
+/// Used to compute 64-bit FNV-1a hashes that are deterministic across processes and platforms with same byte order.
+/// Unlike `std::hash`, whose values are implementation-defined, the hash
+/// computed with this class can be used to identify data stored on disk.
+class StableHasher
+{
+public:
+    /// Add the given bytes to the hash.
+    auto bytes(void const* data, std::size_t size) -> StableHasher&
+    {
+        auto const* p = static_cast<unsigned char const*>(data);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            m_value ^= p[i];
+            m_value *= 1099511628211ull; // the FNV-1a 64-bit prime
+        }
+        return *this;
+    }
+
+    /// Add the given string to the hash (including its size, so that consecutive strings cannot be confused).
+    auto operator()(std::string_view str) -> StableHasher&
+    {
+        operator()(static_cast<std::uint64_t>(str.size()));
+        return bytes(str.data(), str.size());
+    }
+
+    /// Add the given string to the hash (this overload prevents string literals from being converted to bool).
+    auto operator()(char const* str) -> StableHasher&
+    {
+        return operator()(std::string_view(str));
+    }
+
+    /// Add the given floating-point number to the hash.
+    auto operator()(double val) -> StableHasher&
+    {
+        val = (val == 0.0) ? 0.0 : val; // ensure -0.0 and 0.0 have the same hash
+        return bytes(&val, sizeof(val));
+    }
+
+    /// Add the given unsigned integer number to the hash.
+    auto operator()(std::uint64_t val) -> StableHasher&
+    {
+        return bytes(&val, sizeof(val));
+    }
+
+    /// Add the given boolean value to the hash.
+    auto operator()(bool val) -> StableHasher&
+    {
+        return operator()(static_cast<std::uint64_t>(val));
+    }
+
+    /// Return the current value of the hash.
+    auto value() const -> std::uint64_t
+    {
+        return m_value;
+    }
+
+private:
+    /// The current value of the hash, initialized with the FNV-1a 64-bit offset basis.
+    std::uint64_t m_value = 14695981039346656037ull;
+};
+
 } // namespace Reaktoro
 
 /// Specialize std::hash for `std::vector<T, A>` so that it can be used as key in `std::unordered_map`.
@@ -0,0 +1,86 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to find the index of the first item in a container with a given key in constant time.
+/// The hash table mapping keys to indices is built on the first lookup and
+/// kept until @ref reset is called, which the owner of the container must do
+/// whenever the container is modified. Lookups can be performed concurrently
+/// from multiple threads. Copies share the same immutable hash table until
+/// one of them is reset.
+class LookupTable
+{
+public:
+    /// Construct a default LookupTable object.
+    LookupTable() = default;
+
+    /// Construct a copy of a LookupTable object.
+    LookupTable(LookupTable const& other)
+    : m_table(std::atomic_load(&other.m_table))
+    {}
+
+    /// Assign a copy of a LookupTable object to this.
+    auto operator=(LookupTable const& other) -> LookupTable&
+    {
+        std::atomic_store(&m_table, std::atomic_load(&other.m_table));
+        return *this;
+    }
+
+    /// Return the index of the first item in @p items whose key is @p key or the number of items if not found.
+    /// @param key The key of the item to be found.
+    /// @param items The container of items, which must be the same in every call until @ref reset is called.
+    /// @param keyfn The function returning the key of an item (used only when the hash table is built).
+    template<typename Container, typename KeyFn>
+    auto find(String const& key, Container const& items, KeyFn const& keyfn) const -> Index
+    {
+        auto table = std::atomic_load(&m_table);
+
+        if(!table)
+        {
+            auto built = std::make_shared<Map<String, Index>>();
+            built->reserve(items.size());
+            for(Index i = 0; i < items.size(); ++i)
+                built->emplace(keyfn(items[i]), i); // keep the index of the first item with a repeated key
+            table = built;
+            std::atomic_store(&m_table, table);
+        }
+
+        const auto it = table->find(key);
+        return it != table->end() ? it->second : items.size();
+    }
+
+    /// Discard the hash table so that it is built again in the next lookup.
+    auto reset() -> void
+    {
+        std::atomic_store(&m_table, SharedPtr<const Map<String, Index>>());
+    }
+
+private:
+    /// The hash table mapping keys to the index of the first item with that key (built on demand).
+    mutable SharedPtr<const Map<String, Index>> m_table;
+};
+
+} // namespace Reaktoro
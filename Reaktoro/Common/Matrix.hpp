@@ -19,6 +19,7 @@
 
 // Eigen includes
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 // autodiff includes
 #include <autodiff/forward/real/eigen.hpp>
@@ -79,6 +80,10 @@ using VectorXdConstMap        = Eigen::Map<const VectorXd>;
 using VectorXdStridedRef      = Eigen::Ref<VectorXd, 0, Eigen::InnerStride<>>;       ///< Convenient alias to Eigen type.
 using VectorXdStridedConstRef = Eigen::Ref<const VectorXd, 0, Eigen::InnerStride<>>; ///< Convenient alias to Eigen type.
 
+using VectorXf                = Eigen::VectorXf;                                     ///< Convenient alias to Eigen type.
+using VectorXfRef             = Eigen::Ref<VectorXf>;                                ///< Convenient alias to Eigen type.
+using VectorXfConstRef        = Eigen::Ref<const VectorXf>;                          ///< Convenient alias to Eigen type.
+
 
 //---------------------------------------------------------------------------------------------------------------------
 // == ARRAY TYPE ALIASES ==
@@ -108,6 +113,10 @@ using ArrayXdConstMap         = Eigen::Map<const ArrayXd>;
 using ArrayXdStridedRef       = Eigen::Ref<ArrayXd, 0, Eigen::InnerStride<>>;        ///< Convenient alias to Eigen type.
 using ArrayXdStridedConstRef  = Eigen::Ref<const ArrayXd, 0, Eigen::InnerStride<>>;  ///< Convenient alias to Eigen type.
 
+using ArrayXf                 = Eigen::ArrayXf;                                      ///< Convenient alias to Eigen type.
+using ArrayXfRef              = Eigen::Ref<ArrayXf>;                                 ///< Convenient alias to Eigen type.
+using ArrayXfConstRef         = Eigen::Ref<const ArrayXf>;                           ///< Convenient alias to Eigen type.
+
 using ArrayXXr                = autodiff::ArrayXXreal;                               ///< Convenient alias to Eigen type.
 using ArrayXXrRef             = Eigen::Ref<ArrayXXr>;                                ///< Convenient alias to Eigen type.
 using ArrayXXrConstRef        = Eigen::Ref<const ArrayXXr>;                          ///< Convenient alias to Eigen type.
@@ -140,6 +149,12 @@ using MatrixXdConstRef        = Eigen::Ref<const MatrixXd>; ///< Convenient alia
 using MatrixXdMap             = Eigen::Map<MatrixXd>;       ///< Convenient alias to Eigen type.
 using MatrixXdConstMap        = Eigen::Map<const MatrixXd>; ///< Convenient alias to Eigen type.
 
+using MatrixXf                = Eigen::MatrixXf;            ///< Convenient alias to Eigen type.
+using MatrixXfRef             = Eigen::Ref<MatrixXf>;       ///< Convenient alias to Eigen type.
+using MatrixXfConstRef        = Eigen::Ref<const MatrixXf>; ///< Convenient alias to Eigen type.
+
+using SparseMatrixXd          = Eigen::SparseMatrix<double>; ///< Convenient alias to Eigen type.
+
 //---------------------------------------------------------------------------------------------------------------------
 // == ROW VECTOR TYPE ALIASES ==
 //---------------------------------------------------------------------------------------------------------------------
@@ -19,31 +19,31 @@
 
 namespace Reaktoro {
 
-auto getMemoizationStatus() -> bool&
+auto getMemoizationStatus() -> std::atomic<bool>&
 {
     /// The global variable that holds status if memoization is currently enabled or disabled.
-    static bool memoization_active = true;
+    static std::atomic<bool> memoization_active{true};
     return memoization_active;
 }
 
 auto Memoization::isEnabled() -> bool
 {
-    return getMemoizationStatus();
+    return getMemoizationStatus().load(std::memory_order_relaxed);
 }
 
 auto Memoization::isDisabled() -> bool
 {
-    return !getMemoizationStatus();
+    return !getMemoizationStatus().load(std::memory_order_relaxed);
 }
 
 auto Memoization::enable() -> void
 {
-    getMemoizationStatus() = true;
+    getMemoizationStatus().store(true, std::memory_order_relaxed);
 }
 
 auto Memoization::disable() -> void
 {
-    getMemoizationStatus() = false;
+    getMemoizationStatus().store(false, std::memory_order_relaxed);
 }
 
 } // namespace Reaktoro
@@ -17,6 +17,12 @@
 
 #pragma once
 
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Meta.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
@@ -126,9 +132,84 @@ auto assignValues(Tuple1& tuple1, const Tuple2& tuple2)
 template<typename T>
 using CacheType = typename MemoizationTraits<Decay<T>>::CacheType;
 
+/// Used to give each thread its own instance of an object, such as the cache of a memoized function.
+/// Copies of a ThreadLocal object share the same per-thread instances. An
+/// instance is created, as a copy of the object given at construction, the
+/// first time a thread accesses it, and it is released once all copies of the
+/// ThreadLocal object have been destroyed and the thread creates new instances.
+template<typename T>
+class ThreadLocal
+{
+public:
+    /// Construct a ThreadLocal object whose per-thread instances are initialized with given object.
+    explicit ThreadLocal(T const& init = T())
+    : token(std::make_shared<Token>(Token{ nextid(), init }))
+    {}
+
+    /// Return the instance of the calling thread.
+    auto local() const -> T&
+    {
+        thread_local Map<std::uint64_t, Slot> slots;
+        thread_local std::uint64_t lastid = 0;
+        thread_local T* last = nullptr;
+        thread_local std::size_t purgesize = 16;
+
+        if(token->id == lastid)
+            return *last;
+
+        auto it = slots.find(token->id);
+        if(it == slots.end())
+        {
+            if(slots.size() >= purgesize)
+            {
+                for(auto jt = slots.begin(); jt != slots.end();)
+                    jt = jt->second.owner.expired() ? slots.erase(jt) : std::next(jt);
+                purgesize = std::max<std::size_t>(16, 2 * slots.size());
+            }
+            it = slots.emplace(token->id, Slot{ token, token->init }).first;
+        }
+
+        lastid = token->id;
+        last = &it->second.value;
+        return *last;
+    }
+
+private:
+    /// The data shared among the copies of a ThreadLocal object.
+    struct Token
+    {
+        /// The unique identifier of the ThreadLocal object (never reused).
+        std::uint64_t id;
+
+        /// The object used to initialize the per-thread instances.
+        T init;
+    };
+
+    /// The instance of a thread and the token of the ThreadLocal object it belongs to.
+    struct Slot
+    {
+        std::weak_ptr<const Token> owner;
+        T value;
+    };
+
+    /// The data shared among the copies of this ThreadLocal object.
+    SharedPtr<const Token> token;
+
+    /// Return a new unique identifier for a ThreadLocal object.
+    static auto nextid() -> std::uint64_t
+    {
+        static std::atomic<std::uint64_t> counter{0};
+        return ++counter;
+    }
+};
+
 } // namespace detail
 
 /// The class used to control memoization in the application.
+/// The status of memoization is global and can be changed from any thread,
+/// although a change is not guaranteed to be seen immediately by memoized
+/// functions being evaluated concurrently in other threads. Enable or disable
+/// memoization before starting parallel calculations.
 class Memoization
 {
 public:
@@ -149,18 +230,21 @@ public:
 };
 
 /// Return a memoized version of given function `f`.
+/// The cache of the memoized function is kept per thread, so that it can be
+/// called concurrently from multiple threads.
 template<typename Ret, typename... Args>
 auto memoize(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    auto cache = std::make_shared<Map<Tuple<Args...>, Ret>>();
-    return [=](Args... args) mutable -> Ret
+    detail::ThreadLocal<Map<Tuple<Args...>, Ret>> caches;
+    return [=](Args... args) -> Ret
     {
         if(Memoization::isDisabled())
             return f(args...);
+        auto& cache = caches.local();
         Tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        if(cache.find(t) == cache.end())
+            cache[t] = f(args...);
+        return cache[t];
     };
 }
 
@@ -171,22 +255,38 @@ auto memoize(Fun f)
     return memoize(asFunction(f));
 }
 
+namespace detail {
+
+/// Used to store the arguments and result of the last call to a memoized function.
+template<typename Ret, typename... Args>
+struct LastCallCache
+{
+    Tuple<CacheType<Args>...> args;
+    Ret result = Ret();
+    bool firsttime = true;
+};
+
+} // namespace detail
+
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// The cache of the memoized function is kept per thread, so that it can be
+/// called concurrently from multiple threads (e.g., when the same chemical
+/// system is used by the workers of a ThreadPool) without data races or
+/// results computed for the arguments of another thread.
 template<typename Ret, typename... Args>
 auto memoizeLast(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](Args... args) mutable -> Ret
+    detail::ThreadLocal<detail::LastCallCache<Ret, Args...>> caches;
+    return [=](Args... args) -> Ret
     {
         if(Memoization::isDisabled())
             return f(args...);
-        if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            return Ret(result);
-        detail::assignValues(cache, std::tie(args...));
-        firsttime = false;
-        return result = f(args...);
+        auto& cache = caches.local();
+        if(detail::sameValues(cache.args, std::tie(args...)) && !cache.firsttime)
+            return Ret(cache.result);
+        detail::assignValues(cache.args, std::tie(args...));
+        cache.firsttime = false;
+        return cache.result = f(args...);
     };
 }
 
@@ -198,25 +298,25 @@ auto memoizeLast(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// @see memoizeLast
 template<typename Ret, typename RetRef, typename... Args>
 auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f) -> Fn<void(RetRef, Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](RetRef res, Args... args) mutable -> void
+    detail::ThreadLocal<detail::LastCallCache<Ret, Args...>> caches;
+    return [=](RetRef res, Args... args) -> void
     {
         if(Memoization::isDisabled())
-            f(res, args...);
-        else if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            res = result;
+            return f(res, args...);
+        auto& cache = caches.local();
+        if(detail::sameValues(cache.args, std::tie(args...)) && !cache.firsttime)
+            res = cache.result;
         else
         {
             f(res, args...);
-            result = res;
-            detail::assignValues(cache, std::tie(args...));
+            cache.result = res;
+            detail::assignValues(cache.args, std::tie(args...));
         }
-        firsttime = false;
+        cache.firsttime = false;
     };
 }
 
@@ -246,4 +346,150 @@ auto memoizeLastUsingRef(Fun f)
     return memoizeLastUsingRef(asFunction(f));
 }
 
+namespace detail {
+
+/// Used to store the results of a function for a fixed number of least recently used sets of arguments.
+template<typename Ret, typename... Args>
+class LRUCache
+{
+public:
+    /// Construct a LRUCache object with given capacity (at least one).
+    explicit LRUCache(std::size_t capacity)
+    : capacity(std::max<std::size_t>(capacity, 1))
+    {}
+
+    /// Return the cached result for given arguments or a null pointer if not found.
+    auto find(Args const&... args) -> Ret*
+    {
+        ++counter;
+
+        // Check the entry used in the last call first, since it is the most likely one to be used again
+        if(ilast < entries.size() && sameValues(entries[ilast].args, std::tie(args...)))
+            return hit(ilast);
+
+        for(std::size_t i = 0; i < entries.size(); ++i)
+            if(sameValues(entries[i].args, std::tie(args...)))
+                return hit(i);
+
+        return nullptr;
+    }
+
+    /// Return the entry where the result for given arguments should be stored, replacing the least recently used one if the cache is full.
+    auto insert(Args const&... args) -> Ret&
+    {
+        if(entries.size() < capacity)
+        {
+            ilast = entries.size();
+            entries.emplace_back();
+        }
+        else
+        {
+            ilast = 0;
+            for(std::size_t i = 1; i < entries.size(); ++i)
+                if(entries[i].lastused < entries[ilast].lastused)
+                    ilast = i;
+        }
+
+        auto& entry = entries[ilast];
+        assignValues(entry.args, std::tie(args...));
+        entry.lastused = counter;
+        return entry.result;
+    }
+
+private:
+    /// The cached arguments and result of a function call.
+    struct Entry
+    {
+        Tuple<CacheType<Args>...> args;
+        Ret result = Ret();
+        std::size_t lastused = 0;
+    };
+
+    /// The maximum number of cached entries.
+    std::size_t capacity;
+
+    /// The cached entries.
+    Vec<Entry> entries;
+
+    /// The number of lookups performed so far (used to time stamp the entries).
+    std::size_t counter = 0;
+
+    /// The index of the entry used in the last lookup.
+    std::size_t ilast = 0;
+
+    /// Mark the entry with given index as the most recently used and return its result.
+    auto hit(std::size_t i) -> Ret*
+    {
+        ilast = i;
+        entries[i].lastused = counter;
+        return &entries[i].result;
+    }
+};
+
+} // namespace detail
+
+/// Return a memoized version of given function `f` that caches the results of the last `capacity` distinct calls.
+/// Unlike @ref memoizeLast, this memoized function keeps hitting its cache
+/// when calls alternate among a few sets of arguments (e.g., the temperatures
+/// and pressures of neighbouring cells in a transport simulation), and unlike
+/// @ref memoize, its memory usage is bounded. When the cache is full, the
+/// least recently used entry is replaced. The cache is searched linearly, so
+/// `capacity` should be small.
+/// @param f The function to be memoized.
+/// @param capacity The maximum number of cached results (at least one).
+/// @note The cache is kept per thread, as in @ref memoizeLast.
+template<typename Ret, typename... Args>
+auto memoizeLRU(Fn<Ret(Args...)> f, std::size_t capacity) -> Fn<Ret(Args...)>
+{
+    using Cache = detail::LRUCache<Ret, Decay<Args>...>;
+    detail::ThreadLocal<Cache> caches(Cache{capacity});
+    return [=](Args... args) -> Ret
+    {
+        if(Memoization::isDisabled())
+            return f(args...);
+        auto& cache = caches.local();
+        if(auto result = cache.find(args...))
+            return Ret(*result);
+        return cache.insert(args...) = f(args...);
+    };
+}
+
+/// Return a memoized version of given function `f` that caches the results of the last `capacity` distinct calls.
+/// This overload is used when `f` is a lambda function or free function.
+template<typename Fun, Requires<!isFunction<Fun>> = true>
+auto memoizeLRU(Fun f, std::size_t capacity)
+{
+    return memoizeLRU(asFunction(f), capacity);
+}
+
+/// Return a memoized version of given function `f` that caches the results of the last `capacity` distinct calls.
+/// @see memoizeLRU
+template<typename Ret, typename RetRef, typename... Args>
+auto memoizeLRUUsingRef(Fn<void(RetRef, Args...)> f, std::size_t capacity) -> Fn<void(RetRef, Args...)>
+{
+    using Cache = detail::LRUCache<Ret, Decay<Args>...>;
+    detail::ThreadLocal<Cache> caches(Cache{capacity});
+    return [=](RetRef res, Args... args) -> void
+    {
+        if(Memoization::isDisabled())
+            return f(res, args...);
+        auto& cache = caches.local();
+        if(auto result = cache.find(args...))
+            res = *result;
+        else
+        {
+            f(res, args...);
+            cache.insert(args...) = res;
+        }
+    };
+}
+
+/// Return a memoized version of given function `f` that caches the results of the last `capacity` distinct calls.
+/// This overload assumes that `RetRef = Ret&`.
+template<typename Ret, typename... Args>
+auto memoizeLRUUsingRef(Fn<void(Ret&, Args...)> f, std::size_t capacity) -> Fn<void(Ret&, Args...)>
+{
+    return memoizeLRUUsingRef<Ret, Ret&>(f, capacity);
+}
+
 } // namespace Reaktoro
@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -126,3 +129,129 @@ TEST_CASE("Testing Memoization - memoizeLast without return", "[Memoization]")
 
     CHECK( counter == 5 ); // two increments above, in f1 and f2, because of different arguments
 }
+
+TEST_CASE("Testing Memoization - memoizeLRU with return", "[Memoization]")
+{
+    int counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](real T, real P)
+    {
+        ++counter;
+        return T * P;
+    };
+
+    auto f2 = memoizeLRU(f1, 2); // f2 is the memoized version of f1 caching the last two distinct calls
+
+    CHECK( f2(300.0, 1.0) == 300.0 );
+    CHECK( f2(400.0, 2.0) == 800.0 );
+
+    CHECK( counter == 2 );
+
+    for(auto i = 0; i < 5; ++i) // alternating between the two cached arguments - no increment in counter
+    {
+        CHECK( f2(300.0, 1.0) == 300.0 );
+        CHECK( f2(400.0, 2.0) == 800.0 );
+    }
+
+    CHECK( counter == 2 );
+
+    CHECK( f2(500.0, 3.0) == 1500.0 ); // replaces the least recently used entry (300.0, 1.0)
+
+    CHECK( counter == 3 );
+
+    CHECK( f2(400.0, 2.0) == 800.0 ); // still cached
+
+    CHECK( counter == 3 );
+
+    CHECK( f2(300.0, 1.0) == 300.0 ); // no longer cached, replaces (500.0, 3.0)
+
+    CHECK( counter == 4 );
+
+    Memoization::disable(); // disable memoization
+
+    f2(400.0, 2.0); // memoization is disabled, so counter will be incremented
+
+    CHECK( counter == 5 );
+
+    Memoization::enable(); // enable memoization
+
+    f2(400.0, 2.0);
+
+    CHECK( counter == 5 );
+}
+
+TEST_CASE("Testing Memoization - memoizeLRU without return", "[Memoization]")
+{
+    int counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](DummyResult& res, double x, int y, real z) -> void
+    {
+        ++counter;
+        res.r = x + y + z;
+        res.s = x * y * z;
+    };
+
+    auto f2 = memoizeLRUUsingRef(asFunction(f1), 3); // f2 is the memoized version of f1 caching the last three distinct calls
+
+    DummyResult res;
+
+    for(auto i = 0; i < 4; ++i)
+    {
+        f2(res, 1.0, 2, 3.0);
+        CHECK( res.r == 6.0 );
+        f2(res, 2.0, 3, 4.0);
+        CHECK( res.s == 24.0 );
+        f2(res, 3.0, 4, 5.0);
+        CHECK( res.r == 12.0 );
+        CHECK( res.s == 60.0 );
+    }
+
+    CHECK( counter == 3 ); // each distinct call fully evaluated only once
+}
+
+TEST_CASE("Testing Memoization - memoized functions called from multiple threads", "[Memoization]")
+{
+    std::atomic<int> counter{0}; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](double x)
+    {
+        ++counter;
+        return 2.0 * x;
+    };
+
+    auto f2 = memoizeLast(f1);
+    auto f3 = memoizeLRU(f1, 2);
+
+    const auto numthreads = 4;
+    const auto numcalls = 1000;
+
+    Vec<int> failures(numthreads, 0);
+    Vec<std::thread> threads;
+
+    for(auto k = 0; k < numthreads; ++k)
+        threads.emplace_back([&, k]()
+        {
+            for(auto i = 0; i < numcalls; ++i)
+            {
+                const double x = k; // each thread uses its own argument, so that it would always miss a cache shared among threads
+                if(f2(x) != 2.0 * x) ++failures[k];
+                if(f3(x) != 2.0 * x) ++failures[k];
+            }
+        });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == Vec<int>(numthreads, 0) );
+    CHECK( counter == 2 * numthreads ); // each thread evaluates f1 once in f2 and once in f3 and then hits its own caches
+
+    auto f4 = f2; // copies of a memoized function share its caches
+
+    f4(0.0);
+
+    CHECK( counter == 2 * numthreads + 1 ); // the main thread had not called f2 yet
+
+    f2(0.0);
+
+    CHECK( counter == 2 * numthreads + 1 );
+}
@@ -0,0 +1,184 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MemoryUsage.hpp"
+
+// C++ includes
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+
+namespace Reaktoro {
+
+auto MemoryUsage::add(String const& name, Index bytes) -> MemoryUsage&
+{
+    components.push_back({ name, bytes, {} });
+    return *this;
+}
+
+auto MemoryUsage::add(MemoryUsage const& component) -> MemoryUsage&
+{
+    components.push_back(component);
+    return *this;
+}
+
+auto MemoryUsage::total() const -> Index
+{
+    Index sum = bytes;
+    for(auto const& component : components)
+        sum += component.total();
+    return sum;
+}
+
+auto MemoryUsage::component(String const& name) const -> MemoryUsage const&
+{
+    for(auto const& component : components)
+        if(component.name == name)
+            return component;
+    errorif(true, "There is no component with name `", name, "` in the memory usage of `", this->name, "`.");
+    return *this; // unreachable
+}
+
+namespace {
+
+auto writeMemoryUsage(std::ostream& out, MemoryUsage const& usage, Index depth) -> void
+{
+    out << String(2 * depth, ' ') << (usage.name.empty() ? "<unnamed>" : usage.name) << ": " << strbytes(usage.total()) << "\n";
+    for(auto const& component : usage.components)
+        writeMemoryUsage(out, component, depth + 1);
+}
+
+} // namespace
+
+auto operator<<(std::ostream& out, MemoryUsage const& usage) -> std::ostream&
+{
+    writeMemoryUsage(out, usage, 0);
+    return out;
+}
+
+auto strbytes(Index bytes) -> String
+{
+    const char* units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+    auto value = static_cast<double>(bytes);
+    auto i = 0;
+    while(value >= 1024.0 && i < 4)
+    {
+        value /= 1024.0;
+        ++i;
+    }
+    std::stringstream ss;
+    if(i == 0) ss << bytes << " B";
+    else ss << std::fixed << std::setprecision(1) << value << " " << units[i];
+    return ss.str();
+}
+
+auto processResidentMemory() -> Index
+{
+#if defined(__linux__)
+    std::ifstream file("/proc/self/statm");
+    Index size = 0, resident = 0;
+    if(file >> size >> resident)
+        return resident * sysconf(_SC_PAGESIZE);
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+auto processPeakResidentMemory() -> Index
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(__APPLE__)
+    return usage.ru_maxrss; // in bytes on macOS
+#else
+    return usage.ru_maxrss * 1024; // in kilobytes on Linux
+#endif
+#else
+    return 0;
+#endif
+}
+
+MemoryUsageLogger::MemoryUsageLogger(Fn<MemoryUsage()> const& probe)
+: mprobe(probe), mwriter([](String const& line) { std::cerr << line << std::endl; })
+{
+    errorif(!mprobe, "Expecting a non-empty function returning the memory usage to be logged in MemoryUsageLogger.");
+}
+
+auto MemoryUsageLogger::setInterval(Index steps) -> void
+{
+    minterval = steps;
+}
+
+auto MemoryUsageLogger::setWriter(Fn<void(String const&)> const& writer) -> void
+{
+    errorif(!writer, "Expecting a non-empty function writing the logged lines in MemoryUsageLogger::setWriter.");
+    mwriter = writer;
+}
+
+auto MemoryUsageLogger::step() -> bool
+{
+    ++msteps;
+    if(minterval == 0 || msteps % minterval != 0)
+        return false;
+    log();
+    return true;
+}
+
+auto MemoryUsageLogger::log() -> void
+{
+    const auto usage = mprobe();
+
+    std::stringstream ss;
+    ss << "[memory] step " << msteps << ": " << (usage.name.empty() ? "total" : usage.name) << " " << strbytes(usage.total());
+
+    if(!usage.components.empty())
+    {
+        ss << " (";
+        for(auto i = 0; i < usage.components.size(); ++i)
+            ss << (i > 0 ? ", " : "") << usage.components[i].name << " " << strbytes(usage.components[i].total());
+        ss << ")";
+    }
+
+    const auto resident = processResidentMemory();
+    const auto peak = processPeakResidentMemory();
+
+    if(resident) ss << ", process resident " << strbytes(resident);
+    if(peak) ss << ", process peak " << strbytes(peak);
+
+    mwriter(ss.str());
+}
+
+auto MemoryUsageLogger::steps() const -> Index
+{
+    return msteps;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,174 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// C++ includes
+#include <iosfwd>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The approximate memory used by an object, with a breakdown per component.
+/// The memory of an object is the sum of the bytes used directly by it (see
+/// #bytes) and those used by its components, each of which can be further
+/// broken down. Only the data stored in arrays, matrices, strings and vectors
+/// is accounted for, not the overhead of the containers storing them nor the
+/// data captured in model functions.
+struct MemoryUsage
+{
+    /// The name of the object or component.
+    String name;
+
+    /// The bytes used directly by the object or component, not accounted for in its components.
+    Index bytes = 0;
+
+    /// The components of the object and their memory usage.
+    Vec<MemoryUsage> components;
+
+    /// Add a component with given name and bytes.
+    auto add(String const& name, Index bytes) -> MemoryUsage&;
+
+    /// Add a component with its own breakdown of memory usage.
+    auto add(MemoryUsage const& component) -> MemoryUsage&;
+
+    /// Return the total bytes used by the object, including those used by its components.
+    auto total() const -> Index;
+
+    /// Return the component with given name.
+    auto component(String const& name) const -> MemoryUsage const&;
+};
+
+/// Output a MemoryUsage object to an output stream as an indented tree with human-readable sizes.
+auto operator<<(std::ostream& out, MemoryUsage const& usage) -> std::ostream&;
+
+/// Return a human-readable representation of given number of bytes (e.g., `12.5 MiB`).
+auto strbytes(Index bytes) -> String;
+
+/// Return the resident memory of the current process (in bytes), or zero if not supported in this platform.
+auto processResidentMemory() -> Index;
+
+/// Return the peak resident memory of the current process (in bytes), or zero if not supported in this platform.
+auto processPeakResidentMemory() -> Index;
+
+/// Return the bytes used by the entries of a dense Eigen matrix or array.
+template<typename Derived>
+auto memoryBytes(Eigen::DenseBase<Derived> const& mat) -> Index
+{
+    return mat.size() * sizeof(typename Derived::Scalar);
+}
+
+/// Return the bytes used by the non-zero entries and the indices of a sparse matrix.
+inline auto memoryBytes(SparseMatrixXd const& mat) -> Index
+{
+    return mat.nonZeros() * (sizeof(double) + sizeof(SparseMatrixXd::StorageIndex)) + (mat.outerSize() + 1) * sizeof(SparseMatrixXd::StorageIndex);
+}
+
+/// Return the bytes used by the characters of a string.
+inline auto memoryBytes(String const& str) -> Index
+{
+    return str.capacity();
+}
+
+/// Return the bytes used by the strings in a vector of strings.
+inline auto memoryBytes(Strings const& strs) -> Index
+{
+    Index sum = strs.capacity() * sizeof(String);
+    for(auto const& str : strs)
+        sum += str.capacity();
+    return sum;
+}
+
+/// Return the bytes used by the entries of a vector.
+template<typename T>
+auto memoryBytes(Vec<T> const& vec) -> Index
+{
+    return vec.capacity() * sizeof(T);
+}
+
+/// Return the bytes used by the entries of a deque.
+template<typename T>
+auto memoryBytes(Deque<T> const& deq) -> Index
+{
+    return deq.size() * sizeof(T);
+}
+
+/// Return the sum of the bytes used by given objects.
+template<typename T, typename U, typename... Ts>
+auto memoryBytes(T const& first, U const& second, Ts const&... rest) -> Index
+{
+    return memoryBytes(first) + memoryBytes(second, rest...);
+}
+
+/// Used to log the memory usage of an object periodically during a long run.
+/// The memory usage is obtained with a given function (e.g., one calling the
+/// `memoryUsage` method of a SmartEquilibriumSolver object) every time @ref
+/// step has been called a given number of times, and logged in a single line
+/// together with the resident memory of the process:
+/// ~~~{.cpp}
+/// MemoryUsageLogger logger([&] { return solver.memoryUsage(); });
+/// logger.setInterval(1000);
+/// for(auto istep = 0; istep < nsteps; ++istep)
+/// {
+///     solver.solve(state);
+///     logger.step();
+/// }
+/// ~~~
+/// By default, the lines are written to the standard error stream, which is
+/// kept by batch systems even when a process is killed for exceeding its
+/// memory limit.
+class MemoryUsageLogger
+{
+public:
+    /// Construct a MemoryUsageLogger object with given function returning the memory usage to be logged.
+    explicit MemoryUsageLogger(Fn<MemoryUsage()> const& probe);
+
+    /// Set the number of calls to @ref step between consecutive logs (default is 1, zero disables logging in @ref step).
+    auto setInterval(Index steps) -> void;
+
+    /// Set the function that writes the logged lines (default writes to the standard error stream).
+    auto setWriter(Fn<void(String const&)> const& writer) -> void;
+
+    /// Count a step of the run and log the memory usage if the interval has been reached.
+    /// @return True if the memory usage was logged in this call.
+    auto step() -> bool;
+
+    /// Log the memory usage now, regardless of the interval.
+    auto log() -> void;
+
+    /// Return the number of calls to @ref step so far.
+    auto steps() const -> Index;
+
+private:
+    /// The function returning the memory usage to be logged.
+    Fn<MemoryUsage()> mprobe;
+
+    /// The function that writes the logged lines.
+    Fn<void(String const&)> mwriter;
+
+    /// The number of calls to step between consecutive logs.
+    Index minterval = 1;
+
+    /// The number of calls to step so far.
+    Index msteps = 0;
+};
+
+} // namespace Reaktoro
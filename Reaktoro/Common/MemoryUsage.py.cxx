@@ -0,0 +1,52 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/MemoryUsage.hpp>
+using namespace Reaktoro;
+
+void exportMemoryUsage(py::module& m)
+{
+    py::class_<MemoryUsage>(m, "MemoryUsage")
+        .def(py::init<>())
+        .def_readwrite("name", &MemoryUsage::name, "The name of the object or component.")
+        .def_readwrite("bytes", &MemoryUsage::bytes, "The bytes used directly by the object or component, not accounted for in its components.")
+        .def_readwrite("components", &MemoryUsage::components, "The components of the object and their memory usage.")
+        .def("add", py::overload_cast<String const&, Index>(&MemoryUsage::add), return_internal_ref, "Add a component with given name and bytes.")
+        .def("add", py::overload_cast<MemoryUsage const&>(&MemoryUsage::add), return_internal_ref, "Add a component with its own breakdown of memory usage.")
+        .def("total", &MemoryUsage::total, "Return the total bytes used by the object, including those used by its components.")
+        .def("component", &MemoryUsage::component, return_internal_ref, "Return the component with given name.")
+        .def("__repr__", [](MemoryUsage const& self) { std::stringstream ss; ss << self; return ss.str(); })
+        ;
+
+    m.def("strbytes", strbytes, "Return a human-readable representation of given number of bytes.");
+    m.def("processResidentMemory", processResidentMemory, "Return the resident memory of the current process (in bytes), or zero if not supported in this platform.");
+    m.def("processPeakResidentMemory", processPeakResidentMemory, "Return the peak resident memory of the current process (in bytes), or zero if not supported in this platform.");
+
+    py::class_<MemoryUsageLogger>(m, "MemoryUsageLogger")
+        .def(py::init<Fn<MemoryUsage()> const&>())
+        .def("setInterval", &MemoryUsageLogger::setInterval, "Set the number of calls to step between consecutive logs.")
+        .def("setWriter", &MemoryUsageLogger::setWriter, "Set the function that writes the logged lines (default writes to the standard error stream).")
+        .def("step", &MemoryUsageLogger::step, "Count a step of the run and log the memory usage if the interval has been reached.")
+        .def("log", &MemoryUsageLogger::log, "Log the memory usage now, regardless of the interval.")
+        .def("steps", &MemoryUsageLogger::steps, "Return the number of calls to step so far.")
+        ;
+}
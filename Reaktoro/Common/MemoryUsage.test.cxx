@@ -0,0 +1,107 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <sstream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/MemoryUsage.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing MemoryUsage class", "[MemoryUsage]")
+{
+    MemoryUsage usage;
+    usage.name = "Object";
+    usage.bytes = 100;
+
+    MemoryUsage component;
+    component.name = "Component";
+    component.add("A", 1000).add("B", 24);
+
+    usage.add(component).add("C", 2048);
+
+    CHECK( usage.total() == 100 + 1000 + 24 + 2048 );
+    CHECK( usage.component("Component").total() == 1024 );
+    CHECK( usage.component("C").total() == 2048 );
+    CHECK_THROWS( usage.component("D") );
+
+    std::stringstream ss;
+    ss << usage;
+
+    CHECK( ss.str() ==
+        "Object: 3.1 KiB\n"
+        "  Component: 1.0 KiB\n"
+        "    A: 1000 B\n"
+        "    B: 24 B\n"
+        "  C: 2.0 KiB\n" );
+}
+
+TEST_CASE("Testing memoryBytes functions", "[MemoryUsage]")
+{
+    CHECK( memoryBytes(ArrayXd(10)) == 10 * sizeof(double) );
+    CHECK( memoryBytes(MatrixXd(3, 4)) == 12 * sizeof(double) );
+    CHECK( memoryBytes(ArrayXr(5)) == 5 * sizeof(real) );
+    CHECK( memoryBytes(ArrayXd(10), MatrixXd(3, 4)) == 22 * sizeof(double) );
+    CHECK( memoryBytes(Vec<double>(7)) >= 7 * sizeof(double) );
+}
+
+TEST_CASE("Testing strbytes function", "[MemoryUsage]")
+{
+    CHECK( strbytes(0) == "0 B" );
+    CHECK( strbytes(1023) == "1023 B" );
+    CHECK( strbytes(1024) == "1.0 KiB" );
+    CHECK( strbytes(1536) == "1.5 KiB" );
+    CHECK( strbytes(5 * 1024 * 1024) == "5.0 MiB" );
+}
+
+TEST_CASE("Testing MemoryUsageLogger class", "[MemoryUsage]")
+{
+    Index calls = 0;
+
+    MemoryUsageLogger logger([&]
+    {
+        ++calls;
+        MemoryUsage usage;
+        usage.name = "Object";
+        usage.add("A", 2048);
+        return usage;
+    });
+
+    Strings lines;
+    logger.setWriter([&](String const& line) { lines.push_back(line); });
+    logger.setInterval(3);
+
+    for(auto i = 0; i < 7; ++i)
+        logger.step();
+
+    CHECK( logger.steps() == 7 );
+    CHECK( calls == 2 );
+    REQUIRE( lines.size() == 2 );
+    CHECK( lines[0].find("[memory] step 3: Object 2.0 KiB (A 2.0 KiB)") == 0 );
+    CHECK( lines[1].find("[memory] step 6: Object 2.0 KiB (A 2.0 KiB)") == 0 );
+
+    logger.log();
+    CHECK( lines.size() == 3 );
+
+    logger.setInterval(0);
+    CHECK_FALSE( logger.step() );
+    CHECK( lines.size() == 3 );
+}
@@ -0,0 +1,296 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "Profiler.hpp"
+
+// C++ includes
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Table.hpp>
+
+namespace Reaktoro {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// The execution of a profiled region recorded for the Chrome trace output.
+struct ProfilerEvent
+{
+    /// The index of the executed region in the regions of its thread.
+    Index iregion;
+
+    /// The start time of the execution since the creation of the profiler (in μs).
+    double start;
+
+    /// The duration of the execution (in μs).
+    double duration;
+};
+
+/// A region being executed in a thread.
+struct ProfilerFrame
+{
+    /// The index of the region in the regions of its thread.
+    Index iregion;
+
+    /// The time at which the execution of the region started.
+    Clock::time_point start;
+
+    /// The time spent so far in regions nested in this one (in s).
+    double children = 0.0;
+
+    /// The number of times the profiler was reset when the execution of the region started.
+    Index generation;
+};
+
+/// The profiling data collected in a thread.
+struct ProfilerThreadData
+{
+    /// The mutex protecting the data against concurrent access by its thread and the profiler queries.
+    std::mutex mutex;
+
+    /// The sequential number of the thread.
+    Index thread = 0;
+
+    /// The statistics of the regions profiled in the thread.
+    Vec<ProfilerRegion> regions;
+
+    /// The index of a region in `regions` for each path of enclosing regions.
+    Map<String, Index> regionsByPath;
+
+    /// The index of a region in `regions` for each pair (parent region index plus one, name pointer) already seen.
+    std::map<Pair<Index, Chars>, Index> regionsByParentAndName;
+
+    /// The regions being executed in the thread (innermost last).
+    Vec<ProfilerFrame> stack;
+
+    /// The recorded executions of the regions in the thread.
+    Vec<ProfilerEvent> events;
+};
+
+/// The profiling data collected in all threads.
+struct ProfilerRegistry
+{
+    /// The mutex protecting the list of threads.
+    std::mutex mutex;
+
+    /// The profiling data of each thread (in the order threads were first profiled).
+    Vec<SharedPtr<ProfilerThreadData>> threads;
+
+    /// The time point at which the registry was created, used as the origin of the recorded executions.
+    Clock::time_point origin = Clock::now();
+
+    /// The flag indicating if the executions of the regions should be recorded.
+    std::atomic<bool> tracing{false};
+
+    /// The number of times the profiler was reset (executions started before a reset are discarded).
+    /// The regions are kept with zeroed statistics after a reset, since other threads may be executing them.
+    std::atomic<Index> generation{0};
+};
+
+/// Return the profiling data collected in all threads.
+auto registry() -> ProfilerRegistry&
+{
+    static ProfilerRegistry instance;
+    return instance;
+}
+
+/// Return the profiling data of the calling thread, registering it on first use.
+/// The data is shared with the registry so that it outlives its thread.
+auto threadData() -> ProfilerThreadData&
+{
+    thread_local auto data = []()
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        auto res = std::make_shared<ProfilerThreadData>();
+        res->thread = reg.threads.size();
+        reg.threads.push_back(res);
+        return res;
+    }();
+    return *data;
+}
+
+/// Return the elapsed time between two time points (in s).
+auto seconds(Clock::time_point const& begin, Clock::time_point const& end) -> double
+{
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+/// Return a string with the characters `"` and `\` escaped for its use in a JSON document.
+auto escapeJson(String const& str) -> String
+{
+    String res;
+    res.reserve(str.size());
+    for(auto c : str)
+    {
+        if(c == '"' || c == '\\')
+            res += '\\';
+        res += c;
+    }
+    return res;
+}
+
+} // namespace
+
+auto Profiler::enable(bool tracing) -> void
+{
+    registry().tracing.store(tracing);
+    active.store(true);
+}
+
+auto Profiler::disable() -> void
+{
+    active.store(false);
+}
+
+auto Profiler::reset() -> void
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.generation += 1;
+    for(auto& data : reg.threads)
+    {
+        std::lock_guard<std::mutex> datalock(data->mutex);
+        for(auto& region : data->regions)
+        {
+            region.calls = 0;
+            region.inclusive = 0.0;
+            region.exclusive = 0.0;
+        }
+        data->events.clear();
+    }
+}
+
+auto Profiler::regions() -> Vec<ProfilerRegion>
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    Vec<ProfilerRegion> res;
+    for(auto& data : reg.threads)
+    {
+        std::lock_guard<std::mutex> datalock(data->mutex);
+        for(auto const& region : data->regions)
+            if(region.calls > 0)
+                res.push_back(region);
+    }
+    return res;
+}
+
+auto Profiler::table() -> Table
+{
+    Table table;
+    for(auto const& region : regions())
+    {
+        table.column("Thread").appendInteger(region.thread);
+        table.column("Region").appendString(region.path);
+        table.column("Calls").appendInteger(region.calls);
+        table.column("Inclusive").appendFloat(region.inclusive);
+        table.column("Exclusive").appendFloat(region.exclusive);
+    }
+    return table;
+}
+
+auto Profiler::saveChromeTrace(String const& filepath) -> void
+{
+    std::ofstream file(filepath);
+    errorif(!file, "Could not create file `", filepath, "` to save the profiled regions in the Chrome trace format.");
+
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    auto first = true;
+    for(auto& data : reg.threads)
+    {
+        std::lock_guard<std::mutex> datalock(data->mutex);
+        for(auto const& event : data->events)
+        {
+            file << (first ? "\n" : ",\n");
+            file << "{\"name\": \"" << escapeJson(data->regions[event.iregion].name) << "\", \"cat\": \"reaktoro\", \"ph\": \"X\", ";
+            file << "\"ts\": " << event.start << ", \"dur\": " << event.duration << ", \"pid\": 0, \"tid\": " << data->thread << "}";
+            first = false;
+        }
+    }
+    file << "\n]}\n";
+}
+
+auto ProfilerScope::begin(Chars name) -> void
+{
+    auto& data = threadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    const auto parent = data.stack.empty() ? 0 : data.stack.back().iregion + 1;
+    const auto key = Pair<Index, Chars>{ parent, name };
+
+    auto it = data.regionsByParentAndName.find(key);
+    if(it == data.regionsByParentAndName.end())
+    {
+        // Regions with the same name in the same parent share statistics even if their names are stored at different addresses
+        const auto path = parent == 0 ? String(name) : data.regions[parent - 1].path + "/" + name;
+        auto [jt, inserted] = data.regionsByPath.try_emplace(path, data.regions.size());
+        if(inserted)
+        {
+            ProfilerRegion region;
+            region.name = name;
+            region.path = path;
+            region.depth = data.stack.size();
+            region.thread = data.thread;
+            data.regions.push_back(region);
+        }
+        it = data.regionsByParentAndName.emplace(key, jt->second).first;
+    }
+
+    data.stack.push_back({ it->second, Clock::now(), 0.0, registry().generation.load() });
+    started = true;
+}
+
+auto ProfilerScope::end() -> void
+{
+    const auto now = Clock::now();
+
+    auto& data = threadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    const auto frame = data.stack.back();
+    data.stack.pop_back();
+
+    const auto duration = seconds(frame.start, now);
+
+    if(!data.stack.empty())
+        data.stack.back().children += duration;
+
+    auto& reg = registry();
+
+    if(frame.generation != reg.generation.load())
+        return; // the profiler was reset while the region was being executed
+
+    auto& region = data.regions[frame.iregion];
+    region.calls += 1;
+    region.inclusive += duration;
+    region.exclusive += duration - frame.children;
+
+    if(reg.tracing.load(std::memory_order_relaxed))
+        data.events.push_back({ frame.iregion, 1e6 * seconds(reg.origin, frame.start), 1e6 * duration });
+}
+
+} // namespace Reaktoro
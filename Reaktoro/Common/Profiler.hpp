@@ -0,0 +1,140 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class Table;
+
+/// The accumulated timing statistics of a profiled region of code in a thread.
+struct ProfilerRegion
+{
+    /// The name of the region (e.g., `ChemicalProps::update`).
+    String name;
+
+    /// The names of the enclosing regions and this region separated by `/` (e.g., `EquilibriumSolver::solve/ChemicalProps::update`).
+    String path;
+
+    /// The number of regions enclosing this region.
+    Index depth = 0;
+
+    /// The sequential number of the thread in which the region was executed (in the order threads were first profiled).
+    Index thread = 0;
+
+    /// The number of times the region was executed.
+    Index calls = 0;
+
+    /// The accumulated time spent in the region, including its nested regions (in s).
+    double inclusive = 0.0;
+
+    /// The accumulated time spent in the region, excluding its nested regions (in s).
+    double exclusive = 0.0;
+};
+
+/// Used to collect hierarchical timing statistics of named regions of code at runtime.
+/// Regions of code are profiled with @ref ProfilerScope objects, often created
+/// with the @ref REAKTORO_PROFILE macro. Profiling is disabled by default, in
+/// which case a profiled region costs a single relaxed atomic load. When
+/// enabled, the statistics of each region are accumulated per thread and per
+/// path of enclosing regions. The individual executions of the regions can
+/// also be recorded and saved in the Chrome trace format (which can be viewed
+/// in Perfetto or `chrome://tracing`). Compile with `REAKTORO_DISABLE_PROFILING`
+/// to remove all profiled regions from the library.
+class Profiler
+{
+public:
+    /// Enable the profiling of regions of code.
+    /// @param tracing The flag indicating if each execution of a region should be recorded for @ref saveChromeTrace.
+    static auto enable(bool tracing = false) -> void;
+
+    /// Disable the profiling of regions of code.
+    static auto disable() -> void;
+
+    /// Return true if the profiling of regions of code is enabled.
+    static auto enabled() -> bool { return active.load(std::memory_order_relaxed); }
+
+    /// Discard all statistics and recorded executions collected so far.
+    static auto reset() -> void;
+
+    /// Return the statistics of all profiled regions ordered by thread and then by first execution.
+    static auto regions() -> Vec<ProfilerRegion>;
+
+    /// Return a table with the statistics of all profiled regions (one row per region).
+    static auto table() -> Table;
+
+    /// Save the recorded executions of the profiled regions to a file in the Chrome trace format.
+    /// Executions are recorded only if profiling was enabled with `tracing` set to true.
+    static auto saveChromeTrace(String const& filepath) -> void;
+
+private:
+    /// The flag indicating if the profiling of regions of code is enabled.
+    inline static std::atomic<bool> active{false};
+};
+
+/// Used to profile a region of code between the construction and destruction of this object.
+class ProfilerScope
+{
+public:
+    /// Construct a ProfilerScope object and start profiling a region with given name if profiling is enabled.
+    /// @param name The name of the region, which must outlive the profiling session (e.g., a string literal)
+    explicit ProfilerScope(Chars name) { if(Profiler::enabled()) begin(name); }
+
+    /// Destroy this ProfilerScope object and finish profiling its region.
+    ~ProfilerScope() { if(started) end(); }
+
+    /// Deleted copy constructor (a region of code is profiled by a single object).
+    ProfilerScope(ProfilerScope const&) = delete;
+
+    /// Deleted copy assignment operator (a region of code is profiled by a single object).
+    auto operator=(ProfilerScope const&) -> ProfilerScope& = delete;
+
+private:
+    /// Start profiling the region.
+    auto begin(Chars name) -> void;
+
+    /// Finish profiling the region.
+    auto end() -> void;
+
+    /// The flag indicating if the region is being profiled.
+    bool started = false;
+};
+
+#define REAKTORO_PROFILE_CONCAT_IMPL(a, b) a##b
+#define REAKTORO_PROFILE_CONCAT(a, b) REAKTORO_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef REAKTORO_DISABLE_PROFILING
+
+/// Macro to profile the remaining statements of the current scope as a named region.
+#define REAKTORO_PROFILE(name)
+
+#else
+
+/// Macro to profile the remaining statements of the current scope as a named region.
+#define REAKTORO_PROFILE(name) ::Reaktoro::ProfilerScope REAKTORO_PROFILE_CONCAT(__profiler_scope_, __LINE__)(name)
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace Reaktoro
@@ -0,0 +1,49 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+#include <Reaktoro/Common/Table.hpp>
+using namespace Reaktoro;
+
+void exportProfiler(py::module& m)
+{
+    py::class_<ProfilerRegion>(m, "ProfilerRegion")
+        .def(py::init<>())
+        .def_readwrite("name", &ProfilerRegion::name, "The name of the region.")
+        .def_readwrite("path", &ProfilerRegion::path, "The names of the enclosing regions and this region separated by `/`.")
+        .def_readwrite("depth", &ProfilerRegion::depth, "The number of regions enclosing this region.")
+        .def_readwrite("thread", &ProfilerRegion::thread, "The sequential number of the thread in which the region was executed.")
+        .def_readwrite("calls", &ProfilerRegion::calls, "The number of times the region was executed.")
+        .def_readwrite("inclusive", &ProfilerRegion::inclusive, "The accumulated time spent in the region, including its nested regions (in s).")
+        .def_readwrite("exclusive", &ProfilerRegion::exclusive, "The accumulated time spent in the region, excluding its nested regions (in s).")
+        ;
+
+    py::class_<Profiler>(m, "Profiler")
+        .def_static("enable", &Profiler::enable, "Enable the profiling of regions of code.", py::arg("tracing") = false)
+        .def_static("disable", &Profiler::disable, "Disable the profiling of regions of code.")
+        .def_static("enabled", &Profiler::enabled, "Return true if the profiling of regions of code is enabled.")
+        .def_static("reset", &Profiler::reset, "Discard all statistics and recorded executions collected so far.")
+        .def_static("regions", &Profiler::regions, "Return the statistics of all profiled regions.")
+        .def_static("table", &Profiler::table, "Return a table with the statistics of all profiled regions (one row per region).")
+        .def_static("saveChromeTrace", &Profiler::saveChromeTrace, "Save the recorded executions of the profiled regions to a file in the Chrome trace format.")
+        ;
+}
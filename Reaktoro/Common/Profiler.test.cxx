@@ -0,0 +1,159 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+#include <Reaktoro/Common/Table.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+auto inner() -> void
+{
+    REAKTORO_PROFILE("inner");
+    volatile double sum = 0.0;
+    for(auto i = 0; i < 1000; ++i)
+        sum += i;
+}
+
+auto outer() -> void
+{
+    REAKTORO_PROFILE("outer");
+    inner();
+    inner();
+}
+
+auto find(Vec<ProfilerRegion> const& regions, String const& path) -> ProfilerRegion const*
+{
+    for(auto const& region : regions)
+        if(region.path == path)
+            return &region;
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("Testing Profiler", "[Profiler]")
+{
+    Profiler::disable();
+    Profiler::reset();
+
+    SECTION("Checking nothing is collected when profiling is disabled")
+    {
+        outer();
+        CHECK( Profiler::regions().empty() );
+    }
+
+    SECTION("Checking the statistics of nested regions")
+    {
+        Profiler::enable();
+        outer();
+        outer();
+        inner();
+        Profiler::disable();
+
+        auto const regions = Profiler::regions();
+
+        auto const* router = find(regions, "outer");
+        auto const* rinner = find(regions, "outer/inner");
+        auto const* rtop = find(regions, "inner");
+
+        REQUIRE( router );
+        REQUIRE( rinner );
+        REQUIRE( rtop );
+
+        CHECK( router->calls == 2 );
+        CHECK( rinner->calls == 4 );
+        CHECK( rtop->calls == 1 );
+
+        CHECK( router->depth == 0 );
+        CHECK( rinner->depth == 1 );
+        CHECK( rinner->name == "inner" );
+
+        CHECK( router->exclusive <= router->inclusive );
+        CHECK( router->inclusive >= rinner->inclusive );
+        CHECK( router->exclusive == Approx(router->inclusive - rinner->inclusive) );
+        CHECK( rinner->exclusive == rinner->inclusive );
+
+        Table table = Profiler::table();
+        CHECK( table.rows() == 3 );
+
+        Profiler::reset();
+        CHECK( Profiler::regions().empty() );
+    }
+
+    SECTION("Checking regions are collected per thread")
+    {
+        Profiler::enable();
+        std::thread t1([] { outer(); });
+        std::thread t2([] { outer(); outer(); });
+        t1.join();
+        t2.join();
+        Profiler::disable();
+
+        auto const regions = Profiler::regions();
+
+        Index calls = 0;
+        Set<Index> threads;
+        for(auto const& region : regions)
+        {
+            if(region.path == "outer")
+            {
+                calls += region.calls;
+                threads.insert(region.thread);
+            }
+        }
+
+        CHECK( calls == 3 );
+        CHECK( threads.size() == 2 );
+    }
+
+    SECTION("Checking the executions of regions are saved in the Chrome trace format")
+    {
+        Profiler::enable(true);
+        outer();
+        Profiler::disable();
+
+        const auto filepath = "Profiler.test.trace.json";
+        Profiler::saveChromeTrace(filepath);
+
+        std::ifstream file(filepath);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        const auto contents = ss.str();
+        file.close();
+        std::remove(filepath);
+
+        CHECK( contents.find("\"traceEvents\"") != String::npos );
+        CHECK( contents.find("\"name\": \"outer\"") != String::npos );
+        CHECK( contents.find("\"name\": \"inner\"") != String::npos );
+        CHECK( contents.find("\"ph\": \"X\"") != String::npos );
+    }
+
+    Profiler::disable();
+    Profiler::reset();
+}
@@ -25,4 +25,10 @@ namespace Reaktoro {
 /// The number type used throughout the library.
 using real = autodiff::real;
 
+/// Return true if two real numbers have the same value and derivative.
+inline auto identical(real const& a, real const& b) -> bool
+{
+    return a[0] == b[0] && a[1] == b[1];
+}
+
 } // namespace Reaktoro
@@ -18,18 +18,23 @@
 #include "Table.hpp"
 
 // C++ includes
+#include <cstdint>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 
 namespace Reaktoro {
 namespace {
 
+using detail::writeBinary;
+using detail::readBinary;
+
 // Convenient alias for this translation unit.
 using DataType = TableColumn::DataType;
 
@@ -67,7 +72,7 @@ auto appendNewValue(Any& data, DataType& datatype, T const& value, Chars strvalu
 {
     if(!data.has_value())
     {
-        data = Deque<T>();
+        data = Vec<T>();
         datatype = type;
     }
 
@@ -76,8 +81,8 @@ auto appendNewValue(Any& data, DataType& datatype, T const& value, Chars strvalu
         "Make sure that after inserting the first value into a table column, the **same value type** is used for all subsequent inserts. "
         "Note that integer values can be stored as floating-point values in a table column of floats. No other conversion is supported.");
 
-    auto& deque = std::any_cast<Deque<T>&>(data);
-    deque.push_back(value);
+    auto& values = std::any_cast<Vec<T>&>(data);
+    values.push_back(value);
 }
 
 /// Convert a TableColumn object to a vector of strings representing the column's data along its rows.
@@ -144,6 +149,39 @@ auto outputTable(Stream& stream, Table const& table, Table::OutputOptions const&
     }
 }
 
+/// The identifier written at the beginning of a binary table file.
+const String binaryTableTag = "RKTTABLE";
+
+/// The version of the binary table file format.
+const std::uint32_t binaryTableVersion = 1;
+
+/// Write the values in a table column to a binary stream.
+auto writeBinaryTableColumn(std::ostream& out, TableColumn const& column)
+{
+    const auto rows = column.rows();
+    switch(column.dataType())
+    {
+        case DataType::Float: writeBinary(out, column.floats().data(), rows); break;
+        case DataType::Integer: for(auto value : column.integers()) writeBinary(out, std::int64_t(value)); break; // long has different sizes across platforms
+        case DataType::String: for(auto const& value : column.strings()) writeBinary(out, value); break;
+        case DataType::Boolean: for(auto value : column.booleans()) writeBinary(out, std::uint8_t(value)); break; // Vec<bool> is not stored as contiguous bool values
+        default: break;
+    }
+}
+
+/// Read the values of a table column from a binary stream.
+auto readBinaryTableColumn(std::istream& in, TableColumn& column, DataType datatype, Index rows)
+{
+    switch(datatype)
+    {
+        case DataType::Float: for(auto i = 0; i < rows; ++i) { double value; readBinary(in, value); column.appendFloat(value); } break;
+        case DataType::Integer: for(auto i = 0; i < rows; ++i) { std::int64_t value; readBinary(in, value); column.appendInteger(value); } break;
+        case DataType::String: for(auto i = 0; i < rows; ++i) { String value; readBinary(in, value); column.appendString(value); } break;
+        case DataType::Boolean: for(auto i = 0; i < rows; ++i) { std::uint8_t value; readBinary(in, value); column.appendBoolean(value); } break;
+        default: break;
+    }
+}
+
 } // anonymous namespace
 
 TableColumn::TableColumn()
@@ -178,52 +216,52 @@ auto TableColumn::dataType() const -> DataType
     return datatype;
 }
 
-auto TableColumn::floats() const -> Deque<double> const&
+auto TableColumn::floats() const -> Vec<double> const&
 {
     errorif(datatype != DataType::Float, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to values a list of of floating-point type.");
-    return std::any_cast<Deque<double> const&>(data);
+    return std::any_cast<Vec<double> const&>(data);
 }
 
-auto TableColumn::floats() -> Deque<double>&
+auto TableColumn::floats() -> Vec<double>&
 {
     errorif(datatype != DataType::Float, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to values a list of of floating-point type.");
-    return std::any_cast<Deque<double>&>(data);
+    return std::any_cast<Vec<double>&>(data);
 }
 
-auto TableColumn::integers() const -> Deque<long> const&
+auto TableColumn::integers() const -> Vec<long> const&
 {
     errorif(datatype != DataType::Integer, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of integer type.");
-    return std::any_cast<Deque<long> const&>(data);
+    return std::any_cast<Vec<long> const&>(data);
 }
 
-auto TableColumn::integers() -> Deque<long>&
+auto TableColumn::integers() -> Vec<long>&
 {
     errorif(datatype != DataType::Integer, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of integer type.");
-    return std::any_cast<Deque<long>&>(data);
+    return std::any_cast<Vec<long>&>(data);
 }
 
-auto TableColumn::strings() const -> Deque<String> const&
+auto TableColumn::strings() const -> Vec<String> const&
 {
     errorif(datatype != DataType::String, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of string type.");
-    return std::any_cast<Deque<String> const&>(data);
+    return std::any_cast<Vec<String> const&>(data);
 }
 
-auto TableColumn::strings() -> Deque<String>&
+auto TableColumn::strings() -> Vec<String>&
 {
     errorif(datatype != DataType::String, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of string type.");
-    return std::any_cast<Deque<String>&>(data);
+    return std::any_cast<Vec<String>&>(data);
 }
 
-auto TableColumn::booleans() const -> Deque<bool> const&
+auto TableColumn::booleans() const -> Vec<bool> const&
 {
     errorif(datatype != DataType::Boolean, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of boolean type.");
-    return std::any_cast<Deque<bool> const&>(data);
+    return std::any_cast<Vec<bool> const&>(data);
 }
 
-auto TableColumn::booleans() -> Deque<bool>&
+auto TableColumn::booleans() -> Vec<bool>&
 {
     errorif(datatype != DataType::Boolean, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of boolean type.");
-    return std::any_cast<Deque<bool>&>(data);
+    return std::any_cast<Vec<bool>&>(data);
 }
 
 auto TableColumn::rows() const -> Index
@@ -236,10 +274,10 @@ auto TableColumn::operator[](Index row) const -> std::variant<double, long, Stri
     errorifnot(row < mrows, "Given row index, ", row, ", is greater than number of rows in the table column, ", mrows, ".");
     switch(datatype)
     {
-        case DataType::Float:     return std::any_cast<Deque<double> const&>(data)[row];
-        case DataType::Integer:   return std::any_cast<Deque<long> const&>(data)[row];
-        case DataType::String:    return std::any_cast<Deque<String> const&>(data)[row];
-        case DataType::Boolean:   return std::any_cast<Deque<bool> const&>(data)[row];
+        case DataType::Float:     return std::any_cast<Vec<double> const&>(data)[row];
+        case DataType::Integer:   return std::any_cast<Vec<long> const&>(data)[row];
+        case DataType::String:    return std::any_cast<Vec<String> const&>(data)[row];
+        case DataType::Boolean:   return std::any_cast<Vec<bool> const&>(data)[row];
         default: return NaN;
     }
 }
@@ -266,7 +304,7 @@ auto Table::column(String const& columnname) -> TableColumn&
     return mcolumns[columnname];
 }
 
-auto Table::operator[](String const& columnname) const -> Deque<double> const&
+auto Table::operator[](String const& columnname) const -> Vec<double> const&
 {
     auto& col = column(columnname);
     auto const& datatype = col.dataType();
@@ -276,9 +314,9 @@ auto Table::operator[](String const& columnname) const -> Deque<double> const&
     return col.floats();
 }
 
-auto Table::operator[](String const& columnname) -> Deque<double>&
+auto Table::operator[](String const& columnname) -> Vec<double>&
 {
-    return const_cast<Deque<double>&>(std::as_const(*this)[columnname]);
+    return const_cast<Vec<double>&>(std::as_const(*this)[columnname]);
 }
 
 auto Table::rows() const -> Index
@@ -307,6 +345,54 @@ auto Table::save(String const& filepath, OutputOptions const& outputopts) const
     outputTable(file, *this, outputopts);
 }
 
+auto Table::saveBinary(String const& filepath) const -> void
+{
+    std::ofstream file(filepath, std::ios::binary);
+    errorif(!file, "Could not create file `", filepath, "` to save the Table object.");
+    file.write(binaryTableTag.data(), binaryTableTag.size());
+    writeBinary(file, binaryTableVersion);
+    writeBinary(file, std::uint64_t(cols()));
+    for(auto const& [name, column] : mcolumns)
+    {
+        writeBinary(file, name);
+        writeBinary(file, std::int32_t(column.dataType()));
+        writeBinary(file, std::uint64_t(column.rows()));
+        writeBinaryTableColumn(file, column);
+    }
+}
+
+auto Table::loadBinary(String const& filepath) -> Table
+{
+    std::ifstream file(filepath, std::ios::binary);
+    errorif(!file, "Could not open file `", filepath, "` to load a Table object.");
+
+    String tag(binaryTableTag.size(), ' ');
+    file.read(tag.data(), tag.size());
+    errorif(tag != binaryTableTag, "The file `", filepath, "` is not a binary table file created with Table::saveBinary.");
+
+    std::uint32_t version = 0;
+    readBinary(file, version);
+    errorif(version != binaryTableVersion, "The binary table file `", filepath, "` has version ", version, " but only version ", binaryTableVersion, " is supported.");
+
+    std::uint64_t numcols = 0;
+    readBinary(file, numcols);
+
+    Table table;
+    for(auto j = 0; j < numcols; ++j)
+    {
+        String name;
+        std::int32_t datatype = 0;
+        std::uint64_t rows = 0;
+        readBinary(file, name);
+        readBinary(file, datatype);
+        readBinary(file, rows);
+        readBinaryTableColumn(file, table.column(name), DataType(datatype), rows);
+        errorif(!file, "The binary table file `", filepath, "` is truncated or corrupted.");
+    }
+
+    return table;
+}
+
 Table::OutputOptions::OutputOptions()
 : delimiter(" | "), precision(6), scientific(false), fixed(false)
 {}
@@ -25,6 +25,9 @@
 namespace Reaktoro {
 
 /// Used to represent the data stored in a table column.
+/// The values of a column are stored contiguously (e.g., in a `Vec<double>`
+/// object), so that columns of floats and integers can be handed to other
+/// libraries (e.g., NumPy) without copying.
 /// @see Table
 class TableColumn
 {
@@ -61,37 +64,37 @@ public:
     /// Get the data type of the column.
     auto dataType() const -> DataType;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<double>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<double>` object.
     /// @warning If the column data type is not DataType::Float, a runtime error is thrown.
-    auto floats() const -> Deque<double> const&;
+    auto floats() const -> Vec<double> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<double>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<double>` object.
     /// @warning If the column data type is not DataType::Float, a runtime error is thrown.
-    auto floats() -> Deque<double>&; // TODO: These methods in Table that return Deque<T>& are dangerous in which the user can change its length, and this will not be reflected in mrows. Replace this by std::span when migrating to C++20.
+    auto floats() -> Vec<double>&; // TODO: These methods in Table that return Vec<T>& are dangerous in which the user can change its length, and this will not be reflected in mrows. Replace this by std::span when migrating to C++20.
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<long>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<long>` object.
     /// @warning If the column data type is not DataType::Integer, a runtime error is thrown.
-    auto integers() const -> Deque<long> const&;
+    auto integers() const -> Vec<long> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<long>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<long>` object.
     /// @warning If the column data type is not DataType::Integer, a runtime error is thrown.
-    auto integers() -> Deque<long>&;
+    auto integers() -> Vec<long>&;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<String>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<String>` object.
     /// @warning If the column data type is not DataType::String, a runtime error is thrown.
-    auto strings() const -> Deque<String> const&;
+    auto strings() const -> Vec<String> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<String>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<String>` object.
     /// @warning If the column data type is not DataType::String, a runtime error is thrown.
-    auto strings() -> Deque<String>&;
+    auto strings() -> Vec<String>&;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<bool>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<bool>` object.
     /// @warning If the column data type is not DataType::Bool, a runtime error is thrown.
-    auto booleans() const -> Deque<bool> const&;
+    auto booleans() const -> Vec<bool> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<bool>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<bool>` object.
     /// @warning If the column data type is not DataType::Bool, a runtime error is thrown.
-    auto booleans() -> Deque<bool>&;
+    auto booleans() -> Vec<bool>&;
 
     /// Get the number of rows in the column.
     auto rows() const -> Index;
@@ -142,14 +145,14 @@ public:
 
     /// Cast this TableColumn object to a mutable reference to a list of values with type compatible with given one.
     template<typename T>
-    auto cast() -> Deque<T>&
+    auto cast() -> Vec<T>&
     {
-        return const_cast<Deque<T>&>(std::as_const(*this).cast<T>());
+        return const_cast<Vec<T>&>(std::as_const(*this).cast<T>());
     }
 
     /// Cast this TableColumn object to a constant reference to a list of values with type compatible with given one.
     template<typename T>
-    auto cast() const -> Deque<T> const&
+    auto cast() const -> Vec<T> const&
     {
         if constexpr(isSame<T, bool>)
             return booleans();
@@ -163,7 +166,7 @@ public:
     }
 
 private:
-    /// The values stored in this table column (e.g., `Deque<double>`, `Deque<long>`, `Deque<String>`, `Deque<bool>`).
+    /// The values stored in this table column (e.g., `Vec<double>`, `Vec<long>`, `Vec<String>`, `Vec<bool>`).
     Any data;
 
     /// The number of rows in the column.
@@ -190,10 +193,10 @@ public:
     auto column(String const& columnname) -> TableColumn&;
 
     /// Get a constant reference to a column in the table with given name.
-    auto operator[](String const& columnname) const -> Deque<double> const&;
+    auto operator[](String const& columnname) const -> Vec<double> const&;
 
     /// Get a mutable reference to a column in the table with given name.
-    auto operator[](String const& columnname) -> Deque<double>&;
+    auto operator[](String const& columnname) -> Vec<double>&;
 
     /// Get the number of rows in the table (i.e., the length of the longest column in the table).
     auto rows() const -> Index;
@@ -230,6 +233,18 @@ public:
     /// @warning Ensure that the path given exists; no directories are created in this method call.
     auto save(String const& filepath, OutputOptions const& outputopts = {}) const -> void;
 
+    /// Save the Table object to a file in binary columnar format.
+    /// The values of each column are written in a contiguous block, without
+    /// conversion to text, which is much faster and more compact than @ref
+    /// save for tables with many rows. Use @ref loadBinary to read the file.
+    /// @param filepath The path to the file that will be created, including its file name (e.g., `table.bin`).
+    /// @warning Ensure that the path given exists; no directories are created in this method call.
+    auto saveBinary(String const& filepath) const -> void;
+
+    /// Load a Table object from a file created with @ref saveBinary.
+    /// @param filepath The path to the file.
+    static auto loadBinary(String const& filepath) -> Table;
+
 private:
     /// The named columns and their stored values in the table.
     Dict<String, TableColumn> mcolumns;
@@ -225,6 +225,9 @@ def testTable():
     assert table.column("Strings").strings()   == ["Hello", "World", "!"]
     assert table.column("Booleans").booleans() == [True, False]
 
+    assert list(table.column("Floats").floatsArray())     == [10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0]
+    assert list(table.column("Integers").integersArray()) == [1, 2, 3, 4, 5]
+
     #----------------------------------------------------------------------------------------------------
     # Checking method TableColumn.dump
     #----------------------------------------------------------------------------------------------------
@@ -50,14 +50,16 @@ void exportTable(py::module& m)
         .def("appendString", &TableColumn::appendString, "Append a new string value to the TableColumn object.")
         .def("appendBoolean", &TableColumn::appendBoolean, "Append a new boolean value to the TableColumn object.")
         .def("dataType", &TableColumn::dataType, "Get the data type of the column.")
-        .def("floats", py::overload_cast<>(&TableColumn::floats, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<double>` object.")
-        .def("floats", py::overload_cast<>(&TableColumn::floats), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<double>` object.")
-        .def("integers", py::overload_cast<>(&TableColumn::integers, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<long>` object.")
-        .def("integers", py::overload_cast<>(&TableColumn::integers), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<long>` object.")
-        .def("strings", py::overload_cast<>(&TableColumn::strings, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<String>` object.")
-        .def("strings", py::overload_cast<>(&TableColumn::strings), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<String>` object.")
-        .def("booleans", py::overload_cast<>(&TableColumn::booleans, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<bool>` object.")
-        .def("booleans", py::overload_cast<>(&TableColumn::booleans), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<bool>` object.")
+        .def("floats", py::overload_cast<>(&TableColumn::floats, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<double>` object.")
+        .def("floats", py::overload_cast<>(&TableColumn::floats), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<double>` object.")
+        .def("integers", py::overload_cast<>(&TableColumn::integers, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<long>` object.")
+        .def("integers", py::overload_cast<>(&TableColumn::integers), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<long>` object.")
+        .def("strings", py::overload_cast<>(&TableColumn::strings, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<String>` object.")
+        .def("strings", py::overload_cast<>(&TableColumn::strings), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<String>` object.")
+        .def("booleans", py::overload_cast<>(&TableColumn::booleans, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<bool>` object.")
+        .def("booleans", py::overload_cast<>(&TableColumn::booleans), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<bool>` object.")
+        .def("floatsArray", [](TableColumn& self) { auto& values = self.floats(); return Eigen::Map<ArrayXd>(values.data(), values.size()); }, return_internal_ref, "Return a NumPy array viewing the floating-point values of the column without copying them (invalidated once a new value is appended).")
+        .def("integersArray", [](TableColumn& self) { auto& values = self.integers(); return Eigen::Map<Eigen::Array<long, -1, 1>>(values.data(), values.size()); }, return_internal_ref, "Return a NumPy array viewing the integer values of the column without copying them (invalidated once a new value is appended).")
         .def("rows", &TableColumn::rows, "Get the number of rows in the column.")
         .def("__getitem__", [](TableColumn const& self, int irow) { return self[irow]; } )
         .def("append", [](TableColumn& self, bool value) { self.append(value); }, "Append a new value to the TableColumn object.")
@@ -92,6 +94,8 @@ void exportTable(py::module& m)
         .def("cols", &Table::cols, "Get the number of columns in the table.")
         .def("dump", &Table::dump, "Assemble a string representation of the Table object.", "outputopts"_a = Table::OutputOptions())
         .def("save", &Table::save, "Save the Table object to a file.", "filepath"_a, "outputopts"_a = Table::OutputOptions())
+        .def("saveBinary", &Table::saveBinary, "Save the Table object to a file in binary columnar format.", "filepath"_a)
+        .def_static("loadBinary", &Table::loadBinary, "Load a Table object from a file created with saveBinary.", "filepath"_a)
         .def("__str__", [](Table const& self) { return self.dump(); })
         ;
 }
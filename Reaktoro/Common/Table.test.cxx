@@ -18,6 +18,9 @@
 // Catch includes
 #include <catch2/catch.hpp>
 
+// C++ includes
+#include <cstdio>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Table.hpp>
@@ -80,10 +83,10 @@ TEST_CASE("Testing class Table", "[Table]")
         // Checking conversion methods TableColumn::floats|integers|strings|booleans
         //----------------------------------------------------------------------------------------------------
 
-        CHECK( table.column("Floats").floats()     == Deque<double>{0.0, 1.0, 2.0, 3.0, 4.0} );
-        CHECK( table.column("Integers").integers() == Deque<long>{2, 3, 4, 5} );
-        CHECK( table.column("Strings").strings()   == Deque<String>{"Hello", "World", "!"} );
-        CHECK( table.column("Booleans").booleans() == Deque<bool>{true, false} );
+        CHECK( table.column("Floats").floats()     == Vec<double>{0.0, 1.0, 2.0, 3.0, 4.0} );
+        CHECK( table.column("Integers").integers() == Vec<long>{2, 3, 4, 5} );
+        CHECK( table.column("Strings").strings()   == Vec<String>{"Hello", "World", "!"} );
+        CHECK( table.column("Booleans").booleans() == Vec<bool>{true, false} );
 
         CHECK_THROWS( table.column("Floats").integers() );
         CHECK_THROWS( table.column("Floats").strings() );
@@ -212,10 +215,10 @@ TEST_CASE("Testing class Table", "[Table]")
         CHECK( table.column("Strings").dataType()  == TableColumn::DataType::String );
         CHECK( table.column("Booleans").dataType() == TableColumn::DataType::Boolean );
 
-        CHECK( table.column("Floats").floats()     == Deque<double>{10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0} );
-        CHECK( table.column("Integers").integers() == Deque<long>{1, 2, 3, 4, 5} );
-        CHECK( table.column("Strings").strings()   == Deque<String>{"Hello", "World", "!"} );
-        CHECK( table.column("Booleans").booleans() == Deque<bool>{true, false} );
+        CHECK( table.column("Floats").floats()     == Vec<double>{10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0} );
+        CHECK( table.column("Integers").integers() == Vec<long>{1, 2, 3, 4, 5} );
+        CHECK( table.column("Strings").strings()   == Vec<String>{"Hello", "World", "!"} );
+        CHECK( table.column("Booleans").booleans() == Vec<bool>{true, false} );
 
         //----------------------------------------------------------------------------------------------------
         // Checking method TableColumn::dump
@@ -233,4 +236,34 @@ TEST_CASE("Testing class Table", "[Table]")
             "70.0000 |          |         |         ");
 #endif
     }
+
+    SECTION("Testing binary columnar output using Table::saveBinary and Table::loadBinary")
+    {
+        Table table;
+
+        table.column("Floats") << 10.0 << 20 << 30.0 << 40 << 50.0;
+        table.column("Integers") << 1 << 2 << 3;
+        table.column("Strings") << "Hello" << String("World") << "!";
+        table.column("Booleans") << true << false;
+
+        const auto filepath = "Table.test.bin";
+
+        table.saveBinary(filepath);
+
+        const auto loaded = Table::loadBinary(filepath);
+
+        std::remove(filepath);
+
+        CHECK( loaded.rows() == 5 );
+        CHECK( loaded.cols() == 4 );
+
+        CHECK( loaded.column("Floats").floats()     == Vec<double>{10.0, 20.0, 30.0, 40.0, 50.0} );
+        CHECK( loaded.column("Integers").integers() == Vec<long>{1, 2, 3} );
+        CHECK( loaded.column("Strings").strings()   == Vec<String>{"Hello", "World", "!"} );
+        CHECK( loaded.column("Booleans").booleans() == Vec<bool>{true, false} );
+
+        CHECK( loaded.dump() == table.dump() );
+
+        CHECK_THROWS( Table::loadBinary("Table.test.does.not.exist.bin") );
+    }
 }
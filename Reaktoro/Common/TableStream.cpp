@@ -0,0 +1,361 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "TableStream.hpp"
+
+// C++ includes
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+using detail::writeBinary;
+using detail::readBinary;
+
+/// The identifier written at the beginning of a binary table stream file.
+const String binaryTableStreamTag = "RKTSTREAM";
+
+/// The version of the binary table stream file format.
+const std::uint32_t binaryTableStreamVersion = 1;
+
+} // namespace
+
+struct TableStream::Impl
+{
+    /// The names of the columns in the table.
+    const Strings columns;
+
+    /// The format of the file.
+    const Format format;
+
+    /// The number of rows in each chunk handed to the background writer.
+    const Index chunksize;
+
+    /// The formatting options used when the format is Format::Text.
+    const Table::OutputOptions outputopts;
+
+    /// The output file (only accessed by the background writer once it has started).
+    std::ofstream file;
+
+    /// The chunk being filled by the calling thread, with values stored row after row.
+    Vec<double> active;
+
+    /// The number of rows in the chunk being filled.
+    Index activerows = 0;
+
+    /// The chunk handed to the background writer, with values stored row after row.
+    Vec<double> pending;
+
+    /// The number of rows in the chunk handed to the background writer.
+    Index pendingrows = 0;
+
+    /// The auxiliary buffer used to transpose a chunk into columns in Format::Binary.
+    Vec<double> columnar;
+
+    /// The auxiliary stream used to format a chunk in Format::Text.
+    std::ostringstream ss;
+
+    /// The total number of rows appended so far.
+    Index numrows = 0;
+
+    /// The background thread writing the chunks to the file.
+    std::thread writer;
+
+    /// The mutex protecting the hand over of chunks to the background writer.
+    std::mutex mutex;
+
+    /// The condition variable used to wake up the background writer when a chunk is pending.
+    std::condition_variable cvpending;
+
+    /// The condition variable used to notify the calling thread that the pending chunk was written.
+    std::condition_variable cvwritten;
+
+    /// The flag indicating a chunk is pending to be written by the background writer.
+    bool haspending = false;
+
+    /// The flag indicating the background writer is being stopped.
+    bool stopping = false;
+
+    /// The flag indicating the stream has been closed.
+    bool closed = false;
+
+    /// The exception thrown while writing a chunk (rethrown in the calling thread).
+    std::exception_ptr failure;
+
+    /// Construct a TableStream::Impl object.
+    Impl(String const& filepath, Strings const& columns, Format format, Index chunksize, Table::OutputOptions const& outputopts)
+    : columns(columns), format(format), chunksize(chunksize), outputopts(outputopts)
+    {
+        errorif(columns.empty(), "Cannot create a TableStream object without columns.");
+        errorif(chunksize == 0, "Cannot create a TableStream object with a chunk size of zero rows.");
+
+        file.open(filepath, format == Format::Binary ? std::ios::out | std::ios::binary : std::ios::out);
+        errorif(!file, "Could not create file `", filepath, "` to write the TableStream object.");
+
+        writeHeader();
+
+        active.resize(chunksize * columns.size());
+        pending.resize(chunksize * columns.size());
+
+        if(outputopts.scientific) ss << std::scientific;
+        if(outputopts.fixed) ss << std::fixed;
+        ss << std::showpoint;
+        ss << std::setprecision(outputopts.precision);
+
+        writer = std::thread([this] { work(); });
+    }
+
+    /// Destroy this TableStream::Impl object.
+    ~Impl()
+    {
+        try { close(); }
+        catch(...) {} // errors while writing the last chunk cannot be propagated from a destructor
+    }
+
+    /// Write the column names at the beginning of the file.
+    auto writeHeader() -> void
+    {
+        if(format == Format::Binary)
+        {
+            file.write(binaryTableStreamTag.data(), binaryTableStreamTag.size());
+            writeBinary(file, binaryTableStreamVersion);
+            writeBinary(file, std::uint64_t(columns.size()));
+            for(auto const& name : columns)
+                writeBinary(file, name);
+        }
+        else
+        {
+            auto const& delimiter = outputopts.delimiter;
+            for(auto j = 0; j < columns.size(); ++j)
+            {
+                auto const& name = columns[j];
+                const auto name_has_delimiter = name.find(delimiter) != String::npos;
+                file << (j > 0 ? delimiter : "") << (name_has_delimiter ? "\"" + name + "\"" : name);
+            }
+            file << "\n";
+        }
+    }
+
+    /// Write a chunk of rows to the file.
+    auto writeChunk(Vec<double> const& values, Index rows) -> void
+    {
+        const auto ncols = columns.size();
+        if(format == Format::Binary)
+        {
+            columnar.resize(rows * ncols);
+            for(auto j = 0; j < ncols; ++j)
+                for(auto i = 0; i < rows; ++i)
+                    columnar[j*rows + i] = values[i*ncols + j];
+            writeBinary(file, std::uint64_t(rows));
+            writeBinary(file, columnar.data(), columnar.size());
+        }
+        else
+        {
+            ss.str("");
+            for(auto i = 0; i < rows; ++i)
+            {
+                for(auto j = 0; j < ncols; ++j)
+                    ss << (j > 0 ? outputopts.delimiter : "") << values[i*ncols + j];
+                ss << "\n";
+            }
+            file << ss.str();
+        }
+        file.flush();
+        errorif(!file, "Could not write to the file of a TableStream object.");
+    }
+
+    /// The loop executed by the background writer.
+    auto work() -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            cvpending.wait(lock, [&] { return stopping || haspending; });
+            if(haspending)
+            {
+                lock.unlock();
+                std::exception_ptr exception;
+                try { writeChunk(pending, pendingrows); }
+                catch(...) { exception = std::current_exception(); }
+                lock.lock();
+                if(exception && !failure)
+                    failure = exception;
+                haspending = false;
+                cvwritten.notify_all();
+            }
+            else if(stopping)
+                return;
+        }
+    }
+
+    /// Rethrow in the calling thread the exception thrown by the background writer, if any.
+    auto rethrowFailure() -> void
+    {
+        if(failure)
+        {
+            auto exception = failure;
+            failure = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// Hand the chunk being filled to the background writer, waiting first for the previous one to be written.
+    auto handover() -> void
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvwritten.wait(lock, [&] { return !haspending; });
+            rethrowFailure();
+            std::swap(active, pending);
+            pendingrows = activerows;
+            activerows = 0;
+            haspending = true;
+        }
+        cvpending.notify_one();
+    }
+
+    auto append(ArrayXdConstRef values) -> void
+    {
+        errorif(closed, "Cannot append a row to a TableStream object that has been closed.");
+        const auto ncols = columns.size();
+        errorif(values.size() != ncols, "Expecting a row with ", ncols, " values to append to the TableStream object, but got one with ", values.size(), " values.");
+        ArrayXd::Map(active.data() + activerows*ncols, ncols) = values;
+        ++activerows;
+        ++numrows;
+        if(activerows == chunksize)
+            handover();
+    }
+
+    auto flush() -> void
+    {
+        if(closed)
+            return;
+        if(activerows > 0)
+            handover();
+        std::unique_lock<std::mutex> lock(mutex);
+        cvwritten.wait(lock, [&] { return !haspending; });
+        rethrowFailure();
+    }
+
+    auto close() -> void
+    {
+        if(closed)
+            return;
+        std::exception_ptr exception;
+        try { flush(); }
+        catch(...) { exception = std::current_exception(); }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cvpending.notify_one();
+        writer.join();
+        file.close();
+        closed = true;
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+};
+
+TableStream::TableStream(String const& filepath, Strings const& columns, Format format, Index chunksize, Table::OutputOptions const& outputopts)
+: pimpl(new Impl(filepath, columns, format, chunksize, outputopts))
+{}
+
+TableStream::~TableStream()
+{}
+
+auto TableStream::columns() const -> Strings const&
+{
+    return pimpl->columns;
+}
+
+auto TableStream::rows() const -> Index
+{
+    return pimpl->numrows;
+}
+
+auto TableStream::append(ArrayXdConstRef values) -> void
+{
+    pimpl->append(values);
+}
+
+auto TableStream::flush() -> void
+{
+    pimpl->flush();
+}
+
+auto TableStream::close() -> void
+{
+    pimpl->close();
+}
+
+auto TableStream::load(String const& filepath) -> Table
+{
+    std::ifstream file(filepath, std::ios::binary);
+    errorif(!file, "Could not open file `", filepath, "` to load a Table object.");
+
+    String tag(binaryTableStreamTag.size(), ' ');
+    file.read(tag.data(), tag.size());
+    errorif(tag != binaryTableStreamTag, "The file `", filepath, "` is not a binary file written by a TableStream object.");
+
+    std::uint32_t version = 0;
+    readBinary(file, version);
+    errorif(version != binaryTableStreamVersion, "The binary TableStream file `", filepath, "` has version ", version, " but only version ", binaryTableStreamVersion, " is supported.");
+
+    std::uint64_t ncols = 0;
+    readBinary(file, ncols);
+
+    Strings columns(ncols);
+    for(auto& name : columns)
+        readBinary(file, name);
+
+    Table table;
+    for(auto const& name : columns)
+        table.column(name); // ensure the columns exist (and keep their order) even if no rows were written
+
+    Vec<double> values;
+    std::uint64_t rows = 0;
+    while(file.peek() != std::ifstream::traits_type::eof())
+    {
+        readBinary(file, rows);
+        values.resize(rows * ncols);
+        readBinary(file, values.data(), values.size());
+        errorif(!file, "The binary TableStream file `", filepath, "` is truncated or corrupted.");
+        for(auto j = 0; j < ncols; ++j)
+        {
+            auto& column = table.column(columns[j]);
+            for(auto i = 0; i < rows; ++i)
+                column.appendFloat(values[j*rows + i]);
+        }
+    }
+
+    return table;
+}
+
+} // namespace Reaktoro
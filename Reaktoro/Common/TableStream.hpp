@@ -0,0 +1,91 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to write rows of floating-point values to a file while they are being computed.
+/// The rows appended to a TableStream object are collected in a chunk of
+/// fixed size. Once the chunk is full, it is handed to a background thread
+/// that writes it to the file while the next chunk is filled (double
+/// buffering). Memory use is therefore bounded by two chunks, no matter how
+/// many rows are output, and formatting and writing the values do not block
+/// the calling thread unless the writer falls behind by a whole chunk.
+/// Errors raised while writing are rethrown on the next call to @ref append,
+/// @ref flush, or @ref close.
+/// @see Table
+class TableStream
+{
+public:
+    /// Used to specify the format of the file written by a TableStream object.
+    enum class Format
+    {
+        Text,   ///< The values are written as text, one row per line, formatted as in @ref Table::save.
+        Binary, ///< The values are written in binary columnar chunks, which can be read back with @ref TableStream::load.
+    };
+
+    /// Construct a TableStream object that writes to a file.
+    /// @param filepath The path to the file that will be created, including its file name.
+    /// @param columns The names of the columns in the table.
+    /// @param format The format of the file.
+    /// @param chunksize The number of rows in each chunk handed to the background writer.
+    /// @param outputopts The formatting options used when @p format is Format::Text.
+    TableStream(String const& filepath, Strings const& columns, Format format = Format::Text, Index chunksize = 1024, Table::OutputOptions const& outputopts = {});
+
+    /// Deleted copy constructor (the background writer cannot be shared or duplicated).
+    TableStream(TableStream const& other) = delete;
+
+    /// Destroy this TableStream object after writing all appended rows.
+    ~TableStream();
+
+    /// Deleted copy assignment operator (the background writer cannot be shared or duplicated).
+    auto operator=(TableStream const& other) -> TableStream& = delete;
+
+    /// Return the names of the columns in the table.
+    auto columns() const -> Strings const&;
+
+    /// Return the number of rows appended so far.
+    auto rows() const -> Index;
+
+    /// Append a row of values, one for each column.
+    auto append(ArrayXdConstRef values) -> void;
+
+    /// Write all appended rows to the file and wait until this is done.
+    auto flush() -> void;
+
+    /// Write all appended rows to the file, stop the background writer and close the file.
+    /// Rows can no longer be appended afterwards. This method is called on destruction.
+    auto close() -> void;
+
+    /// Load a Table object from a file written by a TableStream object in Format::Binary.
+    /// @param filepath The path to the file.
+    static auto load(String const& filepath) -> Table;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
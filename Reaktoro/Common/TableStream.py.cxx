@@ -0,0 +1,44 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/TableStream.hpp>
+using namespace Reaktoro;
+
+void exportTableStream(py::module& m)
+{
+    auto mTableStream = py::class_<TableStream>(m, "TableStream");
+
+    py::enum_<TableStream::Format>(mTableStream, "Format")
+        .value("Text", TableStream::Format::Text, "The values are written as text, one row per line.")
+        .value("Binary", TableStream::Format::Binary, "The values are written in binary columnar chunks, which can be read back with TableStream.load.")
+        ;
+
+    mTableStream
+        .def(py::init<String const&, Strings const&, TableStream::Format, Index, Table::OutputOptions const&>(), "filepath"_a, "columns"_a, "format"_a = TableStream::Format::Text, "chunksize"_a = 1024, "outputopts"_a = Table::OutputOptions())
+        .def("columns", &TableStream::columns, return_internal_ref, "Return the names of the columns in the table.")
+        .def("rows", &TableStream::rows, "Return the number of rows appended so far.")
+        .def("append", &TableStream::append, "Append a row of values, one for each column.")
+        .def("flush", &TableStream::flush, "Write all appended rows to the file and wait until this is done.")
+        .def("close", &TableStream::close, "Write all appended rows to the file, stop the background writer and close the file.")
+        .def_static("load", &TableStream::load, "Load a Table object from a file written by a TableStream object in binary format.")
+        ;
+}
@@ -0,0 +1,98 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/TableStream.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing TableStream", "[TableStream]")
+{
+    SECTION("Checking rows are written in binary columnar chunks")
+    {
+        const auto filepath = "TableStream.test.bin";
+
+        TableStream stream(filepath, {"x", "y"}, TableStream::Format::Binary, 3); // chunks of 3 rows to test several hand overs
+
+        CHECK( stream.columns() == Strings{"x", "y"} );
+
+        for(auto i = 0; i < 10; ++i)
+            stream.append(ArrayXd{{1.0*i, 10.0*i}});
+
+        CHECK( stream.rows() == 10 );
+
+        CHECK_THROWS( stream.append(ArrayXd{{1.0, 2.0, 3.0}}) ); // wrong number of values
+
+        stream.close();
+
+        CHECK_THROWS( stream.append(ArrayXd{{1.0, 2.0}}) ); // stream is closed
+
+        const auto table = TableStream::load(filepath);
+
+        std::remove(filepath);
+
+        CHECK( table.rows() == 10 );
+        CHECK( table.cols() == 2 );
+        CHECK( table["x"] == Vec<double>{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0} );
+        CHECK( table["y"] == Vec<double>{0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0} );
+    }
+
+    SECTION("Checking rows are written as text")
+    {
+        const auto filepath = "TableStream.test.txt";
+
+        Table::OutputOptions opts;
+        opts.delimiter = ",";
+        opts.precision = 3;
+
+        {
+            TableStream stream(filepath, {"x", "y,z"}, TableStream::Format::Text, 2, opts);
+            stream.append(ArrayXd{{1.0, 2.0}});
+            stream.append(ArrayXd{{3.0, 4.0}});
+            stream.append(ArrayXd{{5.0, 6.0}});
+            stream.flush();
+
+            std::ifstream file(filepath);
+            std::stringstream ss;
+            ss << file.rdbuf();
+
+            CHECK( ss.str() == "x,\"y,z\"\n1.00,2.00\n3.00,4.00\n5.00,6.00\n" );
+
+            stream.append(ArrayXd{{7.0, 8.0}});
+        } // rows not yet written are written on destruction
+
+        std::ifstream file(filepath);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        file.close();
+
+        std::remove(filepath);
+
+        CHECK( ss.str() == "x,\"y,z\"\n1.00,2.00\n3.00,4.00\n5.00,6.00\n7.00,8.00\n" );
+    }
+
+    CHECK_THROWS( TableStream("TableStream.test.none.bin", {}) ); // no columns
+    CHECK_THROWS( TableStream::load("TableStream.test.does.not.exist.bin") );
+}
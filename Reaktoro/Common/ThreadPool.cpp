@@ -0,0 +1,522 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ThreadPool.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+// Linux includes
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The range of task indices `[begin, end)` still to be executed by a worker.
+struct TaskRange
+{
+    /// The mutex protecting the range against concurrent access by its owner and thieves.
+    std::mutex mutex;
+
+    /// The index of the next task to be executed by the owner of this range.
+    Index begin = 0;
+
+    /// The index past the last task in this range.
+    Index end = 0;
+};
+
+/// The external scheduler adopted by default by new ThreadPool objects (see ThreadPool::setDefaultExecutor).
+struct DefaultExecutor
+{
+    /// The mutex protecting the default executor against concurrent access.
+    std::mutex mutex;
+
+    /// The number of workers of the default executor.
+    Index numworkers = 0;
+
+    /// The default executor (empty if none).
+    ThreadPoolExecutor executor;
+};
+
+/// Return the external scheduler adopted by default by new ThreadPool objects.
+auto defaultExecutor() -> DefaultExecutor&
+{
+    static DefaultExecutor instance;
+    return instance;
+}
+
+/// Return the flag indicating if the worker threads of new ThreadPool objects are pinned (see ThreadPool::setDefaultThreadPinning).
+auto defaultThreadPinning() -> std::atomic<bool>&
+{
+    static std::atomic<bool> instance(false);
+    return instance;
+}
+
+/// Return the hardware threads the calling thread is allowed to run on (empty if unknown).
+auto allowedHardwareThreads() -> Indices
+{
+    Indices cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) == 0)
+        for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if(CPU_ISSET(cpu, &set))
+                cpus.push_back(cpu);
+#endif
+    return cpus;
+}
+
+/// Bind the calling thread to a given hardware thread.
+auto pinCurrentThread(Index cpu) -> void
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+/// The flag indicating the current thread is executing a task of a ThreadPool with its own threads.
+thread_local bool insideTask = false;
+
+/// The pools (and the workers in them) whose tasks are being executed by the current thread, innermost last.
+thread_local Vec<Pair<void const*, Index>> currentTasks;
+
+/// Used to register the task of a pool executed by the current thread during the lifetime of an object of this type.
+struct InsideTaskGuard
+{
+    /// The value of `insideTask` before construction.
+    const bool previous;
+
+    /// Construct an InsideTaskGuard object.
+    /// @param pool The pool whose task is executed by the current thread
+    /// @param iworker The index of the worker executing the task in the pool
+    /// @param inside The value of `insideTask` during the lifetime of this object
+    InsideTaskGuard(void const* pool, Index iworker, bool inside)
+    : previous(insideTask)
+    {
+        currentTasks.emplace_back(pool, iworker);
+        insideTask = inside;
+    }
+
+    /// Destroy this InsideTaskGuard object.
+    ~InsideTaskGuard()
+    {
+        currentTasks.pop_back();
+        insideTask = previous;
+    }
+};
+
+/// Return the index of the worker executing a task of a pool in the current thread (or `Index(-1)` if none).
+auto currentWorker(void const* pool) -> Index
+{
+    for(auto it = currentTasks.rbegin(); it != currentTasks.rend(); ++it)
+        if(it->first == pool)
+            return it->second;
+    return Index(-1);
+}
+
+} // namespace
+
+struct ThreadPool::Impl
+{
+    /// The number of workers in the pool (including the calling thread).
+    const Index numthreads;
+
+    /// The worker threads (one less than `numthreads` since the calling thread also works).
+    Vec<std::thread> threads;
+
+    /// The mutex used to serialize concurrent calls to `run`.
+    std::mutex runmutex;
+
+    /// The mutex protecting the job state below.
+    std::mutex mutex;
+
+    /// The condition variable used to wake up the workers when a new job is available.
+    std::condition_variable cvjob;
+
+    /// The condition variable used to notify the calling thread that all workers finished the job.
+    std::condition_variable cvdone;
+
+    /// The current job to be executed by every worker.
+    Fn<void(Index)> const* job = nullptr;
+
+    /// The counter of submitted jobs (used by workers to detect a new job).
+    Index generation = 0;
+
+    /// The number of worker threads still executing the current job.
+    Index busy = 0;
+
+    /// The flag indicating the pool is being destroyed.
+    bool stopping = false;
+
+    /// The external scheduler adopted by the pool (empty if the pool uses its own threads).
+    const ThreadPoolExecutor executor;
+
+    /// The hardware threads the worker threads are pinned to, cyclically (empty if the worker threads are not pinned).
+    Indices cpus;
+
+    /// Construct a ThreadPool::Impl object with its own threads.
+    Impl(Index n, bool pinned)
+    : numthreads(n > 0 ? n : std::max<Index>(std::thread::hardware_concurrency(), 1))
+    {
+        if(pinned)
+            cpus = allowedHardwareThreads();
+        for(Index i = 1; i < numthreads; ++i)
+            threads.emplace_back([this, i] { work(i); });
+    }
+
+    /// Construct a ThreadPool::Impl object that adopts an external scheduler.
+    Impl(Index n, ThreadPoolExecutor const& executor)
+    : numthreads(n), executor(executor)
+    {
+        errorif(numthreads == 0, "Expecting a positive number of workers for the external scheduler adopted by ThreadPool.");
+        errorif(!executor, "Expecting a non-empty executor function for the external scheduler adopted by ThreadPool.");
+    }
+
+    /// Destroy this ThreadPool::Impl object.
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cvjob.notify_all();
+        for(auto& thread : threads)
+            thread.join();
+    }
+
+    /// The loop executed by every worker thread.
+    auto work(Index iworker) -> void
+    {
+        if(!cpus.empty())
+            pinCurrentThread(cpus[iworker % cpus.size()]);
+
+        Index seen = 0;
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvjob.wait(lock, [&] { return stopping || generation != seen; });
+            if(stopping)
+                return;
+            seen = generation;
+            auto const& fn = *job;
+            lock.unlock();
+
+            {
+                InsideTaskGuard guard(this, iworker, true);
+                fn(iworker);
+            }
+
+            lock.lock();
+            if(--busy == 0)
+                cvdone.notify_one();
+        }
+    }
+
+    /// Execute `fn(iworker)` on every worker and wait for all of them to finish.
+    auto run(Fn<void(Index)> const& fn) -> void
+    {
+        std::lock_guard<std::mutex> runlock(runmutex);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &fn;
+            busy = threads.size();
+            ++generation;
+        }
+        cvjob.notify_all();
+
+        {
+            InsideTaskGuard guard(this, 0, true);
+            fn(0);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cvdone.wait(lock, [&] { return busy == 0; });
+        job = nullptr;
+    }
+
+    auto parallelFor(Index n, Fn<void(Index, Index)> const& f) -> void
+    {
+        if(n == 0)
+            return;
+
+        // Execute a parallel loop nested in a task of this same pool serially by the worker executing that task, which owns its per-worker data
+        const auto thatworker = currentWorker(this);
+        if(thatworker != Index(-1))
+        {
+            for(Index i = 0; i < n; ++i)
+                f(i, thatworker);
+            return;
+        }
+
+        if(executor)
+            return parallelForAdopted(n, f);
+
+        if(numthreads == 1 || n == 1)
+        {
+            for(Index i = 0; i < n; ++i)
+                f(i, 0);
+            return;
+        }
+
+        // Avoid oversubscription in a parallel loop nested in a task of another pool by executing its tasks in the calling thread
+        if(insideTask)
+        {
+            std::lock_guard<std::mutex> runlock(runmutex); // the per-worker data of worker 0 is used below, as in concurrent calls
+            InsideTaskGuard guard(this, 0, true);
+            for(Index i = 0; i < n; ++i)
+                f(i, 0);
+            return;
+        }
+
+        const auto W = numthreads;
+
+        // Evenly distribute the tasks among the workers
+        Vec<TaskRange> ranges(W);
+        for(Index k = 0; k < W; ++k)
+            std::tie(ranges[k].begin, ranges[k].end) = initialTasks(n, k);
+
+        // Get the next task of a worker, stealing half the remaining tasks of another worker if its own range is exhausted
+        auto next = [&](Index iworker, Index& i) -> bool
+        {
+            auto& own = ranges[iworker];
+            {
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if(own.begin < own.end)
+                {
+                    i = own.begin++;
+                    return true;
+                }
+            }
+            for(Index k = 1; k < W; ++k)
+            {
+                auto& victim = ranges[(iworker + k) % W];
+                Index begin = 0;
+                Index end = 0;
+                {
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if(victim.begin >= victim.end)
+                        continue;
+                    const auto remaining = victim.end - victim.begin;
+                    end = victim.end;
+                    begin = end - (remaining + 1)/2;
+                    victim.end = begin;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    own.begin = begin + 1;
+                    own.end = end;
+                }
+                i = begin;
+                return true;
+            }
+            return false;
+        };
+
+        std::exception_ptr exception;
+        std::mutex exceptionmutex;
+        std::atomic<bool> failed(false);
+
+        Fn<void(Index)> job = [&](Index iworker)
+        {
+            Index i = 0;
+            while(!failed && next(iworker, i))
+            {
+                try { f(i, iworker); }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(exceptionmutex);
+                    if(!exception)
+                        exception = std::current_exception();
+                    failed = true;
+                }
+            }
+        };
+
+        run(job);
+
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+
+    auto forEachWorker(Fn<void(Index)> const& f) -> void
+    {
+        errorif(currentWorker(this) != Index(-1), "ThreadPool::forEachWorker cannot be called from within a task of the same pool, since the other workers are busy.");
+
+        if(executor)
+            return parallelForAdopted(numthreads, [&](Index i, Index iworker) { f(i); });
+
+        if(numthreads == 1)
+            return f(0);
+
+        // Avoid oversubscription when nested in a task of another pool by executing the functions of all workers in the calling thread
+        if(insideTask)
+        {
+            std::lock_guard<std::mutex> runlock(runmutex);
+            for(Index i = 0; i < numthreads; ++i)
+            {
+                InsideTaskGuard guard(this, i, true);
+                f(i);
+            }
+            return;
+        }
+
+        std::exception_ptr exception;
+        std::mutex exceptionmutex;
+
+        Fn<void(Index)> job = [&](Index iworker)
+        {
+            try { f(iworker); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionmutex);
+                if(!exception)
+                    exception = std::current_exception();
+            }
+        };
+
+        run(job);
+
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+
+    /// Return the range of tasks initially assigned to a worker in a parallel loop with `n` tasks.
+    auto initialTasks(Index n, Index iworker) const -> Pair<Index, Index>
+    {
+        const auto chunk = n / numthreads;
+        const auto remainder = n % numthreads;
+        const auto begin = iworker * chunk + std::min(iworker, remainder);
+        return { begin, begin + chunk + (iworker < remainder ? 1 : 0) };
+    }
+
+    /// Execute `f(i, iworker)` for every `i` in `[0, n)` using the adopted external scheduler.
+    auto parallelForAdopted(Index n, Fn<void(Index, Index)> const& f) -> void
+    {
+        std::lock_guard<std::mutex> runlock(runmutex);
+
+        std::exception_ptr exception;
+        std::mutex exceptionmutex;
+        std::atomic<bool> failed(false);
+
+        // Exceptions are caught here since external schedulers such as OpenMP cannot propagate them
+        executor(n, [&](Index i, Index iworker)
+        {
+            if(failed)
+                return;
+            InsideTaskGuard guard(this, iworker, insideTask);
+            try { f(i, iworker); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionmutex);
+                if(!exception)
+                    exception = std::current_exception();
+                failed = true;
+            }
+        });
+
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+};
+
+ThreadPool::ThreadPool(Index numthreads)
+{
+    auto& instance = defaultExecutor();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    if(instance.executor)
+        pimpl.reset(new Impl(instance.numworkers, instance.executor));
+    else pimpl.reset(new Impl(numthreads, defaultThreadPinning()));
+}
+
+ThreadPool::ThreadPool(Index numworkers, ThreadPoolExecutor const& executor)
+: pimpl(new Impl(numworkers, executor))
+{}
+
+ThreadPool::~ThreadPool()
+{}
+
+auto ThreadPool::numThreads() const -> Index
+{
+    return pimpl->numthreads;
+}
+
+auto ThreadPool::parallelFor(Index n, Fn<void(Index i, Index iworker)> const& f) -> void
+{
+    pimpl->parallelFor(n, f);
+}
+
+auto ThreadPool::forEachWorker(Fn<void(Index iworker)> const& f) -> void
+{
+    pimpl->forEachWorker(f);
+}
+
+auto ThreadPool::initialTasks(Index n, Index iworker) const -> Pair<Index, Index>
+{
+    errorif(iworker >= pimpl->numthreads, "Expecting a worker index smaller than ", pimpl->numthreads, " in ThreadPool::initialTasks, but got ", iworker, ".");
+    return pimpl->initialTasks(n, iworker);
+}
+
+auto ThreadPool::adopted() const -> bool
+{
+    return static_cast<bool>(pimpl->executor);
+}
+
+auto ThreadPool::pinned() const -> bool
+{
+    return !pimpl->cpus.empty();
+}
+
+auto ThreadPool::setDefaultExecutor(Index numworkers, ThreadPoolExecutor const& executor) -> void
+{
+    errorif(numworkers == 0, "Expecting a positive number of workers for the default executor of ThreadPool.");
+    errorif(!executor, "Expecting a non-empty function as the default executor of ThreadPool.");
+    auto& instance = defaultExecutor();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    instance.numworkers = numworkers;
+    instance.executor = executor;
+}
+
+auto ThreadPool::resetDefaultExecutor() -> void
+{
+    auto& instance = defaultExecutor();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    instance.numworkers = 0;
+    instance.executor = {};
+}
+
+auto ThreadPool::setDefaultThreadPinning(bool pinned) -> void
+{
+    defaultThreadPinning() = pinned;
+}
+
+} // namespace Reaktoro
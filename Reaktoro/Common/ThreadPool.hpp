@@ -0,0 +1,154 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The function type of an external scheduler adopted by ThreadPool objects.
+/// An executor must call `f(i, iworker)` once for every `i` in `[0, n)`,
+/// with `iworker` in `[0, numworkers)` identifying the worker of the
+/// external runtime executing the task (e.g., `omp_get_thread_num()` in an
+/// OpenMP team or `tbb::this_task_arena::current_thread_index()` in a TBB
+/// arena), and return once all tasks have been executed. A given `iworker`
+/// must not execute two tasks at the same time. Exceptions thrown by `f`
+/// are handled by ThreadPool and never reach the executor.
+/// @see ThreadPool::setDefaultExecutor
+using ThreadPoolExecutor = Fn<void(Index n, Fn<void(Index i, Index iworker)> const& f)>;
+
+/// Used to execute loops of independent tasks in parallel using a fixed set of worker threads.
+/// The tasks of a loop are evenly split among the workers at the start of the
+/// loop. A worker that finishes its own tasks steals half of the remaining
+/// tasks of another worker, so that expensive tasks (e.g., equilibrium
+/// calculations needing many iterations) do not leave threads idle.
+/// The thread calling @ref parallelFor participates as worker `0`.
+///
+/// A ThreadPool object can instead adopt an external scheduler (see
+/// ThreadPoolExecutor), in which case it creates no threads of its own. If
+/// a default executor is set with @ref setDefaultExecutor, every ThreadPool
+/// object subsequently created by Reaktoro (e.g., in batched equilibrium and
+/// kinetics calculations, equilibrium grids and fitting) adopts it, so that
+/// Reaktoro's parallel loops run in the threads of the application's own
+/// runtime without oversubscription. Parallel loops started from within a
+/// task of a pool with its own threads (e.g., a batched calculation inside
+/// an equilibrium grid) are executed serially in the calling thread for the
+/// same reason. Parallel loops started from within a task of the same pool
+/// are also executed serially, by the worker executing that task.
+///
+/// On NUMA systems (e.g., nodes with several sockets), the worker threads
+/// can be pinned to hardware threads (see @ref setDefaultThreadPinning),
+/// and the data used by each worker can be allocated and first touched in
+/// its own thread (see @ref forEachWorker and @ref initialTasks), so that
+/// it is placed in the memory of the socket the worker runs on.
+class ThreadPool
+{
+public:
+    /// Construct a ThreadPool object with given number of worker threads.
+    /// If a default executor is set (see @ref setDefaultExecutor), the
+    /// constructed pool adopts it and `numthreads` is ignored.
+    /// @param numthreads The number of workers (if zero, the number of hardware threads is used)
+    explicit ThreadPool(Index numthreads = 0);
+
+    /// Construct a ThreadPool object that adopts an external scheduler.
+    /// @param numworkers The number of workers of the external scheduler
+    /// @param executor The function that executes the tasks of a parallel loop in the external scheduler
+    ThreadPool(Index numworkers, ThreadPoolExecutor const& executor);
+
+    /// Deleted copy constructor (worker threads cannot be shared or duplicated).
+    ThreadPool(ThreadPool const& other) = delete;
+
+    /// Destroy this ThreadPool object after joining all worker threads.
+    ~ThreadPool();
+
+    /// Deleted copy assignment operator (worker threads cannot be shared or duplicated).
+    auto operator=(ThreadPool const& other) -> ThreadPool& = delete;
+
+    /// Return the number of workers in the pool (including the calling thread).
+    auto numThreads() const -> Index;
+
+    /// Execute `f(i, iworker)` for every `i` in `[0, n)` among the workers of the pool.
+    /// The index `iworker` in `[0, numThreads())` identifies the worker
+    /// executing the task, and can be used to access per-worker data
+    /// without synchronization. If this is called from within a task of the
+    /// same pool, the tasks are executed serially in the calling thread with
+    /// the index of the worker executing that task. This method returns once
+    /// all tasks have been executed. The first exception thrown by a task is
+    /// rethrown here.
+    /// @param n The number of tasks to be executed
+    /// @param f The function executing the task with index `i` on worker `iworker`
+    auto parallelFor(Index n, Fn<void(Index i, Index iworker)> const& f) -> void;
+
+    /// Execute `f(iworker)` once for every worker of the pool in the thread of that worker.
+    /// This is used to create the data of each worker (e.g., its own copy of
+    /// a solver) in the thread using it, so that its memory is allocated and
+    /// first touched there. If the pool adopts an external scheduler, or if
+    /// this is called from within a task of another pool, every `f(iworker)`
+    /// is still executed once, but not necessarily in the thread of worker
+    /// `iworker`. The first exception thrown by `f` is rethrown here. This
+    /// method cannot be called from within a task of the same pool.
+    /// @param f The function executed by worker `iworker`
+    auto forEachWorker(Fn<void(Index iworker)> const& f) -> void;
+
+    /// Return the range of tasks `[begin, end)` initially assigned to a worker in a parallel loop.
+    /// The tasks of a loop in @ref parallelFor are split among the workers in
+    /// contiguous ranges of about the same size, and most of them are executed
+    /// by the worker of their range unless the workloads are very uneven.
+    /// Data first touched by each worker over its own range (e.g., the cells
+    /// of a ChemicalField object) is thus mostly accessed from the same
+    /// socket in later loops with the same number of tasks on pinned pools
+    /// with the same number of workers (see @ref setDefaultThreadPinning).
+    /// @param n The number of tasks of the loop
+    /// @param iworker The index of the worker
+    auto initialTasks(Index n, Index iworker) const -> Pair<Index, Index>;
+
+    /// Return true if this pool adopts an external scheduler instead of using its own threads.
+    auto adopted() const -> bool;
+
+    /// Return true if the worker threads of this pool are pinned to hardware threads.
+    auto pinned() const -> bool;
+
+    /// Set the external scheduler adopted by every ThreadPool object constructed afterwards.
+    /// ThreadPool objects already constructed are not affected.
+    /// @param numworkers The number of workers of the external scheduler
+    /// @param executor The function that executes the tasks of a parallel loop in the external scheduler
+    static auto setDefaultExecutor(Index numworkers, ThreadPoolExecutor const& executor) -> void;
+
+    /// Reset the default executor so that ThreadPool objects constructed afterwards use their own threads.
+    static auto resetDefaultExecutor() -> void;
+
+    /// Set whether the worker threads of ThreadPool objects constructed afterwards are pinned to hardware threads.
+    /// Worker `k` of a pinned pool is bound to the `k`-th hardware thread
+    /// (cyclically) among those the calling process is allowed to run on, so
+    /// that worker `k` of every pinned pool runs on the same hardware thread.
+    /// Consecutive workers thus share a socket when the hardware threads of a
+    /// socket are numbered contiguously, as is usual on Linux. The thread
+    /// calling @ref parallelFor, which participates as worker `0`, is not
+    /// pinned. Pinning is only supported on Linux, and is ignored elsewhere
+    /// and by pools adopting an external scheduler. By default, worker
+    /// threads are not pinned.
+    static auto setDefaultThreadPinning(bool pinned) -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,224 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadPool.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ThreadPool", "[ThreadPool]")
+{
+    ThreadPool pool(4);
+
+    CHECK( pool.numThreads() == 4 );
+
+    SECTION("Checking every task is executed exactly once")
+    {
+        const Index n = 1001;
+        Vec<int> counts(n, 0);
+        Vec<Index> workers(n, -1);
+
+        pool.parallelFor(n, [&](Index i, Index iworker)
+        {
+            counts[i] += 1;
+            workers[i] = iworker;
+        });
+
+        for(Index i = 0; i < n; ++i)
+        {
+            CHECK( counts[i] == 1 );
+            CHECK( workers[i] < pool.numThreads() );
+        }
+    }
+
+    SECTION("Checking the pool can be reused for many loops")
+    {
+        Vec<double> values(100, 0.0);
+        for(auto k = 0; k < 50; ++k)
+            pool.parallelFor(values.size(), [&](Index i, Index iworker) { values[i] += 1.0; });
+        for(auto value : values)
+            CHECK( value == 50.0 );
+    }
+
+    SECTION("Checking exceptions thrown in tasks are propagated")
+    {
+        CHECK_THROWS( pool.parallelFor(100, [&](Index i, Index iworker) { if(i == 42) throw std::runtime_error("failure"); }) );
+    }
+
+    SECTION("Checking every worker executes its function once in its own thread")
+    {
+        Vec<int> counts(pool.numThreads(), 0);
+        Vec<std::thread::id> ids(pool.numThreads());
+
+        pool.forEachWorker([&](Index iworker)
+        {
+            counts[iworker] += 1;
+            ids[iworker] = std::this_thread::get_id();
+        });
+
+        for(auto count : counts)
+            CHECK( count == 1 );
+
+        CHECK( ids[0] == std::this_thread::get_id() );
+        for(Index i = 0; i < ids.size(); ++i)
+            for(Index j = i + 1; j < ids.size(); ++j)
+                CHECK( ids[i] != ids[j] );
+
+        CHECK_THROWS( pool.forEachWorker([&](Index iworker) { if(iworker == 2) throw std::runtime_error("failure"); }) );
+    }
+
+    SECTION("Checking the tasks initially assigned to the workers")
+    {
+        const Index n = 10;
+        CHECK( pool.initialTasks(n, 0) == Pair<Index, Index>{0, 3} );
+        CHECK( pool.initialTasks(n, 1) == Pair<Index, Index>{3, 6} );
+        CHECK( pool.initialTasks(n, 2) == Pair<Index, Index>{6, 8} );
+        CHECK( pool.initialTasks(n, 3) == Pair<Index, Index>{8, 10} );
+        CHECK( pool.initialTasks(2, 3) == Pair<Index, Index>{2, 2} );
+        CHECK_THROWS( pool.initialTasks(n, 4) );
+    }
+
+    SECTION("Checking pools created after enabling thread pinning")
+    {
+        ThreadPool::setDefaultThreadPinning(true);
+
+        ThreadPool pinned(4);
+
+        ThreadPool::setDefaultThreadPinning(false);
+
+        ThreadPool unpinned(4);
+
+#if defined(__linux__)
+        CHECK( pinned.pinned() );
+#endif
+        CHECK_FALSE( unpinned.pinned() );
+
+        Vec<int> counts(1001, 0);
+        pinned.parallelFor(counts.size(), [&](Index i, Index iworker) { counts[i] += 1; });
+        for(auto count : counts)
+            CHECK( count == 1 );
+    }
+
+    SECTION("Checking a pool with a single worker runs tasks in the calling thread")
+    {
+        ThreadPool serial(1);
+        Vec<Index> order;
+        serial.parallelFor(5, [&](Index i, Index iworker) { order.push_back(i); });
+        CHECK( order == Vec<Index>{0, 1, 2, 3, 4} );
+    }
+
+    SECTION("Checking parallel loops nested in tasks of another pool are executed in the calling thread")
+    {
+        ThreadPool inner(4);
+        Vec<int> counts(8 * 10, 0);
+        Vec<int> innerworkers(8 * 10, -1);
+
+        pool.parallelFor(8, [&](Index i, Index iworker)
+        {
+            inner.parallelFor(10, [&](Index j, Index jworker)
+            {
+                counts[i*10 + j] += 1;
+                innerworkers[i*10 + j] = jworker;
+            });
+        });
+
+        for(auto count : counts)
+            CHECK( count == 1 );
+        for(auto jworker : innerworkers)
+            CHECK( jworker == 0 );
+    }
+
+    SECTION("Checking parallel loops nested in tasks of the same pool are executed by the worker of the outer task")
+    {
+        Vec<int> counts(8 * 10, 0);
+        Vec<Index> outerworkers(8, -1);
+        Vec<Index> innerworkers(8 * 10, -1);
+
+        pool.parallelFor(8, [&](Index i, Index iworker)
+        {
+            outerworkers[i] = iworker;
+            pool.parallelFor(10, [&](Index j, Index jworker)
+            {
+                counts[i*10 + j] += 1;
+                innerworkers[i*10 + j] = jworker;
+            });
+        });
+
+        for(auto count : counts)
+            CHECK( count == 1 );
+        for(Index i = 0; i < 8; ++i)
+            for(Index j = 0; j < 10; ++j)
+                CHECK( innerworkers[i*10 + j] == outerworkers[i] );
+
+        CHECK_THROWS( pool.parallelFor(2, [&](Index i, Index iworker) { pool.forEachWorker([&](Index jworker) {}); }) );
+    }
+
+    // An executor that runs the tasks serially, as an external scheduler with two workers would
+    ThreadPoolExecutor executor = [](Index n, Fn<void(Index, Index)> const& f)
+    {
+        for(Index i = 0; i < n; ++i)
+            f(i, i % 2);
+    };
+
+    SECTION("Checking a pool adopting an external scheduler")
+    {
+        ThreadPool adopted(2, executor);
+
+        CHECK( adopted.adopted() );
+        CHECK( adopted.numThreads() == 2 );
+        CHECK_FALSE( pool.adopted() );
+
+        Vec<Index> workers(7, -1);
+        adopted.parallelFor(7, [&](Index i, Index iworker) { workers[i] = iworker; });
+        CHECK( workers == Vec<Index>{0, 1, 0, 1, 0, 1, 0} );
+
+        Vec<int> counts(2, 0);
+        adopted.forEachWorker([&](Index iworker) { counts[iworker] += 1; });
+        CHECK( counts == Vec<int>{1, 1} );
+        CHECK_FALSE( adopted.pinned() );
+
+        CHECK_THROWS( adopted.parallelFor(10, [&](Index i, Index iworker) { if(i == 3) throw std::runtime_error("failure"); }) );
+
+        Vec<Index> nested(4, -1);
+        adopted.parallelFor(2, [&](Index i, Index iworker) { adopted.parallelFor(2, [&](Index j, Index jworker) { nested[i*2 + j] = jworker; }); });
+        CHECK( nested == Vec<Index>{0, 0, 1, 1} );
+
+        CHECK_THROWS( ThreadPool(0, executor) );
+        CHECK_THROWS( ThreadPool(2, ThreadPoolExecutor()) );
+    }
+
+    SECTION("Checking pools created after setting a default executor adopt it")
+    {
+        ThreadPool::setDefaultExecutor(2, executor);
+
+        ThreadPool adopted(8);
+
+        ThreadPool::resetDefaultExecutor();
+
+        ThreadPool native(3);
+
+        CHECK( adopted.adopted() );
+        CHECK( adopted.numThreads() == 2 );
+        CHECK_FALSE( native.adopted() );
+        CHECK( native.numThreads() == 3 );
+    }
+}
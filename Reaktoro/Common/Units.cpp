@@ -23,6 +23,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 using std::endl;
 using std::pow;
@@ -613,23 +614,41 @@ inline void checkConvertibleUnits(const DerivedUnit& from, const DerivedUnit& to
     }
 }
 
+Converter computeConverter(const string& from, const string& to)
+{
+    if(temperatureUnitsMap.count(from) && temperatureUnitsMap.count(to))
+    {
+        const auto intercept = convertTemperature(0.0, from, to);
+        return { convertTemperature(1.0, from, to) - intercept, intercept };
+    }
+    auto parsed_from = parseUnit(from);
+    auto parsed_to   = parseUnit(to);
+    checkConvertibleUnits(parsed_from, parsed_to, from, to);
+    return { factor(parsed_from)/factor(parsed_to), 0.0 };
+}
+
 } // namespace internal
 
+auto converter(const std::string& from, const std::string& to) -> const Converter&
+{
+    // The cached conversion functions, indexed first by the unit to convert from and then by the unit to convert to
+    thread_local std::unordered_map<string, std::unordered_map<string, Converter>> cache;
+
+    auto& converters = cache[from];
+    auto it = converters.find(to);
+    if(it == converters.end())
+        it = converters.emplace(to, internal::computeConverter(from, to)).first;
+    return it->second;
+}
+
 auto slope(const std::string& from, const std::string& to) -> double
 {
-    if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
-        return internal::convertTemperature(1.0, from, to) - internal::convertTemperature(0.0, from, to);
-    auto parsed_from = internal::parseUnit(from);
-    auto parsed_to   = internal::parseUnit(to);
-    internal::checkConvertibleUnits(parsed_from, parsed_to, from, to);
-    return internal::factor(parsed_from)/internal::factor(parsed_to);
+    return converter(from, to).slope;
 }
 
 auto intercept(const std::string& from, const std::string& to) -> double
 {
-    if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
-        return internal::convertTemperature(0.0, from, to);
-    return 0.0;
+    return converter(from, to).intercept;
 }
 
 bool convertible(const std::string& from, const std::string& to)
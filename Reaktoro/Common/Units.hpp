@@ -23,6 +23,33 @@
 namespace Reaktoro {
 namespace units {
 
+/// The linear function that converts a numeric value from a unit to another.
+/// Obtain it once with @ref converter and reuse it to convert many values
+/// between the same units without parsing the unit strings again.
+struct Converter
+{
+    /// The slope factor in the linear conversion function.
+    double slope = 1.0;
+
+    /// The intercept term in the linear conversion function.
+    double intercept = 0.0;
+
+    /// Convert a numeric value with this linear conversion function.
+    template<typename T>
+    auto operator()(const T& value) const -> T
+    {
+        return value * slope + intercept;
+    }
+};
+
+/// Return the linear function that converts a numeric value from a unit to another.
+/// The conversion function of every pair of units is computed once and then
+/// cached (per thread), so that repeated calls with the same units do not
+/// parse the unit strings again.
+/// @param from The string representing the unit from which the conversion is done
+/// @param to The string representing the unit to which the conversion is done
+auto converter(const std::string& from, const std::string& to) -> const Converter&;
+
 /// Return the slope factor in the linear function that converts a numeric value from a unit to another.
 /// @param from The string representing the unit from which the conversion is done
 /// @param to The string representing the unit to which the conversion is done
@@ -47,7 +74,7 @@ auto convertible(const std::string& from, const std::string& to) -> bool;
 template<typename T>
 auto convert(const T& value, const std::string& from, const std::string& to) -> T
 {
-    return (from == to) ? value : value * slope(from, to) + intercept(from, to);
+    return (from == to) ? value : converter(from, to)(value);
 }
 
 /// Convenience function to convert a value from a time unit to seconds.
@@ -26,6 +26,16 @@ void exportUnits(py::module& m)
 {
     auto sub = m.def_submodule("units");
 
+    py::class_<units::Converter>(sub, "Converter")
+        .def(py::init<>())
+        .def_readwrite("slope", &units::Converter::slope)
+        .def_readwrite("intercept", &units::Converter::intercept)
+        .def("__call__", &units::Converter::operator()<double>)
+        .def("__call__", &units::Converter::operator()<real>)
+        ;
+
+    sub.def("converter", [](const std::string& from, const std::string& to) { return units::converter(from, to); });
+
     sub.def("convertible", &units::convertible);
 
     sub.def("convert", &units::convert<double>);
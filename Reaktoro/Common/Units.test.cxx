@@ -68,6 +68,22 @@ TEST_CASE("Testing Units module", "[Units]")
     REQUIRE( units::convert(x, "ftH2O"  , "Pa") == Approx(x * 249.08891 * 12)  );
     REQUIRE( units::convert(x, "pascal" , "Pa") == Approx(x * 1.0)             );
 
+    //-------------------------------------------------------------------------
+    // CACHED CONVERSION FUNCTIONS
+    //-------------------------------------------------------------------------
+    const auto& degC_to_K = units::converter("degC", "K");
+    const auto& kPa_to_Pa = units::converter("kPa", "Pa");
+
+    REQUIRE( degC_to_K(x) == Approx(x * 1.0 + 273.15) );
+    REQUIRE( kPa_to_Pa(x) == Approx(x * 1.0e+3) );
+
+    REQUIRE( &units::converter("degC", "K") == &degC_to_K ); // the same cached conversion function is returned
+
+    REQUIRE( units::slope("degC", "degF") == Approx(1.8) );
+    REQUIRE( units::intercept("degC", "degF") == Approx(32.0) );
+
+    REQUIRE_THROWS( units::converter("kPa", "m3") );
+
     //-------------------------------------------------------------------------
     // CONVENIENCE FUNCTIONS
     //-------------------------------------------------------------------------
@@ -17,6 +17,9 @@
 
 #include "Warnings.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Types.hpp>
@@ -25,12 +28,19 @@ namespace Reaktoro {
 
 auto getDisabledWarnings() -> Vec<int>&
 {
-    static thread_local Vec<int> disabled_warnings;
+    static Vec<int> disabled_warnings;
     return disabled_warnings;
 }
 
+auto getDisabledWarningsMutex() -> std::mutex&
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
 auto Warnings::enable(int warningid) -> bool
 {
+    std::lock_guard<std::mutex> lock(getDisabledWarningsMutex());
     auto& disabled = getDisabledWarnings();
     auto pos = std::find(disabled.begin(), disabled.end(), warningid);
     if(pos < disabled.end())
@@ -43,6 +53,7 @@ auto Warnings::enable(int warningid) -> bool
 
 auto Warnings::disable(int warningid) -> bool
 {
+    std::lock_guard<std::mutex> lock(getDisabledWarningsMutex());
     auto& disabled = getDisabledWarnings();
     if(!contains(disabled, warningid))
     {
@@ -59,6 +70,7 @@ auto Warnings::isEnabled(int warningid) -> bool
 
 auto Warnings::isDisabled(int warningid) -> bool
 {
+    std::lock_guard<std::mutex> lock(getDisabledWarningsMutex());
     auto const& disabled = getDisabledWarnings();
     return contains(disabled, warningid);
 }
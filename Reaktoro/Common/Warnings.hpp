@@ -20,6 +20,9 @@
 namespace Reaktoro {
 
 /// Used to control warnings in the execution of Reaktoro.
+/// The warnings are enabled or disabled for the whole process, so that a
+/// warning disabled in the main thread is also disabled in the worker threads
+/// of parallel calculations. These methods can be called concurrently.
 class Warnings
 {
 public:
@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -42,4 +45,14 @@ TEST_CASE("Testing Warnings", "[Warnings]")
     // Check enabling already enabled warnings return false
     CHECK_FALSE( Warnings::enable(897) );
     CHECK_FALSE( Warnings::enable(976) );
+
+    // Check warnings disabled in one thread are also disabled in other threads
+    Warnings::disable(555);
+
+    bool disabled = false;
+    std::thread([&]() { disabled = Warnings::isDisabled(555); }).join();
+
+    CHECK( disabled );
+
+    Warnings::enable(555);
 }
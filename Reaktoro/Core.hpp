@@ -22,9 +22,13 @@
 #include <Reaktoro/Core/AggregateState.hpp>
 #include <Reaktoro/Core/ChemicalFormula.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsBatch.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
+#include <Reaktoro/Core/ChemicalPropsStream.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateCheckpoint.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/ChemicalSystemCache.hpp>
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Core/Element.hpp>
@@ -34,6 +38,7 @@
 #include <Reaktoro/Core/FormationReaction.hpp>
 #include <Reaktoro/Core/Model.hpp>
 #include <Reaktoro/Core/Param.hpp>
+#include <Reaktoro/Core/ParamArena.hpp>
 #include <Reaktoro/Core/Params.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/PhaseList.hpp>
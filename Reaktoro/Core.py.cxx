@@ -23,9 +23,13 @@ void exportActivityProps(py::module& m);
 void exportAggregateState(py::module& m);
 void exportChemicalFormula(py::module& m);
 void exportChemicalProps(py::module& m);
+void exportChemicalPropsBatch(py::module& m);
+void exportChemicalPropsStream(py::module& m);
 void exportChemicalPropsPhase(py::module& m);
 void exportChemicalState(py::module& m);
+void exportChemicalStateCheckpoint(py::module& m);
 void exportChemicalSystem(py::module& m);
+void exportChemicalSystemCache(py::module& m);
 void exportData(py::module& m);
 void exportDatabase(py::module& m);
 void exportElement(py::module& m);
@@ -105,7 +109,11 @@ void exportCore(py::module& m)
     exportThermoPropsPhase(m);
     exportCoreUtils(m);
     exportChemicalSystem(m);
+    exportChemicalSystemCache(m);
     exportChemicalState(m);
+    exportChemicalStateCheckpoint(m);
     exportChemicalPropsPhase(m);
     exportChemicalProps(m);
+    exportChemicalPropsBatch(m);
+    exportChemicalPropsStream(m);
 }
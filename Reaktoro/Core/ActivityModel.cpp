@@ -17,21 +17,45 @@
 
 #include "ActivityModel.hpp"
 
+// C++ includes
+#include <atomic>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+
 namespace Reaktoro {
 
+auto newActivityModelArgsVersion() -> std::uint64_t
+{
+    static std::atomic<std::uint64_t> counter{0};
+    return ++counter;
+}
+
+auto createThreadLocalActivityModel(ActivityModelGenerator const& generator, SpeciesList const& species) -> ActivityModel
+{
+    const ActivityModel prototype = generator(species);
+
+    detail::ThreadLocal<ActivityModel> instances;
+    instances.local() = prototype; // the calling thread uses the instance created above
+
+    auto evalfn = [=](ActivityPropsRef props, ActivityModelArgs args)
+    {
+        auto& model = instances.local();
+        if(!model.initialized())
+            model = generator(species); // other threads create their own instances
+        model.apply(props, args);
+    };
+
+    return ActivityModel(evalfn, prototype.params(), prototype.serializerFn());
+}
+
 auto chain(Vec<ActivityModelGenerator> const& models) -> ActivityModelGenerator
 {
     ActivityModelGenerator chained_model = [=](SpeciesList const& species)
     {
         const Vec<ActivityModel> activity_models = vectorize(models, RKT_LAMBDA(model, model(species)));
 
-        ActivityModel chained_activity_model = [=](ActivityPropsRef props, ActivityModelArgs args)
-        {
-            for(const auto& fn : activity_models)
-                fn(props, args);
-        };
-
-        return chained_activity_model;
+        return chain(activity_models); // call the evaluator functions of the activity models directly and keep their parameters so that memoization can detect changes in them
     };
 
     return chained_model;
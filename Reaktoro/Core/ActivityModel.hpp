@@ -19,6 +19,8 @@
 
 // C++ includes
 #include <cmath>
+#include <cstdint>
+#include <tuple>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
@@ -40,18 +42,72 @@ struct ActivityModelArgs
 
     /// The mole fractions of the species in the phase.
     ArrayXrConstRef x;
+
+    /// The version of these arguments, or zero if unknown.
+    /// Two ActivityModelArgs objects with the same non-zero version hold
+    /// identical values of `T`, `P` and `x`, including their derivative
+    /// seeds. This permits a memoized activity model to detect repeated
+    /// arguments by comparing two integers instead of all mole fractions.
+    /// Use @ref newActivityModelArgsVersion to obtain a version that has
+    /// never been used before whenever the arguments change.
+    std::uint64_t version = 0;
+
+    /// Return `T`, `P` or `x` so that `auto const& [T, P, x] = args` binds only these (i.e., not the version).
+    template<std::size_t I>
+    auto get() const -> decltype(auto)
+    {
+        static_assert(I < 3);
+        if constexpr(I == 0) return (T);
+        else if constexpr(I == 1) return (P);
+        else return (x);
+    }
 };
 
+/// Return a new version for ActivityModelArgs objects, distinct from all previously returned ones (thread-safe).
+auto newActivityModelArgsVersion() -> std::uint64_t;
+
 // Declare this so that Model understands ActivityPropsRef as reference type for ActivityProps instead of ActivityProps&.
 REAKTORO_DEFINE_REFERENCE_TYPE_OF(ActivityProps, ActivityPropsRef);
 
 /// The function type for the calculation of activity and corrective thermodynamic properties of a phase.
+/// When derivatives with respect to species amounts are computed (e.g., in
+/// the assembly of the Hessian of the Gibbs energy function), an activity
+/// model is evaluated repeatedly with the same values of temperature,
+/// pressure and mole fractions, only with different derivative seeds in
+/// the mole fractions. Terms that depend only on temperature and pressure
+/// can thus be cached across these evaluations, using @ref identical to
+/// detect changes in `T` and `P` (see, e.g., ActivityModelDebyeHuckel).
 using ActivityModel = Model<ActivityProps(ActivityModelArgs)>;
 
 /// The type for functions that construct an ActivityModel for a phase.
 /// @param species The species in the phase.
 using ActivityModelGenerator = Fn<ActivityModel(SpeciesList const& species)>;
 
+/// The function type for the analytic calculation of the derivatives of the ln activities of the species in a phase with respect to their amounts.
+/// This is an optional companion of an ActivityModel for which these
+/// derivatives are known in closed form. When available, the Jacobian block
+/// of the chemical potentials of a phase is computed in a single call,
+/// instead of one evaluation of the activity model per seeded species amount.
+/// @param J The output matrix with entries J(i, j) = ∂(ln a_i)/∂n_j.
+/// @param args The temperature, pressure and mole fractions of the species in the phase.
+/// @param nsum The amount of the phase (in mol).
+using ActivityModelJacobian = Fn<void(MatrixXdRef J, ActivityModelArgs args, double nsum)>;
+
+/// The type for functions that construct an ActivityModelJacobian for a phase.
+/// @param species The species in the phase.
+using ActivityModelJacobianGenerator = Fn<ActivityModelJacobian(SpeciesList const& species)>;
+
+/// Return an activity model for a phase whose instances are created per thread with given generator.
+/// Activity models often keep mutable state in their evaluator functions
+/// (e.g., intermediate results for the last temperature and pressure), and
+/// thus cannot be evaluated concurrently. The returned activity model gives
+/// each thread its own instance, created with the generator the first time the
+/// thread evaluates it, except the calling thread, which uses the instance
+/// created here. The returned model has the parameters of this instance.
+/// @param generator The function that constructs the activity model.
+/// @param species The species in the phase.
+auto createThreadLocalActivityModel(ActivityModelGenerator const& generator, SpeciesList const& species) -> ActivityModel;
+
 /// Return an activity model resulting from chaining other activity models.
 auto chain(const Vec<ActivityModelGenerator>& models) -> ActivityModelGenerator;
 
@@ -68,6 +124,23 @@ auto chain(ActivityModelGenerator const& model, Models const&... models) -> Acti
 
 } // namespace Reaktoro
 
+// Declare ActivityModelArgs as a tuple-like type of three elements for structured bindings (see ActivityModelArgs::get).
+namespace std {
+
+template<>
+struct tuple_size<Reaktoro::ActivityModelArgs> : std::integral_constant<std::size_t, 3> {};
+
+template<>
+struct tuple_element<0, Reaktoro::ActivityModelArgs> { using type = Reaktoro::real const; };
+
+template<>
+struct tuple_element<1, Reaktoro::ActivityModelArgs> { using type = Reaktoro::real const; };
+
+template<>
+struct tuple_element<2, Reaktoro::ActivityModelArgs> { using type = Reaktoro::ArrayXrConstRef const; };
+
+} // namespace std
+
 //=========================================================================
 // CODE BELOW NEEDED FOR MEMOIZATION TECHNIQUE INVOLVING ACTIVITYMODELARGS
 //=========================================================================
@@ -84,17 +157,23 @@ struct MemoizationTraits<ActivityModelArgs>
     using Type = ActivityModelArgs;
 
     /// The type used instead to cache an ActivityModelArgs object.
-    using CacheType = Tuple<real, real, ArrayXr>;
+    /// The values of `T`, `P` and `x` are cached only for arguments with unknown version.
+    using CacheType = Tuple<real, real, ArrayXr, std::uint64_t>;
 
-    static auto equal(Tuple<real, real, ArrayXr> const& a, ActivityModelArgs const& b)
+    static auto equal(Tuple<real, real, ArrayXr, std::uint64_t> const& a, ActivityModelArgs const& b)
     {
-        auto const& [T, P, x] = a;
-        return T == b.T && P == b.P && (x == b.x).all();
+        auto const& [T, P, x, version] = a;
+        if(b.version != 0)
+            return version == b.version;
+        return version == 0 && T == b.T && P == b.P && x.size() == b.x.size() && (x == b.x).all();
     }
 
-    static auto assign(Tuple<real, real, ArrayXr>& a, ActivityModelArgs const& b)
+    static auto assign(Tuple<real, real, ArrayXr, std::uint64_t>& a, ActivityModelArgs const& b)
     {
-        auto& [T, P, x] = a;
+        auto& [T, P, x, version] = a;
+        version = b.version;
+        if(b.version != 0)
+            return; // the version alone identifies the arguments, so there is no need to copy them
         T = b.T;
         P = b.P;
         x = b.x;
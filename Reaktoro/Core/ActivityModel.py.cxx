@@ -30,6 +30,7 @@ void exportActivityModel(py::module& m)
         .def_property_readonly("T", [](const ActivityModelArgs& self) { return self.T; })
         .def_property_readonly("P", [](const ActivityModelArgs& self) { return self.P; })
         .def_property_readonly("x", [](const ActivityModelArgs& self) { return self.x; })
+        .def_property_readonly("version", [](const ActivityModelArgs& self) { return self.version; })
         ;
 
     auto cls = exportModel<ActivityProps, ActivityModelArgs>(m, "ActivityModel");
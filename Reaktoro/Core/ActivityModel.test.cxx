@@ -0,0 +1,72 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ActivityModel.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing memoization of ActivityModel with versioned arguments", "[ActivityModel]")
+{
+    auto counter = 0;
+
+    ActivityModel model = ActivityModel([&](ActivityPropsRef props, ActivityModelArgs args)
+    {
+        auto const& [T, P, x] = args;
+        ++counter;
+        props = 0.0;
+        props.ln_a = x.log();
+    }).withMemoization();
+
+    const real T = 300.0;
+    const real P = 1.0e5;
+    const ArrayXr x = ArrayXr{{0.2, 0.3, 0.5}};
+
+    ActivityProps props = ActivityProps::create(x.size());
+
+    // Arguments with unknown version are compared by value
+    model(props, {T, P, x});
+    model(props, {T, P, x});
+    CHECK( counter == 1 );
+
+    // Arguments with known version are compared by version only
+    const auto v1 = newActivityModelArgsVersion();
+    const auto v2 = newActivityModelArgsVersion();
+
+    CHECK( v1 != 0 );
+    CHECK( v2 != v1 );
+
+    model(props, {T, P, x, v1});
+    CHECK( counter == 2 );
+
+    model(props, {T, P, x, v1});
+    CHECK( counter == 2 );
+
+    model(props, {T, P, x, v2});
+    CHECK( counter == 3 );
+
+    // The values of versioned arguments are not cached, so that the next arguments with unknown version are evaluated
+    model(props, {T, P, x});
+    CHECK( counter == 4 );
+
+    model(props, {T, P, x});
+    CHECK( counter == 4 );
+
+    CHECK( (props.ln_a == x.log()).all() );
+}
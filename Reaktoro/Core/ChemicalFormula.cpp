@@ -17,6 +17,9 @@
 
 #include "ChemicalFormula.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
@@ -25,6 +28,19 @@
 #include <Reaktoro/Singletons/Elements.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return the identifier of an element symbol, unique among all symbols interned so far (thread-safe).
+auto internSymbol(String const& symbol) -> Index
+{
+    static std::mutex mutex;
+    static Map<String, Index> ids;
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto id = ids.size();
+    return ids.emplace(symbol, id).first->second;
+}
+
+} // namespace
 
 struct ChemicalFormula::Impl
 {
@@ -37,30 +53,52 @@ struct ChemicalFormula::Impl
     /// The electric charge in the chemical formula (e.g., `-1` for `HCO3-`).
     double charge = {};
 
+    /// The symbols of the elements.
+    Strings symbols;
+
+    /// The coefficients of the elements.
+    Vec<double> coefficients;
+
+    /// The interned identifiers of the element symbols and their coefficients, sorted by identifier, for fast comparison of formulas (see @ref internSymbol).
+    Pairs<Index, double> composition;
+
     /// Construct an object of type Impl.
     Impl()
     {}
 
     /// Construct an object of type Impl with given formula.
     Impl(String formula)
-    : formula(formula), elements(parseChemicalFormula(formula)), charge(parseElectricCharge(formula))
+    : Impl(formula, parseChemicalFormula(formula), parseElectricCharge(formula))
     {}
 
     /// Construct an object of type Impl with given data.
     Impl(String formula, Pairs<String, double> elements, double charge)
     : formula(formula), elements(elements), charge(charge)
-    {}
-
-    /// Return the symbols of the elements.
-    auto symbols() const -> Strings
     {
-        return vectorize(elements, RKT_LAMBDA(pair, pair.first));
+        symbols = vectorize(elements, RKT_LAMBDA(pair, pair.first));
+        coefficients = vectorize(elements, RKT_LAMBDA(pair, pair.second));
+        composition.reserve(elements.size());
+        for(auto const& [symbol, coeff] : elements)
+            composition.emplace_back(internSymbol(symbol), coeff);
+        std::sort(composition.begin(), composition.end());
     }
 
-    /// Return the coefficients of the elements.
-    auto coefficients() const -> Vec<double>
+    /// Return the parsed data of a chemical formula, shared with all other ChemicalFormula objects constructed with the same formula string (thread-safe).
+    /// Formulas are parsed repeatedly when loading databases and matching
+    /// species and model parameters by formula, and the parsed data is never
+    /// modified after construction, so it is safely shared.
+    static auto parsed(String const& formula) -> SharedPtr<Impl>
     {
-        return vectorize(elements, RKT_LAMBDA(pair, pair.second));
+        static std::mutex mutex;
+        static Map<String, SharedPtr<Impl>> cache;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(auto it = cache.find(formula); it != cache.end())
+                return it->second;
+        }
+        auto impl = std::make_shared<Impl>(formula); // parse outside the lock; another thread may parse the same formula meanwhile, and the first one stored is kept
+        std::lock_guard<std::mutex> lock(mutex);
+        return cache.emplace(formula, impl).first->second;
     }
 
     /// Return the coefficient of an element symbol in the chemical formula.
@@ -96,7 +134,7 @@ ChemicalFormula::ChemicalFormula(const char* formula)
 {}
 
 ChemicalFormula::ChemicalFormula(String formula)
-: pimpl(new Impl(formula))
+: pimpl(Impl::parsed(formula))
 {}
 
 ChemicalFormula::ChemicalFormula(String formula, Pairs<String, double> symbols, double charge)
@@ -113,14 +151,14 @@ auto ChemicalFormula::elements() const -> const Pairs<String, double>&
     return pimpl->elements;
 }
 
-auto ChemicalFormula::symbols() const -> Strings
+auto ChemicalFormula::symbols() const -> const Strings&
 {
-    return pimpl->symbols();
+    return pimpl->symbols;
 }
 
-auto ChemicalFormula::coefficients() const -> Vec<double>
+auto ChemicalFormula::coefficients() const -> const Vec<double>&
 {
-    return pimpl->coefficients();
+    return pimpl->coefficients;
 }
 
 auto ChemicalFormula::coefficient(const String& symbol) const -> double
@@ -140,9 +178,9 @@ auto ChemicalFormula::molarMass() const -> double
 
 auto ChemicalFormula::equivalent(const ChemicalFormula& other) const -> bool
 {
-    return elements().size() == other.elements().size() &&
-        contained(elements(), other.elements()) &&
-        charge() == other.charge();
+    return pimpl == other.pimpl || (
+        pimpl->composition == other.pimpl->composition &&
+        charge() == other.charge());
 }
 
 auto ChemicalFormula::equivalent(const ChemicalFormula& f1, const ChemicalFormula& f2) -> bool
@@ -50,10 +50,10 @@ public:
     auto elements() const -> const Pairs<String, double>&;
 
     /// Return the element symbols in the chemical formula.
-    auto symbols() const -> Strings;
+    auto symbols() const -> const Strings&;
 
     /// Return the coefficients of the elements in the chemical formula.
-    auto coefficients() const -> Vec<double>;
+    auto coefficients() const -> const Vec<double>&;
 
     /// Return the coefficient of an element symbol in the chemical formula.
     auto coefficient(const String& symbol) const -> double;
@@ -284,4 +284,15 @@ TEST_CASE("Testing ChemicalFormula class", "[ChemicalFormula]")
 
     CHECK(ChemicalFormula::equivalent("CO2", "CO2(g)"));
     CHECK(ChemicalFormula::equivalent("CO2", "COO"));
+
+    CHECK_FALSE(ChemicalFormula::equivalent("CO2", "CO"));
+    CHECK_FALSE(ChemicalFormula::equivalent("CO2", "CO2-"));
+    CHECK_FALSE(ChemicalFormula::equivalent("CaCO3", "MgCO3"));
+    CHECK_FALSE(ChemicalFormula::equivalent("CaCO3", "CaCO3Mg"));
+
+    // Formulas constructed with the same string share their parsed data
+    formula = ChemicalFormula("CaCO3");
+    CHECK( &formula.symbols() == &ChemicalFormula("CaCO3").symbols() );
+    CHECK( formula.symbols().size() == 3 );
+    CHECK( formula.coefficients().size() == 3 );
 }
@@ -27,6 +27,9 @@ using namespace tabulate;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
@@ -44,6 +47,11 @@ ChemicalProps::ChemicalProps(ChemicalSystem const& system)
 
     Ts   = ArrayXr::Zero(K);
     Ps   = ArrayXr::Zero(K);
+    Tstd = ArrayXr::Constant(K, NaN);
+    Pstd = ArrayXr::Constant(K, NaN);
+    Tref = ArrayXd::Constant(K, NaN);
+    Pref = ArrayXd::Constant(K, NaN);
+    std_taylor = ArrayXXd::Zero(N, 12);
     n    = ArrayXr::Zero(N);
     nsum = ArrayXr::Zero(K);
     msum = ArrayXr::Zero(K);
@@ -64,6 +72,7 @@ ChemicalProps::ChemicalProps(ChemicalSystem const& system)
     ln_g = ArrayXr::Zero(N);
     ln_a = ArrayXr::Zero(N);
     u    = ArrayXr::Zero(N);
+    s    = ArrayXr::Zero(system.surfaces().size());
     som.resize(K);
 }
 
@@ -75,42 +84,34 @@ ChemicalProps::ChemicalProps(ChemicalState const& state)
 
 auto ChemicalProps::update(ChemicalState const& state) -> void
 {
+    if(Memoization::isEnabled() && state.generation() == mgeneration && mstateid == mgenerationstateid)
+        return; // these chemical properties already correspond to the given chemical state
+
     auto const& T = state.temperature();
     auto const& P = state.pressure();
     auto const& n = state.speciesAmounts();
-    update(T, P, n);
+    updateAux(T, P, n, false, state.generation()); // the generation of the state identifies the arguments of the activity models of its phases
+
+    mgeneration = state.generation();
+    mgenerationstateid = mstateid;
 }
 
 auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
-    mstateid += 1;
-
-    assert(T0 >= 0.0);
-    assert(P0 >= 0.0);
-    assert(n0.size() == n.size() && (n0 >= 0.0).all());
-
-    T = T0;
-    P = P0;
-
-    auto offset = 0;
-    for(auto const& [i, phase] : enumerate(msystem.phases()))
-    {
-        const auto size = phase.species().size();
-        const auto np = n0.segment(offset, size);
-        phasePropsRef(i).update(T, P, np, m_extra);
-        offset += size;
-    }
+    updateAux(T0, P0, n0, false, 0);
 }
 
 auto ChemicalProps::update(ArrayXrConstRef data) -> void
 {
     mstateid += 1;
+    discardStandardThermoProps();
     ArraySerialization::deserialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
 auto ChemicalProps::update(ArrayXdConstRef data) -> void
 {
     mstateid += 1;
+    discardStandardThermoProps();
     ArraySerialization::deserialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
@@ -119,11 +120,18 @@ auto ChemicalProps::updateIdeal(ChemicalState const& state) -> void
     auto const& T = state.temperature();
     auto const& P = state.pressure();
     auto const& n = state.speciesAmounts();
-    updateIdeal(T, P, n);
+    updateAux(T, P, n, true, state.generation());
 }
 
 auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
+    updateAux(T0, P0, n0, true, 0);
+}
+
+auto ChemicalProps::updateAux(real const& T0, real const& P0, ArrayXrConstRef n0, bool ideal, std::uint64_t version) -> void
+{
+    REAKTORO_PROFILE(ideal ? "ChemicalProps::updateIdeal" : "ChemicalProps::update");
+
     mstateid += 1;
 
     assert(T0 >= 0.0);
@@ -138,11 +146,37 @@ auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).updateIdeal(T, P, np, m_extra);
+        updatePhaseAux(i, T, P, np, ideal, version);
         offset += size;
     }
 }
 
+auto ChemicalProps::updatePhase(Index iphase, real const& T0, real const& P0, ArrayXrConstRef np) -> void
+{
+    mstateid += 1;
+
+    assert(iphase < msystem.phases().size());
+    assert(np.size() == msystem.phase(iphase).species().size() && (np >= 0.0).all());
+
+    T = T0;
+    P = P0;
+
+    updatePhaseAux(iphase, T, P, np, false, 0);
+}
+
+auto ChemicalProps::updatePhaseIdeal(Index iphase, real const& T0, real const& P0, ArrayXrConstRef np) -> void
+{
+    mstateid += 1;
+
+    assert(iphase < msystem.phases().size());
+    assert(np.size() == msystem.phase(iphase).species().size() && (np >= 0.0).all());
+
+    T = T0;
+    P = P0;
+
+    updatePhaseAux(iphase, T, P, np, true, 0);
+}
+
 auto ChemicalProps::serialize(ArrayStream<real>& stream) const -> void
 {
     stream.from(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
@@ -156,15 +190,186 @@ auto ChemicalProps::serialize(ArrayStream<double>& stream) const -> void
 auto ChemicalProps::deserialize(const ArrayStream<real>& stream) -> void
 {
     mstateid += 1;
+    discardStandardThermoProps();
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
 auto ChemicalProps::deserialize(const ArrayStream<double>& stream) -> void
 {
     mstateid += 1;
+    discardStandardThermoProps();
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
+auto ChemicalProps::serialize(ArrayXrRef data) const -> void
+{
+    errorif(data.size() != serializationSize(), "Expecting an array with ", serializationSize(), " entries to serialize the chemical properties, but got one with ", data.size(), " entries.");
+    ArraySerialization::serialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+}
+
+auto ChemicalProps::serialize(ArrayXdRef data) const -> void
+{
+    errorif(data.size() != serializationSize(), "Expecting an array with ", serializationSize(), " entries to serialize the chemical properties, but got one with ", data.size(), " entries.");
+    ArraySerialization::serialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+}
+
+auto ChemicalProps::serializePhase(Index iphase, ArrayXrRef data) const -> void
+{
+    errorif(data.size() != serializationSize(), "Expecting an array with ", serializationSize(), " entries to serialize the chemical properties, but got one with ", data.size(), " entries.");
+
+    const auto offset = msystem.phases().numSpeciesUntilPhase(iphase);
+    const auto size = msystem.phase(iphase).species().size();
+
+    auto pos = 2; // skip T and P, which are not properties of a phase
+
+    const auto species = [&](ArrayXrConstRef a) { data.segment(pos + offset, size) = a.segment(offset, size); pos += a.size(); };
+    const auto phase = [&](ArrayXrConstRef a) { data[pos + iphase] = a[iphase]; pos += a.size(); };
+
+    // Keep the order below consistent with serialize and serializationLayout
+    species(n);
+    phase(Ts);
+    phase(Ps);
+    phase(nsum);
+    phase(msum);
+    species(x);
+    species(G0);
+    species(H0);
+    species(V0);
+    species(VT0);
+    species(VP0);
+    species(Cp0);
+    phase(Vx);
+    phase(VxT);
+    phase(VxP);
+    species(Vxi);
+    phase(Gx);
+    phase(Hx);
+    phase(Cpx);
+    species(ln_g);
+    species(ln_a);
+    species(u);
+}
+
+auto ChemicalProps::serializationSize() const -> Index
+{
+    return detail::length(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
+}
+
+auto ChemicalProps::serializationLayout() const -> Pairs<String, Index>
+{
+    return {
+        {"T", 1}, {"P", 1}, {"n", n.size()}, {"Ts", Ts.size()}, {"Ps", Ps.size()},
+        {"nsum", nsum.size()}, {"msum", msum.size()}, {"x", x.size()},
+        {"G0", G0.size()}, {"H0", H0.size()}, {"V0", V0.size()}, {"VT0", VT0.size()}, {"VP0", VP0.size()}, {"Cp0", Cp0.size()},
+        {"Vx", Vx.size()}, {"VxT", VxT.size()}, {"VxP", VxP.size()}, {"Vxi", Vxi.size()},
+        {"Gx", Gx.size()}, {"Hx", Hx.size()}, {"Cpx", Cpx.size()},
+        {"ln_g", ln_g.size()}, {"ln_a", ln_a.size()}, {"u", u.size()},
+    };
+}
+
+auto ChemicalProps::memoryUsage() const -> MemoryUsage
+{
+    MemoryUsage usage;
+    usage.name = "ChemicalProps";
+    usage.bytes = sizeof(ChemicalProps);
+    usage.add("species properties", memoryBytes(n, x, G0, H0, V0, VT0, VP0, Cp0, Vxi, ln_g, ln_a, u));
+    usage.add("phase properties", memoryBytes(Ts, Ps, nsum, msum, Vx, VxT, VxP, Gx, Hx, Cpx, som) + memoryBytes(s));
+    usage.add("standard properties cache", memoryBytes(Tstd, Pstd, Tref, Pref, std_taylor));
+
+    Index extra = 0;
+    for(auto const& [key, value] : m_extra)
+        extra += sizeof(Any) + memoryBytes(key);
+    usage.add("activity model extra data", extra);
+
+    return usage;
+}
+
+auto ChemicalProps::reuseStandardThermoProps(bool enable) -> void
+{
+    mreuse_standard_props = enable;
+}
+
+auto ChemicalProps::discardStandardThermoProps() -> void
+{
+    Tstd.fill(NaN);
+    Pstd.fill(NaN);
+    Tref.fill(NaN);
+    Pref.fill(NaN);
+}
+
+auto ChemicalProps::extrapolateStandardThermoProps(double dT) -> void
+{
+    errorif(dT < 0.0, "Expecting a non-negative temperature band for the extrapolation of the standard thermodynamic properties, but got ", dT, ".");
+    mstd_taylor_band = dT;
+    Tref.fill(NaN);
+    Pref.fill(NaN);
+}
+
+auto ChemicalProps::updatePhaseAux(Index iphase, real const& T, real const& P, ArrayXrConstRef np, bool ideal, std::uint64_t version) -> void
+{
+    auto standard = !mreuse_standard_props || !identical(Tstd[iphase], T) || !identical(Pstd[iphase], P);
+
+    if(standard && mstd_taylor_band > 0.0 && grad(P) == 0.0)
+    {
+        extrapolatePhaseStandardThermoProps(iphase, T, P);
+        standard = false;
+    }
+
+    auto phaseprops = phasePropsRef(iphase);
+
+    if(version == 0)
+        version = newActivityModelArgsVersion(); // the mole fractions are computed anew, so the activity model need not compare them with those of its last evaluation
+
+    if(ideal) phaseprops.updateIdeal(T, P, np, m_extra, standard, version);
+    else phaseprops.update(T, P, np, m_extra, standard, version);
+
+    Tstd[iphase] = T;
+    Pstd[iphase] = P;
+}
+
+auto ChemicalProps::extrapolatePhaseStandardThermoProps(Index iphase, real const& T, real const& P) -> void
+{
+    REAKTORO_PROFILE("ChemicalProps::extrapolatePhaseStandardThermoProps");
+
+    const auto offset = msystem.phases().numSpeciesUntilPhase(iphase);
+    const auto size = msystem.phase(iphase).species().size();
+
+    // Compute the standard properties and their temperature derivatives at a new reference temperature if needed (note NaN reference values fail these comparisons)
+    const auto withinband = std::abs(T.val() - Tref[iphase]) <= mstd_taylor_band && P.val() == Pref[iphase];
+
+    if(!withinband)
+    {
+        Tref[iphase] = T.val();
+        Pref[iphase] = P.val();
+
+        real T0 = T.val();
+        autodiff::seed(T0);
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto aux = msystem.species(offset + i).standardThermoProps(T0, P.val());
+            std_taylor.row(offset + i) <<
+                aux.G0.val(), aux.H0.val(), aux.V0.val(), aux.VT0.val(), aux.VP0.val(), aux.Cp0.val(),
+                grad(aux.G0), grad(aux.H0), grad(aux.V0), grad(aux.VT0), grad(aux.VP0), grad(aux.Cp0);
+        }
+    }
+
+    // The temperature deviation from the reference temperature, which keeps the derivative seed of T, if any
+    const real dT = T - Tref[iphase];
+    const auto T0 = Tref[iphase];
+
+    for(auto i = offset; i < offset + size; ++i)
+    {
+        const auto ref = std_taylor.row(i);
+        G0[i]  = ref[0] + ref[6]*dT - 0.5*ref[7]/T0*dT*dT; // from dG0/dT = -S0 and d2G0/dT2 = -dH0/dT/T
+        H0[i]  = ref[1] + ref[7]*dT + 0.5*ref[11]*dT*dT;   // from d2H0/dT2 = dCp0/dT
+        V0[i]  = ref[2] + ref[8]*dT;
+        VT0[i] = ref[3] + ref[9]*dT;
+        VP0[i] = ref[4] + ref[10]*dT;
+        Cp0[i] = ref[5] + ref[11]*dT;
+    }
+}
+
 auto ChemicalProps::stateid() const -> Index
 {
     return mstateid;
@@ -309,8 +514,10 @@ auto ChemicalProps::elementMassAmongSpecies(StringOrIndex element, Indices const
 
 auto ChemicalProps::elementAmounts() const -> ArrayXr
 {
-    const auto A = msystem.formulaMatrixElements();
-    return (A * n.matrix()).array();
+    auto const& A = msystem.formulaMatrixSparse(); // the last row, corresponding to charge, is dropped below
+    const auto Ne = msystem.elements().size();
+    const VectorXr b = A * n.matrix();
+    return b.head(Ne).array();
 }
 
 auto ChemicalProps::elementAmountsInPhase(StringOrIndex phase) const -> ArrayXr
@@ -334,8 +541,9 @@ auto ChemicalProps::elementAmountsAmongSpecies(Indices const& indices) const ->
 
 auto ChemicalProps::componentAmounts() const -> ArrayXr
 {
-    const auto A = msystem.formulaMatrix();
-    return (A * n.matrix()).array();
+    auto const& A = msystem.formulaMatrixSparse();
+    const VectorXr b = A * n.matrix();
+    return b.array();
 }
 
 auto ChemicalProps::componentAmountsInPhase(StringOrIndex phase) const -> ArrayXr
@@ -593,16 +801,37 @@ auto ChemicalProps::surfaceArea(StringOrIndex const& surface) const -> real
     const auto isurface = detail::resolveSurfaceIndexOrRaiseError(msystem, surface);
     const auto numsurfaces = msystem.surfaces().size();
     errorif(isurface >= numsurfaces, "There is no surface in the chemical system with name or index `", stringfy(surface), "`.");
-    return msystem.surface(isurface).area(*this);
+    if(!Memoization::isEnabled())
+        return msystem.surface(isurface).area(*this);
+    updateSurfaceAreas();
+    return s[isurface];
 }
 
 auto ChemicalProps::surfaceAreas() const -> ArrayXr
 {
+    if(!Memoization::isEnabled())
+    {
+        auto const& surfaces = msystem.surfaces();
+        ArrayXr areas(surfaces.size());
+        for(auto const& [i, surface] : enumerate(surfaces))
+            areas[i] = surface.area(*this);
+        return areas;
+    }
+    updateSurfaceAreas();
+    return s;
+}
+
+auto ChemicalProps::updateSurfaceAreas() const -> void
+{
+    if(msurfacestateid == mstateid)
+        return; // the surface areas have already been computed for the current state
+
+    msurfacestateid = mstateid; // set before evaluating the area models, so that an area model that queries the area of another surface does not trigger this evaluation again
+
     auto const& surfaces = msystem.surfaces();
-    ArrayXr areas(surfaces.size());
+    s.resize(surfaces.size());
     for(auto const& [i, surface] : enumerate(surfaces))
-        areas[i] = surface.area(*this);
-    return areas;
+        s[i] = surface.area(*this);
 }
 
 auto ChemicalProps::molarVolume() const -> real
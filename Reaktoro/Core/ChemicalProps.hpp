@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/MemoryUsage.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -43,6 +44,12 @@ public:
     explicit ChemicalProps(ChemicalState const& state);
 
     /// Update the chemical properties of the system.
+    /// The evaluation is skipped if these chemical properties were last
+    /// updated with this method using the same generation of temperature,
+    /// pressure and species amounts in @p state (see ChemicalState::generation).
+    /// Changes in the parameters of the thermodynamic and activity models are
+    /// not detected by this check. Use `update(T, P, n)` or disable memoization
+    /// with Memoization::disable() to force a new evaluation in such cases.
     /// @param state The chemical state of the system
     auto update(ChemicalState const& state) -> void;
 
@@ -70,6 +77,23 @@ public:
     /// @param n The amounts of the species in the system (in mol)
     auto updateIdeal(real const& T, real const& P, ArrayXrConstRef n) -> void;
 
+    /// Update the chemical properties of a single phase in the system.
+    /// The properties of the other phases are left unchanged. This is useful
+    /// when only the amounts of the species in one phase have changed and the
+    /// properties of this phase do not depend on the species in other phases.
+    /// @param iphase The index of the phase in the system
+    /// @param T The temperature condition (in K)
+    /// @param P The pressure condition (in Pa)
+    /// @param np The amounts of the species in the phase (in mol)
+    auto updatePhase(Index iphase, real const& T, real const& P, ArrayXrConstRef np) -> void;
+
+    /// Update the chemical properties of a single phase in the system using ideal activity models.
+    /// @param iphase The index of the phase in the system
+    /// @param T The temperature condition (in K)
+    /// @param P The pressure condition (in Pa)
+    /// @param np The amounts of the species in the phase (in mol)
+    auto updatePhaseIdeal(Index iphase, real const& T, real const& P, ArrayXrConstRef np) -> void;
+
     /// Serialize the chemical properties into the array stream @p stream.
     /// @param stream The array stream used to serialize the chemical properties.
     auto serialize(ArrayStream<real>& stream) const -> void;
@@ -86,6 +110,78 @@ public:
     /// @param stream The array stream containing the serialized chemical properties.
     auto deserialize(const ArrayStream<double>& stream) -> void;
 
+    /// Serialize the chemical properties into the caller-provided array @p data.
+    /// No memory is allocated in this method, so that @p data can be a
+    /// segment of a larger buffer storing the chemical properties of many
+    /// states (e.g., for checkpointing or communication). The chemical
+    /// properties are serialized in the order given by @ref
+    /// serializationLayout and can be restored with @ref update.
+    /// @param data The array with @ref serializationSize entries where the chemical properties are serialized.
+    auto serialize(ArrayXrRef data) const -> void;
+
+    /// Serialize the chemical properties into the caller-provided array @p data.
+    /// @param data The array with @ref serializationSize entries where the chemical properties are serialized.
+    /// @see serialize(ArrayXrRef) const
+    auto serialize(ArrayXdRef data) const -> void;
+
+    /// Serialize only the chemical properties of a phase into the caller-provided array @p data.
+    /// The properties of the species in the phase and of the phase itself are
+    /// written at the same positions they have in @ref serialize(ArrayXrRef) const,
+    /// and all other entries of @p data are left untouched. This is useful
+    /// when only the properties of a single phase have changed since the last
+    /// serialization.
+    /// @param iphase The index of the phase in the system.
+    /// @param data The array with @ref serializationSize entries where the chemical properties of the phase are serialized.
+    auto serializePhase(Index iphase, ArrayXrRef data) const -> void;
+
+    /// Return the number of entries needed to serialize the chemical properties.
+    auto serializationSize() const -> Index;
+
+    /// Return the names and lengths of the serialized chemical properties, in the order they are serialized.
+    auto serializationLayout() const -> Pairs<String, Index>;
+
+    /// Return the approximate memory used by this ChemicalProps object, with a breakdown per group of properties.
+    auto memoryUsage() const -> MemoryUsage;
+
+    /// Enable or disable the reuse of the standard thermodynamic properties of the species in updates at unchanged temperature and pressure.
+    /// When enabled, the standard thermodynamic properties of the species in
+    /// a phase (e.g., their standard Gibbs energies and volumes) are only
+    /// computed again when temperature or pressure differ from those of the
+    /// last update of the phase, either in value or in derivative seed. This
+    /// is very effective in chemical equilibrium calculations at given
+    /// temperature and pressure, in which the properties are evaluated many
+    /// times with only the species amounts changing or seeded. Note that
+    /// changes in the parameters of the standard thermodynamic models are
+    /// not detected, so that @ref discardStandardThermoProps needs to be
+    /// called after them. This is disabled by default, and the flag is
+    /// copied together with this object.
+    auto reuseStandardThermoProps(bool enable) -> void;
+
+    /// Ensure the standard thermodynamic properties of the species are computed in the next update even if reused (see @ref reuseStandardThermoProps).
+    auto discardStandardThermoProps() -> void;
+
+    /// Enable or disable the extrapolation of the standard thermodynamic properties of the species in temperature.
+    /// When enabled with a positive temperature band @p dT (in K), the
+    /// standard thermodynamic properties of the species in a phase, together
+    /// with their temperature derivatives, are computed at a reference
+    /// temperature, and then extrapolated with Taylor expansions in the
+    /// following updates, as long as temperature stays within @p dT of the
+    /// reference temperature and pressure is unchanged. The standard Gibbs
+    /// energies are expanded to second order using @eq{\partial^2 G^\circ/\partial T^2=-C_P^\circ/T},
+    /// the standard enthalpies to second order, and the remaining properties
+    /// to first order. A new reference temperature is used once temperature
+    /// leaves this band. This is useful in chemical equilibrium calculations
+    /// in which temperature is unknown (e.g., with given enthalpy and
+    /// pressure), in which it changes at every iteration by small amounts,
+    /// since the standard thermodynamic models are then evaluated only a few
+    /// times. The extrapolated properties are approximations, whose errors
+    /// are of the order of the third power of the distance to the reference
+    /// temperature. The properties are always computed without extrapolation
+    /// when pressure is seeded for automatic differentiation. A zero value of
+    /// @p dT disables the extrapolation, which is the default, and the band is
+    /// copied together with this object.
+    auto extrapolateStandardThermoProps(double dT) -> void;
+
     /// Return the state identification number of this ChemicalProps object.
     /// Each time this ChemicalProps object is updated, its state identification
     /// number (`stateid`) is incremented. This is useful for memorizing
@@ -322,6 +418,9 @@ public:
     auto speciesStandardHeatCapacitiesConstV() const -> ArrayXr;
 
     /// Return the area of a surface in the system (in m2).
+    /// The areas of all surfaces are computed once after each update of these
+    /// chemical properties and reused by subsequent calls (e.g., from several
+    /// reaction rate models referencing the same surface).
     /// @param surface The name or index of the surface in the system.
     /// @warning An error is thrown if no surface with given name or index exists in the system.
     auto surfaceArea(StringOrIndex const& surface) const -> real;
@@ -475,9 +574,36 @@ private:
     /// The state identification number of this ChemicalProps object.
     Index mstateid = 0;
 
+    /// The generation number of the chemical state used in the last call to update(state).
+    std::uint64_t mgeneration = 0;
+
+    /// The state identification number of this ChemicalProps object right after the last call to update(state).
+    Index mgenerationstateid = 0;
+
     /// The ChemicalSystem object associated with this ChemicalProps object.
     ChemicalSystem msystem;
 
+    /// The flag indicating if the standard thermodynamic properties of the species are reused at unchanged temperature and pressure.
+    bool mreuse_standard_props = false;
+
+    /// The temperature at which the standard thermodynamic properties of the species in each phase were last computed (NaN if unknown).
+    ArrayXr Tstd;
+
+    /// The pressure at which the standard thermodynamic properties of the species in each phase were last computed (NaN if unknown).
+    ArrayXr Pstd;
+
+    /// The temperature band within which the standard thermodynamic properties of the species are extrapolated from a reference temperature (zero if not extrapolated).
+    double mstd_taylor_band = 0.0;
+
+    /// The reference temperatures of the extrapolation of the standard thermodynamic properties of the species in each phase (NaN if unknown).
+    ArrayXd Tref;
+
+    /// The reference pressures of the extrapolation of the standard thermodynamic properties of the species in each phase (NaN if unknown).
+    ArrayXd Pref;
+
+    /// The standard properties G0, H0, V0, VT0, VP0, Cp0 of the species at the reference temperatures (first six columns) and their temperature derivatives (last six columns).
+    ArrayXXd std_taylor;
+
     /// The temperature of the system (in K).
     real T;
 
@@ -487,8 +613,11 @@ private:
     /// The amounts of each species in the system (in mol).
     ArrayXr n;
 
-    /// The surface areas of the reacting phase interfaces (in m2).
-    ArrayXr s;
+    /// The surface areas of the reacting phase interfaces (in m2), computed on demand (see @ref surfaceArea).
+    mutable ArrayXr s;
+
+    /// The state identification number of this ChemicalProps object when the surface areas in `s` were last computed.
+    mutable Index msurfacestateid = -1;
 
     /// The temperatures of each phase (in K).
     ArrayXr Ts;
@@ -561,6 +690,20 @@ private:
     /// data from the activity model of a previous phase if needed.
     Map<String, Any> m_extra;
 
+    /// Update the chemical properties of the system with ideal or non-ideal activity models.
+    /// @param version The version of the arguments of the activity models of the phases (see ActivityModelArgs::version), or zero for a new one.
+    auto updateAux(real const& T, real const& P, ArrayXrConstRef n, bool ideal, std::uint64_t version) -> void;
+
+    /// Update the chemical properties of a phase, reusing the standard thermodynamic properties of its species if possible.
+    /// @param version The version of the arguments of the activity model of the phase (see ActivityModelArgs::version), or zero for a new one.
+    auto updatePhaseAux(Index iphase, real const& T, real const& P, ArrayXrConstRef np, bool ideal, std::uint64_t version) -> void;
+
+    /// Extrapolate the standard thermodynamic properties of the species in a phase from its reference temperature, which is first updated if @p T is outside the extrapolation band.
+    auto extrapolatePhaseStandardThermoProps(Index iphase, real const& T, real const& P) -> void;
+
+    /// Compute the areas of all surfaces in `s`, unless already computed for the current state.
+    auto updateSurfaceAreas() const -> void;
+
     /// Return a mutable view to the chemical properties of a phase with given index.
     /// @param phase The name or index of the phase in the system.
     auto phasePropsRef(StringOrIndex phase) -> ChemicalPropsPhaseRef;
@@ -49,6 +49,13 @@ def testChemicalProps(database: Database) -> None:
 
     assert props.speciesMoleFractions() == [0.3, 0.7]
     assert props.speciesActivitiesLn().asarray() == pytest.approx([log(3.0), log(7.0)])
+
+    # Zero-copy NumPy views of the arrays stored in the chemical properties
+    assert props.speciesAmountsArray() == pytest.approx([3.0, 7.0])
+    assert props.speciesMoleFractionsArray() == pytest.approx([0.3, 0.7])
+    assert props.speciesActivitiesLnArray() == pytest.approx([log(3.0), log(7.0)])
+    assert props.speciesChemicalPotentialsArray() == pytest.approx(props.speciesChemicalPotentials().asarray())
+    assert not props.speciesAmountsArray().flags.writeable
     # Partial molar volumes are only evaluated for phases with activity models with cubic EoSs.
     assert props.speciesPartialMolarVolumes() == 0.
 
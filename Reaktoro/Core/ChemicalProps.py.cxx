@@ -34,6 +34,9 @@ void exportChemicalProps(py::module& m)
         .def("update", py::overload_cast<real const&, real const&, ArrayXrConstRef>(&ChemicalProps::update), "Update the chemical properties of the system.")
         .def("update", py::overload_cast<ArrayXrConstRef>(&ChemicalProps::update), "Update the chemical properties of the system with serialized data.")
         .def("update", py::overload_cast<ArrayXdConstRef>(&ChemicalProps::update), "Update the chemical properties of the system with serialized data.")
+        .def("serializationSize", &ChemicalProps::serializationSize, "Return the number of entries needed to serialize the chemical properties.")
+        .def("serializationLayout", &ChemicalProps::serializationLayout, "Return the names and lengths of the serialized chemical properties, in the order they are serialized.")
+        .def("memoryUsage", &ChemicalProps::memoryUsage, "Return the approximate memory used by this ChemicalProps object, with a breakdown per group of properties.")
         .def("updateIdeal", py::overload_cast<ChemicalState const&>(&ChemicalProps::updateIdeal), "Update the chemical properties of the system using ideal activity models.")
         .def("updateIdeal", py::overload_cast<real const&, real const&, ArrayXrConstRef>(&ChemicalProps::updateIdeal), "Update the chemical properties of the system using ideal activity models.")
         .def("stateid", &ChemicalProps::stateid, "Return the state identification number of this ChemicalProps object")
@@ -97,6 +100,17 @@ void exportChemicalProps(py::module& m)
         .def("speciesStandardHelmholtzEnergies", &ChemicalProps::speciesStandardHelmholtzEnergies, "Return the standard partial molar Helmholtz energies of formation of the species in the system (in J/mol).")
         .def("speciesStandardHeatCapacitiesConstP", &ChemicalProps::speciesStandardHeatCapacitiesConstP, return_internal_ref, "Return the standard partial molar isobaric heat capacities of the species in the system (in J/(mol·K)).")
         .def("speciesStandardHeatCapacitiesConstV", &ChemicalProps::speciesStandardHeatCapacitiesConstV, return_internal_ref, "Return the standard partial molar isochoric heat capacities of the species in the system (in J/(mol·K)).")
+        .def("speciesAmountsArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesAmounts(), self); }, "Return a read-only NumPy view of the amounts of the species in the system (in mol) without copying them.")
+        .def("speciesMoleFractionsArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesMoleFractions(), self); }, "Return a read-only NumPy view of the mole fractions of the species in the system without copying them.")
+        .def("speciesActivityCoefficientsLnArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesActivityCoefficientsLn(), self); }, "Return a read-only NumPy view of the ln activity coefficients of the species in the system without copying them.")
+        .def("speciesActivitiesLnArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesActivitiesLn(), self); }, "Return a read-only NumPy view of the ln activities of the species in the system without copying them.")
+        .def("speciesChemicalPotentialsArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesChemicalPotentials(), self); }, "Return a read-only NumPy view of the chemical potentials of the species in the system (in J/mol) without copying them.")
+        .def("speciesStandardVolumesArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesStandardVolumes(), self); }, "Return a read-only NumPy view of the standard partial molar volumes of the species in the system (in m³/mol) without copying them.")
+        .def("speciesStandardVolumesTArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesStandardVolumesT(), self); }, "Return a read-only NumPy view of the temperature derivative of the standard molar volumes of the species in the system (in m³/(mol·K)) without copying them.")
+        .def("speciesStandardVolumesPArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesStandardVolumesP(), self); }, "Return a read-only NumPy view of the pressure derivative of the standard molar volumes of the species in the system (in m³/(mol·Pa)) without copying them.")
+        .def("speciesStandardGibbsEnergiesArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesStandardGibbsEnergies(), self); }, "Return a read-only NumPy view of the standard partial molar Gibbs energies of formation of the species in the system (in J/mol) without copying them.")
+        .def("speciesStandardEnthalpiesArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesStandardEnthalpies(), self); }, "Return a read-only NumPy view of the standard partial molar enthalpies of formation of the species in the system (in J/mol) without copying them.")
+        .def("speciesStandardHeatCapacitiesConstPArray", [](py::object self) { return realArrayView(self.cast<ChemicalProps const&>().speciesStandardHeatCapacitiesConstP(), self); }, "Return a read-only NumPy view of the standard partial molar isobaric heat capacities of the species in the system (in J/(mol·K)) without copying them.")
         .def("surfaceArea", &ChemicalProps::surfaceArea, "Return the area of a surface in the system (in m2).")
         .def("surfaceAreas", &ChemicalProps::surfaceAreas, "Return the areas of the surfaces in the system (in m2).")
         .def("molarVolume", &ChemicalProps::molarVolume, "Return the molar volume of the system (in m³/mol).")
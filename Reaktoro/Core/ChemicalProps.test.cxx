@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AllocationCounter.hpp>
 #include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -704,4 +705,308 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         props.deserialize(dstream);
         CHECK(props.stateid() == 9);
     }
+
+    SECTION("Testing serialization into caller-provided arrays")
+    {
+        ChemicalState state(system);
+        state.temperature(345.6, "K");
+        state.pressure(1.234, "bar");
+        state.setSpeciesAmounts(0.1234);
+
+        ChemicalProps props(state);
+
+        const auto size = props.serializationSize();
+        const auto layout = props.serializationLayout();
+
+        Index total = 0;
+        for(auto const& [name, length] : layout)
+            total += length;
+
+        CHECK( total == size );
+        CHECK( layout.front().first == "T" );
+        CHECK( layout.back().first == "u" );
+        CHECK( layout.back().second == system.species().size() );
+
+        ArrayStream<double> stream;
+        props.serialize(stream);
+
+        ArrayXd buffer = ArrayXd::Zero(3 * size); // the chemical properties of a state in the middle of a larger buffer
+        props.serialize(buffer.segment(size, size));
+
+        CHECK( (buffer.segment(size, size) == stream.data()).all() );
+        CHECK( (buffer.head(size) == 0.0).all() );
+        CHECK( (buffer.tail(size) == 0.0).all() );
+
+        ArrayXr rbuffer(size);
+        props.serialize(rbuffer);
+
+        CHECK( (rbuffer == stream.data().cast<real>()).all() );
+
+        // Serializing into preallocated storage is a steady-state hot path that must not allocate memory (only counted if AllocationCounter::supported)
+        AllocationCounter counter;
+        props.serialize(buffer.segment(size, size));
+        props.serialize(rbuffer);
+        CHECK( counter.stats().allocations == 0 );
+
+        ChemicalProps other(system);
+        other.update(ArrayXdConstRef(buffer.segment(size, size)));
+
+        CHECK( other.temperature() == props.temperature() );
+        CHECK( other.pressure() == props.pressure() );
+        CHECK( (other.speciesAmounts() == props.speciesAmounts()).all() );
+        CHECK( (other.speciesChemicalPotentials() == props.speciesChemicalPotentials()).all() );
+
+        // Serializing every phase separately produces all entries except temperature and pressure
+        ArrayXr pbuffer = ArrayXr::Zero(size);
+        for(auto k = 0; k < system.phases().size(); ++k)
+            props.serializePhase(k, pbuffer);
+
+        CHECK( pbuffer[0] == 0.0 );
+        CHECK( pbuffer[1] == 0.0 );
+        CHECK( (pbuffer.tail(size - 2) == rbuffer.tail(size - 2)).all() );
+
+        CHECK_THROWS( props.serialize(buffer) );
+
+        ArrayXr lbuffer(size + 1);
+        CHECK_THROWS( props.serializePhase(0, lbuffer) );
+    }
+
+    SECTION("Testing reuse of standard thermodynamic properties at unchanged temperature and pressure")
+    {
+        auto count = 0; // the number of evaluations of the standard thermodynamic model below
+
+        StandardThermoModel counting_model = [&](real T, real P)
+        {
+            ++count;
+            return standard_thermo_model_gas(T, P);
+        };
+
+        Database cdb;
+        cdb.addSpecies( Species("H2O(g)").withStandardThermoModel(counting_model) );
+        cdb.addSpecies( Species("CO2(g)").withStandardThermoModel(counting_model) );
+
+        Vec<Phase> cphases
+        {
+            Phase()
+                .withName("SomeGas")
+                .withActivityModel(activity_model_gas)
+                .withIdealActivityModel(activity_model_gas)
+                .withStateOfMatter(StateOfMatter::Gas)
+                .withSpecies(cdb.species())
+        };
+
+        ChemicalSystem csystem(cdb, cphases);
+
+        ChemicalProps cprops(csystem);
+
+        real T = 3.0;
+        real P = 5.0;
+        ArrayXr n = ArrayXr{{ 4.0, 6.0 }};
+
+        cprops.update(T, P, n);
+        cprops.update(T, P, n);
+
+        CHECK( count == 4 ); // the standard properties are computed in every update by default
+
+        cprops.reuseStandardThermoProps(true);
+
+        count = 0;
+
+        cprops.update(T, P, n);    // reused, since the previous update was at the same temperature and pressure
+        n[0] = 2.0;
+        cprops.update(T, P, n);    // reused
+        autodiff::seed(n[1]);
+        cprops.updateIdeal(T, P, n); // reused, since only a species amount is seeded
+        autodiff::unseed(n[1]);
+
+        CHECK( count == 0 );
+
+        const auto G0 = cprops.speciesStandardGibbsEnergies();
+        CHECK( G0[0] == Approx(0.1 * (T*P)*(T*P)) );
+
+        autodiff::seed(T);
+        cprops.update(T, P, n);    // computed because temperature is seeded
+        autodiff::unseed(T);
+
+        CHECK( count == 2 );
+        CHECK( grad(cprops.speciesStandardGibbsEnergies()[0]) == Approx(0.2 * T*P*P) );
+
+        cprops.update(T, P, n);    // computed because temperature is no longer seeded
+        cprops.update(T, P, n);    // reused
+
+        CHECK( count == 4 );
+        CHECK( grad(cprops.speciesStandardGibbsEnergies()[0]) == 0.0 );
+
+        P = 6.0;
+        cprops.update(T, P, n);    // computed because pressure changed
+
+        CHECK( count == 6 );
+        CHECK( cprops.speciesStandardGibbsEnergies()[0] == Approx(0.1 * (T*P)*(T*P)) );
+
+        cprops.discardStandardThermoProps();
+        cprops.update(T, P, n);    // computed because discarded
+
+        CHECK( count == 8 );
+
+        cprops.update(VectorXd(cprops)); // deserialization discards the reused properties
+        cprops.update(T, P, n);
+
+        CHECK( count == 10 );
+    }
+
+    SECTION("Testing reuse of the results of activity models for the same chemical state")
+    {
+        auto count = 0; // the number of evaluations of the activity model below
+
+        ActivityModel counting_model = [&](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            ++count;
+            activity_model_gas(props, args);
+        };
+
+        Vec<Phase> cphases
+        {
+            Phase()
+                .withName("SomeGas")
+                .withActivityModel(counting_model)
+                .withIdealActivityModel(activity_model_gas)
+                .withStateOfMatter(StateOfMatter::Gas)
+                .withSpecies({
+                    db.species().get("H2O(g)"),
+                    db.species().get("CO2(g)")})
+        };
+
+        ChemicalSystem csystem(db, cphases);
+
+        ChemicalState cstate(csystem);
+        cstate.setTemperature(3.0);
+        cstate.setPressure(5.0);
+        cstate.setSpeciesAmounts(ArrayXr{{ 4.0, 6.0 }});
+
+        ChemicalProps cprops1(csystem);
+        ChemicalProps cprops2(csystem);
+
+        cprops1.update(cstate);
+        cprops2.update(cstate); // reused, since the generation of the chemical state identifies the arguments of the activity model
+
+        CHECK( count == 1 );
+        CHECK( (cprops2.speciesActivitiesLn() == cprops1.speciesActivitiesLn()).all() );
+
+        cstate.setTemperature(4.0);
+        cprops2.update(cstate); // computed because temperature changed
+
+        CHECK( count == 2 );
+
+        cprops1.update(cstate.temperature(), cstate.pressure(), cstate.speciesAmounts()); // computed because the arguments have no known version
+
+        CHECK( count == 3 );
+    }
+
+    SECTION("Testing extrapolation of standard thermodynamic properties in temperature")
+    {
+        auto count = 0; // the number of evaluations of the standard thermodynamic model below
+
+        StandardThermoModel counting_model = [&](real T, real P) // a model for which the Taylor expansions are exact
+        {
+            ++count;
+            StandardThermoProps props;
+            props.G0  = -0.1 * T*T * P;
+            props.H0  =  0.1 * T*T * P;
+            props.Cp0 =  0.2 * T * P;
+            props.V0  =  0.3 * T * P;
+            return props;
+        };
+
+        Database cdb;
+        cdb.addSpecies( Species("H2O(g)").withStandardThermoModel(counting_model) );
+        cdb.addSpecies( Species("CO2(g)").withStandardThermoModel(counting_model) );
+
+        Vec<Phase> cphases
+        {
+            Phase()
+                .withName("SomeGas")
+                .withActivityModel(activity_model_gas)
+                .withIdealActivityModel(activity_model_gas)
+                .withStateOfMatter(StateOfMatter::Gas)
+                .withSpecies(cdb.species())
+        };
+
+        ChemicalSystem csystem(cdb, cphases);
+
+        ChemicalProps cprops(csystem);
+        cprops.extrapolateStandardThermoProps(2.0);
+
+        real T = 300.0;
+        real P = 5.0;
+        ArrayXr n = ArrayXr{{ 4.0, 6.0 }};
+
+        cprops.update(T, P, n);    // computed with derivatives at reference temperature 300 K
+
+        CHECK( count == 2 );
+
+        T = 301.5;
+        cprops.update(T, P, n);    // extrapolated
+
+        CHECK( count == 2 );
+        CHECK( cprops.speciesStandardGibbsEnergies()[0] == Approx(-0.1 * T*T * P) );
+        CHECK( cprops.speciesStandardEnthalpies()[0] == Approx(0.1 * T*T * P) );
+        CHECK( cprops.speciesStandardHeatCapacitiesConstP()[0] == Approx(0.2 * T * P) );
+        CHECK( cprops.speciesStandardVolumes()[1] == Approx(0.3 * T * P) );
+
+        autodiff::seed(T);
+        cprops.update(T, P, n);    // extrapolated, with derivatives with respect to temperature
+        autodiff::unseed(T);
+
+        CHECK( count == 2 );
+        CHECK( grad(cprops.speciesStandardGibbsEnergies()[0]) == Approx(-0.2 * T * P) );
+
+        T = 302.5;
+        cprops.update(T, P, n);    // computed because temperature is outside the band
+
+        CHECK( count == 4 );
+
+        P = 6.0;
+        cprops.update(T, P, n);    // computed because pressure changed
+
+        CHECK( count == 6 );
+        CHECK( cprops.speciesStandardGibbsEnergies()[0] == Approx(-0.1 * T*T * P) );
+
+        cprops.extrapolateStandardThermoProps(0.0);
+        cprops.update(T, P, n);    // computed because extrapolation is disabled
+
+        CHECK( count == 8 );
+
+        CHECK_THROWS( cprops.extrapolateStandardThermoProps(-1.0) );
+    }
+
+    SECTION("Testing surface areas computed once per update")
+    {
+        auto count = 0; // the number of evaluations of the surface area model below
+
+        SurfaceAreaModel counting_model = [&](ChemicalProps const& props)
+        {
+            ++count;
+            return 2.0 * props.speciesAmount("CaCO3(s)");
+        };
+
+        ChemicalSystem ssystem(db, phases, SurfaceList{ Surface("SomeSolid", counting_model) });
+
+        ChemicalProps sprops(ssystem);
+
+        const real T = 3.0;
+        const real P = 5.0;
+        const ArrayXr n = ArrayXr{{ 1.0, 2.0, 3.0 }};
+
+        sprops.update(T, P, n);
+
+        CHECK( sprops.surfaceArea("SomeSolid") == Approx(6.0) );
+        CHECK( sprops.surfaceArea(0) == Approx(6.0) );        // reused
+        CHECK( sprops.surfaceAreas()[0] == Approx(6.0) );     // reused
+        CHECK( count == 1 );
+
+        sprops.update(T, P, 2.0 * n);
+
+        CHECK( sprops.surfaceArea("SomeSolid") == Approx(12.0) ); // computed because chemical properties were updated
+        CHECK( count == 2 );
+    }
 }
@@ -0,0 +1,184 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalPropsBatch.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsPhase.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+
+struct ChemicalPropsBatch::Impl
+{
+    /// The chemical system of the states.
+    const ChemicalSystem system;
+
+    /// The number of worker threads requested (zero for the number of hardware threads).
+    Index numthreads = 1;
+
+    /// The activities (natural log) of the species in the states, one column per state.
+    MatrixXd ln_a;
+
+    /// The chemical potentials of the species in the states, one column per state.
+    MatrixXd u;
+
+    /// The volumes of the phases in the states, one column per state.
+    MatrixXd V;
+
+    /// The pool of worker threads (created on demand).
+    SharedPtr<ThreadPool> pool;
+
+    /// The chemical properties of the worker threads (created on demand).
+    Vec<ChemicalProps> props;
+
+    /// The species amounts of the state being evaluated by each worker thread.
+    Vec<ArrayXr> nstate;
+
+    /// Construct a ChemicalPropsBatch::Impl object with given chemical system.
+    Impl(ChemicalSystem const& system)
+    : system(system)
+    {}
+
+    /// Construct a copy of a ChemicalPropsBatch::Impl object (the workers are not copied).
+    Impl(Impl const& other)
+    : system(other.system), numthreads(other.numthreads), ln_a(other.ln_a), u(other.u), V(other.V)
+    {}
+
+    /// Ensure the pool of worker threads and their chemical properties exist.
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(numthreads);
+
+        const auto numworkers = pool->numThreads();
+
+        if(props.size() != numworkers)
+        {
+            props.assign(numworkers, ChemicalProps(system));
+            nstate.assign(numworkers, ArrayXr::Zero(system.species().size()));
+            for(auto& p : props)
+                p.reuseStandardThermoProps(true);
+        }
+
+        // The model parameters may have changed since the last update
+        for(auto& p : props)
+            p.discardStandardThermoProps();
+    }
+
+    /// Evaluate the chemical properties of the states.
+    auto update(ArrayXdConstRef T, ArrayXdConstRef P, MatrixXdConstRef n, bool ideal) -> void
+    {
+        const auto Nn = system.species().size();
+        const auto Np = system.phases().size();
+        const auto num_states = n.cols();
+
+        errorif(n.rows() != Nn, "Expecting the amounts of ", Nn, " species in each column of the species amounts matrix in ChemicalPropsBatch::update, but got ", n.rows(), ".");
+        errorif(T.size() != num_states, "Expecting ", num_states, " temperatures in ChemicalPropsBatch::update, one for each state, but got ", T.size(), ".");
+        errorif(P.size() != num_states, "Expecting ", num_states, " pressures in ChemicalPropsBatch::update, one for each state, but got ", P.size(), ".");
+
+        ln_a.resize(Nn, num_states);
+        u.resize(Nn, num_states);
+        V.resize(Np, num_states);
+
+        initializeWorkers();
+
+        pool->parallelFor(num_states, [&](Index i, Index iworker)
+        {
+            auto& chemprops = props[iworker];
+            auto& ni = nstate[iworker];
+
+            ni = n.col(i).array();
+
+            if(ideal) chemprops.updateIdeal(T[i], P[i], ni);
+            else chemprops.update(T[i], P[i], ni);
+
+            ln_a.col(i) = chemprops.speciesActivitiesLn().cast<double>().matrix();
+            u.col(i) = chemprops.speciesChemicalPotentials().cast<double>().matrix();
+
+            for(Index k = 0; k < Np; ++k)
+                V(k, i) = chemprops.phaseProps(k).volume();
+        });
+    }
+};
+
+ChemicalPropsBatch::ChemicalPropsBatch(ChemicalSystem const& system)
+: pimpl(new Impl(system))
+{}
+
+ChemicalPropsBatch::ChemicalPropsBatch(ChemicalPropsBatch const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ChemicalPropsBatch::~ChemicalPropsBatch()
+{}
+
+auto ChemicalPropsBatch::operator=(ChemicalPropsBatch other) -> ChemicalPropsBatch&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ChemicalPropsBatch::setNumThreads(Index numthreads) -> void
+{
+    if(pimpl->numthreads == numthreads)
+        return;
+    pimpl->numthreads = numthreads;
+    pimpl->pool.reset();
+    pimpl->props.clear();
+    pimpl->nstate.clear();
+}
+
+auto ChemicalPropsBatch::update(ArrayXdConstRef T, ArrayXdConstRef P, MatrixXdConstRef n) -> void
+{
+    pimpl->update(T, P, n, false);
+}
+
+auto ChemicalPropsBatch::updateIdeal(ArrayXdConstRef T, ArrayXdConstRef P, MatrixXdConstRef n) -> void
+{
+    pimpl->update(T, P, n, true);
+}
+
+auto ChemicalPropsBatch::system() const -> ChemicalSystem const&
+{
+    return pimpl->system;
+}
+
+auto ChemicalPropsBatch::size() const -> Index
+{
+    return pimpl->u.cols();
+}
+
+auto ChemicalPropsBatch::speciesActivitiesLn() const -> MatrixXdConstRef
+{
+    return pimpl->ln_a;
+}
+
+auto ChemicalPropsBatch::speciesChemicalPotentials() const -> MatrixXdConstRef
+{
+    return pimpl->u;
+}
+
+auto ChemicalPropsBatch::phaseVolumes() const -> MatrixXdConstRef
+{
+    return pimpl->V;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,96 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalSystem;
+
+/// Used to evaluate the chemical properties of many chemical states of the same chemical system.
+/// The temperatures, pressures and species amounts of the states are given
+/// as contiguous arrays, with the species amounts of each state in a column
+/// (as in ChemicalField). The evaluated properties are stored likewise, with
+/// one column per state, so that they can be post-processed in bulk (e.g.,
+/// to generate datasets for machine learning) without creating a
+/// ChemicalProps object per state. The states are distributed among a pool
+/// of worker threads, each evaluating its states with its own ChemicalProps
+/// object. The standard thermodynamic properties of the species are
+/// computed again only when the temperature or pressure of a state differ
+/// from those of the previous state evaluated by the same worker (see
+/// ChemicalProps::reuseStandardThermoProps), which is very effective when
+/// many states share the same temperature and pressure.
+/// @note The thermodynamic models are still evaluated one state at a time,
+/// since they are general functions of a single state.
+class ChemicalPropsBatch
+{
+public:
+    /// Construct a ChemicalPropsBatch object with given chemical system.
+    explicit ChemicalPropsBatch(ChemicalSystem const& system);
+
+    /// Construct a copy of a ChemicalPropsBatch object.
+    ChemicalPropsBatch(ChemicalPropsBatch const& other);
+
+    /// Destroy this ChemicalPropsBatch object.
+    ~ChemicalPropsBatch();
+
+    /// Assign a copy of a ChemicalPropsBatch object to this.
+    auto operator=(ChemicalPropsBatch other) -> ChemicalPropsBatch&;
+
+    /// Set the number of worker threads used to evaluate the chemical properties of the states.
+    /// If zero, the number of hardware threads available is used. The default is one.
+    auto setNumThreads(Index numthreads) -> void;
+
+    /// Evaluate the chemical properties of the states.
+    /// @param T The temperatures of the states (in K)
+    /// @param P The pressures of the states (in Pa)
+    /// @param n The amounts of the species in the states, one column per state (in mol)
+    auto update(ArrayXdConstRef T, ArrayXdConstRef P, MatrixXdConstRef n) -> void;
+
+    /// Evaluate the chemical properties of the states using ideal activity models.
+    /// @param T The temperatures of the states (in K)
+    /// @param P The pressures of the states (in Pa)
+    /// @param n The amounts of the species in the states, one column per state (in mol)
+    auto updateIdeal(ArrayXdConstRef T, ArrayXdConstRef P, MatrixXdConstRef n) -> void;
+
+    /// Return the chemical system of the states.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Return the number of states evaluated in the last update.
+    auto size() const -> Index;
+
+    /// Return the activities (natural log) of the species in the states, one column per state.
+    auto speciesActivitiesLn() const -> MatrixXdConstRef;
+
+    /// Return the chemical potentials of the species in the states, one column per state (in J/mol).
+    auto speciesChemicalPotentials() const -> MatrixXdConstRef;
+
+    /// Return the volumes of the phases in the states, one column per state (in m³).
+    auto phaseVolumes() const -> MatrixXdConstRef;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
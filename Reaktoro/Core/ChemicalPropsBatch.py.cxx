@@ -0,0 +1,40 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalPropsBatch.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+void exportChemicalPropsBatch(py::module& m)
+{
+    py::class_<ChemicalPropsBatch>(m, "ChemicalPropsBatch")
+        .def(py::init<ChemicalSystem const&>())
+        .def("clone", [](ChemicalPropsBatch const& self) { return ChemicalPropsBatch(self); }, "Return a deep copy of this ChemicalPropsBatch object.")
+        .def("setNumThreads", &ChemicalPropsBatch::setNumThreads, "Set the number of worker threads used to evaluate the chemical properties of the states.")
+        .def("update", &ChemicalPropsBatch::update, "Evaluate the chemical properties of the states.")
+        .def("updateIdeal", &ChemicalPropsBatch::updateIdeal, "Evaluate the chemical properties of the states using ideal activity models.")
+        .def("system", &ChemicalPropsBatch::system, return_internal_ref, "Return the chemical system of the states.")
+        .def("size", &ChemicalPropsBatch::size, "Return the number of states evaluated in the last update.")
+        .def("speciesActivitiesLn", &ChemicalPropsBatch::speciesActivitiesLn, return_internal_ref, "Return the activities (natural log) of the species in the states, one column per state.")
+        .def("speciesChemicalPotentials", &ChemicalPropsBatch::speciesChemicalPotentials, return_internal_ref, "Return the chemical potentials of the species in the states, one column per state (in J/mol).")
+        .def("phaseVolumes", &ChemicalPropsBatch::phaseVolumes, return_internal_ref, "Return the volumes of the phases in the states, one column per state (in m³).")
+        ;
+}
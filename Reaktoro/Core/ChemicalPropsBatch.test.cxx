@@ -0,0 +1,111 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsBatch.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Extensions/Nasa.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ChemicalPropsBatch", "[ChemicalPropsBatch]")
+{
+    NasaDatabase db("nasa-cea");
+
+    ChemicalSystem system(db,
+        CondensedPhase("C(gr)"),
+        GaseousPhase("O2 CO2")
+    );
+
+    const auto Nn = system.species().size();
+    const auto Np = system.phases().size();
+    const auto num_states = 7;
+
+    ArrayXd T(num_states);
+    ArrayXd P(num_states);
+    MatrixXd n(Nn, num_states);
+
+    for(auto i = 0; i < num_states; ++i)
+    {
+        T[i] = (i < 4) ? 400.0 : 500.0 + 10.0*i; // the first states share the same temperature and pressure
+        P[i] = (i < 4) ? 1.0e5 : 1.0e5 * (i + 1);
+        n.col(i) = VectorXd::LinSpaced(Nn, 1.0, 2.0) * (i + 1);
+    }
+
+    auto checkBatch = [&](ChemicalPropsBatch const& batch, bool ideal)
+    {
+        REQUIRE( batch.size() == num_states );
+        REQUIRE( batch.speciesActivitiesLn().rows() == Nn );
+        REQUIRE( batch.speciesChemicalPotentials().rows() == Nn );
+        REQUIRE( batch.phaseVolumes().rows() == Np );
+
+        ChemicalProps props(system);
+
+        for(auto i = 0; i < num_states; ++i)
+        {
+            ArrayXr ni = n.col(i);
+
+            if(ideal) props.updateIdeal(T[i], P[i], ni);
+            else props.update(T[i], P[i], ni);
+
+            for(auto j = 0; j < Nn; ++j)
+            {
+                CHECK( batch.speciesActivitiesLn()(j, i) == Approx(props.speciesActivitiesLn()[j]) );
+                CHECK( batch.speciesChemicalPotentials()(j, i) == Approx(props.speciesChemicalPotentials()[j]) );
+            }
+
+            for(auto k = 0; k < Np; ++k)
+                CHECK( batch.phaseVolumes()(k, i) == Approx(props.phaseProps(k).volume()) );
+        }
+    };
+
+    ChemicalPropsBatch batch(system);
+
+    SECTION("When the states are evaluated by a single thread")
+    {
+        batch.update(T, P, n);
+        checkBatch(batch, false);
+
+        batch.updateIdeal(T, P, n);
+        checkBatch(batch, true);
+    }
+
+    SECTION("When the states are evaluated by many threads")
+    {
+        batch.setNumThreads(3);
+
+        batch.update(T, P, n);
+        checkBatch(batch, false);
+
+        ChemicalPropsBatch copy(batch);
+        checkBatch(copy, false);
+
+        copy.update(T, P, n);
+        checkBatch(copy, false);
+    }
+
+    SECTION("When the given arrays have inconsistent dimensions")
+    {
+        CHECK_THROWS( batch.update(T.head(3), P, n) );
+        CHECK_THROWS( batch.update(T, P.head(3), n) );
+        CHECK_THROWS( batch.update(T, P, n.topRows(1)) );
+    }
+}
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
@@ -216,9 +217,11 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    /// @param standard The flag indicating if the standard thermodynamic properties of the species should be computed (otherwise, their current values, computed at the same temperature and pressure, are kept)
+    /// @param version The version of the arguments of the activity model, or zero if unknown (see ActivityModelArgs::version)
+    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool standard = true, std::uint64_t version = 0)
     {
-        _update<false>(T, P, n, extra);
+        _update<false>(T, P, n, extra, standard, version);
     }
 
     /// Update the chemical properties of the phase using ideal activity models.
@@ -226,9 +229,11 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    /// @param standard The flag indicating if the standard thermodynamic properties of the species should be computed (otherwise, their current values, computed at the same temperature and pressure, are kept)
+    /// @param version The version of the arguments of the activity model, or zero if unknown (see ActivityModelArgs::version)
+    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool standard = true, std::uint64_t version = 0)
     {
-        _update<true>(T, P, n, extra);
+        _update<true>(T, P, n, extra, standard, version);
     }
 
     /// Update the chemical properties of the phase with given data.
@@ -623,9 +628,13 @@ private:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra data mapped to activity mode
+    /// @param standard The flag indicating if the standard thermodynamic properties of the species should be computed
+    /// @param version The version of the arguments of the activity model, or zero if unknown
     template<bool use_ideal_activity_model>
-    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool standard, std::uint64_t version)
     {
+        REAKTORO_PROFILE("ChemicalPropsPhase::update");
+
         mdata.T = T;
         mdata.P = P;
         mdata.n = n;
@@ -668,17 +677,22 @@ private:
         assert(    u.size() == N );
         assert(   Vxi.size() == N );
 
-        // Compute the standard thermodynamic properties of the species in the phase.
-        StandardThermoProps aux;
-        for(auto i = 0; i < N; ++i)
+        // Compute the standard thermodynamic properties of the species in the phase (unless these are known to be up-to-date).
+        if(standard)
         {
-            aux = species[i].standardThermoProps(T, P);
-            G0[i]  = aux.G0;
-            H0[i]  = aux.H0;
-            V0[i]  = aux.V0;
-            VT0[i] = aux.VT0;
-            VP0[i] = aux.VP0;
-            Cp0[i] = aux.Cp0;
+            REAKTORO_PROFILE("StandardThermoModel");
+
+            StandardThermoProps aux;
+            for(auto i = 0; i < N; ++i)
+            {
+                aux = species[i].standardThermoProps(T, P);
+                G0[i]  = aux.G0;
+                H0[i]  = aux.H0;
+                V0[i]  = aux.V0;
+                VT0[i] = aux.VT0;
+                VP0[i] = aux.VP0;
+                Cp0[i] = aux.Cp0;
+            }
         }
 
         // Compute the amount of the phase
@@ -687,6 +701,22 @@ private:
         // Compute the mass of the phase
         msum = (n * mphase.speciesMolarMasses()).sum();
 
+        // Skip mole fractions and activity model evaluation for a single-species phase with unit activity (e.g., a pure mineral)
+        const auto trivial = use_ideal_activity_model ?
+            phase().hasTrivialIdealActivityModel() : phase().hasTrivialActivityModel();
+
+        if(trivial)
+        {
+            x = 1.0;
+            Vx = VxT = VxP = Gx = Hx = Cpx = 0.0;
+            Vxi = 0.0;
+            ln_g = 0.0;
+            ln_a = 0.0;
+            som = phase().stateOfMatter();
+            u = G0;
+            return;
+        }
+
         // Compute the mole fractions of the species
         if(nsum == 0.0)
             x = (N == 1) ? 1.0 : 0.0;
@@ -698,12 +728,16 @@ private:
 
         // Compute the activity properties of the phase
         ActivityPropsRef aprops{ Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, som, extra };
-        ActivityModelArgs args{ T, P, x };
+        ActivityModelArgs args{ T, P, x, version };
         const ActivityModel& activity_model = use_ideal_activity_model ?  // IMPORTANT: Use `const ActivityModel&` here instead of `ActivityModel`, otherwise a new model is constructed without cache, and so memoization will not take effect.
             phase().idealActivityModel() : phase().activityModel();
 
         if(nsum == 0.0) aprops = 0.0;
-        else activity_model(aprops, args);
+        else
+        {
+            REAKTORO_PROFILE("ActivityModel");
+            activity_model(aprops, args);
+        }
 
         // Compute the chemical potentials of the species
         u = G0 + R*T*ln_a;
@@ -0,0 +1,108 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ChemicalPropsStream.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+
+namespace Reaktoro {
+
+struct ChemicalPropsStream::Impl
+{
+    /// The path to the output file.
+    const String filepath;
+
+    /// The format of the output file.
+    const TableStream::Format format;
+
+    /// The number of rows in each chunk handed to the background writer.
+    const Index chunksize;
+
+    /// The names of the columns in the output file.
+    Strings names;
+
+    /// The functions evaluating the quantities in each column.
+    Vec<Fn<real(ChemicalProps const&)>> quantities;
+
+    /// The values of the quantities in the current row.
+    ArrayXd row;
+
+    /// The stream writing the rows to the file (created on the first call to `append`).
+    Ptr<TableStream> stream;
+
+    Impl(String const& filepath, TableStream::Format format, Index chunksize)
+    : filepath(filepath), format(format), chunksize(chunksize)
+    {}
+
+    auto add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void
+    {
+        errorif(stream, "Cannot add quantity `", name, "` to a ChemicalPropsStream object after rows have been appended to it.");
+        names.push_back(name);
+        quantities.push_back(quantity);
+    }
+
+    auto append(ChemicalProps const& props) -> void
+    {
+        if(!stream)
+        {
+            stream = std::make_unique<TableStream>(filepath, names, format, chunksize);
+            row.resize(quantities.size());
+        }
+        for(auto i = 0; i < quantities.size(); ++i)
+            row[i] = quantities[i](props).val();
+        stream->append(row);
+    }
+};
+
+ChemicalPropsStream::ChemicalPropsStream(String const& filepath, TableStream::Format format, Index chunksize)
+: pimpl(new Impl(filepath, format, chunksize))
+{}
+
+ChemicalPropsStream::~ChemicalPropsStream()
+{}
+
+auto ChemicalPropsStream::add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void
+{
+    pimpl->add(name, quantity);
+}
+
+auto ChemicalPropsStream::append(ChemicalProps const& props) -> void
+{
+    pimpl->append(props);
+}
+
+auto ChemicalPropsStream::flush() -> void
+{
+    if(pimpl->stream)
+        pimpl->stream->flush();
+}
+
+auto ChemicalPropsStream::close() -> void
+{
+    if(pimpl->stream)
+        pimpl->stream->close();
+}
+
+auto ChemicalPropsStream::rows() const -> Index
+{
+    return pimpl->stream ? pimpl->stream->rows() : 0;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,75 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/TableStream.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+
+/// Used to write chosen chemical properties of a sequence of chemical states to a file.
+/// The quantities to be output are registered with @ref add before the first
+/// state is appended. Each call to @ref append evaluates these quantities
+/// for the given ChemicalProps object and hands the resulting row to a
+/// TableStream object, which writes it to the file in a background thread.
+/// This is useful in long simulations (e.g., reactive transport or kinetics)
+/// in which keeping every output row in a Table object until the end is not
+/// possible.
+class ChemicalPropsStream
+{
+public:
+    /// Construct a ChemicalPropsStream object that writes to a file.
+    /// @param filepath The path to the file that will be created, including its file name.
+    /// @param format The format of the file.
+    /// @param chunksize The number of rows in each chunk handed to the background writer.
+    explicit ChemicalPropsStream(String const& filepath, TableStream::Format format = TableStream::Format::Text, Index chunksize = 1024);
+
+    /// Destroy this ChemicalPropsStream object after writing all appended rows.
+    ~ChemicalPropsStream();
+
+    /// Register a quantity to be output in a column with given name.
+    /// @param name The name of the column.
+    /// @param quantity The function that evaluates the quantity for given chemical properties.
+    /// @warning An error is thrown if this method is called after the first call to @ref append.
+    auto add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void;
+
+    /// Evaluate the registered quantities for given chemical properties and append them as a new row.
+    auto append(ChemicalProps const& props) -> void;
+
+    /// Write all appended rows to the file and wait until this is done.
+    auto flush() -> void;
+
+    /// Write all appended rows to the file and close it.
+    auto close() -> void;
+
+    /// Return the number of rows appended so far.
+    auto rows() const -> Index;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,37 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsStream.hpp>
+using namespace Reaktoro;
+
+void exportChemicalPropsStream(py::module& m)
+{
+    py::class_<ChemicalPropsStream>(m, "ChemicalPropsStream")
+        .def(py::init<String const&, TableStream::Format, Index>(), "filepath"_a, "format"_a = TableStream::Format::Text, "chunksize"_a = 1024)
+        .def("add", &ChemicalPropsStream::add, "Register a quantity to be output in a column with given name.")
+        .def("append", &ChemicalPropsStream::append, "Evaluate the registered quantities for given chemical properties and append them as a new row.")
+        .def("flush", &ChemicalPropsStream::flush, "Write all appended rows to the file and wait until this is done.")
+        .def("close", &ChemicalPropsStream::close, "Write all appended rows to the file and close it.")
+        .def("rows", &ChemicalPropsStream::rows, "Return the number of rows appended so far.")
+        ;
+}
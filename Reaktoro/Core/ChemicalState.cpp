@@ -18,7 +18,9 @@
 #include "ChemicalState.hpp"
 
 // C++ includes
+#include <atomic>
 #include <fstream>
+#include <mutex>
 
 // cpp-tabulate includes
 #include <tabulate/table.hpp>
@@ -32,9 +34,21 @@ using namespace tabulate;
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Units.hpp>
+#include <Reaktoro/Core/ActivityModel.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return a new generation number, unique across all ChemicalState objects in the program.
+/// Generation numbers are drawn from the versions of ActivityModelArgs
+/// objects, so that ChemicalProps::update(state) can use them as such.
+auto newGeneration() -> std::uint64_t
+{
+    return newActivityModelArgsVersion();
+}
+
+} // namespace
 
 //=================================================================================================
 //
@@ -62,6 +76,34 @@ struct ChemicalState::Impl
     /// The amounts of the chemical species (in mol)
     ArrayXr n;
 
+    /// The generation number of the current temperature, pressure and species amounts.
+    std::uint64_t generation = newGeneration();
+
+    /// The chemical properties serialized in double precision while #props is released (empty if not compact).
+    ArrayXd compactprops;
+
+    /// Used to have a mutex in Impl objects that can be copied (each copy has its own mutex).
+    struct Mutex : std::mutex
+    {
+        Mutex() = default;
+        Mutex(Mutex const&) {}
+    };
+
+    /// Used to have an atomic flag in Impl objects that can be copied and assigned.
+    struct Flag : std::atomic<bool>
+    {
+        Flag(bool value = false) : std::atomic<bool>(value) {}
+        Flag(Flag const& other) : std::atomic<bool>(other.load()) {}
+        auto operator=(bool value) -> Flag& { store(value); return *this; }
+        auto operator=(Flag const& other) -> Flag& { store(other.load()); return *this; }
+    };
+
+    /// The flag indicating if the chemical properties are stored in compact form in #compactprops.
+    Flag compact = false;
+
+    /// The mutex used to restore the chemical properties from their compact form when read from concurrent threads.
+    Mutex mutex;
+
     /// Construct a ChemicalState::Impl instance with given chemical system.
     Impl(ChemicalSystem const& system)
     : system(system), equilibrium(system), props(system)
@@ -69,10 +111,47 @@ struct ChemicalState::Impl
         n.setConstant(system.species().size(), 1e-16); // set small positive value for initial species amounts
     }
 
+    /// Store the chemical properties in compact form, releasing the memory of #props.
+    auto compactProps() -> void
+    {
+        if(compact)
+            return;
+        static const ChemicalProps empty; // shared by all compact states so that releasing #props allocates nothing
+        compactprops.resize(props.serializationSize());
+        props.serialize(compactprops);
+        props = empty;
+        compact = true;
+    }
+
+    /// Restore the chemical properties from their compact form, if needed.
+    auto expandProps() -> void
+    {
+        if(!compact)
+            return;
+        props = ChemicalProps(system);
+        props.update(compactprops);
+        compactprops.resize(0);
+        compact = false;
+    }
+
+    /// Update the chemical properties with the current temperature, pressure and species amounts.
+    auto updateProps() -> void
+    {
+        expandProps();
+        props.update(T, P, n);
+    }
+
+    /// Assign a new generation number after a change in temperature, pressure or species amounts.
+    auto modified() -> void
+    {
+        generation = newGeneration();
+    }
+
     auto temperature(real const& val) -> void
     {
         errorif(val <= 0.0, "Expecting a positive temperature value, but got ", val, " K.");
         T = val;
+        modified();
     }
 
     auto temperature(real val, Chars unit) -> void
@@ -84,6 +163,7 @@ struct ChemicalState::Impl
     {
         errorif(val <= 0.0, "Expecting a positive pressure value, but got ", val, " Pa.");
         P = val;
+        modified();
     }
 
     auto pressure(real val, Chars unit) -> void
@@ -100,18 +180,21 @@ struct ChemicalState::Impl
     {
         errorif(val < 0.0, "It is not possible to set a negative value for the species amounts.");
         n.fill(val);
+        modified();
     }
 
     auto setSpeciesAmounts(ArrayXrConstRef const& values) -> void
     {
         errorif(n.size() != values.size(), "Expecting given vector of species amounts to be of size ", n.size(), " but its size is ", values.size(), ".");
         n = values;
+        modified();
     }
 
     auto setSpeciesAmounts(ArrayXdConstRef const& values) -> void
     {
         errorif(n.size() != values.size(), "Expecting given vector of species amounts to be of size ", n.size(), " but its size is ", values.size(), ".");
         n = values;
+        modified();
     }
 
     auto setSpeciesAmount(Index ispecies, real const& amount) -> void
@@ -119,6 +202,7 @@ struct ChemicalState::Impl
         errorif(amount < 0.0, "Expecting a non-negative amount value, but got ", amount, " mol.");
         errorif(ispecies >= system.species().size(), "Given species index ", ispecies, " is greater than number of species, `", system.species().size(), ".");
         n[ispecies] = amount;
+        modified();
     }
 
     auto setSpeciesAmount(StringOrIndex const& species, real amount, Chars unit) -> void
@@ -127,6 +211,7 @@ struct ChemicalState::Impl
         const auto ispecies = detail::resolveSpeciesIndexOrRaiseError(system, species);
         errorif(ispecies >= system.species().size(), "Could not find a species in the system with index or name `", stringfy(species), "`.");
         n[ispecies] = units::convert(amount, unit, "mol");
+        modified();
     }
 
     auto setSpeciesMass(StringOrIndex const& species, real mass, Chars unit) -> void
@@ -135,6 +220,7 @@ struct ChemicalState::Impl
         const auto ispecies = detail::resolveSpeciesIndexOrRaiseError(system, species);
         errorif(ispecies >= system.species().size(), "Could not find a species in the system with index or name `", stringfy(species), "`.");
         n[ispecies] = units::convert(mass, unit, "kg") / system.species(ispecies).molarMass();
+        modified();
     }
 
     auto set(StringOrIndex const& species, real value, Chars unit) -> void
@@ -145,6 +231,7 @@ struct ChemicalState::Impl
         errorif(ispecies >= numspecies, "Could not find a species in the system with index or name `", stringfy(species), "`.");
         const auto amount = detail::computeSpeciesAmount(system, ispecies, value, unit);
         n[ispecies] = amount;
+        modified();
     }
 
     auto add(StringOrIndex const& species, real value, Chars unit) -> void
@@ -154,6 +241,7 @@ struct ChemicalState::Impl
         errorif(ispecies >= numspecies, "Could not find a species in the system with index or name `", stringfy(species), "`.");
         const auto amount = detail::computeSpeciesAmount(system, ispecies, value, unit);
         n[ispecies] += amount;
+        modified();
         errorif(n[ispecies] < 0.0, "It is not possible to add a negative species amount (", value, " ", unit, ") that produces a negative amount for the species.");
     }
 
@@ -186,14 +274,17 @@ struct ChemicalState::Impl
 
     auto componentAmounts() const -> ArrayXr
     {
-        auto const& A = system.formulaMatrix();
-        return A * n.matrix();
+        auto const& A = system.formulaMatrixSparse();
+        const VectorXr b = A * n.matrix();
+        return b.array();
     }
 
     auto elementAmounts() const -> ArrayXr
     {
-        auto const& Ae = system.formulaMatrixElements();
-        return Ae * n.matrix();
+        auto const& A = system.formulaMatrixSparse(); // the last row, corresponding to charge, is dropped below
+        const auto Ne = system.elements().size();
+        const VectorXr b = A * n.matrix();
+        return b.head(Ne).array();
     }
 
     auto charge() const -> real
@@ -210,12 +301,14 @@ struct ChemicalState::Impl
     {
         errorif(scalar < 0.0, "Expecting a non-negative scaling factor, but got ", scalar);
         n *= scalar;
+        modified();
     }
 
     auto scaleSpeciesAmounts(double scalar, Indices const& indices) -> void
     {
         errorif(scalar < 0.0, "Expecting a non-negative scaling factor, but got ", scalar);
         n(indices) *= scalar;
+        modified();
     }
 
     auto scaleSpeciesAmountsInPhase(StringOrIndex const& phase, double scalar) -> void
@@ -226,6 +319,7 @@ struct ChemicalState::Impl
         const auto start = system.phases().numSpeciesUntilPhase(iphase);
         const auto size = system.phase(iphase).species().size();
         n.segment(start, size) *= scalar;
+        modified();
     }
 
     // --------------------------------------------------------------------------------------------
@@ -236,7 +330,7 @@ struct ChemicalState::Impl
     {
         errorif(amount < 0.0, "Expecting a non-negative amount value, but got ", amount, " ", unit);
         amount = units::convert(amount, unit, "mol");
-        props.update(T, P, n);
+        updateProps();
         const auto current_amount = props.amount();
         const auto scalar = (current_amount != 0.0) ? amount/current_amount : real(0.0);
         scaleSpeciesAmounts(scalar);
@@ -248,7 +342,7 @@ struct ChemicalState::Impl
         amount = units::convert(amount, unit, "mol");
         const auto iphase = detail::resolvePhaseIndexOrRaiseError(system, phase);
         errorif(iphase >= system.phases().size(), "Could not find a phase in the system with index or name `", stringfy(phase));
-        props.update(T, P, n);
+        updateProps();
         const auto current_amount = props.phaseProps(iphase).amount();
         const auto scalar = (current_amount != 0.0) ? amount/current_amount : real(0.0);
         scaleSpeciesAmountsInPhase(iphase, scalar);
@@ -258,26 +352,28 @@ struct ChemicalState::Impl
     {
         errorif(amount < 0.0, "Expecting a non-negative amount value, but got ", amount, " ", unit);
         amount = units::convert(amount, unit, "mol");
-        props.update(T, P, n);
+        updateProps();
         const auto ifluidphases = props.indicesPhasesWithFluidState();
         const auto current_fluid_amount =
             Reaktoro::sum(ifluidphases, [&](auto i) { return props.phaseProps(i).amount(); });
         auto const& factor = current_fluid_amount > 0.0 ? amount / current_fluid_amount : real(0.0);
         auto const& ifluidspecies = system.phases().indicesSpeciesInPhases(ifluidphases);
         n(ifluidspecies) *= factor;
+        modified();
     }
 
     auto scaleSolidAmount(real amount, Chars unit) -> void
     {
         errorif(amount < 0.0, "Expecting a non-negative amount value, but got ", amount, " ", unit);
         amount = units::convert(amount, unit, "mol");
-        props.update(T, P, n);
+        updateProps();
         const auto isolidphases = props.indicesPhasesWithSolidState();
         const auto current_solid_amount =
             Reaktoro::sum(isolidphases, [&](auto i) { return props.phaseProps(i).amount(); });
         auto const& factor = current_solid_amount > 0.0 ? amount / current_solid_amount : real(0.0);
         auto const& isolidspecies = system.phases().indicesSpeciesInPhases(isolidphases);
         n(isolidspecies) *= factor;
+        modified();
     }
 
     // --------------------------------------------------------------------------------------------
@@ -288,7 +384,7 @@ struct ChemicalState::Impl
     {
         errorif(mass < 0.0, "Expecting a non-negative mass value, but got ", mass, " ", unit);
         mass = units::convert(mass, unit, "kg");
-        props.update(T, P, n);
+        updateProps();
         const auto current_mass = props.mass();
         const auto scalar = (current_mass != 0.0) ? mass/current_mass : real(0.0);
         scaleSpeciesAmounts(scalar);
@@ -300,7 +396,7 @@ struct ChemicalState::Impl
         mass = units::convert(mass, unit, "kg");
         const auto iphase = detail::resolvePhaseIndexOrRaiseError(system, phase);
         errorif(iphase >= system.phases().size(), "Could not find a phase in the system with index or name `", stringfy(phase));
-        props.update(T, P, n);
+        updateProps();
         const auto current_mass = props.phaseProps(iphase).mass();
         const auto scalar = (current_mass != 0.0) ? mass/current_mass : real(0.0);
         scaleSpeciesAmountsInPhase(iphase, scalar);
@@ -310,26 +406,28 @@ struct ChemicalState::Impl
     {
         errorif(mass < 0.0, "Expecting a non-negative mass value, but got ", mass, " ", unit);
         mass = units::convert(mass, unit, "kg");
-        props.update(T, P, n);
+        updateProps();
         const auto ifluidphases = props.indicesPhasesWithFluidState();
         const auto current_fluid_mass =
             Reaktoro::sum(ifluidphases, [&](auto i) { return props.phaseProps(i).mass(); });
         auto const& factor = current_fluid_mass > 0.0 ? mass / current_fluid_mass : real(0.0);
         auto const& ifluidspecies = system.phases().indicesSpeciesInPhases(ifluidphases);
         n(ifluidspecies) *= factor;
+        modified();
     }
 
     auto scaleSolidMass(real mass, Chars unit) -> void
     {
         errorif(mass < 0.0, "Expecting a non-negative mass value, but got ", mass, " ", unit);
         mass = units::convert(mass, unit, "kg");
-        props.update(T, P, n);
+        updateProps();
         const auto isolidphases = props.indicesPhasesWithSolidState();
         const auto current_solid_mass =
             Reaktoro::sum(isolidphases, [&](auto i) { return props.phaseProps(i).mass(); });
         auto const& factor = current_solid_mass > 0.0 ? mass / current_solid_mass : real(0.0);
         auto const& isolidspecies = system.phases().indicesSpeciesInPhases(isolidphases);
         n(isolidspecies) *= factor;
+        modified();
     }
 
     // --------------------------------------------------------------------------------------------
@@ -340,7 +438,7 @@ struct ChemicalState::Impl
     {
         errorif(volume < 0.0, "Expecting a non-negative volume value, but got ", volume, " ", unit);
         volume = units::convert(volume, unit, "m3");
-        props.update(T, P, n);
+        updateProps();
         const auto current_volume = props.volume();
         const auto scalar = (current_volume != 0.0) ? volume/current_volume : real(0.0);
         scaleSpeciesAmounts(scalar);
@@ -352,7 +450,7 @@ struct ChemicalState::Impl
         volume = units::convert(volume, unit, "m3");
         const auto iphase = detail::resolvePhaseIndexOrRaiseError(system, phase);
         errorif(iphase >= system.phases().size(), "Could not find a phase in the system with index or name `", stringfy(phase));
-        props.update(T, P, n);
+        updateProps();
         const auto current_volume = props.phaseProps(iphase).volume();
         const auto scalar = (current_volume != 0.0) ? volume/current_volume : real(0.0);
         scaleSpeciesAmountsInPhase(iphase, scalar);
@@ -362,26 +460,28 @@ struct ChemicalState::Impl
     {
         errorif(volume < 0.0, "Expecting a non-negative volume value, but got ", volume, " ", unit);
         volume = units::convert(volume, unit, "m3");
-        props.update(T, P, n);
+        updateProps();
         const auto ifluidphases = props.indicesPhasesWithFluidState();
         const auto current_fluid_volume =
             Reaktoro::sum(ifluidphases, [&](auto i) { return props.phaseProps(i).volume(); });
         auto const& factor = current_fluid_volume > 0.0 ? volume / current_fluid_volume : real(0.0);
         auto const& ifluidspecies = system.phases().indicesSpeciesInPhases(ifluidphases);
         n(ifluidspecies) *= factor;
+        modified();
     }
 
     auto scaleSolidVolume(real volume, Chars unit) -> void
     {
         errorif(volume < 0.0, "Expecting a non-negative volume value, but got ", volume, " ", unit);
         volume = units::convert(volume, unit, "m3");
-        props.update(T, P, n);
+        updateProps();
         const auto isolidphases = props.indicesPhasesWithSolidState();
         const auto current_solid_volume =
             Reaktoro::sum(isolidphases, [&](auto i) { return props.phaseProps(i).volume(); });
         auto const& factor = current_solid_volume > 0.0 ? volume / current_solid_volume : real(0.0);
         auto const& isolidspecies = system.phases().indicesSpeciesInPhases(isolidphases);
         n(isolidspecies) *= factor;
+        modified();
     }
 };
 
@@ -402,6 +502,27 @@ auto ChemicalState::operator=(ChemicalState other) -> ChemicalState&
     return *this;
 }
 
+auto ChemicalState::assign(ChemicalState const& other) -> void
+{
+    if(pimpl == other.pimpl)
+        return;
+
+    if(pimpl->system.id() != other.pimpl->system.id())
+    {
+        *this = other;
+        return;
+    }
+
+    pimpl->equilibrium.assign(other.pimpl->equilibrium);
+    pimpl->props = other.pimpl->props;
+    pimpl->compactprops = other.pimpl->compactprops;
+    pimpl->compact = other.pimpl->compact;
+    pimpl->T = other.pimpl->T;
+    pimpl->P = other.pimpl->P;
+    pimpl->n = other.pimpl->n;
+    pimpl->generation = other.pimpl->generation;
+}
+
 // --------------------------------------------------------------------------------------------
 // METHODS FOR SETTING/GETTING TEMPERATURE
 // --------------------------------------------------------------------------------------------
@@ -643,7 +764,7 @@ auto ChemicalState::update(real const& T, real const& P, ArrayXrConstRef const&
     setTemperature(T);
     setPressure(P);
     setSpeciesAmounts(n);
-    props().update(T, P, n);
+    props().update(*this);
 }
 
 auto ChemicalState::updateIdeal(real const& T, real const& P, ArrayXrConstRef const& n) -> void
@@ -663,16 +784,49 @@ auto ChemicalState::system() const -> ChemicalSystem const&
     return pimpl->system;
 }
 
+auto ChemicalState::generation() const -> std::uint64_t
+{
+    return pimpl->generation;
+}
+
+auto ChemicalState::memoryUsage() const -> MemoryUsage
+{
+    MemoryUsage usage;
+    usage.name = "ChemicalState";
+    usage.bytes = sizeof(ChemicalState) + sizeof(Impl) - sizeof(ChemicalProps); // the ChemicalProps object in Impl is accounted for in its own memory usage
+    usage.add("species amounts", memoryBytes(pimpl->n));
+    usage.add(pimpl->props.memoryUsage());
+    usage.add("compact props", memoryBytes(pimpl->compactprops));
+    usage.add(pimpl->equilibrium.memoryUsage());
+    return usage;
+}
+
 auto ChemicalState::props() const -> ChemicalProps const&
 {
+    if(pimpl->compact) // other threads reading this state may be restoring its chemical properties too
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        pimpl->expandProps();
+    }
     return pimpl->props;
 }
 
 auto ChemicalState::props() -> ChemicalProps&
 {
+    pimpl->expandProps();
     return pimpl->props;
 }
 
+auto ChemicalState::compactProps() -> void
+{
+    pimpl->compactProps();
+}
+
+auto ChemicalState::hasCompactProps() const -> bool
+{
+    return pimpl->compact;
+}
+
 auto ChemicalState::equilibrium() const -> Equilibrium const&
 {
     return pimpl->equilibrium;
@@ -729,6 +883,9 @@ struct ChemicalState::Equilibrium::Impl
     /// The Optima::State object used for warm start Optima optimization calculations.
     Optima::State optstate;
 
+    /// The Optima::State objects saved for warm start in calculations with different equilibrium specifications.
+    Map<String, Optima::State> optstates;
+
     /// Construct a default ChemicalState::Equilibrium::Impl instance
     Impl(ChemicalSystem const& system)
     : Nn(system.species().size()), Nb(system.elements().size() + 1)
@@ -752,6 +909,27 @@ auto ChemicalState::Equilibrium::operator=(ChemicalState::Equilibrium other) ->
     return *this;
 }
 
+auto ChemicalState::Equilibrium::assign(ChemicalState::Equilibrium const& other) -> void
+{
+    if(pimpl == other.pimpl)
+        return;
+
+    if(pimpl->Nn != other.pimpl->Nn || pimpl->Nb != other.pimpl->Nb)
+    {
+        *this = other;
+        return;
+    }
+
+    pimpl->Nq = other.pimpl->Nq;
+    pimpl->wnames = other.pimpl->wnames;
+    pimpl->pnames = other.pimpl->pnames;
+    pimpl->qnames = other.pimpl->qnames;
+    pimpl->w = other.pimpl->w;
+    pimpl->c = other.pimpl->c;
+    pimpl->optstate = other.pimpl->optstate;
+    pimpl->optstates = other.pimpl->optstates;
+}
+
 auto ChemicalState::Equilibrium::reset() -> void
 {
     pimpl->Nq = 0;
@@ -761,6 +939,7 @@ auto ChemicalState::Equilibrium::reset() -> void
     pimpl->w = {};
     pimpl->c = {};
     pimpl->optstate = {};
+    pimpl->optstates = {};
 }
 
 auto ChemicalState::Equilibrium::setNamesInputVariables(Strings const& wnames) -> void
@@ -808,6 +987,12 @@ auto ChemicalState::Equilibrium::setOptimaState(Optima::State const& state) -> v
     pimpl->optstate = state;
 }
 
+auto ChemicalState::Equilibrium::setOptimaState(String const& key, Optima::State const& state) -> void
+{
+    pimpl->optstate = state;
+    pimpl->optstates[key] = state;
+}
+
 auto ChemicalState::Equilibrium::empty() const -> bool
 {
     return pimpl->optstate.x.size() == 0; // this means optstate has not been set yet
@@ -934,6 +1119,31 @@ auto ChemicalState::Equilibrium::optimaState() const -> Optima::State const&
     return pimpl->optstate;
 }
 
+auto ChemicalState::Equilibrium::optimaState(String const& key) const -> Optima::State const&
+{
+    const auto it = pimpl->optstates.find(key);
+    return it != pimpl->optstates.end() ? it->second : pimpl->optstate;
+}
+
+auto ChemicalState::Equilibrium::memoryUsage() const -> MemoryUsage
+{
+    Index saved = 0;
+    for(auto const& [key, optstate] : pimpl->optstates)
+        saved += memoryBytes(key) + memoryBytes(optstate);
+
+    MemoryUsage usage;
+    usage.name = "equilibrium";
+    usage.bytes = sizeof(Impl) + memoryBytes(pimpl->wnames, pimpl->pnames, pimpl->qnames, pimpl->w, pimpl->c);
+    usage.add("optima state", memoryBytes(pimpl->optstate));
+    usage.add("saved optima states", saved);
+    return usage;
+}
+
+auto memoryBytes(Optima::State const& state) -> Index
+{
+    return memoryBytes(state.x, state.p, state.ye, state.s, state.jb, state.jn);
+}
+
 auto operator<<(std::ostream& out, ChemicalState const& state) -> std::ostream&
 {
     auto const& n = state.speciesAmounts();
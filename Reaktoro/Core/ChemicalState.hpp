@@ -57,6 +57,16 @@ public:
     /// Assign a ChemicalState instance to this instance.
     auto operator=(ChemicalState other) -> ChemicalState&;
 
+    /// Assign a copy of a ChemicalState instance to this instance reusing its allocated memory.
+    /// Unlike @ref operator=, which constructs a new copy of @p other, this
+    /// method copies the data of @p other into the existing arrays and
+    /// containers of this instance. If both states have the same chemical
+    /// system and have been used in similar calculations, no heap allocation
+    /// is needed, which makes this method preferable when a state is copied
+    /// repeatedly (e.g., into pre-allocated checkpoint or scratch states). If
+    /// the chemical systems differ, this is equivalent to @ref operator=.
+    auto assign(ChemicalState const& other) -> void;
+
     // --------------------------------------------------------------------------------------------
     // METHODS FOR SETTING/GETTING TEMPERATURE
     // --------------------------------------------------------------------------------------------
@@ -311,12 +321,43 @@ public:
     /// properties using `state.props().update(state)`.
     auto props() -> ChemicalProps&;
 
+    /// Store the chemical properties of this state in compact form, with values only in double precision.
+    /// The chemical properties are kept as an array of doubles without the
+    /// derivative lanes of `real` numbers, which are meaningless after a
+    /// calculation has finished, and the memory of the ChemicalProps object is
+    /// released. This halves the memory used by the chemical properties of
+    /// states at rest (e.g., in large arrays of states of a reactive transport
+    /// simulation). The chemical properties are restored transparently on the
+    /// next call to @ref props (e.g., by a solver), so that they are only kept
+    /// in full while in use. The state of matter of the phases and the cached
+    /// standard thermodynamic properties are not kept in compact form.
+    /// @note Calling @ref props on a compact state modifies it. The const
+    /// version of @ref props can be called concurrently for the same state from
+    /// different threads, but not concurrently with its non-const methods.
+    auto compactProps() -> void;
+
+    /// Return true if the chemical properties of this state are currently stored in compact form (see @ref compactProps).
+    auto hasCompactProps() const -> bool;
+
     /// Return the equilibrium properties of a calculated chemical equilibrium state.
     auto equilibrium() const -> Equilibrium const&;
 
     /// Return the equilibrium properties of a calculated chemical equilibrium state.
     auto equilibrium() -> Equilibrium&;
 
+    /// Return the generation number of the temperature, pressure and species amounts in this chemical state.
+    /// A new generation number is assigned whenever temperature, pressure or
+    /// species amounts are changed, and a copy of this chemical state shares
+    /// its generation number until either one is changed. This permits
+    /// ChemicalProps::update(state) to skip the evaluation of the chemical
+    /// properties when these already correspond to the given chemical state,
+    /// and the memoized activity models of the phases to reuse their results
+    /// for this chemical state (see ActivityModelArgs::version).
+    auto generation() const -> std::uint64_t;
+
+    /// Return the approximate memory used by this chemical state, with a breakdown into its species amounts, chemical properties and equilibrium properties.
+    auto memoryUsage() const -> MemoryUsage;
+
     /// Output this ChemicalState instance to a stream.
     auto output(std::ostream& out) const -> void;
 
@@ -351,6 +392,10 @@ public:
     /// Assign a ChemicalState::Equilibrium instance to this instance
     auto operator=(Equilibrium other) -> Equilibrium&;
 
+    /// Assign a copy of a ChemicalState::Equilibrium instance to this instance reusing its allocated memory.
+    /// @see ChemicalState::assign
+    auto assign(Equilibrium const& other) -> void;
+
     /// Reset this object by clearing all information related to a previous computed equilibrium state.
     /// This method can be used right after a failed calculation, so that the next tentative, with
     /// possibly a different initial guess, does not use Lagrange multipliers from the failed computation.
@@ -380,6 +425,15 @@ public:
     /// Set the Optima::State object computed as part of the equilibrium calculation.
     auto setOptimaState(Optima::State const& state) -> void;
 
+    /// Set the Optima::State object computed as part of the equilibrium calculation and save it for later warm starts with the same key.
+    /// This permits the same ChemicalState object to be used in equilibrium
+    /// calculations with different specifications (e.g., alternating TP, TP+pH
+    /// and HP calculations) so that each resumes from its own last computed
+    /// state. The given state also becomes the one returned by @ref optimaState().
+    /// @param key The identifier of the equilibrium specifications used in the calculation.
+    /// @param state The computed Optima::State object.
+    auto setOptimaState(String const& key, Optima::State const& state) -> void;
+
     /// Return true if no equilibrium information available.
     auto empty() const -> bool;
 
@@ -453,12 +507,22 @@ public:
     /// Return the Optima::State object computed as part of the equilibrium calculation.
     auto optimaState() const -> Optima::State const&;
 
+    /// Return the Optima::State object saved with given key, or the last computed one if none was saved with this key.
+    /// @param key The identifier of the equilibrium specifications used in the calculation.
+    auto optimaState(String const& key) const -> Optima::State const&;
+
+    /// Return the approximate memory used by these equilibrium properties, including the Optima::State objects kept for warm starts.
+    auto memoryUsage() const -> MemoryUsage;
+
 private:
     struct Impl;
 
     Ptr<Impl> pimpl;
 };
 
+/// Return the bytes used by the vectors of an Optima::State object.
+auto memoryBytes(Optima::State const& state) -> Index;
+
 /// Output a ChemicalState object to an output stream.
 auto operator<<(std::ostream& out, ChemicalState const& state) -> std::ostream&;
 
@@ -317,3 +317,38 @@ def testChemicalState():
     otherstate.setTemperature(1234, "K")
 
     assert state.temperature() == 321  # ensure state was not changed with changing otherstate above!
+
+    #-------------------------------------------------------------------------
+    # TESTING METHOD: ChemicalState.speciesAmountsArray
+    #-------------------------------------------------------------------------
+    state = ChemicalState(system)
+    state.setSpeciesAmounts(n)
+
+    view = state.speciesAmountsArray()
+
+    assert npy.all(view == n)
+
+    view[0] = 123.0  # the view shares memory with the chemical state
+
+    assert state.speciesAmount(0) == 123.0
+
+    state.setSpeciesAmount(1, 456.0)  # changes in the chemical state are seen by the view
+
+    assert view[1] == 456.0
+
+    #-------------------------------------------------------------------------
+    # TESTING PICKLING OF CHEMICALSYSTEM AND CHEMICALSTATE
+    #-------------------------------------------------------------------------
+    import pickle
+
+    state = ChemicalState(system)
+    state.setTemperature(350.0)
+    state.setPressure(2.0e5)
+    state.setSpeciesAmounts(n)
+
+    unpickled = pickle.loads(pickle.dumps(state))
+
+    assert unpickled.system().hash() == system.hash()
+    assert unpickled.temperature() == 350.0
+    assert unpickled.pressure() == 2.0e5
+    assert npy.all(unpickled.speciesAmounts() == n)
@@ -22,18 +22,34 @@
 #include <Optima/State.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateCheckpoint.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 using namespace Reaktoro;
 
 void exportChemicalState(py::module& m)
 {
+    // Pickle a chemical state by its chemical system and the binary image of its temperature, pressure, species amounts and equilibrium data
+    auto getstate = [](ChemicalState const& self)
+    {
+        return py::make_tuple(self.system(), py::bytes(dumpChemicalState(self)));
+    };
+
+    // Unpickle a chemical state from its chemical system and binary image
+    auto setstate = [](py::tuple const& t)
+    {
+        errorif(t.size() != 2, "Invalid state for unpickling a ChemicalState object.");
+        return parseChemicalState(t[1].cast<String>(), t[0].cast<ChemicalSystem>());
+    };
+
     py::class_<ChemicalState>(m, "ChemicalState")
         .def(py::init<ChemicalSystem const&>())
         .def(py::init<ChemicalState const&>())
 
         .def("assign", [](ChemicalState& self, ChemicalState const& other) { self = other; })
         .def("clone", [](ChemicalState const& self) { return ChemicalState(self); })
+        .def("assign", &ChemicalState::assign)
 
         .def("setTemperature", py::overload_cast<real const&>(&ChemicalState::setTemperature))
         .def("setTemperature", py::overload_cast<real, Chars>(&ChemicalState::setTemperature))
@@ -59,6 +75,7 @@ void exportChemicalState(py::module& m)
 
         .def("speciesAmounts", &ChemicalState::speciesAmounts, return_internal_ref)
         .def("speciesAmountsInPhase", &ChemicalState::speciesAmountsInPhase, return_internal_ref)
+        .def("speciesAmountsArray", [](py::object self) { return realArrayView(self.cast<ChemicalState const&>().speciesAmounts(), self, true); }, "Return a writeable NumPy view of the amounts of the species (in mol) sharing memory with this chemical state.")
         .def("speciesAmount", &ChemicalState::speciesAmount)
         .def("speciesMass", &ChemicalState::speciesMass)
         .def("componentAmounts", &ChemicalState::componentAmounts)
@@ -92,9 +109,14 @@ void exportChemicalState(py::module& m)
         .def("props", py::overload_cast<>(&ChemicalState::props), return_internal_ref)
         .def("equilibrium", py::overload_cast<>(&ChemicalState::equilibrium, py::const_), return_internal_ref)
         .def("equilibrium", py::overload_cast<>(&ChemicalState::equilibrium), return_internal_ref)
+        .def("generation", &ChemicalState::generation)
+        .def("memoryUsage", &ChemicalState::memoryUsage)
+        .def("compactProps", &ChemicalState::compactProps)
+        .def("hasCompactProps", &ChemicalState::hasCompactProps)
         .def("output", py::overload_cast<std::ostream&>(&ChemicalState::output, py::const_))
         .def("output", py::overload_cast<String const&>(&ChemicalState::output, py::const_))
         .def("__repr__", [](ChemicalState const& self) { std::stringstream ss; ss << self; return ss.str(); })
+        .def(py::pickle(getstate, setstate))
         ;
 
     py::class_<ChemicalState::Equilibrium>(m, "_ChemicalStateEquilibrium")
@@ -106,7 +128,8 @@ void exportChemicalState(py::module& m)
         .def("setControlVariablesP", &ChemicalState::Equilibrium::setControlVariablesP)
         .def("setControlVariablesQ", &ChemicalState::Equilibrium::setControlVariablesQ)
         .def("setInitialComponentAmounts", &ChemicalState::Equilibrium::setInitialComponentAmounts)
-        .def("setOptimaState", &ChemicalState::Equilibrium::setOptimaState)
+        .def("setOptimaState", py::overload_cast<Optima::State const&>(&ChemicalState::Equilibrium::setOptimaState))
+        .def("setOptimaState", py::overload_cast<String const&, Optima::State const&>(&ChemicalState::Equilibrium::setOptimaState))
         .def("empty", &ChemicalState::Equilibrium::empty)
         .def("numPrimarySpecies", &ChemicalState::Equilibrium::numPrimarySpecies)
         .def("numSecondarySpecies", &ChemicalState::Equilibrium::numSecondarySpecies)
@@ -128,6 +151,7 @@ void exportChemicalState(py::module& m)
         .def("p", &ChemicalState::Equilibrium::p, return_internal_ref)
         .def("q", &ChemicalState::Equilibrium::q, return_internal_ref)
         .def("c", &ChemicalState::Equilibrium::c, return_internal_ref)
-        .def("optimaState", &ChemicalState::Equilibrium::optimaState, return_internal_ref)
+        .def("optimaState", py::overload_cast<>(&ChemicalState::Equilibrium::optimaState, py::const_), return_internal_ref)
+        .def("optimaState", py::overload_cast<String const&>(&ChemicalState::Equilibrium::optimaState, py::const_), return_internal_ref)
         ;
 }
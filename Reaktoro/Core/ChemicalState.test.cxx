@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -324,4 +327,129 @@ TEST_CASE("Testing ChemicalState class", "[ChemicalState]")
     CHECK(  props.temperature() == 288.0 );
     CHECK(  props.pressure() == 1.3e5 );
     CHECK(  props.charge() == Approx(-1.234) );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalState::assign
+    //-------------------------------------------------------------------------
+    ChemicalState other(system);
+    other.equilibrium().setNamesInputVariables({"T", "P"});
+    other.equilibrium().setInputVariables(ArrayXd::Constant(2, 1.0));
+
+    const auto address = other.speciesAmounts().data();
+
+    other.assign(state);
+
+    CHECK( other.temperature() == state.temperature() );
+    CHECK( other.pressure() == state.pressure() );
+    CHECK( (other.speciesAmounts() == state.speciesAmounts()).all() );
+    CHECK( (other.props().speciesAmounts() == state.props().speciesAmounts()).all() );
+    CHECK( other.generation() == state.generation() );
+    CHECK( other.equilibrium().namesInputVariables() == state.equilibrium().namesInputVariables() );
+    CHECK( other.equilibrium().inputVariables().size() == 0 );
+    CHECK( other.speciesAmounts().data() == address ); // the existing buffer has been reused
+
+    other.setTemperature(500.0);
+    CHECK( state.temperature() != 500.0 ); // the assigned state is an independent copy
+    CHECK( other.generation() != state.generation() );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalState::generation
+    //-------------------------------------------------------------------------
+    auto generation = state.generation();
+
+    state.setTemperature(310.0);
+    CHECK( state.generation() != generation );
+    generation = state.generation();
+
+    state.setPressure(2.0e5);
+    CHECK( state.generation() != generation );
+    generation = state.generation();
+
+    state.setSpeciesAmount("H2O(aq)", 55.0, "mol");
+    CHECK( state.generation() != generation );
+    generation = state.generation();
+
+    state.scaleSpeciesAmounts(2.0);
+    CHECK( state.generation() != generation );
+    generation = state.generation();
+
+    CHECK( ChemicalState(state).generation() == generation ); // a copy shares the generation of the original state
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalProps::update(state) with unchanged chemical state
+    //-------------------------------------------------------------------------
+    state.props().update(state);
+    auto stateid = state.props().stateid();
+
+    state.props().update(state);
+    CHECK( state.props().stateid() == stateid ); // evaluation skipped, state has not changed
+
+    state.setTemperature(320.0);
+    state.props().update(state);
+    CHECK( state.props().stateid() == stateid + 1 ); // evaluation performed, state has changed
+    stateid = state.props().stateid();
+
+    state.props().updateIdeal(state);
+    state.props().update(state);
+    CHECK( state.props().stateid() == stateid + 2 ); // evaluation performed, props were recomputed with ideal models in between
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalState::memoryUsage
+    //-------------------------------------------------------------------------
+    const auto usage = state.memoryUsage();
+
+    CHECK( usage.name == "ChemicalState" );
+    CHECK( usage.component("species amounts").total() == state.speciesAmounts().size() * sizeof(real) );
+    CHECK( usage.component("ChemicalProps").component("species properties").total() >= 12 * state.speciesAmounts().size() * sizeof(real) );
+    CHECK( usage.component("equilibrium").total() > 0 );
+    CHECK( usage.total() > usage.component("ChemicalProps").total() );
+    CHECK( system.memoryUsage().component("species").total() > 0 );
+    CHECK( system.memoryUsage().component("matrices").total() >= system.formulaMatrix().size() * sizeof(double) );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalState::compactProps
+    //-------------------------------------------------------------------------
+    state.props().update(state);
+
+    auto serialized = [](ChemicalProps const& props) { ArrayXd data(props.serializationSize()); props.serialize(data); return data; };
+
+    const ArrayXd propsdata = serialized(state.props());
+    const auto propsbytes = state.memoryUsage().component("ChemicalProps").total();
+
+    CHECK_FALSE( state.hasCompactProps() );
+
+    state.compactProps();
+
+    CHECK( state.hasCompactProps() );
+    CHECK( state.memoryUsage().component("ChemicalProps").total() + state.memoryUsage().component("compact props").total() < propsbytes );
+
+    ChemicalState copy(state); // copies of compact states are compact too
+
+    CHECK( copy.hasCompactProps() );
+    CHECK( state.speciesAmounts().isApprox(copy.speciesAmounts()) );
+
+    CHECK( serialized(state.props()).isApprox(propsdata) ); // props are restored on access
+    CHECK_FALSE( state.hasCompactProps() );
+    CHECK( serialized(copy.props()).isApprox(propsdata) );
+
+    copy.compactProps();
+
+    ChemicalState const& shared = copy; // compact states can be read from concurrent threads
+    Vec<ArrayXd> readdata(4);
+    Vec<std::thread> readers;
+    for(auto i = 0; i < readdata.size(); ++i)
+        readers.emplace_back([&, i] { readdata[i] = serialized(shared.props()); });
+    for(auto& reader : readers)
+        reader.join();
+
+    CHECK_FALSE( copy.hasCompactProps() );
+    for(auto const& data : readdata)
+        CHECK( data.isApprox(propsdata) );
+
+    state.compactProps();
+    state.setTemperature(330.0);
+    state.scaleAmount(2.0, "mol"); // uses the chemical properties internally
+    CHECK_FALSE( state.hasCompactProps() );
+    state.props().update(state);
+    CHECK( state.props().amount() == Approx(2.0) );
 }
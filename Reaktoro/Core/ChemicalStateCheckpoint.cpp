@@ -0,0 +1,321 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ChemicalStateCheckpoint.hpp"
+
+// C++ includes
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/HashUtils.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+namespace {
+
+using detail::writeBinary;
+using detail::readBinary;
+
+/// The identifier written at the beginning of a binary checkpoint file.
+const String checkpointTag = "RKTSTATE";
+
+/// The version of the binary checkpoint file format.
+const std::uint32_t checkpointVersion = 1;
+
+/// The header of a binary checkpoint file.
+struct CheckpointHeader
+{
+    /// The hash identifying the chemical system of the states.
+    std::uint64_t systemhash = 0;
+
+    /// The number of species in the chemical system.
+    std::uint64_t Nn = 0;
+
+    /// The number of states in the file.
+    std::uint64_t numstates = 0;
+
+    /// The number of equilibrium input variables *w* of each state.
+    std::uint64_t Nw = 0;
+
+    /// The number of initial component amounts *c* of each state.
+    std::uint64_t Nc = 0;
+
+    /// The number of equilibrium control variables *p* of each state.
+    std::uint64_t Np = 0;
+
+    /// The names of the equilibrium input variables *w*.
+    Strings wnames;
+
+    /// The names of the equilibrium control variables *p*.
+    Strings pnames;
+
+    /// Return the number of 8-byte values in the record of each state.
+    auto recordSize() const -> Index
+    {
+        return 2 + Nn + Nw + Nc + Np;
+    }
+};
+
+/// Return the hash identifying a chemical system from its element symbols and species names.
+auto systemHash(ChemicalSystem const& system) -> std::uint64_t
+{
+    Strings names;
+    for(auto const& element : system.elements())
+        names.push_back(element.symbol());
+    for(auto const& species : system.species())
+        names.push_back(species.name());
+    return hashVector(names);
+}
+
+/// Write zero bytes to a binary stream until its position is a multiple of 8.
+auto alignBinary(std::ostream& out) -> void
+{
+    while(out.tellp() % 8 != 0)
+        out.put(0);
+}
+
+/// Skip bytes in a binary stream until its position is a multiple of 8.
+auto alignBinary(std::istream& in) -> void
+{
+    const auto pos = static_cast<std::streamoff>(in.tellg());
+    in.seekg((pos + 7)/8*8);
+}
+
+/// Write the header of a binary checkpoint file.
+auto writeHeader(std::ostream& out, CheckpointHeader const& header) -> void
+{
+    out.write(checkpointTag.data(), checkpointTag.size());
+    writeBinary(out, checkpointVersion);
+    writeBinary(out, header.systemhash);
+    writeBinary(out, header.Nn);
+    writeBinary(out, header.numstates);
+    writeBinary(out, header.Nw);
+    writeBinary(out, header.Nc);
+    writeBinary(out, header.Np);
+    for(auto const& name : header.wnames)
+        writeBinary(out, name);
+    for(auto const& name : header.pnames)
+        writeBinary(out, name);
+    alignBinary(out);
+}
+
+/// Read the header of a binary checkpoint file and check it is consistent with given chemical system.
+auto readHeader(std::istream& in, String const& filepath, ChemicalSystem const& system) -> CheckpointHeader
+{
+    errorif(!in, "Could not open file `", filepath, "` to load chemical states.");
+
+    String tag(checkpointTag.size(), ' ');
+    in.read(tag.data(), tag.size());
+    errorif(tag != checkpointTag, "The file `", filepath, "` is not a chemical state checkpoint file created with saveChemicalStates.");
+
+    std::uint32_t version = 0;
+    readBinary(in, version);
+    errorif(version != checkpointVersion, "The chemical state checkpoint file `", filepath, "` has version ", version, " but only version ", checkpointVersion, " is supported.");
+
+    CheckpointHeader header;
+    readBinary(in, header.systemhash);
+    readBinary(in, header.Nn);
+    readBinary(in, header.numstates);
+    readBinary(in, header.Nw);
+    readBinary(in, header.Nc);
+    readBinary(in, header.Np);
+    header.wnames.resize(header.Nw);
+    header.pnames.resize(header.Np);
+    for(auto& name : header.wnames)
+        readBinary(in, name);
+    for(auto& name : header.pnames)
+        readBinary(in, name);
+    alignBinary(in);
+
+    errorif(!in, "The chemical state checkpoint file `", filepath, "` is truncated or corrupted.");
+    errorif(header.Nn != system.species().size() || header.systemhash != systemHash(system),
+        "The chemical states in the checkpoint file `", filepath, "` were not saved with the given chemical system.");
+
+    return header;
+}
+
+/// Create a chemical state from its record in a binary checkpoint file.
+auto createChemicalState(ChemicalSystem const& system, CheckpointHeader const& header, double const* record) -> ChemicalState
+{
+    const auto Nn = header.Nn;
+    const auto Nw = header.Nw;
+    const auto Nc = header.Nc;
+    const auto Np = header.Np;
+
+    ChemicalState state(system);
+    state.setTemperature(record[0]);
+    state.setPressure(record[1]);
+    state.setSpeciesAmounts(ArrayXd::Map(record + 2, Nn));
+
+    if(Nw + Nc + Np > 0)
+    {
+        auto& equilibrium = state.equilibrium();
+        equilibrium.setNamesInputVariables(header.wnames);
+        equilibrium.setNamesControlVariablesP(header.pnames);
+        equilibrium.setInputVariables(ArrayXd::Map(record + 2 + Nn, Nw));
+        equilibrium.setInitialComponentAmounts(ArrayXd::Map(record + 2 + Nn + Nw, Nc));
+        equilibrium.setControlVariablesP(ArrayXd::Map(record + 2 + Nn + Nw + Nc, Np));
+    }
+
+    return state;
+}
+
+/// Write chemical states to a binary stream in the format of a checkpoint file.
+auto writeChemicalStates(std::ostream& file, String const& filepath, Vec<ChemicalState> const& states) -> void
+{
+    errorif(states.empty(), "Cannot save an empty list of chemical states to file `", filepath, "`.");
+
+    auto const& first = states.front();
+    auto const& system = first.system();
+
+    CheckpointHeader header;
+    header.systemhash = systemHash(system);
+    header.Nn = system.species().size();
+    header.numstates = states.size();
+    header.Nw = first.equilibrium().inputVariables().size();
+    header.Nc = first.equilibrium().initialComponentAmounts().size();
+    header.Np = first.equilibrium().controlVariablesP().size();
+    header.wnames = first.equilibrium().namesInputVariables();
+    header.pnames = first.equilibrium().namesControlVariablesP();
+
+    errorif(header.wnames.size() != header.Nw || header.pnames.size() != header.Np,
+        "Cannot save chemical states whose equilibrium input or control variables are inconsistent with their names.");
+
+    writeHeader(file, header);
+
+    const auto Nn = header.Nn;
+    const auto Nw = header.Nw;
+    const auto Nc = header.Nc;
+    const auto Np = header.Np;
+
+    Vec<double> record(header.recordSize());
+
+    for(auto const& state : states)
+    {
+        auto const& equilibrium = state.equilibrium();
+
+        errorif(state.system().species().size() != Nn,
+            "Cannot save chemical states of different chemical systems in the same checkpoint file.");
+        errorif(equilibrium.inputVariables().size() != Nw || equilibrium.initialComponentAmounts().size() != Nc || equilibrium.controlVariablesP().size() != Np,
+            "Cannot save chemical states with different equilibrium specifications in the same checkpoint file.");
+
+        auto values = ArrayXd::Map(record.data(), record.size());
+        values[0] = state.temperature().val();
+        values[1] = state.pressure().val();
+        values.segment(2, Nn) = state.speciesAmounts().cast<double>();
+        values.segment(2 + Nn, Nw) = equilibrium.inputVariables();
+        values.segment(2 + Nn + Nw, Nc) = equilibrium.initialComponentAmounts();
+        values.segment(2 + Nn + Nw + Nc, Np) = equilibrium.controlVariablesP();
+
+        writeBinary(file, record.data(), record.size());
+    }
+
+    errorif(!file, "Could not write chemical states to file `", filepath, "`.");
+}
+
+/// Read all chemical states from a binary stream in the format of a checkpoint file.
+auto readChemicalStates(std::istream& file, String const& filepath, ChemicalSystem const& system) -> Vec<ChemicalState>
+{
+    const auto header = readHeader(file, filepath, system);
+
+    Vec<double> record(header.recordSize());
+
+    Vec<ChemicalState> states;
+    states.reserve(header.numstates);
+
+    for(auto i = 0; i < header.numstates; ++i)
+    {
+        readBinary(file, record.data(), record.size());
+        errorif(!file, "The chemical state checkpoint file `", filepath, "` is truncated or corrupted.");
+        states.push_back(createChemicalState(system, header, record.data()));
+    }
+
+    return states;
+}
+
+/// The name used in place of a file path in error messages when chemical states are stored in memory.
+const String inmemory = "<in-memory bytes>";
+
+} // namespace
+
+auto saveChemicalStates(String const& filepath, Vec<ChemicalState> const& states) -> void
+{
+    std::ofstream file(filepath, std::ios::binary);
+    errorif(!file, "Could not create file `", filepath, "` to save chemical states.");
+    writeChemicalStates(file, filepath, states);
+}
+
+auto saveChemicalState(String const& filepath, ChemicalState const& state) -> void
+{
+    saveChemicalStates(filepath, {state});
+}
+
+auto loadChemicalStates(String const& filepath, ChemicalSystem const& system) -> Vec<ChemicalState>
+{
+    std::ifstream file(filepath, std::ios::binary);
+    return readChemicalStates(file, filepath, system);
+}
+
+auto loadChemicalState(String const& filepath, ChemicalSystem const& system, Index istate) -> ChemicalState
+{
+    std::ifstream file(filepath, std::ios::binary);
+
+    const auto header = readHeader(file, filepath, system);
+
+    errorif(istate >= header.numstates, "Cannot load chemical state with index ", istate, " from checkpoint file `", filepath, "`, which contains only ", header.numstates, " states.");
+
+    Vec<double> record(header.recordSize());
+
+    file.seekg(istate * record.size() * sizeof(double), std::ios::cur);
+    readBinary(file, record.data(), record.size());
+    errorif(!file, "The chemical state checkpoint file `", filepath, "` is truncated or corrupted.");
+
+    return createChemicalState(system, header, record.data());
+}
+
+auto dumpChemicalStates(Vec<ChemicalState> const& states) -> String
+{
+    std::ostringstream out(std::ios::binary);
+    writeChemicalStates(out, inmemory, states);
+    return out.str();
+}
+
+auto dumpChemicalState(ChemicalState const& state) -> String
+{
+    return dumpChemicalStates({state});
+}
+
+auto parseChemicalStates(String const& bytes, ChemicalSystem const& system) -> Vec<ChemicalState>
+{
+    std::istringstream in(bytes, std::ios::binary);
+    return readChemicalStates(in, inmemory, system);
+}
+
+auto parseChemicalState(String const& bytes, ChemicalSystem const& system) -> ChemicalState
+{
+    auto states = parseChemicalStates(bytes, system);
+    errorif(states.size() != 1, "Expecting the binary image of a single chemical state, but it contains ", states.size(), " states.");
+    return states.front();
+}
+
+} // namespace Reaktoro
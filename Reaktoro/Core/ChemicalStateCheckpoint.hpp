@@ -0,0 +1,81 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalSystem;
+
+/// Save chemical states of the same chemical system to a binary checkpoint file.
+/// The file starts with a header identifying the chemical system (by a hash
+/// of its element symbols and species names) and the names of the equilibrium
+/// input variables and *p* control variables, which are stored only once.
+/// The header is followed by one fixed-size record of 8-byte floating-point
+/// values per state, aligned at 8 bytes, containing its temperature,
+/// pressure, species amounts, and the equilibrium input variables *w*,
+/// initial component amounts *c*, and control variables *p*. A record can
+/// therefore be located directly from its index (e.g., to memory map the
+/// file or to load a single state with @ref loadChemicalState).
+/// @note Only values are stored (no derivatives). The Optima::State objects
+/// used for warm start and the *q* control variables stored in them are not
+/// saved, so an equilibrium calculation from a restored state starts cold.
+/// @param filepath The path to the file that will be created.
+/// @param states The chemical states, all with the same chemical system and the same equilibrium specifications.
+auto saveChemicalStates(String const& filepath, Vec<ChemicalState> const& states) -> void;
+
+/// Save a chemical state to a binary checkpoint file.
+/// @see saveChemicalStates
+auto saveChemicalState(String const& filepath, ChemicalState const& state) -> void;
+
+/// Load all chemical states from a binary checkpoint file created with @ref saveChemicalStates.
+/// @param filepath The path to the file.
+/// @param system The chemical system of the saved states (checked against the one identified in the file).
+auto loadChemicalStates(String const& filepath, ChemicalSystem const& system) -> Vec<ChemicalState>;
+
+/// Load the chemical state with given index from a binary checkpoint file created with @ref saveChemicalStates.
+/// Only the record of the requested state is read from the file.
+/// @param filepath The path to the file.
+/// @param system The chemical system of the saved states (checked against the one identified in the file).
+/// @param istate The index of the state in the file.
+auto loadChemicalState(String const& filepath, ChemicalSystem const& system, Index istate = 0) -> ChemicalState;
+
+/// Return the binary image of chemical states of the same chemical system, with the same format of a checkpoint file.
+/// This is used, for example, to send chemical states to other processes.
+/// @see saveChemicalStates
+auto dumpChemicalStates(Vec<ChemicalState> const& states) -> String;
+
+/// Return the binary image of a chemical state, with the same format of a checkpoint file.
+/// @see dumpChemicalStates
+auto dumpChemicalState(ChemicalState const& state) -> String;
+
+/// Return the chemical states in a binary image created with @ref dumpChemicalStates.
+/// @param bytes The binary image of the chemical states.
+/// @param system The chemical system of the states (checked against the one identified in the binary image).
+auto parseChemicalStates(String const& bytes, ChemicalSystem const& system) -> Vec<ChemicalState>;
+
+/// Return the chemical state in a binary image created with @ref dumpChemicalState.
+/// @see parseChemicalStates
+auto parseChemicalState(String const& bytes, ChemicalSystem const& system) -> ChemicalState;
+
+} // namespace Reaktoro
@@ -0,0 +1,38 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateCheckpoint.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+void exportChemicalStateCheckpoint(py::module& m)
+{
+    m.def("saveChemicalStates", saveChemicalStates, "Save chemical states of the same chemical system to a binary checkpoint file.", "filepath"_a, "states"_a);
+    m.def("saveChemicalState", saveChemicalState, "Save a chemical state to a binary checkpoint file.", "filepath"_a, "state"_a);
+    m.def("loadChemicalStates", loadChemicalStates, "Load all chemical states from a binary checkpoint file.", "filepath"_a, "system"_a);
+    m.def("loadChemicalState", loadChemicalState, "Load the chemical state with given index from a binary checkpoint file.", "filepath"_a, "system"_a, "istate"_a = 0);
+    m.def("dumpChemicalStates", [](Vec<ChemicalState> const& states) { return py::bytes(dumpChemicalStates(states)); }, "Return the binary image of chemical states of the same chemical system.", "states"_a);
+    m.def("dumpChemicalState", [](ChemicalState const& state) { return py::bytes(dumpChemicalState(state)); }, "Return the binary image of a chemical state.", "state"_a);
+    m.def("parseChemicalStates", parseChemicalStates, "Return the chemical states in a binary image.", "bytes"_a, "system"_a);
+    m.def("parseChemicalState", parseChemicalState, "Return the chemical state in a binary image.", "bytes"_a, "system"_a);
+}
@@ -0,0 +1,115 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateCheckpoint.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
+
+TEST_CASE("Testing ChemicalStateCheckpoint", "[ChemicalStateCheckpoint]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto Nn = system.species().size();
+
+    const auto filepath = "ChemicalStateCheckpoint.test.bin";
+
+    Vec<ChemicalState> states;
+    for(auto i = 0; i < 5; ++i)
+    {
+        ChemicalState state(system);
+        state.temperature(300.0 + i);
+        state.pressure(1.0e5 * (i + 1));
+        const ArrayXd n = ArrayXd::LinSpaced(Nn, 1.0, 2.0) * (i + 1);
+        state.setSpeciesAmounts(n);
+        state.equilibrium().setNamesInputVariables({"T", "P"});
+        state.equilibrium().setInputVariables(ArrayXd{{300.0 + i, 1.0e5 * (i + 1)}});
+        state.equilibrium().setInitialComponentAmounts(ArrayXd::Constant(3, 1.0 * i));
+        states.push_back(state);
+    }
+
+    auto checkEqual = [](ChemicalState const& actual, ChemicalState const& expected)
+    {
+        CHECK( actual.temperature() == expected.temperature() );
+        CHECK( actual.pressure() == expected.pressure() );
+        CHECK( (actual.speciesAmounts() == expected.speciesAmounts()).all() );
+        CHECK( actual.equilibrium().namesInputVariables() == expected.equilibrium().namesInputVariables() );
+        CHECK( (actual.equilibrium().inputVariables() == expected.equilibrium().inputVariables()).all() );
+        CHECK( (actual.equilibrium().initialComponentAmounts() == expected.equilibrium().initialComponentAmounts()).all() );
+    };
+
+    SECTION("Checking many states are saved and loaded")
+    {
+        saveChemicalStates(filepath, states);
+
+        const auto loaded = loadChemicalStates(filepath, system);
+
+        REQUIRE( loaded.size() == states.size() );
+        for(auto i = 0; i < states.size(); ++i)
+            checkEqual(loaded[i], states[i]);
+
+        checkEqual(loadChemicalState(filepath, system, 3), states[3]); // only the record of the fourth state is read
+
+        CHECK_THROWS( loadChemicalState(filepath, system, 5) );
+
+        std::remove(filepath);
+    }
+
+    SECTION("Checking a single state is saved and loaded")
+    {
+        saveChemicalState(filepath, states[2]);
+
+        checkEqual(loadChemicalState(filepath, system), states[2]);
+
+        std::remove(filepath);
+    }
+
+    SECTION("Checking states are dumped to and parsed from binary images in memory")
+    {
+        const auto bytes = dumpChemicalStates(states);
+        const auto parsed = parseChemicalStates(bytes, system);
+
+        REQUIRE( parsed.size() == states.size() );
+        for(auto i = 0; i < states.size(); ++i)
+            checkEqual(parsed[i], states[i]);
+
+        checkEqual(parseChemicalState(dumpChemicalState(states[4]), system), states[4]);
+
+        CHECK_THROWS( parseChemicalState(bytes, system) ); // more than one state in the binary image
+        CHECK_THROWS( parseChemicalStates("not a binary image", system) );
+    }
+
+    SECTION("Checking states with different equilibrium specifications cannot be saved together")
+    {
+        states[1].equilibrium().setNamesInputVariables({"T"});
+        states[1].equilibrium().setInputVariables(ArrayXd{{301.0}});
+
+        CHECK_THROWS( saveChemicalStates(filepath, states) );
+
+        std::remove(filepath);
+    }
+}
@@ -18,10 +18,13 @@
 #include "ChemicalSystem.hpp"
 
 // C++ includes
+#include <algorithm>
 #include <iostream>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/HashUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
@@ -34,6 +37,45 @@ auto computeChemicalSystemID() -> Index
     return counter++;
 }
 
+/// The registry of the chemical systems alive in this process, used to find them by their structural hash.
+struct ChemicalSystemRegistry
+{
+    /// The mutex used to access the registry from concurrent threads.
+    std::mutex mutex;
+
+    /// The weak references to the internal data of the registered chemical systems.
+    Vec<std::weak_ptr<void>> systems;
+};
+
+/// Return the registry of the chemical systems alive in this process.
+auto chemicalSystemRegistry() -> ChemicalSystemRegistry&
+{
+    static ChemicalSystemRegistry registry;
+    return registry;
+}
+
+/// Register the internal data of a chemical system, removing those of destroyed chemical systems.
+auto registerChemicalSystem(SharedPtr<void> const& impl) -> void
+{
+    auto& registry = chemicalSystemRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& systems = registry.systems;
+    systems.erase(std::remove_if(systems.begin(), systems.end(), [](auto const& x) { return x.expired(); }), systems.end());
+    systems.push_back(impl);
+}
+
+/// Return the internal data of the chemical systems alive in this process.
+auto registeredChemicalSystems() -> Vec<SharedPtr<void>>
+{
+    auto& registry = chemicalSystemRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    Vec<SharedPtr<void>> alive;
+    for(auto const& x : registry.systems)
+        if(auto impl = x.lock())
+            alive.push_back(impl);
+    return alive;
+}
+
 template<typename NamedObjects>
 auto fixDuplicateNames(NamedObjects& objects)
 {
@@ -44,6 +86,99 @@ auto fixDuplicateNames(NamedObjects& objects)
             objects[i] = objects[i].withName(names[i]);
 }
 
+/// Add the current values of the parameters of a model and its serialized form (if available) to a structural hash.
+template<typename ModelType>
+auto hashModel(StableHasher& hasher, ModelType const& model) -> void
+{
+    hasher(model.initialized());
+    hasher(static_cast<std::uint64_t>(model.params().size()));
+    for(auto const& param : model.params())
+        hasher(param.value().val());
+    if(model.serializerFn())
+        hasher(model.serialize().dumpBinary());
+}
+
+/// Add an activity model of a phase to a structural hash.
+/// Activity models often have no parameters nor serialization support, so the
+/// activity properties they compute at a fixed reference condition are also
+/// added to the hash. This distinguishes, for example, two phases with the same
+/// species but different parameterless activity models.
+auto hashActivityModel(StableHasher& hasher, ActivityModel const& model, Index numspecies) -> void
+{
+    hashModel(hasher, model);
+
+    if(!model.initialized() || numspecies == 0)
+        return;
+
+    const real T = 298.15;
+    const real P = 1.0e+5;
+    const ArrayXr x = ArrayXr::Constant(numspecies, 1.0/numspecies);
+
+    try
+    {
+        ActivityProps props = ActivityProps::create(numspecies);
+        props = 0.0;
+        model(props, { T, P, x, 0 });
+        for(auto value : { props.Vx, props.VxT, props.VxP, props.Gx, props.Hx, props.Cpx })
+            hasher(value.val());
+        for(auto i = 0; i < numspecies; ++i)
+            hasher(props.ln_g[i].val())(props.ln_a[i].val());
+    }
+    catch(...)
+    {
+        hasher("unevaluable"); // the activity model could not be evaluated without a more complete context
+    }
+}
+
+/// Return a deterministic structural hash of a chemical system.
+auto computeChemicalSystemHash(ChemicalSystem const& system) -> std::uint64_t
+{
+    StableHasher hasher;
+
+    hasher(static_cast<std::uint64_t>(system.elements().size()));
+    for(auto const& element : system.elements())
+        hasher(element.symbol())(element.molarMass());
+
+    hasher(static_cast<std::uint64_t>(system.species().size()));
+    for(auto const& species : system.species())
+    {
+        hasher(species.name())(species.formula().str())(species.charge());
+        hasher(static_cast<std::uint64_t>(species.aggregateState()));
+        hasher(static_cast<std::uint64_t>(species.tags().size()));
+        for(auto const& tag : species.tags())
+            hasher(tag);
+        hashModel(hasher, species.standardThermoModel());
+    }
+
+    hasher(static_cast<std::uint64_t>(system.phases().size()));
+    for(auto const& phase : system.phases())
+    {
+        hasher(phase.name());
+        hasher(static_cast<std::uint64_t>(phase.stateOfMatter()));
+        hasher(static_cast<std::uint64_t>(phase.species().size()));
+        for(auto const& species : phase.species())
+            hasher(species.name());
+        hashActivityModel(hasher, phase.activityModel(), phase.species().size());
+        hashActivityModel(hasher, phase.idealActivityModel(), phase.species().size());
+    }
+
+    hasher(static_cast<std::uint64_t>(system.reactions().size()));
+    for(auto const& reaction : system.reactions())
+    {
+        hasher(reaction.name())(String(reaction.equation()));
+        hashModel(hasher, reaction.rateModel());
+    }
+
+    hasher(static_cast<std::uint64_t>(system.surfaces().size()));
+    for(auto const& surface : system.surfaces())
+    {
+        hasher(surface.name());
+        hashModel(hasher, surface.areaModel());
+    }
+
+    return hasher.value();
+}
+
 } // namespace detail
 
 struct ChemicalSystem::Impl
@@ -72,9 +207,15 @@ struct ChemicalSystem::Impl
     /// The formula matrix of the species in the system with respect to its elements.
     MatrixXd formula_matrix;
 
+    /// The formula matrix of the species in the system with respect to its elements in compressed sparse storage.
+    SparseMatrixXd formula_matrix_sparse;
+
     /// The stoichiometric matrix of the reactions in the system with respect to its species.
     MatrixXd stoichiometric_matrix;
 
+    /// The stoichiometric matrix of the reactions in the system with respect to its species in compressed sparse storage.
+    SparseMatrixXd stoichiometric_matrix_sparse;
+
     /// Construct a default ChemicalSystem::Impl object.
     Impl()
     {}
@@ -101,13 +242,15 @@ struct ChemicalSystem::Impl
     Impl(Database const& database0, PhaseList const& phases0, ReactionList const& reactions0, SurfaceList const& surfaces0)
     : database(database0), phases(phases0), reactions(reactions0), surfaces(surfaces0)
     {
-        errorif(database.species().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
+        errorif(database.elements().empty() && database.species().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object."); // elements are checked first to avoid creating all species in a lazy database
         errorif(phases.empty(), "Expecting at least one phase when creating a ChemicalSystem object, but none was provided.");
 
         species = phases.species();
         elements = species.elements();
         formula_matrix = detail::assembleFormulaMatrix(species, elements);
+        formula_matrix_sparse = formula_matrix.sparseView();
         stoichiometric_matrix = detail::assembleStoichiometricMatrix(reactions, species);
+        stoichiometric_matrix_sparse = stoichiometric_matrix.sparseView();
 
         detail::fixDuplicateNames(phases);
         detail::fixDuplicateNames(species);
@@ -146,41 +289,109 @@ ChemicalSystem::ChemicalSystem()
 
 ChemicalSystem::ChemicalSystem(Database const& database, PhaseList const& phases)
 : pimpl(new Impl(database, phases))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Database const& database, PhaseList const& phases, SurfaceList const& surfaces)
 : pimpl(new Impl(database, phases, surfaces))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Database const& database, PhaseList const& phases, ReactionList const& reactions)
 : pimpl(new Impl(database, phases, reactions))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Database const& database, PhaseList const& phases, ReactionList const& reactions, SurfaceList const& surfaces)
 : pimpl(new Impl(database, phases, reactions, surfaces))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Phases const& phases)
 : pimpl(new Impl(phases.database(), phases.convert()))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Phases const& phases, Surfaces const& surfaces)
 : pimpl(new Impl(phases.database(), phases.convert(), surfaces))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Phases const& phases, Reactions const& reactions)
 : pimpl(new Impl(phases.database(), phases.convert(), reactions))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 ChemicalSystem::ChemicalSystem(Phases const& phases, Reactions const& reactions, Surfaces const& surfaces)
 : pimpl(new Impl(phases.database(), phases.convert(), reactions, surfaces))
-{}
+{
+    detail::registerChemicalSystem(pimpl);
+}
 
 auto ChemicalSystem::id() const -> Index
 {
     return pimpl->id;
 }
 
+auto ChemicalSystem::hash() const -> std::uint64_t
+{
+    return detail::computeChemicalSystemHash(*this);
+}
+
+auto ChemicalSystem::memoryUsage() const -> MemoryUsage
+{
+    auto elementBytes = [](Element const& element)
+    {
+        return sizeof(Element) + memoryBytes(element.symbol(), element.name()) + memoryBytes(element.tags());
+    };
+
+    auto speciesBytes = [](Species const& species)
+    {
+        return sizeof(Species) + memoryBytes(species.name(), species.formula().str(), species.substance()) + memoryBytes(species.tags())
+            + species.elements().size() * (sizeof(Element) + sizeof(double));
+    };
+
+    auto sum = [](auto const& list, auto const& bytes)
+    {
+        Index res = 0;
+        for(auto const& item : list)
+            res += bytes(item);
+        return res;
+    };
+
+    const auto& database = pimpl->database;
+
+    MemoryUsage usage;
+    usage.name = "ChemicalSystem";
+    usage.bytes = sizeof(ChemicalSystem) + sizeof(Impl);
+    usage.add("database", sum(database.elements(), elementBytes) + sum(database.speciesCreated(), speciesBytes)); // the species of a lazy database not yet created are not created here
+    usage.add("elements", sum(pimpl->elements, elementBytes));
+    usage.add("species", sum(pimpl->species, speciesBytes));
+    usage.add("phases", sum(pimpl->phases, [](Phase const& phase) { return sizeof(Phase) + memoryBytes(phase.name()) + phase.species().size() * sizeof(Species) + phase.elements().size() * sizeof(Element); }));
+    usage.add("reactions", sum(pimpl->reactions, [](Reaction const& reaction) { return sizeof(Reaction) + memoryBytes(reaction.name()) + reaction.equation().size() * (sizeof(Species) + sizeof(double)); }));
+    usage.add("matrices", memoryBytes(pimpl->formula_matrix, pimpl->formula_matrix_sparse, pimpl->stoichiometric_matrix, pimpl->stoichiometric_matrix_sparse));
+    return usage;
+}
+
+auto ChemicalSystem::findWithHash(std::uint64_t hash) -> Optional<ChemicalSystem>
+{
+    for(auto const& impl : detail::registeredChemicalSystems())
+    {
+        ChemicalSystem system;
+        system.pimpl = std::static_pointer_cast<Impl>(impl);
+        if(system.hash() == hash)
+            return system;
+    }
+    return {};
+}
+
 auto ChemicalSystem::database() const -> Database const&
 {
     return pimpl->database;
@@ -251,11 +462,21 @@ auto ChemicalSystem::formulaMatrixCharge() const -> MatrixXdConstRef
     return pimpl->formula_matrix.bottomRows(1);
 }
 
+auto ChemicalSystem::formulaMatrixSparse() const -> SparseMatrixXd const&
+{
+    return pimpl->formula_matrix_sparse;
+}
+
 auto ChemicalSystem::stoichiometricMatrix() const -> MatrixXdConstRef
 {
     return pimpl->stoichiometric_matrix;
 }
 
+auto ChemicalSystem::stoichiometricMatrixSparse() const -> SparseMatrixXd const&
+{
+    return pimpl->stoichiometric_matrix_sparse;
+}
+
 auto operator<<(std::ostream& out, ChemicalSystem const& system) -> std::ostream&
 {
     // auto const& phases = system.phases();
@@ -17,8 +17,12 @@
 
 #pragma once
 
+// C++ includes
+#include <cstdint>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/MemoryUsage.hpp>
 #include <Reaktoro/Common/Meta.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/Types.hpp>
@@ -64,6 +68,17 @@ template<typename... Args>
 auto createChemicalSystem(Database const& db, Args const&... args) -> ChemicalSystem;
 
 /// The class used to represent a chemical system and its attributes and properties.
+/// A ChemicalSystem object cannot be modified after construction, and its
+/// copies share the same data (including the Database object and the
+/// thermodynamic models of its species and phases), so that copying it (e.g.,
+/// into solvers) is cheap. The caches of its memoized models are kept per
+/// thread, and so are the activity models of phases created from
+/// GeneralPhase objects (e.g., AqueousPhase), which each thread constructs
+/// with their generators (see createThreadLocalActivityModel). Activity models
+/// given directly with Phase::withActivityModel, as well as the standard
+/// thermodynamic models of the species, are shared by all threads, and a
+/// ChemicalSystem object can be used by solvers running concurrently in
+/// different threads only if these models can be evaluated concurrently.
 /// @see Species, Phase
 /// @ingroup Core
 class ChemicalSystem
@@ -105,6 +120,31 @@ public:
     /// ChemicalSystem objects are guaranteed to be the same if they have the same id.
     auto id() const -> Index;
 
+    /// Return a deterministic structural hash of this ChemicalSystem object.
+    /// Unlike @ref id, this hash is the same across processes for chemical
+    /// systems constructed in the same way. It covers the elements, species,
+    /// phases, reactions and surfaces in the system, as well as the current
+    /// values of the parameters of their models. It is computed on every call
+    /// because these parameter values may change after the system is created.
+    /// Use it as a key for data derived from the system that is stored on disk
+    /// (see @ref ChemicalSystemCache).
+    auto hash() const -> std::uint64_t;
+
+    /// Return a chemical system alive in this process with given structural hash, if any.
+    /// This permits a chemical system to be sent to another process by its
+    /// hash only (e.g., when pickling it in Python), as long as an identical
+    /// chemical system has already been constructed in that process (e.g.,
+    /// inherited from a forked parent process or created in the initializer
+    /// of a worker process).
+    /// @see hash
+    static auto findWithHash(std::uint64_t hash) -> Optional<ChemicalSystem>;
+
+    /// Return the approximate memory used by this chemical system, with a breakdown into its database, species, elements, phases, reactions and matrices.
+    /// The database is accounted for in full, even though its species and
+    /// elements may share data with those in the chemical system, except the
+    /// species of a lazy database not yet created (see Database::speciesCreated).
+    auto memoryUsage() const -> MemoryUsage;
+
     /// Return the database used to construct the chemical system.
     auto database() const -> Database const&;
 
@@ -150,11 +190,24 @@ public:
     /// Return the bottom row of the formula matrix corresponding to electric charge.
     auto formulaMatrixCharge() const -> MatrixXdConstRef;
 
+    /// Return the formula matrix of the system in compressed sparse storage.
+    /// Species are usually composed of only a few of the elements in the
+    /// system, so that products with this matrix (e.g., to compute the
+    /// amounts of elements or components) are considerably cheaper than those
+    /// with the dense matrix returned by @ref formulaMatrix.
+    auto formulaMatrixSparse() const -> SparseMatrixXd const&;
+
     /// Return the stoichiometric matrix of the reactions corresponding to the species in the system.
     /// The stoichiometric matrix is defined as the matrix whose entry *(i, j)*
     /// is given by the coefficient of the *i*th species in the *j*th reaction.
     auto stoichiometricMatrix() const -> MatrixXdConstRef;
 
+    /// Return the stoichiometric matrix of the reactions corresponding to the species in the system in compressed sparse storage.
+    /// Reactions usually involve only a few of the species in the system, so
+    /// that products with this matrix are considerably cheaper than those
+    /// with the dense matrix returned by @ref stoichiometricMatrix.
+    auto stoichiometricMatrixSparse() const -> SparseMatrixXd const&;
+
 private:
     struct Impl;
 
@@ -20,6 +20,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 using namespace Reaktoro;
 
@@ -68,6 +69,26 @@ auto createChemicalSystem(Database const& db, py::args args) -> ChemicalSystem
 
 void exportChemicalSystem(py::module& m)
 {
+    // Pickle a chemical system by its structural hash and the names of its species (used only to give informative errors)
+    auto getstate = [](ChemicalSystem const& self)
+    {
+        Strings names;
+        for(auto const& species : self.species())
+            names.push_back(species.name());
+        return py::make_tuple(self.hash(), names);
+    };
+
+    // Unpickle a chemical system by finding an identical one already constructed in this process
+    auto setstate = [](py::tuple const& t)
+    {
+        errorif(t.size() != 2, "Invalid state for unpickling a ChemicalSystem object.");
+        const auto hash = t[0].cast<std::uint64_t>();
+        auto system = ChemicalSystem::findWithHash(hash);
+        errorif(!system.has_value(), "Could not unpickle a ChemicalSystem object with species `", join(t[1].cast<Strings>()), "` because "
+            "no identical chemical system has been constructed in this process. Construct it before unpickling (e.g., in the initializer of the "
+            "worker processes, or in the parent process before the worker processes are forked).");
+        return system.value();
+    };
 
     py::class_<ChemicalSystem>(m, "ChemicalSystem")
         .def(py::init<>())
@@ -81,6 +102,8 @@ void exportChemicalSystem(py::module& m)
         .def(py::init<Phases const&, Reactions const&, Surfaces const&>())
         .def(py::init(&rkt4py::createChemicalSystem))
         .def("id", &ChemicalSystem::id)
+        .def("hash", &ChemicalSystem::hash)
+        .def("memoryUsage", &ChemicalSystem::memoryUsage)
         .def("database", &ChemicalSystem::database, return_internal_ref)
         .def("element", &ChemicalSystem::element, return_internal_ref)
         .def("elements", &ChemicalSystem::elements, return_internal_ref)
@@ -95,6 +118,9 @@ void exportChemicalSystem(py::module& m)
         .def("formulaMatrix", &ChemicalSystem::formulaMatrix, return_internal_ref)
         .def("formulaMatrixElements", &ChemicalSystem::formulaMatrixElements, return_internal_ref)
         .def("formulaMatrixCharge", &ChemicalSystem::formulaMatrixCharge, return_internal_ref)
+        .def("formulaMatrixSparse", &ChemicalSystem::formulaMatrixSparse, return_internal_ref)
         .def("stoichiometricMatrix", &ChemicalSystem::stoichiometricMatrix, return_internal_ref)
+        .def_static("findWithHash", &ChemicalSystem::findWithHash)
+        .def(py::pickle(getstate, setstate))
         ;
 }
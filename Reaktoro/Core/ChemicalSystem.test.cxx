@@ -154,6 +154,19 @@ TEST_CASE("Testing ChemicalSystem class", "[ChemicalSystem]")
     CHECK( ChemicalSystem().id() == system.id() + 1 ); // new ChemicalSystem object has id = id0 + 1 and original system continues to have id = id0
     CHECK( ChemicalSystem().id() == system.id() + 2 ); // new ChemicalSystem object has id = id0 + 2 and original system continues to have id = id0
 
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: ChemicalSystem::hash() and ChemicalSystem::findWithHash()
+    //-------------------------------------------------------------------------
+    CHECK( system.hash() == test::createChemicalSystem().hash() );
+    CHECK( system.hash() != ChemicalSystem(system.database(), PhaseList{system.phase(0)}).hash() );
+
+    auto found = ChemicalSystem::findWithHash(system.hash());
+    REQUIRE( found.has_value() );
+    CHECK( found->hash() == system.hash() );
+    CHECK( found->species().size() == system.species().size() );
+
+    CHECK_FALSE( ChemicalSystem::findWithHash(system.hash() + 1).has_value() );
+
     //-------------------------------------------------------------------------
     // TESTING METHOD: ChemicalSystem::database()
     //-------------------------------------------------------------------------
@@ -255,6 +268,13 @@ TEST_CASE("Testing ChemicalSystem class", "[ChemicalSystem]")
     CHECK(system.formulaMatrixElements() == Aexpected.topRows(system.elements().size()));
     CHECK(system.formulaMatrixCharge() == Aexpected.row(system.elements().size()));
 
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalSystem::formulaMatrixSparse()
+    //-------------------------------------------------------------------------
+
+    CHECK(MatrixXd(system.formulaMatrixSparse()) == Aexpected);
+    CHECK(system.formulaMatrixSparse().nonZeros() == (Aexpected.array() != 0.0).count());
+
     //-------------------------------------------------------------------------
     // TESTING METHOD: ChemicalSystem::stoichiometricMatrix()
     //-------------------------------------------------------------------------
@@ -263,6 +283,13 @@ TEST_CASE("Testing ChemicalSystem class", "[ChemicalSystem]")
 
     CHECK(system.stoichiometricMatrix() == Sexpected);
 
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: ChemicalSystem::stoichiometricMatrixSparse()
+    //-------------------------------------------------------------------------
+
+    CHECK(MatrixXd(system.stoichiometricMatrixSparse()) == Sexpected);
+    CHECK(system.stoichiometricMatrixSparse().nonZeros() == (Sexpected.array() != 0.0).count());
+
     //-------------------------------------------------------------------------
     // TESTING METHOD: ChemicalSystem::surfaces()
     //-------------------------------------------------------------------------
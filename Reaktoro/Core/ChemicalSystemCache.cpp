@@ -0,0 +1,145 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ChemicalSystemCache.hpp"
+
+// C++ includes
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+namespace {
+
+namespace fs = std::filesystem;
+
+/// Return the default cache directory.
+auto defaultCacheDirectory() -> String
+{
+    if(auto const* dir = std::getenv("REAKTORO_CACHE_DIR"); dir && *dir)
+        return dir;
+    return (fs::temp_directory_path() / "reaktoro-cache").string();
+}
+
+/// Return a suffix for temporary files that is unique among threads and processes with high probability.
+auto uniqueSuffix() -> String
+{
+    static thread_local std::mt19937_64 engine(std::random_device{}());
+    std::stringstream ss;
+    ss << std::hex << engine();
+    return ss.str();
+}
+
+} // namespace
+
+ChemicalSystemCache::ChemicalSystemCache()
+: ChemicalSystemCache(defaultCacheDirectory())
+{}
+
+ChemicalSystemCache::ChemicalSystemCache(String const& directory)
+: m_directory(directory)
+{
+    errorif(m_directory.empty(), "Expecting a non-empty cache directory in ChemicalSystemCache.");
+}
+
+auto ChemicalSystemCache::directory() const -> String const&
+{
+    return m_directory;
+}
+
+auto ChemicalSystemCache::key(ChemicalSystem const& system) const -> String
+{
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << system.hash();
+    return ss.str();
+}
+
+auto ChemicalSystemCache::path(ChemicalSystem const& system, String const& name) const -> String
+{
+    errorif(name.empty(), "Expecting a non-empty name for the data in ChemicalSystemCache.");
+    return (fs::path(m_directory) / key(system) / name).string();
+}
+
+auto ChemicalSystemCache::exists(ChemicalSystem const& system, String const& name) const -> bool
+{
+    std::error_code ec;
+    return fs::is_regular_file(path(system, name), ec);
+}
+
+auto ChemicalSystemCache::load(ChemicalSystem const& system, String const& name) const -> Optional<String>
+{
+    std::ifstream file(path(system, name), std::ios::binary);
+    if(!file.is_open())
+        return {};
+    return String((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+auto ChemicalSystemCache::save(ChemicalSystem const& system, String const& name, String const& contents) const -> void
+{
+    fs::path const filepath = path(system, name);
+    fs::path const tmppath = filepath.string() + ".tmp-" + uniqueSuffix();
+
+    std::error_code ec;
+    fs::create_directories(filepath.parent_path(), ec);
+    errorif(ec, "Could not create the cache directory `", filepath.parent_path().string(), "` (", ec.message(), ").");
+
+    {
+        std::ofstream file(tmppath, std::ios::binary);
+        errorif(!file.is_open(), "Could not create the file `", tmppath.string(), "` in the cache directory.");
+        file.write(contents.data(), contents.size());
+        errorif(!file, "Could not write the file `", tmppath.string(), "` in the cache directory.");
+    }
+
+    fs::rename(tmppath, filepath, ec);
+    if(ec)
+    {
+        fs::remove(tmppath, ec);
+        errorif(true, "Could not move the file `", tmppath.string(), "` to `", filepath.string(), "` in the cache directory.");
+    }
+}
+
+auto ChemicalSystemCache::loadOrCreate(ChemicalSystem const& system, String const& name, Fn<String()> const& create) const -> String
+{
+    if(auto contents = load(system, name); contents.has_value())
+        return contents.value();
+    auto contents = create();
+    save(system, name, contents);
+    return contents;
+}
+
+auto ChemicalSystemCache::remove(ChemicalSystem const& system) const -> void
+{
+    std::error_code ec;
+    fs::remove_all(fs::path(m_directory) / key(system), ec);
+}
+
+auto ChemicalSystemCache::clear() const -> void
+{
+    std::error_code ec;
+    fs::remove_all(m_directory, ec);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,91 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalSystem;
+
+/// Used to store data derived from chemical systems in a directory on disk so that it can be reused in later runs.
+/// Data derived from a chemical system with expensive preprocessing (e.g.,
+/// tabulated thermodynamic properties, reduced systems, trained surrogate
+/// models) can be saved in this cache under a given name and loaded again in
+/// another process, as long as the chemical system is constructed in the
+/// same way. The files are stored in the cache directory under a
+/// subdirectory named after the structural hash of the chemical system (see
+/// @ref ChemicalSystem::hash), so changing species, phases, models or their
+/// parameters results in a different subdirectory and no stale data is used.
+/// ~~~{.cpp}
+/// ChemicalSystemCache cache;
+/// String contents = cache.loadOrCreate(system, "my-table.bin", [&]() { return computeMyExpensiveTable(system); });
+/// ~~~
+class ChemicalSystemCache
+{
+public:
+    /// Construct a ChemicalSystemCache object with the default cache directory.
+    /// The default cache directory is given by the environment variable
+    /// `REAKTORO_CACHE_DIR` if set, or `reaktoro-cache` in the temporary
+    /// directory of the operating system otherwise.
+    ChemicalSystemCache();
+
+    /// Construct a ChemicalSystemCache object with given cache directory.
+    explicit ChemicalSystemCache(String const& directory);
+
+    /// Return the cache directory.
+    auto directory() const -> String const&;
+
+    /// Return the key of the data derived from a chemical system in the cache (its structural hash in hexadecimal).
+    auto key(ChemicalSystem const& system) const -> String;
+
+    /// Return the path of the file with given name storing data derived from a chemical system.
+    auto path(ChemicalSystem const& system, String const& name) const -> String;
+
+    /// Return true if there is data with given name derived from a chemical system in the cache.
+    auto exists(ChemicalSystem const& system, String const& name) const -> bool;
+
+    /// Return the data with given name derived from a chemical system in the cache, if any.
+    auto load(ChemicalSystem const& system, String const& name) const -> Optional<String>;
+
+    /// Save data with given name derived from a chemical system in the cache.
+    /// The data is first written to a temporary file which is then renamed,
+    /// so that concurrent processes never read a partially written file.
+    auto save(ChemicalSystem const& system, String const& name, String const& contents) const -> void;
+
+    /// Return the data with given name derived from a chemical system in the cache, creating and saving it first if needed.
+    /// @param system The chemical system from which the data is derived.
+    /// @param name The name of the data in the cache.
+    /// @param create The function that creates the data when it is not in the cache.
+    auto loadOrCreate(ChemicalSystem const& system, String const& name, Fn<String()> const& create) const -> String;
+
+    /// Remove all data derived from a chemical system in the cache.
+    auto remove(ChemicalSystem const& system) const -> void;
+
+    /// Remove all data in the cache.
+    auto clear() const -> void;
+
+private:
+    /// The cache directory.
+    String m_directory;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,60 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/ChemicalSystemCache.hpp>
+using namespace Reaktoro;
+
+void exportChemicalSystemCache(py::module& m)
+{
+    auto load = [](ChemicalSystemCache const& self, ChemicalSystem const& system, String const& name) -> Optional<py::bytes>
+    {
+        auto contents = self.load(system, name);
+        if(contents.has_value())
+            return py::bytes(contents.value());
+        return {};
+    };
+
+    auto save = [](ChemicalSystemCache const& self, ChemicalSystem const& system, String const& name, py::bytes const& contents)
+    {
+        self.save(system, name, String(contents));
+    };
+
+    auto loadOrCreate = [](ChemicalSystemCache const& self, ChemicalSystem const& system, String const& name, Fn<py::bytes()> const& create) -> py::bytes
+    {
+        return py::bytes(self.loadOrCreate(system, name, [&]() { return String(create()); }));
+    };
+
+    py::class_<ChemicalSystemCache>(m, "ChemicalSystemCache")
+        .def(py::init<>())
+        .def(py::init<String const&>())
+        .def("directory", &ChemicalSystemCache::directory, return_internal_ref)
+        .def("key", &ChemicalSystemCache::key)
+        .def("path", &ChemicalSystemCache::path)
+        .def("exists", &ChemicalSystemCache::exists)
+        .def("load", load)
+        .def("save", save)
+        .def("loadOrCreate", loadOrCreate)
+        .def("remove", &ChemicalSystemCache::remove)
+        .def("clear", &ChemicalSystemCache::clear)
+        ;
+}
@@ -0,0 +1,65 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/ChemicalSystemCache.hpp>
+using namespace Reaktoro;
+
+namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
+
+TEST_CASE("Testing ChemicalSystemCache", "[ChemicalSystemCache]")
+{
+    ChemicalSystem system1 = test::createChemicalSystem();
+    ChemicalSystem system2 = test::createChemicalSystem();
+
+    CHECK( system1.id() != system2.id() );
+    CHECK( system1.hash() == system2.hash() ); // systems constructed in the same way have the same structural hash
+
+    ChemicalSystemCache cache("ChemicalSystemCache.test.dir");
+    cache.clear();
+
+    CHECK( cache.directory() == "ChemicalSystemCache.test.dir" );
+    CHECK( cache.key(system1) == cache.key(system2) );
+    CHECK( cache.key(system1).size() == 16 );
+
+    CHECK_FALSE( cache.exists(system1, "data.bin") );
+    CHECK_FALSE( cache.load(system1, "data.bin").has_value() );
+
+    cache.save(system1, "data.bin", String("abc\0def", 7));
+
+    CHECK( cache.exists(system2, "data.bin") );
+    CHECK( cache.load(system2, "data.bin").value() == String("abc\0def", 7) );
+
+    auto calls = 0;
+    auto create = [&]() { ++calls; return String("xyz"); };
+
+    CHECK( cache.loadOrCreate(system1, "other.bin", create) == "xyz" );
+    CHECK( cache.loadOrCreate(system2, "other.bin", create) == "xyz" );
+    CHECK( calls == 1 ); // the data was created only once and loaded afterwards
+
+    cache.remove(system1);
+
+    CHECK_FALSE( cache.exists(system2, "data.bin") );
+    CHECK_FALSE( cache.exists(system2, "other.bin") );
+
+    cache.clear();
+}
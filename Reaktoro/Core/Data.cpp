@@ -18,10 +18,15 @@
 #include "Data.hpp"
 
 // C++ includes
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <streambuf>
 
 // Third-party includes
 #include <nlohmann/json.hpp>
+#include <yaml-cpp/eventhandler.h>
 #include <yaml-cpp/yaml.h>
 using yaml = YAML::Node;
 using json = nlohmann::json;
@@ -69,15 +74,155 @@ bool isNumber(String const& str, double& result)
     return true;
 }
 
+/// Check if string `str` is an integer.
+/// @param str The string being checked
+/// @param[out] result The number in `str` as an int value if it is indeed an integer.
+bool isInteger(String const& str, int& result)
+{
+    char* end;
+    errno = 0;
+    const auto value = std::strtol(str.c_str(), &end, 10);
+    if(end == str.c_str() || *end != '\0' || errno == ERANGE)
+        return false;
+    if(value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+        return false;
+    result = static_cast<int>(value);
+    return true;
+}
+
+/// Used to read a character buffer as an input stream without copying it.
+class CharsBuffer : public std::streambuf
+{
+public:
+    /// Construct a CharsBuffer object with given characters and number of characters.
+    CharsBuffer(Chars text, std::size_t size)
+    {
+        auto begin = const_cast<char*>(text);
+        setg(begin, begin, begin + size);
+    }
+};
+
 // ==========================================================================================
-// METHODS TO CONVERT YAML TO DATA
+// CLASS TO ASSEMBLE DATA OBJECTS FROM THE EVENTS OF STREAMING PARSERS
 // ==========================================================================================
 
-auto convertYamlToData(yaml const& obj) -> Data;
+/// Used to assemble a Data object directly from the events of a streaming YAML or JSON parser.
+/// Dictionaries and lists are assembled on a stack and moved into their
+/// parents once complete, so that no intermediate YAML or JSON document tree
+/// needs to be created while parsing.
+class DataBuilder
+{
+public:
+    /// Start the construction of a dictionary.
+    auto startDict() -> void
+    {
+        frames.push_back({ {}, {}, true, false });
+    }
+
+    /// Start the construction of a list.
+    auto startList() -> void
+    {
+        frames.push_back({ {}, {}, false, false });
+    }
+
+    /// Finish the construction of the current dictionary or list and return it.
+    auto finish() -> Data
+    {
+        errorif(frames.empty(), "Could not finish the construction of a dictionary or list in a Data object because none has been started.");
+        Data data = std::move(frames.back().data);
+        frames.pop_back();
+        return data;
+    }
+
+    /// Set the key of the next value to be added to the current dictionary.
+    auto key(String key) -> void
+    {
+        frames.back().key = std::move(key);
+        frames.back().haskey = true;
+    }
+
+    /// Return true if a key is expected next in the current dictionary.
+    auto expectingKey() const -> bool
+    {
+        return !frames.empty() && frames.back().isdict && !frames.back().haskey;
+    }
+
+    /// Return `i` or `f` if the key of the next value in the current dictionary ends with `|i` or `|f`, zero otherwise.
+    auto keySuffix() const -> char
+    {
+        if(frames.empty() || !frames.back().isdict)
+            return 0;
+        auto const& key = frames.back().key;
+        if(key.size() > 2 && key[key.size() - 2] == '|' && (key.back() == 'i' || key.back() == 'f'))
+            return key.back();
+        return 0;
+    }
+
+    /// Return the key of the next value in the current dictionary.
+    auto currentKey() const -> String const&
+    {
+        return frames.back().key;
+    }
+
+    /// Ensure the key of the next value does not require an integer or floating-point value.
+    auto ensureUntypedKey() const -> void
+    {
+        const auto suffix = keySuffix();
+        errorif(suffix == 'i', "Expecting an integer value for key-value pair with key `", currentKey(), "` because it ends with `|i`.");
+        errorif(suffix == 'f', "Expecting a floating-point value for key-value pair with key `", currentKey(), "` because it ends with `|f`.");
+    }
 
-auto convertYamlScalarToData(yaml const& obj) -> Data
+    /// Add a value to the current dictionary or list, or set it as the final result if there is none.
+    auto add(Data value) -> void
+    {
+        if(frames.empty())
+            result = std::move(value);
+        else if(frames.back().isdict)
+        {
+            auto& frame = frames.back();
+            frame.data.add(frame.key, std::move(value));
+            frame.haskey = false;
+        }
+        else frames.back().data.add(std::move(value));
+    }
+
+    /// Return the assembled Data object.
+    auto release() -> Data
+    {
+        errorif(!frames.empty(), "Could not complete the construction of the Data object because some of its dictionaries or lists have not been finished.");
+        return std::move(result);
+    }
+
+private:
+    /// Used to represent a dictionary or list under construction.
+    struct Frame
+    {
+        /// The dictionary or list under construction.
+        Data data;
+
+        /// The key of the next value if the frame is a dictionary.
+        String key;
+
+        /// The flag indicating if the frame is a dictionary.
+        bool isdict;
+
+        /// The flag indicating if the key of the next value has been given.
+        bool haskey;
+    };
+
+    /// The dictionaries and lists under construction.
+    Vec<Frame> frames;
+
+    /// The assembled Data object.
+    Data result;
+};
+
+// ==========================================================================================
+// METHODS TO PARSE YAML INTO DATA
+// ==========================================================================================
+
+auto convertYamlScalarToData(String const& word) -> Data
 {
-    auto const& word = obj.Scalar();
     auto number = 0.0;
     if(isNumber(word, number))
         return Param(number);
@@ -90,112 +235,255 @@ auto convertYamlScalarToData(yaml const& obj) -> Data
     }
 }
 
-auto convertYamlSequenceToData(yaml const& obj) -> Data
+/// Used to assemble a Data object from the events of the YAML parser.
+class YamlDataHandler : public YAML::EventHandler
 {
-    Data result;
-    for(auto i = 0; i < obj.size(); ++i)
-        result.add(convertYamlToData(obj[i]));
-    return result;
-}
+public:
+    auto OnDocumentStart(YAML::Mark const& mark) -> void override
+    {
+    }
 
-auto convertYamlMapToData(yaml const& obj) -> Data
-{
-    Data result;
-    for(auto const& child : obj)
+    auto OnDocumentEnd() -> void override
+    {
+    }
+
+    auto OnNull(YAML::Mark const& mark, YAML::anchor_t anchor) -> void override
     {
-        const auto key = child.first.as<String>();
-        if(key.size() > 2 && key.substr(key.size() - 2) == "|i")
+        if(anchor != YAML::NullAnchor)
+            nodes[anchor] = Data();
+        if(builder.expectingKey())
+            return builder.key("null");
+        builder.ensureUntypedKey();
+        builder.add({});
+    }
+
+    auto OnAlias(YAML::Mark const& mark, YAML::anchor_t anchor) -> void override
+    {
+        const auto scalar = scalars.find(anchor);
+        if(scalar != scalars.end())
+            return OnScalar(mark, {}, YAML::NullAnchor, scalar->second);
+        const auto node = nodes.find(anchor);
+        errorif(node == nodes.end(), "Could not find the YAML anchor referenced by the alias in line ", mark.line + 1, ".");
+        if(node->second.isNull())
+            return OnNull(mark, YAML::NullAnchor);
+        errorif(builder.expectingKey(), "Could not use the alias in line ", mark.line + 1, " as a YAML key because it does not refer to a scalar.");
+        builder.ensureUntypedKey();
+        builder.add(node->second);
+    }
+
+    auto OnScalar(YAML::Mark const& mark, String const& tag, YAML::anchor_t anchor, String const& value) -> void override
+    {
+        if(anchor != YAML::NullAnchor)
+            scalars[anchor] = value;
+        if(builder.expectingKey())
+            return builder.key(value);
+        const auto suffix = builder.keySuffix();
+        if(suffix == 'i')
         {
             int num = 0;
-            try { num = child.second.as<int>(); }
-            catch(...) errorif(true, "Expecting an integer value for key-value pair with key `", key, "` because it ends with `|i`.");
-            result.add(key, num);
+            errorif(!isInteger(value, num), "Expecting an integer value for key-value pair with key `", builder.currentKey(), "` because it ends with `|i`.");
+            return builder.add(num);
         }
-        else if(key.size() > 2 && key.substr(key.size() - 2) == "|f")
+        if(suffix == 'f')
         {
             double num = 0;
-            try { num = child.second.as<double>(); }
-            catch(...) errorif(true, "Expecting a floating-point value for key-value pair with key `", key, "` because it ends with `|f`.");
-            result.add(key, num);
+            errorif(!isNumber(value, num), "Expecting a floating-point value for key-value pair with key `", builder.currentKey(), "` because it ends with `|f`.");
+            return builder.add(num);
         }
-        else result.add(key, convertYamlToData(child.second));
+        builder.add(convertYamlScalarToData(value));
     }
-    return result;
-}
 
-auto convertYamlToData(yaml const& obj) -> Data
-{
-    switch(obj.Type())
+    auto OnSequenceStart(YAML::Mark const& mark, String const& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) -> void override
     {
-        case YAML::NodeType::Scalar: return convertYamlScalarToData(obj);
-        case YAML::NodeType::Sequence: return convertYamlSequenceToData(obj);
-        case YAML::NodeType::Map: return convertYamlMapToData(obj);
-        case YAML::NodeType::Null: return {};
-        case YAML::NodeType::Undefined: return {};
+        errorif(builder.expectingKey(), "Could not use the sequence in line ", mark.line + 1, " as a YAML key. Only scalars are supported as keys.");
+        builder.ensureUntypedKey();
+        builder.startList();
+        anchors.push_back(anchor);
     }
 
-    errorif(true, "Could not convert YAML node to Data object: ", YAML::Dump(obj));
+    auto OnSequenceEnd() -> void override
+    {
+        finish();
+    }
 
-    return {};
-}
+    auto OnMapStart(YAML::Mark const& mark, String const& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) -> void override
+    {
+        errorif(builder.expectingKey(), "Could not use the map in line ", mark.line + 1, " as a YAML key. Only scalars are supported as keys.");
+        builder.ensureUntypedKey();
+        builder.startDict();
+        anchors.push_back(anchor);
+    }
 
-// ==========================================================================================
-// METHODS TO CONVERT JSON TO DATA
-// ==========================================================================================
+    auto OnMapEnd() -> void override
+    {
+        finish();
+    }
 
-auto convertJsonToData(json const& obj) -> Data;
+    /// Return the Data object assembled from the parsed YAML document.
+    auto release() -> Data
+    {
+        return builder.release();
+    }
 
-auto convertJsonObjectToData(json const& obj) -> Data
-{
-    Data result;
-    for(auto const& [key, value] : obj.items())
+private:
+    /// Finish the current sequence or map and add it to its parent.
+    auto finish() -> void
     {
-        if(key.size() > 2 && key.substr(key.length() - 2) == "|i")
-        {
-            int num = 0;
-            try { num = value.get<int>(); }
-            catch(...) errorif(true, "Expecting an integer value for key-value pair with key `", key, "` because it ends with `|i`.");
-            result.add(key, num);
-        }
-        else if(key.size() > 2 && key.substr(key.length() - 2) == "|f")
-        {
-            double num = 0;
-            try { num = value.get<double>(); }
-            catch(...) errorif(true, "Expecting a floating-point value for key-value pair with key `", key, "` because it ends with `|f`.");
-            result.add(key, num);
-        }
-        else result.add(key, convertJsonToData(value));
+        Data data = builder.finish();
+        const auto anchor = anchors.back();
+        anchors.pop_back();
+        if(anchor != YAML::NullAnchor)
+            nodes[anchor] = data;
+        builder.add(std::move(data));
     }
-    return result;
+
+    /// The object that assembles the Data object.
+    DataBuilder builder;
+
+    /// The anchors of the sequences and maps under construction.
+    Vec<YAML::anchor_t> anchors;
+
+    /// The anchored scalars that can be referenced by aliases.
+    Map<YAML::anchor_t, String> scalars;
+
+    /// The anchored sequences, maps and null values that can be referenced by aliases.
+    Map<YAML::anchor_t, Data> nodes;
+};
+
+/// Parse the first document in a YAML stream into a Data object.
+auto parseYamlToData(std::istream& text) -> Data
+{
+    YamlDataHandler handler;
+    YAML::Parser parser(text);
+    parser.HandleNextDocument(handler);
+    return handler.release();
 }
 
-auto convertJsonArrayToData(json const& obj) -> Data
+/// Parse a YAML formatted string into a Data object.
+auto parseYamlToData(Chars text, std::size_t size) -> Data
 {
-    Data result;
-    for(auto const& value : obj)
-        result.add(convertJsonToData(value));
-    return result;
+    CharsBuffer buffer(text, size);
+    std::istream stream(&buffer);
+    return parseYamlToData(stream);
 }
 
-auto convertJsonToData(json const& obj) -> Data
+// ==========================================================================================
+// METHODS TO PARSE JSON INTO DATA
+// ==========================================================================================
+
+/// Used to assemble a Data object from the events of the JSON parser.
+class JsonDataHandler
 {
-    switch(obj.type())
+public:
+    auto null() -> bool
     {
-        case json::value_t::null: return {};
-        case json::value_t::object: return convertJsonObjectToData(obj);
-        case json::value_t::array: return convertJsonArrayToData(obj);
-        case json::value_t::string: return obj.get<String>();
-        case json::value_t::boolean: return obj.get<bool>();
-        case json::value_t::number_integer: return Param(obj.get<int>());
-        case json::value_t::number_unsigned: return Param(obj.get<int>());
-        case json::value_t::number_float: return Param(obj.get<double>());
-        case json::value_t::binary: break;
-        case json::value_t::discarded: break;
+        builder.ensureUntypedKey();
+        builder.add({});
+        return true;
     }
 
-    errorif(true, "Could not convert JSON node to Data object: ", obj.dump());
+    auto boolean(bool val) -> bool
+    {
+        return number(val, val);
+    }
 
-    return {};
+    auto number_integer(json::number_integer_t val) -> bool
+    {
+        return number(val, Param(static_cast<int>(val)));
+    }
+
+    auto number_unsigned(json::number_unsigned_t val) -> bool
+    {
+        return number(val, Param(static_cast<int>(val)));
+    }
+
+    auto number_float(json::number_float_t val, json::string_t const& str) -> bool
+    {
+        return number(val, Param(static_cast<double>(val)));
+    }
+
+    auto string(json::string_t& val) -> bool
+    {
+        builder.ensureUntypedKey();
+        builder.add(val);
+        return true;
+    }
+
+    auto binary(json::binary_t& val) -> bool
+    {
+        errorif(true, "Could not convert binary JSON values to Data objects.");
+        return false;
+    }
+
+    auto start_object(std::size_t elements) -> bool
+    {
+        builder.ensureUntypedKey();
+        builder.startDict();
+        return true;
+    }
+
+    auto end_object() -> bool
+    {
+        builder.add(builder.finish());
+        return true;
+    }
+
+    auto start_array(std::size_t elements) -> bool
+    {
+        builder.ensureUntypedKey();
+        builder.startList();
+        return true;
+    }
+
+    auto end_array() -> bool
+    {
+        builder.add(builder.finish());
+        return true;
+    }
+
+    auto key(json::string_t& val) -> bool
+    {
+        builder.key(std::move(val));
+        return true;
+    }
+
+    auto parse_error(std::size_t position, std::string const& last_token, nlohmann::detail::exception const& ex) -> bool
+    {
+        errorif(true, "Could not parse the JSON text at position ", position, " near `", last_token, "`. More details about the error below:\n\n", ex.what());
+        return false;
+    }
+
+    /// Return the Data object assembled from the parsed JSON text.
+    auto release() -> Data
+    {
+        return builder.release();
+    }
+
+private:
+    /// Add a number to the current dictionary or list, converted to int or double if its key ends with `|i` or `|f`.
+    template<typename T>
+    auto number(T val, Data data) -> bool
+    {
+        const auto suffix = builder.keySuffix();
+        if(suffix == 'i')
+            builder.add(static_cast<int>(val));
+        else if(suffix == 'f')
+            builder.add(static_cast<double>(val));
+        else builder.add(std::move(data));
+        return true;
+    }
+
+    /// The object that assembles the Data object.
+    DataBuilder builder;
+};
+
+/// Parse a JSON formatted input (string or stream) into a Data object.
+template<typename Input>
+auto parseJsonToData(Input&& text) -> Data
+{
+    JsonDataHandler handler;
+    json::sax_parse(std::forward<Input>(text), &handler);
+    return handler.release();
 }
 
 // ==========================================================================================
@@ -250,6 +538,202 @@ auto convertDataToJson(Data const& data) -> json
     return convertDataTo<json>(data);
 }
 
+// ==========================================================================================
+// METHODS TO CONVERT DATA TO AND FROM BINARY IMAGES
+// ==========================================================================================
+
+/// The characters at the beginning of a binary image of a Data object.
+const char BINARY_IMAGE_MAGIC[8] = { 'R', 'K', 'T', 'D', 'A', 'T', 'A', '\0' };
+
+/// The version of the format of binary images of Data objects (increment when the format changes).
+const std::uint32_t BINARY_IMAGE_VERSION = 1;
+
+/// The value used to detect binary images written with a different byte order.
+const std::uint32_t BINARY_IMAGE_BYTE_ORDER = 0x01020304;
+
+/// The tags identifying the type of each node in a binary image of a Data object.
+enum class BinaryTag : std::uint8_t { Null, Boolean, Integer, Float, String, Param, Dict, List };
+
+/// Used to write a binary image of a Data object.
+/// Strings (e.g., dictionary keys, which repeat often in a database) are
+/// interned in a table written before the nodes, which refer to them by index.
+struct BinaryWriter
+{
+    /// The bytes of the nodes in the binary image.
+    String nodes;
+
+    /// The interned strings in the binary image.
+    Strings strings;
+
+    /// The indices of the interned strings.
+    Map<String, std::uint32_t> indices;
+
+    template<typename T>
+    auto write(String& buffer, T const& value) -> void
+    {
+        buffer.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    auto intern(String const& str) -> std::uint32_t
+    {
+        auto [it, inserted] = indices.try_emplace(str, static_cast<std::uint32_t>(strings.size()));
+        if(inserted)
+            strings.push_back(str);
+        return it->second;
+    }
+
+    auto tag(BinaryTag value) -> void
+    {
+        write(nodes, static_cast<std::uint8_t>(value));
+    }
+
+    auto node(Data const& data) -> void
+    {
+        if(data.isNull()) { tag(BinaryTag::Null); }
+        else if(data.isBoolean()) { tag(BinaryTag::Boolean); write(nodes, static_cast<std::uint8_t>(data.asBoolean())); }
+        else if(data.isInteger()) { tag(BinaryTag::Integer); write(nodes, static_cast<std::int64_t>(data.asInteger())); }
+        else if(data.isFloat()) { tag(BinaryTag::Float); write(nodes, data.asFloat()); }
+        else if(data.isString()) { tag(BinaryTag::String); write(nodes, intern(data.asString())); }
+        else if(data.isParam())
+        {
+            auto const& param = data.asParam();
+            tag(BinaryTag::Param);
+            write(nodes, static_cast<double>(param.value()));
+            write(nodes, intern(param.id()));
+            write(nodes, param.lowerbound());
+            write(nodes, param.upperbound());
+            write(nodes, static_cast<std::uint8_t>(param.isconst()));
+        }
+        else if(data.isDict())
+        {
+            tag(BinaryTag::Dict);
+            write(nodes, static_cast<std::uint32_t>(data.asDict().size()));
+            for(auto const& [key, value] : data.asDict())
+            {
+                write(nodes, intern(key));
+                node(value);
+            }
+        }
+        else if(data.isList())
+        {
+            tag(BinaryTag::List);
+            write(nodes, static_cast<std::uint32_t>(data.asList().size()));
+            for(auto const& value : data.asList())
+                node(value);
+        }
+        else errorif(true, "Could not create a binary image of a Data object containing a value of unsupported type.");
+    }
+
+    auto image(Data const& data) -> String
+    {
+        node(data);
+        String res(BINARY_IMAGE_MAGIC, sizeof(BINARY_IMAGE_MAGIC));
+        write(res, BINARY_IMAGE_VERSION);
+        write(res, BINARY_IMAGE_BYTE_ORDER);
+        write(res, static_cast<std::uint32_t>(strings.size()));
+        for(auto const& str : strings)
+        {
+            write(res, static_cast<std::uint32_t>(str.size()));
+            res.append(str);
+        }
+        res.append(nodes);
+        return res;
+    }
+};
+
+/// Used to read a binary image of a Data object.
+struct BinaryReader
+{
+    /// The bytes of the binary image.
+    String const& bytes;
+
+    /// The position of the next byte to be read.
+    std::size_t pos = 0;
+
+    /// The interned strings in the binary image.
+    Strings strings;
+
+    template<typename T>
+    auto read() -> T
+    {
+        errorif(pos + sizeof(T) > bytes.size(), "Could not read the binary image of a Data object because it is truncated.");
+        T value;
+        std::memcpy(&value, bytes.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    auto string() -> String const&
+    {
+        auto const i = read<std::uint32_t>();
+        errorif(i >= strings.size(), "Could not read the binary image of a Data object because it is corrupted.");
+        return strings[i];
+    }
+
+    auto node() -> Data
+    {
+        Data data;
+        switch(static_cast<BinaryTag>(read<std::uint8_t>()))
+        {
+            case BinaryTag::Null: break;
+            case BinaryTag::Boolean: data = static_cast<bool>(read<std::uint8_t>()); break;
+            case BinaryTag::Integer: data = static_cast<int>(read<std::int64_t>()); break;
+            case BinaryTag::Float: data = read<double>(); break;
+            case BinaryTag::String: data = string(); break;
+            case BinaryTag::Param:
+            {
+                Param param(read<double>());
+                param.id(string());
+                param.lowerbound(read<double>());
+                param.upperbound(read<double>());
+                param.isconst(read<std::uint8_t>());
+                data = param;
+                break;
+            }
+            case BinaryTag::Dict:
+            {
+                auto const size = read<std::uint32_t>();
+                for(std::uint32_t i = 0; i < size; ++i)
+                {
+                    auto const& key = string();
+                    data.add(key, node());
+                }
+                if(size == 0) data = Dict<String, Data>();
+                break;
+            }
+            case BinaryTag::List:
+            {
+                auto const size = read<std::uint32_t>();
+                for(std::uint32_t i = 0; i < size; ++i)
+                    data.add(node());
+                if(size == 0) data = Vec<Data>();
+                break;
+            }
+            default: errorif(true, "Could not read the binary image of a Data object because it is corrupted.");
+        }
+        return data;
+    }
+
+    auto image() -> Data
+    {
+        errorif(bytes.compare(0, sizeof(BINARY_IMAGE_MAGIC), BINARY_IMAGE_MAGIC, sizeof(BINARY_IMAGE_MAGIC)) != 0, "Could not read the binary image of a Data object because the given bytes do not start as expected.");
+        pos = sizeof(BINARY_IMAGE_MAGIC);
+        auto const version = read<std::uint32_t>();
+        errorif(version != BINARY_IMAGE_VERSION, "Could not read the binary image of a Data object because it was created with format version ", version, " instead of ", BINARY_IMAGE_VERSION, ". Create the binary image again with this version of Reaktoro.");
+        errorif(read<std::uint32_t>() != BINARY_IMAGE_BYTE_ORDER, "Could not read the binary image of a Data object because it was created in a machine with a different byte order.");
+        auto const numstrings = read<std::uint32_t>();
+        strings.reserve(numstrings);
+        for(std::uint32_t i = 0; i < numstrings; ++i)
+        {
+            auto const size = read<std::uint32_t>();
+            errorif(pos + size > bytes.size(), "Could not read the binary image of a Data object because it is truncated.");
+            strings.emplace_back(bytes.data() + pos, size);
+            pos += size;
+        }
+        return node();
+    }
+};
+
 // ==========================================================================================
 // CLASS TO ENSURE A COMMON LOCALE IS KEPT WHEN DEALING WITH YAML AND JSON
 // ==========================================================================================
@@ -300,39 +784,37 @@ auto Data::parse(std::istream& text) -> Data
 auto Data::parseYaml(Chars text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertYamlToData(YAML::Load(text));
+    return parseYamlToData(text, std::strlen(text));
 }
 
 auto Data::parseYaml(String const& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertYamlToData(YAML::Load(text));
+    return parseYamlToData(text.data(), text.size());
 }
 
 auto Data::parseYaml(std::istream& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertYamlToData(YAML::Load(text));
+    return parseYamlToData(text);
 }
 
 auto Data::parseJson(Chars text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertJsonToData(nlohmann::json::parse(text));
+    return parseJsonToData(text);
 }
 
 auto Data::parseJson(String const& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertJsonToData(nlohmann::json::parse(text));
+    return parseJsonToData(text);
 }
 
 auto Data::parseJson(std::istream& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    nlohmann::json obj;
-    text >> obj;
-    return convertJsonToData(obj);
+    return parseJsonToData(text);
 }
 
 auto Data::load(String const& path) -> Data
@@ -350,22 +832,40 @@ auto Data::loadYaml(String const& path) -> Data
 {
     std::ifstream f(path);
     errorif(f.fail(), "There was an error finding your YAML file at `", path, "`. Ensure this file exists and prefer global path strings such as \"/home/mary/data.json\" in Linux and macOS or \"C:\\\\Users\\\\Mary\\\\data.json\" in Windows.");
-    yaml doc;
-    try { doc = YAML::Load(f); }
+    Data doc;
+    try { doc = parseYamlToData(f); }
     catch(std::exception e)
         errorif(true, "There was an error parsing your YAML file at `", path, "`. Ensure this file is properly formatted (e.g., inconsistent indentation). Try using some online YAML validator to find the error. More details about the error below:\n\n", e.what());
-    return convertYamlToData(doc);
+    return doc;
 }
 
 auto Data::loadJson(String const& path) -> Data
 {
     std::ifstream f(path);
     errorif(f.fail(), "There was an error finding your JSON file at `", path, "`. Ensure this file exists and prefer global path strings such as \"/home/mary/data.json\" in Linux and macOS or \"C:\\\\Users\\\\Mary\\\\data.json\" in Windows.");
-    json doc;
-    try { doc = json::parse(f); }
+    Data doc;
+    try { doc = parseJsonToData(f); }
     catch(std::exception e)
         errorif(true, "There was an error parsing your JSON file at `", path, "`. Ensure this file is properly formatted (e.g., missing closing brackets). Try using some online JSON validator to find the error. More details about the error below:\n\n", e.what());
-    return convertJsonToData(doc);
+    return doc;
+}
+
+auto Data::parseBinary(String const& bytes) -> Data
+{
+    return BinaryReader{bytes}.image();
+}
+
+auto Data::loadBinary(String const& path) -> Data
+{
+    std::ifstream f(path, std::ios::binary);
+    errorif(f.fail(), "There was an error finding your binary file at `", path, "`. Ensure this file exists and prefer global path strings such as \"/home/mary/data.bin\" in Linux and macOS or \"C:\\\\Users\\\\Mary\\\\data.bin\" in Windows.");
+    const String bytes((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    return parseBinary(bytes);
+}
+
+auto Data::isBinary(String const& bytes) -> bool
+{
+    return bytes.compare(0, sizeof(BINARY_IMAGE_MAGIC), BINARY_IMAGE_MAGIC, sizeof(BINARY_IMAGE_MAGIC)) == 0;
 }
 
 auto Data::asString() const -> String const&
@@ -592,7 +1092,7 @@ auto Data::exists(String const& key) const -> bool
 {
     if(!isDict())
         return false;
-    auto obj = asDict();
+    auto const& obj = asDict();
     return obj.find(key) != obj.end();
 }
 
@@ -632,6 +1132,18 @@ auto Data::saveJson(String const& filepath) const -> void
     file.close();
 }
 
+auto Data::dumpBinary() const -> String
+{
+    return BinaryWriter().image(*this);
+}
+
+auto Data::saveBinary(String const& filepath) const -> void
+{
+    std::ofstream file(filepath, std::ios::binary);
+    file << dumpBinary();
+    file.close();
+}
+
 auto Data::repr() const -> String
 {
     return dumpYaml();
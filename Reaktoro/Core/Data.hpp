@@ -80,6 +80,15 @@ public:
     /// Return a Data object by parsing a JSON formatted file at a given path.
     static auto loadJson(String const& path) -> Data;
 
+    /// Return a Data object from its binary image created with @ref dumpBinary.
+    static auto parseBinary(String const& bytes) -> Data;
+
+    /// Return a Data object from its binary image saved with @ref saveBinary in a file at a given path.
+    static auto loadBinary(String const& path) -> Data;
+
+    /// Return true if given bytes are the beginning of a binary image of a Data object.
+    static auto isBinary(String const& bytes) -> bool;
+
     /// Return this Data object as a boolean value.
     auto asBoolean() const -> bool;
 
@@ -213,6 +222,16 @@ public:
     /// Save the state of this Data object into a JSON formatted file.
     auto saveJson(String const& filepath) const -> void;
 
+    /// Return a binary image representing the state of this Data object.
+    /// The binary image can be converted back into a Data object considerably
+    /// faster than YAML or JSON formatted strings, since no text needs to be
+    /// interpreted. Its format is versioned and specific to the byte order of
+    /// the machine where it was created.
+    auto dumpBinary() const -> String;
+
+    /// Save the state of this Data object into a file as a binary image (see @ref dumpBinary).
+    auto saveBinary(String const& filepath) const -> void;
+
     /// Return a YAML formatted string representing the state of this Data object.
     auto repr() const -> String;
 
@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <sstream>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -566,11 +569,28 @@ TEST_CASE("Testing Data class", "[Data]")
         CHECK_THROWS( num9.asNull()     );
     }
 
+    SECTION("Checking the construction of Data objects using binary images")
+    {
+        const Data data = Data::parseYaml(yaml_testing_string);
+        const String image = data.dumpBinary();
+
+        CHECK( Data::isBinary(image) );
+        CHECK_FALSE( Data::isBinary(yaml_testing_string) );
+
+        const Data parsed = Data::parseBinary(image);
+
+        CHECK( parsed.dumpYaml() == data.dumpYaml() );
+
+        CHECK_THROWS( Data::parseBinary(image.substr(0, image.size() - 1)) ); // truncated image
+        CHECK_THROWS( Data::parseBinary(yaml_testing_string) ); // not a binary image
+    }
+
     SECTION("Checking the construction of Data objects using YAML and JSON formatted strings")
     {
         const Data data = GENERATE(
             Data::parseYaml(yaml_testing_string),
-            Data::parseJson(json_testing_string)
+            Data::parseJson(json_testing_string),
+            Data::parseBinary(Data::parseYaml(yaml_testing_string).dumpBinary())
         );
 
         CHECK( data.isDict() );
@@ -679,6 +699,50 @@ TEST_CASE("Testing Data class", "[Data]")
         CHECK_THROWS( data["Species"].with("Name", "Calcite") );
     }
 
+    SECTION("Checking the streaming parsing of YAML and JSON formatted strings")
+    {
+        const Data yaml = Data::parseYaml(
+            "Counts|i: 7\n"
+            "Factor|f: 2.5\n"
+            "Defaults: &defaults\n"
+            "  Tmax: 1000\n"
+            "  Name: &name Calcite\n"
+            "Species:\n"
+            "  - *defaults\n"
+            "  - *name\n"
+            "Missing: ~\n"
+        );
+
+        CHECK( yaml["Counts|i"].asInteger() == 7 );
+        CHECK( yaml["Factor|f"].asFloat() == 2.5 );
+        CHECK( yaml["Defaults"]["Tmax"].isParam() );
+        CHECK( yaml["Species"][0]["Tmax"].asFloat() == 1000.0 );
+        CHECK( yaml["Species"][0]["Name"].asString() == "Calcite" );
+        CHECK( yaml["Species"][1].asString() == "Calcite" );
+        CHECK( yaml["Missing"].isNull() );
+
+        const Data json = Data::parseJson(R"({"Counts|i": 7, "Factor|f": 2.5, "Values": [1, 2.5, "x", true, null]})");
+
+        CHECK( json["Counts|i"].asInteger() == 7 );
+        CHECK( json["Factor|f"].asFloat() == 2.5 );
+        CHECK( json["Values"][0].isParam() );
+        CHECK( json["Values"][1].asFloat() == 2.5 );
+        CHECK( json["Values"][2].asString() == "x" );
+        CHECK( json["Values"][3].asBoolean() == true );
+        CHECK( json["Values"][4].isNull() );
+
+        std::istringstream stream(yaml_testing_string);
+        CHECK( Data::parseYaml(stream).dumpYaml() == Data::parseYaml(yaml_testing_string).dumpYaml() );
+
+        CHECK( Data::parseYaml("").isNull() );
+
+        CHECK_THROWS( Data::parseYaml("Counts|i: 7.5") );
+        CHECK_THROWS( Data::parseYaml("Factor|f: abc") );
+        CHECK_THROWS( Data::parseYaml("Factor|f: [1, 2]") );
+        CHECK_THROWS( Data::parseJson(R"({"Counts|i": "7"})") );
+        CHECK_THROWS( Data::parseJson(R"({"Species": [1, 2)") );
+    }
+
     SECTION("Checking dumping of Data objects to YAML formatted strings")
     {
         const Data data1 = Data::parseYaml(yaml_testing_string);
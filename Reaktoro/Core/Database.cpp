@@ -18,7 +18,9 @@
 #include "Database.hpp"
 
 // C++ includes
+#include <cstdint>
 #include <fstream>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
@@ -29,6 +31,29 @@
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The type used to represent a set of indices (e.g., of elements or tags) as bits.
+using Bitmask = Vec<std::uint64_t>;
+
+/// Set the bit with given index in a bitmask, enlarging the bitmask if needed.
+auto setbit(Bitmask& mask, Index i) -> void
+{
+    if(mask.size() <= i / 64)
+        mask.resize(i / 64 + 1, 0);
+    mask[i / 64] |= std::uint64_t(1) << (i % 64);
+}
+
+/// Return true if all bits set in bitmask `a` are also set in bitmask `b`.
+auto subset(Bitmask const& a, Bitmask const& b) -> bool
+{
+    for(Index w = 0; w < a.size(); ++w)
+        if(a[w] & ~(w < b.size() ? b[w] : std::uint64_t(0)))
+            return false;
+    return true;
+}
+
+} // namespace
 
 struct Database::Impl
 {
@@ -41,24 +66,91 @@ struct Database::Impl
     /// The additional data in the database whose type is known at runtime only.
     Any attached_data;
 
-    /// The symbols of all elements already in the database.
-    Set<String> inserted_elements_set;
+    /// The indices of the elements already in the database, with their symbols as keys.
+    Map<String, Index> element_indices;
 
     /// The ids of the species already inserted in the database, with id = species name + aggregate state
     Set<String> inserted_species_set;
 
+    /// The indices of the species in the database, with their names as keys (the first species with a given name if it is shared among aggregate states).
+    Map<String, Index> species_indices;
+
+    /// The indices of the species in the database, with their names and aggregate states as keys (see @ref speciesKey).
+    Map<String, Index> species_indices_with_name_and_aggregate_state;
+
     /// The species in the database grouped in terms of their aggregate state
     Map<AggregateState, SpeciesList> species_with_aggregate_state;
 
+    /// The indices of the species in the database grouped in terms of their aggregate state
+    Map<AggregateState, Indices> species_indices_with_aggregate_state;
+
+    /// The indices of the elements composing each species in the database as bitmasks
+    Vec<Bitmask> species_elements;
+
+    /// The indices of the tags of the species in the database, with the tags as keys
+    Map<String, Index> tag_indices;
+
+    /// The indices of the tags of each species in the database as bitmasks
+    Vec<Bitmask> species_tags;
+
+    /// The parser used to create the species of a lazy database on demand (null if the database is not lazy).
+    SharedPtr<DatabaseParser> parser;
+
+    /// The indices of the records of the species in a lazy database, with the species names as keys.
+    Map<String, Index> record_indices;
+
+    /// The indices of the species created from each record in a lazy database (equal to the number of species if not yet created).
+    Indices record_species;
+
+    /// The indices of the elements composing the species of each record in a lazy database as bitmasks.
+    Vec<Bitmask> record_elements;
+
+    /// Used to have a mutex in Impl objects that can be copied (each copy has its own mutex).
+    struct Mutex : std::mutex
+    {
+        Mutex() = default;
+        Mutex(Mutex const&) {}
+    };
+
+    /// The mutex used to create the species of a lazy database on demand from concurrent threads.
+    Mutex mutex;
+
+    /// Return the key used to find a species in the database with given name and aggregate state.
+    static auto speciesKey(String const& name, AggregateState option) -> String
+    {
+        return name + "@" + std::to_string(static_cast<int>(option));
+    }
+
+    /// Return the index of the element in the database with given symbol (the number of elements if not found).
+    auto elementIndex(String const& symbol) const -> Index
+    {
+        auto const it = element_indices.find(symbol);
+        return it != element_indices.end() ? it->second : elements.size();
+    }
+
+    /// Return the index of the species in the database with given name (the number of species if not found).
+    auto speciesIndex(String const& name) const -> Index
+    {
+        auto const it = species_indices.find(name);
+        return it != species_indices.end() ? it->second : species.size();
+    }
+
+    /// Return the index of the species in the database with given name and aggregate state (the number of species if not found).
+    auto speciesIndex(String const& name, AggregateState option) const -> Index
+    {
+        auto const it = species_indices_with_name_and_aggregate_state.find(speciesKey(name, option));
+        return it != species_indices_with_name_and_aggregate_state.end() ? it->second : species.size();
+    }
+
     /// Add an element in the database.
     auto addElement(Element const& element) -> void
     {
-        auto const ielement = elements.findWithSymbol(element.symbol());
+        auto const ielement = elementIndex(element.symbol());
 
         if(ielement == elements.size())
         {
             elements.append(element);
-            inserted_elements_set.insert(element.symbol());
+            element_indices.emplace(element.symbol(), ielement);
         }
         else
         {
@@ -109,12 +201,43 @@ struct Database::Impl
         // Update the list of unique species ids.
         inserted_species_set.insert(unique_id);
 
+        // Index the new species by its name, and by its name and aggregate state, so that it can be found without string comparisons
+        species_indices.emplace(newspecies.name(), species.size() - 1); // emplace does not replace the first species with this name
+        species_indices_with_name_and_aggregate_state.emplace(speciesKey(newspecies.name(), newspecies.aggregateState()), species.size() - 1);
+
         // Update the container of elements with the Element objects in this new species.
         for(auto&& [element, coeff] : newspecies.elements())
             addElement(element);
 
         // Add the new species in the group of species with same aggregate state
         species_with_aggregate_state[newspecies.aggregateState()].push_back(newspecies);
+        species_indices_with_aggregate_state[newspecies.aggregateState()].push_back(species.size() - 1);
+
+        // Index the elements composing the new species, so that species can be selected by elements without string comparisons
+        Bitmask elementsmask;
+        for(auto&& [element, coeff] : newspecies.elements())
+            setbit(elementsmask, elementIndex(element.symbol()));
+        species_elements.push_back(elementsmask);
+
+        // Index the tags of the new species, so that species can be excluded by tags without string comparisons
+        Bitmask tagsmask;
+        for(auto const& tag : newspecies.tags())
+            setbit(tagsmask, tag_indices.emplace(tag, tag_indices.size()).first->second);
+        species_tags.push_back(tagsmask);
+    }
+
+    /// Return the bitmask of the tags with given names, or empty if any of these tags is not used by the species in the database.
+    auto tagsmask(StringList const& tags) const -> Bitmask
+    {
+        Bitmask mask;
+        for(auto const& tag : tags)
+        {
+            auto const it = tag_indices.find(tag);
+            if(it == tag_indices.end())
+                return {};
+            setbit(mask, it->second);
+        }
+        return mask;
     }
 
     /// Construct a reaction with given equation.
@@ -122,6 +245,96 @@ struct Database::Impl
     {
         return Reaction().withEquation(ReactionEquation(equation, species));
     }
+
+    /// Initialize this lazy database with a parser whose species are created on demand.
+    auto initialize(SharedPtr<DatabaseParser> const& lazyparser) -> void
+    {
+        parser = lazyparser;
+
+        for(auto const& element : parser->elements())
+            addElement(element);
+
+        auto const& records = parser->speciesRecords();
+        for(auto i = 0; i < records.size(); ++i)
+            record_indices.emplace(records[i].name, i);
+        record_species.assign(records.size(), -1);
+
+        record_elements.resize(records.size());
+        for(auto i = 0; i < records.size(); ++i)
+            for(auto const& symbol : records[i].elements)
+                setbit(record_elements[i], elementIndex(symbol)); // an unknown symbol sets a bit that is never allowed
+
+        reserve();
+    }
+
+    /// Reserve memory for all species in this lazy database so that references to those already created remain valid when more are created.
+    auto reserve() -> void
+    {
+        Map<AggregateState, Index> counts;
+        for(auto const& record : parser->speciesRecords())
+            counts[record.aggregate_state] += 1;
+        species.reserve(record_species.size());
+        for(auto const& [option, count] : counts)
+            species_with_aggregate_state[option].reserve(count);
+    }
+
+    /// Reserve memory for the given number of additional elements and species in this database (not lazy).
+    auto reserve(Index nelements, Index nspecies) -> void
+    {
+        element_indices.reserve(element_indices.size() + nelements);
+        species.reserve(species.size() + nspecies);
+        species_elements.reserve(species_elements.size() + nspecies);
+        species_tags.reserve(species_tags.size() + nspecies);
+        species_indices.reserve(species_indices.size() + nspecies);
+        species_indices_with_name_and_aggregate_state.reserve(species_indices_with_name_and_aggregate_state.size() + nspecies);
+        inserted_species_set.reserve(inserted_species_set.size() + nspecies);
+    }
+
+    /// Return the index of the species created from the record with given index in this lazy database, creating it if needed (the mutex must be locked).
+    auto createSpecies(Index irecord) -> Index
+    {
+        if(record_species[irecord] < species.size())
+            return record_species[irecord];
+        addSpecies(parser->createSpecies(parser->speciesRecords()[irecord].name));
+        record_species[irecord] = species.size() - 1;
+        return record_species[irecord];
+    }
+
+    /// Create the species with given name in this lazy database if it has a record with this name (the mutex must be locked).
+    auto createSpecies(String const& name) -> void
+    {
+        auto const it = record_indices.find(name);
+        if(it != record_indices.end())
+            createSpecies(it->second);
+    }
+
+    /// Create the species in this lazy database with given aggregate state not yet created (the mutex must be locked).
+    auto createSpecies(AggregateState option) -> void
+    {
+        auto const& records = parser->speciesRecords();
+        for(auto i = 0; i < records.size(); ++i)
+            if(records[i].aggregate_state == option)
+                createSpecies(i);
+    }
+
+    /// Create the species in this lazy database not yet created (the mutex must be locked).
+    auto createAllSpecies() -> void
+    {
+        for(auto i = 0; i < record_species.size(); ++i)
+            createSpecies(i);
+    }
+
+    /// Create all species in this lazy database so that it is no longer lazy (this Impl object must not be shared).
+    auto createAllSpeciesAndStopBeingLazy() -> void
+    {
+        if(!parser)
+            return;
+        createAllSpecies();
+        parser = nullptr;
+        record_indices.clear();
+        record_species.clear();
+        record_elements.clear();
+    }
 };
 
 Database::Database()
@@ -129,7 +342,7 @@ Database::Database()
 {}
 
 Database::Database(Database const& other)
-: pimpl(new Impl(*other.pimpl))
+: pimpl(other.pimpl)
 {}
 
 Database::Database(Vec<Element> const& elements, Vec<Species> const& species)
@@ -159,37 +372,52 @@ auto Database::operator=(Database other) -> Database&
 
 auto Database::clear() -> void
 {
-    *pimpl = Database::Impl();
+    pimpl = std::make_shared<Impl>();
 }
 
 auto Database::addElement(Element const& element) -> void
 {
+    detach();
+    pimpl->createAllSpeciesAndStopBeingLazy();
     pimpl->addElement(element);
 }
 
 auto Database::addSpecies(Species const& species) -> void
 {
+    detach();
+    pimpl->createAllSpeciesAndStopBeingLazy();
     pimpl->addSpecies(species);
 }
 
 auto Database::addSpecies(Vec<Species> const& species) -> void
 {
+    detach();
+    pimpl->createAllSpeciesAndStopBeingLazy();
+    pimpl->reserve(0, species.size());
     for(auto const& x : species)
-        addSpecies(x);
+        pimpl->addSpecies(x);
 }
 
 auto Database::attachData(Any const& data) -> void
 {
+    detach();
     pimpl->attached_data = data;
 }
 
 auto Database::extend(Database const& other) -> void
 {
-    for(auto const& element : other.elements())
-        addElement(element);
+    auto const& otherelements = other.elements();
+    auto const& otherspecies = other.species();
 
-    for(auto const& species : other.species())
-        addSpecies(species);
+    detach();
+    pimpl->createAllSpeciesAndStopBeingLazy();
+    pimpl->reserve(otherelements.size(), otherspecies.size());
+
+    for(auto const& element : otherelements)
+        pimpl->addElement(element);
+
+    for(auto const& species : otherspecies)
+        pimpl->addSpecies(species);
 
     // TODO: Replace Any by Map<String, Any> so that it becomes easier/more intuitive to unify different attached data to Database objects.
     // pimpl->attached_data = ???;
@@ -202,17 +430,88 @@ auto Database::elements() const -> ElementList const&
 
 auto Database::species() const -> SpeciesList const&
 {
+    if(pimpl->parser)
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        pimpl->createAllSpecies();
+    }
+    return pimpl->species;
+}
+
+auto Database::speciesCreated() const -> SpeciesList
+{
+    std::lock_guard<std::mutex> lock(pimpl->mutex);
     return pimpl->species;
 }
 
-auto Database::speciesWithAggregateState(AggregateState option) const -> SpeciesList
+auto Database::speciesWithAggregateState(AggregateState option) const -> SpeciesList const&
 {
+    static const SpeciesList empty;
+    if(pimpl->parser)
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        pimpl->createSpecies(option);
+    }
     auto it = pimpl->species_with_aggregate_state.find(option);
     if(it == pimpl->species_with_aggregate_state.end())
-        return {};
+        return empty;
     return it->second;
 }
 
+auto Database::speciesWithAggregateState(AggregateState option, StringList const& symbols) const -> SpeciesList
+{
+    return speciesWithAggregateState(option, symbols, {});
+}
+
+auto Database::speciesWithAggregateState(AggregateState option, StringList const& symbols, StringList const& excludetags) const -> SpeciesList
+{
+    Bitmask allowed;
+    for(auto const& symbol : symbols)
+    {
+        auto const ielement = pimpl->elementIndex(symbol);
+        if(ielement < pimpl->elements.size())
+            setbit(allowed, ielement);
+    }
+
+    Vec<Species> selected;
+
+    // Return true if the species with given index has all tags to be excluded.
+    auto excluded = [&](Index ispecies)
+    {
+        if(excludetags.empty())
+            return false;
+        auto const excludemask = pimpl->tagsmask(excludetags);
+        return !excludemask.empty() && subset(excludemask, pimpl->species_tags[ispecies]);
+    };
+
+    if(pimpl->parser) // in a lazy database, create only the selected species, in the order they appear in the database
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        auto const& records = pimpl->parser->speciesRecords();
+        for(auto i = 0; i < records.size(); ++i)
+        {
+            if(records[i].aggregate_state != option)
+                continue;
+            if(!subset(pimpl->record_elements[i], allowed))
+                continue;
+            auto const ispecies = pimpl->createSpecies(i);
+            if(!excluded(ispecies))
+                selected.push_back(pimpl->species[ispecies]);
+        }
+        return selected;
+    }
+
+    auto it = pimpl->species_indices_with_aggregate_state.find(option);
+    if(it == pimpl->species_indices_with_aggregate_state.end())
+        return {};
+
+    for(auto const ispecies : it->second)
+        if(subset(pimpl->species_elements[ispecies], allowed) && !excluded(ispecies))
+            selected.push_back(pimpl->species[ispecies]);
+
+    return selected;
+}
+
 auto Database::element(String const& symbol) const -> Element const&
 {
     return elements().getWithSymbol(symbol);
@@ -220,11 +519,45 @@ auto Database::element(String const& symbol) const -> Element const&
 
 auto Database::species(String const& name) const -> Species const&
 {
-    return species().getWithName(name);
+    if(pimpl->parser)
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        auto const it = pimpl->record_indices.find(name);
+        if(it != pimpl->record_indices.end())
+            return pimpl->species[pimpl->createSpecies(it->second)];
+        return pimpl->species.getWithName(name);
+    }
+    auto const ispecies = pimpl->speciesIndex(name);
+    if(ispecies < pimpl->species.size())
+        return pimpl->species[ispecies];
+    return pimpl->species.getWithName(name); // throws the usual error for a species not found
+}
+
+auto Database::findSpecies(String const& name, AggregateState option) const -> Optional<Species>
+{
+    if(pimpl->parser)
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        auto const it = pimpl->record_indices.find(name);
+        if(it != pimpl->record_indices.end() && pimpl->parser->speciesRecords()[it->second].aggregate_state == option)
+            return pimpl->species[pimpl->createSpecies(it->second)];
+        return {};
+    }
+    auto const ispecies = pimpl->speciesIndex(name, option);
+    if(ispecies < pimpl->species.size())
+        return pimpl->species[ispecies];
+    return {};
 }
 
 auto Database::reaction(String const& equation) const -> Reaction
 {
+    if(pimpl->parser)
+    {
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+        for(auto const& [name, coeff] : parseReactionEquation(equation))
+            pimpl->createSpecies(name);
+        return pimpl->reaction(equation);
+    }
     return pimpl->reaction(equation);
 }
 
@@ -233,9 +566,42 @@ auto Database::attachedData() const -> Any const&
     return pimpl->attached_data;
 }
 
-auto Database::fromFile(String const& path) -> Database
+auto Database::detach() -> void
+{
+    if(pimpl.use_count() == 1)
+        return;
+
+    if(pimpl->parser)
+    {
+        auto const shared = pimpl;
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        pimpl = std::make_shared<Impl>(*shared);
+        pimpl->parser = std::make_shared<DatabaseParser>(*shared->parser); // the species may still be created on demand in both copies
+        pimpl->reserve();
+    }
+    else pimpl = std::make_shared<Impl>(*pimpl);
+}
+
+auto Database::initializeLazy(DatabaseParser const& parser) -> void
+{
+    detach();
+    errorif(!pimpl->species.empty() || pimpl->parser, "Expecting an empty Database object when initializing it to create its species on demand.");
+    pimpl->initialize(std::make_shared<DatabaseParser>(parser));
+}
+
+auto Database::fromDataLazy(Data const& doc) -> Database
 {
-    std::ifstream file(path);
+    Database db;
+    db.pimpl->initialize(std::make_shared<DatabaseParser>(doc, true));
+    return db;
+}
+
+namespace {
+
+/// Return the contents of a database file in YAML or JSON formats, or of a binary database image, as a Data object.
+auto loadDatabaseFile(String const& path) -> Data
+{
+    std::ifstream file(path, std::ios::binary);
     errorif(!file.is_open(),
         "Could not open file `", path, "`. Ensure the given file path "
         "is relative to the directory where your application is RUNNING "
@@ -244,22 +610,18 @@ auto Database::fromFile(String const& path) -> Database
         "in Windows, `C:\\User\\username\\mydata\\mydatabase.yaml`, "
         "in Linux and macOS, `/home/username/mydata/mydatabase.yaml`). "
         "File formats accepted are JSON and YAML and expected file extensions are .json, .yaml, or .yml.");
+    String contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if(Data::isBinary(contents))
+        return Data::parseBinary(contents);
     auto isJson = endswith(path, ".json");
     auto isYaml = endswith(path, ".yaml") || endswith(path, ".yml");
-    errorifnot(isJson || isYaml, "The file `", path, "` must be a JSON or YAML file terminating with .json, .yaml, or .yml.");
-    auto doc = isJson ? Data::parseJson(file) : Data::parseYaml(file);
-    DatabaseParser dbparser(doc);
-    return Database(dbparser);
-}
-
-auto Database::fromEmbeddedFile(String const& path) -> Database
-{
-    const String contents = Embedded::get("databases/reaktoro/" + path);
-    return fromContents(contents);
+    errorifnot(isJson || isYaml, "The file `", path, "` must be a JSON or YAML file terminating with .json, .yaml, or .yml, or a binary database image created with Database::compile.");
+    return isJson ? Data::parseJson(contents) : Data::parseYaml(contents);
 }
 
+/// Return the contents of a database in YAML or JSON formats as a Data object.
 template<typename Source>
-auto createDatabaseFromContents(Source& contents)
+auto parseDatabaseContents(Source& contents) -> Data
 {
     Data doc;
 
@@ -273,18 +635,64 @@ auto createDatabaseFromContents(Source& contents)
         }
     }
 
-    DatabaseParser dbparser(doc);
+    return doc;
+}
+
+/// Return the contents of a database in YAML or JSON formats, or of a binary database image, as a Data object.
+auto parseDatabaseContents(String const& contents) -> Data
+{
+    if(Data::isBinary(contents))
+        return Data::parseBinary(contents);
+    return parseDatabaseContents<String const>(contents);
+}
+
+} // namespace
+
+auto Database::fromFile(String const& path) -> Database
+{
+    DatabaseParser dbparser(loadDatabaseFile(path));
     return Database(dbparser);
 }
 
+auto Database::fromFileLazy(String const& path) -> Database
+{
+    return fromDataLazy(loadDatabaseFile(path));
+}
+
+auto Database::compile(String const& path, String const& imagepath) -> void
+{
+    const auto doc = Data::load(path);
+    DatabaseParser dbparser(doc); // ensure the database file is valid before creating its binary image
+    doc.saveBinary(imagepath);
+}
+
+auto Database::fromEmbeddedFile(String const& path) -> Database
+{
+    const String contents = Embedded::get("databases/reaktoro/" + path);
+    return fromContents(contents);
+}
+
+auto Database::fromEmbeddedFileLazy(String const& path) -> Database
+{
+    const String contents = Embedded::get("databases/reaktoro/" + path);
+    return fromContentsLazy(contents);
+}
+
 auto Database::fromContents(String const& contents) -> Database
 {
-    return createDatabaseFromContents(contents);
+    DatabaseParser dbparser(parseDatabaseContents(contents));
+    return Database(dbparser);
+}
+
+auto Database::fromContentsLazy(String const& contents) -> Database
+{
+    return fromDataLazy(parseDatabaseContents(contents));
 }
 
 auto Database::fromStream(std::istream& stream) -> Database
 {
-    return createDatabaseFromContents(stream);
+    DatabaseParser dbparser(parseDatabaseContents(stream));
+    return Database(dbparser);
 }
 
 auto Database::local(String const& path) -> Database
@@ -25,26 +25,77 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class Data;
+class DatabaseParser;
+
 /// The class used to store and retrieve data of chemical species.
+/// Copies of a Database object share its data until one of them is modified
+/// (e.g., with @ref addSpecies), in which case that copy first creates its
+/// own copy of the data. Thus, copies made when constructing ChemicalSystem
+/// objects, for example, are cheap even for large databases. Note that
+/// references returned by the methods of a Database object (e.g., by
+/// @ref species) refer to the data it had before any later modification.
+///
+/// A Database object created with @ref fromFileLazy, @ref fromEmbeddedFileLazy
+/// or @ref fromContentsLazy is lazy: its Species objects, together with their
+/// thermodynamic models, are only created when first needed (e.g., when a
+/// ChemicalSystem object is constructed with some of them). Methods that need
+/// all species (e.g., @ref species()) create all of them, and so do methods
+/// that modify the species or elements in the database. Note that in a lazy
+/// database, the species are stored in the order in which they are created.
+/// Derived classes for other database formats (e.g., ThermoFunDatabase) can
+/// also be lazy with @ref initializeLazy.
 /// @see Element, Species
 /// @ingroup Core
 class Database
 {
 public:
     /// Return a Database object constructed with a given local file.
+    /// The file can be in YAML or JSON formats, or a binary database image created with @ref compile.
     /// @warning An exception is thrown if `path` does not point to a valid local database file.
     /// @param path The path, including file name, to the local database file.
     static auto fromFile(String const& path) -> Database;
 
+    /// Compile a database file in YAML or JSON formats into a binary database image.
+    /// The binary database image can be loaded with @ref fromFile considerably
+    /// faster than the original file, since no text needs to be parsed. This is
+    /// useful for applications that start many short-lived processes using the
+    /// same database. The binary image must be compiled again if created with
+    /// a different version of the format (an exception is thrown when loaded).
+    /// @param path The path, including file name, to the database file in YAML or JSON formats.
+    /// @param imagepath The path, including file name, to the binary database image to be created.
+    static auto compile(String const& path, String const& imagepath) -> void;
+
+    /// Return a lazy Database object constructed with a given local file.
+    /// Only the elements in the database are created when the file is
+    /// loaded. Each species is created when first needed, which reduces the
+    /// time and memory needed to load large databases of which only a few
+    /// species are used. The attributes of a species in the file are only
+    /// checked when it is created.
+    /// @warning An exception is thrown if `path` does not point to a valid local database file.
+    /// @param path The path, including file name, to the local database file.
+    static auto fromFileLazy(String const& path) -> Database;
+
     /// Return a Database object constructed with a given embedded file.
     /// @warning An exception is thrown if `path` does not point to a valid embedded database file.
     /// @param path The path, including file name, to the embedded database file.
     static auto fromEmbeddedFile(String const& path) -> Database;
 
+    /// Return a lazy Database object constructed with a given embedded file.
+    /// @see fromFileLazy
+    /// @param path The path, including file name, to the embedded database file.
+    static auto fromEmbeddedFileLazy(String const& path) -> Database;
+
     /// Return a Database object constructed with given database text contents.
-    /// @param contents The contents of the database as a string.
+    /// @param contents The contents of the database as a string (in YAML or JSON formats, or a binary database image created with @ref compile).
     static auto fromContents(String const& contents) -> Database;
 
+    /// Return a lazy Database object constructed with given database text contents.
+    /// @see fromFileLazy
+    /// @param contents The contents of the database as a string (in YAML or JSON formats, or a binary database image created with @ref compile).
+    static auto fromContentsLazy(String const& contents) -> Database;
+
     /// Return a Database object constructed with given input stream containing the database text contents.
     /// @param stream The input stream containing the database file contents.
     static auto fromStream(std::istream& stream) -> Database;
@@ -101,8 +152,23 @@ public:
     /// Return all species in the database.
     auto species() const -> SpeciesList const&;
 
+    /// Return the species in the database that have already been created.
+    /// This is equivalent to @ref species() if the database is not lazy.
+    /// Otherwise, the species not yet needed are not created.
+    auto speciesCreated() const -> SpeciesList;
+
     /// Return all species in the database with given aggregate state.
-    auto speciesWithAggregateState(AggregateState option) const -> SpeciesList;
+    auto speciesWithAggregateState(AggregateState option) const -> SpeciesList const&;
+
+    /// Return all species in the database with given aggregate state that are composed of given elements only.
+    /// This is equivalent to `speciesWithAggregateState(option).withElements(symbols)`,
+    /// but faster, since the elements of the species are indexed in the database.
+    auto speciesWithAggregateState(AggregateState option, StringList const& symbols) const -> SpeciesList;
+
+    /// Return all species in the database with given aggregate state that are composed of given elements only, excluding those with all given tags.
+    /// This is equivalent to `speciesWithAggregateState(option, symbols).withoutTags(excludetags)`,
+    /// but faster, since the tags of the species are also indexed in the database.
+    auto speciesWithAggregateState(AggregateState option, StringList const& symbols, StringList const& excludetags) const -> SpeciesList;
 
     /// Return an element with given symbol in the database.
     /// @warning An exception is thrown if no element with given symbol exists.
@@ -112,6 +178,9 @@ public:
     /// @warning An exception is thrown if no species with given name exists.
     auto species(String const& name) const -> Species const&;
 
+    /// Return the species in the database with given name and aggregate state if there is one.
+    auto findSpecies(String const& name, AggregateState option) const -> Optional<Species>;
+
     /// Construct a reaction with given equation.
     /// @warning An exception is thrown if the reaction has an inexistent species in the database.
     auto reaction(String const& equation) const -> Reaction;
@@ -119,10 +188,21 @@ public:
     /// Return the attached data to this database whose type is known at runtime only.
     auto attachedData() const -> Any const&;
 
+protected:
+    /// Initialize this Database object so that its species are created on demand with a given lazy DatabaseParser object.
+    /// @param parser The parser with the elements and species records in the database, and which creates the species on demand
+    auto initializeLazy(DatabaseParser const& parser) -> void;
+
 private:
     struct Impl;
 
-    Ptr<Impl> pimpl;
+    SharedPtr<Impl> pimpl;
+
+    /// Ensure the data of this Database object is not shared with others before it is modified.
+    auto detach() -> void;
+
+    /// Return a lazy Database object whose species are created on demand from a given Data object.
+    static auto fromDataLazy(Data const& doc) -> Database;
 };
 
 } // namespace Reaktoro
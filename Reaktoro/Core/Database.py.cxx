@@ -48,14 +48,22 @@ void exportDatabase(py::module& m)
         .def("extend", &Database::extend)
         .def("elements", &Database::elements)
         .def("species", py::overload_cast<>(&Database::species, py::const_))
-        .def("speciesWithAggregateState", &Database::speciesWithAggregateState)
+        .def("speciesCreated", &Database::speciesCreated)
+        .def("speciesWithAggregateState", py::overload_cast<AggregateState>(&Database::speciesWithAggregateState, py::const_))
+        .def("speciesWithAggregateState", py::overload_cast<AggregateState, StringList const&>(&Database::speciesWithAggregateState, py::const_))
+        .def("speciesWithAggregateState", py::overload_cast<AggregateState, StringList const&, StringList const&>(&Database::speciesWithAggregateState, py::const_))
         .def("element", &Database::element, return_internal_ref)
         .def("species", py::overload_cast<const String&>(&Database::species, py::const_), return_internal_ref)
+        .def("findSpecies", &Database::findSpecies)
         .def("reaction", &Database::reaction)
         .def("attachedData", &Database::attachedData)
         .def_static("fromFile", &Database::fromFile)
+        .def_static("compile", &Database::compile)
+        .def_static("fromFileLazy", &Database::fromFileLazy)
         .def_static("fromEmbeddedFile", &Database::fromEmbeddedFile)
+        .def_static("fromEmbeddedFileLazy", &Database::fromEmbeddedFileLazy)
         .def_static("fromContents", &Database::fromContents)
+        .def_static("fromContentsLazy", &Database::fromContentsLazy)
         .def_static("fromStream", &Database::fromStream)
         .def_static("local", &Database::local)
         .def_static("embedded", &Database::embedded)
@@ -151,6 +151,34 @@ TEST_CASE("Testing Database class", "[Database]")
     REQUIRE_NOTHROW( db.speciesWithAggregateState(AggregateState::Gas).index("CO2(g)")      );
     REQUIRE_NOTHROW( db.speciesWithAggregateState(AggregateState::Solid).index("NaCl(s)")   );
 
+    const auto aqueous = db.speciesWithAggregateState(AggregateState::Aqueous);
+    const auto symbols = Strings{ "H", "O", "C" };
+
+    const auto expected = aqueous.withElements(symbols);
+    const auto selected = db.speciesWithAggregateState(AggregateState::Aqueous, symbols);
+
+    REQUIRE( selected.size() == expected.size() );
+    for(auto i = 0; i < expected.size(); ++i)
+        CHECK( selected[i].name() == expected[i].name() );
+
+    CHECK( selected.findWithName("H2O(aq)") < selected.size() );
+    CHECK( selected.findWithName("CO2(aq)") < selected.size() );
+    CHECK( selected.findWithName("Na+(aq)") == selected.size() ); // Na is not in the list of symbols
+    CHECK( db.speciesWithAggregateState(AggregateState::Adsorbed, symbols).size() == 0 );
+
+    Database tagged(Vec<Species>{
+        test::createAqueousSpecies("H2O(aq)"),
+        test::createAqueousSpecies("CO2(aq)").withTags({"carbon", "neutral"}),
+        test::createAqueousSpecies("HCO3-(aq)").withTags({"carbon", "charged"}),
+        test::createAqueousSpecies("Na+(aq)").withTags({"charged"}),
+    });
+
+    CHECK( tagged.speciesWithAggregateState(AggregateState::Aqueous, symbols, {}).size() == 3 );
+    CHECK( tagged.speciesWithAggregateState(AggregateState::Aqueous, symbols, {"carbon"}).size() == 1 );
+    CHECK( tagged.speciesWithAggregateState(AggregateState::Aqueous, symbols, {"carbon", "neutral"}).size() == 2 ); // only species with all given tags are excluded
+    CHECK( tagged.speciesWithAggregateState(AggregateState::Aqueous, symbols, {"inexistent"}).size() == 3 );
+    CHECK( tagged.speciesWithAggregateState(AggregateState::Aqueous, {"Na"}, {"carbon"}).size() == 1 ); // Na+(aq) is composed of Na only and is not tagged with carbon
+
     //-------------------------------------------------------------------------
     // TESTING METHOD: Database::element
     //-------------------------------------------------------------------------
@@ -232,6 +260,15 @@ TEST_CASE("Testing Database class", "[Database]")
     CHECK_NOTHROW( db.species().index("Mg(s)") );
     CHECK_NOTHROW( db.species().index("Al(s)") );
 
+    // Check the hashed lookups of species by name, and by name and aggregate state, after the database is extended
+    CHECK( db.species("H2O(aq)!").name() == "H2O(aq)!" );
+    CHECK( db.species("CaCO3(aq)").name() == "CaCO3(aq)" );
+    CHECK( db.species("Fe(OH)2").aggregateState() == AggregateState::Aqueous ); // the first species with this name
+    CHECK( db.findSpecies("Fe(OH)2", AggregateState::Solid).has_value() );
+    CHECK( db.findSpecies("Fe(OH)2", AggregateState::Solid)->aggregateState() == AggregateState::Solid );
+    CHECK( db.findSpecies("Mg(s)", AggregateState::Aqueous).has_value() == false );
+    CHECK_THROWS( db.species("Unknown") );
+
     //-------------------------------------------------------------------------
     // TESTING METHOD: Database::clear
     //-------------------------------------------------------------------------
@@ -260,6 +297,19 @@ TEST_CASE("Testing Database class", "[Database]")
 
     check_same_contents_in_databases(db, new_db1);
     check_same_contents_in_databases(db, new_db2);
+
+    //-------------------------------------------------------------------------
+    // TESTING COPY SEMANTICS: copies share data until modified
+    //-------------------------------------------------------------------------
+    Database copy = new_db1;
+
+    CHECK( &copy.species() == &new_db1.species() );
+
+    copy.addSpecies(Species("H2O(aq)"));
+
+    CHECK( &copy.species() != &new_db1.species() );
+    CHECK( copy.species().size() == new_db1.species().size() + 1 );
+    CHECK( new_db1.species().findWithName("H2O(aq)") == new_db1.species().size() );
 }
 
 TEST_CASE("Testing Database object creation using Database::fromContents using YAML", "[Database]")
@@ -323,3 +373,93 @@ TEST_CASE("Testing Database object creation using Database::fromContents using J
     CHECK(db.species()[0].name() == "Akermanite");
     CHECK(db.species()[0].formula() == "Ca2MgSi2O7");
 }
+
+TEST_CASE("Testing lazy Database object creation using Database::fromContentsLazy", "[Database]")
+{
+    String contents = R"#(
+        Species:
+          H2O(aq):
+            Formula: H2O
+            Elements: 2:H 1:O
+            AggregateState: Aqueous
+            StandardThermoModel:
+              Constant:
+                G0: -237181.0
+          H+:
+            Formula: H+
+            Elements: 1:H
+            Charge: 1.0
+            AggregateState: Aqueous
+            StandardThermoModel:
+              Constant:
+                G0: 0.0
+          OH-:
+            Formula: OH-
+            Elements: 1:O 1:H
+            Charge: -1.0
+            AggregateState: Aqueous
+            FormationReaction:
+              Reactants: 1:H2O(aq) -1:H+
+              ReactionStandardThermoModel:
+                ConstLgK:
+                  lgKr: -14.0
+          Quartz:
+            Formula: SiO2
+            Elements: 1:Si 2:O
+            AggregateState: Solid
+            StandardThermoModel:
+              Constant:
+                G0: -856288.0
+          Calcite:
+            Formula: CaCO3
+            Elements: 1:Ca 1:C 3:O
+            AggregateState: Solid
+            StandardThermoModel:
+              Constant:
+                G0: -1129176.0
+          Unchecked:
+            Elements: 1:Ca
+            AggregateState: Solid
+        )#";
+
+    CHECK_THROWS( Database::fromContents(contents) ); // species Unchecked has neither Formula nor a thermodynamic model
+
+    Database db = Database::fromContentsLazy(contents); // the attributes of species Unchecked are only checked when it is created
+
+    CHECK( db.elements().size() == 5 );
+    CHECK( db.speciesCreated().size() == 0 );
+
+    CHECK( db.species("OH-").name() == "OH-" );
+    CHECK( db.species("OH-").reaction().reactants().size() == 2 );
+
+    auto const& quartz = db.species("Quartz");
+
+    CHECK( db.findSpecies("Calcite", AggregateState::Solid).has_value() );
+    CHECK( db.findSpecies("Calcite", AggregateState::Aqueous).has_value() == false );
+    CHECK( db.findSpecies("Dolomite", AggregateState::Solid).has_value() == false );
+
+    CHECK( &quartz == &db.species("Quartz") ); // references to species remain valid as other species are created
+
+    auto const aqueous = db.speciesWithAggregateState(AggregateState::Aqueous, {"H", "O"});
+
+    CHECK( aqueous.size() == 3 );
+    CHECK( aqueous[0].name() == "H2O(aq)" ); // species are selected in the order they appear in the database
+    CHECK( aqueous[1].name() == "H+" );
+    CHECK( aqueous[2].name() == "OH-" );
+
+    CHECK( db.speciesWithAggregateState(AggregateState::Solid, {"Si", "O"}).size() == 1 );
+
+    CHECK( db.reaction("H2O(aq) = H+ + OH-").equation().size() == 3 );
+
+    CHECK( db.speciesCreated().size() == 5 ); // species Unchecked is not created
+
+    Database copy = db;
+    copy.attachData(String("Lazy"));
+
+    CHECK( copy.species("H2O(aq)").name() == "H2O(aq)" );
+    CHECK_THROWS( copy.species("Unchecked") );
+    CHECK_THROWS( db.species() );
+
+    copy = Database::fromContentsLazy(contents);
+    CHECK_THROWS( copy.addSpecies(Species("CO2(aq)")) ); // all species are created before the database is modified
+}
@@ -37,6 +37,7 @@ ElementList::ElementList(const Vec<Element>& elements)
 
 auto ElementList::append(const Element& element) -> void
 {
+    resetLookupTables();
     m_elements.push_back(element);
 }
 
@@ -67,12 +68,12 @@ auto ElementList::find(const String& symbol) const -> Index
 
 auto ElementList::findWithSymbol(const String& symbol) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.symbol() == symbol));
+    return m_symbols.find(symbol, m_elements, RKT_LAMBDA(e, e.symbol()));
 }
 
 auto ElementList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.name() == name));
+    return m_names.find(name, m_elements, RKT_LAMBDA(e, e.name()));
 }
 
 auto ElementList::index(const String& symbol) const -> Index
@@ -141,6 +142,7 @@ auto ElementList::withoutTags(const StringList& tags) const -> ElementList
 
 ElementList::operator Vec<Element>&()
 {
+    resetLookupTables();
     return m_elements;
 }
 
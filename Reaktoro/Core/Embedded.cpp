@@ -17,12 +17,89 @@
 
 #include "Embedded.hpp"
 
+// C++ includes
+#include <mutex>
+
 // CMakeRC includes
 #include <cmrc/cmrc.hpp>
 
+#if REAKTORO_EMBEDDED_COMPRESSED
+// zlib includes
+#include <zlib.h>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#endif
+
 CMRC_DECLARE(ReaktoroEmbedded);
 
 namespace Reaktoro {
+namespace {
+
+#if REAKTORO_EMBEDDED_COMPRESSED
+
+/// Return the decompressed contents of a gzip stream.
+auto decompress(String const& path, Chars begin, Chars end) -> String
+{
+    const auto size = static_cast<Index>(end - begin);
+
+    // The last four bytes of a gzip stream store the size of the uncompressed data (modulo 2^32)
+    const auto usize = size >= 4 ? (
+        Index(static_cast<unsigned char>(end[-4]))       |
+        Index(static_cast<unsigned char>(end[-3])) << 8  |
+        Index(static_cast<unsigned char>(end[-2])) << 16 |
+        Index(static_cast<unsigned char>(end[-1])) << 24) : 0;
+
+    String result;
+    result.reserve(usize);
+
+    z_stream stream = {};
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(begin));
+    stream.avail_in = static_cast<uInt>(size);
+
+    errorif(inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK, "Could not initialize the decompression of embedded file `", path, "`.");
+
+    char buffer[16384];
+    auto status = Z_OK;
+    while(status != Z_STREAM_END)
+    {
+        stream.next_out = reinterpret_cast<Bytef*>(buffer);
+        stream.avail_out = sizeof(buffer);
+        status = inflate(&stream, Z_NO_FLUSH);
+        if(status != Z_OK && status != Z_STREAM_END)
+        {
+            inflateEnd(&stream);
+            errorif(true, "Could not decompress embedded file `", path, "` (zlib error code ", status, ").");
+        }
+        result.append(buffer, sizeof(buffer) - stream.avail_out);
+    }
+
+    inflateEnd(&stream);
+
+    return result;
+}
+
+/// Return the decompressed contents of an embedded file, which are cached on first access and shared afterwards.
+auto getDecompressed(String const& path) -> String const&
+{
+    static Map<String, String> cache;
+    static std::mutex mutex;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = cache.find(path);
+    if(it != cache.end())
+        return it->second;
+
+    auto fs = cmrc::ReaktoroEmbedded::get_filesystem();
+    auto file = fs.open("embedded/" + path);
+
+    return cache.emplace(path, decompress(path, file.begin(), file.end())).first->second; // elements in an unordered map do not move on insertions, so references to them remain valid
+}
+
+#endif
+
+} // namespace
 
 auto Embedded::get(String const& path) -> String
 {
@@ -37,9 +114,14 @@ auto Embedded::getAsString(String const& path) -> String
 
 auto Embedded::getAsStringView(String const& path) -> Pair<Chars, Chars>
 {
+#if REAKTORO_EMBEDDED_COMPRESSED
+    String const& contents = getDecompressed(path);
+    return { contents.data(), contents.data() + contents.size() };
+#else
     auto fs = cmrc::ReaktoroEmbedded::get_filesystem();
     auto file = fs.open("embedded/" + path);
     return { file.begin(), file.end() };
+#endif
 }
 
 } // namespace Reaktoro
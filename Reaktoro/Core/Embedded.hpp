@@ -23,6 +23,9 @@
 namespace Reaktoro {
 
 /// Used to retrieve embedded resources (e.g., database files, parameter files) in Reaktoro.
+/// When Reaktoro is built with `REAKTORO_COMPRESS_EMBEDDED` enabled, the
+/// embedded resources are stored compressed in the library. Each one is then
+/// decompressed on its first access and kept in a cache shared by all threads.
 class Embedded
 {
 public:
@@ -33,6 +36,7 @@ public:
     static auto getAsString(String const& path) -> String;
 
     /// Return the contents of the embedded document with given path (as a string view).
+    /// The returned pointers remain valid until the end of the program.
     static auto getAsStringView(String const& path) -> Pair<Chars, Chars>;
 
     /// Deleted default constructor.
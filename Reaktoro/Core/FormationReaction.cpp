@@ -64,7 +64,10 @@ struct FormationReaction::Impl
 
         auto calcfn = [=](real T, real P) mutable -> StandardThermoProps
         {
-            // Precompute the standard thermo properties of each reactant species
+            // Precompute the standard thermo properties of each reactant species.
+            // These are memoized in the reactant species, whose caches are shared
+            // with their copies in the database and chemical system, so a reactant
+            // common to several formation reactions is evaluated once per (T, P).
             for(auto i = 0; i < num_reactants; ++i)
             {
                 const auto& reactant = reactants[i].first;
@@ -182,3 +182,43 @@ TEST_CASE("Testing FormationReaction class", "[FormationReaction]")
     REQUIRE( Cp0(D.reaction(), T, P)  == Approx(Cp0_D) );
     REQUIRE( Cp0(E.reaction(), T, P)  == Approx(Cp0_E) );
 }
+
+TEST_CASE("Testing FormationReaction evaluates each reactant once per temperature and pressure", "[FormationReaction]")
+{
+    // FORMATION REACTIONS CONSIDERED IN THE TEST BELOW, IN WHICH A IS A REACTANT OF C, AND INDIRECTLY OF D AND E
+    //    A + B = C
+    //    A + C = D
+    //    C + D = E
+
+    auto count = 0;
+
+    const auto A = Species()
+        .withName("A")
+        .withStandardThermoModel([&](real T, real P) { ++count; StandardThermoProps props; props.G0 = 1.0; return props; });
+
+    const auto B = Species()
+        .withName("B")
+        .withStandardGibbsEnergy(2.0);
+
+    const auto C = Species()
+        .withName("C")
+        .withFormationReaction(FormationReaction().withReactants({{A, 1}, {B, 1}}).withEquilibriumConstant(0.0));
+
+    const auto D = Species()
+        .withName("D")
+        .withFormationReaction(FormationReaction().withReactants({{A, 1}, {C, 1}}).withEquilibriumConstant(0.0));
+
+    const auto E = Species()
+        .withName("E")
+        .withFormationReaction(FormationReaction().withReactants({{C, 1}, {D, 1}}).withEquilibriumConstant(0.0));
+
+    // The copies of A among the reactants of C, D and E share the memoized evaluation of A
+    CHECK( E.standardThermoProps(300.0, 1.0e5).G0 == Approx(3.0 + 4.0) );
+    CHECK( D.standardThermoProps(300.0, 1.0e5).G0 == Approx(4.0) );
+    CHECK( C.standardThermoProps(300.0, 1.0e5).G0 == Approx(3.0) );
+    CHECK( A.standardThermoProps(300.0, 1.0e5).G0 == Approx(1.0) );
+    CHECK( count == 1 );
+
+    CHECK( E.standardThermoProps(350.0, 1.0e5).G0 == Approx(3.0 + 4.0) );
+    CHECK( count == 2 );
+}
@@ -24,6 +24,7 @@
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Param.hpp>
+#include <Reaktoro/Core/ParamArena.hpp>
 
 namespace Reaktoro {
 
@@ -113,11 +114,43 @@ public:
     {}
 
     /// Return a new Model function object with memoization for the model calculator.
-    auto withMemoization() const -> Model
+    /// The values of the parameters of the model are moved into a ParamArena
+    /// object, so that checking if they have changed since the last call is
+    /// done over a contiguous block of memory.
+    /// @param capacity The number of distinct sets of arguments whose results are cached (the least recently used is discarded first).
+    auto withMemoization(std::size_t capacity = 1) const -> Model
     {
         Model copy = *this;
-        copy.m_evalfn = memoizeLastUsingRef<Result>(copy.m_evalfn); // Here, if `m_evalfn` did not consider `const Vec<Param>&` as argument, memoization would not know when the parameters have been changed externally!
-        copy.m_calcfn = memoizeLast(copy.m_calcfn); // Here, if `m_calcfn` did not consider `const Vec<Param>&` as argument, memoization would not know when the parameters have been changed externally!
+        // Here, if `m_evalfn` and `m_calcfn` did not consider the parameters as argument, memoization would not know when the parameters have been changed externally!
+        const ParamArena arena(copy.m_params);
+        const auto evalfn = copy.m_evalfn;
+        const auto calcfn = copy.m_calcfn;
+        Fn<void(ResultRef, const ParamArena&, const Args&...)> evalfnarena = [evalfn](ResultRef res, const ParamArena& w, const Args&... args)
+        {
+            evalfn(res, w.params(), args...);
+        };
+        Fn<Result(const ParamArena&, const Args&...)> calcfnarena = [calcfn](const ParamArena& w, const Args&... args) -> Result
+        {
+            return calcfn(w.params(), args...);
+        };
+        if(capacity <= 1)
+        {
+            evalfnarena = memoizeLastUsingRef<Result>(evalfnarena);
+            calcfnarena = memoizeLast(calcfnarena);
+        }
+        else
+        {
+            evalfnarena = memoizeLRUUsingRef<Result>(evalfnarena, capacity);
+            calcfnarena = memoizeLRU(calcfnarena, capacity);
+        }
+        copy.m_evalfn = [evalfnarena, arena](ResultRef res, const Vec<Param>& w, const Args&... args)
+        {
+            evalfnarena(res, arena, args...); // the parameters in `w` are those in `arena`
+        };
+        copy.m_calcfn = [calcfnarena, arena](const Vec<Param>& w, const Args&... args) -> Result
+        {
+            return calcfnarena(arena, args...);
+        };
         return copy;
     }
 
@@ -241,14 +274,15 @@ auto chain(const Vec<Model<Result(Args...)>>& models) -> Model<Result(Args...)>
     auto evalfn = [=](ResultRef res, const Args&... args)
     {
         for(auto i = 0; i < evalfns.size(); ++i)
-            evalfns[i](res, args..., paramsvec[i]);
+            evalfns[i](res, paramsvec[i], args...);
     };
 
     auto serializerfn = [serializerfns]() -> Data
     {
         Data result;
         for(auto i = 0; i < serializerfns.size(); ++i)
-            result.add(serializerfns[i]());
+            if(serializerfns[i])
+                result.add(serializerfns[i]());
         return result;
     };
 
@@ -257,7 +291,7 @@ auto chain(const Vec<Model<Result(Args...)>>& models) -> Model<Result(Args...)>
         for(const auto& param : model.params())
             params.push_back(param);
 
-    return Model<Result(Args...)>(evalfn, params);
+    return Model<Result(Args...)>(evalfn, params, serializerfn);
 }
 
 /// Return a reaction thermodynamic model resulting from chaining other models.
@@ -56,6 +56,35 @@ TEST_CASE("Testing Model class", "[Model]")
         CHECK( model(x, y) == Approx(5.0 * x * y) );
     }
 
+    SECTION("Using memoization with many cached arguments")
+    {
+        int counter = 0;
+
+        auto calcfn = [=, &counter](real x, real y)
+        {
+            ++counter;
+            return K*x*y;
+        };
+
+        Model<real(real, real)> model = Model<real(real, real)>(calcfn, params).withMemoization(2);
+
+        real res = 0.0;
+
+        for(auto i = 0; i < 3; ++i)
+        {
+            CHECK( model(3.0, 7.0) == Approx(3.0 * 3.0 * 7.0) );
+            model.apply(res, 2.0, 5.0);
+            CHECK( res == Approx(3.0 * 2.0 * 5.0) );
+        }
+
+        CHECK( counter == 2 ); // once for each distinct pair of arguments, in model(x, y) and model.apply(res, x, y)
+
+        K = 5.0;
+
+        CHECK( model(3.0, 7.0) == Approx(5.0 * 3.0 * 7.0) ); // a change in the parameters is detected
+        CHECK( counter == 3 );
+    }
+
     SECTION("Using ModelCalculator")
     {
         auto calcfn = [=](real x, real y)
@@ -133,4 +162,35 @@ TEST_CASE("Testing Model class", "[Model]")
 
         CHECK( model(x, y) == Approx(5.0) );
     }
+
+    SECTION("Using chain")
+    {
+        Param L = 2.0;
+
+        auto evalfn1 = [=](real& res, real x, real y) { res = K*x; };
+        auto evalfn2 = [=](real& res, real x, real y) { res += L*y; };
+
+        auto chained = chain(Model<real(real, real)>(evalfn1, { K }), Model<real(real, real)>(evalfn2, { L }));
+
+        CHECK( chained.params().size() == 2 );
+
+        const auto x = 3.0;
+        const auto y = 7.0;
+
+        CHECK( chained(x, y) == Approx(3.0*x + 2.0*y) );
+
+        real res = 0.0;
+        chained(res, x, y);
+
+        CHECK( res == Approx(3.0*x + 2.0*y) );
+
+        auto memoized = chained.withMemoization();
+
+        CHECK( memoized(x, y) == Approx(3.0*x + 2.0*y) );
+
+        L = 4.0;
+
+        CHECK( memoized(x, y) == Approx(3.0*x + 4.0*y) );
+        CHECK( chained(x, y) == Approx(3.0*x + 4.0*y) );
+    }
 }
@@ -50,6 +50,18 @@ struct Param::Impl
 
     /// The boolean flag that indicates if this parameter is constant.
     bool isconst = false;
+
+    /// The location of the parameter value in the contiguous storage of a ParamArena object (null if the value is stored in #value).
+    real* ptr = nullptr;
+
+    /// The contiguous storage of the ParamArena object in which the parameter value is stored (kept alive while the parameter exists).
+    SharedPtr<Vec<real>> storage;
+
+    /// Return the parameter value, wherever it is stored.
+    auto val() -> real&
+    {
+        return ptr ? *ptr : value;
+    }
 };
 
 Param::Param()
@@ -72,30 +84,39 @@ auto Param::clone() const -> Param
 {
     Param param;
     *param.pimpl = *pimpl;
+    param.pimpl->value = pimpl->val(); // the clone stores its own value, not in the ParamArena object of this parameter, if any
+    param.pimpl->ptr = nullptr;
+    param.pimpl->storage = nullptr;
     return param;
 }
 
 auto Param::assign(const Param& other) -> Param&
 {
+    auto ptr = pimpl->ptr; // keep the value of this parameter where it is currently stored
+    auto storage = pimpl->storage;
+    const real val = other.pimpl->val();
     *pimpl = *other.pimpl;
+    pimpl->ptr = ptr;
+    pimpl->storage = storage;
+    pimpl->val() = val;
     return *this;
 }
 
 auto Param::value(const real& val) -> Param&
 {
     warningIfOutOfBounds(*this, val);
-    pimpl->value = val;
+    pimpl->val() = val;
     return *this;
 }
 
 auto Param::value() const -> const real&
 {
-    return pimpl->value;
+    return pimpl->val();
 }
 
 auto Param::value() -> real&
 {
-    return pimpl->value;
+    return pimpl->val();
 }
 
 auto Param::id(String id) -> Param&
@@ -154,17 +175,29 @@ auto Param::operator=(const real& val) -> Param&
 
 Param::operator const real&() const
 {
-    return pimpl->value;
+    return pimpl->val();
 }
 
 Param::operator real&()
 {
-    return pimpl->value;
+    return pimpl->val();
 }
 
 Param::operator double() const
 {
-    return pimpl->value;
+    return pimpl->val();
+}
+
+auto Param::arenaptr() const -> real*
+{
+    return pimpl->ptr;
+}
+
+auto Param::arenabind(real* ptr, SharedPtr<Vec<real>> const& storage) -> void
+{
+    *ptr = pimpl->val();
+    pimpl->ptr = ptr;
+    pimpl->storage = storage;
 }
 
 auto Param::Constant(const real& val) -> Param
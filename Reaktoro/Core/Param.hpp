@@ -104,6 +104,14 @@ private:
     struct Impl;
 
     SharedPtr<Impl> pimpl;
+
+    /// Return the location of the value of this parameter in the storage of a ParamArena object (null if not stored in one).
+    auto arenaptr() const -> real*;
+
+    /// Move the value of this parameter into given location in the storage of a ParamArena object.
+    auto arenabind(real* ptr, SharedPtr<Vec<real>> const& storage) -> void;
+
+    friend class ParamArena;
 };
 
 } // namespace Reaktoro
@@ -179,6 +187,33 @@ struct MemoizationTraits<Param>
     using CacheType = real;
 };
 
+/// Specialize MemoizationTraits for Vec<Param>.
+/// The values of the parameters are cached, instead of the Param objects,
+/// which share their values with the original ones. Otherwise, a change in
+/// the value of a parameter would not be detected by a memoized function.
+template<>
+struct MemoizationTraits<Vec<Param>>
+{
+    using CacheType = Vec<real>;
+
+    static auto equal(const Vec<real>& a, const Vec<Param>& b)
+    {
+        if(a.size() != b.size())
+            return false;
+        for(auto i = 0; i < a.size(); ++i)
+            if(a[i] != b[i].value())
+                return false;
+        return true;
+    }
+
+    static auto assign(Vec<real>& a, const Vec<Param>& b)
+    {
+        a.resize(b.size());
+        for(auto i = 0; i < b.size(); ++i)
+            a[i] = b[i].value();
+    }
+};
+
 } // namespace Reaktoro
 
 //======================================================================
@@ -0,0 +1,64 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ParamArena.hpp"
+
+namespace Reaktoro {
+
+ParamArena::ParamArena()
+: m_storage(std::make_shared<Vec<real>>())
+{}
+
+ParamArena::ParamArena(Vec<Param> const& params)
+: m_params(params)
+{
+    Index count = 0;
+    for(auto const& param : params)
+        count += param.arenaptr() == nullptr;
+
+    m_storage = std::make_shared<Vec<real>>(count); // the storage is never resized, so that pointers to its entries remain valid
+
+    m_ptrs.reserve(params.size());
+
+    Index k = 0;
+    for(auto& param : m_params)
+    {
+        if(param.arenaptr() == nullptr)
+            param.arenabind(&(*m_storage)[k++], m_storage);
+        m_ptrs.push_back(param.arenaptr());
+    }
+}
+
+auto ParamArena::size() const -> Index
+{
+    return m_ptrs.size();
+}
+
+auto ParamArena::params() const -> Vec<Param> const&
+{
+    return m_params;
+}
+
+auto ParamArena::values() const -> Vec<real>
+{
+    Vec<real> res(m_ptrs.size());
+    for(auto i = 0; i < m_ptrs.size(); ++i)
+        res[i] = *m_ptrs[i];
+    return res;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,106 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Core/Param.hpp>
+
+namespace Reaktoro {
+
+/// Used to store the values of a collection of Param objects contiguously in memory.
+/// When a ParamArena object is constructed, the values of the given
+/// parameters are moved into a single contiguous block of memory, which is
+/// then read by models in their evaluations instead of each parameter value
+/// being reached through its own pointer. The Param objects remain valid and
+/// changes in their values (e.g., in a parameter fitting calculation) are
+/// seen by the ParamArena object. A parameter whose value is already stored
+/// in another ParamArena object is not moved, and its value is read from
+/// there instead. Copies of a ParamArena object share the same storage.
+class ParamArena
+{
+public:
+    /// Construct a default ParamArena object.
+    ParamArena();
+
+    /// Construct a ParamArena object with given parameters.
+    explicit ParamArena(Vec<Param> const& params);
+
+    /// Return the number of parameters in the arena.
+    auto size() const -> Index;
+
+    /// Return the parameters in the arena.
+    auto params() const -> Vec<Param> const&;
+
+    /// Return the current values of the parameters in the arena.
+    auto values() const -> Vec<real>;
+
+    /// Return the value of the `i`-th parameter in the arena.
+    auto operator[](Index i) const -> real const&
+    {
+        return *m_ptrs[i];
+    }
+
+private:
+    /// The parameters in the arena.
+    Vec<Param> m_params;
+
+    /// The contiguous storage of the parameter values.
+    SharedPtr<Vec<real>> m_storage;
+
+    /// The locations of the parameter values (in #m_storage, unless stored in another ParamArena object).
+    Vec<real*> m_ptrs;
+};
+
+} // namespace Reaktoro
+
+//======================================================================
+// CODE BELOW NEEDED FOR MEMOIZATION TECHNIQUE INVOLVING PARAMARENA
+//======================================================================
+
+namespace Reaktoro {
+
+template<typename T>
+struct MemoizationTraits;
+
+/// Specialize MemoizationTraits for ParamArena.
+/// The values of the parameters are cached and compared, instead of the
+/// ParamArena object, which shares its storage with the original one.
+template<>
+struct MemoizationTraits<ParamArena>
+{
+    using CacheType = Vec<real>;
+
+    static auto equal(const Vec<real>& a, const ParamArena& b)
+    {
+        if(a.size() != b.size())
+            return false;
+        for(auto i = 0; i < a.size(); ++i)
+            if(a[i] != b[i])
+                return false;
+        return true;
+    }
+
+    static auto assign(Vec<real>& a, const ParamArena& b)
+    {
+        a.resize(b.size());
+        for(auto i = 0; i < b.size(); ++i)
+            a[i] = b[i];
+    }
+};
+
+} // namespace Reaktoro
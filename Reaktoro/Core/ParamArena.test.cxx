@@ -0,0 +1,92 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ParamArena.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ParamArena class", "[ParamArena]")
+{
+    Param a("a", 1.0);
+    Param b("b", 2.0);
+    Param c("c", 3.0);
+
+    ParamArena arena({ a, b, c });
+
+    REQUIRE( arena.size() == 3 );
+
+    CHECK( arena[0] == 1.0 );
+    CHECK( arena[1] == 2.0 );
+    CHECK( arena[2] == 3.0 );
+
+    CHECK( &arena[1] == &arena[0] + 1 ); // the values are stored contiguously
+    CHECK( &arena[2] == &arena[0] + 2 );
+
+    CHECK( arena.params()[0].id() == "a" );
+
+    //-------------------------------------------------------------------------
+    // TESTING THAT CHANGES IN THE PARAM OBJECTS ARE SEEN BY THE ARENA
+    //-------------------------------------------------------------------------
+    a = 10.0;
+    b.value(20.0);
+    c.assign(Param("c", 30.0));
+
+    CHECK( arena[0] == 10.0 );
+    CHECK( arena[1] == 20.0 );
+    CHECK( arena[2] == 30.0 );
+
+    CHECK( arena.values() == Vec<real>{ 10.0, 20.0, 30.0 } );
+
+    //-------------------------------------------------------------------------
+    // TESTING THAT CLONES OF THE PARAM OBJECTS ARE NOT IN THE ARENA
+    //-------------------------------------------------------------------------
+    Param aclone = a.clone();
+
+    aclone = 100.0;
+
+    CHECK( a.value() == 10.0 );
+    CHECK( arena[0] == 10.0 );
+
+    //-------------------------------------------------------------------------
+    // TESTING THAT PARAM OBJECTS ALREADY IN AN ARENA ARE SHARED WITH ANOTHER
+    //-------------------------------------------------------------------------
+    Param d("d", 4.0);
+
+    ParamArena another({ d, a });
+
+    CHECK( &another[1] == &arena[0] ); // the value of `a` remains in `arena`
+
+    a = 5.0;
+
+    CHECK( arena[0] == 5.0 );
+    CHECK( another[1] == 5.0 );
+    CHECK( another[0] == 4.0 );
+
+    //-------------------------------------------------------------------------
+    // TESTING THAT PARAM OBJECTS OUTLIVE THEIR ARENA
+    //-------------------------------------------------------------------------
+    Param e("e", 6.0);
+
+    { ParamArena temporary({ e }); }
+
+    e = 7.0;
+
+    CHECK( e.value() == 7.0 );
+}
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <fstream>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
@@ -41,6 +42,27 @@ auto createDataFromYamlOrJson(String const& path, Text&& text) -> Data
     return {};
 }
 
+/// Return the binary image of the Data object parsed from an embedded parameter file, which is parsed on first access and shared afterwards.
+/// The binary image is cached instead of the Data object itself because Param objects share their values
+/// on copy. Every Params object created from the cache must own its own Param objects so that changing
+/// parameters in one of them (e.g., during a parameter fitting) does not affect the others.
+auto getEmbeddedParamsBinary(String const& path) -> String const&
+{
+    static Map<String, String> cache;
+    static std::mutex mutex;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = cache.find(path);
+    if(it != cache.end())
+        return it->second;
+
+    const auto [begin, end] = Embedded::getAsStringView("params/" + path);
+    const auto data = createDataFromYamlOrJson(path, String(begin, end));
+
+    return cache.emplace(path, data.dumpBinary()).first->second; // elements in an unordered map do not move on insertions, so references to them remain valid
+}
+
 } // namespace
 
 Params::Params()
@@ -53,8 +75,7 @@ Params::Params(Data const& params)
 
 auto Params::embedded(String const& path) -> Params
 {
-    const String text = Embedded::get("params/" + path);
-    return Params(createDataFromYamlOrJson(path, text));
+    return Params(Data::parseBinary(getEmbeddedParamsBinary(path)));
 }
 
 auto Params::local(String const& path) -> Params
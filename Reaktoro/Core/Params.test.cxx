@@ -91,4 +91,21 @@ TEST_CASE("Testing Params class", "[Params]")
         CHECK( data.at("ReactionRateModelParams").exists("PalandriKharaka") );
         CHECK( data.at("ReactionRateModelParams").at("PalandriKharaka").exists("Albite") );
     }
+
+    SECTION("Check embedded resources parsed once produce independent Params objects")
+    {
+        Params params1 = Params::embedded("PalandriKharaka.yaml");
+        Params params2 = Params::embedded("PalandriKharaka.yaml");
+
+        Param lgk1 = params1["ReactionRateModelParams"]["PalandriKharaka"]["Quartz"]["Mechanisms"]["Neutral"]["lgk"].asParam();
+        Param lgk2 = params2["ReactionRateModelParams"]["PalandriKharaka"]["Quartz"]["Mechanisms"]["Neutral"]["lgk"].asParam();
+
+        CHECK( lgk1.value() == -13.99 );
+        CHECK( lgk2.value() == -13.99 );
+
+        lgk1.value(1.23); // changing a parameter in params1 should not affect params2
+
+        CHECK( params1["ReactionRateModelParams"]["PalandriKharaka"]["Quartz"]["Mechanisms"]["Neutral"]["lgk"].asFloat() == 1.23 );
+        CHECK( params2["ReactionRateModelParams"]["PalandriKharaka"]["Quartz"]["Mechanisms"]["Neutral"]["lgk"].asFloat() == -13.99 );
+    }
 }
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
@@ -36,6 +37,43 @@ auto ensureCommonAggregateState(const SpeciesList& species)
             "aggregate state ", aggregatestate, " while ", s.name(), " has aggregate state ", s.aggregateState(), ".");
 }
 
+/// Return true if the activity model of a phase with given species is trivial (i.e., single species with unit activity and no activity corrections).
+/// The model is probed at two temperature and pressure conditions with unit mole fraction. It
+/// is considered trivial only if it has no parameters (which could change its results later),
+/// produces zero for all corrective properties and ln activity/activity coefficient, stores no
+/// extra data, and reports the given state of matter of the phase.
+auto isTrivialActivityModel(const SpeciesList& species, StateOfMatter state, const ActivityModel& model) -> bool
+{
+    if(species.size() != 1 || !model.initialized() || !model.params().empty() || state == StateOfMatter::Unspecified)
+        return false;
+
+    const ArrayXr x = ArrayXr::Ones(1);
+    const real Ts[] = { 298.15, 373.15 };
+    const real Ps[] = { 1.0e+5, 1.0e+7 };
+
+    try
+    {
+        for(auto i = 0; i < 2; ++i)
+        {
+            ActivityProps props = ActivityProps::create(1);
+            props = NaN;
+            props.som = StateOfMatter::Unspecified;
+            model(props, { Ts[i], Ps[i], x, 0 });
+            if(props.som != state || !props.extra.empty())
+                return false;
+            for(auto value : { props.Vx, props.VxT, props.VxP, props.Gx, props.Hx, props.Cpx, props.Vxi[0], props.ln_g[0], props.ln_a[0] })
+                if(value != 0.0) // also false for NaN values not set by the model
+                    return false;
+        }
+    }
+    catch(...)
+    {
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace detail
 
 struct Phase::Impl
@@ -58,8 +96,27 @@ struct Phase::Impl
     /// The ideal activity model function of the phase.
     ActivityModel ideal_activity_model;
 
+    /// The function for the analytic derivatives of the activity model of the phase (empty if not available).
+    ActivityModelJacobian activity_model_jacobian;
+
+    /// The function for the analytic derivatives of the ideal activity model of the phase (empty if not available).
+    ActivityModelJacobian ideal_activity_model_jacobian;
+
     /// The molar masses of the species in the phase.
     ArrayXd species_molar_masses;
+
+    /// The flag indicating if the activity model of the phase is trivial (single species with unit activity).
+    bool trivial_activity_model = false;
+
+    /// The flag indicating if the ideal activity model of the phase is trivial (single species with unit activity).
+    bool trivial_ideal_activity_model = false;
+
+    /// Classify the activity models of the phase as trivial or not after a change in its species, state of matter or activity models.
+    auto classifyActivityModels() -> void
+    {
+        trivial_activity_model = detail::isTrivialActivityModel(species, state, activity_model);
+        trivial_ideal_activity_model = detail::isTrivialActivityModel(species, state, ideal_activity_model);
+    }
 };
 
 Phase::Phase()
@@ -87,6 +144,7 @@ auto Phase::withSpecies(SpeciesList species) -> Phase
     copy.pimpl->elements = species.elements();
     copy.pimpl->species = std::move(species);
     copy.pimpl->species_molar_masses = detail::molarMasses(copy.pimpl->species);
+    copy.pimpl->classifyActivityModels();
     return copy;
 }
 
@@ -94,6 +152,7 @@ auto Phase::withStateOfMatter(StateOfMatter state) -> Phase
 {
     Phase copy = clone();
     copy.pimpl->state = std::move(state);
+    copy.pimpl->classifyActivityModels();
     return copy;
 }
 
@@ -101,6 +160,8 @@ auto Phase::withActivityModel(const ActivityModel& model) -> Phase
 {
     Phase copy = clone();
     copy.pimpl->activity_model = model.withMemoization();
+    copy.pimpl->activity_model_jacobian = {}; // the analytic derivatives of a previous activity model no longer apply
+    copy.pimpl->classifyActivityModels();
     return copy;
 }
 
@@ -108,6 +169,22 @@ auto Phase::withIdealActivityModel(const ActivityModel& model) -> Phase
 {
     Phase copy = clone();
     copy.pimpl->ideal_activity_model = model.withMemoization();
+    copy.pimpl->ideal_activity_model_jacobian = {}; // the analytic derivatives of a previous ideal activity model no longer apply
+    copy.pimpl->classifyActivityModels();
+    return copy;
+}
+
+auto Phase::withActivityModelJacobian(const ActivityModelJacobian& jacobian) -> Phase
+{
+    Phase copy = clone();
+    copy.pimpl->activity_model_jacobian = jacobian;
+    return copy;
+}
+
+auto Phase::withIdealActivityModelJacobian(const ActivityModelJacobian& jacobian) -> Phase
+{
+    Phase copy = clone();
+    copy.pimpl->ideal_activity_model_jacobian = jacobian;
     return copy;
 }
 
@@ -161,6 +238,26 @@ auto Phase::idealActivityModel() const -> const ActivityModel&
     return pimpl->ideal_activity_model;
 }
 
+auto Phase::activityModelJacobian() const -> const ActivityModelJacobian&
+{
+    return pimpl->activity_model_jacobian;
+}
+
+auto Phase::idealActivityModelJacobian() const -> const ActivityModelJacobian&
+{
+    return pimpl->ideal_activity_model_jacobian;
+}
+
+auto Phase::hasTrivialActivityModel() const -> bool
+{
+    return pimpl->trivial_activity_model;
+}
+
+auto Phase::hasTrivialIdealActivityModel() const -> bool
+{
+    return pimpl->trivial_ideal_activity_model;
+}
+
 auto operator<(const Phase& lhs, const Phase& rhs) -> bool
 {
     return lhs.name() < rhs.name();
@@ -53,6 +53,14 @@ public:
     /// Return a copy of this Phase object with a new ideal activity model function.
     auto withIdealActivityModel(const ActivityModel& model) -> Phase;
 
+    /// Return a copy of this Phase object with a new function for the analytic derivatives of its activity model.
+    /// @note This must be called after Phase::withActivityModel, which discards any previously given analytic derivatives.
+    auto withActivityModelJacobian(const ActivityModelJacobian& jacobian) -> Phase;
+
+    /// Return a copy of this Phase object with a new function for the analytic derivatives of its ideal activity model.
+    /// @note This must be called after Phase::withIdealActivityModel, which discards any previously given analytic derivatives.
+    auto withIdealActivityModelJacobian(const ActivityModelJacobian& jacobian) -> Phase;
+
     /// Return the name of the phase.
     auto name() const -> String;
 
@@ -83,6 +91,19 @@ public:
     /// Return the function that computes ideal activity properties of the phase.
     auto idealActivityModel() const -> const ActivityModel&;
 
+    /// Return the function that computes the analytic derivatives of the ln activities of the species in the phase (empty if not available).
+    auto activityModelJacobian() const -> const ActivityModelJacobian&;
+
+    /// Return the function that computes the analytic derivatives of the ideal ln activities of the species in the phase (empty if not available).
+    auto idealActivityModelJacobian() const -> const ActivityModelJacobian&;
+
+    /// Return true if the phase has a single species whose activity model always produces unit activity and no corrections (e.g., a pure mineral with an ideal model).
+    /// In this case, the chemical properties of the phase are determined by the standard thermodynamic properties of its species alone.
+    auto hasTrivialActivityModel() const -> bool;
+
+    /// Return true if the phase has a single species whose ideal activity model always produces unit activity and no corrections.
+    auto hasTrivialIdealActivityModel() const -> bool;
+
 private:
     struct Impl;
 
@@ -42,5 +42,7 @@ void exportPhase(py::module& m)
         .def("speciesMolarMasses", &Phase::speciesMolarMasses, return_internal_ref)
         .def("activityModel", &Phase::activityModel, return_internal_ref)
         .def("idealActivityModel", &Phase::idealActivityModel, return_internal_ref)
+        .def("hasTrivialActivityModel", &Phase::hasTrivialActivityModel)
+        .def("hasTrivialIdealActivityModel", &Phase::hasTrivialIdealActivityModel)
         ;
 }
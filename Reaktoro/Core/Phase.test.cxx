@@ -111,4 +111,54 @@ TEST_CASE("Testing Phase", "[Phase]")
         // Because of this mismatch in aggregate states, the above
         // Phase::withSpecies call should raise a runtime error.
     }
+
+    SECTION("Testing Phase::hasTrivialActivityModel")
+    {
+        ActivityModel ideal_solid = [](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            props.som = StateOfMatter::Solid;
+            props = 0.0;
+            props.ln_a = args.x.log();
+        };
+
+        ActivityModel ideal_gas = [](ActivityPropsRef props, ActivityModelArgs args)
+        {
+            props.som = StateOfMatter::Gas;
+            props = 0.0;
+            props.ln_a = args.x.log() + log(args.P * 1e-5);
+        };
+
+        Phase calcite = Phase()
+            .withName("Calcite")
+            .withSpecies({ Species("CaCO3(s)").withName("Calcite") })
+            .withStateOfMatter(StateOfMatter::Solid)
+            .withActivityModel(ideal_solid)
+            .withIdealActivityModel(ideal_solid);
+
+        CHECK( calcite.hasTrivialActivityModel() );
+        CHECK( calcite.hasTrivialIdealActivityModel() );
+
+        // An activity model that leaves its properties unset is never trivial
+        CHECK_FALSE( calcite.withActivityModel(activity_model).hasTrivialActivityModel() );
+        CHECK( calcite.withActivityModel(activity_model).hasTrivialIdealActivityModel() );
+
+        // A state of matter different from that reported by the activity model is not trivial
+        CHECK_FALSE( calcite.withStateOfMatter(StateOfMatter::Liquid).hasTrivialActivityModel() );
+
+        Phase co2 = Phase()
+            .withName("CO2")
+            .withSpecies({ Species("CO2(g)") })
+            .withStateOfMatter(StateOfMatter::Gas)
+            .withActivityModel(ideal_gas);
+
+        CHECK_FALSE( co2.hasTrivialActivityModel() ); // ln(a) = ln(P) is not zero
+
+        Phase solid = Phase()
+            .withName("SolidSolution")
+            .withSpecies(SpeciesList("CaCO3(s) MgCO3(s)"))
+            .withStateOfMatter(StateOfMatter::Solid)
+            .withActivityModel(ideal_solid);
+
+        CHECK_FALSE( solid.hasTrivialActivityModel() ); // more than one species
+    }
 }
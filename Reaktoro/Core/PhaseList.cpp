@@ -38,6 +38,7 @@ PhaseList::PhaseList(const Vec<Phase>& phases)
 
 auto PhaseList::append(const Phase& phase) -> void
 {
+    resetLookupTables();
     m_phases.push_back(phase);
 }
 
@@ -75,6 +76,7 @@ auto PhaseList::operator[](Index i) const -> const Phase&
 
 auto PhaseList::operator[](Index i) -> Phase&
 {
+    resetLookupTables();
     return m_phases[i];
 }
 
@@ -85,7 +87,7 @@ auto PhaseList::find(const String& name) const -> Index
 
 auto PhaseList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_phases, RKT_LAMBDA(p, p.name() == name));
+    return m_names.find(name, m_phases, RKT_LAMBDA(p, p.name()));
 }
 
 auto PhaseList::findWithSpecies(Index index) const -> Index
@@ -249,6 +251,7 @@ auto PhaseList::indicesSpeciesInPhases(const Indices& iphases) const -> Indices
 
 PhaseList::operator Vec<Phase>&()
 {
+    resetLookupTables();
     return m_phases;
 }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/LookupTable.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
@@ -137,6 +138,12 @@ private:
     /// The phases stored in the list.
     Vec<Phase> m_phases;
 
+    /// The lookup table of the phases in the list by their names.
+    LookupTable m_names;
+
+    /// Reset the lookup tables after the phases in the list may have been changed.
+    auto resetLookupTables() -> void { m_names.reset(); }
+
 public:
     /// Construct an PhaseList object with given begin and end iterators.
     template<typename InputIterator>
@@ -146,20 +153,20 @@ public:
     auto begin() const { return m_phases.begin(); }
 
     /// Return begin iterator of this PhaseList instance (for STL compatibility reasons).
-    auto begin() { return m_phases.begin(); }
+    auto begin() { resetLookupTables(); return m_phases.begin(); }
 
     /// Return end const iterator of this PhaseList instance (for STL compatibility reasons).
     auto end() const { return m_phases.end(); }
 
     /// Return end iterator of this PhaseList instance (for STL compatibility reasons).
-    auto end() { return m_phases.end(); }
+    auto end() { resetLookupTables(); return m_phases.end(); }
 
     /// Append a new Phase at the back of the container (for STL compatibility reasons).
     auto push_back(const Phase& species) -> void { append(species); }
 
     /// Insert a container of Phase objects into this PhaseList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_phases.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { resetLookupTables(); m_phases.insert(pos, begin, end); }
 
     /// The type of the value stored in a PhaseList (for STL compatibility reasons).
     using value_type = Phase;
@@ -23,6 +23,53 @@
 
 namespace Reaktoro {
 
+namespace {
+
+/// Return the species in the database with given aggregate states and names, or composed of given elements if no names are given, excluding those with all given tags.
+/// The species are selected using the indices in the Database object, so
+/// that systems can be constructed quickly even with large databases (e.g.,
+/// when a GeneralPhasesGenerator object creates a phase for each mineral).
+auto selectSpecies(Database const& db, AggregateState aggregatestate, Vec<AggregateState> const& other_aggregate_states, Strings const& names, Strings const& symbols, Strings const& excludetags) -> SpeciesList
+{
+    if(names.size())
+    {
+        Vec<Species> selected;
+        selected.reserve(names.size());
+        for(auto const& name : names)
+        {
+            auto found = false;
+            auto select = [&](AggregateState option)
+            {
+                auto const species = db.findSpecies(name, option); // in a lazy database, only this species is created
+                if(species)
+                {
+                    selected.push_back(*species);
+                    found = true;
+                }
+            };
+            select(aggregatestate);
+            for(auto i = 0; i < other_aggregate_states.size() && !found; ++i)
+                select(other_aggregate_states[i]);
+            error(!found, "Could not find any Species object with name ", name, ".");
+        }
+        return SpeciesList(selected).withoutTags(excludetags);
+    }
+
+    auto species = db.speciesWithAggregateState(aggregatestate, symbols, excludetags);
+
+    // If additional aggregate states provided, consider also other species in the database
+    for(auto other_aggregate_state : other_aggregate_states)
+    {
+        auto other_species = db.speciesWithAggregateState(other_aggregate_state, symbols, excludetags);
+        if(other_species.size())
+            species = concatenate(species, other_species);
+    }
+
+    return species;
+}
+
+} // namespace
+
 auto speciate(StringList const& substances) -> Speciate
 {
     errorif(substances.empty(), "Expecting a non-empty list of substance formulas in method `speciate`.");
@@ -67,6 +114,14 @@ auto GeneralPhase::setName(String name) -> GeneralPhase&
     return *this;
 }
 
+auto GeneralPhase::setSpecies(StringList const& species) -> GeneralPhase&
+{
+    names = species;
+    symbols.clear();
+    excludetags.clear();
+    return *this;
+}
+
 auto GeneralPhase::setStateOfMatter(StateOfMatter option) -> GeneralPhase&
 {
     stateofmatter = option;
@@ -88,12 +143,26 @@ auto GeneralPhase::setAdditionalAggregateStates(const Vec<AggregateState>& optio
 auto GeneralPhase::setActivityModel(const ActivityModelGenerator& model) -> GeneralPhase&
 {
     activity_model = model;
+    activity_model_jacobian = {}; // the analytic derivatives of a previous activity model no longer apply
     return *this;
 }
 
 auto GeneralPhase::setIdealActivityModel(const ActivityModelGenerator& model) -> GeneralPhase&
 {
     ideal_activity_model = model;
+    ideal_activity_model_jacobian = {}; // the analytic derivatives of a previous ideal activity model no longer apply
+    return *this;
+}
+
+auto GeneralPhase::setActivityModelJacobian(const ActivityModelJacobianGenerator& jacobian) -> GeneralPhase&
+{
+    activity_model_jacobian = jacobian;
+    return *this;
+}
+
+auto GeneralPhase::setIdealActivityModelJacobian(const ActivityModelJacobianGenerator& jacobian) -> GeneralPhase&
+{
+    ideal_activity_model_jacobian = jacobian;
     return *this;
 }
 
@@ -157,30 +226,23 @@ auto GeneralPhase::idealActivityModel() const -> const ActivityModelGenerator&
     return ideal_activity_model;
 }
 
+auto GeneralPhase::activityModelJacobian() const -> const ActivityModelJacobianGenerator&
+{
+    return activity_model_jacobian;
+}
+
+auto GeneralPhase::idealActivityModelJacobian() const -> const ActivityModelJacobianGenerator&
+{
+    return ideal_activity_model_jacobian;
+}
+
 auto GeneralPhase::convert(const Database& db, const Strings& elements) const -> Phase
 {
     error(aggregatestate == AggregateState::Undefined,
         "GeneralPhase::convert requires an AggregateState value to be specified.\n"
         "Use method GeneralPhase::setAggregateState to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
-
-    // If additional aggregate states provided, consider also other species in the database
-    for(auto other_aggregate_state : other_aggregate_states)
-    {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
-        if(other_species.size())
-            species = concatenate(species, other_species);
-    }
-
-    species =
-        names.size() ? species.withNames(names) :
-        symbols.size() ? species.withElements(symbols) :
-            species.withElements(elements);
-
-    // Filter out species with provided tags in the exclude function
-    if(excludetags.size())
-        species = species.withoutTags(excludetags);
+    auto species = selectSpecies(db, aggregatestate, other_aggregate_states, names, symbols.size() ? symbols : elements, excludetags); // species with provided tags in the exclude function are filtered out
 
     errorif(species.empty(), "Expecting at least one species when defining a phase, but none was provided. Make sure you have listed the species names yourself or used the `speciate` method appropriately.")
 
@@ -188,8 +250,14 @@ auto GeneralPhase::convert(const Database& db, const Strings& elements) const ->
     phase = phase.withName(phasename);
     phase = phase.withStateOfMatter(stateofmatter);
     phase = phase.withSpecies(species);
-    phase = phase.withActivityModel(activity_model(species));
-    phase = phase.withIdealActivityModel(ideal_activity_model(species));
+    phase = phase.withActivityModel(createThreadLocalActivityModel(activity_model, species));
+    phase = phase.withIdealActivityModel(createThreadLocalActivityModel(ideal_activity_model, species));
+
+    if(activity_model_jacobian)
+        phase = phase.withActivityModelJacobian(activity_model_jacobian(species));
+
+    if(ideal_activity_model_jacobian)
+        phase = phase.withIdealActivityModelJacobian(ideal_activity_model_jacobian(species));
 
     return phase;
 }
@@ -303,24 +371,7 @@ auto GeneralPhasesGenerator::convert(const Database& db, const Strings& elements
         "GeneralPhasesGenerator::convert requires an AggregateState value to be specified. "
         "Use method GeneralPhasesGenerator::set(AggregateState) to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
-
-    // If additional aggregate states provided, consider also other species in the database
-    for(auto other_aggregate_state : other_aggregate_states)
-    {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
-        if(other_species.size())
-            species = concatenate(species, other_species);
-    }
-
-    species =
-        names.size() ? species.withNames(names) :
-        symbols.size() ? species.withElements(symbols) :
-            species.withElements(elements);
-
-    // Filter out species with provided tags in the exclude function
-    if(excludetags.size())
-        species = species.withoutTags(excludetags);
+    auto species = selectSpecies(db, aggregatestate, other_aggregate_states, names, symbols.size() ? symbols : elements, excludetags); // species with provided tags in the exclude function are filtered out
 
     errorif(species.empty(), "Expecting at least one species when defining a list of single-species phases, but none was provided. Make sure you have listed the species names yourself or used the `speciate` method appropriately.")
 
@@ -371,64 +422,34 @@ auto Phases::generalPhasesGenerators() const -> Vec<GeneralPhasesGenerator> cons
     return generators;
 }
 
-auto Phases::convert() const -> Vec<Phase>
+auto Phases::expandedGeneralPhases() const -> Vec<GeneralPhase>
 {
-    // Return the element symbols in all stored GeneralPhase and GeneralPhasesGenerator objects.
-    auto collect_all_element_symbols = [&]() -> Strings
-    {
-        Strings symbols;
-
-        const auto collect_element_symbols_in_generalphase_or_generator = [&](const auto& phase)
-        {
-            Strings result;
-            if(phase.elements().size())
-                result = merge(result, phase.elements());
-            if(phase.species().size())
-                for(auto&& s : db.species().withNames(phase.species()))
-                    result = merge(result, s.elements().symbols());
-            if(phase.aggregateState() == AggregateState::Aqueous)
-                result = merge(result, Strings{"H", "O"}); // ensure both H and O are considered in case there is aqueous phases
-            return result;
-        };
-
-        for(const auto& phase : generalphases)
-            symbols = merge(symbols, collect_element_symbols_in_generalphase_or_generator(phase));
-
-        for(const auto& generator : generators)
-            symbols = merge(symbols, collect_element_symbols_in_generalphase_or_generator(generator));
-
-        return symbols;
-    };
+    const Strings symbols = collectElementSymbols();
 
     // Return all given GeneralPhase objects together with the generated ones.
-    auto collect_all_general_phases = [&](const Strings& symbols) -> Vec<GeneralPhase>
-    {
-        Vec<GeneralPhase> collected(generalphases);
+    Vec<GeneralPhase> collected(generalphases);
 
-        for(auto generator : generators)
-        {
-            const Vec<GeneralPhase> generated = generator.convert(db, symbols);
-            collected.insert(collected.end(), generated.begin(), generated.end());
-        }
-
-        return collected;
-    };
+    for(auto generator : generators)
+    {
+        const Vec<GeneralPhase> generated = generator.convert(db, symbols);
+        collected.insert(collected.end(), generated.begin(), generated.end());
+    }
 
     // Replace duplicate phase names with unique names.
-    auto fix_duplicate_phase_names = [](Vec<GeneralPhase>& phases)
-    {
-        Strings phasenames = vectorize(phases, RKT_LAMBDA(x, x.name()));
-        phasenames = makeunique(phasenames, "!");
-        auto i = 0;
-        for(auto& phase : phases)
-            phase.setName(phasenames[i++]);
-    };
+    Strings phasenames = vectorize(collected, RKT_LAMBDA(x, x.name()));
+    phasenames = makeunique(phasenames, "!");
+    auto i = 0;
+    for(auto& phase : collected)
+        phase.setName(phasenames[i++]);
 
-    Strings symbols = collect_all_element_symbols();
+    return collected;
+}
 
-    Vec<GeneralPhase> allgeneralphases = collect_all_general_phases(symbols);
+auto Phases::convert() const -> Vec<Phase>
+{
+    const Strings symbols = collectElementSymbols();
 
-    fix_duplicate_phase_names(allgeneralphases);
+    const Vec<GeneralPhase> allgeneralphases = expandedGeneralPhases();
 
     Vec<Phase> phases;
     phases.reserve(allgeneralphases.size());
@@ -438,6 +459,31 @@ auto Phases::convert() const -> Vec<Phase>
     return phases;
 }
 
+auto Phases::collectElementSymbols() const -> Strings
+{
+    Set<String> symbols; // collected in a set rather than with repeated merges of Strings, which is slow for many phases
+
+    const auto collect_element_symbols_in_generalphase_or_generator = [&](const auto& phase)
+    {
+        symbols.insert(phase.elements().begin(), phase.elements().end());
+        for(auto&& name : phase.species())
+            for(auto&& [element, coeff] : db.species(name).elements()) // not db.species().withNames(...), which would create all species in a lazy database
+                symbols.insert(element.symbol());
+        if(phase.aggregateState() == AggregateState::Aqueous)
+            symbols.insert({"H", "O"}); // ensure both H and O are considered in case there is aqueous phases
+    };
+
+    for(const auto& phase : generalphases)
+        collect_element_symbols_in_generalphase_or_generator(phase);
+
+    for(const auto& generator : generators)
+        collect_element_symbols_in_generalphase_or_generator(generator);
+
+    Strings result(symbols.begin(), symbols.end());
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 Phases::operator Vec<Phase>() const
 {
     return convert();
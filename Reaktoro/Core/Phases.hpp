@@ -92,12 +92,23 @@ public:
     /// Set additional aggregate states to be considered when searching for species in a database.
     auto setAdditionalAggregateStates(Vec<AggregateState> const& options) -> GeneralPhase&;
 
+    /// Set the names of the species composing the phase (replacing any automatic selection of species from element symbols).
+    auto setSpecies(StringList const& species) -> GeneralPhase&;
+
     /// Set the activity model of the phase.
     auto setActivityModel(ActivityModelGenerator const& model) -> GeneralPhase&;
 
     /// Set the ideal activity model of the phase.
     auto setIdealActivityModel(ActivityModelGenerator const& model) -> GeneralPhase&;
 
+    /// Set the analytic derivatives of the activity model of the phase.
+    /// @note This must be called after GeneralPhase::setActivityModel, which discards any previously given analytic derivatives.
+    auto setActivityModelJacobian(ActivityModelJacobianGenerator const& jacobian) -> GeneralPhase&;
+
+    /// Set the analytic derivatives of the ideal activity model of the phase.
+    /// @note This must be called after GeneralPhase::setIdealActivityModel, which discards any previously given analytic derivatives.
+    auto setIdealActivityModelJacobian(ActivityModelJacobianGenerator const& jacobian) -> GeneralPhase&;
+
     /// Set a unique name of the phase (equivalent to GeneralPhase::setName).
     auto named(String name) -> GeneralPhase&;
 
@@ -134,6 +145,12 @@ public:
     /// Return the specified ideal activity model of the phase.
     auto idealActivityModel() const -> ActivityModelGenerator const&;
 
+    /// Return the specified analytic derivatives of the activity model of the phase (empty if not given).
+    auto activityModelJacobian() const -> ActivityModelJacobianGenerator const&;
+
+    /// Return the specified analytic derivatives of the ideal activity model of the phase (empty if not given).
+    auto idealActivityModelJacobian() const -> ActivityModelJacobianGenerator const&;
+
     /// Convert this GeneralPhase object into a Phase object.
     auto convert(Database const& db, Strings const& elements) const -> Phase;
 
@@ -164,6 +181,12 @@ private:
 
     /// The ideal activity model of the phase.
     ActivityModelGenerator ideal_activity_model;
+
+    /// The analytic derivatives of the activity model of the phase (empty if not given).
+    ActivityModelJacobianGenerator activity_model_jacobian;
+
+    /// The analytic derivatives of the ideal activity model of the phase (empty if not given).
+    ActivityModelJacobianGenerator ideal_activity_model_jacobian;
 };
 
 /// The base type for a generator of general phases with a single species.
@@ -314,6 +337,9 @@ public:
     /// Return the GeneralPhaseGenerator objects collected so far with each call to Phases::add method.
     auto generalPhasesGenerators() const -> Vec<GeneralPhasesGenerator> const&;
 
+    /// Return all GeneralPhase objects, including those created by the GeneralPhasesGenerator objects, in the same order and with the same names as the Phase objects from @ref convert.
+    auto expandedGeneralPhases() const -> Vec<GeneralPhase>;
+
     /// Convert this Phases object into a vector of Phase objects.
     auto convert() const -> Vec<Phase>;
 
@@ -330,6 +356,9 @@ private:
     /// The GeneralPhaseGenerator objects collected so far with each call to Phases::add method.
     Vec<GeneralPhasesGenerator> generators;
 
+    /// Return the element symbols in all stored GeneralPhase and GeneralPhasesGenerator objects.
+    auto collectElementSymbols() const -> Strings;
+
     /// Add one or more GeneralPhase or GeneralPhasesGenerator objects into the Phases container.
     template<typename Arg, typename... Args>
     auto addAux(Arg const& arg, Args const&... args) -> void
@@ -367,6 +396,8 @@ public:
         setAggregateState(AggregateState::Aqueous);
         setActivityModel(ActivityModelIdealAqueous());
         setIdealActivityModel(ActivityModelIdealAqueous());
+        setActivityModelJacobian(ActivityModelJacobianIdealAqueous());
+        setIdealActivityModelJacobian(ActivityModelJacobianIdealAqueous());
     }
 };
 
@@ -397,6 +428,8 @@ public:
         setAggregateState(AggregateState::Gas);
         setActivityModel(ActivityModelIdealGas());
         setIdealActivityModel(ActivityModelIdealGas());
+        setActivityModelJacobian(ActivityModelJacobianIdealGas());
+        setIdealActivityModelJacobian(ActivityModelJacobianIdealGas());
     }
 };
 
@@ -427,6 +460,8 @@ public:
         setAggregateState(AggregateState::Liquid);
         setActivityModel(ActivityModelIdealSolution(StateOfMatter::Liquid));
         setIdealActivityModel(ActivityModelIdealSolution(StateOfMatter::Liquid));
+        setActivityModelJacobian(ActivityModelJacobianIdealSolution());
+        setIdealActivityModelJacobian(ActivityModelJacobianIdealSolution());
     }
 };
 
@@ -451,6 +486,8 @@ public:
         setAdditionalAggregateStates({AggregateState::CrystallineSolid});
         setActivityModel(ActivityModelIdealSolution(StateOfMatter::Solid));
         setIdealActivityModel(ActivityModelIdealSolution(StateOfMatter::Solid));
+        setActivityModelJacobian(ActivityModelJacobianIdealSolution());
+        setIdealActivityModelJacobian(ActivityModelJacobianIdealSolution());
     }
 };
 
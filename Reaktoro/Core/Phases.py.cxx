@@ -70,6 +70,7 @@ void exportPhases(py::module& m)
         .def("database", &Phases::database, return_internal_ref)
         .def("generalPhases", &Phases::generalPhases, return_internal_ref)
         .def("generalPhasesGenerators", &Phases::generalPhasesGenerators, return_internal_ref)
+        .def("expandedGeneralPhases", &Phases::expandedGeneralPhases)
         .def("convert", &Phases::convert)
         ;
 
@@ -84,8 +85,11 @@ void exportPhases(py::module& m)
         .def("setName", &GeneralPhase::setName, return_internal_ref)
         .def("setStateOfMatter", &GeneralPhase::setStateOfMatter, return_internal_ref)
         .def("setAggregateState", &GeneralPhase::setAggregateState, return_internal_ref)
+        .def("setSpecies", &GeneralPhase::setSpecies, return_internal_ref)
         .def("setActivityModel", &GeneralPhase::setActivityModel, return_internal_ref)
         .def("setIdealActivityModel", &GeneralPhase::setIdealActivityModel, return_internal_ref)
+        .def("setActivityModelJacobian", &GeneralPhase::setActivityModelJacobian, return_internal_ref)
+        .def("setIdealActivityModelJacobian", &GeneralPhase::setIdealActivityModelJacobian, return_internal_ref)
         .def("named", &GeneralPhase::named, return_internal_ref)
         .def("set", py::overload_cast<StateOfMatter>(&GeneralPhase::set), return_internal_ref)
         .def("set", py::overload_cast<AggregateState>(&GeneralPhase::set), return_internal_ref)
@@ -98,6 +102,8 @@ void exportPhases(py::module& m)
         .def("elements", &GeneralPhase::elements, return_internal_ref)
         .def("activityModel", &GeneralPhase::activityModel, return_internal_ref)
         .def("idealActivityModel", &GeneralPhase::idealActivityModel, return_internal_ref)
+        .def("activityModelJacobian", &GeneralPhase::activityModelJacobian, return_internal_ref)
+        .def("idealActivityModelJacobian", &GeneralPhase::idealActivityModelJacobian, return_internal_ref)
         .def("convert", &GeneralPhase::convert)
         ;
 
@@ -121,8 +121,15 @@ auto createReactionRateModel(py::object obj) -> ReactionRateModel
 {
     errorif(!isReactionRateModelConvertible(obj), "Expecting a Python callable object with just one argument of type ChemicalProps.");
 
+    // The solvers release the GIL during their calculations, so it needs to be
+    // reacquired before calling the Python callable. The callable is also held
+    // in a shared pointer whose deleter reacquires the GIL, since copies of the
+    // rate model may be created and destroyed while the GIL is released.
+    auto fn = std::shared_ptr<py::object>(new py::object(obj), [](py::object* ptr) { py::gil_scoped_acquire acquire; delete ptr; });
+
     return [=](ChemicalProps const& props) -> ReactionRate {
-        auto res = obj(props);
+        py::gil_scoped_acquire acquire;
+        auto res = (*fn)(props);
         try { return ReactionRate(res.cast<real>()); }
         catch(...) {
             try { return res.cast<ReactionRate>(); }
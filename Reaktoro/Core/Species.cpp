@@ -90,6 +90,9 @@ struct Species::Impl
     /// The attached data whose type is known at runtime only.
     Any attacheddata;
 
+    /// The chemical formula of the species assembled from its formula string, elements and charge.
+    ChemicalFormula chemical_formula;
+
     /// Construct a default Species::Impl instance
     Impl()
     {}
@@ -103,7 +106,9 @@ struct Species::Impl
       elements(formula.elements()),
       charge(formula.charge()),
       aggregate_state(identifyAggregateState(formula))
-    {}
+    {
+        updateChemicalFormula();
+    }
 
     /// Construct a Species::Impl instance with given attributes
     Impl(const Attribs& attribs)
@@ -143,6 +148,14 @@ struct Species::Impl
             propsfn = reaction.createStandardThermoModel();
             propsfn = propsfn.withMemoization();
         }
+
+        updateChemicalFormula();
+    }
+
+    /// Update the chemical formula of the species after a change in its formula string, elements or charge.
+    auto updateChemicalFormula() -> void
+    {
+        chemical_formula = ChemicalFormula(formula, elements, charge);
     }
 };
 
@@ -178,6 +191,7 @@ auto Species::withFormula(String formula) const -> Species
     Species copy = clone();
     copy.pimpl->formula = std::move(formula);
     copy.pimpl->repr = detail::speciesNameFormula(copy.pimpl->name, copy.pimpl->formula);
+    copy.pimpl->updateChemicalFormula();
     return copy;
 }
 
@@ -192,6 +206,7 @@ auto Species::withElements(ElementalComposition elements) const -> Species
 {
     Species copy = clone();
     copy.pimpl->elements = std::move(elements);
+    copy.pimpl->updateChemicalFormula();
     return copy;
 }
 
@@ -199,6 +214,7 @@ auto Species::withCharge(double charge) const -> Species
 {
     Species copy = clone();
     copy.pimpl->charge = charge;
+    copy.pimpl->updateChemicalFormula();
     return copy;
 }
 
@@ -250,9 +266,9 @@ auto Species::name() const -> String
     return pimpl->name;
 }
 
-auto Species::formula() const -> ChemicalFormula
+auto Species::formula() const -> const ChemicalFormula&
 {
-    return ChemicalFormula(pimpl->formula, pimpl->elements, pimpl->charge);
+    return pimpl->chemical_formula;
 }
 
 auto Species::repr() const -> String
@@ -144,7 +144,7 @@ public:
     auto name() const -> String;
 
     /// Return the chemical formula of the species.
-    auto formula() const -> ChemicalFormula;
+    auto formula() const -> const ChemicalFormula&;
 
     /// Return the name of the species and its chemical formula if name does not contain it (e.g., `Calcite :: CaCO3`).
     auto repr() const -> String;
@@ -65,6 +65,17 @@ TEST_CASE("Testing Species class", "[Species]")
         CHECK( species.attachedData().has_value() );
         CHECK( species.attachedData().type() == typeid(String) );
         CHECK( std::any_cast<String>(species.attachedData()) == "SomeData" );
+
+        // Copies share the data of the species, including its chemical formula
+        const auto copy = species;
+        CHECK( &copy.formula() == &species.formula() );
+        CHECK( copy.formula().charge() == 2.0 );
+        CHECK( copy.formula().coefficient("B") == 2 );
+
+        // Modified copies do not affect the original species
+        const auto other = species.withCharge(1.0);
+        CHECK( other.formula().charge() == 1.0 );
+        CHECK( species.formula().charge() == 2.0 );
     }
 
     SECTION("Testing the standard thermodynamic property functionality of the chemical species")
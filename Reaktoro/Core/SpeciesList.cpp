@@ -43,6 +43,7 @@ SpeciesList::SpeciesList(const StringList& formulas)
 
 auto SpeciesList::append(const Species& species) -> void
 {
+    resetLookupTables();
     m_species.push_back(species);
 }
 
@@ -80,6 +81,7 @@ auto SpeciesList::operator[](Index i) const -> const Species&
 
 auto SpeciesList::operator[](Index i) -> Species&
 {
+    resetLookupTables();
     return m_species[i];
 }
 
@@ -90,7 +92,7 @@ auto SpeciesList::find(const String& name) const -> Index
 
 auto SpeciesList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.name() == name));
+    return m_names.find(name, m_species, RKT_LAMBDA(s, s.name()));
 }
 
 auto SpeciesList::findWithFormula(const ChemicalFormula& formula) const -> Index
@@ -100,7 +102,7 @@ auto SpeciesList::findWithFormula(const ChemicalFormula& formula) const -> Index
 
 auto SpeciesList::findWithSubstance(const String& substance) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.substance() == substance));
+    return m_substances.find(substance, m_species, RKT_LAMBDA(s, s.substance()));
 }
 
 auto SpeciesList::index(const String& name) const -> Index
@@ -217,6 +219,7 @@ auto SpeciesList::withElementsOf(const StringList& formulas) const -> SpeciesLis
 
 SpeciesList::operator Vec<Species>&()
 {
+    resetLookupTables();
     return m_species;
 }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/LookupTable.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ElementList.hpp>
 #include <Reaktoro/Core/Species.hpp>
@@ -169,6 +170,15 @@ private:
     /// The species stored in the list.
     Vec<Species> m_species;
 
+    /// The lookup table of the species in the list by their names.
+    LookupTable m_names;
+
+    /// The lookup table of the species in the list by their substance names.
+    LookupTable m_substances;
+
+    /// Reset the lookup tables after the species in the list may have been changed.
+    auto resetLookupTables() -> void { m_names.reset(); m_substances.reset(); }
+
 public:
     /// Construct an SpeciesList object with given begin and end iterators.
     template<typename InputIterator>
@@ -178,20 +188,23 @@ public:
     auto begin() const { return m_species.begin(); }
 
     /// Return begin iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto begin() { return m_species.begin(); }
+    auto begin() { resetLookupTables(); return m_species.begin(); }
 
     /// Return end const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto end() const { return m_species.end(); }
 
     /// Return end iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto end() { return m_species.end(); }
+    auto end() { resetLookupTables(); return m_species.end(); }
 
     /// Append a new Species at the back of the container (for STL compatibility reasons).
     auto push_back(const Species& species) -> void { append(species); }
 
+    /// Reserve memory for a given number of Species objects in the container (for STL compatibility reasons).
+    auto reserve(Index n) -> void { m_species.reserve(n); }
+
     /// Insert a container of Species objects into this SpeciesList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_species.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { resetLookupTables(); m_species.insert(pos, begin, end); }
 
     /// The type of the value stored in a SpeciesList (for STL compatibility reasons).
     using value_type = Species;
@@ -506,6 +506,22 @@ TEST_CASE("Testing SpeciesList", "[SpeciesList]")
     CHECK( specieslist.indexWithName("CaCO3(calcite)") < specieslist.size() );
     CHECK( specieslist.indexWithFormula("CaCO3") < specieslist.size() );
 
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: SpeciesList::operator[] after lookups by name
+    //-------------------------------------------------------------------------
+    SpeciesList copied = specieslist;
+
+    CHECK( copied.find("CaCO3(calcite)") == specieslist.find("CaCO3(calcite)") );
+
+    const auto icalcite = copied.find("CaCO3(calcite)");
+
+    copied[icalcite] = Species("MgCO3(magnesite)");
+
+    CHECK( copied.find("CaCO3(calcite)") >= copied.size() );
+    CHECK( copied.find("MgCO3(magnesite)") == icalcite );
+    CHECK( copied.findWithSubstance("MgCO3") == icalcite );
+    CHECK( specieslist.find("CaCO3(calcite)") == icalcite ); // the original list is not affected by changes in its copy
+
     //-------------------------------------------------------------------------
     // TESTING METHOD: SpeciesList::begin|end
     //-------------------------------------------------------------------------
@@ -38,12 +38,26 @@ struct DatabaseParser::Impl
     ///< The database contents parsed from YAML or JSON into a Data object.
     Data doc;
 
+    ///< The records of the species in the database, if species are created on demand.
+    Vec<SpeciesRecord> species_records;
+
+    ///< The positions of the species in the `Species` list of the database, if species are created on demand.
+    Map<String, Index> species_positions;
+
+    ///< The function that creates the species on demand, if these are not created from the Data object.
+    Fn<Species(String const&)> species_fn;
+
     /// Construct a default DatabaseParser::Impl object.
     Impl()
     {}
 
     /// Construct a DatabaseParser::Impl object with given Data object.
     Impl(const Data& doc)
+    : Impl(doc, false)
+    {}
+
+    /// Construct a DatabaseParser::Impl object with given Data object whose species are optionally created on demand.
+    Impl(const Data& doc, bool lazy)
     : doc(doc)
     {
         errorif(!doc.isDict(), "Could not understand your YAML or JSON database file with content:\n", doc.repr(), "\n",
@@ -71,7 +85,9 @@ struct DatabaseParser::Impl
             else errorif(true, "Expecting the `Elements` section in your YAML or JSON database to be either a list or dictionary. Please check other Reaktoro databases in either YAML or JSON format and replicate the structure.");
         }
 
-        if(doc.exists("Species"))
+        if(lazy)
+            addSpeciesRecords();
+        else if(doc.exists("Species"))
         {
             if(doc["Species"].isDict())
                 for(auto const& child : doc["Species"].asDict())
@@ -84,6 +100,53 @@ struct DatabaseParser::Impl
         }
     }
 
+    /// Add the records of the species in the database without creating their Species objects.
+    auto addSpeciesRecords() -> void
+    {
+        if(!doc.exists("Species"))
+            return;
+
+        auto const& section = doc["Species"];
+
+        if(section.isDict())
+            for(auto const& child : section.asDict())
+                addSpeciesRecord(child.first, child.second);
+        else if(section.isList())
+        {
+            auto const& list = section.asList();
+            for(auto i = 0; i < list.size(); ++i)
+            {
+                auto const name = list[i]["Name"].asString();
+                if(species_positions.emplace(name, i).second) // Do not consider a species that has already been found! The first one is created, as when species are not created on demand.
+                    addSpeciesRecord(name, list[i]);
+            }
+        }
+        else errorif(true, "Expecting the `Species` section in your YAML or JSON database to be either a list or dictionary. Please check other Reaktoro databases in either YAML or JSON format and replicate the structure.");
+    }
+
+    /// Add the record of a species with given `name` and `attributes`, and the elements composing it.
+    auto addSpeciesRecord(String const& name, Data const& attributes) -> void
+    {
+        errorif(!attributes.isDict(), "Expecting the attributes of a species as an object, but got instead:\n\n", attributes.repr());
+        errorif(!attributes.exists("AggregateState"), "Missing `AggregateState` specification in:\n\n", attributes.repr());
+        SpeciesRecord record;
+        record.name = name;
+        attributes.at("AggregateState").to(record.aggregate_state);
+        errorif(record.aggregate_state == AggregateState::Undefined,
+            "Unsupported AggregateState value `", attributes["AggregateState"].asString(), "` in:\n\n", attributes.repr(), "\n\n"
+            "The supported values are given below:\n\n", supportedAggregateStateValues());
+        if(attributes.exists("Elements") && !attributes.at("Elements").isNull())
+        {
+            for(auto const& [symbol, coeff] : parseNumberStringPairs(attributes["Elements"].asString()))
+            {
+                if(element_list.find(symbol) == element_list.size())
+                    addElement(symbol);
+                record.elements.push_back(symbol);
+            }
+        }
+        species_records.push_back(record);
+    }
+
     /// Return the Data object with the details of an element with given unique @p symbol.
     auto getElementDetails(String const& symbol) -> Data
     {
@@ -97,8 +160,16 @@ struct DatabaseParser::Impl
     auto getSpeciesDetails(const String& name) -> Data
     {
         if(doc.exists("Species"))
-            if(doc["Species"].exists(name))
+        {
+            if(doc["Species"].isList())
+            {
+                const auto it = species_positions.find(name);
+                if(it != species_positions.end())
+                    return doc["Species"][it->second];
+            }
+            else if(doc["Species"].exists(name))
                 return doc["Species"][name];
+        }
         return {};
     }
 
@@ -130,6 +201,14 @@ struct DatabaseParser::Impl
     /// Add a new species with given unique @p name. A Data object for this species must exist.
     auto addSpecies(String const& name) -> Species
     {
+        if(species_fn)
+        {
+            const auto idx = species_list.find(name);
+            if(idx < species_list.size())
+                return species_list[idx];
+            species_list.append(species_fn(name));
+            return species_list[species_list.size() - 1];
+        }
         const auto attributes = getSpeciesDetails(name);
         errorif(attributes.isNull(), "Could not create a Species object with "
             "name `", name, "`, which does not seem to exist in the database. "
@@ -268,6 +347,18 @@ DatabaseParser::DatabaseParser(Data const& doc)
 : pimpl(new Impl(doc))
 {}
 
+DatabaseParser::DatabaseParser(Data const& doc, bool lazy)
+: pimpl(new Impl(doc, lazy))
+{}
+
+DatabaseParser::DatabaseParser(ElementList const& elements, Vec<SpeciesRecord> const& records, Fn<Species(String const&)> const& createfn)
+: pimpl(new Impl())
+{
+    pimpl->element_list = elements;
+    pimpl->species_records = records;
+    pimpl->species_fn = createfn;
+}
+
 DatabaseParser::~DatabaseParser()
 {}
 
@@ -287,8 +378,20 @@ auto DatabaseParser::species() const -> const SpeciesList&
     return pimpl->species_list;
 }
 
+auto DatabaseParser::speciesRecords() const -> const Vec<SpeciesRecord>&
+{
+    return pimpl->species_records;
+}
+
+auto DatabaseParser::createSpecies(String const& name) -> Species
+{
+    return pimpl->addSpecies(name);
+}
+
 DatabaseParser::operator Database() const
 {
+    for(auto const& record : pimpl->species_records)
+        pimpl->addSpecies(record.name); // ensure all species are created if they are created on demand
     return Database(elements(), species());
 }
 
@@ -31,6 +31,19 @@ class Data;
 class DatabaseParser
 {
 public:
+    /// The name, aggregate state and elements of a species in the database file, known before its Species object is created.
+    struct SpeciesRecord
+    {
+        /// The name of the species.
+        String name;
+
+        /// The aggregate state of the species.
+        AggregateState aggregate_state;
+
+        /// The symbols of the elements composing the species.
+        Strings elements;
+    };
+
     /// Construct a default DatabaseParser object.
     DatabaseParser();
 
@@ -40,6 +53,22 @@ public:
     /// Construct a DatabaseParser object with given Data object.
     explicit DatabaseParser(const Data& node);
 
+    /// Construct a DatabaseParser object with given Data object whose species are optionally created on demand.
+    /// If `lazy` is true, only the elements in the database file are created
+    /// at construction, and each species is created when first requested with
+    /// @ref createSpecies. The attributes of a species are then only checked
+    /// when its Species object is created.
+    DatabaseParser(const Data& node, bool lazy);
+
+    /// Construct a lazy DatabaseParser object whose species are created on demand with a given function.
+    /// This permits databases in formats other than those of Reaktoro (e.g.,
+    /// ThermoFun databases) to create their species only when first requested
+    /// with @ref createSpecies, after indexing them with their records.
+    /// @param elements The Element objects in the database
+    /// @param records The records of the species in the database
+    /// @param createfn The function that creates the Species object with a given name in @p records
+    DatabaseParser(ElementList const& elements, Vec<SpeciesRecord> const& records, Fn<Species(String const&)> const& createfn);
+
     /// Destroy this DatabaseParser object.
     ~DatabaseParser();
 
@@ -50,8 +79,15 @@ public:
     auto elements() const -> const ElementList&;
 
     /// Return the parsed Species objects in the database file.
+    /// @note If this DatabaseParser object is lazy, only the species created so far are returned.
     auto species() const -> const SpeciesList&;
 
+    /// Return the records of the species in the database file known before they are created (empty if this DatabaseParser object is not lazy).
+    auto speciesRecords() const -> const Vec<SpeciesRecord>&;
+
+    /// Return the Species object with given name in the database file, creating it if not yet created.
+    auto createSpecies(String const& name) -> Species;
+
     /// Return the parsed Element objects in the database file.
     operator Database() const;
 
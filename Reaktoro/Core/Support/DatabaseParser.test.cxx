@@ -20,6 +20,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 using namespace Reaktoro;
 
@@ -231,6 +232,43 @@ TEST_CASE("Testing DatabaseParser class", "[DatabaseParser]")
         CHECK( species[3].reaction().stoichiometry("A2B3(aq)") == 2 );
     }
 
+    SECTION("Testing creation of species on demand")
+    {
+        String doc = GENERATE(doc_dict_based, doc_list_based);
+
+        Data data = Data::parse(doc);
+
+        DatabaseParser db(data, true);
+
+        CHECK( db.elements().size() == 2 );
+        CHECK( db.species().size() == 0 );
+
+        auto const& records = db.speciesRecords();
+
+        CHECK( records.size() == 4 );
+
+        CHECK( records[0].name == "A2B(l)" );
+        CHECK( records[0].aggregate_state == AggregateState::Liquid );
+        CHECK( records[0].elements == Strings{"A", "B"} );
+
+        CHECK( records[3].name == "A6B7(aq)" );
+        CHECK( records[3].aggregate_state == AggregateState::Aqueous );
+        CHECK( records[3].elements == Strings{"A", "B"} );
+
+        auto species = db.createSpecies("A6B7(aq)");
+
+        CHECK( species.name() == "A6B7(aq)" );
+        CHECK( species.reaction().reactants().size() == 2 );
+        CHECK( db.species().size() == 3 ); // A6B7(aq) and its reactants A2B(l) and A2B3(aq)
+
+        CHECK( db.createSpecies("A2B(l)").name() == "A2B(l)" );
+        CHECK( db.species().size() == 3 );
+
+        CHECK_THROWS( db.createSpecies("A3B(s)") );
+
+        CHECK( Database(db).species().size() == 4 );
+    }
+
     SECTION("Testing non-conforming databases")
     {
         CHECK_THROWS(DatabaseParser(Data::parse(doc_elements_wrong)));
@@ -19,8 +19,12 @@
 
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumFitter.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumGrid.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumReducer.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
@@ -30,6 +34,7 @@
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SpeciationSolver.hpp>
 
 /// @defgroup Equilibrium Equilibrium
 /// The module in Reaktoro in which classes and methods for chemical equilibrium calculations are implemented.
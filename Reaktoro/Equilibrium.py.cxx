@@ -20,8 +20,12 @@
 
 void exportEquilibriumConditions(py::module& m);
 void exportEquilibriumDims(py::module& m);
+void exportEquilibriumFitter(py::module& m);
+void exportEquilibriumGrid(py::module& m);
 void exportEquilibriumOptions(py::module& m);
 void exportEquilibriumProblem(py::module& m);
+void exportEquilibriumRecord(py::module& m);
+void exportEquilibriumReducer(py::module& m);
 void exportEquilibriumRestrictions(py::module& m);
 void exportEquilibriumResult(py::module& m);
 void exportEquilibriumSensitivity(py::module& m);
@@ -31,14 +35,19 @@ void exportEquilibriumUtils(py::module& m);
 void exportSmartEquilibriumOptions(py::module& m);
 void exportSmartEquilibriumResult(py::module& m);
 void exportSmartEquilibriumSolver(py::module& m);
+void exportSpeciationSolver(py::module& m);
 
 void exportEquilibrium(py::module& m)
 {
     exportEquilibriumConditions(m);
     exportEquilibriumDims(m);
+    exportEquilibriumFitter(m);
+    exportEquilibriumGrid(m);
     exportEquilibriumOptions(m);
     exportEquilibriumRestrictions(m);
     exportEquilibriumProblem(m); // Ensure exportEquilibriumProblem is executed after exportEquilibriumConditions and exportEquilibriumRestrictions!
+    exportEquilibriumRecord(m);
+    exportEquilibriumReducer(m);
     exportEquilibriumResult(m);
     exportEquilibriumSensitivity(m);
     exportEquilibriumSolver(m);
@@ -47,4 +56,5 @@ void exportEquilibrium(py::module& m)
     exportSmartEquilibriumOptions(m);
     exportSmartEquilibriumResult(m);
     exportSmartEquilibriumSolver(m);
+    exportSpeciationSolver(m);
 }
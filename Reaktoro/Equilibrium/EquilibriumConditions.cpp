@@ -398,6 +398,18 @@ auto EquilibriumConditions::inputNames() const -> Strings const&
     return wvars;
 }
 
+auto EquilibriumConditions::inputIndex(String const& name) const -> Index
+{
+    const auto idx = index(wvars, name);
+    errorif(idx >= wvars.size(), "There is no input variable with name `", name, "` in this EquilibriumConditions object.");
+    return idx;
+}
+
+auto EquilibriumConditions::inputValues() -> ArrayXrRef
+{
+    return w;
+}
+
 auto EquilibriumConditions::inputValues() const -> ArrayXrConstRef
 {
     return w;
@@ -471,6 +483,23 @@ auto EquilibriumConditions::initialComponentAmountsGetOrCompute(ChemicalState co
     return c0.rows() != 0 ? c0 : ArrayXd(C * n0);
 }
 
+//=================================================================================================
+//
+// METHODS TO SPECIFY THE ACCURACY OF THE CALCULATION
+//
+//=================================================================================================
+
+auto EquilibriumConditions::setTolerance(double tolerance) -> void
+{
+    errorif(tolerance < 0.0, "Expecting a non-negative convergence tolerance in EquilibriumConditions::setTolerance, but got ", tolerance, ".");
+    tol = tolerance;
+}
+
+auto EquilibriumConditions::tolerance() const -> double
+{
+    return tol;
+}
+
 //=================================================================================================
 //
 // MISCELLANEOUS METHODS
@@ -266,6 +266,19 @@ public:
     /// Get the names of the input variables associated with the equilibrium conditions.
     auto inputNames() const -> Strings const&;
 
+    /// Get the index of an input variable with given name.
+    /// Use this method to resolve the index of an input variable once and then set
+    /// its value repeatedly with @ref setInputVariable(Index, real const&) or
+    /// @ref inputValues, e.g. when the conditions of many cells are set in sequence.
+    /// @param name The unique name of the input variable.
+    /// @warning An error is thrown if there are no input variable with given name.
+    auto inputIndex(String const& name) const -> Index;
+
+    /// Get the values of the input variables associated with the equilibrium conditions.
+    /// The returned array can be written directly, with the input variables
+    /// ordered as in @ref inputNames.
+    auto inputValues() -> ArrayXrRef;
+
     /// Get the values of the input variables associated with the equilibrium conditions.
     auto inputValues() const -> ArrayXrConstRef;
 
@@ -319,6 +332,26 @@ public:
     /// @param state0 The initial state of the system from which the initial amounts of the species \eq{n^\circ} are collected if needed.
     auto initialComponentAmountsGetOrCompute(ChemicalState const& state0) const -> ArrayXd;
 
+    //=================================================================================================
+    //
+    // METHODS TO SPECIFY THE ACCURACY OF THE CALCULATION
+    //
+    //=================================================================================================
+
+    /// Set the convergence tolerance of the equilibrium calculation with these conditions, overriding that in EquilibriumOptions::optima.
+    /// This allows each calculation to be solved only as accurately as
+    /// needed without changing the options of the solver, e.g., in
+    /// operator-split reactive transport, with a tolerance matched to the
+    /// splitting error, looser in cells where little changes and tighter
+    /// near reaction fronts. The tolerance used and the residuals achieved
+    /// are reported in EquilibriumResult. Zero (the default) restores the
+    /// tolerance in EquilibriumOptions::optima.
+    /// @param tolerance The convergence tolerance of the calculation (non-negative)
+    auto setTolerance(double tolerance) -> void;
+
+    /// Get the convergence tolerance of the equilibrium calculation with these conditions (zero if that in EquilibriumOptions::optima is used).
+    auto tolerance() const -> double;
+
     //=================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -341,6 +374,7 @@ private:
     ArrayXd c0;                           ///< The initial amounts of the conservative components.
     ArrayXd plower;                       ///< The lower bounds for the *p* control variables.
     ArrayXd pupper;                       ///< The upper bounds for the *p* control variables.
+    double tol = 0.0;                     ///< The convergence tolerance of the calculation (zero if that in EquilibriumOptions::optima is used).
 };
 
 } // namespace Reaktoro
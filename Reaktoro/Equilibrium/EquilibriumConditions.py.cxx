@@ -73,7 +73,8 @@ void exportEquilibriumConditions(py::module& m)
         .def("setInputVariable", py::overload_cast<Index, real const&>(&EquilibriumConditions::setInputVariable), "Set the value of an input variable with given index.")
         .def("setInputVariables", &EquilibriumConditions::setInputVariables, "Set the input variables with given vector of input values.")
         .def("inputNames", &EquilibriumConditions::inputNames, return_internal_ref, "Return the names of the input variables associated with the equilibrium conditions.")
-        .def("inputValues", &EquilibriumConditions::inputValues, return_internal_ref, "Return the values of the input variables associated with the equilibrium conditions.")
+        .def("inputIndex", &EquilibriumConditions::inputIndex, "Return the index of an input variable with given name.")
+        .def("inputValues", py::overload_cast<>(&EquilibriumConditions::inputValues), return_internal_ref, "Return the values of the input variables associated with the equilibrium conditions.")
         .def("inputValuesGetOrCompute", &EquilibriumConditions::inputValuesGetOrCompute, "Get the values of the input variables associated with the equilibrium conditions if specified, otherwise fetch them from given initial state.")
         .def("inputValue", &EquilibriumConditions::inputValue, return_internal_ref, "Return the values of the input variables associated with the equilibrium conditions.")
 
@@ -84,6 +85,9 @@ void exportEquilibriumConditions(py::module& m)
         .def("initialComponentAmountsGetOrCompute", py::overload_cast<VectorXdConstRef const&>(&EquilibriumConditions::initialComponentAmountsGetOrCompute, py::const_), "Get the initial amounts of the conservative components c0 before the chemical system reacts if available, otherwise compute it.")
         .def("initialComponentAmountsGetOrCompute", py::overload_cast<ChemicalState const&>(&EquilibriumConditions::initialComponentAmountsGetOrCompute, py::const_), "Get the initial amounts of the conservative components c0 before the chemical system reacts if available, otherwise compute it.")
 
+        .def("setTolerance", &EquilibriumConditions::setTolerance, "Set the convergence tolerance of the equilibrium calculation with these conditions, overriding that in EquilibriumOptions::optima (zero restores it).")
+        .def("tolerance", &EquilibriumConditions::tolerance, "Get the convergence tolerance of the equilibrium calculation with these conditions (zero if that in EquilibriumOptions::optima is used).")
+
         .def("system", &EquilibriumConditions::system, return_internal_ref, "Return the chemical system associated with the equilibrium conditions.")
         ;
 }
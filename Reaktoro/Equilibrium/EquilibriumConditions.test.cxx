@@ -100,6 +100,19 @@ TEST_CASE("Testing EquilibriumConditions", "[EquilibriumConditions]")
         CHECK( conditions.inputValue("T") ==  50.0 + 273.15 ); // T in K
         CHECK( conditions.inputValue("P") == 100.0 * 1.0e+5 ); // P in Pa
 
+        const auto iT = conditions.inputIndex("T");
+        const auto iP = conditions.inputIndex("P");
+
+        CHECK( iT == 0 );
+        CHECK( iP == 1 );
+        CHECK_THROWS( conditions.inputIndex("V") );
+
+        conditions.setInputVariable(iT, 330.0);
+        conditions.inputValues()[iP] = 2.0e+5;
+
+        CHECK( conditions.inputValue("T") == 330.0 );
+        CHECK( conditions.inputValue("P") == 2.0e+5 );
+
         CHECK_THROWS( conditions.volume(1, "m3") );
 
         CHECK( conditions.lowerBoundsControlVariablesP().size() == 0 ); // there are no p control variables
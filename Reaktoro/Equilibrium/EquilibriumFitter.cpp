@@ -0,0 +1,387 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumFitter.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Params.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return a copy of a Data object in which every Param object is cloned (i.e., does not share its value with the original one).
+auto cloneData(Data const& data) -> Data
+{
+    if(data.isParam())
+        return data.asParam().clone();
+    if(data.isDict())
+    {
+        Dict<String, Data> dict;
+        for(auto const& [key, value] : data.asDict())
+            dict.insert_or_assign(key, cloneData(value));
+        return dict;
+    }
+    if(data.isList())
+    {
+        Vec<Data> list;
+        for(auto const& value : data.asList())
+            list.push_back(cloneData(value));
+        return list;
+    }
+    return data;
+}
+
+/// The chemical system, parameters and equilibrium solver used by a worker thread of EquilibriumFitter.
+struct EquilibriumFitterWorker
+{
+    /// The copy of the model parameters used by this worker.
+    const Params params;
+
+    /// The chemical system created with the model parameters of this worker.
+    const ChemicalSystem system;
+
+    /// The fitted parameters among the model parameters of this worker.
+    Vec<Param> fitted;
+
+    /// The indices of the fitted parameters among the input variables *w* of the equilibrium calculations.
+    Indices iw;
+
+    /// The equilibrium specifications with temperature, pressure and the fitted parameters as input variables.
+    const EquilibriumSpecs specs;
+
+    /// The equilibrium solver of this worker.
+    EquilibriumSolver solver;
+
+    /// The sensitivity derivatives of the last equilibrium state computed by this worker.
+    EquilibriumSensitivity sensitivity;
+
+    /// The chemical properties at the last equilibrium state computed by this worker.
+    ChemicalProps props;
+
+    EquilibriumFitterWorker(Params const& params0, Fn<ChemicalSystem(Params const&)> const& createSystem, Fn<Vec<Param>(Params const&)> const& select, EquilibriumOptions const& options)
+    : params(cloneData(params0.data())),
+      system(createSystem(params)),
+      fitted(select(params)),
+      specs(createSpecs()),
+      solver(specs),
+      sensitivity(specs),
+      props(system)
+    {
+        solver.setOptions(options);
+    }
+
+    /// Return the equilibrium specifications at given temperature and pressure with the fitted parameters as input variables.
+    auto createSpecs() -> EquilibriumSpecs
+    {
+        EquilibriumSpecs res(system);
+        res.temperature();
+        res.pressure();
+        for(auto i = 0; i < fitted.size(); ++i)
+        {
+            fitted[i].id("EquilibriumFitterParam" + std::to_string(i)); // ensure distinct identifiers for the input variables
+            iw.push_back(res.addInput(fitted[i]));
+        }
+        return res;
+    }
+};
+
+} // namespace
+
+struct EquilibriumFitter::Impl
+{
+    /// The model parameters, among which are those to be fitted.
+    const Params params;
+
+    /// The function that creates the chemical system using given model parameters.
+    const Fn<ChemicalSystem(Params const&)> createSystem;
+
+    /// The function that returns the parameters to be fitted in a Params object.
+    Fn<Vec<Param>(Params const&)> select;
+
+    /// The options of the equilibrium calculations.
+    EquilibriumOptions eqoptions;
+
+    /// The options of the fitting.
+    EquilibriumFitterOptions options;
+
+    /// The experiments used in the fitting.
+    Vec<EquilibriumFitterExperiment> experiments;
+
+    /// The species amounts at the last successfully computed equilibrium state of each experiment (used as initial guess).
+    Vec<ArrayXd> namounts;
+
+    /// The chemical systems, parameters and equilibrium solvers of the worker threads.
+    Vec<SharedPtr<EquilibriumFitterWorker>> workers;
+
+    /// The pool of worker threads (created on first use).
+    SharedPtr<ThreadPool> pool;
+
+    Impl(Params const& params, Fn<ChemicalSystem(Params const&)> const& createSystem)
+    : params(params), createSystem(createSystem)
+    {
+        errorif(!createSystem, "Expecting an initialized function that creates the chemical system in EquilibriumFitter.");
+    }
+
+    Impl(Impl const& other)
+    : params(other.params), createSystem(other.createSystem), select(other.select),
+      eqoptions(other.eqoptions), options(other.options), experiments(other.experiments),
+      namounts(other.namounts)
+    {}
+
+    /// Discard the worker threads and their data so that they are created again with the current settings.
+    auto resetWorkers() -> void
+    {
+        workers.clear();
+        pool.reset();
+    }
+
+    auto initializeWorkers() -> void
+    {
+        errorif(!select, "Expecting the parameters to be fitted to be specified with EquilibriumFitter::setParams.");
+
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(options.threads);
+
+        if(workers.size() == pool->numThreads())
+            return;
+
+        workers.clear();
+        for(auto i = 0; i < pool->numThreads(); ++i)
+            workers.push_back(std::make_shared<EquilibriumFitterWorker>(params, createSystem, select, eqoptions));
+    }
+
+    auto residuals(ArrayXdConstRef values, ArrayXdRef r, MatrixXdRef J) -> bool
+    {
+        initializeWorkers();
+
+        const auto numexperiments = experiments.size();
+        const auto numparams = workers.front()->fitted.size();
+
+        errorif(values.size() != numparams, "Expecting ", numparams, " values for the fitted parameters, but got ", values.size(), ".");
+        errorif(r.size() != numexperiments, "Expecting an array of residuals with ", numexperiments, " entries, but got one with ", r.size(), ".");
+        errorif(J.rows() != numexperiments || J.cols() != numparams, "Expecting a Jacobian matrix with dimensions ", numexperiments, " x ", numparams, ".");
+
+        // Set the values of the fitted parameters of every worker (each worker uses only its own parameters below)
+        for(auto const& worker : workers)
+            for(auto j = 0; j < numparams; ++j)
+                worker->fitted[j].value() = values[j];
+
+        namounts.resize(numexperiments);
+
+        Vec<char> success(numexperiments, false); // stored as bytes so that workers can write them concurrently
+
+        pool->parallelFor(numexperiments, [&](Index i, Index iworker)
+        {
+            auto& worker = *workers[iworker];
+            auto const& experiment = experiments[i];
+
+            ChemicalState state = experiment.state(worker.system);
+
+            if(namounts[i].size() == state.speciesAmounts().size())
+                state.setSpeciesAmounts(namounts[i]); // start from the equilibrium state of the experiment in the previous evaluation
+
+            EquilibriumConditions conditions(worker.specs);
+            conditions.temperature(state.temperature());
+            conditions.pressure(state.pressure());
+
+            const auto result = worker.solver.solve(state, worker.sensitivity, conditions);
+
+            success[i] = result.succeeded();
+
+            if(result.succeeded())
+                namounts[i] = state.speciesAmounts().cast<double>();
+
+            auto& props = worker.props;
+
+            const auto T = state.temperature();
+            const auto P = state.pressure();
+            const auto& n = state.speciesAmounts();
+
+            props.update(T, P, n);
+
+            r[i] = experiment.weight * (experiment.quantity(props).val() - experiment.value);
+
+            // Compute the derivatives of the residual with respect to each fitted parameter, considering both
+            // its effect on the equilibrium species amounts (dn/dw) and its direct effect on the measured quantity
+            const auto dndw = worker.sensitivity.dndw();
+            ArrayXr nseeded = n;
+            for(auto j = 0; j < numparams; ++j)
+            {
+                for(auto k = 0; k < nseeded.size(); ++k)
+                    nseeded[k][1] = dndw(k, worker.iw[j]);
+                autodiff::seed(worker.fitted[j].value());
+                props.update(T, P, nseeded);
+                J(i, j) = experiment.weight * grad(experiment.quantity(props));
+                autodiff::unseed(worker.fitted[j].value());
+            }
+        });
+
+        return std::all_of(success.begin(), success.end(), [](char x) { return x; });
+    }
+
+    auto fit() -> EquilibriumFitterResult
+    {
+        errorif(!select, "Expecting the parameters to be fitted to be specified with EquilibriumFitter::setParams.");
+
+        auto fitted = select(params); // the fitted parameters in the Params object given at construction
+
+        const auto m = experiments.size();
+        const auto k = fitted.size();
+
+        ArrayXd lower(k), upper(k), x(k);
+        for(auto j = 0; j < k; ++j)
+        {
+            x[j] = fitted[j].value().val();
+            lower[j] = fitted[j].lowerbound();
+            upper[j] = fitted[j].upperbound();
+        }
+
+        ArrayXd r(m), rnew(m);
+        MatrixXd J(m, k), Jnew(m, k);
+
+        const auto ok = residuals(x, r, J);
+        errorif(!ok, "Could not fit the parameters in EquilibriumFitter because the equilibrium calculations of some experiments failed with the initial parameter values.");
+
+        EquilibriumFitterResult result;
+
+        auto cost = 0.5 * r.matrix().squaredNorm();
+        auto lambda = options.damping;
+
+        for(result.iterations = 1; result.iterations <= options.maxiters; ++result.iterations)
+        {
+            const MatrixXd JtJ = J.transpose() * J;
+            const VectorXd g = J.transpose() * r.matrix();
+
+            if(cost == 0.0 || g.lpNorm<Eigen::Infinity>() == 0.0)
+            {
+                result.succeeded = true;
+                break;
+            }
+
+            // The damped normal equations of the Levenberg--Marquardt step (scaled with the diagonal of JtJ, which is kept positive)
+            MatrixXd A = JtJ;
+            A.diagonal() += lambda * JtJ.diagonal().cwiseMax(1e-12);
+
+            const VectorXd dx = A.ldlt().solve(-g);
+            const ArrayXd xnew = (x + dx.array()).max(lower).min(upper);
+
+            const auto oknew = residuals(xnew, rnew, Jnew);
+            const auto costnew = 0.5 * rnew.matrix().squaredNorm();
+
+            if(oknew && costnew < cost)
+            {
+                const auto decrease = (cost - costnew) / cost;
+                x = xnew;
+                r = rnew;
+                J = Jnew;
+                cost = costnew;
+                lambda = std::max(lambda / 10.0, 1e-12);
+                if(decrease <= options.tolerance)
+                {
+                    result.succeeded = true;
+                    break;
+                }
+            }
+            else lambda *= 10.0; // reject the step and increase the damping
+        }
+
+        result.iterations = std::min(result.iterations, options.maxiters);
+
+        // Write the fitted values back to the parameters given at construction
+        for(auto j = 0; j < k; ++j)
+            fitted[j].value() = x[j];
+
+        result.cost = cost;
+        result.values = x;
+        result.residuals = r;
+
+        return result;
+    }
+};
+
+EquilibriumFitter::EquilibriumFitter(Params const& params, Fn<ChemicalSystem(Params const&)> const& system)
+: pimpl(new Impl(params, system))
+{}
+
+EquilibriumFitter::EquilibriumFitter(EquilibriumFitter const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumFitter::~EquilibriumFitter()
+{}
+
+auto EquilibriumFitter::operator=(EquilibriumFitter other) -> EquilibriumFitter&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumFitter::setEquilibriumOptions(EquilibriumOptions const& options) -> void
+{
+    pimpl->eqoptions = options;
+    pimpl->resetWorkers();
+}
+
+auto EquilibriumFitter::setOptions(EquilibriumFitterOptions const& options) -> void
+{
+    pimpl->options = options;
+    pimpl->resetWorkers();
+}
+
+auto EquilibriumFitter::setParams(Fn<Vec<Param>(Params const&)> const& select) -> void
+{
+    pimpl->select = select;
+    pimpl->resetWorkers();
+}
+
+auto EquilibriumFitter::addExperiment(EquilibriumFitterExperiment const& experiment) -> void
+{
+    errorif(!experiment.state, "Expecting an initialized function that creates the chemical state of the experiment in EquilibriumFitter::addExperiment.");
+    errorif(!experiment.quantity, "Expecting an initialized function that computes the measured quantity of the experiment in EquilibriumFitter::addExperiment.");
+    pimpl->experiments.push_back(experiment);
+}
+
+auto EquilibriumFitter::numExperiments() const -> Index
+{
+    return pimpl->experiments.size();
+}
+
+auto EquilibriumFitter::residuals(ArrayXdConstRef values, ArrayXdRef r, MatrixXdRef J) -> bool
+{
+    return pimpl->residuals(values, r, J);
+}
+
+auto EquilibriumFitter::fit() -> EquilibriumFitterResult
+{
+    return pimpl->fit();
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,153 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+class ChemicalSystem;
+class Param;
+class Params;
+struct EquilibriumOptions;
+
+/// The data of an experiment used by EquilibriumFitter.
+/// The chemical state returned by #state provides the temperature, pressure
+/// and amounts of the elements of the experiment, for which the chemical
+/// equilibrium state of the system is computed. The quantity predicted by
+/// #quantity at this equilibrium state is then compared with the measured
+/// value #value.
+struct EquilibriumFitterExperiment
+{
+    /// The function that creates the initial chemical state of the experiment for a given chemical system.
+    Fn<ChemicalState(ChemicalSystem const&)> state;
+
+    /// The function that computes the measured quantity at the equilibrium state of the experiment.
+    Fn<real(ChemicalProps const&)> quantity;
+
+    /// The measured value of the quantity.
+    double value = 0.0;
+
+    /// The weight of the residual of this experiment in the fitting.
+    double weight = 1.0;
+};
+
+/// The options for the fitting of parameters with EquilibriumFitter.
+struct EquilibriumFitterOptions
+{
+    /// The maximum number of Levenberg--Marquardt iterations.
+    Index maxiters = 50;
+
+    /// The tolerance for the relative decrease of the sum of squared residuals at which the fitting stops.
+    double tolerance = 1e-10;
+
+    /// The initial damping factor of the Levenberg--Marquardt steps.
+    double damping = 1e-3;
+
+    /// The number of worker threads used to evaluate the experiments (if zero, the number of hardware threads is used).
+    unsigned threads = 0;
+};
+
+/// The result of the fitting of parameters with EquilibriumFitter.
+struct EquilibriumFitterResult
+{
+    /// The flag indicating if the fitting converged within the maximum number of iterations.
+    bool succeeded = false;
+
+    /// The number of Levenberg--Marquardt iterations performed.
+    Index iterations = 0;
+
+    /// The sum of squared weighted residuals at the fitted parameters, divided by two.
+    double cost = 0.0;
+
+    /// The fitted values of the parameters.
+    ArrayXd values;
+
+    /// The weighted residuals of the experiments at the fitted parameters.
+    ArrayXd residuals;
+};
+
+/// Used to fit model parameters to experimental data using chemical equilibrium calculations.
+/// The chemical system is created from a Params object (e.g., loaded from the
+/// embedded yaml files with Params::embedded) by a function given at
+/// construction, so that every worker thread evaluates the experiments with
+/// its own chemical system, parameters and equilibrium solver. The residuals
+/// of all experiments and their derivatives with respect to the fitted
+/// parameters are computed in parallel, using the sensitivity derivatives of
+/// the equilibrium states with respect to the parameters (see
+/// EquilibriumSensitivity), and the parameters are updated with
+/// Levenberg--Marquardt steps within their lower and upper bounds.
+class EquilibriumFitter
+{
+public:
+    /// Construct an EquilibriumFitter object.
+    /// @param params The model parameters, among which are those to be fitted.
+    /// @param system The function that creates the chemical system using given model parameters.
+    EquilibriumFitter(Params const& params, Fn<ChemicalSystem(Params const&)> const& system);
+
+    /// Construct a copy of an EquilibriumFitter object.
+    EquilibriumFitter(EquilibriumFitter const& other);
+
+    /// Destroy this EquilibriumFitter object.
+    ~EquilibriumFitter();
+
+    /// Assign a copy of an EquilibriumFitter object to this.
+    auto operator=(EquilibriumFitter other) -> EquilibriumFitter&;
+
+    /// Set the options of the equilibrium calculations.
+    auto setEquilibriumOptions(EquilibriumOptions const& options) -> void;
+
+    /// Set the options of the fitting.
+    auto setOptions(EquilibriumFitterOptions const& options) -> void;
+
+    /// Set the model parameters to be fitted.
+    /// The function is applied to the Params object given at construction and
+    /// to the copies of it used by the worker threads, and must return the
+    /// parameters to be fitted in the same order.
+    /// @param select The function that returns the parameters to be fitted in a Params object.
+    auto setParams(Fn<Vec<Param>(Params const&)> const& select) -> void;
+
+    /// Add an experiment to the fitting.
+    auto addExperiment(EquilibriumFitterExperiment const& experiment) -> void;
+
+    /// Return the number of experiments in the fitting.
+    auto numExperiments() const -> Index;
+
+    /// Compute the weighted residuals of all experiments and their derivatives with respect to the fitted parameters.
+    /// @param values The values of the fitted parameters.
+    /// @param[out] r The weighted residuals of the experiments.
+    /// @param[out] J The derivatives of the residuals with respect to the fitted parameters.
+    /// @return True if the equilibrium calculations of all experiments succeeded.
+    auto residuals(ArrayXdConstRef values, ArrayXdRef r, MatrixXdRef J) -> bool;
+
+    /// Fit the parameters to the experiments, starting from their current values in the Params object given at construction.
+    /// The fitted values are written back to the parameters in this Params object.
+    auto fit() -> EquilibriumFitterResult;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
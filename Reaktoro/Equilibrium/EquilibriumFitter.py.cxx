@@ -0,0 +1,75 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Params.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumFitter.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+using namespace Reaktoro;
+
+void exportEquilibriumFitter(py::module& m)
+{
+    py::class_<EquilibriumFitterExperiment>(m, "EquilibriumFitterExperiment")
+        .def(py::init<>())
+        .def_readwrite("state", &EquilibriumFitterExperiment::state)
+        .def_readwrite("quantity", &EquilibriumFitterExperiment::quantity)
+        .def_readwrite("value", &EquilibriumFitterExperiment::value)
+        .def_readwrite("weight", &EquilibriumFitterExperiment::weight)
+        ;
+
+    py::class_<EquilibriumFitterOptions>(m, "EquilibriumFitterOptions")
+        .def(py::init<>())
+        .def_readwrite("maxiters", &EquilibriumFitterOptions::maxiters)
+        .def_readwrite("tolerance", &EquilibriumFitterOptions::tolerance)
+        .def_readwrite("damping", &EquilibriumFitterOptions::damping)
+        .def_readwrite("threads", &EquilibriumFitterOptions::threads)
+        ;
+
+    py::class_<EquilibriumFitterResult>(m, "EquilibriumFitterResult")
+        .def(py::init<>())
+        .def_readwrite("succeeded", &EquilibriumFitterResult::succeeded)
+        .def_readwrite("iterations", &EquilibriumFitterResult::iterations)
+        .def_readwrite("cost", &EquilibriumFitterResult::cost)
+        .def_readwrite("values", &EquilibriumFitterResult::values)
+        .def_readwrite("residuals", &EquilibriumFitterResult::residuals)
+        ;
+
+    auto residuals = [](EquilibriumFitter& self, ArrayXdConstRef values)
+    {
+        ArrayXd r(self.numExperiments());
+        MatrixXd J(self.numExperiments(), values.size());
+        const auto succeeded = self.residuals(values, r, J);
+        return std::make_tuple(r, J, succeeded);
+    };
+
+    py::class_<EquilibriumFitter>(m, "EquilibriumFitter")
+        .def(py::init<Params const&, Fn<ChemicalSystem(Params const&)> const&>())
+        .def("setEquilibriumOptions", &EquilibriumFitter::setEquilibriumOptions)
+        .def("setOptions", &EquilibriumFitter::setOptions)
+        .def("setParams", &EquilibriumFitter::setParams)
+        .def("addExperiment", &EquilibriumFitter::addExperiment)
+        .def("numExperiments", &EquilibriumFitter::numExperiments)
+        .def("residuals", residuals, "Return the weighted residuals of the experiments, their derivatives with respect to the fitted parameters, and whether all equilibrium calculations succeeded.")
+        .def("fit", &EquilibriumFitter::fit, py::call_guard<py::gil_scoped_release>(), "Fit the parameters to the experiments using Levenberg-Marquardt steps.")
+        ;
+}
@@ -0,0 +1,118 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Params.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumFitter.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing EquilibriumFitter", "[EquilibriumFitter]")
+{
+    // The function that creates the chemical system with the standard Gibbs energy of OH- taken from given parameters
+    auto createSystem = [](Params const& params)
+    {
+        const auto db = Database({
+            Species("H2O").withStandardGibbsEnergy(-237181.72),
+            Species("H+" ).withStandardGibbsEnergy(      0.00),
+            Species("OH-").withStandardGibbsEnergy(params["G0"].asParam()),
+            Species("H2" ).withStandardGibbsEnergy(  17723.42),
+            Species("O2" ).withStandardGibbsEnergy(  16543.54),
+        });
+
+        return ChemicalSystem(db, AqueousPhase("H2O H+ OH- H2 O2"));
+    };
+
+    auto createState = [](ChemicalSystem const& system, double T)
+    {
+        ChemicalState state(system);
+        state.temperature(T, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O", 55.0, "mol");
+        return state;
+    };
+
+    auto lgaH = [](ChemicalProps const& props) { return props.speciesActivityLg("H+"); };
+
+    const auto G0expected = -157297.48;
+
+    Data truedata;
+    truedata.add("G0", Param(G0expected));
+
+    ChemicalSystem truesystem = createSystem(Params(truedata));
+
+    EquilibriumSolver truesolver(truesystem);
+
+    Data data;
+    data.add("G0", Param(-150000.0));
+
+    Params params(data);
+
+    EquilibriumFitterOptions options;
+    options.threads = 2;
+
+    EquilibriumFitter fitter(params, createSystem);
+    fitter.setOptions(options);
+    fitter.setParams([](Params const& params) { return Vec<Param>{ params["G0"].asParam() }; });
+
+    for(auto T : { 25.0, 50.0, 75.0, 100.0 })
+    {
+        ChemicalState truestate = createState(truesystem, T);
+        REQUIRE( truesolver.solve(truestate).succeeded() );
+
+        EquilibriumFitterExperiment experiment;
+        experiment.state = [=](ChemicalSystem const& system) { return createState(system, T); };
+        experiment.quantity = lgaH;
+        experiment.value = ChemicalProps(truestate).speciesActivityLg("H+").val();
+
+        fitter.addExperiment(experiment);
+    }
+
+    CHECK( fitter.numExperiments() == 4 );
+
+    SECTION("Checking the residual derivatives against finite differences")
+    {
+        const auto G0 = -155000.0;
+        const auto h = 1.0;
+
+        ArrayXd r(4), rh(4);
+        MatrixXd J(4, 1), Jh(4, 1);
+
+        REQUIRE( fitter.residuals(ArrayXd::Constant(1, G0), r, J) );
+        REQUIRE( fitter.residuals(ArrayXd::Constant(1, G0 + h), rh, Jh) );
+
+        for(auto i = 0; i < 4; ++i)
+            CHECK( J(i, 0) == Approx((rh[i] - r[i])/h).epsilon(1e-4) );
+    }
+
+    SECTION("Checking the fitted parameter")
+    {
+        const auto result = fitter.fit();
+
+        CHECK( result.succeeded );
+        CHECK( result.values[0] == Approx(G0expected) );
+        CHECK( params["G0"].asParam().value() == Approx(G0expected) ); // the fitted value is written back to the given parameters
+        CHECK( result.cost == Approx(0.0).margin(1e-12) );
+    }
+}
@@ -0,0 +1,255 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "EquilibriumGrid.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+
+namespace Reaktoro {
+
+struct EquilibriumGrid::Impl
+{
+    /// The chemical equilibrium specifications of the calculations.
+    const EquilibriumSpecs specs;
+
+    /// The options of the equilibrium calculations.
+    EquilibriumOptions options;
+
+    /// The number of grid points along each side of a tile.
+    Index tilesize = 16;
+
+    /// The names of the registered quantities.
+    Strings names;
+
+    /// The functions evaluating the registered quantities.
+    Vec<Fn<real(ChemicalProps const&)>> quantities;
+
+    /// The number of grid points along the first and second axes.
+    Index nx = 0, ny = 0;
+
+    /// The values of the registered quantities at every grid point (one column per quantity).
+    ArrayXXd data;
+
+    /// The flags indicating if the calculation at every grid point succeeded (stored as bytes so that workers can write them concurrently).
+    Vec<char> success;
+
+    /// The number of iterations of the calculation at every grid point.
+    ArrayXl iters;
+
+    /// The equilibrium solvers used by each worker thread.
+    Vec<EquilibriumSolver> solvers;
+
+    /// The pool of worker threads (created on first use).
+    SharedPtr<ThreadPool> pool;
+
+    Impl(EquilibriumSpecs const& specs)
+    : specs(specs)
+    {}
+
+    Impl(Impl const& other)
+    : specs(other.specs), options(other.options), tilesize(other.tilesize),
+      names(other.names), quantities(other.quantities), nx(other.nx), ny(other.ny),
+      data(other.data), success(other.success), iters(other.iters)
+    {}
+
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(options.threads);
+
+        if(solvers.size() == pool->numThreads())
+            return;
+
+        EquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        solvers.clear();
+        solvers.resize(pool->numThreads(), solver);
+    }
+
+    auto solve(ChemicalState const& state0, EquilibriumConditions const& conditions, String const& xinput, ArrayXdConstRef const& xvalues, String const& yinput, ArrayXdConstRef const& yvalues) -> void
+    {
+        const auto ix = conditions.inputIndex(xinput);
+        const auto iy = conditions.inputIndex(yinput);
+
+        nx = xvalues.size();
+        ny = yvalues.size();
+
+        data.resize(nx * ny, quantities.size());
+        success.assign(nx * ny, false);
+        iters.setZero(nx * ny);
+
+        if(nx == 0 || ny == 0)
+            return;
+
+        initializeWorkers();
+
+        const auto ts = std::max<Index>(tilesize, 1);
+        const auto ntx = (nx + ts - 1) / ts;
+        const auto nty = (ny + ts - 1) / ts;
+
+        // The equilibrium states at the end of the first row and at the start of the last row of each tile, which seed the tiles to its right and above it
+        Vec<ChemicalState> seedsright(ntx * nty, state0);
+        Vec<ChemicalState> seedstop(ntx * nty, state0);
+
+        // Solve the tile with index (tx, ty) using worker `iworker`
+        auto solveTile = [&](Index tx, Index ty, Index iworker)
+        {
+            auto& solver = solvers[iworker];
+
+            EquilibriumConditions xconditions(conditions);
+
+            const auto x0 = tx * ts, x1 = std::min(x0 + ts, nx);
+            const auto y0 = ty * ts, y1 = std::min(y0 + ts, ny);
+
+            // Start from the neighbouring tile on the left, or else the one below, or else the given initial state
+            ChemicalState const& seed =
+                tx > 0 ? seedsright[(tx - 1) + ty * ntx] :
+                ty > 0 ? seedstop[tx + (ty - 1) * ntx] : state0;
+
+            ChemicalState rowstart(seed); // the equilibrium state at the start of the previous row
+            ChemicalState state(seed);
+
+            for(auto j = y0; j < y1; ++j)
+            {
+                state = rowstart; // the first point of a row starts from the first point of the row below
+
+                for(auto i = x0; i < x1; ++i)
+                {
+                    const auto k = i + j * nx;
+
+                    xconditions.setInputVariable(ix, xvalues[i]);
+                    xconditions.setInputVariable(iy, yvalues[j]);
+
+                    const auto result = solver.solve(state, xconditions);
+
+                    success[k] = result.succeeded();
+                    iters[k] = result.iterations();
+
+                    for(auto q = 0; q < quantities.size(); ++q)
+                        data(k, q) = quantities[q](state.props()).val();
+
+                    if(result.failed())
+                        state = rowstart; // do not start the next point from a failed calculation
+
+                    if(i == x0 && result.succeeded())
+                        rowstart = state;
+
+                    if(i == x1 - 1 && j == y0)
+                        seedsright[tx + ty * ntx] = state;
+                }
+
+                if(j == y1 - 1)
+                    seedstop[tx + ty * ntx] = rowstart;
+            }
+        };
+
+        // Process the tiles along each anti-diagonal tx + ty = d in parallel
+        for(Index d = 0; d < ntx + nty - 1; ++d)
+        {
+            const auto txmin = d < nty ? 0 : d - nty + 1;
+            const auto txmax = std::min(d, ntx - 1);
+
+            pool->parallelFor(txmax - txmin + 1, [&](Index t, Index iworker)
+            {
+                const auto tx = txmin + t;
+                solveTile(tx, d - tx, iworker);
+            });
+        }
+    }
+};
+
+EquilibriumGrid::EquilibriumGrid(EquilibriumSpecs const& specs)
+: pimpl(new Impl(specs))
+{}
+
+EquilibriumGrid::EquilibriumGrid(EquilibriumGrid const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumGrid::~EquilibriumGrid()
+{}
+
+auto EquilibriumGrid::operator=(EquilibriumGrid other) -> EquilibriumGrid&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumGrid::setOptions(EquilibriumOptions const& options) -> void
+{
+    pimpl->options = options;
+    pimpl->solvers.clear();
+    pimpl->pool.reset();
+}
+
+auto EquilibriumGrid::setTileSize(Index size) -> void
+{
+    errorif(size == 0, "The tile size in EquilibriumGrid must be positive.");
+    pimpl->tilesize = size;
+}
+
+auto EquilibriumGrid::add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void
+{
+    pimpl->names.push_back(name);
+    pimpl->quantities.push_back(quantity);
+}
+
+auto EquilibriumGrid::solve(ChemicalState const& state0, EquilibriumConditions const& conditions, String const& xinput, ArrayXdConstRef const& xvalues, String const& yinput, ArrayXdConstRef const& yvalues) -> void
+{
+    pimpl->solve(state0, conditions, xinput, xvalues, yinput, yvalues);
+}
+
+auto EquilibriumGrid::numPointsX() const -> Index
+{
+    return pimpl->nx;
+}
+
+auto EquilibriumGrid::numPointsY() const -> Index
+{
+    return pimpl->ny;
+}
+
+auto EquilibriumGrid::values(String const& name) const -> ArrayXdConstRef
+{
+    const auto idx = index(pimpl->names, name);
+    errorif(idx >= pimpl->names.size(), "There is no quantity named `", name, "` registered in this EquilibriumGrid object.");
+    return pimpl->data.col(idx);
+}
+
+auto EquilibriumGrid::succeeded() const -> Vec<bool>
+{
+    return Vec<bool>(pimpl->success.begin(), pimpl->success.end());
+}
+
+auto EquilibriumGrid::iterations() const -> ArrayXlConstRef
+{
+    return pimpl->iters;
+}
+
+} // namespace Reaktoro
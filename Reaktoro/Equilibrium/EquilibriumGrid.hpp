@@ -0,0 +1,106 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+class EquilibriumConditions;
+class EquilibriumSpecs;
+struct EquilibriumOptions;
+
+/// Used to compute chemical equilibrium states over a two-dimensional grid of input conditions (e.g., a phase diagram or property map).
+/// Two input variables of the equilibrium specifications (e.g., `T` and `P`,
+/// or `pH` and `lnfO2`) are varied along the axes of the grid, while all
+/// other conditions are kept fixed. The grid is split into square tiles,
+/// which are processed in wavefront order: the tiles along each
+/// anti-diagonal are independent and are solved in parallel (see
+/// EquilibriumOptions::threads). Each point starts from an equilibrium
+/// state already computed at a neighbouring point, and the first point of
+/// each tile starts from a neighbouring tile. The quantities registered with
+/// @ref add are evaluated at every point and stored in one contiguous array
+/// per quantity.
+class EquilibriumGrid
+{
+public:
+    /// Construct an EquilibriumGrid object with given chemical equilibrium specifications.
+    explicit EquilibriumGrid(EquilibriumSpecs const& specs);
+
+    /// Construct a copy of an EquilibriumGrid object.
+    EquilibriumGrid(EquilibriumGrid const& other);
+
+    /// Destroy this EquilibriumGrid object.
+    ~EquilibriumGrid();
+
+    /// Assign a copy of an EquilibriumGrid object to this.
+    auto operator=(EquilibriumGrid other) -> EquilibriumGrid&;
+
+    /// Set the options of the equilibrium calculations.
+    auto setOptions(EquilibriumOptions const& options) -> void;
+
+    /// Set the number of grid points along each side of a tile (default: 16).
+    auto setTileSize(Index size) -> void;
+
+    /// Register a quantity to be evaluated at every grid point.
+    /// The function is called concurrently from the worker threads, so it
+    /// must not modify shared data. Aqueous properties can be evaluated with
+    /// AqueousProps::compute(props), whose cache is per thread.
+    /// @param name The name of the quantity.
+    /// @param quantity The function that evaluates the quantity for given chemical properties.
+    auto add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void;
+
+    /// Compute the equilibrium states over the grid.
+    /// @param state0 The initial guess for the first point of the grid
+    /// @param conditions The equilibrium conditions at every point, except for the two input variables varied along the axes
+    /// @param xinput The name of the input variable varied along the first axis
+    /// @param xvalues The values of the input variable along the first axis
+    /// @param yinput The name of the input variable varied along the second axis
+    /// @param yvalues The values of the input variable along the second axis
+    auto solve(ChemicalState const& state0, EquilibriumConditions const& conditions, String const& xinput, ArrayXdConstRef const& xvalues, String const& yinput, ArrayXdConstRef const& yvalues) -> void;
+
+    /// Return the number of grid points along the first axis in the last calculation.
+    auto numPointsX() const -> Index;
+
+    /// Return the number of grid points along the second axis in the last calculation.
+    auto numPointsY() const -> Index;
+
+    /// Return the values of a registered quantity at every grid point.
+    /// The value at the point *(i, j)* is at index *i + j × nx*, where *nx* is
+    /// the number of points along the first axis.
+    auto values(String const& name) const -> ArrayXdConstRef;
+
+    /// Return the flags indicating if the calculation at every grid point succeeded (ordered as in @ref values).
+    auto succeeded() const -> Vec<bool>;
+
+    /// Return the number of iterations of the calculation at every grid point (ordered as in @ref values).
+    auto iterations() const -> ArrayXlConstRef;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
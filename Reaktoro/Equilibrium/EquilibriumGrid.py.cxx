@@ -0,0 +1,45 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumGrid.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+using namespace Reaktoro;
+
+void exportEquilibriumGrid(py::module& m)
+{
+    py::class_<EquilibriumGrid>(m, "EquilibriumGrid")
+        .def(py::init<EquilibriumSpecs const&>())
+        .def("setOptions", &EquilibriumGrid::setOptions)
+        .def("setTileSize", &EquilibriumGrid::setTileSize)
+        .def("add", &EquilibriumGrid::add)
+        .def("solve", &EquilibriumGrid::solve, py::call_guard<py::gil_scoped_release>(), "Compute the equilibrium states over a two-dimensional grid of values of two input variables.", py::arg("state0"), py::arg("conditions"), py::arg("xinput"), py::arg("xvalues"), py::arg("yinput"), py::arg("yvalues"))
+        .def("numPointsX", &EquilibriumGrid::numPointsX)
+        .def("numPointsY", &EquilibriumGrid::numPointsY)
+        .def("values", &EquilibriumGrid::values, py::return_value_policy::reference_internal)
+        .def("succeeded", &EquilibriumGrid::succeeded)
+        .def("iterations", &EquilibriumGrid::iterations, py::return_value_policy::reference_internal)
+        ;
+}
@@ -0,0 +1,112 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumGrid.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing EquilibriumGrid", "[EquilibriumGrid]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(25.0, "celsius");
+    conditions.pressure(1.0, "bar");
+    conditions.pH(7.0);
+
+    ChemicalState state0(system);
+    state0.set("H2O", 55.0, "mol");
+    state0.set("NaCl", 0.1, "mol");
+
+    const ArrayXd Ts = ArrayXd::LinSpaced(7, 298.15, 358.15);
+    const ArrayXd pHs = ArrayXd::LinSpaced(5, 3.0, 11.0);
+
+    EquilibriumOptions options;
+    options.threads = 2;
+
+    EquilibriumGrid grid(specs);
+    grid.setOptions(options);
+    grid.setTileSize(3);
+    grid.add("n[Na+]", [](ChemicalProps const& props) { return props.speciesAmount("Na+"); });
+    grid.add("n[H+]", [](ChemicalProps const& props) { return props.speciesAmount("H+"); });
+
+    grid.solve(state0, conditions, "T", Ts, "pH", pHs);
+
+    REQUIRE( grid.numPointsX() == Ts.size() );
+    REQUIRE( grid.numPointsY() == pHs.size() );
+
+    const auto nNa = grid.values("n[Na+]");
+    const auto nH = grid.values("n[H+]");
+    const auto succeeded = grid.succeeded();
+
+    REQUIRE( nNa.size() == Ts.size() * pHs.size() );
+
+    // Compare with equilibrium calculations performed one point at a time
+    EquilibriumSolver solver(specs);
+    for(auto j = 0; j < pHs.size(); ++j)
+    {
+        for(auto i = 0; i < Ts.size(); ++i)
+        {
+            const auto k = i + j * Ts.size();
+
+            ChemicalState state(state0);
+            conditions.temperature(Ts[i]);
+            conditions.pH(pHs[j]);
+            REQUIRE( solver.solve(state, conditions).succeeded() );
+
+            CHECK( succeeded[k] );
+            CHECK( nNa[k] == Approx(state.speciesAmount("Na+")) );
+            CHECK( nH[k] == Approx(state.speciesAmount("H+")) );
+        }
+    }
+
+    CHECK_THROWS( grid.values("n[Cl-]") );
+}
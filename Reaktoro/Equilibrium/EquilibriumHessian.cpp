@@ -43,9 +43,36 @@ struct EquilibriumHessian::Impl
     /// The auxiliary vector to compute the diagonal of ∂(µ/RT)/∂n.
     VectorXd dudn_diag;
 
+    /// The possible structures of the non-zero entries in ∂(µ/RT)/∂n.
+    enum class Structure { Dense, BlockDiagonal, Diagonal };
+
+    /// The structure of the entries in #dudn that may be non-zero after its last evaluation.
+    /// With this, the approximate and diagonal evaluations reset only the
+    /// entries that may be non-zero, instead of the whole matrix, whose
+    /// size grows quadratically with the number of species.
+    Structure structure = Structure::Dense;
+
     /// The auxiliary vector of species amounts.
     VectorXr n;
 
+    /// The differences in species amounts between successive calls to quasiNewton (most recent last).
+    Deque<VectorXd> secants_s;
+
+    /// The differences in µ/RT between successive calls to quasiNewton that are not captured by the ideal approximation (most recent last).
+    Deque<VectorXd> secants_r;
+
+    /// The species amounts in the last call to quasiNewton.
+    VectorXd nlast;
+
+    /// The values of µ/RT in the last call to quasiNewton.
+    VectorXd ulast;
+
+    /// The temperature and pressure in the last call to quasiNewton.
+    double Tlast = 0.0, Plast = 0.0;
+
+    /// The auxiliary vectors used in the quasi-Newton updates.
+    VectorXd sk, rk, vk;
+
     /// The functions for each phase that assemble the block of approximate derivatives in ∂(µ/RT)/∂n.
     Vec<Fn<void(VectorXrConstRef, MatrixXdRef)>> approxfuncs;
 
@@ -117,6 +144,7 @@ struct EquilibriumHessian::Impl
         };
         const double RT = universalGasConstant * T;
         dudn.noalias() = jacobian(fn, wrt(n), at(n))/RT;
+        structure = Structure::Dense;
         return dudn;
     }
 
@@ -129,14 +157,17 @@ struct EquilibriumHessian::Impl
             return props.speciesChemicalPotentials();
         };
         const double RT = universalGasConstant * T;
-        dudn = approximate(n);
+        approximate(n);
         dudn(Eigen::all, idxs) = jacobian(fn, wrt(n(idxs)), at(n))/RT;
+        structure = Structure::Dense;
         return dudn;
     }
 
     auto approximate(VectorXrConstRef const& n) -> MatrixXdConstRef
     {
-        dudn.fill(0.0); // clear previous state of dudn
+        if(structure == Structure::Dense)
+            dudn.fill(0.0); // clear previous state of dudn (the entries outside the phase blocks are already zero otherwise, and the blocks are overwritten below)
+        structure = Structure::BlockDiagonal;
         const auto numphases = system.phases().size();
         auto offset = 0;
         for(auto i = 0; i < numphases; ++i)
@@ -152,7 +183,8 @@ struct EquilibriumHessian::Impl
 
     auto diagonal(VectorXrConstRef const& n) -> MatrixXdConstRef
     {
-        dudn.fill(0.0); // clear previous state of dudn
+        if(structure == Structure::Dense)
+            dudn.fill(0.0); // clear previous state of dudn
         const auto numphases = system.phases().size();
         auto offset = 0;
         for(auto i = 0; i < numphases; ++i)
@@ -160,10 +192,68 @@ struct EquilibriumHessian::Impl
             const auto length = system.phase(i).species().size();
             const auto np = n.segment(offset, length);
             const auto dupdnp_diag = dudn_diag.segment(offset, length);
+            if(structure == Structure::BlockDiagonal)
+                dudn.block(offset, offset, length, length).fill(0.0); // clear only the phase blocks, the only entries possibly non-zero
             approxfuncsdiag[i](np, dupdnp_diag);
             offset += length;
         }
         dudn.diagonal() = dudn_diag;
+        structure = Structure::Diagonal;
+        return dudn;
+    }
+
+    auto quasiNewton(real const& T, real const& P, VectorXrConstRef const& n, VectorXdConstRef const& u, Index memory) -> MatrixXdConstRef
+    {
+        // Discard the secant pairs if they were collected at different temperature or pressure
+        if(T != Tlast || P != Plast || nlast.size() != n.size())
+        {
+            secants_s.clear();
+            secants_r.clear();
+        }
+        else
+        {
+            sk = n.cast<double>() - nlast;
+            if(sk.norm() > 0.0)
+            {
+                approximate(n);
+                rk = u - ulast - dudn * sk; // the change in µ/RT not captured by the ideal approximation
+                secants_s.push_back(sk);
+                secants_r.push_back(rk);
+            }
+        }
+
+        while(secants_s.size() > memory)
+        {
+            secants_s.pop_front();
+            secants_r.pop_front();
+        }
+
+        Tlast = T.val();
+        Plast = P.val();
+        nlast = n.cast<double>();
+        ulast = u;
+
+        // Start with the ideal approximation and correct it with the non-ideal secant information
+        approximate(n);
+
+        if(secants_s.empty())
+            return dudn;
+
+        MatrixXd C = MatrixXd::Zero(n.size(), n.size());
+
+        for(auto k = 0; k < secants_s.size(); ++k)
+        {
+            auto const& s = secants_s[k];
+            auto const& r = secants_r[k];
+            vk.noalias() = r - C * s;
+            const auto denom = vk.dot(s);
+            if(std::abs(denom) > 1e-8 * vk.norm() * s.norm()) // skip the update if it is ill-defined (standard SR1 safeguard)
+                C.noalias() += vk * vk.transpose() / denom;
+        }
+
+        dudn += C;
+        structure = Structure::Dense;
+
         return dudn;
     }
 };
@@ -208,4 +298,9 @@ auto EquilibriumHessian::diagonal(VectorXrConstRef const& n) -> MatrixXdConstRef
     return pimpl->diagonal(n);
 }
 
+auto EquilibriumHessian::quasiNewton(real const& T, real const& P, VectorXrConstRef const& n, VectorXdConstRef const& u, Index memory) -> MatrixXdConstRef
+{
+    return pimpl->quasiNewton(T, P, n, u, memory);
+}
+
 } // namespace Reaktoro
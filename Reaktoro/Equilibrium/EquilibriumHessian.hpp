@@ -70,6 +70,21 @@ public:
     /// diagonal entries from the matrix produced with @ref dudnApproximate.
     auto diagonal(VectorXrConstRef const& n) -> MatrixXdConstRef;
 
+    /// Evaluate the Hessian matrix *∂(µ/RT)/∂n* using a limited-memory quasi-Newton approximation.
+    /// The approximation is the matrix produced with @ref approximate plus a
+    /// correction for non-ideal effects. The correction is built with
+    /// symmetric rank-one (SR1) updates from the last `memory` secant pairs,
+    /// which are collected from the changes in *n* and *µ/RT* between
+    /// successive calls to this method. SR1 is used instead of BFGS because the
+    /// non-ideal correction need not be positive definite. The recorded pairs
+    /// are discarded whenever temperature or pressure change between calls.
+    /// @param T The temperature of the system (in K)
+    /// @param P The pressure of the system (in Pa)
+    /// @param n The amounts of the species in the system (in mol)
+    /// @param u The chemical potentials of the species normalized by *RT* at *n*
+    /// @param memory The maximum number of secant pairs used in the approximation
+    auto quasiNewton(real const& T, real const& P, VectorXrConstRef const& n, VectorXdConstRef const& u, Index memory) -> MatrixXdConstRef;
+
 private:
     struct Impl;
 
@@ -111,4 +111,48 @@ TEST_CASE("Testing EquilibriumHessian", "[EquilibriumHessian]")
         INFO("dudn_partially_exact(expected) = \n" << dudn_partially_exact_expected);
         CHECK( dudn_partially_exact.isApprox(dudn_partially_exact_expected) );
     }
+
+    SECTION("testing EquilibriumHessian evaluations of different kinds in sequence")
+    {
+        // Each evaluation must clear the entries left by a previous evaluation of another kind
+        CHECK( MatrixXd(hessian.approximate(n)).isApprox(dudn_approx_expected) );
+        CHECK( MatrixXd(hessian.diagonal(n)).isApprox(dudn_diag_expected) );
+        CHECK( MatrixXd(hessian.exact(T, P, n)).isApprox(dudn_exact_expected) );
+        CHECK( MatrixXd(hessian.diagonal(n)).isApprox(dudn_diag_expected) );
+        CHECK( MatrixXd(hessian.approximate(n)).isApprox(dudn_approx_expected) );
+        CHECK( MatrixXd(hessian.partiallyExact(T, P, n, idxs)).isApprox(dudn_partially_exact_expected) );
+        CHECK( MatrixXd(hessian.approximate(n)).isApprox(dudn_approx_expected) );
+    }
+
+    SECTION("testing EquilibriumHessian::quasiNewton")
+    {
+        auto u_fn = [&](VectorXrConstRef n) -> VectorXd
+        {
+            ChemicalProps props(system);
+            props.update(T, P, n);
+            return (props.speciesChemicalPotentials()/RT).cast<double>();
+        };
+
+        // The first call has no secant information and should produce the ideal approximation
+        MatrixXd dudn_qn0 = hessian.quasiNewton(T, P, n, u_fn(n), 5);
+        CHECK( dudn_qn0.isApprox(dudn_approx_expected) );
+
+        // The next call should satisfy the secant condition for the last step
+        VectorXr n1 = n;
+        n1.array() *= 1.01;
+        n1[0] += 0.001;
+
+        const VectorXd s = (n1 - n.matrix()).cast<double>();
+        const VectorXd y = u_fn(n1) - u_fn(n);
+
+        MatrixXd dudn_qn1 = hessian.quasiNewton(T, P, n1, u_fn(n1), 5);
+        INFO("dudn_qn1*s = \n" << dudn_qn1*s);
+        INFO("y = \n" << y);
+        CHECK( (dudn_qn1*s).isApprox(y) );
+        CHECK( dudn_qn1.isApprox(dudn_qn1.transpose()) );
+
+        // A change in temperature should discard the secant pairs
+        MatrixXd dudn_qn2 = hessian.quasiNewton(T + 1.0, P, n1, u_fn(n1), 5);
+        CHECK( dudn_qn2.isApprox(hessian.approximate(n1)) );
+    }
 }
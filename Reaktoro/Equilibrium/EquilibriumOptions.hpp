@@ -20,6 +20,9 @@
 // Optima includes
 #include <Optima/Options.hpp>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
 namespace Reaktoro {
 
 /// The options for the description of the Hessian of the Gibbs energy function
@@ -36,6 +39,23 @@ enum class GibbsHessian
 
     /// The Hessian of the Gibbs energy function is a diagonal matrix approximation using ideal thermodynamic models.
     ApproxDiagonal,
+
+    /// The Hessian of the Gibbs energy function is approximated using ideal thermodynamic models corrected with limited-memory SR1 quasi-Newton updates.
+    QuasiNewton,
+};
+
+/// The sources of the initial guesses of the calculations in batched chemical equilibrium calculations.
+/// @see EquilibriumOptions::warm_start
+enum class EquilibriumWarmStart
+{
+    /// The initial guess of a calculation is its own chemical state (e.g., the one computed at the previous time step).
+    PreviousStep,
+
+    /// The initial guess of a calculation is the equilibrium state just computed for the previous one in the batch (e.g., the neighbour cell), including its Lagrange multipliers and control variables.
+    Neighbour,
+
+    /// The initial guess of a calculation is a first-order Taylor prediction from the equilibrium state just computed for the previous one in the batch (see EquilibriumPredictor).
+    Predicted,
 };
 
 /// The options for the equilibrium calculations
@@ -64,8 +84,209 @@ struct EquilibriumOptions
     /// The flag indicating if ideal activity models should be used in the calculations.
     bool use_ideal_activity_models = false;
 
+    /// The flag indicating if cold-start calculations should first be converged with ideal activity models.
+    /// A calculation starts cold when the chemical state has no equilibrium
+    /// data from a previous calculation with the same specifications (e.g.,
+    /// Lagrange multipliers), which can take several times more iterations
+    /// than a warm start with non-ideal activity models (e.g., Pitzer or
+    /// cubic equations of state). When enabled, such a calculation is first
+    /// converged with ideal activity models, which are cheap to evaluate, and
+    /// then continued from there with the full activity models. If the
+    /// preliminary calculation fails, the full one starts from the original
+    /// initial guess. This has no effect if @ref use_ideal_activity_models is
+    /// enabled.
+    bool ideal_presolve = false;
+
+    /// The convergence tolerance of the preliminary calculations with ideal activity models (see @ref ideal_presolve), or zero for that in @ref optima.
+    /// A loose tolerance is usually enough, since the solution with ideal
+    /// activity models only needs to be close to the non-ideal one.
+    double ideal_presolve_tolerance = 0.0;
+
     /// The calculation mode of the Hessian of the Gibbs energy function
     GibbsHessian hessian = GibbsHessian::PartiallyExact;
+
+    /// The maximum number of secant pairs kept when the Hessian of the Gibbs energy function is computed with GibbsHessian::QuasiNewton.
+    Index quasi_newton_memory = 10;
+
+    /// The flag indicating if the Hessian matrix of the Gibbs energy function should be assembled phase by phase.
+    /// When enabled, the derivatives of the chemical potentials with respect
+    /// to the amount of a species are computed by re-evaluating only the
+    /// properties of the phase containing that species. This assumes that the
+    /// chemical potentials of the species in a phase depend only on the
+    /// amounts of the species in that same phase, which holds for most
+    /// activity models, but not, for example, for ion exchange phases whose
+    /// activity models depend on the aqueous phase. This is only used when
+    /// temperature and pressure are known (i.e., when there are no *p* control
+    /// variables), and when the Hessian is either exact or partially exact.
+    /// Phases with a single species, and phases whose activity models provide
+    /// analytic derivatives (see ActivityModelJacobian), are not re-evaluated
+    /// at all, since their blocks are then computed directly.
+    bool use_block_sparse_hessian = false;
+
+    /// The flag indicating if phases whose species amounts have not changed since the last evaluation should be skipped when evaluating the chemical properties.
+    /// During the iterations of an equilibrium calculation, the species in
+    /// unstable phases (e.g., minerals that should not exist at equilibrium)
+    /// are pinned at their lower bounds, so that the properties of these
+    /// phases need not be recomputed as long as temperature, pressure and
+    /// other input variables do not change. Because only phases whose
+    /// properties would be identical are skipped, this introduces no
+    /// approximation under the same assumption described in @ref
+    /// use_block_sparse_hessian. This is useful for systems with many
+    /// candidate mineral phases of which only a few are stable.
+    bool prune_inactive_phases = false;
+
+    /// The temperature band (in K) within which the standard thermodynamic properties of the species are extrapolated from a reference temperature.
+    /// When positive, the standard thermodynamic properties of the species are
+    /// not computed again whenever temperature changes. Instead, they are computed with
+    /// their temperature derivatives at a reference temperature and
+    /// extrapolated with Taylor expansions while temperature stays within
+    /// this band from it (see ChemicalProps::extrapolateStandardThermoProps).
+    /// This is useful when temperature is unknown in the calculation (e.g.,
+    /// with given enthalpy and pressure, or internal energy and volume), in
+    /// which case it changes at every iteration.
+    /// Extrapolated values introduce small errors in the computed equilibrium
+    /// state, of the order of the third power of this band, so it should be
+    /// kept small (e.g., a few kelvins). This has no effect when model
+    /// parameters are input variables. Zero disables the extrapolation.
+    double standard_thermo_taylor_band = 0.0;
+
+    /// The maximum number of species amounts seeded at once when computing the Hessian of the Gibbs energy function.
+    /// With a value greater than one, the amounts of up to this many species,
+    /// each from a different phase, are seeded in the same evaluation of the
+    /// chemical properties. The derivatives of the chemical potentials with
+    /// respect to each seeded amount are then recovered from the rows of its
+    /// phase. This reduces the number of evaluations of the chemical
+    /// properties of the whole system by approximately this factor, under the
+    /// same assumption described in @ref use_block_sparse_hessian. It is not
+    /// used when the sensitivity derivatives of the chemical properties are
+    /// being assembled, and it has no effect if @ref use_block_sparse_hessian
+    /// is enabled, in which case phases are already evaluated individually.
+    unsigned jacobian_seeds = 1;
+
+    /// The relative perturbation of the species amounts used to compute the Hessian of the Gibbs energy function with finite differences, or zero to use automatic differentiation.
+    /// This is useful when some activity or standard thermodynamic models
+    /// wrap external codes that do not propagate automatic derivatives, in
+    /// which case automatic differentiation produces zero or wrong Hessian
+    /// entries. The species are grouped into colors, each containing at most
+    /// one species from every phase, and the amounts of all species in a color
+    /// are perturbed in the same evaluation of the chemical properties. The
+    /// derivatives of the chemical potentials with respect to each perturbed
+    /// amount are then recovered from the rows of its phase, under the same
+    /// assumption described in @ref use_block_sparse_hessian. The number of
+    /// evaluations of the chemical properties is thus the number of species
+    /// in the largest phase. This is only used when temperature and pressure
+    /// are known (i.e., when there are no *p* control variables), when the
+    /// Hessian is either exact or partially exact, and when the sensitivity
+    /// derivatives of the chemical properties are not being assembled.
+    /// A value around `1e-7` is usually adequate.
+    double jacobian_finite_differences = 0.0;
+
+    /// The number of threads evaluating the colors concurrently in the finite difference computation of the Hessian (see @ref jacobian_finite_differences).
+    /// If zero, the number of hardware threads available is used.
+    unsigned jacobian_threads = 1;
+
+    /// The maximum number of consecutive evaluations of the derivatives with respect to the species amounts that can be skipped by reusing previously computed ones.
+    /// With a positive value, a modified Newton method is used in which the
+    /// derivatives of the chemical potentials and the residuals of the
+    /// equation constraints with respect to the species amounts (e.g., the
+    /// derivatives of the reaction rates in chemical kinetics calculations)
+    /// are frozen and reused in subsequent iterations, including those of
+    /// subsequent calculations. They are computed again once reused this many
+    /// times in a row, when the set of basic variables changes, or when the
+    /// iterations converge slowly (see @ref jacobian_reuse_contraction). A
+    /// calculation that fails while reusing derivatives is repeated with all
+    /// derivatives computed at every iteration. This is mostly useful in
+    /// chemical kinetics calculations (see KineticsOptions), in which these
+    /// derivatives change slowly from one time step to the next.
+    Index jacobian_reuse = 0;
+
+    /// The largest ratio between the lengths of two consecutive Newton steps for which previously computed derivatives are still reused.
+    /// A ratio above this value indicates that the iterations are converging
+    /// too slowly with the derivatives being reused, which are then computed
+    /// again. Only used when @ref jacobian_reuse is positive.
+    double jacobian_reuse_contraction = 0.5;
+
+    /// The flag indicating if failed calculations should be reported only through the returned result, without warning messages or exceptions.
+    /// When enabled, a calculation that does not converge emits no warning
+    /// message, and an error raised during a calculation is caught and
+    /// reported as EquilibriumStatus::Error in its result (see
+    /// EquilibriumResult::status). This is useful in batched calculations, in
+    /// which a fraction of the calculations may fail and be repeated with
+    /// other options, and whose failures can be inspected with
+    /// summarizeFailures. This does not apply to the methods that also compute
+    /// sensitivity derivatives.
+    bool quiet = false;
+
+    /// The maximum wall-clock time of an equilibrium calculation (in seconds), or zero for no limit.
+    /// When this budget is exhausted before convergence, the calculation
+    /// stops and the chemical state is updated with the last iterate, which
+    /// satisfies the bounds of the species amounts but not necessarily all
+    /// equality constraints. This is then indicated by
+    /// EquilibriumResult::budget_exhausted, with no warning message. The
+    /// elapsed time is checked every @ref time_budget_interval iterations. In
+    /// chemical kinetics calculations (see KineticsOptions), this budget
+    /// applies to each time step, so that a step that exhausts it can be
+    /// repeated with a shorter time step. This does not apply to the methods
+    /// that also compute sensitivity derivatives.
+    double time_budget = 0.0;
+
+    /// The number of iterations between checks of the elapsed time against @ref time_budget.
+    /// The optimization solver is stopped and resumed from its last iterate
+    /// at each check, so that small values increase the overhead.
+    Index time_budget_interval = 5;
+
+    /// The maximum number of iterations of an equilibrium calculation, or zero for no limit other than the one in Optima::Options.
+    /// Unlike the maximum number of iterations of the optimization solver,
+    /// exhausting this budget is indicated by EquilibriumResult::budget_exhausted,
+    /// as described in @ref time_budget.
+    Index iteration_budget = 0;
+
+    /// The binary file to which the inputs of slow calculations are appended for their later replay, or empty to disable recording.
+    /// A calculation is recorded if it takes at least @ref record_min_time
+    /// seconds or @ref record_min_iterations iterations, where zero values
+    /// disable the corresponding threshold. If both are zero, all calculations
+    /// are recorded. The recorded calculations can be read with
+    /// readEquilibriumRecords and repeated in isolation with
+    /// EquilibriumSolver::replay (or KineticsSolver::replay for the time
+    /// steps of chemical kinetics calculations). This does not apply to the
+    /// methods that also compute sensitivity derivatives.
+    String record_file;
+
+    /// The minimum wall-clock time (in seconds) of a calculation for its recording in @ref record_file.
+    double record_min_time = 0.0;
+
+    /// The minimum number of iterations of a calculation for its recording in @ref record_file.
+    Index record_min_iterations = 0;
+
+    /// The number of worker threads used in batched equilibrium calculations.
+    /// If zero, the number of hardware threads available is used.
+    unsigned threads = 0;
+
+    /// The source of the initial guess of each calculation in batched equilibrium calculations.
+    /// This is used by the batched solve methods of EquilibriumSolver and
+    /// by ReactiveTransportSolver, in which the calculations are ordered
+    /// (e.g., cells along a flow direction) and neighbouring ones are often
+    /// much closer to each other than to their own state at the previous
+    /// time step (e.g., on advancing reaction fronts). The equilibrium state
+    /// of the previous calculation in the batch is only used if it succeeded
+    /// and was computed by the same worker thread immediately before;
+    /// otherwise the calculation starts from its own chemical state. With
+    /// EquilibriumWarmStart::Predicted, the sensitivity derivatives of every
+    /// calculation are also computed. The input variables and the initial
+    /// amounts of the components of each calculation are always those of its
+    /// own chemical state and conditions.
+    EquilibriumWarmStart warm_start = EquilibriumWarmStart::PreviousStep;
+
+    /// The flag indicating if speciation calculations in aqueous-only systems should use the mass-action law instead of Gibbs energy minimization.
+    /// When enabled, and the chemical system contains only an aqueous phase,
+    /// with only temperature and pressure specified and no reactivity
+    /// restrictions, the calculation is performed by SpeciationSolver, with
+    /// Newton iterations only on the amounts of the primary species. If this
+    /// calculation fails (e.g., because of a cold start or an element with
+    /// zero amount), the general solver is used instead. No sensitivity
+    /// derivatives are computed with this method, so it is not used by the
+    /// solve methods that compute them.
+    bool use_mass_action_speciation = false;
 };
 
 } // namespace Reaktoro
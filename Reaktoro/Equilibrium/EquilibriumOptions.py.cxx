@@ -24,10 +24,37 @@ using namespace Reaktoro;
 
 void exportEquilibriumOptions(py::module& m)
 {
+    py::enum_<EquilibriumWarmStart>(m, "EquilibriumWarmStart")
+        .value("PreviousStep", EquilibriumWarmStart::PreviousStep)
+        .value("Neighbour", EquilibriumWarmStart::Neighbour)
+        .value("Predicted", EquilibriumWarmStart::Predicted)
+        ;
+
     py::class_<EquilibriumOptions>(m, "EquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("optima", &EquilibriumOptions::optima)
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
         .def_readwrite("use_ideal_activity_models", &EquilibriumOptions::use_ideal_activity_models)
+        .def_readwrite("ideal_presolve", &EquilibriumOptions::ideal_presolve)
+        .def_readwrite("ideal_presolve_tolerance", &EquilibriumOptions::ideal_presolve_tolerance)
+        .def_readwrite("quasi_newton_memory", &EquilibriumOptions::quasi_newton_memory)
+        .def_readwrite("use_block_sparse_hessian", &EquilibriumOptions::use_block_sparse_hessian)
+        .def_readwrite("prune_inactive_phases", &EquilibriumOptions::prune_inactive_phases)
+        .def_readwrite("standard_thermo_taylor_band", &EquilibriumOptions::standard_thermo_taylor_band)
+        .def_readwrite("jacobian_seeds", &EquilibriumOptions::jacobian_seeds)
+        .def_readwrite("jacobian_finite_differences", &EquilibriumOptions::jacobian_finite_differences)
+        .def_readwrite("jacobian_threads", &EquilibriumOptions::jacobian_threads)
+        .def_readwrite("jacobian_reuse", &EquilibriumOptions::jacobian_reuse)
+        .def_readwrite("jacobian_reuse_contraction", &EquilibriumOptions::jacobian_reuse_contraction)
+        .def_readwrite("quiet", &EquilibriumOptions::quiet)
+        .def_readwrite("time_budget", &EquilibriumOptions::time_budget)
+        .def_readwrite("time_budget_interval", &EquilibriumOptions::time_budget_interval)
+        .def_readwrite("iteration_budget", &EquilibriumOptions::iteration_budget)
+        .def_readwrite("record_file", &EquilibriumOptions::record_file)
+        .def_readwrite("record_min_time", &EquilibriumOptions::record_min_time)
+        .def_readwrite("record_min_iterations", &EquilibriumOptions::record_min_iterations)
+        .def_readwrite("threads", &EquilibriumOptions::threads)
+        .def_readwrite("warm_start", &EquilibriumOptions::warm_start)
+        .def_readwrite("use_mass_action_speciation", &EquilibriumOptions::use_mass_action_speciation)
         ;
 }
@@ -17,8 +17,12 @@
 
 #include "EquilibriumPredictor.hpp"
 
+// C++ includes
+#include <limits>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
@@ -27,36 +31,50 @@
 namespace Reaktoro {
 namespace {
 
-/// The auxiliary return type for the temperature and pressure getter functions below.
-using GetterFn = Fn<double(VectorXdConstRef, VectorXdConstRef)>;
+/// The location of temperature or pressure in either the input variables *w* or the control variables *p*.
+struct VariableIndex
+{
+    /// The index of the variable in either *w* or *p*.
+    Index index = 0;
+
+    /// True if the variable is an input variable in *w*, false if it is a control variable in *p*.
+    bool input = false;
+
+    /// Return the value of the variable from either *p* or *w*.
+    auto operator()(VectorXdConstRef const& p, VectorXdConstRef const& w) const -> double
+    {
+        return input ? w[index] : p[index];
+    }
+};
 
-/// Create the lambda function that extracts temperature from either `p` or `w`.
-auto getTemperatureFn(Strings const& inputs) -> GetterFn
+/// Return the location of temperature in either *w* or *p*.
+auto temperatureIndex(Strings const& inputs) -> VariableIndex
 {
     const auto idxT = index(inputs, "T");
     const auto knownT = idxT < inputs.size(); // T is known if it is an input variable (it then lives in w)
-    if(knownT) return [idxT](VectorXdConstRef p, VectorXdConstRef w) { return w[idxT]; };
-    else return [](VectorXdConstRef p, VectorXdConstRef w) { return p[0]; };
+    if(knownT) return { idxT, true };
+    else return { 0, false };
 }
 
-/// Create the lambda function that extracts pressure from either `p` or `w`.
-auto getPressureFn(Strings const& inputs) -> GetterFn
+/// Return the location of pressure in either *w* or *p*.
+auto pressureIndex(Strings const& inputs) -> VariableIndex
 {
     const auto idxP = index(inputs, "P");
     const auto knownP = idxP < inputs.size(); // P is known if it is an input variable (it then lives in w)
-    if(knownP) return [idxP](VectorXdConstRef p, VectorXdConstRef w) { return w[idxP]; };
+    if(knownP) return { idxP, true };
     const auto idxT = index(inputs, "T");
     const auto knownT = idxT < inputs.size(); // T is known if it is an input variable (it then lives in w)
-    if(knownT) return [](VectorXdConstRef p, VectorXdConstRef w) { return p[0]; }; // if T is known, then P is in p[0]
-    else return [](VectorXdConstRef p, VectorXdConstRef w) { return p[1]; }; // if T is unknown, then P is in p[1]
+    if(knownT) return { 0, false }; // if T is known, then P is in p[0]
+    else return { 1, false }; // if T is unknown, then P is in p[1]
 }
 
 } // namespace
 
 struct EquilibriumPredictor::Impl
 {
-    const ChemicalState state0;
-    const EquilibriumSensitivity sensitivity0;
+    Optional<ChemicalState> state0;                 ///< The reference chemical equilibrium state (not kept if the predictor is slim).
+    Optional<EquilibriumSensitivity> sensitivity0;  ///< The sensitivity derivatives at the reference equilibrium state (not kept if the predictor is slim or single-precision).
+    ChemicalState::Equilibrium equilibrium0;        ///< The equilibrium data of the reference equilibrium state assigned to predicted states.
     const VectorXd n0;    ///< The species amounts *n* at the reference equilibrium state.
     const VectorXd p0;    ///< The control variables *p* at the reference equilibrium state.
     const VectorXd q0;    ///< The control variables *q* at the reference equilibrium state.
@@ -64,13 +82,22 @@ struct EquilibriumPredictor::Impl
     const VectorXd c0;    ///< The component amounts *c* at the reference equilibrium state.
     const VectorXd u0;    ///< The chemical properties *u* at the reference equilibrium state.
     const Index Nn;       ///< The size of vector *n* with amounts of the species in the chemical system.
+    const Index Np;       ///< The size of vector *p* with the control variables.
+    const Index Nq;       ///< The size of vector *q* with the control variables.
     const Index Nu;       ///< The size of vector *u* with the serialized properties of the chemical system.
-    GetterFn getT;        ///< The function that gets temperature from either *p* or *w* depending if it is known or unwknon in the equilibrium calculation.
-    GetterFn getP;        ///< The function that gets pressure from either *p* or *w* depending if it is known or unwknon in the equilibrium calculation.
+    VariableIndex iT;     ///< The location of temperature in either *p* or *w* depending if it is known or unknown in the equilibrium calculation.
+    VariableIndex iP;     ///< The location of pressure in either *p* or *w* depending if it is known or unknown in the equilibrium calculation.
+    const bool single;    ///< The flag indicating if the Taylor matrices are stored in single precision.
+    MatrixXd dxdw0;       ///< The derivatives of *x = (n, p, q, u)* with respect to *w* at the reference equilibrium state (only if the predictor is slim and not single-precision).
+    MatrixXd dxdc0;       ///< The derivatives of *x = (n, p, q, u)* with respect to *c* at the reference equilibrium state (only if the predictor is slim and not single-precision).
+    MatrixXf dxdw0f;      ///< The derivatives of *x = (n, p, q, u)* with respect to *w* in single precision (only if the predictor is single-precision).
+    MatrixXf dxdc0f;      ///< The derivatives of *x = (n, p, q, u)* with respect to *c* in single precision (only if the predictor is single-precision).
+    VectorXd mub0;        ///< The chemical potentials of the primary species at the reference equilibrium state.
+    MatrixXd dmubdwc0;    ///< The derivatives of the chemical potentials of the primary species with respect to *(w, c)* at the reference equilibrium state.
 
     /// Construct a EquilibriumPredictor object.
-    Impl(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0)
-    : state0(state0), sensitivity0(sensitivity0),
+    Impl(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0, bool slim, bool singleprecision)
+    : equilibrium0(state0.equilibrium()),
       n0(state0.speciesAmounts()),
       p0(state0.equilibrium().p()),
       q0(state0.equilibrium().q()),
@@ -78,15 +105,77 @@ struct EquilibriumPredictor::Impl
       c0(state0.equilibrium().c()),
       u0(state0.props()),
       Nn(n0.size()),
+      Np(p0.size()),
+      Nq(q0.size()),
       Nu(u0.size()),
-      getT(getTemperatureFn(state0.equilibrium().namesInputVariables())),
-      getP(getPressureFn(state0.equilibrium().namesInputVariables()))
+      iT(temperatureIndex(state0.equilibrium().namesInputVariables())),
+      iP(pressureIndex(state0.equilibrium().namesInputVariables())),
+      single(singleprecision)
     {
         errorif(state0.equilibrium().w().size() == 0,
             "EquilibriumPredictor expects a ChemicalState object that "
             "has been used in a call to EquilibriumSolver::solve.");
+
+        const auto Nw = w0.size();
+        const auto Nc = c0.size();
+
+        // Keep either the full reference state and sensitivities or only the dense Taylor matrices stacked in the order (n, p, q, u)
+        if(slim || single)
+        {
+            dxdw0.resize(Nn + Np + Nq + Nu, Nw);
+            dxdw0.topRows(Nn) = sensitivity0.dndw();
+            dxdw0.middleRows(Nn, Np) = sensitivity0.dpdw();
+            dxdw0.middleRows(Nn + Np, Nq) = sensitivity0.dqdw();
+            dxdw0.bottomRows(Nu) = sensitivity0.dudw();
+
+            dxdc0.resize(Nn + Np + Nq + Nu, Nc);
+            dxdc0.topRows(Nn) = sensitivity0.dndc();
+            dxdc0.middleRows(Nn, Np) = sensitivity0.dpdc();
+            dxdc0.middleRows(Nn + Np, Nq) = sensitivity0.dqdc();
+            dxdc0.bottomRows(Nu) = sensitivity0.dudc();
+        }
+
+        // Keep the Taylor matrices only in single precision if requested (the predictions are still accumulated in double precision)
+        if(single)
+        {
+            dxdw0f = dxdw0.cast<float>();
+            dxdc0f = dxdc0.cast<float>();
+            dxdw0.resize(0, 0);
+            dxdc0.resize(0, 0);
+        }
+
+        if(!slim)
+            this->state0 = state0;
+
+        if(!slim && !single)
+            this->sensitivity0 = sensitivity0;
+
+        // Gather the chemical potentials of the primary species and their derivatives so that they can be predicted in a single matrix-vector product
+        const auto ib0 = state0.equilibrium().indicesPrimarySpecies();
+        const auto Nb = ib0.size();
+        const auto dudw0 = sensitivity0.dudw();
+        const auto dudc0 = sensitivity0.dudc();
+
+        mub0.resize(Nb);
+        dmubdwc0.resize(Nb, Nw + Nc);
+        for(auto i = 0; i < Nb; ++i)
+        {
+            const auto irow = Nu - Nn + ib0[i];
+            mub0[i] = u0[irow];
+            dmubdwc0.row(i).head(Nw) = dudw0.row(irow);
+            dmubdwc0.row(i).tail(Nc) = dudc0.row(irow);
+        }
     }
 
+    auto dndw() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dndw() : dxdw0.topRows(Nn); }
+    auto dpdw() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dpdw() : dxdw0.middleRows(Nn, Np); }
+    auto dqdw() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dqdw() : dxdw0.middleRows(Nn + Np, Nq); }
+    auto dudw() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dudw() : dxdw0.bottomRows(Nu); }
+    auto dndc() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dndc() : dxdc0.topRows(Nn); }
+    auto dpdc() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dpdc() : dxdc0.middleRows(Nn, Np); }
+    auto dqdc() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dqdc() : dxdc0.middleRows(Nn + Np, Nq); }
+    auto dudc() const -> MatrixXdConstRef { return sensitivity0 ? sensitivity0->dudc() : dxdc0.bottomRows(Nu); }
+
     auto predict(ChemicalState& state, EquilibriumConditions const& conditions) const -> void
     {
         const auto wvals = conditions.inputValues();
@@ -101,41 +190,50 @@ struct EquilibriumPredictor::Impl
         predict(state, dw, dc);
     }
 
+    /// Return the first-order Taylor increment of *x = (n, p, q, u)* from the single-precision Taylor matrices, accumulated in double precision.
+    auto incrementSinglePrecision(VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> VectorXd
+    {
+        VectorXd dx = VectorXd::Zero(dxdw0f.rows());
+        for(auto j = 0; j < dw.size(); ++j)
+            dx += dxdw0f.col(j).cast<double>() * dw[j];
+        for(auto j = 0; j < dc.size(); ++j)
+            dx += dxdc0f.col(j).cast<double>() * dc[j];
+        return dx;
+    }
+
     auto predict(ChemicalState& state, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> void
     {
-        const auto dndw0 = sensitivity0.dndw(); // The derivatives *dn/dw* at the reference equilibrium state.
-        const auto dpdw0 = sensitivity0.dpdw(); // The derivatives *dp/dw* at the reference equilibrium state.
-        const auto dqdw0 = sensitivity0.dqdw(); // The derivatives *dq/dw* at the reference equilibrium state.
-        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* at the reference equilibrium state.
-        const auto dndc0 = sensitivity0.dndc(); // The derivatives *dn/dc* at the reference equilibrium state.
-        const auto dpdc0 = sensitivity0.dpdc(); // The derivatives *dp/dc* at the reference equilibrium state.
-        const auto dqdc0 = sensitivity0.dqdc(); // The derivatives *dq/dc* at the reference equilibrium state.
-        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* at the reference equilibrium state.
-
-        const auto n = n0 + dndw0*dw + dndc0*dc;
-        const auto p = p0 + dpdw0*dw + dpdc0*dc;
-        const auto q = q0 + dqdw0*dw + dqdc0*dc;
-        const auto u = u0 + dudw0*dw + dudc0*dc;
-
-        const auto w = w0 + dw;
-        const auto c = c0 + dc;
+        VectorXd n, p, q, u;
+
+        if(single)
+        {
+            const VectorXd dx = incrementSinglePrecision(dw, dc);
+            n = n0 + dx.head(Nn);
+            p = p0 + dx.segment(Nn, Np);
+            q = q0 + dx.segment(Nn + Np, Nq);
+            u = u0 + dx.tail(Nu);
+        }
+        else
+        {
+            n = n0 + dndw()*dw + dndc()*dc;
+            p = p0 + dpdw()*dw + dpdc()*dc;
+            q = q0 + dqdw()*dw + dqdc()*dc;
+            u = u0 + dudw()*dw + dudc()*dc;
+        }
+
+        const VectorXd w = w0 + dw;
+        const VectorXd c = c0 + dc;
 
         state.setSpeciesAmounts(n);
         state.props().update(u);
-        state.equilibrium() = state0.equilibrium();
+        state.equilibrium().assign(equilibrium0);
         state.equilibrium().setControlVariablesP(p);
         state.equilibrium().setControlVariablesQ(q);
         state.equilibrium().setInputVariables(w);
         state.equilibrium().setInitialComponentAmounts(c);
 
-        auto const& pp = state.equilibrium().p();
-        auto const& ww = state.equilibrium().w();
-
-        const auto T = getT(pp, ww); // get temperature from predicted *p* or given *w*
-        const auto P = getP(pp, ww); // get pressure from predicted *p* or given *w*
-
-        state.setTemperature(T);
-        state.setPressure(P);
+        state.setTemperature(iT(p, w)); // get temperature from predicted *p* or given *w*
+        state.setPressure(iP(p, w)); // get pressure from predicted *p* or given *w*
     }
 
     /// Perform a first-order Taylor prediction of the chemical potential of a species at given conditions.
@@ -143,11 +241,14 @@ struct EquilibriumPredictor::Impl
     {
         assert(i < Nn);
 
-        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* of the chemical properties of the chemical system wrt *w*.
-        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* of the chemical properties of the chemical system wrt *c*.
+        if(single)
+        {
+            const auto irow = Np + Nq + Nu + i; // the row of μ[i] in the stacked vector x = (n, p, q, u)
+            return u0[Nu - Nn + i] + dxdw0f.row(irow).cast<double>().dot(dw) + dxdc0f.row(irow).cast<double>().dot(dc);
+        }
 
-        const auto dmuidw0 = dudw0.row(Nu - Nn + i); // The derivatives *dμ[i]/dw* of the chemical potential of the i-th species.
-        const auto dmuidc0 = dudc0.row(Nu - Nn + i); // The derivatives *dμ[i]/dc* of the chemical potential of the i-th species.
+        const auto dmuidw0 = dudw().row(Nu - Nn + i); // The derivatives *dμ[i]/dw* of the chemical potential of the i-th species.
+        const auto dmuidc0 = dudc().row(Nu - Nn + i); // The derivatives *dμ[i]/dc* of the chemical potential of the i-th species.
         const auto mui0 = u0[Nu - Nn + i];
 
         return mui0 + dmuidw0.dot(dw) + dmuidc0.dot(dc);
@@ -159,10 +260,46 @@ struct EquilibriumPredictor::Impl
         assert(i < Nn);
         return u0[Nu - Nn + i];
     }
+
+    /// Perform a first-order Taylor prediction of the chemical potentials of the primary species at given conditions.
+    auto primarySpeciesChemicalPotentialsPredicted(VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> VectorXd
+    {
+        const auto Nw = w0.size();
+        const auto Nc = c0.size();
+        assert(dw.size() == Nw);
+        assert(dc.size() == Nc);
+        return mub0 + dmubdwc0.leftCols(Nw)*dw + dmubdwc0.rightCols(Nc)*dc;
+    }
+
+    /// Assign the sensitivity derivatives at the reference equilibrium state to a given object.
+    auto referenceSensitivity(EquilibriumSensitivity& sensitivity) const -> void
+    {
+        if(sensitivity0)
+        {
+            sensitivity = *sensitivity0;
+            return;
+        }
+
+        auto assign = [&](MatrixXdConstRef dxdw, MatrixXdConstRef dxdc)
+        {
+            sensitivity.dndw(dxdw.topRows(Nn));
+            sensitivity.dpdw(dxdw.middleRows(Nn, Np));
+            sensitivity.dqdw(dxdw.middleRows(Nn + Np, Nq));
+            sensitivity.dudw(dxdw.bottomRows(Nu));
+            sensitivity.dndc(dxdc.topRows(Nn));
+            sensitivity.dpdc(dxdc.middleRows(Nn, Np));
+            sensitivity.dqdc(dxdc.middleRows(Nn + Np, Nq));
+            sensitivity.dudc(dxdc.bottomRows(Nu));
+        };
+
+        if(single)
+            assign(dxdw0f.cast<double>(), dxdc0f.cast<double>());
+        else assign(dxdw0, dxdc0);
+    }
 };
 
-EquilibriumPredictor::EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0)
-: pimpl(new Impl(state0, sensitivity0))
+EquilibriumPredictor::EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0, bool slim, bool singleprecision)
+: pimpl(new Impl(state0, sensitivity0, slim, singleprecision))
 {}
 
 EquilibriumPredictor::EquilibriumPredictor(EquilibriumPredictor const& other)
@@ -188,6 +325,45 @@ auto EquilibriumPredictor::predict(ChemicalState& state, VectorXdConstRef const&
     pimpl->predict(state, dw, dc);
 }
 
+auto EquilibriumPredictor::correct(ChemicalState& state, MatrixXdConstRef const& An, MatrixXdConstRef const& Aq, MatrixXdConstRef const& Ap, Index iterations, double epsilon) -> double
+{
+    auto const& equilibrium = state.equilibrium();
+
+    const VectorXd c = equilibrium.c();
+    const VectorXd p = equilibrium.p();
+    const VectorXd q = equilibrium.q();
+
+    const VectorXd b = c - Aq*q - Ap*p; // the right-hand side of the mass balance constraints on the species amounts
+
+    const VectorXd n0 = state.speciesAmounts().cast<double>().max(epsilon).matrix();
+
+    VectorXd lambda = VectorXd::Zero(An.rows());
+    VectorXd n = n0;
+    VectorXd r = An*n - b;
+
+    const auto bnorm = b.norm();
+    const auto scale = bnorm > 0.0 ? 1.0/bnorm : 1.0;
+
+    for(Index k = 0; k < iterations && r.norm()*scale > 1e-14; ++k)
+    {
+        const MatrixXd J = An * n.asDiagonal() * An.transpose();
+        lambda -= J.completeOrthogonalDecomposition().solve(r);
+        n = n0.array() * (An.transpose()*lambda).array().exp();
+        r = An*n - b;
+    }
+
+    // Keep the positive amounts before the projection if the Newton iterations diverged
+    if(!n.allFinite())
+    {
+        state.setSpeciesAmounts(n0);
+        return std::numeric_limits<double>::infinity();
+    }
+
+    state.setSpeciesAmounts(n);
+
+    return r.norm()*scale;
+}
+
 auto EquilibriumPredictor::speciesChemicalPotentialPredicted(Index ispecies, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> double
 {
     return pimpl->speciesChemicalPotentialPredicted(ispecies, dw, dc);
@@ -198,4 +374,47 @@ auto EquilibriumPredictor::speciesChemicalPotentialReference(Index ispecies) con
     return pimpl->speciesChemicalPotentialReference(ispecies);
 }
 
+auto EquilibriumPredictor::primarySpeciesChemicalPotentialsPredicted(VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> VectorXd
+{
+    return pimpl->primarySpeciesChemicalPotentialsPredicted(dw, dc);
+}
+
+auto EquilibriumPredictor::primarySpeciesChemicalPotentialsReference() const -> VectorXdConstRef
+{
+    return pimpl->mub0;
+}
+
+auto EquilibriumPredictor::primarySpeciesChemicalPotentialsDerivatives() const -> MatrixXdConstRef
+{
+    return pimpl->dmubdwc0;
+}
+
+auto EquilibriumPredictor::slim() const -> bool
+{
+    return !pimpl->state0.has_value();
+}
+
+auto EquilibriumPredictor::singlePrecision() const -> bool
+{
+    return pimpl->single;
+}
+
+auto EquilibriumPredictor::referenceState() const -> ChemicalState const&
+{
+    errorif(slim(), "The reference chemical state is not kept in a slim EquilibriumPredictor object.");
+    return *pimpl->state0;
+}
+
+auto EquilibriumPredictor::referenceSensitivity() const -> EquilibriumSensitivity const&
+{
+    errorif(slim(), "The reference sensitivity derivatives are not kept in a slim EquilibriumPredictor object.");
+    errorif(singlePrecision(), "The reference sensitivity derivatives are not kept in a single-precision EquilibriumPredictor object. Use EquilibriumPredictor::referenceSensitivity(EquilibriumSensitivity&) instead.");
+    return *pimpl->sensitivity0;
+}
+
+auto EquilibriumPredictor::referenceSensitivity(EquilibriumSensitivity& sensitivity) const -> void
+{
+    pimpl->referenceSensitivity(sensitivity);
+}
+
 } // namespace Reaktoro
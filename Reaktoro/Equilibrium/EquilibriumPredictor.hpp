@@ -33,9 +33,20 @@ class EquilibriumPredictor
 {
 public:
     /// Construct a EquilibriumPredictor object.
+    /// A slim predictor keeps only the reference values and the dense Taylor
+    /// matrices needed for predictions, instead of full copies of the reference
+    /// chemical state and its sensitivity derivatives. Its methods @ref
+    /// referenceState and @ref referenceSensitivity are then unavailable.
+    /// A single-precision predictor stores its dense Taylor matrices in
+    /// single precision instead of a copy of the sensitivity derivatives,
+    /// halving the memory they use. The predictions are still accumulated in
+    /// double precision from the double-precision reference values. Its method
+    /// @ref referenceSensitivity returning a reference is then unavailable.
     /// @param state0 The reference chemical equilibrium state from which first-order Taylor predictions are made.
     /// @param sensitivity0 The sensitivity derivatives of the chemical equilibrium state at the reference point.
-    EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0);
+    /// @param slim The flag indicating if the predictor should be slim.
+    /// @param singleprecision The flag indicating if the Taylor matrices should be stored in single precision.
+    EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0, bool slim = false, bool singleprecision = false);
 
     /// Construct a copy of a EquilibriumPredictor object.
     EquilibriumPredictor(EquilibriumPredictor const& other);
@@ -57,12 +68,64 @@ public:
     /// @param dc The change in the values of the initial amounts of conservative components *c*.
     auto predict(ChemicalState& state, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> void;
 
+    /// Correct the species amounts of a predicted chemical state so that they are positive and satisfy the mass balance constraints.
+    /// The first-order Taylor prediction conserves the components only up to
+    /// its truncation error, and may produce negative species amounts away
+    /// from the reference state. This method replaces amounts below @p
+    /// epsilon by @p epsilon and then performs Newton iterations on the
+    /// Lagrange multipliers *λ* of the positive projection *n exp(Anᵀλ)* of
+    /// these amounts onto the constraints *An n + Aq q + Ap p = c*, with *p*,
+    /// *q* and *c* taken from the predicted state. The predicted chemical
+    /// properties of the state are not changed.
+    /// @param[in,out] state The chemical state predicted with @ref predict
+    /// @param An The conservation matrix of the species amounts *n* (see EquilibriumSpecs::assembleConservationMatrixN)
+    /// @param Aq The conservation matrix of the control variables *q* (see EquilibriumSpecs::assembleConservationMatrixQ)
+    /// @param Ap The conservation matrix of the control variables *p* (see EquilibriumSpecs::assembleConservationMatrixP)
+    /// @param iterations The maximum number of Newton iterations
+    /// @param epsilon The positive lower bound of the species amounts before the projection
+    /// @return The norm of the final mass balance residual relative to the norm of its right-hand side.
+    static auto correct(ChemicalState& state, MatrixXdConstRef const& An, MatrixXdConstRef const& Aq, MatrixXdConstRef const& Ap, Index iterations, double epsilon) -> double;
+
     /// Perform a first-order Taylor prediction of the chemical potential of a species at given conditions.
     auto speciesChemicalPotentialPredicted(Index ispecies, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> double;
 
     /// Return the chemical potential of a species at given reference conditions.
     auto speciesChemicalPotentialReference(Index ispecies) const -> double;
 
+    /// Perform a first-order Taylor prediction of the chemical potentials of all primary species at given conditions.
+    /// The primary species are those of the reference chemical equilibrium
+    /// state, in the order of ChemicalState::Equilibrium::indicesPrimarySpecies.
+    /// Their predicted chemical potentials are computed in a single
+    /// matrix-vector product, instead of one dot product per species as in
+    /// @ref speciesChemicalPotentialPredicted.
+    /// @param dw The change in the values of the input variables *w*.
+    /// @param dc The change in the values of the initial amounts of conservative components *c*.
+    auto primarySpeciesChemicalPotentialsPredicted(VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> VectorXd;
+
+    /// Return the chemical potentials of all primary species at given reference conditions.
+    auto primarySpeciesChemicalPotentialsReference() const -> VectorXdConstRef;
+
+    /// Return the derivatives of the chemical potentials of all primary species with respect to *(w, c)* at given reference conditions.
+    /// The first columns of this matrix correspond to the input variables *w*
+    /// and the remaining ones to the initial amounts of conservative components *c*.
+    auto primarySpeciesChemicalPotentialsDerivatives() const -> MatrixXdConstRef;
+
+    /// Return true if this predictor keeps only the data needed for predictions.
+    auto slim() const -> bool;
+
+    /// Return true if this predictor stores its Taylor matrices in single precision.
+    auto singlePrecision() const -> bool;
+
+    /// Return the reference chemical equilibrium state from which first-order Taylor predictions are made (not available if the predictor is slim).
+    auto referenceState() const -> ChemicalState const&;
+
+    /// Return the sensitivity derivatives of the chemical equilibrium state at the reference point (not available if the predictor is slim or single-precision).
+    auto referenceSensitivity() const -> EquilibriumSensitivity const&;
+
+    /// Assign the sensitivity derivatives of the chemical equilibrium state at the reference point to a given object (available in all predictors).
+    /// @param[out] sensitivity The sensitivity derivatives, with the same dimensions as those given at construction
+    auto referenceSensitivity(EquilibriumSensitivity& sensitivity) const -> void;
+
 private:
     struct Impl;
 
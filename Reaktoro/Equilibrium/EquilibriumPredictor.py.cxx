@@ -28,10 +28,18 @@ using namespace Reaktoro;
 void exportEquilibriumProjector(py::module& m)
 {
     py::class_<EquilibriumPredictor>(m, "EquilibriumPredictor")
-        .def(py::init<ChemicalState const&, EquilibriumSensitivity const&>())
+        .def(py::init<ChemicalState const&, EquilibriumSensitivity const&, bool, bool>(), py::arg("state0"), py::arg("sensitivity0"), py::arg("slim") = false, py::arg("singleprecision") = false)
         .def("predict", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&EquilibriumPredictor::predict, py::const_), "Perform a first-order Taylor prediction of the chemical state at given conditions.")
         .def("predict", py::overload_cast<ChemicalState&, VectorXdConstRef const&, VectorXdConstRef const&>(&EquilibriumPredictor::predict, py::const_), "Perform a first-order Taylor prediction of the chemical state at given conditions.")
         .def("speciesChemicalPotentialPredicted", &EquilibriumPredictor::speciesChemicalPotentialPredicted, "Perform a first-order Taylor prediction of the chemical potential of a species at given conditions.")
         .def("speciesChemicalPotentialReference", &EquilibriumPredictor::speciesChemicalPotentialReference, "Return the chemical potential of a species at given reference conditions.")
+        .def("primarySpeciesChemicalPotentialsPredicted", &EquilibriumPredictor::primarySpeciesChemicalPotentialsPredicted, "Perform a first-order Taylor prediction of the chemical potentials of all primary species at given conditions.")
+        .def("primarySpeciesChemicalPotentialsReference", &EquilibriumPredictor::primarySpeciesChemicalPotentialsReference, "Return the chemical potentials of all primary species at given reference conditions.")
+        .def("primarySpeciesChemicalPotentialsDerivatives", &EquilibriumPredictor::primarySpeciesChemicalPotentialsDerivatives, "Return the derivatives of the chemical potentials of all primary species with respect to (w, c) at given reference conditions.")
+        .def("slim", &EquilibriumPredictor::slim, "Return true if this predictor keeps only the data needed for predictions.")
+        .def("singlePrecision", &EquilibriumPredictor::singlePrecision, "Return true if this predictor stores its Taylor matrices in single precision.")
+        .def("referenceState", &EquilibriumPredictor::referenceState, return_internal_ref, "Return the reference chemical equilibrium state from which first-order Taylor predictions are made.")
+        .def("referenceSensitivity", py::overload_cast<>(&EquilibriumPredictor::referenceSensitivity, py::const_), return_internal_ref, "Return the sensitivity derivatives of the chemical equilibrium state at the reference point.")
+        .def("referenceSensitivity", py::overload_cast<EquilibriumSensitivity&>(&EquilibriumPredictor::referenceSensitivity, py::const_), "Assign the sensitivity derivatives of the chemical equilibrium state at the reference point to a given object.")
         ;
 }
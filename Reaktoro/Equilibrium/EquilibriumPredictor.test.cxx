@@ -158,6 +158,88 @@ TEST_CASE("Testing EquilibriumPredictor", "[EquilibriumPredictor]")
             CHECK( predictor.speciesChemicalPotentialReference(i) == Approx(props0.speciesChemicalPotential(i)) );
             CHECK( predictor.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(props.speciesChemicalPotential(i)) );
         }
+
+        // Check EquilibriumPredictor::primarySpeciesChemicalPotentialsPredicted and EquilibriumPredictor::primarySpeciesChemicalPotentialsReference
+        const auto ibasic = state0.equilibrium().indicesPrimarySpecies();
+        const VectorXd mub0 = predictor.primarySpeciesChemicalPotentialsReference();
+        const VectorXd mub1 = predictor.primarySpeciesChemicalPotentialsPredicted(dw, dc);
+
+        REQUIRE( mub0.size() == ibasic.size() );
+        REQUIRE( mub1.size() == ibasic.size() );
+
+        for(auto i = 0; i < ibasic.size(); ++i)
+        {
+            CHECK( mub0[i] == Approx(predictor.speciesChemicalPotentialReference(ibasic[i])) );
+            CHECK( mub1[i] == Approx(predictor.speciesChemicalPotentialPredicted(ibasic[i], dw, dc)) );
+        }
+
+        // Check a slim EquilibriumPredictor produces the same predictions without keeping the reference state and sensitivities
+        EquilibriumPredictor slimpredictor(state0, sensitivity0, true);
+
+        CHECK( slimpredictor.slim() );
+        CHECK_FALSE( predictor.slim() );
+        CHECK_THROWS( slimpredictor.referenceState() );
+        CHECK_THROWS( slimpredictor.referenceSensitivity() );
+
+        ChemicalState slimstate(system);
+        slimstate.set("H2O" , 55.50, "mol");
+        slimstate.set("NaCl", 0.150, "mol");
+        slimstate.set("O2"  , 0.002, "mol");
+
+        slimpredictor.predict(slimstate, conditions);
+
+        CHECK( n.isApprox(VectorXd(slimstate.speciesAmounts())) );
+        CHECK( p.isApprox(VectorXd(slimstate.equilibrium().p())) );
+        CHECK( q.isApprox(VectorXd(slimstate.equilibrium().q())) );
+        CHECK( u.isApprox(VectorXd(slimstate.props())) );
+        CHECK( slimstate.temperature() == state.temperature() );
+        CHECK( slimstate.pressure() == state.pressure() );
+
+        for(auto i = 0; i < n.size(); ++i)
+            CHECK( slimpredictor.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(predictor.speciesChemicalPotentialPredicted(i, dw, dc)) );
+
+        // Check a single-precision EquilibriumPredictor produces the same predictions up to the rounding errors of its Taylor matrices
+        EquilibriumPredictor singlepredictor(state0, sensitivity0, false, true);
+
+        CHECK( singlepredictor.singlePrecision() );
+        CHECK_FALSE( predictor.singlePrecision() );
+        CHECK_FALSE( singlepredictor.slim() );
+        CHECK_NOTHROW( singlepredictor.referenceState() );
+        CHECK_THROWS( singlepredictor.referenceSensitivity() );
+
+        EquilibriumSensitivity singlesensitivity(specs);
+        singlepredictor.referenceSensitivity(singlesensitivity);
+
+        CHECK( singlesensitivity.dndw().isApprox(dndw0, 1e-6) );
+        CHECK( singlesensitivity.dudc().isApprox(dudc0, 1e-6) );
+
+        ChemicalState singlestate(system);
+        singlestate.set("H2O" , 55.50, "mol");
+        singlestate.set("NaCl", 0.150, "mol");
+        singlestate.set("O2"  , 0.002, "mol");
+
+        singlepredictor.predict(singlestate, conditions);
+
+        CHECK( n.isApprox(VectorXd(singlestate.speciesAmounts()), 1e-6) );
+        CHECK( p.isApprox(VectorXd(singlestate.equilibrium().p()), 1e-6) );
+        CHECK( q.isApprox(VectorXd(singlestate.equilibrium().q()), 1e-6) );
+        CHECK( u.isApprox(VectorXd(singlestate.props()), 1e-6) );
+
+        for(auto i = 0; i < n.size(); ++i)
+            CHECK( singlepredictor.speciesChemicalPotentialPredicted(i, dw, dc) == Approx(predictor.speciesChemicalPotentialPredicted(i, dw, dc)).epsilon(1e-6) );
+
+        // Check the mass-balance corrector restores the component amounts while keeping species amounts positive
+        const MatrixXd An = specs.assembleConservationMatrixN();
+        const MatrixXd Aq = specs.assembleConservationMatrixQ();
+        const MatrixXd Ap = specs.assembleConservationMatrixP();
+
+        const auto residual = EquilibriumPredictor::correct(state, An, Aq, Ap, 10, 1e-16);
+
+        const VectorXd ncorrected = state.speciesAmounts();
+
+        CHECK( residual < 1e-10 );
+        CHECK( (An*ncorrected).isApprox(c) );
+        CHECK( ncorrected.minCoeff() > 0.0 );
     }
 
     SECTION("when the system is closed, temperature and pressure given, O2 is a meta-stable basic species - sensitivity derivatives should be zero")
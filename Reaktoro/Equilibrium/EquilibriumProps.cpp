@@ -18,13 +18,11 @@
 #include "EquilibriumProps.hpp"
 
 // Reaktoro includes
-#include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
-#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 
 namespace Reaktoro {
 namespace {
@@ -81,14 +79,20 @@ struct EquilibriumProps::Impl
     /// The pressure getter function for the given equilibrium specifications. @see createPressureGetterFn
     const PropertyGetterFn getP;
 
+    /// The model parameters considered inputs in the equilibrium calculation (sharing their values with those in the specifications).
+    Vec<Param> params;
+
     /// The values of the model parameters before they are altered in the update method.
     VectorXr params0;
 
     /// The partial derivatives of the serialized chemical properties *u* with respect to *(n, p, w)*.
     MatrixXd dudnpw;
 
-    /// The array stream used during serialize and deserialize of chemical properties.
-    ArrayStream<real> stream;
+    /// The serialized chemical properties *u*, allocated once and written in place whenever derivatives are collected.
+    ArrayXr u;
+
+    /// The indices of the entries in *u* corresponding to the properties of each phase and its species.
+    Vec<Indices> uphases;
 
     /// The flag indicating if the full Jacobian matrix is been constructed.
     bool assemblying_jacobian = false;
@@ -99,30 +103,56 @@ struct EquilibriumProps::Impl
       specs(specs),
       dims(specs),
       getT(createTemperatureGetterFn(specs)),
-      getP(createPressureGetterFn(specs))
+      getP(createPressureGetterFn(specs)),
+      params(specs.params()),
+      params0(specs.params().size())
     {
+        // Allocate the serialized chemical properties once so that collecting derivatives does not allocate memory
+        const auto Nu = state.props().serializationSize();
+        u.resize(Nu);
+
+        // Initialize the indices of the entries in u associated with each phase (arrays of species or phase properties; T and P are skipped)
+        const auto& phases = specs.system().phases();
+        const auto numphases = phases.size();
+        const auto numspecies = specs.system().species().size();
+        uphases.resize(numphases);
+        auto pos = 0;
+        for(auto const& [name, length] : state.props().serializationLayout())
+        {
+            if(name == "T" || name == "P")
+            {
+                pos += length;
+                continue;
+            }
+            for(auto k = 0; k < numphases; ++k)
+            {
+                if(length == numspecies)
+                {
+                    const auto offset = phases.numSpeciesUntilPhase(k);
+                    const auto size = phases[k].species().size();
+                    for(auto i = 0; i < size; ++i)
+                        uphases[k].push_back(pos + offset + i);
+                }
+                else uphases[k].push_back(pos + k);
+            }
+            pos += length;
+        }
+
+        // Reuse the standard thermodynamic properties of the species at unchanged temperature and pressure, unless these may depend on input model parameters
+        state.props().reuseStandardThermoProps(specs.params().empty());
+
         // Initialize Jacobian matrix dudnpw with zeros (to avoid uninitialized values)
-        state.props().serialize(stream);
-        const auto Nu = stream.data().rows();
         const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
         dudnpw = zeros(Nu, Nnpw);
     }
 
-    /// Update the chemical properties of the chemical system.
-    auto update(VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel) -> void
+    /// Change the model parameters that are input variables in the equilibrium calculation (their original values are stored in params0).
+    auto applyInputParams(VectorXrConstRef w) -> void
     {
-        // Get temperature and pressure of the system, either available in p or w
-        const auto T = getT(p, w);
-        const auto P = getP(p, w);
-
-        // The model parameters considered inputs in the equilibrium calculation.
-        auto params = specs.params();
-
         // The indices of the model params among the input variables *w*.
         const auto& iparams = specs.indicesInputParams();
 
         // Store the current values of the model parameters
-        params0.resize(params.size());
         for(const auto& [i, param] : enumerate(params))
             params0[i] = param.value();
 
@@ -130,6 +160,23 @@ struct EquilibriumProps::Impl
         // that are input in the chemical equilibrium calculation.
         for(auto i = 0; i < params0.size(); ++i)
             params[i].value() = w[iparams[i]];
+    }
+
+    /// Recover the original state of the model parameters changed in applyInputParams.
+    auto restoreInputParams() -> void
+    {
+        for(auto i = 0; i < params0.size(); ++i)
+            params[i].value() = params0[i];
+    }
+
+    /// Update the chemical properties of the chemical system.
+    auto update(VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel) -> void
+    {
+        // Get temperature and pressure of the system, either available in p or w
+        const auto T = getT(p, w);
+        const auto P = getP(p, w);
+
+        applyInputParams(w);
 
         // Perform the update of the chemical properties of the system.
         // If there were model parameters changed above, the chemical
@@ -138,9 +185,7 @@ struct EquilibriumProps::Impl
             state.updateIdeal(T, P, n);
         else state.update(T, P, n);
 
-        // Recover here the original state of the model parameters changed above.
-        for(auto i = 0; i < params0.size(); ++i)
-            params[i].value() = params0[i];
+        restoreInputParams();
     }
 
     /// Update the chemical properties of the chemical system.
@@ -150,15 +195,89 @@ struct EquilibriumProps::Impl
         update(n, p, w, useIdealModel);
 
         // Collect the derivatives of the chemical properties wrt some seeded variable in n, p, w.
+        collectDerivatives(inpw);
+    }
+
+    /// Update the chemical properties of a single phase in the chemical system.
+    auto updatePhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void
+    {
+        const auto T = getT(p, w);
+        const auto P = getP(p, w);
+
+        const auto& phases = specs.system().phases();
+        const auto offset = phases.numSpeciesUntilPhase(iphase);
+        const auto size = phases[iphase].species().size();
+        const auto np = n.segment(offset, size);
+
+        applyInputParams(w);
+
+        auto& props = state.props();
+        if(useIdealModel)
+            props.updatePhaseIdeal(iphase, T, P, np);
+        else props.updatePhase(iphase, T, P, np);
+
+        restoreInputParams();
+
+        collectDerivativesInPhase(iphase, inpw);
+    }
+
+    /// Update the chemical properties of selected phases in the chemical system.
+    auto updatePhases(Indices const& iphases, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel) -> void
+    {
+        const auto T = getT(p, w);
+        const auto P = getP(p, w);
+
+        const auto& phases = specs.system().phases();
+
+        state.setTemperature(T);
+        state.setPressure(P);
+        state.setSpeciesAmounts(n.array());
+
+        applyInputParams(w);
+
+        auto& props = state.props();
+        for(auto iphase : iphases)
+        {
+            const auto offset = phases.numSpeciesUntilPhase(iphase);
+            const auto size = phases[iphase].species().size();
+            const auto np = n.segment(offset, size);
+            if(useIdealModel)
+                props.updatePhaseIdeal(iphase, T, P, np);
+            else props.updatePhase(iphase, T, P, np);
+        }
+
+        restoreInputParams();
+    }
+
+    /// Collect the derivatives of the chemical properties with respect to the seeded variable in (n, p, w) with index `inpw`.
+    auto collectDerivatives(long inpw) -> void
+    {
         if(assemblying_jacobian && inpw != -1)  // inpw === -1 if seeded variable is some variable in q (the amounts of implicit titrants)
         {
             const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
             assert(inpw < Nnpw);
-            state.props().serialize(stream);
+            state.props().serialize(u);
             auto col = dudnpw.col(inpw);
             const auto size = col.size();
             for(auto i = 0; i < size; ++i)
-                col[i] = grad(stream.data()[i]);
+                col[i] = grad(u[i]);
+        }
+    }
+
+    /// Collect the derivatives of the chemical properties of a phase with respect to the seeded variable in (n, p, w) with index `inpw`.
+    /// The properties of the other phases were not re-evaluated and do not
+    /// depend on the seeded variable, so only the entries of the phase are
+    /// serialized and the remaining entries in the column are left as zeros.
+    auto collectDerivativesInPhase(Index iphase, long inpw) -> void
+    {
+        if(assemblying_jacobian && inpw != -1)
+        {
+            const auto Nnpw = dims.Nn + dims.Np + dims.Nw;
+            assert(inpw < Nnpw);
+            state.props().serializePhase(iphase, u);
+            auto col = dudnpw.col(inpw);
+            for(auto i : uphases[iphase])
+                col[i] = grad(u[i]);
         }
     }
 
@@ -208,6 +327,16 @@ auto EquilibriumProps::update(VectorXrConstRef n, VectorXrConstRef p, VectorXrCo
     pimpl->update(n, p, w, useIdealModel, inpw);
 }
 
+auto EquilibriumProps::updatePhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void
+{
+    pimpl->updatePhase(iphase, n, p, w, useIdealModel, inpw);
+}
+
+auto EquilibriumProps::updatePhases(Indices const& iphases, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel) -> void
+{
+    pimpl->updatePhases(iphases, n, p, w, useIdealModel);
+}
+
 auto EquilibriumProps::assembleFullJacobianBegin() -> void
 {
     pimpl->assemblying_jacobian = true;
@@ -219,6 +348,16 @@ auto EquilibriumProps::assembleFullJacobianEnd() -> void
     pimpl->assemblying_jacobian = false;
 }
 
+auto EquilibriumProps::discardStandardThermoProps() -> void
+{
+    pimpl->state.props().discardStandardThermoProps();
+}
+
+auto EquilibriumProps::extrapolateStandardThermoProps(double dT) -> void
+{
+    pimpl->state.props().extrapolateStandardThermoProps(pimpl->specs.params().empty() ? dT : 0.0);
+}
+
 auto EquilibriumProps::chemicalState() const -> const ChemicalState&
 {
     return pimpl->state;
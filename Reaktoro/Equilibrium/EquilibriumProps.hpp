@@ -69,6 +69,34 @@ public:
     /// @param inpw The index of the variable in (n, p, w) currently seeded for autodiff computation.
     auto update(VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void;
 
+    /// Update the chemical properties of a single phase in the chemical system.
+    /// This method is similar to @ref update, but only the properties of the
+    /// phase with index `iphase` are recomputed. The properties of the other
+    /// phases are left as computed in the last update. This is used in the
+    /// block-sparse assembly of the Hessian of the Gibbs energy function, in
+    /// which derivatives with respect to the amount of a species in a phase are
+    /// computed by re-evaluating only that phase.
+    /// @param iphase The index of the phase in the system.
+    /// @param n The amounts of the species.
+    /// @param p The values of the *p* control variables (e.g., T, P, n[H+] in case U, V and pH are given).
+    /// @param w The input variables *w* in the chemical equilibrium problem (e.g., U, V, pH).
+    /// @param useIdealModel If true, ideal thermodynamic models are used for the phase.
+    /// @param inpw The index of the variable in (n, p, w) currently seeded for autodiff computation.
+    auto updatePhase(Index iphase, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel, long inpw) -> void;
+
+    /// Update the chemical properties of selected phases in the chemical system.
+    /// The temperature, pressure and species amounts of the underlying
+    /// chemical state are updated, but only the properties of the phases with
+    /// given indices are recomputed. The caller is responsible for ensuring
+    /// the properties of the other phases remain valid for the given
+    /// conditions (e.g., their species amounts did not change).
+    /// @param iphases The indices of the phases to be updated.
+    /// @param n The amounts of the species.
+    /// @param p The values of the *p* control variables (e.g., T, P, n[H+] in case U, V and pH are given).
+    /// @param w The input variables *w* in the chemical equilibrium problem (e.g., U, V, pH).
+    /// @param useIdealModel If true, ideal thermodynamic models are used for the phases.
+    auto updatePhases(Indices const& iphases, VectorXrConstRef n, VectorXrConstRef p, VectorXrConstRef w, bool useIdealModel) -> void;
+
     /// Enable recording of derivatives of the chemical properties with respect
     /// to *(n, p, w)* to contruct its full Jacobian matrix.
     /// Consider a series of forward automatic differentiation passes to
@@ -87,6 +115,18 @@ public:
     /// construction.
     auto assembleFullJacobianEnd() -> void;
 
+    /// Ensure the standard thermodynamic properties of the species are computed again in the next update.
+    /// Within a chemical equilibrium calculation, these properties are only
+    /// computed when temperature or pressure change or are seeded, unless
+    /// model parameters are input variables (see ChemicalProps::reuseStandardThermoProps).
+    /// This should be called at the beginning of each calculation, since model
+    /// parameters may have changed since the previous one.
+    auto discardStandardThermoProps() -> void;
+
+    /// Enable the extrapolation of the standard thermodynamic properties of the species in temperature within a band @p dT (in K), or disable it if zero.
+    /// This has no effect if model parameters are input variables (see ChemicalProps::extrapolateStandardThermoProps).
+    auto extrapolateStandardThermoProps(double dT) -> void;
+
     /// Return the underlying chemical state of the system and its updated properties.
     auto chemicalState() const -> const ChemicalState&;
 
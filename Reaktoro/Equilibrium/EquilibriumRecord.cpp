@@ -0,0 +1,126 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumRecord.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// The identifier written at the beginning of files with equilibrium records.
+const char recordFileSignature[8] = {'R', 'K', 'T', 'E', 'Q', 'R', 'E', 'C'};
+
+/// The format version of files with equilibrium records.
+const std::uint64_t recordFileVersion = 1;
+
+/// The mutex serializing the writing of equilibrium records from different threads.
+std::mutex recordFileMutex;
+
+/// Write a value of fixed size into a binary stream.
+template<typename T>
+auto writeRecordValue(std::ostream& out, T const& value) -> void
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Read a value of fixed size from a binary stream.
+template<typename T>
+auto readRecordValue(std::istream& in) -> T
+{
+    T value = {};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    errorif(!in, "Could not read the equilibrium records from the given file, which is either corrupted or truncated.");
+    return value;
+}
+
+/// Write an array of floating-point numbers into a binary stream (its size first).
+auto writeRecordArray(std::ostream& out, ArrayXd const& array) -> void
+{
+    writeRecordValue<std::uint64_t>(out, array.size());
+    out.write(reinterpret_cast<const char*>(array.data()), array.size() * sizeof(double));
+}
+
+/// Read an array of floating-point numbers from a binary stream.
+auto readRecordArray(std::istream& in) -> ArrayXd
+{
+    ArrayXd array(readRecordValue<std::uint64_t>(in));
+    in.read(reinterpret_cast<char*>(array.data()), array.size() * sizeof(double));
+    errorif(!in, "Could not read the equilibrium records from the given file, which is either corrupted or truncated.");
+    return array;
+}
+
+} // namespace detail
+
+auto appendEquilibriumRecord(String const& filename, EquilibriumRecord const& record) -> void
+{
+    std::lock_guard<std::mutex> lock(detail::recordFileMutex);
+
+    std::ofstream out(filename, std::ios::binary | std::ios::app);
+    errorif(!out, "Could not open file `", filename, "` to append an equilibrium record.");
+
+    out.seekp(0, std::ios::end);
+
+    if(out.tellp() == 0) // the file is new or empty
+    {
+        out.write(detail::recordFileSignature, sizeof(detail::recordFileSignature));
+        detail::writeRecordValue(out, detail::recordFileVersion);
+    }
+
+    detail::writeRecordValue(out, record.elapsed);
+    detail::writeRecordValue<std::uint64_t>(out, record.iterations);
+    for(auto const* array : { &record.w, &record.c0, &record.xlower, &record.xupper, &record.plower, &record.pupper, &record.x, &record.p, &record.ye, &record.s })
+        detail::writeRecordArray(out, *array);
+
+    errorif(!out, "Could not append an equilibrium record to file `", filename, "`.");
+}
+
+auto readEquilibriumRecords(String const& filename) -> Vec<EquilibriumRecord>
+{
+    std::ifstream in(filename, std::ios::binary);
+    errorif(!in, "Could not open file `", filename, "` to read equilibrium records.");
+
+    char signature[sizeof(detail::recordFileSignature)] = {};
+    in.read(signature, sizeof(signature));
+    errorif(!in || !std::equal(signature, signature + sizeof(signature), detail::recordFileSignature), "Cannot read equilibrium records from file `", filename, "` because it was not written with appendEquilibriumRecord.");
+
+    const auto version = detail::readRecordValue<std::uint64_t>(in);
+    errorif(version != detail::recordFileVersion, "Cannot read equilibrium records from file `", filename, "` because its format version (", version, ") is not supported.");
+
+    Vec<EquilibriumRecord> records;
+
+    while(in.peek() != std::ifstream::traits_type::eof())
+    {
+        EquilibriumRecord record;
+        record.elapsed = detail::readRecordValue<double>(in);
+        record.iterations = detail::readRecordValue<std::uint64_t>(in);
+        for(auto* array : { &record.w, &record.c0, &record.xlower, &record.xupper, &record.plower, &record.pupper, &record.x, &record.p, &record.ye, &record.s })
+            *array = detail::readRecordArray(in);
+        records.push_back(std::move(record));
+    }
+
+    return records;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,83 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The inputs of a chemical equilibrium calculation captured for its later replay in isolation.
+/// These records are written by EquilibriumSolver (and KineticsSolver) for
+/// calculations whose time or number of iterations exceed given thresholds
+/// (see EquilibriumOptions::record_file), and replayed with
+/// EquilibriumSolver::replay, e.g., with the Profiler enabled. They contain
+/// the inputs of the underlying optimization problem, so that the conditions
+/// and restrictions of the calculation need not be reconstructed, and the
+/// initial guess used for its warm start. The chemical system, the
+/// equilibrium specifications and the options of the solver are not
+/// recorded, and must be the same in the solver replaying the calculation.
+struct EquilibriumRecord
+{
+    /// The wall-clock time of the recorded calculation (in s).
+    double elapsed = 0.0;
+
+    /// The number of iterations of the recorded calculation.
+    Index iterations = 0;
+
+    /// The values of the input variables *w* in the calculation.
+    ArrayXd w;
+
+    /// The amounts of the conservative components in the calculation.
+    ArrayXd c0;
+
+    /// The lower bounds of the variables *x = (n, q)* in the calculation.
+    ArrayXd xlower;
+
+    /// The upper bounds of the variables *x = (n, q)* in the calculation.
+    ArrayXd xupper;
+
+    /// The lower bounds of the control variables *p* in the calculation.
+    ArrayXd plower;
+
+    /// The upper bounds of the control variables *p* in the calculation.
+    ArrayXd pupper;
+
+    /// The initial guess of the variables *x = (n, q)* in the calculation.
+    ArrayXd x;
+
+    /// The initial guess of the control variables *p* in the calculation.
+    ArrayXd p;
+
+    /// The initial guess of the Lagrange multipliers of the linear equality constraints in the calculation.
+    ArrayXd ye;
+
+    /// The initial guess of the stabilities of the variables *x* in the calculation.
+    ArrayXd s;
+};
+
+/// Append an equilibrium record to a binary file, which is created if it does not exist.
+/// Calls of this function from different threads are serialized, so that
+/// the workers of batched calculations can record into the same file.
+auto appendEquilibriumRecord(String const& filename, EquilibriumRecord const& record) -> void;
+
+/// Return the equilibrium records in a binary file written with @ref appendEquilibriumRecord.
+auto readEquilibriumRecords(String const& filename) -> Vec<EquilibriumRecord>;
+
+} // namespace Reaktoro
@@ -0,0 +1,45 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
+using namespace Reaktoro;
+
+void exportEquilibriumRecord(py::module& m)
+{
+    py::class_<EquilibriumRecord>(m, "EquilibriumRecord")
+        .def(py::init<>())
+        .def_readwrite("elapsed", &EquilibriumRecord::elapsed)
+        .def_readwrite("iterations", &EquilibriumRecord::iterations)
+        .def_readwrite("w", &EquilibriumRecord::w)
+        .def_readwrite("c0", &EquilibriumRecord::c0)
+        .def_readwrite("xlower", &EquilibriumRecord::xlower)
+        .def_readwrite("xupper", &EquilibriumRecord::xupper)
+        .def_readwrite("plower", &EquilibriumRecord::plower)
+        .def_readwrite("pupper", &EquilibriumRecord::pupper)
+        .def_readwrite("x", &EquilibriumRecord::x)
+        .def_readwrite("p", &EquilibriumRecord::p)
+        .def_readwrite("ye", &EquilibriumRecord::ye)
+        .def_readwrite("s", &EquilibriumRecord::s)
+        ;
+
+    m.def("appendEquilibriumRecord", appendEquilibriumRecord, "Append an equilibrium record to a binary file, which is created if it does not exist.", py::arg("filename"), py::arg("record"));
+    m.def("readEquilibriumRecords", readEquilibriumRecords, "Return the equilibrium records in a binary file written with appendEquilibriumRecord.", py::arg("filename"));
+}
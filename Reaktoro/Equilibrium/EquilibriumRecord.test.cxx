@@ -0,0 +1,74 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing EquilibriumRecord", "[EquilibriumRecord]")
+{
+    const auto filepath = "EquilibriumRecord.test.bin";
+
+    std::remove(filepath);
+
+    EquilibriumRecord record;
+    record.elapsed = 0.25;
+    record.iterations = 42;
+    record.w = ArrayXd{{ 300.0, 1.0e5 }};
+    record.c0 = ArrayXd{{ 1.0, 2.0, 0.0 }};
+    record.xlower = ArrayXd::Constant(4, 1e-16);
+    record.xupper = ArrayXd::Constant(4, 1e+16);
+    record.x = ArrayXd{{ 1.0, 2.0, 3.0, 4.0 }};
+    record.ye = ArrayXd{{ -1.0, -2.0, -3.0 }};
+    record.s = ArrayXd::Zero(4);
+
+    appendEquilibriumRecord(filepath, record);
+
+    record.iterations = 43;
+    record.p = ArrayXd{{ 350.0 }};
+
+    appendEquilibriumRecord(filepath, record);
+
+    const auto records = readEquilibriumRecords(filepath);
+
+    REQUIRE( records.size() == 2 );
+
+    CHECK( records[0].elapsed == 0.25 );
+    CHECK( records[0].iterations == 42 );
+    CHECK( (records[0].w == record.w).all() );
+    CHECK( (records[0].c0 == record.c0).all() );
+    CHECK( (records[0].xlower == record.xlower).all() );
+    CHECK( (records[0].xupper == record.xupper).all() );
+    CHECK( records[0].plower.size() == 0 );
+    CHECK( (records[0].x == record.x).all() );
+    CHECK( records[0].p.size() == 0 );
+    CHECK( (records[0].ye == record.ye).all() );
+    CHECK( (records[0].s == record.s).all() );
+
+    CHECK( records[1].iterations == 43 );
+    CHECK( (records[1].p == record.p).all() );
+
+    std::remove(filepath);
+
+    CHECK_THROWS( readEquilibriumRecords(filepath) );
+}
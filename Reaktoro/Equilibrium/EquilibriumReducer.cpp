@@ -0,0 +1,272 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "EquilibriumReducer.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+
+namespace Reaktoro {
+
+struct EquilibriumReducer::Impl
+{
+    /// The chemical equilibrium specifications of the calculations.
+    const EquilibriumSpecs specs;
+
+    /// The options of the equilibrium calculations.
+    EquilibriumOptions options;
+
+    /// The mole fraction in the system below which a species is considered negligible.
+    double threshold = 1e-12;
+
+    /// The mole fractions in the system of the species in every successful sample (one row per sample).
+    MatrixXd fractions;
+
+    /// The number of samples given so far.
+    Index numsamples = 0;
+
+    /// The number of samples given so far whose equilibrium calculation failed.
+    Index numfailed = 0;
+
+    /// The equilibrium solvers used by each worker thread.
+    Vec<EquilibriumSolver> solvers;
+
+    /// The pool of worker threads (created on first use).
+    SharedPtr<ThreadPool> pool;
+
+    Impl(EquilibriumSpecs const& specs)
+    : specs(specs)
+    {}
+
+    Impl(Impl const& other)
+    : specs(other.specs), options(other.options), threshold(other.threshold),
+      fractions(other.fractions), numsamples(other.numsamples), numfailed(other.numfailed)
+    {}
+
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(options.threads);
+
+        if(solvers.size() == pool->numThreads())
+            return;
+
+        EquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        solvers.clear();
+        solvers.resize(pool->numThreads(), solver);
+    }
+
+    auto sample(Vec<ChemicalState> const& states, Vec<EquilibriumConditions> const& conditions) -> void
+    {
+        errorif(states.size() != conditions.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects in EquilibriumReducer::sample, but got ", states.size(), " and ", conditions.size(), " respectively.");
+
+        const auto Ns = states.size();
+        const auto Nn = specs.system().species().size();
+
+        if(Ns == 0)
+            return;
+
+        initializeWorkers();
+
+        MatrixXd x(Ns, Nn);
+        Vec<char> success(Ns, false); // stored as bytes so that workers can write them concurrently
+
+        pool->parallelFor(Ns, [&](Index i, Index iworker)
+        {
+            ChemicalState state(states[i]);
+
+            const auto result = solvers[iworker].solve(state, conditions[i]);
+
+            if(result.failed())
+                return;
+
+            const ArrayXd n = state.speciesAmounts().cast<double>();
+            const auto ntotal = n.sum();
+
+            if(ntotal <= 0.0)
+                return;
+
+            x.row(i) = (n / ntotal).matrix().transpose();
+            success[i] = true;
+        });
+
+        const auto Nsucceeded = std::count(success.begin(), success.end(), true);
+        const auto Nprevious = fractions.rows();
+
+        fractions.conservativeResize(Nprevious + Nsucceeded, Nn);
+
+        auto k = Nprevious;
+        for(auto i = 0; i < Ns; ++i)
+            if(success[i])
+                fractions.row(k++) = x.row(i);
+
+        numsamples += Ns;
+        numfailed += Ns - Nsucceeded;
+    }
+
+    auto reduce(Phases const& phases) const -> EquilibriumReduction
+    {
+        auto const& system = specs.system();
+
+        errorif(fractions.rows() == 0, "Expecting at least one successful sample in EquilibriumReducer before reducing the chemical system. Use method EquilibriumReducer::sample for this.");
+
+        const Vec<GeneralPhase> generalphases = phases.expandedGeneralPhases();
+
+        errorif(generalphases.size() != system.phases().size(), "Expecting in EquilibriumReducer::reduce the same Phases object used to construct the chemical system of the equilibrium specifications, but it has ", generalphases.size(), " phases instead of ", system.phases().size(), ".");
+
+        const auto Nn = system.species().size();
+        const auto Ne = system.elements().size();
+        const auto A = system.formulaMatrix();
+
+        // The largest mole fraction of each species among all samples
+        const ArrayXd maxfractions = fractions.colwise().maxCoeff().transpose();
+
+        Vec<bool> kept(Nn);
+        for(auto i = 0; i < Nn; ++i)
+            kept[i] = maxfractions[i] >= threshold;
+
+        // Keep the most abundant species with an element if all species with that element would be removed but it is present in a sample
+        for(auto e = 0; e < Ne; ++e)
+        {
+            auto ibest = Nn;
+            auto best = 0.0;
+            auto found = false;
+            for(auto i = 0; i < Nn && !found; ++i)
+            {
+                if(A(e, i) == 0.0)
+                    continue;
+                found = kept[i];
+                if(maxfractions[i] > best)
+                {
+                    best = maxfractions[i];
+                    ibest = i;
+                }
+            }
+            if(!found && ibest < Nn)
+                kept[ibest] = true;
+        }
+
+        EquilibriumReduction reduction;
+
+        Phases reduced(phases.database());
+
+        auto offset = 0;
+        for(auto const& [k, phase] : enumerate(system.phases()))
+        {
+            Strings names;
+            for(auto const& species : phase.species())
+            {
+                if(kept[offset]) names.push_back(species.name());
+                else reduction.removed_species.push_back(species.name());
+                ++offset;
+            }
+
+            if(names.empty())
+            {
+                reduction.removed_phases.push_back(phase.name());
+                continue;
+            }
+
+            GeneralPhase generalphase = generalphases[k];
+            generalphase.setSpecies(names);
+            reduction.phases.push_back(generalphase);
+            reduced.add(generalphase);
+        }
+
+        reduction.system = ChemicalSystem(reduced);
+
+        // Report the fractions of the amount of matter neglected by removing species
+        for(auto i = 0; i < Nn; ++i)
+            if(!kept[i])
+                reduction.max_removed_species_fraction = std::max(reduction.max_removed_species_fraction, maxfractions[i]);
+
+        for(auto s = 0; s < fractions.rows(); ++s)
+        {
+            auto removed = 0.0;
+            for(auto i = 0; i < Nn; ++i)
+                if(!kept[i])
+                    removed += fractions(s, i);
+            reduction.max_removed_fraction = std::max(reduction.max_removed_fraction, removed);
+        }
+
+        reduction.samples = numsamples;
+        reduction.failed_samples = numfailed;
+
+        return reduction;
+    }
+};
+
+EquilibriumReducer::EquilibriumReducer(EquilibriumSpecs const& specs)
+: pimpl(new Impl(specs))
+{}
+
+EquilibriumReducer::EquilibriumReducer(EquilibriumReducer const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumReducer::~EquilibriumReducer()
+{}
+
+auto EquilibriumReducer::operator=(EquilibriumReducer other) -> EquilibriumReducer&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumReducer::setOptions(EquilibriumOptions const& options) -> void
+{
+    pimpl->options = options;
+    pimpl->solvers.clear();
+    pimpl->pool.reset();
+}
+
+auto EquilibriumReducer::setThreshold(double threshold) -> void
+{
+    errorif(threshold < 0.0, "The threshold in EquilibriumReducer must be non-negative.");
+    pimpl->threshold = threshold;
+}
+
+auto EquilibriumReducer::sample(Vec<ChemicalState> const& states, Vec<EquilibriumConditions> const& conditions) -> void
+{
+    pimpl->sample(states, conditions);
+}
+
+auto EquilibriumReducer::speciesFractions() const -> MatrixXdConstRef
+{
+    return pimpl->fractions;
+}
+
+auto EquilibriumReducer::reduce(Phases const& phases) const -> EquilibriumReduction
+{
+    return pimpl->reduce(phases);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,118 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class EquilibriumConditions;
+class EquilibriumSpecs;
+struct EquilibriumOptions;
+
+/// The result of a chemical system reduction with EquilibriumReducer.
+struct EquilibriumReduction
+{
+    /// The reduced chemical system, containing only the species and phases that are not negligible in the samples.
+    ChemicalSystem system;
+
+    /// The general phases of the reduced chemical system, which can be used to construct it again with reactions or surfaces.
+    Vec<GeneralPhase> phases;
+
+    /// The names of the species removed from the chemical system.
+    Strings removed_species;
+
+    /// The names of the phases removed from the chemical system (i.e., those with all species removed).
+    Strings removed_phases;
+
+    /// The largest mole fraction in the system of a removed species among all successful samples.
+    double max_removed_species_fraction = 0.0;
+
+    /// The largest sum of mole fractions in the system of all removed species among all successful samples (i.e., the largest fraction of the amount of matter neglected).
+    double max_removed_fraction = 0.0;
+
+    /// The number of samples used to determine the negligible species.
+    Index samples = 0;
+
+    /// The number of samples whose equilibrium calculation failed (these are not considered in the reduction).
+    Index failed_samples = 0;
+};
+
+/// Used to reduce a chemical system to the species and phases that are not negligible over an envelope of equilibrium conditions.
+/// Chemical systems constructed with, e.g., `speciate(...)` or `MineralPhases()`
+/// may contain many species that never exceed trace amounts in the conditions
+/// of an application, but they still cost property evaluations in every
+/// calculation. This class computes the equilibrium states of given samples of
+/// these conditions in parallel (see EquilibriumOptions::threads), records the
+/// mole fractions of all species in the system for each sample, and then
+/// creates a reduced chemical system in which species with mole fractions
+/// below a threshold in every sample are removed. Phases whose species are all
+/// removed are removed as well. To keep the elements of the original system,
+/// the most abundant species with an element is never removed if that element
+/// is present in any sample. The samples can be given in several calls to
+/// @ref sample before the reduced system is created with @ref reduce.
+class EquilibriumReducer
+{
+public:
+    /// Construct an EquilibriumReducer object with given chemical equilibrium specifications.
+    explicit EquilibriumReducer(EquilibriumSpecs const& specs);
+
+    /// Construct a copy of an EquilibriumReducer object.
+    EquilibriumReducer(EquilibriumReducer const& other);
+
+    /// Destroy this EquilibriumReducer object.
+    ~EquilibriumReducer();
+
+    /// Assign a copy of an EquilibriumReducer object to this.
+    auto operator=(EquilibriumReducer other) -> EquilibriumReducer&;
+
+    /// Set the options of the equilibrium calculations.
+    auto setOptions(EquilibriumOptions const& options) -> void;
+
+    /// Set the mole fraction in the system below which a species is considered negligible (default: 1e-12).
+    auto setThreshold(double threshold) -> void;
+
+    /// Compute the equilibrium states of given samples and record the mole fractions of the species.
+    /// @param states The initial guesses for the equilibrium calculations of the samples
+    /// @param conditions The equilibrium conditions of the samples
+    auto sample(Vec<ChemicalState> const& states, Vec<EquilibriumConditions> const& conditions) -> void;
+
+    /// Return the mole fractions in the system of the species in every successful sample so far (one row per sample).
+    auto speciesFractions() const -> MatrixXdConstRef;
+
+    /// Create a reduced chemical system from the general phases used to construct the original one.
+    /// Reactions and surfaces of the original chemical system are not
+    /// considered here; use EquilibriumReduction::phases to construct the
+    /// reduced chemical system with them.
+    /// @param phases The general phases used to construct the chemical system of the equilibrium specifications.
+    auto reduce(Phases const& phases) const -> EquilibriumReduction;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,52 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumReducer.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+using namespace Reaktoro;
+
+void exportEquilibriumReducer(py::module& m)
+{
+    py::class_<EquilibriumReduction>(m, "EquilibriumReduction")
+        .def(py::init<>())
+        .def_readwrite("system", &EquilibriumReduction::system, "The reduced chemical system, containing only the species and phases that are not negligible in the samples.")
+        .def_readwrite("phases", &EquilibriumReduction::phases, "The general phases of the reduced chemical system, which can be used to construct it again with reactions or surfaces.")
+        .def_readwrite("removed_species", &EquilibriumReduction::removed_species, "The names of the species removed from the chemical system.")
+        .def_readwrite("removed_phases", &EquilibriumReduction::removed_phases, "The names of the phases removed from the chemical system.")
+        .def_readwrite("max_removed_species_fraction", &EquilibriumReduction::max_removed_species_fraction, "The largest mole fraction in the system of a removed species among all successful samples.")
+        .def_readwrite("max_removed_fraction", &EquilibriumReduction::max_removed_fraction, "The largest sum of mole fractions in the system of all removed species among all successful samples.")
+        .def_readwrite("samples", &EquilibriumReduction::samples, "The number of samples used to determine the negligible species.")
+        .def_readwrite("failed_samples", &EquilibriumReduction::failed_samples, "The number of samples whose equilibrium calculation failed.")
+        ;
+
+    py::class_<EquilibriumReducer>(m, "EquilibriumReducer")
+        .def(py::init<EquilibriumSpecs const&>())
+        .def("setOptions", &EquilibriumReducer::setOptions)
+        .def("setThreshold", &EquilibriumReducer::setThreshold)
+        .def("sample", &EquilibriumReducer::sample, py::call_guard<py::gil_scoped_release>(), "Compute the equilibrium states of given samples and record the mole fractions of the species.", py::arg("states"), py::arg("conditions"))
+        .def("speciesFractions", &EquilibriumReducer::speciesFractions, py::return_value_policy::reference_internal)
+        .def("reduce", &EquilibriumReducer::reduce, "Create a reduced chemical system from the general phases used to construct the original one.", py::arg("phases"))
+        ;
+}
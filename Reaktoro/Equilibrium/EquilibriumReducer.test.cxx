@@ -0,0 +1,121 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumReducer.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing EquilibriumReducer", "[EquilibriumReducer]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs = EquilibriumSpecs::TP(system);
+
+    ChemicalState state0(system);
+    state0.set("H2O", 55.0, "mol");
+    state0.set("NaCl", 0.1, "mol");
+
+    Vec<ChemicalState> states;
+    Vec<EquilibriumConditions> conditions;
+
+    for(auto T : { 25.0, 50.0, 75.0, 100.0 })
+    {
+        EquilibriumConditions xconditions(specs);
+        xconditions.temperature(T, "celsius");
+        xconditions.pressure(1.0, "bar");
+        states.push_back(state0);
+        conditions.push_back(xconditions);
+    }
+
+    EquilibriumOptions options;
+    options.threads = 2;
+
+    EquilibriumReducer reducer(specs);
+    reducer.setOptions(options);
+    reducer.setThreshold(1e-12);
+
+    CHECK_THROWS( reducer.reduce(phases) ); // no samples yet
+
+    reducer.sample(states, conditions);
+
+    REQUIRE( reducer.speciesFractions().rows() == 4 );
+    REQUIRE( reducer.speciesFractions().cols() == system.species().size() );
+
+    const auto reduction = reducer.reduce(phases);
+
+    CHECK( reduction.samples == 4 );
+    CHECK( reduction.failed_samples == 0 );
+
+    // The products of water decomposition are negligible without redox conditions
+    CHECK( contains(reduction.removed_species, "H2") );
+    CHECK( contains(reduction.removed_species, "O2") );
+    CHECK_FALSE( contains(reduction.removed_species, "H2O") );
+    CHECK_FALSE( contains(reduction.removed_species, "Na+") );
+    CHECK_FALSE( contains(reduction.removed_species, "Cl-") );
+    CHECK( reduction.removed_phases.empty() );
+
+    CHECK( reduction.system.species().size() == system.species().size() - reduction.removed_species.size() );
+    CHECK( reduction.system.elements().size() == system.elements().size() );
+    CHECK( reduction.phases.size() == 1 );
+
+    CHECK( reduction.max_removed_species_fraction < 1e-12 );
+    CHECK( reduction.max_removed_fraction < 1e-12 * reduction.removed_species.size() );
+
+    // The reduced system gives the same equilibrium state for the major species (at 25 °C and 1 bar as in the first sample)
+    EquilibriumSolver solver(system);
+    ChemicalState state(state0);
+    REQUIRE( solver.solve(state).succeeded() );
+
+    ChemicalState reducedstate(reduction.system);
+    reducedstate.set("H2O", 55.0, "mol");
+    reducedstate.set("NaCl", 0.1, "mol");
+
+    EquilibriumSolver reducedsolver(reduction.system);
+    REQUIRE( reducedsolver.solve(reducedstate).succeeded() );
+
+    CHECK( reducedstate.speciesAmount("Na+") == Approx(state.speciesAmount("Na+")) );
+    CHECK( reducedstate.speciesAmount("Cl-") == Approx(state.speciesAmount("Cl-")) );
+}
@@ -17,11 +17,31 @@
 
 #include "EquilibriumResult.hpp"
 
+// C++ includes
+#include <algorithm>
+
 namespace Reaktoro {
 
+auto EquilibriumTiming::operator+=(const EquilibriumTiming& other) -> EquilibriumTiming&
+{
+    solve += other.solve;
+    properties += other.properties;
+    jacobian += other.jacobian;
+    optimizer += other.optimizer;
+    evaluations += other.evaluations;
+    jacobian_evaluations += other.jacobian_evaluations;
+    return *this;
+}
+
 auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> EquilibriumResult&
 {
     optima += other.optima;
+    timing += other.timing;
+    error = error || other.error;
+    budget_exhausted = budget_exhausted || other.budget_exhausted;
+    tolerance = std::max(tolerance, other.tolerance);
+    residual = std::max(residual, other.residual);
+    allocations += other.allocations;
     return *this;
 }
 
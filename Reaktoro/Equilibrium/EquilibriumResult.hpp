@@ -17,20 +17,74 @@
 
 #pragma once
 
+// Reaktoro includes
+#include <Reaktoro/Common/AllocationCounter.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
 // Optima includes
 #include <Optima/Result.hpp>
 
 namespace Reaktoro {
 
+/// Used to provide timing information of the operations during a chemical equilibrium calculation.
+struct EquilibriumTiming
+{
+    /// The time spent for solving the chemical equilibrium problem (in seconds).
+    double solve = 0.0;
+
+    /// The time spent for evaluating the chemical properties of the system, including standard thermodynamic and activity models (in seconds).
+    double properties = 0.0;
+
+    /// The time spent for computing the derivatives of the Gibbs energy gradient and constraint residuals, i.e., Jacobian assembly (in seconds).
+    double jacobian = 0.0;
+
+    /// The time spent in the optimization solver outside the evaluation of the chemical properties and their derivatives, mostly its linear algebra (in seconds).
+    double optimizer = 0.0;
+
+    /// The number of evaluations of the chemical properties of the system requested by the optimization solver.
+    Index evaluations = 0;
+
+    /// The number of evaluations of the chemical properties requested by the optimization solver that also needed the Jacobian.
+    Index jacobian_evaluations = 0;
+
+    /// Self addition of another EquilibriumTiming instance to this one.
+    auto operator+=(const EquilibriumTiming& other) -> EquilibriumTiming&;
+};
+
+/// The possible outcomes of a chemical equilibrium or kinetics calculation.
+enum class EquilibriumStatus
+{
+    /// The calculation succeeded.
+    Succeeded,
+
+    /// The calculation did not converge.
+    NotConverged,
+
+    /// The calculation was stopped before convergence because its time or iteration budget was exhausted (see EquilibriumOptions::time_budget).
+    BudgetExhausted,
+
+    /// The calculation was interrupted by an error (only reported with EquilibriumOptions::quiet, otherwise the error is thrown).
+    Error,
+};
+
 /// A type used to describe the result of an equilibrium calculation
 /// @see ChemicalState
 struct EquilibriumResult
 {
     /// Return true if the calculation succeeded.
-    auto succeeded() const { return optima.succeeded; };
+    auto succeeded() const { return optima.succeeded && !error; };
 
     /// Return true if the calculation failed.
-    auto failed() const { return !optima.succeeded; };
+    auto failed() const { return !succeeded(); };
+
+    /// Return the outcome of the calculation.
+    auto status() const
+    {
+        if(error) return EquilibriumStatus::Error;
+        if(optima.succeeded) return EquilibriumStatus::Succeeded;
+        if(budget_exhausted) return EquilibriumStatus::BudgetExhausted;
+        return EquilibriumStatus::NotConverged;
+    };
 
     /// Return the number of iterations in the calculation.
     auto iterations() const { return optima.iterations; };
@@ -38,8 +92,76 @@ struct EquilibriumResult
     /// The result of the optimisation calculation using Optima.
     Optima::Result optima;
 
+    /// The timing information of the operations during the chemical equilibrium calculation.
+    EquilibriumTiming timing;
+
+    /// The flag indicating if the calculation was interrupted by an error (only set with EquilibriumOptions::quiet).
+    bool error = false;
+
+    /// The flag indicating if the calculation was stopped before convergence because its time or iteration budget was exhausted (see EquilibriumOptions::time_budget).
+    bool budget_exhausted = false;
+
+    /// The convergence tolerance used in the calculation (see EquilibriumConditions::setTolerance), or zero if unknown (e.g., in mass-action speciation calculations).
+    double tolerance = 0.0;
+
+    /// The largest residual of the conservation of the components at the computed state, relative to the largest amount of a component.
+    /// This is the mass balance error introduced by the calculation, which
+    /// accumulates over the time steps of operator-split reactive transport,
+    /// unlike the error in the speciation, which is not carried over from
+    /// one time step to the next. It is zero if not computed (e.g., in
+    /// mass-action speciation calculations, which conserve the components
+    /// exactly).
+    double residual = 0.0;
+
+    /// The heap allocations performed during the calculation (only counted if AllocationCounter::supported).
+    AllocationStats allocations;
+
     /// Apply an addition assignment to this instance
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
 
+/// A compact summary of the failures in a batch of chemical equilibrium or kinetics calculations.
+struct EquilibriumBatchSummary
+{
+    /// The number of calculations in the batch.
+    Index size = 0;
+
+    /// The number of calculations in the batch that did not converge.
+    Index not_converged = 0;
+
+    /// The number of calculations in the batch stopped because their time or iteration budget was exhausted.
+    Index budget_exhausted = 0;
+
+    /// The number of calculations in the batch interrupted by an error.
+    Index errors = 0;
+
+    /// The indices of the failed calculations in the batch.
+    Indices failed;
+
+    /// Return true if all calculations in the batch succeeded.
+    auto succeeded() const { return failed.empty(); };
+};
+
+/// Return a summary of the failures in a batch of chemical equilibrium or kinetics calculations.
+/// @param results The results of the calculations (e.g., from the batched methods of EquilibriumSolver or KineticsSolver)
+template<typename Results>
+auto summarizeFailures(Results const& results) -> EquilibriumBatchSummary
+{
+    EquilibriumBatchSummary summary;
+    summary.size = results.size();
+    for(Index i = 0; i < results.size(); ++i)
+    {
+        const auto status = results[i].status();
+        if(status == EquilibriumStatus::Succeeded)
+            continue;
+        summary.failed.push_back(i);
+        if(status == EquilibriumStatus::Error)
+            summary.errors += 1;
+        else if(status == EquilibriumStatus::BudgetExhausted)
+            summary.budget_exhausted += 1;
+        else summary.not_converged += 1;
+    }
+    return summary;
+}
+
 } // namespace Reaktoro
@@ -24,11 +24,48 @@ using namespace Reaktoro;
 
 void exportEquilibriumResult(py::module& m)
 {
+    py::class_<EquilibriumTiming>(m, "EquilibriumTiming")
+        .def(py::init<>())
+        .def_readwrite("solve", &EquilibriumTiming::solve)
+        .def_readwrite("properties", &EquilibriumTiming::properties)
+        .def_readwrite("jacobian", &EquilibriumTiming::jacobian)
+        .def_readwrite("optimizer", &EquilibriumTiming::optimizer)
+        .def_readwrite("evaluations", &EquilibriumTiming::evaluations)
+        .def_readwrite("jacobian_evaluations", &EquilibriumTiming::jacobian_evaluations)
+        .def(py::self += py::self)
+        ;
+
+    py::enum_<EquilibriumStatus>(m, "EquilibriumStatus")
+        .value("Succeeded", EquilibriumStatus::Succeeded)
+        .value("NotConverged", EquilibriumStatus::NotConverged)
+        .value("BudgetExhausted", EquilibriumStatus::BudgetExhausted)
+        .value("Error", EquilibriumStatus::Error)
+        ;
+
     py::class_<EquilibriumResult>(m, "EquilibriumResult")
         .def(py::init<>())
         .def("succeeded", &EquilibriumResult::succeeded, "Return true if the calculation succeeded.")
         .def("failed", &EquilibriumResult::failed, "Return true if the calculation failed.")
+        .def("status", &EquilibriumResult::status, "Return the outcome of the calculation.")
         .def("iterations", &EquilibriumResult::iterations, "Return the number of iterations in the calculation.")
         .def_readwrite("optima", &EquilibriumResult::optima)
+        .def_readwrite("timing", &EquilibriumResult::timing)
+        .def_readwrite("error", &EquilibriumResult::error)
+        .def_readwrite("budget_exhausted", &EquilibriumResult::budget_exhausted)
+        .def_readwrite("tolerance", &EquilibriumResult::tolerance)
+        .def_readwrite("residual", &EquilibriumResult::residual)
+        .def_readwrite("allocations", &EquilibriumResult::allocations)
         ;
+
+    py::class_<EquilibriumBatchSummary>(m, "EquilibriumBatchSummary")
+        .def(py::init<>())
+        .def_readwrite("size", &EquilibriumBatchSummary::size)
+        .def_readwrite("not_converged", &EquilibriumBatchSummary::not_converged)
+        .def_readwrite("budget_exhausted", &EquilibriumBatchSummary::budget_exhausted)
+        .def_readwrite("errors", &EquilibriumBatchSummary::errors)
+        .def_readwrite("failed", &EquilibriumBatchSummary::failed)
+        .def("succeeded", &EquilibriumBatchSummary::succeeded, "Return true if all calculations in the batch succeeded.")
+        ;
+
+    m.def("summarizeFailures", summarizeFailures<Vec<EquilibriumResult>>, "Return a summary of the failures in a batch of chemical equilibrium calculations.");
 }
@@ -36,4 +36,31 @@ TEST_CASE("Testing EquilibriumResult", "[EquilibriumResult]")
     CHECK( result.succeeded() == true );
     CHECK( result.failed() == false );
     CHECK( result.iterations() == 23 );
+    CHECK( result.status() == EquilibriumStatus::Succeeded );
+
+    EquilibriumResult notconverged;
+    EquilibriumResult interrupted;
+    interrupted.error = true;
+    EquilibriumResult exhausted;
+    exhausted.budget_exhausted = true;
+
+    CHECK( notconverged.status() == EquilibriumStatus::NotConverged );
+    CHECK( interrupted.status() == EquilibriumStatus::Error );
+    CHECK( exhausted.status() == EquilibriumStatus::BudgetExhausted );
+
+    const auto summary = summarizeFailures(Vec<EquilibriumResult>{ result, notconverged, result, interrupted, exhausted });
+
+    CHECK( summary.size == 5 );
+    CHECK( summary.not_converged == 1 );
+    CHECK( summary.budget_exhausted == 1 );
+    CHECK( summary.errors == 1 );
+    CHECK( summary.failed == Indices{1, 3, 4} );
+    CHECK( summary.succeeded() == false );
+
+    result.allocations = { 3, 120 };
+    exhausted.allocations = { 2, 80 };
+    result += exhausted;
+
+    CHECK( result.allocations.allocations == 5 );
+    CHECK( result.allocations.bytes == 200 );
 }
@@ -18,6 +18,8 @@
 #include "EquilibriumSensitivity.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 
 namespace Reaktoro {
@@ -30,6 +32,11 @@ EquilibriumSensitivity::EquilibriumSensitivity(EquilibriumSpecs const& specs)
     initialize(specs);
 }
 
+EquilibriumSensitivity::EquilibriumSensitivity(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents)
+{
+    initialize(specs, wids, icomponents);
+}
+
 auto EquilibriumSensitivity::initialize(EquilibriumSpecs const& specs) -> void
 {
     msystem = specs.system();
@@ -37,6 +44,10 @@ auto EquilibriumSensitivity::initialize(EquilibriumSpecs const& specs) -> void
 
     const EquilibriumDims dims(specs);
 
+    mselective = false;
+    miws = range(dims.Nw);
+    mics = range(dims.Nc);
+
     const auto Nw = dims.Nw;
     const auto Nn = dims.Nn;
     const auto Np = dims.Np;
@@ -51,6 +62,49 @@ auto EquilibriumSensitivity::initialize(EquilibriumSpecs const& specs) -> void
     mdqdc.resize(Nq, Nc);
 }
 
+auto EquilibriumSensitivity::initialize(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents) -> void
+{
+    initialize(specs);
+
+    const EquilibriumDims dims(specs);
+
+    miws.clear();
+    for(auto const& wid : wids)
+    {
+        const auto idx = index(minputs, wid);
+        errorif(idx >= minputs.size(), "There is no input variable with identifier `", wid, "` in the equilibrium specifications used to initialize the EquilibriumSensitivity object.");
+        miws.push_back(idx);
+    }
+
+    for(auto i : icomponents)
+        errorif(i >= dims.Nc, "The index of a conservative component (", i, ") exceeds the number of conservative components (", dims.Nc, ") in the equilibrium specifications used to initialize the EquilibriumSensitivity object.");
+
+    mics = icomponents;
+    mselective = true;
+
+    mdndw.setZero();
+    mdpdw.setZero();
+    mdqdw.setZero();
+    mdndc.setZero();
+    mdpdc.setZero();
+    mdqdc.setZero();
+}
+
+auto EquilibriumSensitivity::selective() const -> bool
+{
+    return mselective;
+}
+
+auto EquilibriumSensitivity::indicesSelectedInputs() const -> Indices const&
+{
+    return miws;
+}
+
+auto EquilibriumSensitivity::indicesSelectedComponents() const -> Indices const&
+{
+    return mics;
+}
+
 auto EquilibriumSensitivity::dndw(String const& wid) const -> VectorXdConstRef
 {
     const auto idx = index(minputs, wid);
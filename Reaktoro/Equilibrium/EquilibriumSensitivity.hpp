@@ -43,9 +43,35 @@ public:
     /// Construct an EquilibriumSensitivity object with given equilibrium problem specifications.
     explicit EquilibriumSensitivity(EquilibriumSpecs const& specs);
 
+    /// Construct an EquilibriumSensitivity object that only computes derivatives with respect to selected inputs.
+    /// @param specs The specifications of the equilibrium problem.
+    /// @param wids The identifiers of the input variables in *w* for which derivatives are computed (e.g., "T", "pH").
+    /// @param icomponents The indices of the conservative components in *c* for which derivatives are computed.
+    EquilibriumSensitivity(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents);
+
     /// Initialize this EquilibriumSensitivity object with given equilibrium problem specifications.
     auto initialize(EquilibriumSpecs const& specs) -> void;
 
+    /// Initialize this EquilibriumSensitivity object so that only derivatives with respect to selected inputs are computed.
+    /// The sensitivity derivatives with respect to the input variables in *w*
+    /// and component amounts in *c* that are not selected are not computed
+    /// and remain zero in the matrices of this object. This reduces the
+    /// number of right-hand sides in the sensitivity linear systems and the
+    /// number of evaluations of the chemical properties needed for them.
+    /// @param specs The specifications of the equilibrium problem.
+    /// @param wids The identifiers of the input variables in *w* for which derivatives are computed (e.g., "T", "pH").
+    /// @param icomponents The indices of the conservative components in *c* for which derivatives are computed.
+    auto initialize(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents) -> void;
+
+    /// Return true if only derivatives with respect to selected inputs are computed.
+    auto selective() const -> bool;
+
+    /// Return the indices of the input variables in *w* for which derivatives are computed.
+    auto indicesSelectedInputs() const -> Indices const&;
+
+    /// Return the indices of the conservative components in *c* for which derivatives are computed.
+    auto indicesSelectedComponents() const -> Indices const&;
+
     //======================================================================
     // DERIVATIVES OF SPECIES AMOUNTS WITH RESPECT TO INPUT PARAMETERS
     //======================================================================
@@ -153,6 +179,15 @@ private:
     /// The input variables *w* in the chemical equilibrium problem specifications.
     Strings minputs;
 
+    /// The flag indicating if only derivatives with respect to selected inputs are computed.
+    bool mselective = false;
+
+    /// The indices of the input variables in *w* for which derivatives are computed.
+    Indices miws;
+
+    /// The indices of the conservative components in *c* for which derivatives are computed.
+    Indices mics;
+
     /// The derivatives of the species amounts *n* with respect to input variables *w*.
     MatrixXd mdndw;
 
@@ -31,7 +31,12 @@ void exportEquilibriumSensitivity(py::module& m)
     py::class_<EquilibriumSensitivity>(m, "EquilibriumSensitivity")
         .def(py::init<>())
         .def(py::init<EquilibriumSpecs const&>())
-        .def("initialize", &EquilibriumSensitivity::initialize, "Initialize this EquilibriumSensitivity object with given equilibrium problem specifications.")
+        .def(py::init<EquilibriumSpecs const&, Strings const&, Indices const&>())
+        .def("initialize", py::overload_cast<EquilibriumSpecs const&>(&EquilibriumSensitivity::initialize), "Initialize this EquilibriumSensitivity object with given equilibrium problem specifications.")
+        .def("initialize", py::overload_cast<EquilibriumSpecs const&, Strings const&, Indices const&>(&EquilibriumSensitivity::initialize), "Initialize this EquilibriumSensitivity object so that only derivatives with respect to selected inputs are computed.")
+        .def("selective", &EquilibriumSensitivity::selective, "Return true if only derivatives with respect to selected inputs are computed.")
+        .def("indicesSelectedInputs", &EquilibriumSensitivity::indicesSelectedInputs, return_internal_ref, "Return the indices of the input variables in w for which derivatives are computed.")
+        .def("indicesSelectedComponents", &EquilibriumSensitivity::indicesSelectedComponents, return_internal_ref, "Return the indices of the conservative components in c for which derivatives are computed.")
         .def("dndw", py::overload_cast<String const&>(&EquilibriumSensitivity::dndw, py::const_), return_internal_ref, "Return the derivatives of the species amounts n with respect to an input variable in w.")
         .def("dndw", py::overload_cast<Param const&>(&EquilibriumSensitivity::dndw, py::const_), return_internal_ref, "Return the derivatives of the species amounts n with respect to an input variable in w.")
         .def("dndw", py::overload_cast<>(&EquilibriumSensitivity::dndw, py::const_), return_internal_ref, "Return the derivatives of the species amounts n with respect to the input variables w.")
@@ -17,10 +17,14 @@
 
 #include "EquilibriumSetup.hpp"
 
+// C++ includes
+#include <algorithm>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -81,8 +85,37 @@ struct EquilibriumSetup::Impl
     MatrixXd Vpp;                             ///< The Jacobian of vp with respect to p.
     MatrixXd Vpc;                             ///< The Jacobian of vp with respect to c = (w, b).
     ArrayXr mu;                               ///< The auxiliary vector of chemical potentials of the species.
+    VectorXd u;                               ///< The auxiliary vector of chemical potentials of the species normalized by RT (used in the quasi-Newton Hessian mode).
     VectorXl isbasicvar;                      ///< The bitmap that indicates which variables in x = (n, q) are currently basic variables.
     Indices ipps;                             ///< The indices of the pure phase species (i.e., species composing single-phase species, whose chemical potentials do not depend on composition)
+    Indices phaseoffsets;                     ///< The indices of the first species in each phase followed by the number of species (used for the block-sparse assembly of Hxx)
+    Vec<Indices> pendingcols;                 ///< The auxiliary lists of columns of Hxx, for each phase, still to be computed when seeding several species at once
+    Indices seeded;                           ///< The auxiliary list of species currently seeded when seeding several species at once
+    MatrixXd dlnadn;                          ///< The auxiliary matrix with the analytic derivatives of the ln activities of the species in a phase with respect to their amounts
+    MatrixXd dlnadnideal;                     ///< The auxiliary matrix with the analytic derivatives of the ideal ln activities of the species in a phase with respect to their amounts
+    VectorXd gradF;                           ///< The auxiliary vector with the combined derivatives of F when seeding several species at once
+    bool assembling_jacobian = false;         ///< The flag indicating the full Jacobian of the chemical properties is being assembled (for sensitivity derivatives)
+    VectorXd nlast;                           ///< The species amounts in the last evaluation of the chemical properties (used when pruning inactive phases)
+    VectorXd plast;                           ///< The *p* control variables in the last evaluation of the chemical properties (used when pruning inactive phases)
+    VectorXd wlast;                           ///< The input variables *w* in the last evaluation of the chemical properties (used when pruning inactive phases)
+    bool phasesvalid = false;                 ///< The flag indicating the properties of all phases correspond to (nlast, plast, wlast) (used when pruning inactive phases)
+    Indices activephases;                     ///< The auxiliary list of phases re-evaluated when pruning inactive phases
+    bool gradxvalid = false;                  ///< The flag indicating Hxx and Vpx contain derivatives that can be reused (see EquilibriumOptions::jacobian_reuse)
+    bool gradxreusable = true;                ///< The flag indicating derivatives can be reused in the current calculation
+    bool gradxreused = false;                 ///< The flag indicating previously computed derivatives were reused in the current calculation
+    Index gradxage = 0;                       ///< The number of consecutive evaluations of Hxx and Vpx skipped by reusing previously computed derivatives
+    VectorXl ibasicvarslast;                  ///< The indices of the basic variables when Hxx and Vpx were last computed
+    VectorXd xplast;                          ///< The values of (x, p) in the last evaluation of Hxx and Vpx in the current calculation (empty if none yet)
+    double steplast = 0.0;                    ///< The length of the last step in (x, p) between evaluations of Hxx and Vpx in the current calculation (zero if unknown)
+    VectorXl propsdependonp;                  ///< The bitmap that indicates which variables in *p* affect the chemical properties of the system (i.e., temperature and pressure when unknown)
+    VectorXl propsdependonw;                  ///< The bitmap that indicates which variables in *w* affect the chemical properties of the system (i.e., temperature, pressure and input model parameters)
+    bool propsclean = false;                  ///< The flag indicating the chemical properties carry no derivative information from a previously seeded variable
+    Vec<Indices> colors;                      ///< The groups of species, with at most one species from each phase, whose amounts are perturbed together in finite differences
+    VectorXd fdsteps;                         ///< The perturbations of the species amounts in finite differences
+    MatrixXd fdgn;                            ///< The chemical potentials of the species (normalized by RT) after perturbing the species amounts in each color
+    Vec<VectorXr> fdn;                        ///< The perturbed species amounts used by each worker thread in finite differences
+    Vec<EquilibriumProps> fdprops;            ///< The chemical properties evaluated by each worker thread in finite differences (created on first use)
+    SharedPtr<ThreadPool> fdpool;             ///< The pool of worker threads evaluating the colors concurrently in finite differences (created on first use)
 
     // -------------------------------------------- //
     // ------ CONVENIENT AUXILIARY VARIABLES ------ //
@@ -137,15 +170,35 @@ struct EquilibriumSetup::Impl
 
         isbasicvar.resize(Nx);
 
-        // Initialize the indices of the pure phase species
+        // Initialize the indices of the pure phase species and the offsets of the phases
         auto offset = 0;
         for(auto const& phase : system.phases())
         {
             const auto size = phase.species().size();
             if(size == 1)
                 ipps.push_back(offset);
+            phaseoffsets.push_back(offset);
             offset += size;
         }
+        phaseoffsets.push_back(offset);
+
+        // Initialize the bitmaps of the p and w variables that affect the chemical properties of the system
+        propsdependonp.resize(Np);
+        propsdependonw.resize(Nw);
+        propsdependonp.fill(false);
+        propsdependonw.fill(false);
+
+        const auto iTp = specs.indexTemperatureAmongControlVariablesP();
+        const auto iPp = specs.indexPressureAmongControlVariablesP();
+        const auto iTw = specs.indexTemperatureAmongInputVariables();
+        const auto iPw = specs.indexPressureAmongInputVariables();
+
+        if(iTp < Np) propsdependonp[iTp] = true;
+        if(iPp < Np) propsdependonp[iPp] = true;
+        if(iTw < Nw) propsdependonw[iTw] = true;
+        if(iPw < Nw) propsdependonw[iPw] = true;
+        for(auto i : specs.indicesInputParams())
+            propsdependonw[i] = true;
     }
 
     auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
@@ -178,7 +231,11 @@ struct EquilibriumSetup::Impl
         p = pp;
         w = ww;
 
-        props.update(n, p, w, options.use_ideal_activity_models);
+        if(options.prune_inactive_phases)
+            updatePropsPruningInactivePhases();
+        else props.update(n, p, w, options.use_ideal_activity_models);
+
+        propsclean = true;
 
         updateF();
         updateGibbsEnergy(); // let this after updateF because of update in mu performed by updateF
@@ -186,8 +243,48 @@ struct EquilibriumSetup::Impl
         vp = F.tail(Np);
     }
 
+    /// Update the chemical properties re-evaluating only the phases whose species amounts changed since the last evaluation.
+    /// All phases are re-evaluated if *p* or *w* changed, or if the chemical properties were evaluated in between with
+    /// a different choice of ideal/non-ideal activity models (see #phasesvalid).
+    auto updatePropsPruningInactivePhases() -> void
+    {
+        const VectorXd nval = n.cast<double>();
+        const VectorXd pval = p.cast<double>();
+        const VectorXd wval = w.cast<double>();
+
+        if(phasesvalid && pval == plast && wval == wlast)
+        {
+            const auto numphases = phaseoffsets.size() - 1;
+            activephases.clear();
+            for(auto k = 0; k < numphases; ++k)
+            {
+                const auto offset = phaseoffsets[k];
+                const auto size = phaseoffsets[k + 1] - offset;
+                if(nval.segment(offset, size) != nlast.segment(offset, size))
+                    activephases.push_back(k);
+            }
+            props.updatePhases(activephases, n, p, w, options.use_ideal_activity_models);
+        }
+        else props.update(n, p, w, options.use_ideal_activity_models);
+
+        nlast = nval;
+        plast = pval;
+        wlast = wval;
+        phasesvalid = true;
+    }
+
+    /// Invalidate the properties of the phases for pruning purposes if they were evaluated with a different choice of activity models.
+    auto checkPhasesValidity(bool useIdealModel) -> void
+    {
+        if(useIdealModel != options.use_ideal_activity_models)
+            phasesvalid = false;
+    }
+
     auto updateGradX(VectorXlConstRef ibasicvars) -> void
     {
+        if(reuseGradX(ibasicvars))
+            return;
+
         isbasicvar.fill(false);
         isbasicvar(ibasicvars).fill(true);
 
@@ -213,13 +310,29 @@ struct EquilibriumSetup::Impl
                 Hnn = hessian.approximate(n);
                 add_log_barrier_contrib(Hnn);
             }
+            else if(options.hessian == GibbsHessian::QuasiNewton)
+            {
+                // Remove the log barrier contribution from gx so that the secant updates only see µ/RT
+                const auto tau = options.epsilon * options.logarithm_barrier_factor;
+                u = gx.head(Nn);
+                for(auto i : ipps)
+                    u[i] += tau/n[i].val();
+                Hnn = hessian.quasiNewton(props.chemicalState().temperature(), props.chemicalState().pressure(), n, u, options.quasi_newton_memory);
+                add_log_barrier_contrib(Hnn);
+            }
             else if(options.hessian == GibbsHessian::PartiallyExact)
             {
                 Hnn = hessian.approximate(n);
                 add_log_barrier_contrib(Hnn);
 
                 // Update columns of Hxx and Vpx corresponding to primary species
-                for(auto i : ibasicvars)
+                if(usingFiniteDifferences())
+                    updateGradXWithFiniteDifferences(true);
+                else if(options.use_block_sparse_hessian)
+                    updateGradXByPhase(true);
+                else if(usingMultipleSeeds())
+                    updateGradXWithMultipleSeeds(true);
+                else for(auto i : ibasicvars)
                 {
                     if(i >= Nn) continue; // i corresponds to a `q` variable, and the implicit titrant is currently a primary species
                     updateFx(i);
@@ -229,7 +342,13 @@ struct EquilibriumSetup::Impl
             else // case GibbsHessian::Exact
             {
                 // Update Hxx and Vpx columns for all species
-                for(auto i = 0; i < Nn; ++i)
+                if(usingFiniteDifferences())
+                    updateGradXWithFiniteDifferences(false);
+                else if(options.use_block_sparse_hessian)
+                    updateGradXByPhase(false);
+                else if(usingMultipleSeeds())
+                    updateGradXWithMultipleSeeds(false);
+                else for(auto i = 0; i < Nn; ++i)
                 {
                     updateFx(i);
                     Hxx.col(i) = grad(F.head(Nx));
@@ -254,6 +373,316 @@ struct EquilibriumSetup::Impl
         Hxx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
         Hxx.bottomRows(Nq).fill(0.0); // these are derivatives w.r.t. amounts of implicit titrants q
         Vpx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
+
+        gradxvalid = true;
+        gradxage = 0;
+        ibasicvarslast = ibasicvars;
+    }
+
+    /// Return true if the previously computed Hxx and Vpx can be reused instead of computed again (see EquilibriumOptions::jacobian_reuse).
+    /// The convergence rate of the iterations is monitored with the ratio
+    /// between the lengths of the last two steps in (x, p), which is small in
+    /// a converging Newton method and approaches one as convergence slows down.
+    auto reuseGradX(VectorXlConstRef ibasicvars) -> bool
+    {
+        if(options.jacobian_reuse == 0)
+            return false;
+
+        VectorXd xp(Nx + Np);
+        xp << x.cast<double>(), p.cast<double>();
+
+        auto contraction = 0.0;
+        if(xplast.size() == xp.size())
+        {
+            const auto step = (xp - xplast).norm();
+            contraction = steplast > 0.0 ? step / steplast : 0.0;
+            steplast = step;
+        }
+        xplast = xp;
+
+        const auto samebasicvars = ibasicvars.size() == ibasicvarslast.size() && ibasicvars == ibasicvarslast;
+
+        const auto reusable = gradxvalid && gradxreusable && !assembling_jacobian && samebasicvars
+            && gradxage < options.jacobian_reuse
+            && contraction <= options.jacobian_reuse_contraction;
+
+        if(reusable)
+        {
+            gradxage += 1;
+            gradxreused = true;
+        }
+
+        return reusable;
+    }
+
+    /// Update the columns of Hxx and Vpx corresponding to species amounts by re-evaluating, for each column, only the phase containing the species.
+    /// The chemical potentials of the species in the other phases are
+    /// assumed independent of the seeded species amount, and thus the other
+    /// phases are not re-evaluated. This produces a block-diagonal Hnn (plus
+    /// the coupling rows of the *q* variables) at a fraction of the cost of
+    /// re-evaluating the whole system for every column.
+    /// Phases for which the derivatives are known analytically are not
+    /// re-evaluated at all (see @ref updateGradXInPhaseAnalytically).
+    /// @param onlybasicvars If true, only columns of current basic variables are updated.
+    auto updateGradXByPhase(bool onlybasicvars) -> void
+    {
+        const auto numphases = phaseoffsets.size() - 1;
+        for(auto k = 0; k < numphases; ++k)
+        {
+            if(updateGradXInPhaseAnalytically(k, onlybasicvars))
+                continue;
+
+            auto evaluated = false;
+            for(auto i = phaseoffsets[k]; i < phaseoffsets[k + 1]; ++i)
+            {
+                if(onlybasicvars && !isbasicvar[i]) continue;
+                updateFnInPhase(k, i);
+                Hxx.col(i) = grad(F.head(Nx));
+                Vpx.col(i) = grad(F.tail(Np));
+                evaluated = true;
+            }
+            // Restore the properties of the phase so that they carry no derivative information before the next phase is processed
+            if(evaluated)
+                props.updatePhase(k, n, p, w, options.use_ideal_activity_models, -1);
+        }
+    }
+
+    /// Update the columns of Hxx and Vpx corresponding to the species in a phase without re-evaluating the phase, returning false if this is not possible.
+    /// This is possible for phases with a single species, whose chemical
+    /// potentials do not depend on the amount of the phase, and for phases
+    /// whose activity models (ideal or not, depending on the column, see
+    /// @ref useIdealModelForGradWrtVariableN) have analytic derivatives given
+    /// by an ActivityModelJacobian function. The chemical potentials of the
+    /// species in other phases are assumed independent of the species amounts
+    /// in this phase, as in @ref updateGradXByPhase.
+    /// @param iphase The index of the phase.
+    /// @param onlybasicvars If true, only columns of current basic variables are updated.
+    auto updateGradXInPhaseAnalytically(Index iphase, bool onlybasicvars) -> bool
+    {
+        if(assembling_jacobian) // the derivatives of all chemical properties are needed in this case, not only those of the chemical potentials
+            return false;
+
+        const auto offset = phaseoffsets[iphase];
+        const auto size = phaseoffsets[iphase + 1] - offset;
+
+        if(size == 1)
+        {
+            if(onlybasicvars && !isbasicvar[offset])
+                return true;
+            const auto tau = options.epsilon * options.logarithm_barrier_factor;
+            Hxx.col(offset).setZero();
+            Hxx(offset, offset) = tau/(n[offset].val() * n[offset].val()); // only the log barrier term depends on the amount of a pure phase species
+            Vpx.col(offset).setZero();
+            return true;
+        }
+
+        auto usingideal = false;
+        auto usingnonideal = false;
+        for(auto i = offset; i < offset + size; ++i)
+        {
+            if(onlybasicvars && !isbasicvar[i]) continue;
+            if(useIdealModelForGradWrtVariableN(i)) usingideal = true;
+            else usingnonideal = true;
+        }
+
+        auto const& phase = system.phase(iphase);
+        auto const& jacobian = phase.activityModelJacobian();
+        auto const& idealjacobian = phase.idealActivityModelJacobian();
+
+        if((usingideal && !idealjacobian) || (usingnonideal && !jacobian))
+            return false;
+
+        const auto pprops = props.chemicalProps().phaseProps(iphase);
+        const auto T = pprops.temperature();
+        const auto P = pprops.pressure();
+        const auto nsum = pprops.amount().val();
+        ActivityModelArgs args{ T, P, pprops.speciesMoleFractions() };
+
+        if(usingideal)
+        {
+            dlnadnideal.resize(size, size);
+            idealjacobian(dlnadnideal, args, nsum);
+        }
+
+        if(usingnonideal)
+        {
+            dlnadn.resize(size, size);
+            jacobian(dlnadn, args, nsum);
+        }
+
+        // With µ[i]/RT = G0[i]/RT + ln(a[i]) at fixed temperature and pressure, the phase block of Hxx is ∂(ln a)/∂n
+        for(auto i = offset; i < offset + size; ++i)
+        {
+            if(onlybasicvars && !isbasicvar[i]) continue;
+            auto const& J = useIdealModelForGradWrtVariableN(i) ? dlnadnideal : dlnadn;
+            Hxx.col(i).setZero();
+            Hxx.col(i).segment(offset, size) = J.col(i - offset);
+            Vpx.col(i).setZero();
+        }
+
+        return true;
+    }
+
+    /// Return true if the columns of Hxx should be computed with finite differences instead of automatic differentiation.
+    auto usingFiniteDifferences() const -> bool
+    {
+        return options.jacobian_finite_differences > 0.0 && !assembling_jacobian;
+    }
+
+    /// Update the columns of Hxx corresponding to species amounts with forward finite differences, perturbing the amounts of one species from each phase at once.
+    /// The species are grouped into colors, the color of a species being its
+    /// position in its phase, so that no two species in a color belong to the
+    /// same phase. The colors are evaluated concurrently with independent
+    /// copies of the chemical properties if EquilibriumOptions::jacobian_threads
+    /// is not one. This method assumes there are no *p* control variables.
+    /// @param onlybasicvars If true, only columns of current basic variables are updated.
+    auto updateGradXWithFiniteDifferences(bool onlybasicvars) -> void
+    {
+        const auto numphases = phaseoffsets.size() - 1;
+
+        colors.clear();
+        for(auto k = 0; k < numphases; ++k)
+        {
+            for(auto i = phaseoffsets[k]; i < phaseoffsets[k + 1]; ++i)
+            {
+                if(onlybasicvars && !isbasicvar[i]) continue;
+                const auto c = i - phaseoffsets[k];
+                if(colors.size() <= c)
+                    colors.resize(c + 1);
+                colors[c].push_back(i);
+            }
+        }
+
+        const auto numcolors = colors.size();
+
+        if(numcolors == 0)
+            return;
+
+        initializeFiniteDifferenceWorkers();
+
+        fdsteps.resize(Nn);
+        for(auto i = 0; i < Nn; ++i)
+            fdsteps[i] = options.jacobian_finite_differences * std::max(n[i].val(), options.epsilon);
+
+        fdgn.resize(Nn, numcolors);
+
+        const auto tau = options.epsilon * options.logarithm_barrier_factor;
+
+        auto evaluate = [&](Index c, Index iworker)
+        {
+            auto& nc = fdn[iworker];
+            auto& propsc = fdprops[iworker];
+            nc = n;
+            for(auto i : colors[c])
+                nc[i] += fdsteps[i];
+            propsc.update(nc, p, w, options.use_ideal_activity_models);
+            auto const& chemprops = propsc.chemicalProps();
+            const auto RT = universalGasConstant * chemprops.temperature().val();
+            auto gn = fdgn.col(c);
+            gn = chemprops.speciesChemicalPotentials().matrix().cast<double>() / RT;
+            for(auto i : ipps)
+                gn[i] -= tau/nc[i].val();
+        };
+
+        if(fdpool)
+            fdpool->parallelFor(numcolors, evaluate);
+        else for(auto c = 0; c < numcolors; ++c)
+            evaluate(c, 0);
+
+        auto phaseOf = [&](Index i) { return std::upper_bound(phaseoffsets.begin(), phaseoffsets.end(), i) - phaseoffsets.begin() - 1; };
+
+        for(auto c = 0; c < numcolors; ++c)
+        {
+            for(auto i : colors[c])
+            {
+                const auto k = phaseOf(i);
+                const auto offset = phaseoffsets[k];
+                const auto size = phaseoffsets[k + 1] - offset;
+                Hxx.col(i).setZero();
+                Hxx.col(i).segment(offset, size) = (fdgn.col(c).segment(offset, size) - gx.segment(offset, size)) / fdsteps[i];
+                Vpx.col(i).setZero();
+            }
+        }
+    }
+
+    /// Initialize the copies of the chemical properties and the pool of worker threads used in finite differences, if not yet.
+    auto initializeFiniteDifferenceWorkers() -> void
+    {
+        if(options.jacobian_threads != 1 && !fdpool)
+            fdpool = std::make_shared<ThreadPool>(options.jacobian_threads);
+
+        const auto numworkers = fdpool ? fdpool->numThreads() : 1;
+
+        if(fdprops.size() == numworkers)
+            return;
+
+        fdprops.assign(numworkers, props);
+        fdn.assign(numworkers, n);
+    }
+
+    /// Return true if several species amounts should be seeded at once in the computation of Hxx.
+    auto usingMultipleSeeds() const -> bool
+    {
+        return options.jacobian_seeds > 1 && !assembling_jacobian;
+    }
+
+    /// Update the columns of Hxx and Vpx corresponding to species amounts by seeding up to EquilibriumOptions::jacobian_seeds species from distinct phases in each evaluation of the chemical properties.
+    /// The derivatives with respect to a seeded species amount are extracted
+    /// from the rows of its phase only, where no other seeded species
+    /// contributes, assuming the chemical potentials of the species in a
+    /// phase do not depend on the amounts of species in other phases.
+    /// @param onlybasicvars If true, only columns of current basic variables are updated.
+    auto updateGradXWithMultipleSeeds(bool onlybasicvars) -> void
+    {
+        const auto numphases = phaseoffsets.size() - 1;
+
+        pendingcols.resize(numphases);
+        for(auto k = 0; k < numphases; ++k)
+        {
+            pendingcols[k].clear();
+            for(auto i = phaseoffsets[k]; i < phaseoffsets[k + 1]; ++i)
+                if(!onlybasicvars || isbasicvar[i])
+                    pendingcols[k].push_back(i);
+        }
+
+        auto phaseOf = [&](Index i) { return std::upper_bound(phaseoffsets.begin(), phaseoffsets.end(), i) - phaseoffsets.begin() - 1; };
+
+        Index start = 0; // the phase from which the next selection of seeded species starts (to avoid always privileging the first phases)
+
+        while(true)
+        {
+            // Select at most one species from each phase, and at most EquilibriumOptions::jacobian_seeds species in total
+            seeded.clear();
+            for(auto j = 0; j < numphases && seeded.size() < options.jacobian_seeds; ++j)
+            {
+                auto& pending = pendingcols[(start + j) % numphases];
+                if(pending.empty()) continue;
+                seeded.push_back(pending.back());
+                pending.pop_back();
+            }
+            start = (start + 1) % numphases;
+
+            if(seeded.empty())
+                break;
+
+            for(auto i : seeded) autodiff::seed(n[i]);
+            props.update(n, p, w, options.use_ideal_activity_models, -1);
+            propsclean = false;
+            updateF();
+            for(auto i : seeded) autodiff::unseed(n[i]);
+
+            gradF = grad(F.head(Nx));
+
+            for(auto i : seeded)
+            {
+                const auto k = phaseOf(i);
+                const auto offset = phaseoffsets[k];
+                const auto size = phaseoffsets[k + 1] - offset;
+                Hxx.col(i).setZero();
+                Hxx.col(i).segment(offset, size) = gradF.segment(offset, size);
+                Vpx.col(i).setZero();
+            }
+        }
     }
 
     auto updateGradP() -> void
@@ -280,6 +709,19 @@ struct EquilibriumSetup::Impl
         Vpc.rightCols(Nc).fill(0.0); // these are derivatives w.r.t. amounts of conservative components
     }
 
+    auto updateGradW(Indices const& iws) -> void
+    {
+        // Update only the columns of Hxc and Vpc corresponding to the selected input variables
+        Hxc.fill(0.0);
+        Vpc.fill(0.0);
+        for(auto i : iws)
+        {
+            updateFw(i);
+            Hxc.col(i) = grad(F.head(Nx));
+            Vpc.col(i) = grad(F.tail(Np));
+        }
+    }
+
     auto updateF() -> void
     {
         auto const& qvars = specs.controlVariablesQ();
@@ -317,8 +759,22 @@ struct EquilibriumSetup::Impl
     {
         const auto useIdealModel = useIdealModelForGradWrtVariableN(i); // in case of little or no dependency of the thermochemical properties on n[i] (i.e., chemical props should have very little dependency in general on tiny species amounts)
         const auto inpw = i; // the index of n[i] in the extended vector (n, p, w)
+        checkPhasesValidity(useIdealModel);
         autodiff::seed(n[i]);
         props.update(n, p, w, useIdealModel, inpw);
+        propsclean = false;
+        updateF();
+        autodiff::unseed(n[i]);
+    }
+
+    auto updateFnInPhase(Index iphase, Index i) -> void
+    {
+        const auto useIdealModel = useIdealModelForGradWrtVariableN(i);
+        const auto inpw = i; // the index of n[i] in the extended vector (n, p, w)
+        checkPhasesValidity(useIdealModel);
+        autodiff::seed(n[i]);
+        props.updatePhase(iphase, n, p, w, useIdealModel, inpw);
+        propsclean = false;
         updateF();
         autodiff::unseed(n[i]);
     }
@@ -327,8 +783,10 @@ struct EquilibriumSetup::Impl
     {
         const auto useIdealModel = useIdealModelForGradWrtVariableQ(i); // in case of little or no dependency of the thermochemical properties on q[i] (i.e., chemical props has no dependency on amounts of implicit titrants such as [H+] when fixing pH)
         const auto inpw = -1; // the index of q[i] in the extended vector (n, p, w) is not defined
+        checkPhasesValidity(useIdealModel);
         autodiff::seed(q[i]);
         props.update(n, p, w, useIdealModel, inpw);
+        propsclean = false;
         updateF();
         autodiff::unseed(q[i]);
     }
@@ -336,10 +794,14 @@ struct EquilibriumSetup::Impl
     auto updateFp(Index i) -> void
     {
         assert(i < Np);
+        if(!propsdependonp[i])
+            return updateFWithUnchangedProps(p[i]);
         const auto useIdealModel = useIdealModelForGradWrtVariableP(i); // in case of little or no dependency of the thermochemical properties on p[i] (e.g., chemical props has no dependency on the amount of a titrant, but it has on temperature and pressure if one of these are unknown p variables)
         const auto inpw = Nn + i; // the index of p[i] in the extended vector (n, p, w)
+        checkPhasesValidity(useIdealModel);
         autodiff::seed(p[i]);
         props.update(n, p, w, useIdealModel, inpw);
+        propsclean = false;
         updateF();
         autodiff::unseed(p[i]);
     }
@@ -347,14 +809,41 @@ struct EquilibriumSetup::Impl
     auto updateFw(Index i) -> void
     {
         assert(i < Nw);
+        if(!propsdependonw[i])
+            return updateFWithUnchangedProps(w[i]);
         const auto useIdealModel = useIdealModelForGradWrtVariableW(i); // in case of little or no dependency of the thermochemical properties on w[i] (e.g., chemical props has no dependency on the designated value of pH, but it has on given values of temperature and pressure)
         const auto inpw = Nn + Np + i; // the index of w[i] in the extended vector (n, p, w)
+        checkPhasesValidity(useIdealModel);
         autodiff::seed(w[i]);
         props.update(n, p, w, useIdealModel, inpw);
+        propsclean = false;
         updateF();
         autodiff::unseed(w[i]);
     }
 
+    /// Update F with respect to a seeded variable in *p* or *w* that does not affect the chemical properties of the system.
+    /// Such variables (e.g., amounts of explicit titrants, the given pH
+    /// value, the given volume of a phase) only enter the equation
+    /// constraints and control variable functions, which are evaluated
+    /// against the current chemical properties without re-evaluating them.
+    /// The chemical properties are refreshed only once if they still carry
+    /// derivatives with respect to a previously seeded variable. The
+    /// derivatives of the chemical properties with respect to such variables
+    /// are zero, so the corresponding columns of the Jacobian assembled in
+    /// @ref EquilibriumProps are left untouched.
+    auto updateFWithUnchangedProps(real& var) -> void
+    {
+        if(!propsclean)
+        {
+            checkPhasesValidity(options.use_ideal_activity_models);
+            props.update(n, p, w, options.use_ideal_activity_models);
+            propsclean = true;
+        }
+        autodiff::seed(var);
+        updateF();
+        autodiff::unseed(var);
+    }
+
     auto updateFx(Index i) -> void
     {
         assert(i < Nx);
@@ -438,6 +927,7 @@ struct EquilibriumSetup::Impl
         case GibbsHessian::Exact:          return false;
         case GibbsHessian::Approx:         return true;
         case GibbsHessian::ApproxDiagonal: return true;
+        case GibbsHessian::QuasiNewton:    return true;
         case GibbsHessian::PartiallyExact: return !isbasicvar[i];
         default:                           return !isbasicvar[i];
         }
@@ -452,19 +942,20 @@ struct EquilibriumSetup::Impl
 
     auto useIdealModelForGradWrtVariableP(Index i) -> bool
     {
-        // TODO: Improve efficiency by using ideal thermodynamic models when
-        // computing derivatives with respect to some variables in p that play
-        // no role in chemical properties of the system. For example, amounts
-        // of explicit titrants.
+        // Note: Variables in p that play no role in the chemical properties of
+        // the system (e.g., amounts of explicit titrants) do not cause their
+        // re-evaluation at all (see updateFWithUnchangedProps). The remaining
+        // ones (temperature and pressure) need the actual thermodynamic models.
         return false;
     }
 
     auto useIdealModelForGradWrtVariableW(Index i) -> bool
     {
-        // TODO: Improve efficiency by using ideal thermodynamic models when
-        // computing derivatives with respect to some variables in w that play
-        // no role in chemical properties of the system. For example, pH input
-        // value.
+        // Note: Variables in w that play no role in the chemical properties of
+        // the system (e.g., pH input value) do not cause their re-evaluation
+        // at all (see updateFWithUnchangedProps). The remaining ones
+        // (temperature, pressure, model parameters) need the actual
+        // thermodynamic models.
         return false;
     }
 };
@@ -475,7 +966,12 @@ EquilibriumSetup::EquilibriumSetup(EquilibriumSpecs const& conditions)
 
 EquilibriumSetup::EquilibriumSetup(EquilibriumSetup const& other)
 : pimpl(new Impl(*other.pimpl))
-{}
+{
+    // The worker threads and their chemical properties for finite differences are not shared with the copy (they are created on first use)
+    pimpl->fdpool.reset();
+    pimpl->fdprops.clear();
+    pimpl->fdn.clear();
+}
 
 EquilibriumSetup::~EquilibriumSetup()
 {}
@@ -488,7 +984,12 @@ auto EquilibriumSetup::operator=(EquilibriumSetup other) -> EquilibriumSetup&
 
 auto EquilibriumSetup::setOptions(EquilibriumOptions const& opts) -> void
 {
+    if(opts.jacobian_threads != pimpl->options.jacobian_threads)
+        pimpl->fdpool.reset();
     pimpl->options = opts;
+    pimpl->props.extrapolateStandardThermoProps(opts.standard_thermo_taylor_band);
+    for(auto& fdprops : pimpl->fdprops)
+        fdprops.extrapolateStandardThermoProps(opts.standard_thermo_taylor_band);
 }
 
 auto EquilibriumSetup::dims() const -> EquilibriumDims const&
@@ -551,6 +1052,11 @@ auto EquilibriumSetup::updateGradW() -> void
     pimpl->updateGradW();
 }
 
+auto EquilibriumSetup::updateGradW(Indices const& iws) -> void
+{
+    pimpl->updateGradW(iws);
+}
+
 auto EquilibriumSetup::getGibbsEnergy() -> real
 {
     return pimpl->getGibbsEnergy();
@@ -606,14 +1112,36 @@ auto EquilibriumSetup::usingDiagonalApproxDerivatives() -> bool
     return pimpl->usingDiagonalApproxDerivatives();
 }
 
+auto EquilibriumSetup::beginCalculation() -> void
+{
+    pimpl->gradxreusable = true;
+    pimpl->gradxreused = false;
+    pimpl->xplast.resize(0);
+    pimpl->steplast = 0.0;
+    pimpl->props.discardStandardThermoProps();
+}
+
+auto EquilibriumSetup::disableDerivativesReuse() -> void
+{
+    pimpl->gradxreusable = false;
+    pimpl->gradxvalid = false;
+}
+
+auto EquilibriumSetup::derivativesReused() const -> bool
+{
+    return pimpl->gradxreused;
+}
+
 auto EquilibriumSetup::assembleChemicalPropsJacobianBegin() -> void
 {
     pimpl->props.assembleFullJacobianBegin();
+    pimpl->assembling_jacobian = true;
 }
 
 auto EquilibriumSetup::assembleChemicalPropsJacobianEnd() -> void
 {
     pimpl->props.assembleFullJacobianEnd();
+    pimpl->assembling_jacobian = false;
 }
 
 auto EquilibriumSetup::equilibriumProps() const -> EquilibriumProps const&
@@ -626,4 +1154,19 @@ auto EquilibriumSetup::chemicalProps() const -> ChemicalProps const&
     return pimpl->props.chemicalProps();
 }
 
+auto EquilibriumSetup::memoryUsage() const -> MemoryUsage
+{
+    auto const& impl = *pimpl;
+    MemoryUsage usage;
+    usage.name = "setup";
+    usage.bytes = sizeof(EquilibriumSetup) + sizeof(Impl);
+    usage.add("matrices", memoryBytes(impl.Aex, impl.Aep, impl.Hxx, impl.Hxp, impl.Hxc, impl.Vpx, impl.Vpp, impl.Vpc, impl.dlnadn, impl.dlnadnideal));
+    usage.add("vectors", memoryBytes(impl.x, impl.n, impl.q, impl.p, impl.w, impl.F, impl.gx, impl.vp, impl.mu, impl.u, impl.isbasicvar, impl.gradF, impl.nlast, impl.plast, impl.wlast, impl.ibasicvarslast, impl.xplast)
+        + memoryBytes(impl.ipps, impl.phaseoffsets, impl.seeded, impl.activephases, impl.pendingcols));
+    usage.add(impl.props.chemicalProps().memoryUsage());
+    for(auto const& fdprops : impl.fdprops)
+        usage.add(fdprops.chemicalProps().memoryUsage());
+    return usage;
+}
+
 } // namespace Reaktoro
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/MemoryUsage.hpp>
 
 namespace Reaktoro {
 
@@ -97,6 +98,11 @@ public:
     /// Update the derivatives of the chemical potentials and residuals of the equilibrium constraints with respect to *w*.
     auto updateGradW() -> void;
 
+    /// Update the derivatives of the chemical potentials and residuals of the equilibrium constraints with respect to selected input variables in *w*.
+    /// The columns of the derivative matrices corresponding to the input variables not selected are set to zero.
+    /// @param iws The indices of the selected input variables in *w*.
+    auto updateGradW(Indices const& iws) -> void;
+
     /// Get the updated Gibbs energy value.
     auto getGibbsEnergy() -> real;
 
@@ -130,6 +136,22 @@ public:
     /// Return true if a diagonal structure is adopted for the Hessian matrix *Hxx*.
     auto usingDiagonalApproxDerivatives() -> bool;
 
+    /// Indicate that a new equilibrium calculation begins.
+    /// This resets the monitoring of the convergence rate used to decide
+    /// whether previously computed derivatives can be reused (see
+    /// EquilibriumOptions::jacobian_reuse), and allows their reuse again if it
+    /// was disabled with @ref disableDerivativesReuse. It also ensures the
+    /// standard thermodynamic properties of the species are computed again,
+    /// since model parameters may have changed since the last calculation
+    /// (see EquilibriumProps::discardStandardThermoProps).
+    auto beginCalculation() -> void;
+
+    /// Disable the reuse of previously computed derivatives until the next call to @ref beginCalculation.
+    auto disableDerivativesReuse() -> void;
+
+    /// Return true if previously computed derivatives were reused since the last call to @ref beginCalculation.
+    auto derivativesReused() const -> bool;
+
     /// Enable recording of derivatives of the chemical properties with respect
     /// to *(n, p, w)* to construct its full Jacobian matrix.
     /// Consider a series of forward automatic differentiation passes to
@@ -153,6 +175,9 @@ public:
     /// Return the current chemical properties of the system as a ChemicalProps object.
     auto chemicalProps() const -> ChemicalProps const&;
 
+    /// Return the approximate memory used by this EquilibriumSetup object, with a breakdown into its matrices, vectors and chemical properties.
+    auto memoryUsage() const -> MemoryUsage;
+
 private:
     struct Impl;
 
@@ -27,6 +27,8 @@
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealAqueous.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealGas.hpp>
 using namespace Reaktoro;
 
 using autodiff::jacobian;
@@ -564,3 +566,273 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
         }
     }
 }
+
+TEST_CASE("Testing block-sparse assembly of the Hessian in EquilibriumSetup", "[EquilibriumSetup]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto Nn = system.species().size();
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    const auto T = 350.0;
+    const auto P = 1.0e+7;
+
+    const ArrayXr n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+    const ArrayXr p = ArrayXr{};
+
+    VectorXr w{{T, P}};
+
+    VectorXl ibasicvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+    EquilibriumOptions options;
+
+    auto computeHessian = [&](GibbsHessian hessian, bool blocksparse) -> MatrixXd
+    {
+        options.hessian = hessian;
+        options.use_block_sparse_hessian = blocksparse;
+
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(n.matrix(), p.matrix(), w);
+        setup.updateGradX(ibasicvars);
+
+        return setup.getGibbsHessianX();
+    };
+
+    WHEN("the Hessian is exact")
+    {
+        const MatrixXd Hdense = computeHessian(GibbsHessian::Exact, false);
+        const MatrixXd Hblock = computeHessian(GibbsHessian::Exact, true);
+        CHECK( Hblock.isApprox(Hdense) );
+    }
+
+    WHEN("the Hessian is partially exact")
+    {
+        const MatrixXd Hdense = computeHessian(GibbsHessian::PartiallyExact, false);
+        const MatrixXd Hblock = computeHessian(GibbsHessian::PartiallyExact, true);
+        CHECK( Hblock.isApprox(Hdense) );
+    }
+}
+
+TEST_CASE("Testing analytic derivatives of activity models in the block-sparse assembly of the Hessian in EquilibriumSetup", "[EquilibriumSetup]")
+{
+    ChemicalSystem base = test::createChemicalSystem();
+
+    // Use ideal activity models with analytic derivatives in the aqueous and gaseous phases
+    PhaseList phases;
+    for(auto phase : base.phases())
+    {
+        const SpeciesList species = phase.species();
+        if(phase.name() == "AqueousPhase")
+        {
+            phase = phase.withActivityModel(ActivityModelIdealAqueous()(species));
+            phase = phase.withActivityModelJacobian(ActivityModelJacobianIdealAqueous()(species));
+            phase = phase.withIdealActivityModelJacobian(ActivityModelJacobianIdealAqueous()(species));
+        }
+        if(phase.name() == "GaseousPhase")
+        {
+            phase = phase.withActivityModel(ActivityModelIdealGas()(species));
+            phase = phase.withActivityModelJacobian(ActivityModelJacobianIdealGas()(species));
+            phase = phase.withIdealActivityModelJacobian(ActivityModelJacobianIdealGas()(species));
+        }
+        phases.append(phase);
+    }
+
+    ChemicalSystem system(base.database(), phases);
+
+    const auto Nn = system.species().size();
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    const ArrayXr n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+    const ArrayXr p = ArrayXr{};
+
+    VectorXr w{{350.0, 1.0e+7}};
+
+    VectorXl ibasicvars = VectorXl::LinSpaced(Nn/2, 0, Nn - 1);
+
+    EquilibriumOptions options;
+
+    auto computeHessian = [&](GibbsHessian hessian, bool blocksparse) -> MatrixXd
+    {
+        options.hessian = hessian;
+        options.use_block_sparse_hessian = blocksparse;
+
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(n.matrix(), p.matrix(), w);
+        setup.updateGradX(ibasicvars);
+
+        return setup.getGibbsHessianX();
+    };
+
+    WHEN("the Hessian is exact")
+    {
+        const MatrixXd Hdense = computeHessian(GibbsHessian::Exact, false);
+        const MatrixXd Hblock = computeHessian(GibbsHessian::Exact, true);
+        CHECK( Hblock.isApprox(Hdense) );
+    }
+
+    WHEN("the Hessian is partially exact")
+    {
+        const MatrixXd Hdense = computeHessian(GibbsHessian::PartiallyExact, false);
+        const MatrixXd Hblock = computeHessian(GibbsHessian::PartiallyExact, true);
+        CHECK( Hblock.isApprox(Hdense) );
+    }
+}
+
+TEST_CASE("Testing multiple seeding in the assembly of the Hessian in EquilibriumSetup", "[EquilibriumSetup]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto Nn = system.species().size();
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    const ArrayXr n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+    const ArrayXr p = ArrayXr{};
+
+    VectorXr w{{350.0, 1.0e+7}};
+
+    VectorXl ibasicvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+    EquilibriumOptions options;
+    options.hessian = GibbsHessian::Exact;
+
+    auto computeHessian = [&](unsigned seeds) -> MatrixXd
+    {
+        options.jacobian_seeds = seeds;
+
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(n.matrix(), p.matrix(), w);
+        setup.updateGradX(ibasicvars);
+
+        return setup.getGibbsHessianX();
+    };
+
+    const MatrixXd H1 = computeHessian(1);
+
+    CHECK( computeHessian(2).isApprox(H1) );
+    CHECK( computeHessian(4).isApprox(H1) );
+    CHECK( computeHessian(8).isApprox(H1) );
+}
+
+TEST_CASE("Testing finite difference assembly of the Hessian in EquilibriumSetup", "[EquilibriumSetup]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto Nn = system.species().size();
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+
+    const ArrayXr n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+    const ArrayXr p = ArrayXr{};
+
+    VectorXr w{{350.0, 1.0e+7}};
+
+    VectorXl ibasicvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+    EquilibriumOptions options;
+    options.hessian = GibbsHessian::Exact;
+
+    auto computeHessian = [&](double step, unsigned threads) -> MatrixXd
+    {
+        options.jacobian_finite_differences = step;
+        options.jacobian_threads = threads;
+
+        EquilibriumSetup setup(specs);
+        setup.setOptions(options);
+        setup.update(n.matrix(), p.matrix(), w);
+        setup.updateGradX(ibasicvars);
+
+        return setup.getGibbsHessianX();
+    };
+
+    const MatrixXd Hexact = computeHessian(0.0, 1);
+
+    const MatrixXd Hfd = computeHessian(1e-7, 1);
+
+    CHECK( Hfd.isApprox(Hexact, 1e-5) );
+
+    // The colors evaluated concurrently produce the same Hessian
+    CHECK( computeHessian(1e-7, 4) == Hfd );
+}
+
+TEST_CASE("Testing derivatives with respect to input variables that do not affect the chemical properties in EquilibriumSetup", "[EquilibriumSetup]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto Nn = system.species().size();
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.volume();
+    specs.pH();
+
+    const auto Nq = 1; // q control variables: the amount of titrant [H+] from pH constraint
+    const auto Nx = Nn + Nq;
+    const auto Nw = 3; // w input variables: T, V, and pH (only T affects the chemical properties)
+
+    const ArrayXr n = ArrayXr::LinSpaced(Nn, 1.0, Nn);
+    const ArrayXr q = ArrayXr{{1.3}};
+    const ArrayXr p = ArrayXr{{1.0e+7}}; // p control variables: P
+    const ArrayXr w = ArrayXr{{350.0, 2.0, 4.0}};
+
+    ArrayXr x(Nx);
+    x << n, q;
+
+    VectorXl ibasicvars = VectorXl::LinSpaced(Nn, 0, Nn - 1);
+
+    EquilibriumOptions options;
+    options.hessian = GibbsHessian::Exact;
+
+    EquilibriumSetup setup(specs);
+    setup.setOptions(options);
+    setup.update(x.matrix(), p.matrix(), w.matrix());
+    setup.updateGradX(ibasicvars); // this leaves derivative information in the chemical properties that must not leak into Hxc and Vpc
+    setup.updateGradW();
+
+    auto gfn = [&](ArrayXrConstRef w)
+    {
+        ChemicalState auxstate(system);
+        auxstate.update(w[0], p[0], n);
+
+        ChemicalProps auxprops = auxstate.props();
+
+        const auto RT = universalGasConstant * w[0];
+
+        VectorXr g(Nx);
+        g.head(Nn) = auxprops.speciesChemicalPotentials()/RT; // the log barrier contribution does not depend on w
+        g[Nn] = specs.controlVariablesQ()[0].fn(auxprops, p, w)/RT;
+
+        return g;
+    };
+
+    auto vfn = [&](ArrayXrConstRef w)
+    {
+        ChemicalState auxstate(system);
+        auxstate.update(w[0], p[0], n);
+
+        VectorXr v = specs.assembleEquationConstraints().fn(auxstate.props(), p, w);
+
+        return v;
+    };
+
+    ArrayXr wr = w;
+
+    const MatrixXd Hxw = jacobian(gfn, wrt(wr), at(wr));
+    const MatrixXd Vpw = jacobian(vfn, wrt(wr), at(wr));
+
+    CHECK( Hxw.isApprox(setup.getGibbsHessianC().leftCols(Nw)) );
+    CHECK( Vpw.isApprox(setup.getConstraintResidualsGradC().leftCols(Nw)) );
+}
@@ -26,21 +26,32 @@
 #include <Optima/State.hpp>
 
 // Reaktoro includes
-#include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AllocationCounter.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
+#include <Reaktoro/Math/LU.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProps.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSetup.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SpeciationSolver.hpp>
 
 namespace Reaktoro {
 
@@ -51,6 +62,24 @@ This can occur due to various factors, such as:
   3. Numerical Instabilities: Convergence issues may arise from numerical problems during the execution of the chemical/kinetic equilibrium algorithm. Consider reporting the issue with a minimal reproducible example if you believe the algorithm is responsible for this issue.
 Disable this warning message with Warnings.disable(906) in Python and Warnings::disable(906) in C++.)";
 
+/// Return the key identifying the structure of given equilibrium specifications (used to save/restore warm start states in ChemicalState objects).
+auto createOptStateKey(EquilibriumSpecs const& specs) -> String
+{
+    return join(specs.namesInputs(), ",") + ";" +
+        join(specs.namesControlVariables(), ",") + ";" +
+        join(specs.namesConstraints(), ",") + ";" +
+        join(specs.namesConservativeComponents(), ",");
+}
+
+/// Return true if there are reactivity restrictions on the amounts of some species.
+auto hasRestrictions(EquilibriumRestrictions const& restrictions) -> bool
+{
+    return !restrictions.speciesCannotIncrease().empty() ||
+        !restrictions.speciesCannotDecrease().empty() ||
+        !restrictions.speciesCannotIncreaseAbove().empty() ||
+        !restrictions.speciesCannotDecreaseBelow().empty();
+}
+
 struct EquilibriumSolver::Impl
 {
     /// The chemical system associated with this equilibrium solver.
@@ -62,6 +91,9 @@ struct EquilibriumSolver::Impl
     /// The dimensions of the variables and constraints in the equilibrium specifications.
     const EquilibriumDims dims;
 
+    /// The key identifying the equilibrium specifications when saving/restoring Optima::State objects in ChemicalState objects for warm start.
+    const String optstatekey;
+
     /// The auxiliary equilibrium conditions used whenever none are given in the solve methods.
     const EquilibriumConditions xconditions;
 
@@ -83,29 +115,91 @@ struct EquilibriumSolver::Impl
     /// The optimization problem to be configured for a chemical equilibrium calculation.
     Optima::Problem optproblem;
 
+    /// The Impl object that initialized #optproblem, whose functions capture a pointer to it (copies of Impl must reinitialize #optproblem).
+    Impl const* optproblem_owner = nullptr;
+
+    /// The values of the input variables *w* in the current equilibrium calculation.
+    VectorXr w;
+
+    /// The indices of the input variables in *w* for which sensitivity derivatives are computed.
+    Indices optws;
+
+    /// The indices of the inputs in c' = (w, c) for which sensitivity derivatives are computed (the *c* variables in #optproblem).
+    Indices optcols;
+
     /// The optimization state of the calculation.
     Optima::State optstate;
 
+    /// The flag indicating if the optimization state of the current calculation was initialized with a clean slate (i.e., a cold start).
+    bool coldstart = false;
+
     /// The optimization sensitivity of the calculation.
     Optima::Sensitivity optsensitivity;
 
     /// The solver for the optimization calculations.
     Optima::Solver optsolver;
 
+    /// The convergence tolerance set in #optsolver for the current calculation, or zero if that in EquilibriumOptions::optima (see EquilibriumConditions::setTolerance).
+    double opttolerance = 0.0;
+
     /// The result of the equilibrium calculation
     EquilibriumResult result;
 
-    /// The array stream used to clean up autodiff seed values from the last ChemicalProps update step.
-    ArrayStream<double> stream;
+    /// The timing information accumulated during the current equilibrium calculation (updated by the functions in #optproblem).
+    EquilibriumTiming timing;
+
+    /// The array used to clean up autodiff seed values from the last ChemicalProps update step.
+    ArrayXd propsdata;
+
+    /// The solver for speciation calculations using the mass-action law (see EquilibriumOptions::use_mass_action_speciation).
+    SpeciationSolver speciation;
+
+    /// The flag indicating if the equilibrium specifications allow the use of #speciation.
+    const bool speciation_applicable;
+
+    /// The pool of worker threads used in batched equilibrium calculations (created on demand and shared among copies of this solver).
+    SharedPtr<ThreadPool> pool;
+
+    /// The copies of this solver used by each worker thread in batched equilibrium calculations (created on demand, each in the thread of its worker).
+    Vec<SharedPtr<Impl>> workers;
 
     /// Construct a Impl instance with given EquilibriumConditions object.
     Impl(EquilibriumSpecs const& specs)
-    : system(specs.system()), specs(specs), dims(specs), xconditions(specs), xrestrictions(system), setup(specs)
+    : system(specs.system()), specs(specs), dims(specs), optstatekey(createOptStateKey(specs)), xconditions(specs), xrestrictions(system), setup(specs),
+      speciation(specs), speciation_applicable(SpeciationSolver::applicable(specs))
     {
+        // Initially, sensitivity derivatives are computed with respect to all inputs in c' = (w, c)
+        optws = range(dims.Nw);
+        optcols = range(dims.Nw + dims.Nc);
+
         // Initialize the equilibrium solver with the default options
         setOptions(options);
     }
 
+    /// Return the approximate memory used by this solver and its workers.
+    auto memoryUsage() const -> MemoryUsage
+    {
+        MemoryUsage usage;
+        usage.name = "EquilibriumSolver";
+        usage.bytes = sizeof(Impl) + memoryBytes(optstatekey, xc0, w, optws, optcols, propsdata);
+        usage.add(setup.memoryUsage());
+        usage.add("optima problem", memoryBytes(optproblem.Aex, optproblem.Aep, optproblem.be, optproblem.bec, optproblem.c, optproblem.xlower, optproblem.xupper, optproblem.plower, optproblem.pupper));
+        usage.add("optima state", memoryBytes(optstate));
+        usage.add("optima sensitivity", memoryBytes(optsensitivity.xc, optsensitivity.pc));
+
+        MemoryUsage workersusage;
+        workersusage.name = "workers";
+        for(auto i = 0; i < workers.size(); ++i)
+        {
+            auto workerusage = workers[i]->memoryUsage();
+            workerusage.name = "worker " + std::to_string(i);
+            workersusage.add(workerusage);
+        }
+        usage.add(workersusage);
+
+        return usage;
+    }
+
     /// Set the options of the equilibrium solver.
     auto setOptions(EquilibriumOptions const& opts) -> void
     {
@@ -115,6 +209,9 @@ struct EquilibriumSolver::Impl
         // Pass along the options used for the calculation to EquilibriumSetup object
         setup.setOptions(options);
 
+        // Pass along the options used for the calculation to SpeciationSolver object
+        speciation.setOptions(options);
+
         // Ensure some options have proper values
         error(options.epsilon <= 0, "EquilibriumOptions::epsilon cannot be zero or negative.");
 
@@ -145,28 +242,48 @@ struct EquilibriumSolver::Impl
 
         // Pass along the options used for the calculation to Optima::Solver object
         optsolver.setOptions(options.optima);
+        opttolerance = 0.0;
+
+        // Ensure the worker solvers used in batched calculations are recreated with the new options
+        workers.clear();
+        if(pool && options.threads != 0 && pool->numThreads() != options.threads)
+            pool.reset();
     }
 
-    /// Update the optimization problem before a new equilibrium calculation.
-    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    /// Initialize the optimization problem whose dimensions and functions are fixed for this solver.
+    /// The functions r, f and v reference `this` object, which is why a copy of this object must
+    /// initialize its own optimization problem (see #optproblem_owner).
+    auto initOptProblem() -> void
     {
-        // The input variables for the equilibrium calculation
-        const VectorXr w = conditions.inputValuesGetOrCompute(state0);
-
         // Create the Optima::Dims object with dimension info of the optimization problem
         optdims = Optima::Dims();
         optdims.x  = dims.Nx;
         optdims.p  = dims.Np;
         optdims.be = dims.Nc;
-        optdims.c  = dims.Nw + dims.Nc; // c' = (w, c) where w are the input variables and c are the amounts of components
+        optdims.c  = optcols.size(); // the selected entries in c' = (w, c) where w are the input variables and c are the amounts of components (all by default)
 
-        // Recreate a new Optima::Problem problem (TODO: Avoid recreation of Optima::Problem object for each equilibrium calculation)
+        // Create the Optima::Problem object once; subsequent calculations only refresh be, bounds and w
         optproblem = Optima::Problem(optdims);
 
         // Set the resources function in the Optima::Problem object
-        optproblem.r = [=](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts) mutable
+        optproblem.r = [this](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts)
         {
+            REAKTORO_PROFILE("EquilibriumSolver::resources");
+
+            tic(PROPERTIES_STEP)
             setup.update(x, p, w);
+            timing.properties += toc(PROPERTIES_STEP);
+            timing.evaluations += 1;
+
+            const auto needsjacobian =
+                fopts.eval.fxx || vopts.eval.ddx ||
+                fopts.eval.fxp || vopts.eval.ddp ||
+                fopts.eval.fxc || vopts.eval.ddc;
+
+            if(!needsjacobian)
+                return;
+
+            tic(JACOBIAN_STEP)
 
             if(fopts.eval.fxc || vopts.eval.ddc)
                 setup.assembleChemicalPropsJacobianBegin();
@@ -176,14 +293,21 @@ struct EquilibriumSolver::Impl
             if(fopts.eval.fxp || vopts.eval.ddp)
                 setup.updateGradP();
             if(fopts.eval.fxc || vopts.eval.ddc)
-                setup.updateGradW();
+            {
+                if(optws.size() == dims.Nw)
+                    setup.updateGradW();
+                else setup.updateGradW(optws);
+            }
 
             if(fopts.eval.fxc || vopts.eval.ddc)
                 setup.assembleChemicalPropsJacobianEnd();
+
+            timing.jacobian += toc(JACOBIAN_STEP);
+            timing.jacobian_evaluations += 1;
         };
 
         // Set the objective function in the Optima::Problem object
-        optproblem.f = [=](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts) mutable
+        optproblem.f = [this](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts)
         {
             res.f = setup.getGibbsEnergy();
             res.fx = setup.getGibbsGradX();
@@ -195,7 +319,11 @@ struct EquilibriumSolver::Impl
                 res.fxp = setup.getGibbsHessianP();
 
             if(opts.eval.fxc)
-                res.fxc = setup.getGibbsHessianC();
+            {
+                if(optcols.size() == dims.Nw + dims.Nc)
+                    res.fxc = setup.getGibbsHessianC();
+                else res.fxc = setup.getGibbsHessianC()(Eigen::all, optcols);
+            }
 
             res.fxx4basicvars = setup.usingPartiallyExactDerivatives();
             res.diagfxx = setup.usingDiagonalApproxDerivatives();
@@ -204,7 +332,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the external constraint function in the Optima::Problem object
-        optproblem.v = [=](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts) mutable
+        optproblem.v = [this](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts)
         {
             res.val = setup.getConstraintResiduals();
 
@@ -215,7 +343,11 @@ struct EquilibriumSolver::Impl
                 res.ddp = setup.getConstraintResidualsGradP();
 
             if(opts.eval.ddc)
-                res.ddc = setup.getConstraintResidualsGradC();
+            {
+                if(optcols.size() == dims.Nw + dims.Nc)
+                    res.ddc = setup.getConstraintResidualsGradC();
+                else res.ddc = setup.getConstraintResidualsGradC()(Eigen::all, optcols);
+            }
 
             res.succeeded = true;
         };
@@ -224,6 +356,30 @@ struct EquilibriumSolver::Impl
         optproblem.Aex = setup.Aex();
         optproblem.Aep = setup.Aep();
 
+        // Set the values of the input variables for sensitivity derivatives (due to the use of Param, a wrapper to a shared pointer, the actual values of c here are not important, because the Param objects are embedded in the models)
+        optproblem.c = zeros(optdims.c);
+
+        // Set the Jacobian matrix d(be)/dc = [d(be)/dw d(be)/db]
+        // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
+        // Only the columns of the selected inputs in c' = (w, c) are considered.
+        optproblem.bec.setZero();
+        for(auto j = 0; j < optcols.size(); ++j)
+            if(optcols[j] >= dims.Nw)
+                optproblem.bec(optcols[j] - dims.Nw, j) = 1.0;
+
+        optproblem_owner = this;
+    }
+
+    /// Update the optimization problem before a new equilibrium calculation.
+    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    {
+        // The input variables for the equilibrium calculation (referenced by the functions in optproblem)
+        w = conditions.inputValuesGetOrCompute(state0);
+
+        // Initialize the optimization problem only once (or when this object is a copy of the one that initialized it)
+        if(optproblem_owner != this)
+            initOptProblem();
+
         /// Set the right-hand side vector be of the linear equality constraints.
         optproblem.be = conditions.initialComponentAmountsGetOrCompute(state0);
 
@@ -234,24 +390,17 @@ struct EquilibriumSolver::Impl
         // Set the lower and upper bounds of the *p* control variables
         optproblem.plower = conditions.lowerBoundsControlVariablesP();
         optproblem.pupper = conditions.upperBoundsControlVariablesP();
-
-        // Set the values of the input variables for sensitivity derivatives (due to the use of Param, a wrapper to a shared pointer, the actual values of c here are not important, because the Param objects are embedded in the models)
-        optproblem.c = zeros(optdims.c);
-
-        // Set the Jacobian matrix d(be)/dc = [d(be)/dw d(be)/db]
-        // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
-        optproblem.bec.setZero();
-        optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
     }
 
     /// Update the initial state variables before the new equilibrium calculation.
     auto updateOptState(ChemicalState const& state0)
     {
-        // Initialize optstate with that stored in state0 (note state0 may have empty Optima::State object!)
-        optstate = state0.equilibrium().optimaState();
+        // Initialize optstate with that saved in state0 for these equilibrium specifications, or else the last one computed (note state0 may have empty Optima::State object!)
+        optstate = state0.equilibrium().optimaState(optstatekey);
 
         // In case optstate corresponds to an equilibrium problem of different structure, initialize it with a clean slate
-        if(optstate.dims.x != dims.Nx || optstate.dims.p != dims.Np || optstate.dims.be != dims.Nc || optstate.dims.c != dims.Nw + dims.Nc)  // TODO: Replace this by a code that represents the EquilibriumSpecs object used for the previous calculation. Consider a dictionary of saved optstates and corresponding EquilibriumSpecs objects in case the same ChemicalState object is used within different solvers.
+        coldstart = optstate.dims.x != dims.Nx || optstate.dims.p != dims.Np || optstate.dims.be != dims.Nc || optstate.dims.c != optdims.c;
+        if(coldstart)
             optstate = Optima::State(optdims);
 
         // Overwrite n in x = (n, q) with species amounts from the chemical state
@@ -280,6 +429,8 @@ struct EquilibriumSolver::Impl
         // Update the ChemicalProps object in state
         auto& props = state.props();
         props = setup.chemicalProps();
+        props.reuseStandardThermoProps(false); // the model parameters may change before its next update by the user
+        props.extrapolateStandardThermoProps(0.0); // the extrapolated properties are approximations, not to be kept in the user's chemical state
 
         // TODO: In Optima, make sure check for convergence does not compute
         // any derivatives. Use F.updateSkipJacobian(u) instead of F.update(u)
@@ -291,9 +442,9 @@ struct EquilibriumSolver::Impl
 
         // Make sure the derivative information in the underlying chemical
         // properties of the system are zeroed out!
-        ArrayStream<double> stream;
-        props.serialize(stream);
-        props.deserialize(stream);
+        propsdata.resize(props.serializationSize());
+        props.serialize(propsdata);
+        props.update(propsdata);
 
         // Update other state variables in the ChemicalState object
         state.setTemperature(props.temperature());
@@ -304,12 +455,37 @@ struct EquilibriumSolver::Impl
         state.equilibrium().setNamesControlVariablesQ(specs.namesControlVariablesQ());
         state.equilibrium().setInputVariables(conditions.inputValues());
         state.equilibrium().setInitialComponentAmounts(optproblem.be);
-        state.equilibrium().setOptimaState(optstate);
+        state.equilibrium().setOptimaState(optstatekey, optstate);
     }
 
     /// Update the equilibrium sensitivity object with computed optimization sensitivity.
+    /// Select the inputs in c' = (w, c) for which sensitivity derivatives are computed (the optimization problem is reinitialized if the selection changes).
+    auto selectSensitivityInputs(EquilibriumSensitivity const& sensitivity) -> void
+    {
+        Indices iws = range(dims.Nw);
+        Indices cols = range(dims.Nw + dims.Nc);
+
+        if(sensitivity.selective())
+        {
+            iws = sensitivity.indicesSelectedInputs();
+            cols = iws;
+            for(auto i : sensitivity.indicesSelectedComponents())
+                cols.push_back(dims.Nw + i);
+        }
+
+        if(cols == optcols)
+            return;
+
+        optws = iws;
+        optcols = cols;
+        optproblem_owner = nullptr; // force the reinitialization of optproblem with the new number of c variables
+    }
+
     auto updateEquilibriumSensitivity(EquilibriumSensitivity& sensitivity)
     {
+        if(sensitivity.selective())
+            return updateEquilibriumSensitivitySelective(sensitivity);
+
         auto const& Nn = dims.Nn;
         auto const& Nc = dims.Nc;
         auto const& Nq = dims.Nq;
@@ -340,6 +516,70 @@ struct EquilibriumSolver::Impl
         sensitivity.dudc(dudn*dndc + dudp*dpdc);
     }
 
+    /// Update the equilibrium sensitivity object with derivatives only with respect to its selected inputs.
+    auto updateEquilibriumSensitivitySelective(EquilibriumSensitivity& sensitivity) -> void
+    {
+        auto const& Nn = dims.Nn;
+        auto const& Nc = dims.Nc;
+        auto const& Np = dims.Np;
+        auto const& Nq = dims.Nq;
+        auto const& Nw = dims.Nw;
+        auto const& xc = optsensitivity.xc;
+        auto const& pc = optsensitivity.pc;
+
+        errorif(sensitivity.dndw().cols() != Nw || sensitivity.dndc().cols() != Nc, "The EquilibriumSensitivity object with selected inputs was not initialized with the same equilibrium specifications used in the EquilibriumSolver object.");
+
+        auto const& iws = sensitivity.indicesSelectedInputs();
+        auto const& ics = sensitivity.indicesSelectedComponents();
+
+        const auto Nsw = iws.size();
+        const auto Nsc = ics.size();
+
+        auto const& props = setup.equilibriumProps();
+
+        const auto dudn = props.dudn();
+        const auto dudp = props.dudp();
+        const auto dudw = props.dudw();
+
+        MatrixXd dndw = zeros(Nn, Nw);
+        MatrixXd dqdw = zeros(Nq, Nw);
+        MatrixXd dpdw = zeros(Np, Nw);
+        MatrixXd dndc = zeros(Nn, Nc);
+        MatrixXd dqdc = zeros(Nq, Nc);
+        MatrixXd dpdc = zeros(Np, Nc);
+
+        dndw(Eigen::all, iws) = xc.topLeftCorner(Nn, Nsw);
+        dqdw(Eigen::all, iws) = xc.bottomLeftCorner(Nq, Nsw);
+        dpdw(Eigen::all, iws) = pc.leftCols(Nsw);
+        dndc(Eigen::all, ics) = xc.topRightCorner(Nn, Nsc);
+        dqdc(Eigen::all, ics) = xc.bottomRightCorner(Nq, Nsc);
+        dpdc(Eigen::all, ics) = pc.rightCols(Nsc);
+
+        // Compute the total derivatives of the chemical properties only for the selected columns
+        MatrixXd dudwt = zeros(dudn.rows(), Nw);
+        MatrixXd dudct = zeros(dudn.rows(), Nc);
+
+        dudwt(Eigen::all, iws) = dudw(Eigen::all, iws) + dudn*xc.topLeftCorner(Nn, Nsw) + dudp*pc.leftCols(Nsw);
+        dudct(Eigen::all, ics) = dudn*xc.topRightCorner(Nn, Nsc) + dudp*pc.rightCols(Nsc);
+
+        sensitivity.dndw(dndw);
+        sensitivity.dqdw(dqdw);
+        sensitivity.dpdw(dpdw);
+        sensitivity.dndc(dndc);
+        sensitivity.dqdc(dqdc);
+        sensitivity.dpdc(dpdc);
+        sensitivity.dudw(dudwt);
+        sensitivity.dudc(dudct);
+    }
+
+    /// Update the timing information in the result of the equilibrium calculation.
+    auto updateTiming(EquilibriumResult& res, double elapsed) -> void
+    {
+        res.timing = timing;
+        res.timing.solve = elapsed;
+        res.timing.optimizer = std::max(elapsed - timing.properties - timing.jacobian, 0.0);
+    }
+
     auto solve(ChemicalState& state) -> EquilibriumResult
     {
         return solve(state, xconditions, xrestrictions);
@@ -357,12 +597,270 @@ struct EquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
     {
+        if(!options.quiet)
+            return solveUnguarded(state, conditions, restrictions);
+
+        try
+        {
+            return solveUnguarded(state, conditions, restrictions);
+        }
+        catch(std::exception const&)
+        {
+            result = {};
+            result.error = true; // report the error only through the result (see EquilibriumOptions::quiet)
+            return result;
+        }
+    }
+
+    /// Solve the optimization problem, stopping once the time or iteration budget of the calculation is exhausted (see EquilibriumOptions::time_budget).
+    /// @param start The time point at which the calculation started
+    auto solveOptProblemWithinBudget(Time const& start) -> Optima::Result
+    {
+        const auto timed = options.time_budget > 0.0;
+        const auto limited = options.iteration_budget > 0;
+
+        result.budget_exhausted = false;
+
+        if(!timed && !limited)
+            return optsolver.solve(optproblem, optstate);
+
+        const Index maxiters = limited ? std::min<Index>(options.iteration_budget, options.optima.maxiters) : options.optima.maxiters;
+        const Index interval = timed ? std::max<Index>(options.time_budget_interval, 1) : maxiters;
+
+        // Perform the iterations in chunks, each one resuming from the iterate in optstate where the previous one stopped
+        auto chunkopts = optimaOptions();
+        Optima::Result res;
+        Index iterations = 0;
+
+        while(true)
+        {
+            chunkopts.maxiters = std::min(interval, maxiters - iterations);
+            optsolver.setOptions(chunkopts);
+            res = optsolver.solve(optproblem, optstate);
+            iterations += res.iterations;
+
+            if(res.succeeded || res.iterations < chunkopts.maxiters) // converged or failed before the end of the chunk
+                break;
+
+            const auto timeout = timed && elapsed(start) >= options.time_budget;
+            const auto exhausted = limited && iterations >= options.iteration_budget;
+
+            if(timeout || exhausted)
+            {
+                result.budget_exhausted = true;
+                break;
+            }
+
+            if(iterations >= maxiters)
+                break;
+        }
+
+        optsolver.setOptions(optimaOptions());
+
+        res.iterations = iterations;
+
+        return res;
+    }
+
+    /// Return the options of the optimization solver with the convergence tolerance of the current calculation.
+    auto optimaOptions() const -> Optima::Options
+    {
+        auto opts = options.optima;
+        if(opttolerance > 0.0)
+            opts.convergence.tolerance = opttolerance;
+        return opts;
+    }
+
+    /// Set the convergence tolerance of the optimization solver for the current calculation (zero for that in EquilibriumOptions::optima, see EquilibriumConditions::setTolerance).
+    auto applyTolerance(double tolerance) -> void
+    {
+        if(tolerance == opttolerance)
+            return;
+        opttolerance = tolerance;
+        optsolver.setOptions(optimaOptions());
+    }
+
+    /// Return the largest residual of the conservation of the components at the computed state, relative to the largest amount of a component.
+    auto massBalanceResidual() const -> double
+    {
+        if(optproblem.be.size() == 0)
+            return 0.0;
+        const VectorXd r = optproblem.Aex * optstate.x + optproblem.Aep * optstate.p - optproblem.be;
+        const auto scale = optproblem.be.cwiseAbs().maxCoeff();
+        return r.cwiseAbs().maxCoeff() / (scale > 0.0 ? scale : 1.0);
+    }
+
+    /// Set the convergence tolerance used and the mass balance residual achieved in the result of the current calculation.
+    auto updateAccuracy(EquilibriumResult& res) const -> void
+    {
+        res.tolerance = optimaOptions().convergence.tolerance;
+        res.residual = massBalanceResidual();
+    }
+
+    /// Converge the current calculation with ideal activity models, so that it continues from there with the full ones (see EquilibriumOptions::ideal_presolve).
+    auto presolveWithIdealModels(ChemicalState const& state) -> void
+    {
+        auto idealoptions = options;
+        idealoptions.optima = optimaOptions();
+        idealoptions.use_ideal_activity_models = true;
+        if(options.ideal_presolve_tolerance > 0.0)
+            idealoptions.optima.convergence.tolerance = options.ideal_presolve_tolerance;
+
+        setup.setOptions(idealoptions);
+        optsolver.setOptions(idealoptions.optima);
+
+        setup.beginCalculation();
+
+        const auto res = optsolver.solve(optproblem, optstate);
+
+        setup.setOptions(options);
+        optsolver.setOptions(optimaOptions());
+
+        // Start the full calculation from the original initial guess if the one with ideal activity models failed
+        if(!res.succeeded)
+            updateOptState(state);
+    }
+
+    auto solveUnguarded(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    {
+        REAKTORO_PROFILE("EquilibriumSolver::solve");
+
+        tic(SOLVE_STEP)
+
+        timing = {};
+
+        AllocationCounter allocations;
+
+        if(options.use_mass_action_speciation && speciation_applicable && !hasRestrictions(restrictions))
+        {
+            const ArrayXr wvals = conditions.inputValuesGetOrCompute(state);
+            const ArrayXd c0 = conditions.initialComponentAmountsGetOrCompute(state);
+
+            result = speciation.solve(state, wvals[0], wvals[1], c0); // the inputs are T and P (see SpeciationSolver::applicable)
+
+            if(result.succeeded())
+            {
+                state.equilibrium().setNamesInputVariables(specs.namesInputs());
+                state.equilibrium().setNamesControlVariablesP(specs.namesControlVariablesP());
+                state.equilibrium().setNamesControlVariablesQ(specs.namesControlVariablesQ());
+                state.equilibrium().setInputVariables(wvals.cast<double>());
+                state.equilibrium().setInitialComponentAmounts(c0);
+                result.allocations = allocations.stats();
+                return result;
+            }
+        }
+
+        const auto start = time();
+
+        applyTolerance(conditions.tolerance());
         updateOptProblem(state, conditions, restrictions);
         updateOptState(state);
 
+        if(options.ideal_presolve && coldstart && !options.use_ideal_activity_models)
+            presolveWithIdealModels(state);
+
+        const auto recording = !options.record_file.empty();
+        const auto record = recording ? captureRecord() : EquilibriumRecord{};
+
+        setup.beginCalculation();
+
+        result.optima = solveOptProblemWithinBudget(start);
+
+        // Repeat a failed calculation that reused previously computed derivatives, this time computing them at every iteration
+        if(!result.optima.succeeded && !result.budget_exhausted && setup.derivativesReused())
+        {
+            setup.disableDerivativesReuse();
+            updateOptState(state);
+            result.optima = solveOptProblemWithinBudget(start);
+        }
+
+        updateTiming(result, toc(SOLVE_STEP));
+        updateAccuracy(result);
+
+        warningif(!result.optima.succeeded && !result.budget_exhausted && !options.quiet && Warnings::isEnabled(906), EQUILIBRIUM_FAILURE_MESSAGE);
+
+        if(recording)
+            recordIfSlow(record, elapsed(start));
+
+        updateChemicalState(state, conditions);
+
+        result.allocations = allocations.stats();
+
+        return result;
+    }
+
+    /// Return the inputs of the optimization problem and the initial guess of the current calculation (see EquilibriumRecord).
+    auto captureRecord() const -> EquilibriumRecord
+    {
+        EquilibriumRecord record;
+        record.w = w.cast<double>();
+        record.c0 = optproblem.be;
+        record.xlower = optproblem.xlower;
+        record.xupper = optproblem.xupper;
+        record.plower = optproblem.plower;
+        record.pupper = optproblem.pupper;
+        record.x = optstate.x;
+        record.p = optstate.p;
+        record.ye = optstate.ye;
+        record.s = optstate.s;
+        return record;
+    }
+
+    /// Append the record of the last calculation to the file in EquilibriumOptions::record_file if its time or number of iterations exceed the given thresholds.
+    auto recordIfSlow(EquilibriumRecord record, double elapsed) -> void
+    {
+        const auto bytime = options.record_min_time > 0.0 && elapsed >= options.record_min_time;
+        const auto byiterations = options.record_min_iterations > 0 && result.iterations() >= options.record_min_iterations;
+        const auto all = options.record_min_time <= 0.0 && options.record_min_iterations == 0;
+
+        if(!bytime && !byiterations && !all)
+            return;
+
+        record.elapsed = elapsed;
+        record.iterations = result.iterations();
+        appendEquilibriumRecord(options.record_file, record);
+    }
+
+    auto replay(ChemicalState& state, EquilibriumRecord const& record) -> EquilibriumResult
+    {
+        REAKTORO_PROFILE("EquilibriumSolver::replay");
+
+        errorif(record.w.size() != dims.Nw || record.c0.size() != dims.Nc || record.x.size() != dims.Nx || record.p.size() != dims.Np,
+            "Could not replay the recorded equilibrium calculation because it was performed with different equilibrium specifications.");
+
+        tic(SOLVE_STEP)
+
+        timing = {};
+        result = {};
+
+        w = record.w.cast<real>();
+
+        // Initialize the optimization problem only once (or when this object is a copy of the one that initialized it)
+        if(optproblem_owner != this)
+            initOptProblem();
+
+        optproblem.be = record.c0;
+        optproblem.xlower = record.xlower;
+        optproblem.xupper = record.xupper;
+        optproblem.plower = record.plower;
+        optproblem.pupper = record.pupper;
+
+        optstate = Optima::State(optdims);
+        optstate.x = record.x;
+        optstate.p = record.p;
+        if(record.ye.size() == optstate.ye.size()) optstate.ye = record.ye;
+        if(record.s.size() == optstate.s.size()) optstate.s = record.s;
+
+        setup.beginCalculation();
+
+        applyTolerance(0.0); // the recorded calculation used the tolerance in the options
         result.optima = optsolver.solve(optproblem, optstate);
 
-        warningif(!result.optima.succeeded && Warnings::isEnabled(906), EQUILIBRIUM_FAILURE_MESSAGE);
+        updateTiming(result, toc(SOLVE_STEP));
+        updateAccuracy(result);
+
+        EquilibriumConditions conditions(specs);
+        conditions.setInputVariables(w.array());
 
         updateChemicalState(state, conditions);
 
@@ -386,18 +884,285 @@ struct EquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
     {
+        REAKTORO_PROFILE("EquilibriumSolver::solve");
+
         EquilibriumResult result;
 
+        tic(SOLVE_STEP)
+
+        timing = {};
+
+        selectSensitivityInputs(sensitivity);
+        applyTolerance(conditions.tolerance());
         updateOptProblem(state, conditions, restrictions);
         updateOptState(state);
 
+        setup.beginCalculation();
+
         result.optima = optsolver.solve(optproblem, optstate, optsensitivity);
 
+        // Repeat a failed calculation that reused previously computed derivatives, this time computing them at every iteration
+        if(!result.optima.succeeded && setup.derivativesReused())
+        {
+            setup.disableDerivativesReuse();
+            updateOptState(state);
+            result.optima = optsolver.solve(optproblem, optstate, optsensitivity);
+        }
+
+        updateTiming(result, toc(SOLVE_STEP));
+        updateAccuracy(result);
+
         updateChemicalState(state, conditions);
         updateEquilibriumSensitivity(sensitivity);
 
         return result;
     }
+
+    auto adjoint(ChemicalState const& state, VectorXdConstRef dfdn, VectorXdConstRef dfdp, VectorXdRef dfdw, VectorXdRef dfdc) -> void
+    {
+        const auto Nn = dims.Nn;
+        const auto Nx = dims.Nx;
+        const auto Np = dims.Np;
+        const auto Nw = dims.Nw;
+        const auto Nc = dims.Nc;
+
+        errorif(dfdn.size() != Nn, "Expecting ", Nn, " derivatives of the objective function with respect to the species amounts, but got ", dfdn.size(), ".");
+        errorif(dfdp.size() != Np, "Expecting ", Np, " derivatives of the objective function with respect to the p control variables, but got ", dfdp.size(), ".");
+        errorif(dfdw.size() != Nw, "Expecting an array with ", Nw, " entries for the derivatives of the objective function with respect to the input variables, but got one with ", dfdw.size(), " entries.");
+        errorif(dfdc.size() != Nc, "Expecting an array with ", Nc, " entries for the derivatives of the objective function with respect to the amounts of conservative components, but got one with ", dfdc.size(), " entries.");
+
+        auto const& stateopt = state.equilibrium().optimaState(optstatekey);
+
+        errorif(stateopt.x.size() != Nx || stateopt.p.size() != Np, "Cannot compute adjoint sensitivity derivatives for a chemical state that was not computed with an EquilibriumSolver object with the same equilibrium specifications.");
+        errorif(optproblem_owner != this, "Cannot compute adjoint sensitivity derivatives before an equilibrium calculation with this EquilibriumSolver object.");
+
+        const VectorXd x = stateopt.x;
+        const VectorXd p = stateopt.p;
+
+        w = state.equilibrium().inputVariables().matrix().cast<real>();
+
+        // Evaluate the exact derivatives at the equilibrium state (all variables in x are considered basic, and no derivatives are reused)
+        auto exactoptions = options;
+        exactoptions.hessian = GibbsHessian::Exact;
+        exactoptions.jacobian_reuse = 0;
+        exactoptions.jacobian_finite_differences = 0.0;
+
+        setup.setOptions(exactoptions);
+        setup.beginCalculation();
+        setup.update(x, p, w);
+        setup.updateGradX(VectorXl::LinSpaced(Nx, 0, Nx - 1));
+        setup.updateGradP();
+        setup.updateGradW();
+        setup.setOptions(options);
+
+        // The variables in x that are not at their bounds (those at their bounds do not change with the inputs)
+        Indices js;
+        for(Index i = 0; i < Nx; ++i)
+            if(x[i] > optproblem.xlower[i] && x[i] < optproblem.xupper[i])
+                js.push_back(i);
+
+        const auto Ns = js.size();
+
+        const auto Hxx = setup.getGibbsHessianX();
+        const auto Hxp = setup.getGibbsHessianP();
+        const auto Hxc = setup.getGibbsHessianC();
+        const auto Vpx = setup.getConstraintResidualsGradX();
+        const auto Vpp = setup.getConstraintResidualsGradP();
+        const auto Vpc = setup.getConstraintResidualsGradC();
+        const auto Aex = setup.Aex();
+        const auto Aep = setup.Aep();
+
+        // Assemble the Jacobian of the optimality conditions with respect to the stable variables in x, the p variables, and the Lagrange multipliers y:
+        //   [Hss  Hsp  Aes']
+        //   [Vps  Vpp  0   ]
+        //   [Aes  Aep  0   ]
+        MatrixXd J = zeros(Ns + Np + Nc, Ns + Np + Nc);
+        J.topLeftCorner(Ns, Ns) = Hxx(js, js);
+        J.block(0, Ns, Ns, Np) = Hxp(js, Eigen::all);
+        J.block(0, Ns + Np, Ns, Nc) = Aex(Eigen::all, js).transpose();
+        J.block(Ns, 0, Np, Ns) = Vpx(Eigen::all, js);
+        J.block(Ns, Ns, Np, Np) = Vpp;
+        J.block(Ns + Np, 0, Nc, Ns) = Aex(Eigen::all, js);
+        J.block(Ns + Np, Ns, Nc, Np) = Aep;
+
+        // Assemble the derivatives of the objective function with respect to the stable variables in x (zero for the q variables) and the p variables
+        VectorXd g = zeros(Ns + Np);
+        for(Index k = 0; k < Ns; ++k)
+            if(js[k] < Nn)
+                g[k] = dfdn[js[k]];
+        g.tail(Np) = dfdp;
+
+        VectorXd rhs = zeros(Ns + Np + Nc);
+        rhs.head(Ns + Np) = g;
+
+        // Solve the transposed system for the adjoint variables (lambdax, lambdap, lambday)
+        LU lu(J);
+        const VectorXd lambda = lu.trsolve(rhs);
+
+        const auto lambdax = lambda.head(Ns);
+        const auto lambdap = lambda.segment(Ns, Np);
+        const auto lambday = lambda.tail(Nc);
+
+        // Contract the adjoint variables with the derivatives of the optimality conditions with respect to the inputs
+        dfdw = -(Hxc(js, Eigen::seqN(0, Nw)).transpose() * lambdax + Vpc.leftCols(Nw).transpose() * lambdap);
+        dfdc = lambday; // the derivatives of the linear equality constraints with respect to c are -I
+    }
+
+    /// Ensure the pool of worker threads and the worker solvers exist for a batched equilibrium calculation.
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(options.threads);
+
+        const auto numworkers = pool->numThreads();
+
+        if(workers.size() == numworkers)
+            return;
+
+        workers.clear();
+
+        // Copy this solver in the thread of each worker, so that the memory of its copy is local to the worker on NUMA systems.
+        // The copies share the chemical system, whose phases evaluate their own instances of the activity models in each thread (see createThreadLocalActivityModel).
+        const Impl prototype(*this); // copy of this solver without its own workers
+        Vec<SharedPtr<Impl>> copies(numworkers);
+        pool->forEachWorker([&](Index iworker)
+        {
+            copies[iworker] = std::make_shared<Impl>(prototype);
+        });
+        workers = std::move(copies);
+    }
+
+    auto solve(Vec<ChemicalState>& states) -> Vec<EquilibriumResult>
+    {
+        return solve(states, Vec<EquilibriumConditions>(states.size(), xconditions));
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<EquilibriumResult>
+    {
+        errorif(states.size() != conditions.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects in batched EquilibriumSolver::solve, but got ", states.size(), " and ", conditions.size(), " respectively.");
+        initializeWorkers();
+
+        const auto numworkers = workers.size();
+
+        // The index of the last successful calculation of each worker in the batch (used for warm starts, see EquilibriumOptions::warm_start)
+        Indices ilast(numworkers, Index(-1));
+
+        // The sensitivity derivatives of the last calculation of each worker (only needed for warm starts from predictions)
+        Vec<EquilibriumSensitivity> sensitivities;
+        if(options.warm_start == EquilibriumWarmStart::Predicted)
+            sensitivities.resize(numworkers, EquilibriumSensitivity(specs));
+
+        Vec<EquilibriumResult> results(states.size());
+        pool->parallelFor(states.size(), [&](Index i, Index iworker)
+        {
+            auto const* neighbour = (i > 0 && ilast[iworker] == i - 1) ? &states[i - 1] : nullptr;
+            auto* sensitivity = sensitivities.empty() ? nullptr : &sensitivities[iworker];
+            results[i] = workers[iworker]->solveWarmStarted(states[i], conditions[i], neighbour, sensitivity);
+            ilast[iworker] = results[i].succeeded() ? i : Index(-1);
+        });
+        return results;
+    }
+
+    /// Equilibrate a chemical state in a batch using the initial guess determined by EquilibriumOptions::warm_start.
+    /// @param[in,out] state The chemical state of the calculation
+    /// @param conditions The constraint conditions of the calculation
+    /// @param neighbour The equilibrium state just computed by this solver for the previous calculation in the batch (`nullptr` if none)
+    /// @param sensitivity The sensitivity derivatives of `neighbour` on input and of `state` on output (`nullptr` if not computed)
+    auto solveWarmStarted(ChemicalState& state, EquilibriumConditions const& conditions, ChemicalState const* neighbour, EquilibriumSensitivity* sensitivity) -> EquilibriumResult
+    {
+        auto solveFrom = [&](EquilibriumConditions const& conds)
+        {
+            return sensitivity ? solve(state, *sensitivity, conds, xrestrictions) : solve(state, conds, xrestrictions);
+        };
+
+        if(neighbour == nullptr || options.warm_start == EquilibriumWarmStart::PreviousStep)
+            return solveFrom(conditions);
+
+        // Fix the input variables and the initial amounts of the components of this calculation before its species amounts are replaced
+        EquilibriumConditions fixed(conditions);
+        fixed.setInputVariables(conditions.inputValuesGetOrCompute(state));
+        fixed.setInitialComponentAmounts(conditions.initialComponentAmountsGetOrCompute(state).matrix());
+
+        const ChemicalState own(state); // the initial guess used if the calculation from the neighbour fails
+
+        if(options.warm_start == EquilibriumWarmStart::Predicted && sensitivity)
+        {
+            EquilibriumPredictor predictor(*neighbour, *sensitivity, true);
+            predictor.predict(state, fixed);
+
+            // Ensure the predicted species amounts are positive
+            const ArrayXd n = state.speciesAmounts().cast<double>().max(options.epsilon);
+            state.setSpeciesAmounts(n);
+        }
+        else
+        {
+            state.setSpeciesAmounts(neighbour->speciesAmounts());
+            state.equilibrium().assign(neighbour->equilibrium());
+        }
+
+        const auto res = solveFrom(fixed);
+
+        if(res.succeeded())
+            return res;
+
+        state = own;
+
+        return solveFrom(fixed);
+    }
+
+    auto sweep(ChemicalState& state, Vec<EquilibriumConditions> const& conditions, EquilibriumRestrictions const& restrictions) -> Table
+    {
+        const auto& species = system.species();
+        const auto& inputs = specs.namesInputs();
+
+        Table table;
+
+        EquilibriumSensitivity sensitivity(specs);
+
+        ChemicalState previous(state); // the equilibrium state at the previous point, used if the calculation from the prediction fails
+
+        ArrayXd n;
+
+        bool predicted = false;
+
+        for(Index k = 0; k < conditions.size(); ++k)
+        {
+            if(predicted)
+            {
+                // Use the first-order Taylor prediction from the previous point as the initial guess
+                EquilibriumPredictor predictor(previous, sensitivity, true);
+                predictor.predict(state, conditions[k]);
+
+                // Ensure the predicted species amounts are positive
+                n = state.speciesAmounts().cast<double>().max(options.epsilon);
+                state.setSpeciesAmounts(n);
+            }
+
+            auto result = solve(state, sensitivity, conditions[k], restrictions);
+
+            if(result.failed() && predicted)
+            {
+                state = previous;
+                result = solve(state, sensitivity, conditions[k], restrictions);
+            }
+
+            predicted = result.succeeded();
+
+            if(predicted)
+                previous = state;
+
+            const auto w = conditions[k].inputValues();
+            for(auto i = 0; i < inputs.size(); ++i)
+                table.column(inputs[i]) << double(w[i]);
+            table.column("Succeeded") << result.succeeded();
+            table.column("Iterations") << result.iterations();
+            const auto ns = state.speciesAmounts();
+            for(auto i = 0; i < species.size(); ++i)
+                table.column("n[" + species[i].name() + "]") << double(ns[i]);
+        }
+
+        return table;
+    }
 };
 
 EquilibriumSolver::EquilibriumSolver(ChemicalSystem const& system)
@@ -410,7 +1175,9 @@ EquilibriumSolver::EquilibriumSolver(EquilibriumSpecs const& specs)
 
 EquilibriumSolver::EquilibriumSolver(EquilibriumSolver const& other)
 : pimpl(new Impl(*other.pimpl))
-{}
+{
+    pimpl->workers.clear(); // the copy creates its own worker solvers when needed
+}
 
 EquilibriumSolver::~EquilibriumSolver()
 {}
@@ -461,9 +1228,54 @@ auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sens
     return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
+auto EquilibriumSolver::adjoint(ChemicalState const& state, VectorXdConstRef dfdn, VectorXdConstRef dfdp, VectorXdRef dfdw, VectorXdRef dfdc) -> void
+{
+    pimpl->adjoint(state, dfdn, dfdp, dfdw, dfdc);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states) -> Vec<EquilibriumResult>
+{
+    return pimpl->solve(states);
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<EquilibriumResult>
+{
+    return pimpl->solve(states, conditions);
+}
+
+auto EquilibriumSolver::solveAsync(ChemicalState& state, EquilibriumConditions const& conditions) -> std::future<EquilibriumResult>
+{
+    return std::async(std::launch::async, [impl = pimpl.get(), &state, conditions] { return impl->solve(state, conditions); });
+}
+
+auto EquilibriumSolver::solveAsync(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> std::future<Vec<EquilibriumResult>>
+{
+    return std::async(std::launch::async, [impl = pimpl.get(), &states, conditions] { return impl->solve(states, conditions); });
+}
+
+auto EquilibriumSolver::sweep(ChemicalState& state, Vec<EquilibriumConditions> const& conditions) -> Table
+{
+    return pimpl->sweep(state, conditions, pimpl->xrestrictions);
+}
+
+auto EquilibriumSolver::sweep(ChemicalState& state, Vec<EquilibriumConditions> const& conditions, EquilibriumRestrictions const& restrictions) -> Table
+{
+    return pimpl->sweep(state, conditions, restrictions);
+}
+
+auto EquilibriumSolver::replay(ChemicalState& state, EquilibriumRecord const& record) -> EquilibriumResult
+{
+    return pimpl->replay(state, record);
+}
+
 auto EquilibriumSolver::setOptions(EquilibriumOptions const& options) -> void
 {
     pimpl->setOptions(options);
 }
 
+auto EquilibriumSolver::memoryUsage() const -> MemoryUsage
+{
+    return pimpl->memoryUsage();
+}
+
 } // namespace Reaktoro
@@ -17,9 +17,13 @@
 
 #pragma once
 
+// C++ includes
+#include <future>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/MemoryUsage.hpp>
 
 namespace Reaktoro {
 
@@ -31,7 +35,9 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSensitivity;
 class EquilibriumSpecs;
+class Table;
 struct EquilibriumOptions;
+struct EquilibriumRecord;
 struct EquilibriumResult;
 
 /// Used for calculating chemical equilibrium states.
@@ -109,6 +115,115 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
 
+    /// Compute the derivatives of a scalar objective function of an equilibrium state with respect to all input conditions using the adjoint method.
+    /// Given the derivatives of the objective function with respect to the
+    /// species amounts *n* and the *p* control variables, this method solves a
+    /// single transposed linear system with the Jacobian of the optimality
+    /// conditions at the equilibrium state, and contracts its solution with
+    /// the derivatives of these conditions with respect to the input variables
+    /// *w* and the initial amounts of the conservative components *c*. Its cost
+    /// is thus independent of the number of inputs, in contrast with the
+    /// sensitivity derivatives computed in @ref solve, which is useful when
+    /// fitting many model parameters (registered as input variables with
+    /// EquilibriumSpecs::addInput) to a scalar misfit function.
+    /// @param state The equilibrium state computed in the last calculation with this solver
+    /// @param dfdn The derivatives of the objective function with respect to the species amounts *n*
+    /// @param dfdp The derivatives of the objective function with respect to the *p* control variables
+    /// @param[out] dfdw The derivatives of the objective function with respect to the input variables *w*
+    /// @param[out] dfdc The derivatives of the objective function with respect to the initial amounts of the conservative components *c*
+    auto adjoint(ChemicalState const& state, VectorXdConstRef dfdn, VectorXdConstRef dfdp, VectorXdRef dfdw, VectorXdRef dfdc) -> void;
+
+    //=================================================================================================================
+    //
+    // BATCHED CHEMICAL EQUILIBRIUM METHODS
+    //
+    //=================================================================================================================
+
+    /// Equilibrate many chemical states in parallel.
+    /// The calculations are distributed among a pool of worker threads
+    /// (see EquilibriumOptions::threads), each using its own copy of this
+    /// solver. The chemical system and equilibrium specifications are shared.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @return The result of the equilibrium calculation of each state
+    auto solve(Vec<ChemicalState>& states) -> Vec<EquilibriumResult>;
+
+    /// Equilibrate many chemical states in parallel respecting given constraint conditions.
+    /// The calculations are distributed among a pool of worker threads
+    /// (see EquilibriumOptions::threads), each using its own copy of this
+    /// solver. The chemical system and equilibrium specifications are shared.
+    /// The initial guess of each calculation is either its own chemical state
+    /// or the equilibrium state just computed for the previous one in the
+    /// batch (see EquilibriumOptions::warm_start).
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for each state
+    /// @return The result of the equilibrium calculation of each state
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<EquilibriumResult>;
+
+    //=================================================================================================================
+    //
+    // ASYNCHRONOUS CHEMICAL EQUILIBRIUM METHODS
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a chemical state in a background thread respecting given constraint conditions.
+    /// The calculation overlaps with the work of the calling thread (e.g.,
+    /// transport, I/O or communication) until the result is requested from
+    /// the returned future, which also rethrows any error of the calculation.
+    /// Until then, neither this solver nor `state` may be used.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium (copied)
+    auto solveAsync(ChemicalState& state, EquilibriumConditions const& conditions) -> std::future<EquilibriumResult>;
+
+    /// Equilibrate many chemical states in a background thread respecting given constraint conditions.
+    /// The calculations are distributed among the pool of worker threads used
+    /// in batched calculations (see EquilibriumOptions::threads and
+    /// ThreadPool::setDefaultExecutor). Until the result is requested from
+    /// the returned future, neither this solver nor `states` may be used.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium for each state (copied)
+    auto solveAsync(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> std::future<Vec<EquilibriumResult>>;
+
+    //=================================================================================================================
+    //
+    // METHODS FOR SEQUENCES OF EQUILIBRIUM CALCULATIONS
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a chemical state along an ordered sequence of constraint conditions (e.g., a temperature, pressure or pH sweep).
+    /// The equilibrium state computed at each point, together with its
+    /// sensitivity derivatives, is used to construct an EquilibriumPredictor
+    /// whose first-order Taylor prediction is the initial guess for the next
+    /// point. If the calculation from this prediction fails, it is repeated
+    /// from the previous equilibrium state.
+    /// @param[in,out] state The initial guess for the first point (in) and the computed equilibrium state at the last point (out)
+    /// @param conditions The constraint conditions at each point of the sweep
+    /// @return A table with one row per point containing the input variables, whether the calculation succeeded, its number of iterations, and the amounts of the species (columns `n[Name]`).
+    auto sweep(ChemicalState& state, Vec<EquilibriumConditions> const& conditions) -> Table;
+
+    /// Equilibrate a chemical state along an ordered sequence of constraint conditions respecting given reactivity restrictions.
+    /// @param[in,out] state The initial guess for the first point (in) and the computed equilibrium state at the last point (out)
+    /// @param conditions The constraint conditions at each point of the sweep
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    /// @see sweep(ChemicalState&, Vec<EquilibriumConditions> const&)
+    auto sweep(ChemicalState& state, Vec<EquilibriumConditions> const& conditions, EquilibriumRestrictions const& restrictions) -> Table;
+
+    //=================================================================================================================
+    //
+    // REPLAY METHODS
+    //
+    //=================================================================================================================
+
+    /// Repeat a recorded equilibrium calculation in isolation (e.g., to profile it with Profiler).
+    /// The calculation is repeated with the inputs of its optimization problem
+    /// and its initial guess as recorded (see EquilibriumOptions::record_file),
+    /// without recomputing them from a chemical state, conditions and
+    /// restrictions. This solver must have the same equilibrium specifications
+    /// and options as the one that recorded the calculation, and it is not
+    /// recorded again.
+    /// @param[out] state The computed equilibrium state, which must be a state of the chemical system of this solver
+    /// @param record The recorded calculation (see readEquilibriumRecords)
+    auto replay(ChemicalState& state, EquilibriumRecord const& record) -> EquilibriumResult;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -118,6 +233,13 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(EquilibriumOptions const& options) -> void;
 
+    /// Return the approximate memory used by this equilibrium solver, with a breakdown into its components.
+    /// This includes the problem setup, the Optima problem, state and
+    /// sensitivity objects and the copies of this solver used by worker
+    /// threads in batched calculations, but not the internal workspace of the
+    /// Optima solver.
+    auto memoryUsage() const -> MemoryUsage;
+
 private:
     struct Impl;
 
@@ -17,9 +17,68 @@
 
 
 from reaktoro import *
+import numpy as npy
 import pytest
 
 
-# TODO Implement tests for the python bindings of component EquilibriumSolver in EquilibriumSolver[test].py
 def testEquilibriumSolver():
-    pass
+    db = SupcrtDatabase("supcrtbl")
+
+    system = ChemicalSystem(db,
+        AqueousPhase("H2O(aq) H+ OH- Na+ Cl- HCO3- CO3-2 CO2(aq)"),
+        GaseousPhase("CO2(g)")
+    )
+
+    state = ChemicalState(system)
+    state.set("H2O(aq)", 1.0, "kg")
+    state.set("Na+", 0.1, "mol")
+    state.set("Cl-", 0.1, "mol")
+    state.set("CO2(g)", 1.0, "mol")
+
+    solver = EquilibriumSolver(system)
+
+    #-------------------------------------------------------------------------
+    # Testing batched solve with a list of ChemicalState objects
+    #-------------------------------------------------------------------------
+    states = [ChemicalState(state) for _ in range(4)]
+    for i, s in enumerate(states):
+        s.temperature(25.0 + 10.0*i, "celsius")
+
+    results = solver.solve(states)
+
+    assert len(results) == len(states)
+    assert all(result.succeeded() for result in results)
+
+    # The states in the list must have been updated in place
+    for s in states:
+        expected = ChemicalState(s)
+        assert solver.solve(expected).succeeded()
+        assert s.speciesAmounts().asarray() == pytest.approx(expected.speciesAmounts().asarray())
+
+    #-------------------------------------------------------------------------
+    # Testing batched solve with cell-wise temperatures, pressures and initial component amounts
+    #-------------------------------------------------------------------------
+    specs = EquilibriumSpecs(system)
+    specs.temperature()
+    specs.pressure()
+
+    conditions = EquilibriumConditions(specs)
+
+    b0 = conditions.initialComponentAmountsGetOrCompute(state)
+
+    T = npy.array([298.15, 323.15, 348.15])
+    P = npy.array([1.0e5, 2.0e5, 3.0e5])
+    b = npy.array([b0, 2.0 * b0, 3.0 * b0])
+
+    n, results = solver.solve(state, conditions, T, P, b)
+
+    assert n.shape == (3, system.species().size())
+    assert all(result.succeeded() for result in results)
+
+    for i in range(3):
+        expected = ChemicalState(state)
+        conditions.temperature(T[i])
+        conditions.pressure(P[i])
+        conditions.setInitialComponentAmounts(b[i])
+        assert solver.solve(expected, conditions).succeeded()
+        assert n[i] == pytest.approx(expected.speciesAmounts().asarray())
@@ -19,11 +19,14 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
@@ -31,22 +34,77 @@
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 using namespace Reaktoro;
 
+// Equilibrate copies of the given chemical states in parallel and assign the results back to them.
+// The states are received as pointers so that Python sees the updated ChemicalState objects.
+auto solveBatch(EquilibriumSolver& solver, std::vector<ChemicalState*> const& states, Vec<EquilibriumConditions> const* conditions) -> Vec<EquilibriumResult>
+{
+    Vec<ChemicalState> copies;
+    copies.reserve(states.size());
+    for(auto const* state : states)
+        copies.push_back(*state);
+    auto results = conditions ? solver.solve(copies, *conditions) : solver.solve(copies);
+    for(auto i = 0; i < states.size(); ++i)
+        states[i]->assign(copies[i]);
+    return results;
+}
+
+// Equilibrate one chemical state per cell with temperatures (in K), pressures (in Pa) and initial
+// amounts of conservative components given cell-wise in arrays, returning the species amounts in
+// each cell (one row per cell) and the result of each calculation.
+auto solveCells(EquilibriumSolver& solver, ChemicalState const& state, EquilibriumConditions const& conditions, ArrayXdConstRef const& T, ArrayXdConstRef const& P, ArrayXXdConstRef const& b) -> std::tuple<ArrayXXd, Vec<EquilibriumResult>>
+{
+    const auto Ncells = T.size();
+    errorif(P.size() != Ncells, "Expecting as many pressure values as temperature values in batched EquilibriumSolver::solve, but got ", P.size(), " and ", Ncells, " respectively.");
+    errorif(b.rows() != Ncells, "Expecting one row of initial component amounts per cell in batched EquilibriumSolver::solve, but got ", b.rows(), " rows for ", Ncells, " cells.");
+
+    Vec<ChemicalState> states(Ncells, state);
+    Vec<EquilibriumConditions> conds(Ncells, conditions);
+    for(auto i = 0; i < Ncells; ++i)
+    {
+        states[i].setTemperature(T[i]);
+        states[i].setPressure(P[i]);
+        conds[i].temperature(T[i]);
+        conds[i].pressure(P[i]);
+        conds[i].setInitialComponentAmounts(b.row(i).transpose().matrix());
+    }
+
+    auto results = solver.solve(states, conds);
+
+    ArrayXXd n(Ncells, state.system().species().size());
+    for(auto i = 0; i < Ncells; ++i)
+        n.row(i) = states[i].speciesAmounts().cast<double>().transpose();
+
+    return { n, results };
+}
+
 void exportEquilibriumSolver(py::module& m)
 {
     py::class_<EquilibriumSolver>(m, "EquilibriumSolver")
         .def(py::init<ChemicalSystem const&>())
         .def(py::init<EquilibriumSpecs const&>())
 
-        .def("solve", py::overload_cast<ChemicalState&>(&EquilibriumSolver::solve), "Equilibrate a chemical state.", py::arg("state"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given reactivity restrictions.", py::arg("state"), py::arg("restrictions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state.", py::arg("state"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given reactivity restrictions.", py::arg("state"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("solve", [](EquilibriumSolver& self, std::vector<ChemicalState*> const& states) { return solveBatch(self, states, nullptr); }, py::call_guard<py::gil_scoped_release>(), "Equilibrate multiple chemical states in parallel.", py::arg("states"))
+        .def("solve", [](EquilibriumSolver& self, std::vector<ChemicalState*> const& states, Vec<EquilibriumConditions> const& conditions) { return solveBatch(self, states, &conditions); }, py::call_guard<py::gil_scoped_release>(), "Equilibrate multiple chemical states in parallel respecting given constraint conditions for each state.", py::arg("states"), py::arg("conditions"))
+        .def("solve", solveCells, py::call_guard<py::gil_scoped_release>(), "Equilibrate one chemical state per cell in parallel with cell-wise temperatures (in K), pressures (in Pa) and initial component amounts (one row per cell), returning the species amounts in each cell (one row per cell) and the result of each calculation.", py::arg("state"), py::arg("conditions"), py::arg("T"), py::arg("P"), py::arg("b"))
+
+        .def("sweep", py::overload_cast<ChemicalState&, Vec<EquilibriumConditions> const&>(&EquilibriumSolver::sweep), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state along an ordered sequence of constraint conditions, using the first-order prediction from each point as the initial guess for the next.", py::arg("state"), py::arg("conditions"))
+        .def("sweep", py::overload_cast<ChemicalState&, Vec<EquilibriumConditions> const&, EquilibriumRestrictions const&>(&EquilibriumSolver::sweep), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state along an ordered sequence of constraint conditions respecting given reactivity restrictions, using the first-order prediction from each point as the initial guess for the next.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("adjoint", [](EquilibriumSolver& self, ChemicalState const& state, VectorXdConstRef dfdn, VectorXdConstRef dfdp) { VectorXd dfdw(state.equilibrium().inputVariables().size()), dfdc; dfdc.resize(state.equilibrium().initialComponentAmounts().size()); self.adjoint(state, dfdn, dfdp, dfdw, dfdc); return std::make_tuple(dfdw, dfdc); }, "Compute the derivatives of a scalar objective function of an equilibrium state with respect to the input variables and the initial amounts of the conservative components using the adjoint method, returned as a tuple (dfdw, dfdc).", py::arg("state"), py::arg("dfdn"), py::arg("dfdp"))
 
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&>(&EquilibriumSolver::solve), "Equilibrate a chemical state and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("restrictions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
+        .def("replay", &EquilibriumSolver::replay, py::call_guard<py::gil_scoped_release>(), "Repeat a recorded equilibrium calculation in isolation.", py::arg("state"), py::arg("record"))
 
         .def("setOptions", &EquilibriumSolver::setOptions)
+        .def("memoryUsage", &EquilibriumSolver::memoryUsage)
         ;
 }
@@ -16,6 +16,7 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cstdio>
 #include <iomanip>
 
 // Catch includes
@@ -29,13 +30,16 @@
 #include <Reaktoro/Core/Phases.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDebyeHuckel.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPhreeqc.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
 using namespace Reaktoro;
 
 #define PRINT_INFO_IF_FAILS(x) INFO(#x " = \n" << std::scientific << std::setprecision(16) << x)
@@ -293,6 +297,110 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
             CHECK( result.iterations() == 0 );
             checkChemicalEquilibriumStateHasZeroDerivativeValues(state);
         }
+
+        WHEN("using an iteration budget")
+        {
+            options.epsilon = 1e-16;
+            options.iteration_budget = 10;
+            solver.setOptions(options);
+
+            result = solver.solve(state);
+
+            CHECK( result.failed() );
+            CHECK( result.status() == EquilibriumStatus::BudgetExhausted );
+            CHECK( result.iterations() == 10 );
+
+            options.iteration_budget = 0;
+            solver.setOptions(options);
+
+            result = solver.solve(state); // check the calculation resumes from the last iterate
+
+            CHECK( result.succeeded() );
+            CHECK( result.iterations() < 29 );
+        }
+
+        WHEN("using a time budget")
+        {
+            options.epsilon = 1e-16;
+            options.time_budget = 1e-12; // exhausted once the first chunk of iterations is performed
+            options.time_budget_interval = 5;
+            solver.setOptions(options);
+
+            result = solver.solve(state);
+
+            CHECK( result.status() == EquilibriumStatus::BudgetExhausted );
+            CHECK( result.iterations() == 5 );
+        }
+
+        WHEN("using a convergence tolerance given in the equilibrium conditions")
+        {
+            options.epsilon = 1e-16;
+            solver.setOptions(options);
+
+            EquilibriumConditions conditions(system);
+            conditions.temperature(T, "celsius");
+            conditions.pressure(P, "bar");
+
+            ChemicalState tight(state);
+            result = solver.solve(tight, conditions);
+
+            CHECK( result.succeeded() );
+            CHECK( result.tolerance == options.optima.convergence.tolerance );
+            CHECK( result.residual < 1e-10 );
+
+            const auto tightiters = result.iterations();
+
+            conditions.setTolerance(1e-2);
+
+            ChemicalState loose(state);
+            result = solver.solve(loose, conditions);
+
+            CHECK( result.succeeded() );
+            CHECK( result.tolerance == 1e-2 );
+            CHECK( result.iterations() <= tightiters );
+
+            conditions.setTolerance(0.0);
+
+            result = solver.solve(loose, conditions); // check the loose calculation can be continued with the tolerance in the options
+
+            CHECK( result.succeeded() );
+            CHECK( result.tolerance == options.optima.convergence.tolerance );
+            CHECK( loose.speciesAmounts().isApprox(tight.speciesAmounts(), 1e-6) );
+
+            CHECK_THROWS( conditions.setTolerance(-1.0) );
+        }
+
+        WHEN("cold starts are first converged with ideal activity models")
+        {
+            options.epsilon = 1e-16;
+            solver.setOptions(options);
+
+            ChemicalState expected(state);
+            REQUIRE( solver.solve(expected).succeeded() );
+
+            options.ideal_presolve = true;
+            solver.setOptions(options);
+
+            result = solver.solve(state);
+
+            // The activity models of this system are already ideal, so that nothing is left for the full calculation
+            CHECK( result.succeeded() );
+            CHECK( result.iterations() == 0 );
+            CHECK( state.speciesAmounts().isApprox(expected.speciesAmounts()) );
+
+            options.ideal_presolve_tolerance = 1e-4;
+            solver.setOptions(options);
+
+            ChemicalState loose(system);
+            loose.setTemperature(T, "celsius");
+            loose.setPressure(P, "bar");
+            loose.setSpeciesAmounts(expected.speciesAmounts()); // a cold start, with no equilibrium data from previous calculations
+
+            result = solver.solve(loose);
+
+            CHECK( result.succeeded() );
+            CHECK( loose.speciesAmounts().isApprox(expected.speciesAmounts()) );
+        }
     }
 
     SECTION("There is an aqueous solution and a gaseous solution")
@@ -374,6 +482,26 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
 
         EquilibriumSolver solver(system);
 
+        WHEN("phases with unchanged species amounts are pruned from property evaluations")
+        {
+            ChemicalState expected(state);
+            REQUIRE( solver.solve(expected).succeeded() );
+
+            options.prune_inactive_phases = true;
+            solver.setOptions(options);
+
+            result = solver.solve(state);
+
+            CHECK( result.succeeded() );
+            CHECK( state.speciesAmounts().isApprox(expected.speciesAmounts()) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(state);
+
+            result = solver.solve(state); // check a recalculation converges in 0 iterations
+
+            CHECK( result.succeeded() );
+            CHECK( result.iterations() == 0 );
+        }
+
         WHEN("reactivity restrictions are not imposed")
         {
             WHEN("using epsilon 1e-40")
@@ -681,4 +809,547 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
         CHECK( result.succeeded() );
         CHECK( result.iterations() == 32 );
     }
+
+    SECTION("There is a slow calculation recorded and replayed")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C")) );
+
+        ChemicalSystem system(phases);
+
+        ChemicalState state(system);
+        state.setTemperature(T, "celsius");
+        state.setPressure(P, "bar");
+        state.setSpeciesAmount("H2O"  , 55.0 , "mol");
+        state.setSpeciesAmount("NaCl" , 0.01 , "mol");
+        state.setSpeciesAmount("CO2"  , 1.0  , "mol");
+
+        const auto filepath = "EquilibriumSolver.test.records.bin";
+
+        std::remove(filepath);
+
+        options.record_file = filepath;
+        options.record_min_iterations = 5; // the calculation from the initial state takes more iterations, but not its recalculation
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+
+        const auto iterations = result.iterations();
+
+        result = solver.solve(state); // not recorded, since it converges in 0 iterations
+
+        const auto records = readEquilibriumRecords(filepath);
+
+        REQUIRE( records.size() == 1 );
+        CHECK( records[0].iterations == iterations );
+
+        ChemicalState replayed(system);
+
+        options.record_file = ""; // the solver replaying the calculation has otherwise the same options
+        solver.setOptions(options);
+
+        result = solver.replay(replayed, records[0]);
+
+        CHECK( result.succeeded() );
+        CHECK( result.iterations() == iterations );
+        CHECK( replayed.speciesAmounts().isApprox(state.speciesAmounts()) );
+
+        std::remove(filepath);
+    }
+}
+
+TEST_CASE("Testing batched EquilibriumSolver::solve", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumOptions options;
+    options.threads = 3;
+
+    EquilibriumSolver solver(specs);
+    solver.setOptions(options);
+
+    const auto numstates = 10;
+
+    Vec<ChemicalState> states;
+    Vec<EquilibriumConditions> conditions;
+
+    for(auto i = 0; i < numstates; ++i)
+    {
+        ChemicalState state(system);
+        state.set("H2O", 55.0, "mol");
+        state.set("NaCl", 0.1 * (i + 1), "mol");
+        states.push_back(state);
+
+        EquilibriumConditions condition(specs);
+        condition.temperature(25.0 + 5.0 * i, "celsius");
+        condition.pressure(1.0 + i, "bar");
+        condition.pH(3.0 + 0.5 * i);
+        conditions.push_back(condition);
+    }
+
+    // Compute the expected equilibrium states one by one with a separate solver
+    Vec<ChemicalState> expected = states;
+    EquilibriumSolver sequential(specs);
+    for(auto i = 0; i < numstates; ++i)
+        REQUIRE( sequential.solve(expected[i], conditions[i]).succeeded() );
+
+    const auto results = solver.solve(states, conditions);
+
+    REQUIRE( results.size() == numstates );
+
+    for(auto i = 0; i < numstates; ++i)
+    {
+        CHECK( results[i].succeeded() );
+        CHECK( states[i].temperature() == Approx(expected[i].temperature()) );
+        CHECK( states[i].pressure() == Approx(expected[i].pressure()) );
+        CHECK( states[i].speciesAmounts().isApprox(expected[i].speciesAmounts()) );
+        checkChemicalEquilibriumStateHasZeroDerivativeValues(states[i]);
+    }
+
+    // Check a recalculation of the batch converges in 0 iterations for every state
+    for(auto const& result : solver.solve(states, conditions))
+    {
+        CHECK( result.succeeded() );
+        CHECK( result.iterations() == 0 );
+    }
+
+    // Check the asynchronous calculations produce the same equilibrium states as the synchronous ones
+    Vec<ChemicalState> asyncstates(numstates, ChemicalState(system));
+    for(auto i = 0; i < numstates; ++i)
+    {
+        asyncstates[i].set("H2O", 55.0, "mol");
+        asyncstates[i].set("NaCl", 0.1 * (i + 1), "mol");
+    }
+
+    auto future = solver.solveAsync(asyncstates, conditions);
+
+    ChemicalState asyncstate = asyncstates.front();
+    EquilibriumSolver another(specs);
+    auto single = another.solveAsync(asyncstate, conditions.back());
+
+    const auto asyncresults = future.get();
+
+    REQUIRE( asyncresults.size() == numstates );
+
+    for(auto i = 0; i < numstates; ++i)
+    {
+        CHECK( asyncresults[i].succeeded() );
+        CHECK( asyncstates[i].speciesAmounts().isApprox(expected[i].speciesAmounts()) );
+    }
+
+    CHECK( single.get().succeeded() );
+    CHECK( asyncstate.temperature() == Approx(expected.back().temperature()) );
+    CHECK( asyncstate.pressure() == Approx(expected.back().pressure()) );
+
+    // Check the calculations warm-started from the previous state in the batch produce the same equilibrium states
+    for(auto warmstart : { EquilibriumWarmStart::Neighbour, EquilibriumWarmStart::Predicted })
+    {
+        EquilibriumOptions warmoptions;
+        warmoptions.threads = 2;
+        warmoptions.warm_start = warmstart;
+
+        EquilibriumSolver warmsolver(specs);
+        warmsolver.setOptions(warmoptions);
+
+        Vec<ChemicalState> warmstates(numstates, ChemicalState(system));
+        for(auto i = 0; i < numstates; ++i)
+        {
+            warmstates[i].set("H2O", 55.0, "mol");
+            warmstates[i].set("NaCl", 0.1 * (i + 1), "mol");
+        }
+
+        const auto warmresults = warmsolver.solve(warmstates, conditions);
+
+        for(auto i = 0; i < numstates; ++i)
+        {
+            CHECK( warmresults[i].succeeded() );
+            CHECK( warmstates[i].temperature() == Approx(expected[i].temperature()) );
+            CHECK( warmstates[i].speciesAmounts().isApprox(expected[i].speciesAmounts()) );
+        }
+    }
+
+    // Check an error in one calculation is reported only through its result when the quiet option is enabled
+    conditions[2] = EquilibriumConditions(specs); // pH is not specified in these conditions
+
+    options.quiet = true;
+    solver.setOptions(options);
+
+    const auto summary = summarizeFailures(solver.solve(states, conditions));
+
+    CHECK( summary.size == numstates );
+    CHECK( summary.errors == 1 );
+    CHECK( summary.not_converged == 0 );
+    CHECK( summary.failed == Indices{2} );
+
+    // Check an error is raised when the number of states and conditions differ
+    conditions.pop_back();
+    CHECK_THROWS( solver.solve(states, conditions) );
+}
+
+TEST_CASE("Testing batched EquilibriumSolver::solve with a non-ideal aqueous phase", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    // The Debye-Huckel activity model keeps intermediate results for the last
+    // temperature and pressure, which the workers must not share
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")).set(ActivityModelDebyeHuckel()) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumOptions options;
+    options.threads = 3;
+
+    EquilibriumSolver solver(specs);
+    solver.setOptions(options);
+
+    const auto numstates = 30;
+
+    Vec<ChemicalState> states;
+    Vec<EquilibriumConditions> conditions;
+
+    for(auto i = 0; i < numstates; ++i)
+    {
+        ChemicalState state(system);
+        state.set("H2O", 55.0, "mol");
+        state.set("NaCl", 0.1 * (i + 1), "mol");
+        states.push_back(state);
+
+        EquilibriumConditions condition(specs);
+        condition.temperature(25.0 + 2.0 * i, "celsius");
+        condition.pressure(1.0 + i, "bar");
+        condition.pH(3.0 + 0.2 * i);
+        conditions.push_back(condition);
+    }
+
+    // Compute the expected equilibrium states one by one with a separate solver
+    Vec<ChemicalState> expected = states;
+    EquilibriumSolver sequential(specs);
+    for(auto i = 0; i < numstates; ++i)
+        REQUIRE( sequential.solve(expected[i], conditions[i]).succeeded() );
+
+    const auto results = solver.solve(states, conditions);
+
+    REQUIRE( results.size() == numstates );
+
+    for(auto i = 0; i < numstates; ++i)
+    {
+        CHECK( results[i].succeeded() );
+        CHECK( states[i].speciesAmounts().isApprox(expected[i].speciesAmounts()) );
+        CHECK( states[i].props().speciesActivitiesLn().isApprox(expected[i].props().speciesActivitiesLn()) );
+    }
+}
+
+TEST_CASE("Testing EquilibriumSolver::sweep", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumSolver solver(specs);
+
+    const auto numpoints = 20;
+
+    Vec<EquilibriumConditions> conditions;
+    for(auto i = 0; i < numpoints; ++i)
+    {
+        EquilibriumConditions condition(specs);
+        condition.temperature(25.0 + 2.0 * i, "celsius");
+        condition.pressure(1.0, "bar");
+        condition.pH(3.0 + 0.3 * i);
+        conditions.push_back(condition);
+    }
+
+    ChemicalState state0(system);
+    state0.set("H2O", 55.0, "mol");
+    state0.set("NaCl", 0.1, "mol");
+
+    // Compute the expected equilibrium states one by one, each starting from the previous one
+    Vec<ChemicalState> expected;
+    ChemicalState current(state0);
+    EquilibriumSolver sequential(specs);
+    for(auto i = 0; i < numpoints; ++i)
+    {
+        REQUIRE( sequential.solve(current, conditions[i]).succeeded() );
+        expected.push_back(current);
+    }
+
+    ChemicalState state(state0);
+    const auto table = solver.sweep(state, conditions);
+
+    const auto& T = table["T"];
+    const auto& nNa = table["n[Na+]"];
+    const auto& nH = table["n[H+]"];
+
+    REQUIRE( T.size() == numpoints );
+    REQUIRE( table.column("Succeeded").booleans().size() == numpoints );
+
+    for(auto i = 0; i < numpoints; ++i)
+    {
+        CHECK( table.column("Succeeded").booleans()[i] );
+        CHECK( T[i] == Approx(expected[i].temperature()) );
+        CHECK( nNa[i] == Approx(expected[i].speciesAmount("Na+")) );
+        CHECK( nH[i] == Approx(expected[i].speciesAmount("H+")) );
+    }
+
+    CHECK( state.speciesAmounts().isApprox(expected.back().speciesAmounts()) );
+}
+
+TEST_CASE("Testing warm start of EquilibriumSolver objects with different specifications sharing a ChemicalState", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specsTP(system);
+    specsTP.temperature();
+    specsTP.pressure();
+
+    EquilibriumSpecs specsTPpH(system);
+    specsTPpH.temperature();
+    specsTPpH.pressure();
+    specsTPpH.pH();
+
+    EquilibriumSolver solverTP(specsTP);
+    EquilibriumSolver solverTPpH(specsTPpH);
+
+    ChemicalState state(system);
+    state.set("H2O", 55.0, "mol");
+    state.set("NaCl", 0.1, "mol");
+
+    const auto resultTP = solverTP.solve(state);
+
+    REQUIRE( resultTP.succeeded() );
+    REQUIRE( resultTP.iterations() > 0 );
+
+    // Check the timing information collected during the calculation
+    CHECK( resultTP.timing.evaluations >= resultTP.iterations() );
+    CHECK( resultTP.timing.jacobian_evaluations > 0 );
+    CHECK( resultTP.timing.jacobian_evaluations <= resultTP.timing.evaluations );
+    CHECK( resultTP.timing.solve >= resultTP.timing.properties + resultTP.timing.jacobian );
+
+    const auto pH = AqueousProps(state).pH();
+
+    EquilibriumConditions conditions(specsTPpH);
+    conditions.temperature(state.temperature());
+    conditions.pressure(state.pressure());
+    conditions.pH(pH);
+
+    REQUIRE( solverTPpH.solve(state, conditions).succeeded() );
+
+    // The TP solver should resume from its own saved Optima::State instead of cold-starting
+    const auto resumedTP = solverTP.solve(state);
+
+    CHECK( resumedTP.succeeded() );
+    CHECK( resumedTP.iterations() < resultTP.iterations() );
+
+    // The TP+pH solver should also resume from its own saved Optima::State
+    const auto resumedTPpH = solverTPpH.solve(state, conditions);
+
+    CHECK( resumedTPpH.succeeded() );
+    CHECK( resumedTPpH.iterations() < resultTP.iterations() );
+}
+
+TEST_CASE("Testing EquilibriumSolver with sensitivity derivatives for selected inputs", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(50.0, "celsius");
+    conditions.pressure(10.0, "bar");
+    conditions.pH(4.0);
+
+    ChemicalState state(system);
+    state.set("H2O", 55.0, "mol");
+    state.set("NaCl", 0.1, "mol");
+
+    EquilibriumSolver solver(specs);
+
+    REQUIRE( solver.solve(state, conditions).succeeded() );
+
+    EquilibriumSensitivity full;
+    REQUIRE( solver.solve(state, full, conditions).succeeded() );
+
+    const Indices ics = { 0, 2 };
+
+    EquilibriumSensitivity selected(specs, {"T", "pH"}, ics);
+
+    CHECK( selected.selective() );
+    CHECK( selected.indicesSelectedInputs() == Indices{0, 2} );
+
+    REQUIRE( solver.solve(state, selected, conditions).succeeded() );
+
+    CHECK( selected.dndw("T").isApprox(full.dndw("T")) );
+    CHECK( selected.dndw("pH").isApprox(full.dndw("pH")) );
+    CHECK( selected.dndw("P").isZero() );
+
+    CHECK( selected.dndc()(Eigen::all, ics).isApprox(full.dndc()(Eigen::all, ics)) );
+    CHECK( selected.dndc().col(1).isZero() );
+
+    CHECK( selected.dudw().col(0).isApprox(full.dudw().col(0)) );
+    CHECK( selected.dudc()(Eigen::all, ics).isApprox(full.dudc()(Eigen::all, ics)) );
+
+    // Check the solver returns to computing all sensitivity derivatives when given a non-selective object
+    EquilibriumSensitivity again;
+    REQUIRE( solver.solve(state, again, conditions).succeeded() );
+    CHECK( again.dndw().isApprox(full.dndw()) );
+    CHECK( again.dndc().isApprox(full.dndc()) );
+
+    CHECK_THROWS( EquilibriumSensitivity(specs, {"V"}, {}) );
+}
+
+TEST_CASE("Testing EquilibriumSolver::adjoint", "[EquilibriumSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(50.0, "celsius");
+    conditions.pressure(10.0, "bar");
+    conditions.pH(4.0);
+
+    ChemicalState state(system);
+    state.set("H2O", 55.0, "mol");
+    state.set("NaCl", 0.1, "mol");
+
+    EquilibriumSolver solver(specs);
+
+    EquilibriumSensitivity sensitivity;
+    REQUIRE( solver.solve(state, sensitivity, conditions).succeeded() );
+
+    const auto Nn = system.species().size();
+    const auto Np = specs.numControlVariablesP();
+    const auto Nw = specs.numInputs();
+    const auto Nc = sensitivity.dndc().cols();
+
+    // The objective function f = a'n has derivatives df/dw = a'(dn/dw) and df/dc = a'(dn/dc)
+    const VectorXd a = VectorXd::LinSpaced(Nn, 1.0, 2.0);
+
+    VectorXd dfdw(Nw);
+    VectorXd dfdc(Nc);
+
+    solver.adjoint(state, a, zeros(Np), dfdw, dfdc);
+
+    const VectorXd dfdw_expected = sensitivity.dndw().transpose() * a;
+    const VectorXd dfdc_expected = sensitivity.dndc().transpose() * a;
+
+    CHECK( dfdw.isApprox(dfdw_expected, 1e-6) );
+    CHECK( dfdc.isApprox(dfdc_expected, 1e-6) );
+
+    CHECK_THROWS( solver.adjoint(state, VectorXd(Nn + 1), zeros(Np), dfdw, dfdc) );
 }
@@ -29,6 +29,22 @@
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return the equilibrium solver with fixed temperature and pressure for a chemical system, reused across calls in the current thread.
+auto equilibriumSolverTP(ChemicalSystem const& system) -> EquilibriumSolver&
+{
+    using SystemID = Index;
+    thread_local Map<SystemID, EquilibriumSolver> cache;
+
+    if(auto it = cache.find(system.id()); it != cache.end())
+        return it->second;
+
+    const auto [it, _] = cache.try_emplace(system.id(), EquilibriumSpecs::TP(system));
+    return it->second;
+}
+
+} // namespace
 
 auto equilibrate(ChemicalState& state) -> EquilibriumResult
 {
@@ -78,17 +94,14 @@ auto equilibrate(ChemicalState& state, const EquilibriumRestrictions& restrictio
 {
     EquilibriumOptions opts(options);
 
-    EquilibriumSpecs specs(state.system());
-    specs.temperature();
-    specs.pressure();
+    // The solver for the chemical system is created once per thread; the options are reset below on every call.
+    EquilibriumSolver& solver = equilibriumSolverTP(state.system());
 
-    EquilibriumConditions conditions(specs);
+    EquilibriumConditions conditions(EquilibriumSpecs::TP(state.system()));
     conditions.temperature(state.temperature());
     conditions.pressure(state.pressure());
     conditions.setInitialComponentAmounts(b0);
 
-    EquilibriumSolver solver(specs);
-
     opts.use_ideal_activity_models = true; // force ideal activity models for the first computation
     solver.setOptions(opts);
 
@@ -31,7 +31,8 @@ struct EquilibriumResult;
 /// Perform a chemical equilibrium calculation on a given chemical state.
 /// The calculation is performed with fixed temperature and pressure obtained
 /// from the chemical state, and the chemical system is closed, so chemical
-/// elements and electric charge are conserved.
+/// elements and electric charge are conserved. The equilibrium solver used
+/// for a chemical system is created once per thread and reused in later calls.
 ///@{
 auto equilibrate(ChemicalState& state) -> EquilibriumResult;
 auto equilibrate(ChemicalState& state, const EquilibriumOptions& options) -> EquilibriumResult;
@@ -42,14 +42,102 @@ struct SmartEquilibriumOptions
     /// The relative tolerance used in the acceptance test for the predicted chemical equilibrium state.
     double reltol = 0.005;
 
+    /// The maximum number of iterations used to correct predicted species amounts onto the mass balance constraints (zero means no correction).
+    /// When positive, the species amounts of a first-order Taylor prediction
+    /// are made positive and projected onto the mass balance constraints with
+    /// EquilibriumPredictor::correct before being checked for negative values.
+    /// Predictions that would otherwise be rejected because of negative
+    /// amounts can then be accepted, so that each record covers a larger
+    /// neighbourhood. A corrected prediction is rejected if its relative mass
+    /// balance residual remains above @ref reltol.
+    Index mass_balance_iterations = 0;
+
     /// The absolute tolerance used in the acceptance test for the predicted chemical equilibrium state.
     double abstol = 0.01;
 
+    /// The number of nearest records in a cluster tried first when searching for a record that passes the acceptance test.
+    /// The nearest records are determined from the distance between their
+    /// input vectors (w, c) and that of the new calculation, each entry scaled
+    /// by its value in the first record of the cluster. If none of these records
+    /// pass the acceptance test, the remaining records are tried in the order
+    /// of their usage counts. If zero, only the usage counts are used.
+    Index nearest_neighbors = 0;
+
+    /// The flag indicating if the acceptance tests of all records in a cluster should be performed in a single operation.
+    /// When enabled, the chemical potentials of the primary species predicted
+    /// by all records in a cluster are computed with a single matrix-vector
+    /// product before the records are tested, instead of one product per
+    /// tested record. This is beneficial when many records are usually tested
+    /// before one is accepted, as the products of all records in the cluster
+    /// are always computed. In the batched solve methods of
+    /// SmartEquilibriumSolver, the calculations that start their search in the
+    /// same cluster are evaluated together with a single matrix-matrix product
+    /// (unless the learned data is shared with other solvers).
+    bool packed_acceptance_test = false;
+
+    /// The flag indicating if only the data needed for predictions are kept in the learned records.
+    /// When enabled, the chemical state and the sensitivity derivatives in each
+    /// SmartEquilibriumSolver::Record are left empty, since copies of them are
+    /// already kept in its EquilibriumPredictor object, which is all that is
+    /// needed in the acceptance tests and first-order Taylor predictions. This
+    /// approximately halves the memory used by the learned data.
+    bool compact_records = false;
+
+    /// The flag indicating if the Taylor matrices of the predictors in the learned records are stored in single precision.
+    /// The acceptance tests do not need double precision for these matrices,
+    /// which dominate the memory used by the learned data. When enabled, they
+    /// are stored in single precision instead of a copy of the sensitivity
+    /// derivatives in each EquilibriumPredictor object, while the predictions
+    /// are still accumulated in double precision (see EquilibriumPredictor).
+    /// Combined with @ref compact_records, this approximately halves the memory
+    /// used by the learned data once more. The predicted states differ from
+    /// those with double-precision matrices by relative amounts of order 1e-7.
+    bool single_precision_records = false;
+
+    /// The maximum number of records stored in the learned data (zero means no limit).
+    /// When a learning operation would cause this number to be exceeded, the
+    /// record with the smallest usage count in the learned data is removed
+    /// before the new one is stored. Since all records of a chemical system
+    /// have the same size, this limits the memory used by the learned data.
+    Index max_records = 0;
+
+    /// The number of learning operations after which the records dominated by others are removed from the learned data (zero means never).
+    /// Learning operations often store records just outside the trust region
+    /// of existing ones, so that clusters accumulate near-duplicate records in
+    /// long simulations. Every this many learning operations (counted over all
+    /// solvers sharing the learned data), each record whose reference inputs
+    /// pass the acceptance test of a more used record in its cluster is
+    /// removed (see SmartEquilibriumSolver::pruneLearningData). This keeps the
+    /// search cost and memory of the learned data from growing indefinitely, at
+    /// the expense of occasional learning operations that the removed records
+    /// would have avoided.
+    Index prune_interval = 0;
+
     /// The step length used to discretize temperature in the temperature-pressure space when storing learned calculations (in K).
     double temperature_step = 10.0;
 
     /// The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).
     double pressure_step = 25.0e+5;
+
+    /// The maximum number of records in a temperature-pressure grid cell before it is split into four cells (zero means cells are never split).
+    /// A cell of the grid, initially of size @ref temperature_step by @ref
+    /// pressure_step, is split into four cells of half its temperature and
+    /// pressure intervals when a learning operation causes its number of records
+    /// to exceed this value. Its records are then distributed among the new
+    /// cells according to their temperatures and pressures. This permits finer
+    /// cells in the temperature-pressure regions where most calculations are
+    /// performed, and coarser cells elsewhere.
+    Index max_cell_records = 0;
+
+    /// The maximum number of times a temperature-pressure grid cell can be successively split (see @ref max_cell_records).
+    Index max_cell_splits = 6;
+
+    /// The flag indicating if the neighbor temperature-pressure grid cells should be searched when no record in the cell of the new calculation is accepted.
+    /// The neighbor cells are those containing the temperatures and pressures
+    /// displaced by the temperature and pressure intervals of the cell of the new
+    /// calculation. The cells sharing an edge with it are searched before those
+    /// sharing a corner.
+    bool search_neighbor_cells = false;
 };
 
 } // namespace Reaktoro
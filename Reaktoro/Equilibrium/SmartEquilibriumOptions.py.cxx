@@ -30,6 +30,18 @@ void exportSmartEquilibriumOptions(py::module& m)
         .def_readwrite("reltol_negative_amounts", &SmartEquilibriumOptions::reltol_negative_amounts, "The relative tolerance for negative species amounts when predicting with first-order Taylor approximation.")
         .def_readwrite("reltol", &SmartEquilibriumOptions::reltol, "The relative tolerance used in the acceptance test for the predicted chemical equilibrium state.")
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol, "The absolute tolerance used in the acceptance test for the predicted chemical equilibrium state.")
+        .def_readwrite("packed_acceptance_test", &SmartEquilibriumOptions::packed_acceptance_test, "The flag indicating if the acceptance tests of all records in a cluster should be performed in a single operation.")
+        .def_readwrite("mass_balance_iterations", &SmartEquilibriumOptions::mass_balance_iterations, "The maximum number of iterations used to correct predicted species amounts onto the mass balance constraints (zero means no correction).")
+        .def_readwrite("compact_records", &SmartEquilibriumOptions::compact_records, "The flag indicating if only the data needed for predictions are kept in the learned records.")
+        .def_readwrite("single_precision_records", &SmartEquilibriumOptions::single_precision_records, "The flag indicating if the Taylor matrices of the predictors in the learned records are stored in single precision.")
+        .def_readwrite("max_records", &SmartEquilibriumOptions::max_records, "The maximum number of records stored in the learned data (zero means no limit).")
+        .def_readwrite("prune_interval", &SmartEquilibriumOptions::prune_interval, "The number of learning operations after which the records dominated by others are removed from the learned data (zero means never).")
+        .def_readwrite("nearest_neighbors", &SmartEquilibriumOptions::nearest_neighbors, "The number of nearest records in a cluster tried first when searching for a record that passes the acceptance test.")
+        .def_readwrite("temperature_step", &SmartEquilibriumOptions::temperature_step, "The step length used to discretize temperature in the temperature-pressure space when storing learned calculations (in K).")
+        .def_readwrite("pressure_step", &SmartEquilibriumOptions::pressure_step, "The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).")
+        .def_readwrite("max_cell_records", &SmartEquilibriumOptions::max_cell_records, "The maximum number of records in a temperature-pressure grid cell before it is split into four cells (zero means cells are never split).")
+        .def_readwrite("max_cell_splits", &SmartEquilibriumOptions::max_cell_splits, "The maximum number of times a temperature-pressure grid cell can be successively split.")
+        .def_readwrite("search_neighbor_cells", &SmartEquilibriumOptions::search_neighbor_cells, "The flag indicating if the neighbor temperature-pressure grid cells should be searched when no record in the cell of the new calculation is accepted.")
         ;
 }
 
@@ -17,6 +17,9 @@
 
 #include "SmartEquilibriumResult.hpp"
 
+// Reaktoro includes
+#include <Reaktoro/Common/Table.hpp>
+
 namespace Reaktoro {
 
 auto SmartEquilibriumTiming::operator+=(const SmartEquilibriumTiming& other) -> SmartEquilibriumTiming&
@@ -40,9 +43,11 @@ auto SmartEquilibriumTiming::operator+=(const SmartEquilibriumTiming& other) ->
 auto SmartEquilibriumResultDuringPrediction::operator+=(const SmartEquilibriumResultDuringPrediction& other) -> SmartEquilibriumResultDuringPrediction&
 {
     accepted = other.accepted;
+    surrogate = other.surrogate;
     failed_with_species = other.failed_with_species;
     failed_with_amount = other.failed_with_amount;
     failed_with_chemical_potential = other.failed_with_chemical_potential;
+    records_tested += other.records_tested;
 
     return *this;
 }
@@ -59,7 +64,75 @@ auto SmartEquilibriumResult::operator+=(const SmartEquilibriumResult& other) ->
     prediction += other.prediction;
     learning += other.learning;
     timing   += other.timing;
+    allocations += other.allocations;
 
     return *this;
 }
+
+namespace {
+
+/// Return the ratio of two numbers, or zero if the denominator is zero.
+auto ratio(double num, double den) -> double
+{
+    return den != 0.0 ? num / den : 0.0;
+}
+
+} // namespace
+
+auto SmartEquilibriumStatistics::hitRate() const -> double
+{
+    return ratio(predictions, calculations);
+}
+
+auto SmartEquilibriumStatistics::missRate() const -> double
+{
+    return ratio(learnings, calculations);
+}
+
+auto SmartEquilibriumStatistics::averageRecordsTestedBeforeAcceptance() const -> double
+{
+    return ratio(records_tested_accepted, predictions);
+}
+
+auto SmartEquilibriumStatistics::averageRecordsPerCell() const -> double
+{
+    return ratio(records, cells);
+}
+
+auto SmartEquilibriumStatistics::averageRecordsPerCluster() const -> double
+{
+    return ratio(records, clusters);
+}
+
+auto SmartEquilibriumStatistics::learningTimeShare() const -> double
+{
+    return ratio(timing.learning, timing.solve);
+}
+
+auto SmartEquilibriumStatistics::table() const -> Table
+{
+    Table table;
+    table.column("Calculations") << calculations;
+    table.column("Predictions") << predictions;
+    table.column("Learnings") << learnings;
+    table.column("HitRate") << hitRate();
+    table.column("MissRate") << missRate();
+    table.column("RecordsTestedAccepted") << records_tested_accepted;
+    table.column("RecordsTestedRejected") << records_tested_rejected;
+    table.column("AverageRecordsTestedBeforeAcceptance") << averageRecordsTestedBeforeAcceptance();
+    table.column("Cells") << cells;
+    table.column("Clusters") << clusters;
+    table.column("Records") << records;
+    table.column("AverageRecordsPerCell") << averageRecordsPerCell();
+    table.column("AverageRecordsPerCluster") << averageRecordsPerCluster();
+    table.column("MaxRecordsPerCell") << max_records_per_cell;
+    table.column("MaxRecordsPerCluster") << max_records_per_cluster;
+    table.column("Memory") << memory;
+    table.column("TimeSolve") << timing.solve;
+    table.column("TimeLearning") << timing.learning;
+    table.column("TimePrediction") << timing.prediction;
+    table.column("LearningTimeShare") << learningTimeShare();
+    return table;
+}
+
 } // namespace Reaktoro
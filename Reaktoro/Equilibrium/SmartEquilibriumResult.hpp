@@ -23,6 +23,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class Table;
+
 /// Used to provide timing information of the operations during a smart chemical equilibrium calculation.
 struct SmartEquilibriumTiming
 {
@@ -73,6 +76,9 @@ struct SmartEquilibriumResultDuringPrediction
     /// The indication whether the smart equilibrium prediction was accepted.
     bool accepted = false;
 
+    /// The indication whether the accepted prediction was produced by the surrogate model of the solver (see SmartEquilibriumSolver::setSurrogate).
+    bool surrogate = false;
+
     /// The name of the species that caused the smart approximation to fail.
     String failed_with_species;
 
@@ -82,6 +88,9 @@ struct SmartEquilibriumResultDuringPrediction
     /// The amount of the species that caused the smart approximation to fail.
     double failed_with_chemical_potential;
 
+    /// The number of records whose predictions were tested for acceptance (including the accepted one, if any).
+    Index records_tested = 0;
+
     // Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResultDuringPrediction& other) -> SmartEquilibriumResultDuringPrediction&;
 };
@@ -124,8 +133,82 @@ struct SmartEquilibriumResult
     /// The timing information of the operations during a smart chemical equilibrium calculation.
     SmartEquilibriumTiming timing;
 
+    /// The heap allocations performed during the smart chemical equilibrium calculation (only counted if AllocationCounter::supported).
+    AllocationStats allocations;
+
     /// Self addition assignment to accumulate results.
     auto operator+=(const SmartEquilibriumResult& other) -> SmartEquilibriumResult&;
 };
 
+/// Used to provide cumulative statistics of the smart chemical equilibrium calculations of a SmartEquilibriumSolver object.
+/// The counters and timings accumulate the calculations performed by a
+/// solver since its construction or the last reset of its statistics. The
+/// remaining members describe the learned data at the moment the statistics
+/// are requested, which include the records learned by other solvers if this
+/// data is shared among them.
+/// @see SmartEquilibriumSolver::statistics
+struct SmartEquilibriumStatistics
+{
+    /// The number of smart chemical equilibrium calculations performed.
+    Index calculations = 0;
+
+    /// The number of calculations in which the predicted chemical equilibrium state was accepted.
+    Index predictions = 0;
+
+    /// The number of calculations in which a learning operation was performed.
+    Index learnings = 0;
+
+    /// The number of records tested in the calculations whose predictions were accepted.
+    Index records_tested_accepted = 0;
+
+    /// The number of records tested in the calculations whose predictions were rejected.
+    Index records_tested_rejected = 0;
+
+    /// The cumulative timing information of the calculations.
+    SmartEquilibriumTiming timing;
+
+    /// The number of temperature-pressure cells without subcells in the learned data.
+    Index cells = 0;
+
+    /// The number of clusters in the learned data.
+    Index clusters = 0;
+
+    /// The number of records in the learned data.
+    Index records = 0;
+
+    /// The largest number of records in a temperature-pressure cell without subcells.
+    Index max_records_per_cell = 0;
+
+    /// The largest number of records in a cluster.
+    Index max_records_per_cluster = 0;
+
+    /// The approximate memory used by the learned data (in bytes).
+    /// This accounts for the species amounts and chemical properties of the
+    /// stored states, their sensitivity derivatives, and the data packed in the
+    /// clusters for the acceptance tests, but not for the overhead of the
+    /// containers storing them.
+    Index memory = 0;
+
+    /// Return the fraction of calculations whose predictions were accepted.
+    auto hitRate() const -> double;
+
+    /// Return the fraction of calculations whose predictions were rejected.
+    auto missRate() const -> double;
+
+    /// Return the average number of records tested in the calculations whose predictions were accepted.
+    auto averageRecordsTestedBeforeAcceptance() const -> double;
+
+    /// Return the average number of records in a temperature-pressure cell without subcells.
+    auto averageRecordsPerCell() const -> double;
+
+    /// Return the average number of records in a cluster.
+    auto averageRecordsPerCluster() const -> double;
+
+    /// Return the fraction of the time spent in the calculations that was spent in learning operations.
+    auto learningTimeShare() const -> double;
+
+    /// Return a table with a single row containing these statistics.
+    auto table() const -> Table;
+};
+
 } // namespace Reaktoro
@@ -19,6 +19,7 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 using namespace Reaktoro;
 
@@ -44,9 +45,11 @@ void exportSmartEquilibriumResult(py::module& m)
     py::class_<SmartEquilibriumResultDuringPrediction>(m, "SmartEquilibriumResultDuringPrediction")
         .def(py::init<>())
         .def_readwrite("accepted", &SmartEquilibriumResultDuringPrediction::accepted)
+        .def_readwrite("surrogate", &SmartEquilibriumResultDuringPrediction::surrogate)
         .def_readwrite("failed_with_species", &SmartEquilibriumResultDuringPrediction::failed_with_species)
         .def_readwrite("failed_with_amount", &SmartEquilibriumResultDuringPrediction::failed_with_amount)
         .def_readwrite("failed_with_chemical_potential", &SmartEquilibriumResultDuringPrediction::failed_with_chemical_potential)
+        .def_readwrite("records_tested", &SmartEquilibriumResultDuringPrediction::records_tested)
         .def(py::self += py::self)
         ;
 
@@ -66,5 +69,29 @@ void exportSmartEquilibriumResult(py::module& m)
         .def_readwrite("prediction", &SmartEquilibriumResult::prediction)
         .def_readwrite("learning", &SmartEquilibriumResult::learning)
         .def_readwrite("timing", &SmartEquilibriumResult::timing)
+        .def_readwrite("allocations", &SmartEquilibriumResult::allocations)
+        ;
+
+    py::class_<SmartEquilibriumStatistics>(m, "SmartEquilibriumStatistics")
+        .def(py::init<>())
+        .def_readwrite("calculations", &SmartEquilibriumStatistics::calculations, "The number of smart chemical equilibrium calculations performed.")
+        .def_readwrite("predictions", &SmartEquilibriumStatistics::predictions, "The number of calculations in which the predicted chemical equilibrium state was accepted.")
+        .def_readwrite("learnings", &SmartEquilibriumStatistics::learnings, "The number of calculations in which a learning operation was performed.")
+        .def_readwrite("records_tested_accepted", &SmartEquilibriumStatistics::records_tested_accepted, "The number of records tested in the calculations whose predictions were accepted.")
+        .def_readwrite("records_tested_rejected", &SmartEquilibriumStatistics::records_tested_rejected, "The number of records tested in the calculations whose predictions were rejected.")
+        .def_readwrite("timing", &SmartEquilibriumStatistics::timing, "The cumulative timing information of the calculations.")
+        .def_readwrite("cells", &SmartEquilibriumStatistics::cells, "The number of temperature-pressure cells without subcells in the learned data.")
+        .def_readwrite("clusters", &SmartEquilibriumStatistics::clusters, "The number of clusters in the learned data.")
+        .def_readwrite("records", &SmartEquilibriumStatistics::records, "The number of records in the learned data.")
+        .def_readwrite("max_records_per_cell", &SmartEquilibriumStatistics::max_records_per_cell, "The largest number of records in a temperature-pressure cell without subcells.")
+        .def_readwrite("max_records_per_cluster", &SmartEquilibriumStatistics::max_records_per_cluster, "The largest number of records in a cluster.")
+        .def_readwrite("memory", &SmartEquilibriumStatistics::memory, "The approximate memory used by the learned data (in bytes).")
+        .def("hitRate", &SmartEquilibriumStatistics::hitRate, "Return the fraction of calculations whose predictions were accepted.")
+        .def("missRate", &SmartEquilibriumStatistics::missRate, "Return the fraction of calculations whose predictions were rejected.")
+        .def("averageRecordsTestedBeforeAcceptance", &SmartEquilibriumStatistics::averageRecordsTestedBeforeAcceptance, "Return the average number of records tested in the calculations whose predictions were accepted.")
+        .def("averageRecordsPerCell", &SmartEquilibriumStatistics::averageRecordsPerCell, "Return the average number of records in a temperature-pressure cell without subcells.")
+        .def("averageRecordsPerCluster", &SmartEquilibriumStatistics::averageRecordsPerCluster, "Return the average number of records in a cluster.")
+        .def("learningTimeShare", &SmartEquilibriumStatistics::learningTimeShare, "Return the fraction of the time spent in the calculations that was spent in learning operations.")
+        .def("table", &SmartEquilibriumStatistics::table, "Return a table with a single row containing these statistics.")
         ;
 }
@@ -17,9 +17,28 @@
 
 #include "SmartEquilibriumSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <shared_mutex>
+
+// Optima includes
+#include <Optima/State.hpp>
+
 // Reaktoro includes
+#include <Reaktoro/Common/AllocationCounter.hpp>
+#include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -45,357 +64,2129 @@ auto sround(double num, double step) -> long
     return round(num / step) * step;
 }
 
+/// Return the input vector (w, c) of a chemical equilibrium state used for nearest neighbor searches.
+auto inputVector(VectorXdConstRef w, VectorXdConstRef c) -> VectorXd
+{
+    VectorXd x(w.size() + c.size());
+    x << w, c;
+    return x;
+}
+
+/// Return the hash of the pattern of reactivity restrictions in a chemical equilibrium calculation, or zero if there are no restrictions.
+/// The pattern consists of the indices of the species whose amounts
+/// cannot increase or decrease (with or without given bounds), but not
+/// the values of these bounds.
+auto restrictionsLabel(EquilibriumRestrictions const& restrictions) -> Index
+{
+    auto sorted = [](Indices indices) { std::sort(indices.begin(), indices.end()); return indices; };
+
+    auto keys = [](Map<Index, double> const& map) { Indices indices; for(auto const& [i, val] : map) indices.push_back(i); return indices; };
+
+    const auto ia = sorted(Indices(restrictions.speciesCannotIncrease().begin(), restrictions.speciesCannotIncrease().end()));
+    const auto ib = sorted(Indices(restrictions.speciesCannotDecrease().begin(), restrictions.speciesCannotDecrease().end()));
+    const auto ic = sorted(keys(restrictions.speciesCannotIncreaseAbove()));
+    const auto id = sorted(keys(restrictions.speciesCannotDecreaseBelow()));
+
+    if(ia.empty() && ib.empty() && ic.empty() && id.empty())
+        return 0;
+
+    return hashCombine(hashVector(ia), hashVector(ib), hashVector(ic), hashVector(id));
+}
+
+/// Return the lower bounds of the species amounts imposed by reactivity restrictions for given initial species amounts (`-inf` for species without lower bounds).
+/// The lower bounds are not below `epsilon`, as in EquilibriumSetup::assembleLowerBoundsVector.
+auto restrictedLowerBounds(EquilibriumRestrictions const& restrictions, ArrayXdConstRef n0, double epsilon) -> ArrayXd
+{
+    ArrayXd nlower = ArrayXd::Constant(n0.size(), -inf);
+    for(auto [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = std::max(val, epsilon);
+    for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = std::max(n0[i], epsilon);
+    return nlower;
+}
+
+/// Return the upper bounds of the species amounts imposed by reactivity restrictions for given initial species amounts (`inf` for species without upper bounds).
+/// The upper bounds are not below `epsilon`, as in EquilibriumSetup::assembleUpperBoundsVector.
+auto restrictedUpperBounds(EquilibriumRestrictions const& restrictions, ArrayXdConstRef n0, double epsilon) -> ArrayXd
+{
+    ArrayXd nupper = ArrayXd::Constant(n0.size(), inf);
+    for(auto [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = std::max(val, epsilon);
+    for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = std::max(n0[i], epsilon);
+    return nupper;
+}
+
+/// The identifier written at the beginning of files with learned data of SmartEquilibriumSolver objects.
+const char databaseFileSignature[8] = {'R', 'K', 'T', 'S', 'M', 'E', 'Q', 'S'};
+
+/// The format version of files with learned data of SmartEquilibriumSolver objects.
+const std::uint64_t databaseFileVersion = 4;
+
+/// Write a value of fixed size into a binary stream.
+template<typename T>
+auto writeValue(std::ostream& out, T const& value) -> void
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Read a value of fixed size from a binary stream.
+template<typename T>
+auto readValue(std::istream& in) -> T
+{
+    T value = {};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    errorif(!in, "Could not read the learned data of SmartEquilibriumSolver from the given file, which is either corrupted or truncated.");
+    return value;
+}
+
+/// Write the size of a container into a binary stream.
+auto writeSize(std::ostream& out, Index size) -> void
+{
+    writeValue<std::uint64_t>(out, size);
+}
+
+/// Read the size of a container from a binary stream.
+auto readSize(std::istream& in) -> Index
+{
+    return readValue<std::uint64_t>(in);
+}
+
+/// Write a string into a binary stream.
+auto writeString(std::ostream& out, String const& str) -> void
+{
+    writeSize(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+/// Read a string from a binary stream.
+auto readString(std::istream& in) -> String
+{
+    String str(readSize(in), '\0');
+    in.read(str.data(), str.size());
+    errorif(!in, "Could not read the learned data of SmartEquilibriumSolver from the given file, which is either corrupted or truncated.");
+    return str;
+}
+
+/// Write a list of strings into a binary stream.
+auto writeStrings(std::ostream& out, Strings const& strs) -> void
+{
+    writeSize(out, strs.size());
+    for(auto const& str : strs)
+        writeString(out, str);
+}
+
+/// Read a list of strings from a binary stream.
+auto readStrings(std::istream& in) -> Strings
+{
+    Strings strs(readSize(in));
+    for(auto& str : strs)
+        str = readString(in);
+    return strs;
+}
+
+/// Write a contiguous array of fixed size values into a binary stream (its size first).
+template<typename T>
+auto writeData(std::ostream& out, T const* data, Index size) -> void
+{
+    writeSize(out, size);
+    out.write(reinterpret_cast<const char*>(data), size * sizeof(T));
+}
+
+/// Write an array of floating-point numbers into a binary stream.
+auto writeArray(std::ostream& out, ArrayXdConstRef const& array) -> void
+{
+    const ArrayXd tmp = array; // ensure contiguous storage
+    writeData(out, tmp.data(), tmp.size());
+}
+
+/// Read an array of floating-point numbers from a binary stream.
+auto readArray(std::istream& in) -> ArrayXd
+{
+    ArrayXd array(readSize(in));
+    in.read(reinterpret_cast<char*>(array.data()), array.size() * sizeof(double));
+    errorif(!in, "Could not read the learned data of SmartEquilibriumSolver from the given file, which is either corrupted or truncated.");
+    return array;
+}
+
+/// Write an array of integers into a binary stream.
+auto writeArrayXl(std::ostream& out, ArrayXlConstRef const& array) -> void
+{
+    writeSize(out, array.size());
+    for(auto i = 0; i < array.size(); ++i)
+        writeValue<std::int64_t>(out, array[i]);
+}
+
+/// Read an array of integers from a binary stream.
+auto readArrayXl(std::istream& in) -> ArrayXl
+{
+    ArrayXl array(readSize(in));
+    for(auto i = 0; i < array.size(); ++i)
+        array[i] = readValue<std::int64_t>(in);
+    return array;
+}
+
+/// Write a matrix of floating-point numbers into a binary stream (its rows and columns first, then its entries in column-major order).
+auto writeMatrix(std::ostream& out, MatrixXdConstRef const& matrix) -> void
+{
+    const MatrixXd tmp = matrix; // ensure contiguous storage
+    writeSize(out, tmp.rows());
+    writeData(out, tmp.data(), tmp.size());
+}
+
+/// Read a matrix of floating-point numbers from a binary stream.
+auto readMatrix(std::istream& in) -> MatrixXd
+{
+    const auto rows = readSize(in);
+    const auto size = readSize(in);
+    errorif((rows == 0 && size != 0) || (rows != 0 && size % rows != 0), "Could not read the learned data of SmartEquilibriumSolver from the given file, which is corrupted.");
+    MatrixXd matrix(rows, rows ? size / rows : 0);
+    in.read(reinterpret_cast<char*>(matrix.data()), size * sizeof(double));
+    errorif(!in, "Could not read the learned data of SmartEquilibriumSolver from the given file, which is either corrupted or truncated.");
+    return matrix;
+}
+
+/// Write a list of indices into a binary stream.
+auto writeIndices(std::ostream& out, Deque<Index> const& indices) -> void
+{
+    writeSize(out, indices.size());
+    for(auto i : indices)
+        writeValue<std::uint64_t>(out, i);
+}
+
+/// Read a list of indices from a binary stream.
+auto readIndices(std::istream& in) -> Deque<Index>
+{
+    Deque<Index> indices(readSize(in));
+    for(auto& i : indices)
+        i = readValue<std::uint64_t>(in);
+    return indices;
+}
+
+/// Write a priority queue into a binary stream.
+auto writePriorityQueue(std::ostream& out, PriorityQueue const& queue) -> void
+{
+    writeIndices(out, queue.priorities());
+    writeIndices(out, queue.order());
+}
+
+/// Read a priority queue from a binary stream.
+auto readPriorityQueue(std::istream& in) -> PriorityQueue
+{
+    const auto priorities = readIndices(in);
+    const auto order = readIndices(in);
+    errorif(priorities.size() != order.size(), "Could not read the learned data of SmartEquilibriumSolver from the given file, which is corrupted.");
+    return PriorityQueue::withInitialPrioritiesAndOrder(priorities, order);
+}
+
+/// Write the clusters reached from a starting cluster and their usage counts into a binary stream.
+auto writeTransitions(std::ostream& out, Pairs<Index, Index> const& transitions) -> void
+{
+    writeSize(out, transitions.size());
+    for(auto const& [jcluster, count] : transitions)
+    {
+        writeValue<std::uint64_t>(out, jcluster);
+        writeValue<std::uint64_t>(out, count);
+    }
+}
+
+/// Read the clusters reached from a starting cluster and their usage counts from a binary stream.
+auto readTransitions(std::istream& in) -> Pairs<Index, Index>
+{
+    Pairs<Index, Index> transitions(readSize(in));
+    for(auto& [jcluster, count] : transitions)
+    {
+        jcluster = readValue<std::uint64_t>(in);
+        count = readValue<std::uint64_t>(in);
+    }
+    return transitions;
+}
+
+/// Return the number of entries in the sensitivity matrices of an EquilibriumSensitivity object.
+auto sensitivitySize(EquilibriumSensitivity const& sensitivity) -> Index
+{
+    return sensitivity.dndw().size() + sensitivity.dpdw().size() + sensitivity.dqdw().size() + sensitivity.dudw().size()
+         + sensitivity.dndc().size() + sensitivity.dpdc().size() + sensitivity.dqdc().size() + sensitivity.dudc().size();
+}
+
 } // namespace detail
 
 struct SmartEquilibriumSolver::Impl
 {
+    /// The learned input-output data that can be shared among SmartEquilibriumSolver objects.
+    struct Database
+    {
+        /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
+        SmartEquilibriumSolver::Grid grid;
+
+        /// The lock allowing concurrent searches in the grid and exclusive updates of its records and priorities.
+        std::shared_mutex mutex;
+
+        /// The number of learning operations stored in the grid, used to prune its records periodically (see SmartEquilibriumOptions::prune_interval).
+        Index learnings = 0;
+
+        /// The non-empty clusters in the grid ordered by the smallest usage count of their records, used to find the least used record when SmartEquilibriumOptions::max_records is positive.
+        /// The usage counts in this set may be smaller than the current ones,
+        /// since the priorities of the records are incremented without updating
+        /// it, in which case they are updated when found at its beginning.
+        std::set<Pair<Index, Cluster*>> usage;
+
+        /// The usage count of each cluster in #usage.
+        Map<Cluster const*, Index> usagecounts;
+
+        /// The number of records in the grid, or `Index(-1)` if #usage needs to be collected again from the grid (e.g., after cells are split or records are pruned).
+        Index numrecords = Index(-1);
+    };
+
     EquilibriumSolver solver;
 
     EquilibriumSensitivity sensitivity;
 
     EquilibriumConditions conditions;
 
+    /// The auxiliary equilibrium restrictions used whenever none are given in the solve methods.
+    EquilibriumRestrictions restrictions;
+
     SmartEquilibriumOptions options;
 
     SmartEquilibriumResult result;
 
-    /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
-    SmartEquilibriumSolver::Grid grid;
+    /// The cumulative statistics of the smart equilibrium calculations performed so far (without the snapshot of the learned data).
+    SmartEquilibriumStatistics statistics;
+
+    /// The learned input-output data, possibly shared with other SmartEquilibriumSolver objects.
+    SharedPtr<Database> database;
+
+    /// The conservation matrices of the species amounts *n* and the control variables *q* and *p* used to correct predictions.
+    MatrixXd An, Aq, Ap;
+
+    /// The names of the *w* input variables in the chemical equilibrium specifications.
+    Strings wnames;
+
+    /// The indices of temperature and pressure among the *w* input variables (`Index(-1)` if unknown).
+    Index iTw, iPw;
+
+    /// The surrogate model used to predict chemical equilibrium states when no learned record produces an accepted prediction (empty if none).
+    SmartEquilibriumSurrogate surrogate;
+
+    /// The pool of worker threads used in batched smart equilibrium calculations (created on demand).
+    SharedPtr<ThreadPool> pool;
+
+    /// The copies of this solver, sharing its learned data, used by each worker thread in batched smart equilibrium calculations (created on demand, each in the thread of its worker).
+    Vec<SharedPtr<Impl>> workers;
+
+    /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
+    Impl(EquilibriumSpecs const& specs)
+    : solver(specs), sensitivity(specs), conditions(specs), restrictions(specs.system()), database(std::make_shared<Database>()),
+      An(specs.assembleConservationMatrixN()), Aq(specs.assembleConservationMatrixQ()), Ap(specs.assembleConservationMatrixP()),
+      wnames(specs.namesInputs()), iTw(specs.indexTemperatureAmongInputVariables()), iPw(specs.indexPressureAmongInputVariables())
+    {
+        // Initialize the equilibrium solver with the default options
+        setOptions(options);
+    }
+
+    /// Construct a copy of a SmartEquilibriumSolver::Impl object (with its own copy of the learned data).
+    Impl(Impl const& other)
+    : solver(other.solver), sensitivity(other.sensitivity), conditions(other.conditions), restrictions(other.restrictions), options(other.options), result(other.result), statistics(other.statistics), database(std::make_shared<Database>()),
+      An(other.An), Aq(other.Aq), Ap(other.Ap), wnames(other.wnames), iTw(other.iTw), iPw(other.iPw), surrogate(other.surrogate)
+    {
+        std::shared_lock<std::shared_mutex> lock(other.database->mutex);
+        database->grid = other.database->grid;
+    }
+
+    /// Construct a copy of a SmartEquilibriumSolver::Impl object sharing given learned data (used as a worker in batched calculations).
+    Impl(Impl const& other, SharedPtr<Database> const& shared)
+    : solver(other.solver), sensitivity(other.sensitivity), conditions(other.conditions), restrictions(other.restrictions), options(other.options), database(shared),
+      An(other.An), Aq(other.Aq), Ap(other.Ap), wnames(other.wnames), iTw(other.iTw), iPw(other.iPw), surrogate(other.surrogate)
+    {}
+
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS
+    //
+    //=================================================================================================================
+
+    auto solve(ChemicalState& state) -> SmartEquilibriumResult
+    {
+        return solve(state, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, conditions, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
+    {
+        return solve(state, conditions, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        return solve(state, nullptr, conditions, restrictions);
+    }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS WITH SENSITIVITY CALCULATION
+    //
+    //=================================================================================================================
+
+    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
+    {
+        return solve(state, sensitivity, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, sensitivity, conditions, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
+    {
+        return solve(state, sensitivity, conditions, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        return solve(state, &sensitivity, conditions, restrictions);
+    }
+
+    /// Perform a smart chemical equilibrium calculation, with sensitivity derivatives collected in `sensitivity` if not null.
+    auto solve(ChemicalState& state, EquilibriumSensitivity* sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::solve");
+
+        tic(SOLVE_STEP)
+
+        // Reset the result of the last smart equilibrium calculation
+        result = {};
+
+        AllocationCounter allocations;
+
+        // Perform a smart prediction of the chemical state (and collect the sensitivity derivatives of the record used)
+        timeit( predict(state, conditions, restrictions, sensitivity), result.timing.prediction= )
+
+        // Use the surrogate model, if any, when no learned record produced an accepted prediction
+        if(!result.prediction.accepted && surrogate && sensitivity == nullptr && detail::restrictionsLabel(restrictions) == 0)
+            timeit( predictWithSurrogate(state, conditions), result.timing.prediction+= )
+
+        // Perform a learning step if the smart prediction is not satisfactory
+        if(!result.prediction.accepted)
+        {
+            timeit( learn(state, conditions, restrictions), result.timing.learning= )
+            if(sensitivity)
+                *sensitivity = this->sensitivity;
+        }
+
+        result.timing.solve = toc(SOLVE_STEP);
+
+        result.allocations = allocations.stats();
+
+        accumulateStatistics();
+
+        return result;
+    }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR BATCHES OF CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    auto solve(Vec<ChemicalState>& states) -> Vec<SmartEquilibriumResult>
+    {
+        Vec<EquilibriumConditions> conditions(states.size(), this->conditions);
+        for(auto k = 0; k < states.size(); ++k)
+        {
+            conditions[k].temperature(states[k].temperature());
+            conditions[k].pressure(states[k].pressure());
+        }
+        return solve(states, conditions);
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartEquilibriumResult>
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::solve");
+
+        errorif(conditions.size() != states.size(), "Expecting in batched SmartEquilibriumSolver::solve as many EquilibriumConditions objects as chemical states, but got ", conditions.size(), " and ", states.size(), " respectively.");
+
+        const auto numstates = states.size();
+
+        Vec<SmartEquilibriumResult> results(numstates);
+
+        initializeWorkers();
+
+        // Predict in advance, for all calculations sharing a starting cluster at once, the chemical potentials used in packed acceptance tests (only if the learned data is not shared with other solvers, since these could otherwise change the clusters in the meantime; the workers of this solver only predict until these are used)
+        const auto batched = options.packed_acceptance_test && database.use_count() == 1 + workers.size();
+        const auto packed = batched ? predictPackedChemicalPotentials(states, conditions) : Vec<Pair<Cluster const*, VectorXd>>();
+
+        // Predict the chemical states using the learned records, in parallel since each prediction is cheap compared to a learning operation
+        pool->parallelFor(numstates, [&](Index k, Index iworker)
+        {
+            auto& worker = *workers[iworker];
+            worker.result = {};
+            timeit( worker.predict(states[k], conditions[k], restrictions, nullptr, packed.empty() ? nullptr : &packed[k]), worker.result.timing.prediction= )
+            results[k] = worker.result;
+        });
+
+        // Predict with a single call to the surrogate model, if any, the chemical states for which no learned record produced an accepted prediction
+        Indices irejected;
+        for(auto k = 0; k < numstates; ++k)
+            if(!results[k].prediction.accepted)
+                irejected.push_back(k);
+
+        if(surrogate && !irejected.empty())
+        {
+            tic(SURROGATE_STEP)
+
+            const auto numrejected = irejected.size();
+
+            MatrixXd inputs;
+            for(auto j = 0; j < numrejected; ++j)
+            {
+                const auto k = irejected[j];
+                const VectorXd x = inputVector(states[k], conditions[k]);
+                if(j == 0)
+                    inputs.resize(x.size(), numrejected);
+                inputs.col(j) = x;
+            }
+
+            auto const& [npred, accepted] = surrogate(inputs);
+
+            checkSurrogateOutput(npred, accepted, numrejected);
+
+            for(auto j = 0; j < numrejected; ++j)
+            {
+                const auto k = irejected[j];
+                result = results[k];
+                if(accepted[j])
+                    applySurrogatePrediction(states[k], inputs.col(j), npred.col(j));
+                results[k] = result;
+            }
+
+            // The time spent with the surrogate model is shared equally among the chemical states it was asked to predict
+            const auto elapsed = toc(SURROGATE_STEP) / numrejected;
+            for(auto k : irejected)
+                results[k].timing.prediction += elapsed;
+        }
+
+        // Perform a learning step for the chemical states whose predictions were not satisfactory. These
+        // are distributed among the workers by the work-stealing pool, so that a few expensive learning
+        // operations do not leave the other workers idle. Since each learned record is stored in the
+        // shared learned data as soon as it is computed, the prediction is first tried again, possibly
+        // succeeding now with a record learned in the meantime for a similar chemical state.
+        Indices ilearn;
+        for(auto k = 0; k < numstates; ++k)
+            if(!results[k].prediction.accepted)
+                ilearn.push_back(k);
+
+        pool->parallelFor(ilearn.size(), [&](Index j, Index iworker)
+        {
+            const auto k = ilearn[j];
+            auto& worker = *workers[iworker];
+            worker.result = results[k];
+            timeit( worker.predict(states[k], conditions[k], restrictions, nullptr), worker.result.timing.prediction+= )
+            if(!worker.result.prediction.accepted)
+                timeit( worker.learn(states[k], conditions[k], restrictions), worker.result.timing.learning= )
+            results[k] = worker.result;
+        });
+
+        for(auto k = 0; k < numstates; ++k)
+        {
+            result = results[k];
+            result.timing.solve = result.timing.prediction + result.timing.learning;
+            accumulateStatistics();
+            results[k] = result;
+        }
+
+        return results;
+    }
+
+    auto train(Vec<ChemicalState> const& samples, Vec<EquilibriumConditions> const& conditions) -> Index
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::train");
+
+        errorif(conditions.size() != samples.size(), "Expecting in SmartEquilibriumSolver::train as many EquilibriumConditions objects as chemical states, but got ", conditions.size(), " and ", samples.size(), " respectively.");
+
+        const auto numsamples = samples.size();
+
+        initializeWorkers();
+
+        // Perform the full chemical equilibrium calculations with sensitivity derivatives of all samples in parallel, without storing their records yet
+        Vec<Optional<Record>> records(numsamples);
+
+        pool->parallelFor(numsamples, [&](Index k, Index iworker)
+        {
+            auto& worker = *workers[iworker];
+            ChemicalState state(samples[k]);
+            if(worker.solver.solve(state, worker.sensitivity, conditions[k], restrictions).succeeded())
+                records[k] = worker.createRecord(state, conditions[k], worker.sensitivity);
+        });
+
+        // Store the records in the order of the samples, skipping those whose equilibrium states are already predicted by the records stored before them
+        Index numstored = 0;
+
+        for(auto k = 0; k < numsamples; ++k)
+        {
+            if(!records[k])
+                continue;
+
+            ChemicalState state(samples[k]);
+            predict(state, conditions[k], restrictions, nullptr);
+
+            if(result.prediction.accepted)
+                continue;
+
+            std::unique_lock<std::shared_mutex> lock(database->mutex);
+            storeRecord(*records[k], detail::restrictionsLabel(restrictions));
+            ++numstored;
+        }
+
+        result = {};
+
+        return numstored;
+    }
+
+    auto learnSpeculatively(Vec<ChemicalState> const& candidates, Vec<EquilibriumConditions> const& conditions) -> Index
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::learnSpeculatively");
+
+        Index numstored = 0;
+
+        for(auto k = 0; k < candidates.size(); ++k)
+        {
+            // Skip the candidates already predicted with the learned data, possibly learned in the meantime by the solvers sharing it
+            ChemicalState trial(candidates[k]);
+            predict(trial, conditions[k], restrictions, nullptr);
+
+            if(result.prediction.accepted)
+                continue;
+
+            ChemicalState state(candidates[k]);
+
+            if(!solver.solve(state, sensitivity, conditions[k], restrictions).succeeded())
+                continue;
+
+            const auto record = createRecord(state, conditions[k], sensitivity);
+
+            std::unique_lock<std::shared_mutex> lock(database->mutex);
+            storeRecord(record, detail::restrictionsLabel(restrictions));
+            ++numstored;
+        }
+
+        return numstored;
+    }
+
+    /// Ensure the pool of worker threads and the worker solvers exist for a batched smart equilibrium calculation.
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(options.learning.threads);
+
+        const auto numworkers = pool->numThreads();
+
+        if(workers.size() == numworkers)
+            return;
+
+        workers.clear();
+
+        // Copy this solver in the thread of each worker, so that the memory of its copy is local to the worker on NUMA systems (the learned data is shared by all workers)
+        Vec<SharedPtr<Impl>> copies(numworkers);
+        pool->forEachWorker([&](Index iworker)
+        {
+            copies[iworker] = std::make_shared<Impl>(*this, database);
+        });
+        workers = std::move(copies);
+    }
+
+    /// Accumulate the result of the last smart equilibrium calculation in the cumulative statistics.
+    auto accumulateStatistics() -> void
+    {
+        statistics.calculations += 1;
+        if(result.prediction.accepted)
+        {
+            statistics.predictions += 1;
+            statistics.records_tested_accepted += result.prediction.records_tested;
+        }
+        else
+        {
+            statistics.learnings += 1;
+            statistics.records_tested_rejected += result.prediction.records_tested;
+        }
+        statistics.timing += result.timing;
+    }
+
+    //=================================================================================================================
+    //
+    // LEARN AND PREDICT METHODS
+    //
+    //=================================================================================================================
+
+    /// Perform a learning operation in which a full chemical equilibrium calculation is performed.
+    auto learn(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> void
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::learn");
+
+        //---------------------------------------------------------------------
+        // GIBBS ENERGY MINIMIZATION CALCULATION DURING THE LEARNING PROCESS
+        //---------------------------------------------------------------------
+        tic(EQUILIBRIUM_STEP)
+
+        // Perform a full chemical equilibrium solve with sensitivity derivatives calculation
+        result.learning.solve = solver.solve(state, sensitivity, conditions, restrictions);
+
+        result.timing.learning_solve = toc(EQUILIBRIUM_STEP);
+
+        //---------------------------------------------------------------------
+        // STORAGE STEP DURING THE LEARNING PROCESS
+        //---------------------------------------------------------------------
+        tic(STORAGE_STEP)
+
+        // Create the new record with computed equilibrium state, its sensitivities and predictor
+        const auto record = createRecord(state, conditions, sensitivity);
+
+        // Acquire exclusive access to the learned data, which may be shared with other solvers
+        std::unique_lock<std::shared_mutex> lock(database->mutex);
+
+        storeRecord(record, detail::restrictionsLabel(restrictions));
+
+        // Periodically remove the records dominated by others, so that the size of the learned data levels off in long simulations
+        if(options.prune_interval > 0 && ++database->learnings % options.prune_interval == 0)
+        {
+            pruneRecords(database->grid);
+            database->numrecords = Index(-1); // collect the usage counts of the clusters again when needed
+        }
+
+        result.timing.learning_storage = toc(STORAGE_STEP);
+    }
+
+    /// Store a record in the temperature-pressure cell of the learned data containing its reference temperature and pressure (the database must be locked exclusively by the caller).
+    /// @param record The record of the learned calculation
+    /// @param rlabel The hash number for the pattern of reactivity restrictions in the learned calculation
+    auto storeRecord(Record const& record, Index rlabel) const -> void
+    {
+        auto& grid = database->grid;
+
+        // Remove the least used records if the maximum number of records would be exceeded with the new one
+        if(options.max_records > 0)
+        {
+            collectUsage();
+            while(database->numrecords >= options.max_records && removeLeastUsedRecord());
+        }
+        else database->numrecords = Index(-1); // the usage counts of the clusters are not tracked without a limit on the number of records
+
+        auto const& state = record.predictor.referenceState();
+
+        const auto T = state.temperature().val();
+        const auto P = state.pressure().val();
+
+        // Get a mutable reference to the temperature-pressure cell containing T and P (created if needed)
+        auto& cell = findOrCreateCell(grid, T, P);
+
+        // Generate the hash number for indices of primary species in the state
+        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
+        const auto label = hashVector(iprimary);
+
+        // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species and reactivity restrictions
+        auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label && cluster.restrictionslabel == rlabel));
+
+        // The input vector (w, c) of the learned state used to scale the input vectors of the records in a new cluster
+        const VectorXd x = detail::inputVector(state.equilibrium().w().matrix(), state.equilibrium().c().matrix());
+
+        // The new record, shared by the copies of the learned data
+        const auto recordptr = std::make_shared<Record>(record);
+
+        // If cluster is found, store the new record in it, otherwise, create a new cluster
+        if(icluster < cell.clusters.size())
+        {
+            auto& cluster = cell.clusters[icluster];
+            appendRecord(cluster, recordptr);
+        }
+        else
+        {
+            // Create a new cluster within the current temperature-pressure grid cell
+            Cluster cluster;
+            cluster.iprimary = iprimary;
+            cluster.label = label;
+            cluster.restrictionslabel = rlabel;
+            cluster.scaling = x.cwiseAbs().unaryExpr([](double val) { return val > 0.0 ? val : 1.0; });
+            appendRecord(cluster, recordptr);
+
+            // Append the new cluster and initialize its connectivity and priority
+            cell.clusters.push_back(cluster);
+            cell.connectivity.extend();
+            cell.priority.extend();
+        }
+
+        // Account for the new record, whose usage count is zero, in the usage counts of the clusters
+        if(database->numrecords != Index(-1))
+        {
+            database->numrecords += 1;
+            setUsage(cell.clusters[icluster], 0);
+        }
+
+        // Split the temperature-pressure cell if it now contains more records than allowed (the usage counts of the clusters are then collected again when needed)
+        if(options.max_cell_records > 0)
+        {
+            refineCell(cell);
+            if(!cell.subcells.empty())
+                database->numrecords = Index(-1);
+        }
+    }
+
+    /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
+    /// If `sensitivity` is not null, it is assigned the sensitivity derivatives
+    /// of the record used in an accepted prediction. These are copied while
+    /// the learned data is locked, since the record could otherwise be removed
+    /// by another solver sharing the learned data. If `packed` is not null, it
+    /// contains a cluster and the chemical potentials of the primary species
+    /// predicted by all its records at the new conditions, computed in advance
+    /// for a batch of calculations (see @ref predictPackedChemicalPotentials).
+    auto predict(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions, EquilibriumSensitivity* sensitivity, Pair<Cluster const*, VectorXd> const* packed = nullptr) -> void
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::predict");
+
+        // Set the prediction status to false at the beginning
+        result.prediction.accepted = false;
+
+        // Acquire shared access to the learned data so that other solvers sharing it can search it concurrently
+        std::shared_lock<std::shared_mutex> lock(database->mutex);
+
+        auto& grid = database->grid;
+
+        // Skip prediction operation if no learning data exists yet
+        if(grid.cells.empty())
+            return;
+
+        const auto T = state.temperature().val();
+        const auto P = state.pressure().val();
+
+        // Find an existing temperature-pressure grid cell within which the state temperature/pressure are located
+        auto* homecell = findCell(grid, T, P);
+
+        // Skip prediction operation if no temperature-pressure grid cell with learning data exists and neighbor cells are not searched
+        if(homecell == nullptr && !options.search_neighbor_cells)
+            return;
+
+        const auto wvals = conditions.inputValuesGetOrCompute(state);
+        const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
+
+        const auto w = wvals.cast<double>();
+        const auto c = cvals.cast<double>();
+
+        // Auxiliary vectors used in the lambda function below to avoid repeated memory allocation
+        VectorXd dw;
+        VectorXd dc;
+
+        // The input vector (w, c) of the new calculation used in nearest neighbor searches and packed acceptance tests
+        const VectorXd x = detail::inputVector(w.matrix(), c.matrix());
+
+        // The predicted chemical potentials of the primary species of all records in a cluster (used if options.packed_acceptance_test is true)
+        VectorXd mupacked;
+
+        // The auxiliary ordering of the records in a cluster (the nearest records first if nearest neighbor searches are used)
+        Indices ordering;
+
+        // The function that checks if a record in the grid pass the error test.
+        auto pass_error_test = [&](Cluster const& cluster, Index irecord) mutable -> bool
+        {
+            // The chemical potentials of the primary species at the reference chemical state and their predicted values at the new conditions
+            auto check = [&](VectorXdConstRef mu0, VectorXdConstRef mu1)
+            {
+                return ((mu1 - mu0).array().abs() < options.reltol*mu0.array().abs() + options.abstol).all();
+            };
+
+            // Use the chemical potentials predicted for all records in the cluster at once
+            if(options.packed_acceptance_test)
+            {
+                const auto offset = cluster.offsets[irecord];
+                const auto size = cluster.records[irecord]->predictor.primarySpeciesChemicalPotentialsReference().size();
+                return check(cluster.mu0.segment(offset, size), mupacked.segment(offset, size));
+            }
+
+            // The equilibrium predictor at the reference chemical state
+            auto const& predictor0 = cluster.records[irecord]->predictor;
+
+            // The reference chemical state kept by the predictor (the record's own copy is empty if records are compact)
+            auto const& state0 = predictor0.referenceState();
+
+            const auto w0 = state0.equilibrium().w();
+            const auto c0 = state0.equilibrium().c();
+
+            dw = w - w0;
+            dc = c - c0;
+
+            return check(predictor0.primarySpeciesChemicalPotentialsReference(), predictor0.primarySpeciesChemicalPotentialsPredicted(dw, dc));
+        };
+
+        // Generate the hash number for indices of primary species in the state
+        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
+        const auto label = hashVector(iprimary);
+
+        // Generate the hash number for the pattern of reactivity restrictions (only clusters learned with the same pattern are searched)
+        const auto rlabel = detail::restrictionsLabel(restrictions);
+
+        // The bounds of the species amounts imposed by the reactivity restrictions, determined from the species amounts before the prediction
+        ArrayXd nlower;
+        ArrayXd nupper;
+
+        if(rlabel != 0)
+        {
+            const ArrayXd n0 = state.speciesAmounts().cast<double>();
+            nlower = detail::restrictedLowerBounds(restrictions, n0, options.learning.epsilon);
+            nupper = detail::restrictedUpperBounds(restrictions, n0, options.learning.epsilon);
+        }
+
+        // The function that identifies the starting cluster index in a temperature-pressure cell
+        auto index_starting_cluster = [&](Cell const& cell) -> Index
+        {
+            // If no primary species, then return number of clusters to trigger use of total usage counts of clusters
+            if(iprimary.size() == 0)
+                return cell.clusters.size();
+
+            // Find the index of the cluster with the same set of primary species (search those with highest count first)
+            for(auto icluster : cell.priority.order())
+                if(cell.clusters[icluster].label == label && cell.clusters[icluster].restrictionslabel == rlabel)
+                    return icluster;
+
+            // In no cluster with the same set of primary species if found, then return number of clusters
+            return cell.clusters.size();
+        };
+
+        //---------------------------------------------------------------------
+        // SEARCH STEP DURING THE PREDICTION PROCESS
+        //---------------------------------------------------------------------
+        tic(SEARCH_STEP)
+
+        // The function that searches a temperature-pressure cell for a record whose prediction is accepted
+        auto search_cell = [&](Cell& cell) -> bool
+        {
+            // The index of the starting cluster
+            const auto icluster = index_starting_cluster(cell);
+
+            // Visit all clusters (starting with icluster, then those most often reached from it) until one has a record whose prediction is accepted
+            return cell.connectivity.visit(icluster, [&](Index jcluster) -> bool
+            {
+                // Fetch records from the cluster and the order they have to be processed in
+                auto const& cluster = cell.clusters[jcluster];
+                auto const& records = cluster.records;
+                auto const& records_ordering = cluster.priority.order();
+
+                // Skip the cluster if its records were learned with a different pattern of reactivity restrictions
+                if(cluster.restrictionslabel != rlabel)
+                    return false;
+
+                // Try first the nearest records to the new calculation, then the others in the order based on their priorities
+                ordering.clear();
+                if(options.nearest_neighbors > 0)
+                    ordering = cluster.tree.nearest(x.cwiseQuotient(cluster.scaling), options.nearest_neighbors);
+                const auto numnearest = ordering.size();
+                for(auto irecord : records_ordering)
+                    if(std::find(ordering.begin(), ordering.begin() + numnearest, irecord) == ordering.begin() + numnearest)
+                        ordering.push_back(irecord);
+
+                // Predict the chemical potentials of the primary species of all records in the cluster with a single matrix-vector product (unless computed in advance for a batch of calculations and the cluster has not changed since)
+                if(options.packed_acceptance_test && !records.empty())
+                {
+                    if(packed && packed->first == &cluster && packed->second.size() == cluster.intercepts.size())
+                        mupacked = packed->second;
+                    else
+                    {
+                        mupacked = cluster.intercepts;
+                        mupacked.noalias() += cluster.dmudx * x;
+                    }
+                }
+
+                // Iterate over all records in current cluster (nearest first, if enabled, then using the order based on the priorities)
+                for(auto irecord : ordering)
+                {
+                    auto const& record = *records[irecord];
+
+                    //---------------------------------------------------------------------
+                    // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
+                    //---------------------------------------------------------------------
+                    tic(ERROR_CONTROL_STEP)
+
+                    // Check if the current record passes the error test
+                    result.prediction.records_tested += 1;
+                    const auto success = pass_error_test(cluster, irecord);
+
+                    result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
+
+                    if(success)
+                    {
+                        //---------------------------------------------------------------------
+                        // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
+                        //---------------------------------------------------------------------
+                        tic(TAYLOR_STEP)
+
+                        auto const& predictor0 = record.predictor;
+
+                        predictor0.predict(state, conditions);
+
+                        // Correct the predicted species amounts onto the mass balance constraints (if enabled), rejecting the record if this fails
+                        if(options.mass_balance_iterations > 0)
+                        {
+                            const auto residual = EquilibriumPredictor::correct(state, An, Aq, Ap, options.mass_balance_iterations, options.learning.epsilon);
+                            if(!(residual <= options.reltol))
+                                continue;
+                        }
+
+                        result.timing.prediction_taylor = toc(TAYLOR_STEP);
+
+                        // Check if all projected species amounts are positive or at least very small negative values
+                        auto const& n = state.speciesAmounts();
+
+                        const double nmin = n.minCoeff();
+                        const double nsum = n.sum();
+
+                        if(nmin <= options.reltol_negative_amounts * nsum)
+                            continue; // continue searching for a another record that produces positive amounts only or tolerable negative values
+
+                        // Check if the predicted species amounts respect the bounds imposed by the reactivity restrictions (within the relative tolerance of the acceptance test)
+                        if(rlabel != 0)
+                        {
+                            const ArrayXd npred = n.cast<double>();
+                            if((npred < nlower - options.reltol * nlower.abs()).any() || (npred > nupper + options.reltol * nupper.abs()).any())
+                                continue; // continue searching for another record that produces species amounts within the restricted bounds
+                        }
+
+                        result.timing.prediction_search = toc(SEARCH_STEP);
+
+                        //---------------------------------------------------------------------
+                        // After the search is finished successfully
+                        //---------------------------------------------------------------------
+
+                        // Assign small positive values to all negative amounts
+                        for(auto i = 0; i < n.size(); ++i)
+                            if(n[i] < 0.0)
+                                state.setSpeciesAmount(i, options.learning.epsilon);
+
+                        // Ensure the species amounts are within the bounds imposed by the reactivity restrictions
+                        if(rlabel != 0)
+                        {
+                            const ArrayXd npred = n.cast<double>();
+                            const ArrayXd nbounded = npred.max(nlower).min(nupper);
+                            for(auto i = 0; i < n.size(); ++i)
+                                if(nbounded[i] != npred[i])
+                                    state.setSpeciesAmount(i, nbounded[i]);
+                        }
+
+                        //---------------------------------------------------------------------
+                        // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
+                        //---------------------------------------------------------------------
+                        tic(PRIORITY_UPDATE_STEP)
+
+                        // Keep the record alive while the learned data is unlocked below, since it could be removed in the meantime by another solver sharing it
+                        const auto recordptr = records[irecord];
+
+                        // Exchange the shared access to the learned data by an exclusive one
+                        lock.unlock();
+                        std::unique_lock<std::shared_mutex> wlock(database->mutex);
+
+                        // Increment the priorities below only if the record has not been moved or removed in the meantime (e.g., to make room for new records or by splitting the cell)
+                        if(jcluster < cell.clusters.size() && irecord < cell.clusters[jcluster].records.size() && cell.clusters[jcluster].records[irecord] == recordptr)
+                        {
+                            // Increment priority of the current record (irecord) in the current cluster (jcluster)
+                            cell.clusters[jcluster].priority.increment(irecord);
+
+                            // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
+                            cell.connectivity.increment(icluster, jcluster);
+
+                            // Increment priority of the current cluster (jcluster)
+                            cell.priority.increment(jcluster);
+                        }
+
+                        // Collect the sensitivity derivatives at the reference state of the record used in the prediction
+                        if(sensitivity)
+                            referenceSensitivity(record.predictor, *sensitivity);
+
+                        // Mark the predicted state as accepted
+                        result.prediction.accepted = true;
+
+                        result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+
+                        return true;
+                    }
+                }
+
+                return false;
+            });
+        };
+
+        // Search first the temperature-pressure cell containing the temperature and pressure of the new calculation
+        if(homecell && search_cell(*homecell))
+            return;
+
+        // Search then the neighbor cells (those sharing an edge first), if enabled
+        if(options.search_neighbor_cells)
+        {
+            // The temperature and pressure displacements to the neighbor cells (the size of the cell containing T and P)
+            const auto dT = homecell ? homecell->Tmax - homecell->Tmin : options.temperature_step;
+            const auto dP = homecell ? homecell->Pmax - homecell->Pmin : options.pressure_step;
+
+            const int directions[8][2] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {1, -1}, {-1, 1}, {1, 1} };
+
+            Vec<Cell const*> searched = { homecell };
+
+            for(auto const& [a, b] : directions)
+            {
+                auto* neighbor = findCell(grid, T + a*dT, P + b*dP);
+                if(neighbor == nullptr || std::find(searched.begin(), searched.end(), neighbor) != searched.end())
+                    continue;
+                searched.push_back(neighbor);
+                if(search_cell(*neighbor))
+                    return;
+            }
+        }
+
+        result.prediction.accepted = false;
+    }
+
+    /// Compute the chemical potentials of the primary species predicted by all records of the starting cluster of each calculation in a batch.
+    /// The starting cluster of a calculation is the one, in the
+    /// temperature-pressure cell containing its temperature and pressure, with
+    /// the same primary species as its chemical state. The calculations sharing
+    /// a starting cluster are evaluated with a single matrix-matrix product,
+    /// instead of one matrix-vector product per calculation. The returned
+    /// cluster is null for calculations without a starting cluster.
+    auto predictPackedChemicalPotentials(Vec<ChemicalState> const& states, Vec<EquilibriumConditions> const& conditions) const -> Vec<Pair<Cluster const*, VectorXd>>
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::predictPackedChemicalPotentials");
+
+        const auto numstates = states.size();
+
+        Vec<Pair<Cluster const*, VectorXd>> packed(numstates, { nullptr, VectorXd() });
+
+        std::shared_lock<std::shared_mutex> lock(database->mutex);
+
+        auto& grid = database->grid;
+
+        // The input vectors of the calculations and the indices of the calculations grouped by their starting clusters
+        Vec<VectorXd> inputs(numstates);
+        Map<Cluster const*, Indices> groups;
+
+        for(auto k = 0; k < numstates; ++k)
+        {
+            auto const* cell = findCell(grid, states[k].temperature().val(), states[k].pressure().val());
+            if(cell == nullptr)
+                continue;
+
+            const auto label = hashVector(states[k].equilibrium().indicesPrimarySpecies());
+
+            for(auto icluster : cell->priority.order())
+            {
+                auto const& cluster = cell->clusters[icluster];
+                if(cluster.label == label && cluster.restrictionslabel == 0 && !cluster.records.empty())
+                {
+                    inputs[k] = inputVector(states[k], conditions[k]);
+                    groups[&cluster].push_back(k);
+                    break;
+                }
+            }
+        }
+
+        for(auto const& [cluster, indices] : groups)
+        {
+            MatrixXd X(cluster->dmudx.cols(), indices.size());
+            for(auto j = 0; j < indices.size(); ++j)
+                X.col(j) = inputs[indices[j]];
+
+            MatrixXd mu = cluster->dmudx * X;
+            mu.colwise() += cluster->intercepts;
+
+            for(auto j = 0; j < indices.size(); ++j)
+                packed[indices[j]] = { cluster, mu.col(j) };
+        }
+
+        return packed;
+    }
+
+    /// Perform a prediction operation in which a chemical equilibrium state is predicted using the surrogate model.
+    auto predictWithSurrogate(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    {
+        REAKTORO_PROFILE("SmartEquilibriumSolver::predictWithSurrogate");
+
+        const VectorXd x = inputVector(state, conditions);
+
+        auto const& [npred, accepted] = surrogate(x);
+
+        checkSurrogateOutput(npred, accepted, 1);
+
+        if(accepted[0])
+            applySurrogatePrediction(state, x, npred.col(0));
+    }
+
+    /// Return the input vector (w, c) of a calculation (as used in nearest neighbor searches, packed acceptance tests and surrogate models).
+    auto inputVector(ChemicalState const& state, EquilibriumConditions const& conditions) const -> VectorXd
+    {
+        const ArrayXd w = conditions.inputValuesGetOrCompute(state).cast<double>();
+        const ArrayXd c = conditions.initialComponentAmountsGetOrCompute(state).cast<double>();
+        return detail::inputVector(w.matrix(), c.matrix());
+    }
+
+    /// Check the dimensions of the output of the surrogate model for a given number of calculations.
+    auto checkSurrogateOutput(MatrixXdConstRef npred, Vec<bool> const& accepted, Index numcalculations) const -> void
+    {
+        errorif(npred.rows() != An.cols(), "Expecting the surrogate model of SmartEquilibriumSolver to predict ", An.cols(), " species amounts per calculation, but got ", npred.rows(), ".");
+        errorif(npred.cols() != numcalculations, "Expecting the surrogate model of SmartEquilibriumSolver to predict the species amounts of ", numcalculations, " calculations, but got ", npred.cols(), ".");
+        errorif(accepted.size() != numcalculations, "Expecting the surrogate model of SmartEquilibriumSolver to return ", numcalculations, " acceptance flags, but got ", accepted.size(), ".");
+    }
+
+    /// Assign the species amounts predicted by the surrogate model to a chemical state if they pass the acceptance tests.
+    /// The chemical state is not changed if the prediction is rejected.
+    /// @param[in,out] state The chemical state to be predicted
+    /// @param x The input vector (w, c) of the calculation
+    /// @param npred The species amounts predicted by the surrogate model
+    auto applySurrogatePrediction(ChemicalState& state, VectorXdConstRef x, VectorXdConstRef npred) -> void
+    {
+        // Check if all predicted species amounts are finite and positive or at least very small negative values
+        if(!npred.allFinite() || npred.minCoeff() <= options.reltol_negative_amounts * npred.sum())
+            return;
+
+        const auto Nw = wnames.size();
+
+        const VectorXd w = x.head(Nw);
+        const VectorXd c = x.tail(x.size() - Nw);
+
+        // The species amounts and component amounts of the state before the prediction, restored if the prediction is rejected
+        const ArrayXr n0 = state.speciesAmounts();
+        const ArrayXd c0 = state.equilibrium().c();
+
+        // Assign small positive values to all negative amounts
+        state.setSpeciesAmounts(npred.array().max(options.learning.epsilon).eval());
+        state.equilibrium().setInitialComponentAmounts(c);
+
+        // Correct the predicted species amounts onto the mass balance constraints (if enabled) and compute the remaining relative residual
+        double residual = 0.0;
+        if(options.mass_balance_iterations > 0)
+            residual = EquilibriumPredictor::correct(state, An, Aq, Ap, options.mass_balance_iterations, options.learning.epsilon);
+        else
+        {
+            const auto cnorm = c.norm();
+            residual = (An * state.speciesAmounts().cast<double>().matrix() - c).norm() / (cnorm > 0.0 ? cnorm : 1.0);
+        }
+
+        if(!(residual <= options.reltol))
+        {
+            state.setSpeciesAmounts(n0);
+            state.equilibrium().setInitialComponentAmounts(c0);
+            return;
+        }
+
+        auto& equilibrium = state.equilibrium();
+        equilibrium.setNamesInputVariables(wnames);
+        equilibrium.setInputVariables(w);
+
+        if(iTw < Nw) state.setTemperature(w[iTw]);
+        if(iPw < Nw) state.setPressure(w[iPw]);
+
+        // Evaluate the chemical properties of the state at the predicted species amounts
+        state.props().update(state);
+
+        result.prediction.accepted = true;
+        result.prediction.surrogate = true;
+    }
+
+    //=================================================================================================================
+    //
+    // MISCELLANEOUS METHODS
+    //
+    //=================================================================================================================
+
+    /// Set the options of the smart equilibrium solver
+    auto setOptions(SmartEquilibriumOptions const& opts) -> void
+    {
+        options = opts;
+        solver.setOptions(opts.learning);
+
+        // Ensure the worker solvers used in batched calculations are recreated with the new options
+        workers.clear();
+        if(pool && options.learning.threads != 0 && pool->numThreads() != options.learning.threads)
+            pool.reset();
+    }
+
+    /// Set the surrogate model of the smart equilibrium solver
+    auto setSurrogate(SmartEquilibriumSurrogate const& f) -> void
+    {
+        errorif(f && (Aq.cols() != 0 || Ap.cols() != 0), "SmartEquilibriumSolver::setSurrogate is only supported for chemical equilibrium specifications without unknown control variables p and q (e.g., unknown temperature, pressure or titrant amounts).");
+        surrogate = f;
+        workers.clear();
+    }
+
+    /// Assign the sensitivity derivatives at the reference state of a predictor in the learned data, whether or not its Taylor matrices are stored in single precision.
+    auto referenceSensitivity(EquilibriumPredictor const& predictor, EquilibriumSensitivity& res) const -> void
+    {
+        if(!predictor.singlePrecision())
+        {
+            res = predictor.referenceSensitivity();
+            return;
+        }
+        res = sensitivity; // all records have sensitivity derivatives with the same dimensions as those of the solver
+        predictor.referenceSensitivity(res);
+    }
+
+    /// Create a record of the knowledge database for a calculated chemical equilibrium state.
+    auto createRecord(ChemicalState const& state, EquilibriumConditions const& conditions, EquilibriumSensitivity const& sensitivity) const -> Record
+    {
+        EquilibriumPredictor predictor(state, sensitivity, false, options.single_precision_records);
+        if(options.compact_records)
+            return { ChemicalState(state.system()), conditions, EquilibriumSensitivity(), predictor };
+        return { state, conditions, sensitivity, predictor };
+    }
+
+    /// Return the temperature-pressure cell without subcells containing given temperature and pressure (`nullptr` if none).
+    auto findCell(Grid& grid, double T, double P) const -> Cell*
+    {
+        const auto iT = detail::sround(T, options.temperature_step);
+        const auto iP = detail::sround(P, options.pressure_step);
+
+        auto it = grid.cells.find({iT, iP});
+
+        if(it == grid.cells.end())
+            return nullptr;
+
+        return &leafCell(it->second, T, P);
+    }
+
+    /// Return the temperature-pressure cell without subcells containing given temperature and pressure (created if needed).
+    auto findOrCreateCell(Grid& grid, double T, double P) const -> Cell&
+    {
+        // Round temperature and pressure according to their respective step lengths for discretization
+        const auto iT = detail::sround(T, options.temperature_step);
+        const auto iP = detail::sround(P, options.pressure_step);
+
+        auto [it, inserted] = grid.cells.try_emplace({iT, iP});
+
+        auto& cell = it->second;
+
+        // Initialize the temperature and pressure intervals covered by a new cell
+        if(inserted)
+        {
+            const auto Tmid = std::round(T / options.temperature_step) * options.temperature_step;
+            const auto Pmid = std::round(P / options.pressure_step) * options.pressure_step;
+            cell.Tmin = Tmid - 0.5 * options.temperature_step;
+            cell.Tmax = Tmid + 0.5 * options.temperature_step;
+            cell.Pmin = Pmid - 0.5 * options.pressure_step;
+            cell.Pmax = Pmid + 0.5 * options.pressure_step;
+        }
+
+        return leafCell(cell, T, P);
+    }
+
+    /// Return the index of the subcell of a split temperature-pressure cell containing given temperature and pressure.
+    static auto indexSubcell(Cell const& cell, double T, double P) -> Index
+    {
+        const auto Tmid = 0.5 * (cell.Tmin + cell.Tmax);
+        const auto Pmid = 0.5 * (cell.Pmin + cell.Pmax);
+        return (T < Tmid ? 0 : 1) + (P < Pmid ? 0 : 2);
+    }
+
+    /// Return the cell without subcells, among a temperature-pressure cell and its descendants, containing given temperature and pressure.
+    static auto leafCell(Cell& cell, double T, double P) -> Cell&
+    {
+        auto* current = &cell;
+        while(!current->subcells.empty())
+            current = &current->subcells[indexSubcell(*current, T, P)];
+        return *current;
+    }
+
+    /// Apply a function to a temperature-pressure cell if it has no subcells, or otherwise to each of its descendants without subcells.
+    template<typename CellType, typename Function>
+    static auto forEachLeafCell(CellType& cell, Function const& f) -> void
+    {
+        if(cell.subcells.empty())
+            f(cell);
+        else for(auto& subcell : cell.subcells)
+            forEachLeafCell(subcell, f);
+    }
+
+    /// Return the number of records stored in a temperature-pressure cell without subcells.
+    static auto numRecords(Cell const& cell) -> Index
+    {
+        Index count = 0;
+        for(auto const& cluster : cell.clusters)
+            count += cluster.records.size();
+        return count;
+    }
+
+    /// Split a temperature-pressure cell without subcells, and recursively its subcells, while they contain more records than allowed.
+    auto refineCell(Cell& cell) const -> void
+    {
+        if(numRecords(cell) <= options.max_cell_records || cell.level >= options.max_cell_splits)
+            return;
+
+        splitCell(cell);
+
+        for(auto& subcell : cell.subcells)
+            refineCell(subcell);
+    }
+
+    /// Split a temperature-pressure cell without subcells into four subcells, distributing its records among them.
+    /// The usage counts of the records are preserved. The usage count of a
+    /// cluster in a subcell is initialized with the sum of the usage counts of
+    /// its records, whereas the connectivity of the clusters is reset.
+    static auto splitCell(Cell& cell) -> void
+    {
+        const auto Tmid = 0.5 * (cell.Tmin + cell.Tmax);
+        const auto Pmid = 0.5 * (cell.Pmin + cell.Pmax);
+
+        cell.subcells.resize(4);
+
+        for(auto i = 0; i < 4; ++i)
+        {
+            auto& subcell = cell.subcells[i];
+            subcell.Tmin = i % 2 == 0 ? cell.Tmin : Tmid;
+            subcell.Tmax = i % 2 == 0 ? Tmid : cell.Tmax;
+            subcell.Pmin = i / 2 == 0 ? cell.Pmin : Pmid;
+            subcell.Pmax = i / 2 == 0 ? Pmid : cell.Pmax;
+            subcell.level = cell.level + 1;
+        }
+
+        // The usage counts of the records in each cluster of each subcell
+        Vec<Deque<Deque<Index>>> counts(4);
+
+        for(auto const& cluster : cell.clusters)
+        {
+            auto const& priorities = cluster.priority.priorities();
+
+            for(auto irecord = 0; irecord < cluster.records.size(); ++irecord)
+            {
+                auto const& record = cluster.records[irecord];
+                auto const& state0 = record->predictor.referenceState();
+
+                const auto isubcell = indexSubcell(cell, state0.temperature().val(), state0.pressure().val());
+
+                auto& subcell = cell.subcells[isubcell];
+
+                auto icluster = indexfn(subcell.clusters, RKT_LAMBDA(x, x.label == cluster.label && x.restrictionslabel == cluster.restrictionslabel));
+
+                if(icluster == subcell.clusters.size())
+                {
+                    Cluster subcluster;
+                    subcluster.iprimary = cluster.iprimary;
+                    subcluster.label = cluster.label;
+                    subcluster.restrictionslabel = cluster.restrictionslabel;
+                    subcluster.scaling = cluster.scaling;
+                    subcell.clusters.push_back(subcluster);
+                    subcell.connectivity.extend();
+                    counts[isubcell].emplace_back();
+                }
+
+                appendRecord(subcell.clusters[icluster], record);
+                counts[isubcell][icluster].push_back(priorities[irecord]);
+            }
+        }
+
+        for(auto i = 0; i < 4; ++i)
+        {
+            auto& subcell = cell.subcells[i];
+            Deque<Index> sums;
+            for(auto icluster = 0; icluster < subcell.clusters.size(); ++icluster)
+            {
+                auto const& recordcounts = counts[i][icluster];
+                subcell.clusters[icluster].priority = PriorityQueue::withInitialPriorities(recordcounts);
+                sums.push_back(std::accumulate(recordcounts.begin(), recordcounts.end(), Index(0)));
+            }
+            subcell.priority = PriorityQueue::withInitialPriorities(sums);
+        }
+
+        cell.clusters.clear();
+        cell.connectivity = ClusterConnectivity();
+        cell.priority = PriorityQueue();
+    }
+
+    /// Return the smallest usage count of the records in a non-empty cluster (that of the last record in the order of its priority queue).
+    static auto leastUsage(Cluster const& cluster) -> Index
+    {
+        return cluster.priority.priorities()[cluster.priority.order().back()];
+    }
+
+    /// Set the usage count of a cluster used to find the least used record in the learned data (see Database::usage).
+    auto setUsage(Cluster& cluster, Index count) const -> void
+    {
+        auto it = database->usagecounts.find(&cluster);
+        if(it != database->usagecounts.end())
+        {
+            database->usage.erase({ it->second, &cluster });
+            it->second = count;
+        }
+        else database->usagecounts.emplace(&cluster, count);
+        database->usage.insert({ count, &cluster });
+    }
+
+    /// Collect the usage counts of the clusters in the learned data used to find its least used record, if not up to date (see Database::usage).
+    auto collectUsage() const -> void
+    {
+        if(database->numrecords != Index(-1))
+            return;
+
+        database->usage.clear();
+        database->usagecounts.clear();
+        database->numrecords = 0;
+
+        auto collect = [&](Cell& cell)
+        {
+            for(auto& cluster : cell.clusters)
+            {
+                database->numrecords += cluster.records.size();
+                if(!cluster.records.empty())
+                    setUsage(cluster, leastUsage(cluster));
+            }
+        };
+
+        for(auto& [key, root] : database->grid.cells)
+            forEachLeafCell(root, collect);
+    }
+
+    /// Remove the record with the smallest usage count in the learned data, returning false if there are no records (see Database::usage).
+    /// The removed record is the last one in the order of the priority queue
+    /// of its cluster, and the last record of the cluster is moved into its
+    /// place, so that only the data of these two records is moved.
+    auto removeLeastUsedRecord() const -> bool
+    {
+        auto& usage = database->usage;
+
+        // Update the outdated usage counts at the beginning of the set until the cluster with the least used record is found
+        while(!usage.empty())
+        {
+            const auto [count, cluster] = *usage.begin();
+            const auto least = leastUsage(*cluster);
+            if(least == count)
+                break;
+            setUsage(*cluster, least);
+        }
+
+        if(usage.empty())
+            return false;
+
+        auto& cluster = *usage.begin()->second;
+
+        const auto irecord = cluster.priority.removeLast();
+        const auto ilast = cluster.records.size() - 1;
+
+        // Move the last record, its point in the spatial index and its packed data into the place of the removed record (the records in a cluster have the same number of primary species)
+        const auto offset = cluster.offsets[irecord];
+        const auto offsetlast = cluster.offsets[ilast];
+        const auto size = cluster.mu0.size() - offsetlast;
+
+        if(irecord != ilast)
+        {
+            cluster.records[irecord] = cluster.records[ilast];
+            cluster.mu0.segment(offset, size) = cluster.mu0.tail(size);
+            cluster.intercepts.segment(offset, size) = cluster.intercepts.tail(size);
+            cluster.dmudx.middleRows(offset, size) = cluster.dmudx.bottomRows(size);
+        }
+
+        cluster.records.pop_back();
+        cluster.tree.remove(irecord);
+        cluster.mu0.conservativeResize(offsetlast);
+        cluster.intercepts.conservativeResize(offsetlast);
+        cluster.dmudx.conservativeResize(offsetlast, cluster.dmudx.cols());
+        cluster.offsets.pop_back();
+
+        database->numrecords -= 1;
+
+        // Update the usage count of the cluster, which is no longer tracked if it has no records
+        if(cluster.records.empty())
+        {
+            usage.erase(usage.begin());
+            database->usagecounts.erase(&cluster);
+        }
+        else setUsage(cluster, leastUsage(cluster));
+
+        return true;
+    }
+
+    /// Remove the records of a temperature-pressure grid dominated by more used records in their clusters, returning the number of removed records.
+    /// A record is dominated if its reference input vector (w, c) passes the
+    /// acceptance test of a more used record in the same cluster, so that the
+    /// calculations predicted with it would mostly be predicted with the other
+    /// one. Its usage count is then added to that of the dominating record.
+    auto pruneRecords(Grid& grid) const -> Index
+    {
+        Index numremoved = 0;
+
+        auto prune_cell = [&](Cell& cell)
+        {
+            for(auto& cluster : cell.clusters)
+                numremoved += pruneRecords(cluster);
+        };
+
+        for(auto& [key, root] : grid.cells)
+            forEachLeafCell(root, prune_cell);
+
+        return numremoved;
+    }
+
+    /// Remove the records of a cluster dominated by more used records in it, returning the number of removed records (see @ref pruneRecords(Grid&)).
+    auto pruneRecords(Cluster& cluster) const -> Index
+    {
+        auto const& priorities = cluster.priority.priorities();
+        auto const& order = cluster.priority.order();
+
+        const auto numrecords = cluster.records.size();
+
+        // The indices of the records kept so far, visited from the most used one, and their accumulated usage counts
+        Indices kept;
+        Deque<Index> counts;
+
+        for(auto irecord : order)
+        {
+            auto const& state = cluster.records[irecord]->predictor.referenceState();
+
+            const VectorXd w = state.equilibrium().w().matrix();
+            const VectorXd c = state.equilibrium().c().matrix();
+
+            auto dominates = [&](Index ikept)
+            {
+                auto const& predictor0 = cluster.records[ikept]->predictor;
+                auto const& state0 = predictor0.referenceState();
+                const VectorXd dw = w - state0.equilibrium().w().matrix();
+                const VectorXd dc = c - state0.equilibrium().c().matrix();
+                const auto mu0 = predictor0.primarySpeciesChemicalPotentialsReference();
+                const auto mu1 = predictor0.primarySpeciesChemicalPotentialsPredicted(dw, dc);
+                return ((mu1 - mu0).array().abs() < options.reltol*mu0.array().abs() + options.abstol).all();
+            };
+
+            const auto j = indexfn(kept, dominates);
+
+            if(j < kept.size())
+                counts[j] += priorities[irecord];
+            else
+            {
+                kept.push_back(irecord);
+                counts.push_back(priorities[irecord]);
+            }
+        }
+
+        if(kept.size() == numrecords)
+            return 0;
+
+        // Keep the remaining records in their original order, since this is the order of their entries in the spatial index and packed data
+        Indices sorting(kept.size());
+        std::iota(sorting.begin(), sorting.end(), 0);
+        std::sort(sorting.begin(), sorting.end(), [&](Index l, Index r) { return kept[l] < kept[r]; });
+
+        Deque<SharedPtr<Record>> records;
+        Deque<Index> newcounts;
+        for(auto j : sorting)
+        {
+            records.push_back(cluster.records[kept[j]]);
+            newcounts.push_back(counts[j]);
+        }
+
+        cluster.records.swap(records);
+        cluster.priority = PriorityQueue::withInitialPriorities(newcounts);
+
+        // Rebuild the spatial index and the packed data of the remaining records
+        cluster.tree = KdTree();
+        cluster.dmudx.resize(0, 0);
+        cluster.mu0.resize(0);
+        cluster.intercepts.resize(0);
+        cluster.offsets.clear();
+
+        for(auto const& record : cluster.records)
+            indexRecord(cluster, *record);
 
-    /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
-    Impl(EquilibriumSpecs const& specs)
-    : solver(specs), sensitivity(specs), conditions(specs)
-    {
-        // Initialize the equilibrium solver with the default options
-        setOptions(options);
+        return numrecords - kept.size();
     }
 
-    //=================================================================================================================
-    //
-    // CHEMICAL EQUILIBRIUM METHODS
-    //
-    //=================================================================================================================
-
-    auto solve(ChemicalState& state) -> SmartEquilibriumResult
+    /// Remove the records of the learned data dominated by more used records in their clusters (see @ref pruneRecords(Grid&)).
+    auto pruneLearningData() -> Index
     {
-        conditions.temperature(state.temperature());
-        conditions.pressure(state.pressure());
-        return solve(state, conditions);
+        std::unique_lock<std::shared_mutex> lock(database->mutex);
+        database->numrecords = Index(-1); // collect the usage counts of the clusters again when needed
+        return pruneRecords(database->grid);
     }
 
-    auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    /// Append a record to a cluster, updating its priority queue, spatial index and packed data.
+    static auto appendRecord(Cluster& cluster, SharedPtr<Record> const& record) -> void
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        cluster.records.push_back(record);
+        cluster.priority.extend();
+        indexRecord(cluster, *record);
     }
 
-    auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
+    /// Insert a record of a cluster in its spatial index and packed data (after those of the preceding records).
+    static auto indexRecord(Cluster& cluster, Record const& record) -> void
     {
-        tic(SOLVE_STEP)
+        auto const& predictor = record.predictor;
+        auto const& state0 = predictor.referenceState();
 
-        // Reset the result of the last smart equilibrium calculation
-        result = {};
+        const VectorXd x0 = detail::inputVector(state0.equilibrium().w().matrix(), state0.equilibrium().c().matrix());
 
-        // Perform a smart prediction of the chemical state
-        timeit( predict(state, conditions), result.timing.prediction= )
+        cluster.tree.insert(x0.cwiseQuotient(cluster.scaling));
 
-        // Perform a learning step if the smart prediction is not satisfactory
-        if(!result.prediction.accepted)
-            timeit( learn(state, conditions), result.timing.learning= )
+        const auto mu0 = predictor.primarySpeciesChemicalPotentialsReference();
+        const auto dmudx = predictor.primarySpeciesChemicalPotentialsDerivatives();
 
-        result.timing.solve = toc(SOLVE_STEP);
+        const auto offset = cluster.mu0.size();
+        const auto size = mu0.size();
 
-        return result;
-    }
+        cluster.offsets.push_back(offset);
 
-    auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
-    {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
-    }
+        cluster.mu0.conservativeResize(offset + size);
+        cluster.mu0.tail(size) = mu0;
 
-    //=================================================================================================================
-    //
-    // CHEMICAL EQUILIBRIUM METHODS WITH SENSITIVITY CALCULATION
-    //
-    //=================================================================================================================
+        cluster.intercepts.conservativeResize(offset + size);
+        cluster.intercepts.tail(size) = mu0 - dmudx * x0;
 
-    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
-    {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        cluster.dmudx.conservativeResize(offset + size, dmudx.cols());
+        cluster.dmudx.bottomRows(size) = dmudx;
     }
 
-    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    /// Save the learned data of the smart equilibrium solver in a binary file.
+    auto saveLearningData(String const& filename) const -> void
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        std::ofstream out(filename, std::ios::binary);
+        errorif(!out, "Could not open file `", filename, "` to save the learned data of SmartEquilibriumSolver.");
+        saveLearningData(out);
+        errorif(!out, "Could not write the learned data of SmartEquilibriumSolver to file `", filename, "`.");
     }
 
-    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
+    /// Save the learned data of the smart equilibrium solver in a binary stream.
+    auto saveLearningData(std::ostream& out) const -> void
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        std::shared_lock<std::shared_mutex> lock(database->mutex);
+
+        auto const& grid = database->grid;
+
+        out.write(detail::databaseFileSignature, sizeof(detail::databaseFileSignature));
+        detail::writeValue(out, detail::databaseFileVersion);
+
+        // The dimensions of the equilibrium problem, checked when the learned data is loaded
+        detail::writeSize(out, conditions.system().species().size());
+        detail::writeStrings(out, conditions.inputNames());
+        detail::writeSize(out, conditions.initialComponentAmounts().size());
+
+        detail::writeSize(out, grid.cells.size());
+
+        for(auto const& [key, cell] : grid.cells)
+        {
+            detail::writeValue<std::int64_t>(out, key.first);
+            detail::writeValue<std::int64_t>(out, key.second);
+            writeCell(out, cell);
+        }
     }
 
-    auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
+    /// Load the learned data of the smart equilibrium solver from a binary file.
+    auto loadLearningData(String const& filename) -> void
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        std::ifstream in(filename, std::ios::binary);
+        errorif(!in, "Could not open file `", filename, "` to load the learned data of SmartEquilibriumSolver.");
+
+        loadLearningData(in, "file `" + filename + "`");
     }
 
-    //=================================================================================================================
-    //
-    // LEARN AND PREDICT METHODS
-    //
-    //=================================================================================================================
+    /// Load the learned data of the smart equilibrium solver from a binary stream.
+    auto loadLearningData(std::istream& in, String const& source) -> void
+    {
+        auto grid = readLearningData(in, source);
 
-    /// Perform a learning operation in which a full chemical equilibrium calculation is performed.
-    auto learn(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+        std::unique_lock<std::shared_mutex> lock(database->mutex);
+
+        database->grid = std::move(grid);
+        database->numrecords = Index(-1); // collect the usage counts of the clusters again when needed
+    }
+
+    /// Merge the learned data of another smart equilibrium solver, read from a binary stream, into the learned data of this one.
+    auto mergeLearningData(std::istream& in) -> void
     {
-        //---------------------------------------------------------------------
-        // GIBBS ENERGY MINIMIZATION CALCULATION DURING THE LEARNING PROCESS
-        //---------------------------------------------------------------------
-        tic(EQUILIBRIUM_STEP)
+        const auto other = readLearningData(in, "the given stream");
 
-        // Perform a full chemical equilibrium solve with sensitivity derivatives calculation
-        result.learning.solve = solver.solve(state, sensitivity, conditions);
+        std::unique_lock<std::shared_mutex> lock(database->mutex);
 
-        result.timing.learning_solve = toc(EQUILIBRIUM_STEP);
+        auto& grid = database->grid;
 
-        //---------------------------------------------------------------------
-        // STORAGE STEP DURING THE LEARNING PROCESS
-        //---------------------------------------------------------------------
-        tic(STORAGE_STEP)
+        for(auto const& [key, root] : other.cells)
+        {
+            forEachLeafCell(root, [&](Cell const& othercell)
+            {
+                for(auto const& othercluster : othercell.clusters)
+                {
+                    for(auto const& record : othercluster.records)
+                    {
+                        auto const& state0 = record->predictor.referenceState();
+                        const auto T = state0.temperature().val();
+                        const auto P = state0.pressure().val();
+
+                        // Skip the records already known (e.g., because they were merged before)
+                        if(containsRecord(findOrCreateCell(grid, T, P), *record))
+                            continue;
+
+                        storeRecord(*record, othercluster.restrictionslabel);
+                    }
+                }
+            });
+        }
+    }
 
-        // Create an equilibrium predictor object with computed equilibrium state and its sensitivities
-        EquilibriumPredictor predictor(state, sensitivity);
+    /// Read the learned data of a smart equilibrium solver from a binary stream.
+    auto readLearningData(std::istream& in, String const& source) const -> SmartEquilibriumSolver::Grid
+    {
+        char signature[sizeof(detail::databaseFileSignature)] = {};
+        in.read(signature, sizeof(signature));
+        errorif(!in || !std::equal(signature, signature + sizeof(signature), detail::databaseFileSignature), "The ", source, " does not contain learned data of SmartEquilibriumSolver.");
 
-        // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
+        const auto version = detail::readValue<std::uint64_t>(in);
+        errorif(version != detail::databaseFileVersion, "The ", source, " contains learned data of SmartEquilibriumSolver in an unsupported format version (", version, ").");
 
-        // Get a mutable reference to an existing temperature-pressure cell or create a new one
-        auto& cell = grid.cells[{iT, iP}];
+        const auto Nn = conditions.system().species().size();
+        const auto Nc = conditions.initialComponentAmounts().size();
 
-        // Generate the hash number for indices of primary species in the state
-        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
-        const auto label = hashVector(iprimary);
+        errorif(detail::readSize(in) != Nn, "Cannot load the learned data of SmartEquilibriumSolver in ", source, " because it was produced for a different chemical system.");
+        errorif(detail::readStrings(in) != conditions.inputNames(), "Cannot load the learned data of SmartEquilibriumSolver in ", source, " because it was produced with different input variables.");
+        errorif(detail::readSize(in) != Nc, "Cannot load the learned data of SmartEquilibriumSolver in ", source, " because it was produced with different conservative components.");
 
-        // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species
-        auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label));
+        SmartEquilibriumSolver::Grid grid;
 
-        // If cluster is found, store the new record in it, otherwise, create a new cluster
-        if(icluster < cell.clusters.size())
-        {
-            auto& cluster = cell.clusters[icluster];
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
-        }
-        else
+        const auto numcells = detail::readSize(in);
+
+        for(auto icell = 0; icell < numcells; ++icell)
         {
-            // Create a new cluster within the current temperature-pressure grid cell
-            Cluster cluster;
-            cluster.iprimary = iprimary;
-            cluster.label = label;
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
-            cluster.priority.extend();
+            const auto iT = detail::readValue<std::int64_t>(in);
+            const auto iP = detail::readValue<std::int64_t>(in);
 
-            // Append the new cluster and initialize its connectivity and priority
-            cell.clusters.push_back(cluster);
-            cell.connectivity.extend();
-            cell.priority.extend();
+            grid.cells[{iT, iP}] = readCell(in, source);
         }
 
-        result.timing.learning_storage = toc(STORAGE_STEP);
+        return grid;
     }
 
-    /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
-    auto predict(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    /// Return true if a temperature-pressure cell without subcells contains a record with the same reference inputs and primary species as a given record.
+    static auto containsRecord(Cell const& cell, Record const& record) -> bool
     {
-        // Set the prediction status to false at the beginning
-        result.prediction.accepted = false;
+        auto const& equilibrium = record.predictor.referenceState().equilibrium();
+        const auto label = hashVector(equilibrium.indicesPrimarySpecies());
+        for(auto const& cluster : cell.clusters)
+        {
+            if(cluster.label != label)
+                continue;
+            for(auto const& existing : cluster.records)
+            {
+                auto const& equilibrium0 = existing->predictor.referenceState().equilibrium();
+                if((equilibrium0.w() == equilibrium.w()).all() && (equilibrium0.c() == equilibrium.c()).all())
+                    return true;
+            }
+        }
+        return false;
+    }
 
-        // Skip prediction operation if no learning data exists yet
-        if(grid.cells.empty())
-            return;
+    /// Write a temperature-pressure cell of the learned data, and recursively its subcells, into a binary stream.
+    auto writeCell(std::ostream& out, Cell const& cell) const -> void
+    {
+        detail::writeValue<double>(out, cell.Tmin);
+        detail::writeValue<double>(out, cell.Tmax);
+        detail::writeValue<double>(out, cell.Pmin);
+        detail::writeValue<double>(out, cell.Pmax);
+        detail::writeSize(out, cell.level);
 
-        // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
+        detail::writeSize(out, cell.clusters.size());
 
-        // Find an existing temperature-pressure grid cell within which the state temperature/pressure are located
-        auto it = grid.cells.find({iT, iP});
+        for(auto const& cluster : cell.clusters)
+        {
+            detail::writeArrayXl(out, cluster.iprimary);
+            detail::writeValue<std::uint64_t>(out, cluster.label);
+            detail::writeValue<std::uint64_t>(out, cluster.restrictionslabel);
+            detail::writeArray(out, cluster.scaling.array());
+            detail::writeSize(out, cluster.records.size());
 
-        // Skip prediction operation if no temperature-pressure grid cell with learning data exists yet
-        if(it == grid.cells.end())
-            return;
+            for(auto const& record : cluster.records)
+            {
+                auto const& state = record->predictor.referenceState();
+                auto const& equilibrium = state.equilibrium();
+                EquilibriumSensitivity sensitivity;
+                referenceSensitivity(record->predictor, sensitivity);
+
+                detail::writeValue<double>(out, state.temperature().val());
+                detail::writeValue<double>(out, state.pressure().val());
+                detail::writeArray(out, state.speciesAmounts().cast<double>());
+                detail::writeArray(out, VectorXd(state.props()).array());
+                detail::writeStrings(out, equilibrium.namesControlVariablesP());
+                detail::writeStrings(out, equilibrium.namesControlVariablesQ());
+                detail::writeArray(out, equilibrium.w());
+                detail::writeArray(out, equilibrium.p());
+                detail::writeArray(out, equilibrium.q());
+                detail::writeArray(out, equilibrium.c());
+                detail::writeArrayXl(out, equilibrium.indicesPrimarySpecies());
+                detail::writeArrayXl(out, equilibrium.indicesSecondarySpecies());
+                detail::writeMatrix(out, sensitivity.dndw());
+                detail::writeMatrix(out, sensitivity.dpdw());
+                detail::writeMatrix(out, sensitivity.dqdw());
+                detail::writeMatrix(out, sensitivity.dudw());
+                detail::writeMatrix(out, sensitivity.dndc());
+                detail::writeMatrix(out, sensitivity.dpdc());
+                detail::writeMatrix(out, sensitivity.dqdc());
+                detail::writeMatrix(out, sensitivity.dudc());
+            }
 
-        // Get a mutable reference to the found temperature-pressure cell
-        auto& cell = it->second;
+            detail::writePriorityQueue(out, cluster.priority);
+        }
 
-        const auto wvals = conditions.inputValuesGetOrCompute(state);
-        const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
+        for(auto icluster = 0; icluster < cell.clusters.size(); ++icluster)
+            detail::writeTransitions(out, cell.connectivity.transitions(icluster));
 
-        const auto w = wvals.cast<double>();
-        const auto c = cvals.cast<double>();
+        detail::writePriorityQueue(out, cell.connectivity.usage());
 
-        // Auxiliary vectors used in the lambda function below to avoid repeated memory allocation
-        VectorXd dw;
-        VectorXd dc;
+        detail::writePriorityQueue(out, cell.priority);
 
-        // The function that checks if a record in the grid pass the error test.
-        auto pass_error_test = [&](Record const& record) mutable -> bool
-        {
-            // The primary species at the reference chemical state
-            auto const& iprimary0 = record.state.equilibrium().indicesPrimarySpecies();
+        detail::writeSize(out, cell.subcells.size());
+
+        for(auto const& subcell : cell.subcells)
+            writeCell(out, subcell);
+    }
 
-            // The equilibrium predictor calculator at the reference state
-            auto const& predictor0 = record.predictor;
+    /// Read a temperature-pressure cell of the learned data, and recursively its subcells, from a binary stream.
+    auto readCell(std::istream& in, String const& source) const -> Cell
+    {
+        const auto Nn = conditions.system().species().size();
 
-            const auto w0 = record.state.equilibrium().w();
-            const auto c0 = record.state.equilibrium().c();
+        Cell cell;
+        cell.Tmin = detail::readValue<double>(in);
+        cell.Tmax = detail::readValue<double>(in);
+        cell.Pmin = detail::readValue<double>(in);
+        cell.Pmax = detail::readValue<double>(in);
+        cell.level = detail::readSize(in);
 
-            dw = w - w0;
-            dc = c - c0;
 
-            using std::abs;
+        const auto numclusters = detail::readSize(in);
 
-            for(auto ispecies : iprimary0)
+        for(auto icluster = 0; icluster < numclusters; ++icluster)
+        {
+            Cluster cluster;
+            cluster.iprimary = detail::readArrayXl(in);
+            cluster.label = detail::readValue<std::uint64_t>(in);
+            cluster.restrictionslabel = detail::readValue<std::uint64_t>(in);
+            cluster.scaling = detail::readArray(in).matrix();
+
+            const auto numrecords = detail::readSize(in);
+
+            for(auto irecord = 0; irecord < numrecords; ++irecord)
             {
-                const auto mu0 = predictor0.speciesChemicalPotentialReference(ispecies);
-                const auto mu1 = predictor0.speciesChemicalPotentialPredicted(ispecies, dw, dc);
-                if(abs(mu1 - mu0) >= options.reltol*abs(mu0) + options.abstol)
-                    return false;
+                ChemicalState state0(conditions.system());
+
+                const auto T = detail::readValue<double>(in);
+                const auto P = detail::readValue<double>(in);
+                const auto n = detail::readArray(in);
+                const auto u = detail::readArray(in);
+
+                errorif(n.size() != Nn, "Could not read the learned data of SmartEquilibriumSolver from ", source, ", which is corrupted.");
+
+                state0.setTemperature(T);
+                state0.setPressure(P);
+                state0.setSpeciesAmounts(n);
+                state0.props().update(u);
+
+                auto& equilibrium = state0.equilibrium();
+                equilibrium.setNamesInputVariables(conditions.inputNames());
+                equilibrium.setNamesControlVariablesP(detail::readStrings(in));
+                equilibrium.setNamesControlVariablesQ(detail::readStrings(in));
+
+                const auto w = detail::readArray(in);
+                const auto p = detail::readArray(in);
+                const auto q = detail::readArray(in);
+                const auto c = detail::readArray(in);
+
+                // Only the parts of the Optima state needed to recover p, q and the primary and secondary species are restored
+                Optima::State optstate;
+                optstate.x.resize(Nn + q.size());
+                optstate.x.head(Nn) = n;
+                optstate.jb = detail::readArrayXl(in);
+                optstate.jn = detail::readArrayXl(in);
+
+                equilibrium.setOptimaState(optstate);
+                equilibrium.setInputVariables(w);
+                equilibrium.setControlVariablesP(p);
+                equilibrium.setControlVariablesQ(q);
+                equilibrium.setInitialComponentAmounts(c);
+
+                EquilibriumSensitivity sensitivity0 = sensitivity;
+                sensitivity0.dndw(detail::readMatrix(in));
+                sensitivity0.dpdw(detail::readMatrix(in));
+                sensitivity0.dqdw(detail::readMatrix(in));
+                sensitivity0.dudw(detail::readMatrix(in));
+                sensitivity0.dndc(detail::readMatrix(in));
+                sensitivity0.dpdc(detail::readMatrix(in));
+                sensitivity0.dqdc(detail::readMatrix(in));
+                sensitivity0.dudc(detail::readMatrix(in));
+
+                // The conditions of the restored records are not persisted, since they are not used in predictions
+                appendRecord(cluster, std::make_shared<Record>(createRecord(state0, conditions, sensitivity0)));
             }
 
-            return true;
-        };
+            cluster.priority = detail::readPriorityQueue(in);
 
-        // Generate the hash number for indices of primary species in the state
-        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
-        const auto label = hashVector(iprimary);
+            errorif(cluster.priority.size() != cluster.records.size(), "Could not read the learned data of SmartEquilibriumSolver from ", source, ", which is corrupted.");
 
-        // The function that identifies the starting cluster index
-        auto index_starting_cluster = [&]() -> Index
-        {
-            // If no primary species, then return number of clusters to trigger use of total usage counts of clusters
-            if(iprimary.size() == 0)
-                return cell.clusters.size();
+            cell.clusters.push_back(cluster);
+        }
 
-            // Find the index of the cluster with the same set of primary species (search those with highest count first)
-            for(auto icluster : cell.priority.order())
-                if(cell.clusters[icluster].label == label)
-                    return icluster;
+        Vec<Pairs<Index, Index>> transitions(numclusters);
+        for(auto& row : transitions)
+            row = detail::readTransitions(in);
 
-            // In no cluster with the same set of primary species if found, then return number of clusters
-            return cell.clusters.size();
-        };
+        const auto queue = detail::readPriorityQueue(in);
 
-        // The index of the starting cluster
-        const auto icluster = index_starting_cluster();
+        errorif(queue.size() != numclusters, "Could not read the learned data of SmartEquilibriumSolver from ", source, ", which is corrupted.");
 
-        // The ordering of the clusters to look for (starting with icluster)
-        auto const& clusters_ordering = cell.connectivity.order(icluster);
+        for(auto i = 0; i < numclusters; ++i)
+            for(auto const& [jcluster, count] : transitions[i])
+                errorif(jcluster >= numclusters || jcluster == i, "Could not read the learned data of SmartEquilibriumSolver from ", source, ", which is corrupted.");
 
-        //---------------------------------------------------------------------
-        // SEARCH STEP DURING THE PREDICTION PROCESS
-        //---------------------------------------------------------------------
-        tic(SEARCH_STEP)
+        cell.connectivity = ClusterConnectivity::withInitialTransitions(transitions, queue);
+        cell.priority = detail::readPriorityQueue(in);
 
-        // Iterate over all clusters (starting with icluster)
-        for(auto jcluster : clusters_ordering)
-        {
-            // Fetch records from the cluster and the order they have to be processed in
-            auto const& records = cell.clusters[jcluster].records;
-            auto const& records_ordering = cell.clusters[jcluster].priority.order();
+        errorif(cell.priority.size() != numclusters, "Could not read the learned data of SmartEquilibriumSolver from ", source, ", which is corrupted.");
 
-            // Iterate over all records in current cluster (using the order based on the priorities)
-            for(auto irecord : records_ordering)
-            {
-                auto const& record = records[irecord];
+        const auto numsubcells = detail::readSize(in);
+
+        errorif(numsubcells != 0 && (numsubcells != 4 || numclusters != 0), "Could not read the learned data of SmartEquilibriumSolver from ", source, ", which is corrupted.");
 
-                //---------------------------------------------------------------------
-                // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
-                //---------------------------------------------------------------------
-                tic(ERROR_CONTROL_STEP)
+        for(auto isubcell = 0; isubcell < numsubcells; ++isubcell)
+            cell.subcells.push_back(readCell(in, source));
+
+        return cell;
+    }
+
+    /// Return the approximate memory used by the learned data, with a breakdown into stored states, sensitivity derivatives, input vectors and acceptance test data (the database must be locked by the caller).
+    auto learnedDataMemoryUsageUnlocked() const -> MemoryUsage
+    {
+        // The number of serialized chemical properties of a chemical state, all stored states having the same chemical system
+        Index Nu = 0;
 
-                // Check if the current record passes the error test
-                const auto success = pass_error_test(record);
+        Index states = 0, sensitivities = 0, inputs = 0, clusters = 0;
 
-                result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
+        auto collect = [&](Cell const& cell)
+        {
+            for(auto const& cluster : cell.clusters)
+            {
+                clusters += sizeof(double) * (cluster.dmudx.size() + cluster.mu0.size() + cluster.intercepts.size() + cluster.scaling.size());
+                clusters += sizeof(Index) * cluster.offsets.size();
 
-                if(success)
+                for(auto const& record : cluster.records)
                 {
-                    //---------------------------------------------------------------------
-                    // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(TAYLOR_STEP)
+                    auto const& state0 = record->predictor.referenceState();
+                    if(Nu == 0)
+                    {
+                        ArrayStream<real> stream;
+                        state0.props().serialize(stream);
+                        Nu = stream.data().size();
+                    }
+                    const auto Nn = state0.speciesAmounts().size();
+                    const auto Nx = state0.equilibrium().w().size() + state0.equilibrium().c().size();
+                    states += sizeof(real) * 2 * (Nn + Nu); // the reference state in the predictor and the state in the record
+                    sensitivities += sizeof(double) * detail::sensitivitySize(record->sensitivity);
+                    sensitivities += (record->predictor.singlePrecision() ? sizeof(float) : sizeof(double)) * detail::sensitivitySize(sensitivity); // the Taylor matrices in the predictor, with the same dimensions as the sensitivity derivatives of the solver
+                    inputs += sizeof(double) * 2 * Nx; // the input vector of the record in the spatial index and in its reference state
+                }
+            }
+        };
 
-                    auto const& predictor0 = record.predictor;
+        for(auto const& [key, root] : database->grid.cells)
+            forEachLeafCell(root, collect);
 
-                    predictor0.predict(state, conditions);
+        MemoryUsage usage;
+        usage.name = "learned data";
+        usage.add("states", states);
+        usage.add("sensitivities", sensitivities);
+        usage.add("inputs", inputs);
+        usage.add("clusters", clusters);
+        return usage;
+    }
 
-                    result.timing.prediction_taylor = toc(TAYLOR_STEP);
+    /// Return the approximate memory used by this solver, its learned data (unless shared with the caller) and its workers.
+    auto memoryUsage(bool withlearneddata = true) const -> MemoryUsage
+    {
+        MemoryUsage usage;
+        usage.name = "SmartEquilibriumSolver";
+        usage.bytes = sizeof(Impl) + memoryBytes(An, Aq, Ap) + memoryBytes(wnames);
+        usage.add(solver.memoryUsage());
 
-                    // Check if all projected species amounts are positive or at least very small negative values
-                    auto const& n = state.speciesAmounts();
+        if(withlearneddata)
+        {
+            std::shared_lock<std::shared_mutex> lock(database->mutex);
+            usage.add(learnedDataMemoryUsageUnlocked());
+        }
 
-                    const double nmin = n.minCoeff();
-                    const double nsum = n.sum();
+        MemoryUsage workersusage;
+        workersusage.name = "workers";
+        for(auto i = 0; i < workers.size(); ++i)
+        {
+            auto workerusage = workers[i]->memoryUsage(false); // the learned data is shared with this solver
+            workerusage.name = "worker " + std::to_string(i);
+            workersusage.add(workerusage);
+        }
+        usage.add(workersusage);
 
-                    if(nmin <= options.reltol_negative_amounts * nsum)
-                        continue; // continue searching for a another record that produces positive amounts only or tolerable negative values
+        return usage;
+    }
 
-                    result.timing.prediction_search = toc(SEARCH_STEP);
+    /// Return the cumulative statistics of the smart equilibrium calculations together with a snapshot of the learned data.
+    auto collectStatistics() const -> SmartEquilibriumStatistics
+    {
+        auto stats = statistics;
 
-                    //---------------------------------------------------------------------
-                    // After the search is finished successfully
-                    //---------------------------------------------------------------------
+        std::shared_lock<std::shared_mutex> lock(database->mutex);
 
-                    // Assign small positive values to all negative amounts
-                    for(auto i = 0; i < n.size(); ++i)
-                        if(n[i] < 0.0)
-                            state.setSpeciesAmount(i, options.learning.epsilon);
+        auto collect = [&](Cell const& cell)
+        {
+            const auto numrecords = numRecords(cell);
+            stats.cells += 1;
+            stats.clusters += cell.clusters.size();
+            stats.records += numrecords;
+            stats.max_records_per_cell = std::max(stats.max_records_per_cell, numrecords);
+
+            for(auto const& cluster : cell.clusters)
+                stats.max_records_per_cluster = std::max<Index>(stats.max_records_per_cluster, cluster.records.size());
+        };
 
-                    //---------------------------------------------------------------------
-                    // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(PRIORITY_UPDATE_STEP)
+        for(auto const& [key, root] : database->grid.cells)
+            forEachLeafCell(root, collect);
 
-                    // Increment priority of the current record (irecord) in the current cluster (jcluster)
-                    cell.clusters[jcluster].priority.increment(irecord);
+        stats.memory = learnedDataMemoryUsageUnlocked().total();
 
-                    // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
-                    cell.connectivity.increment(icluster, jcluster);
+        return stats;
+    }
 
-                    // Increment priority of the current cluster (jcluster)
-                    cell.priority.increment(jcluster);
+    /// Return a table with the temperature-pressure bounds and the number of clusters and records of each cell without subcells in the learned data.
+    auto statisticsPerCell() const -> Table
+    {
+        std::shared_lock<std::shared_mutex> lock(database->mutex);
 
-                    // Mark the predicted state as accepted
-                    result.prediction.accepted = true;
+        Table table;
 
-                    result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+        auto collect = [&](Cell const& cell)
+        {
+            Index maxrecords = 0;
+            for(auto const& cluster : cell.clusters)
+                maxrecords = std::max<Index>(maxrecords, cluster.records.size());
+
+            table.column("Tmin") << cell.Tmin;
+            table.column("Tmax") << cell.Tmax;
+            table.column("Pmin") << cell.Pmin;
+            table.column("Pmax") << cell.Pmax;
+            table.column("Level") << cell.level;
+            table.column("Clusters") << cell.clusters.size();
+            table.column("Records") << numRecords(cell);
+            table.column("MaxRecordsPerCluster") << maxrecords;
+        };
 
-                    return;
-                }
-            }
-        }
+        for(auto const& [key, root] : database->grid.cells)
+            forEachLeafCell(root, collect);
 
-        result.prediction.accepted = false;
+        return table;
     }
 
-    //=================================================================================================================
-    //
-    // MISCELLANEOUS METHODS
-    //
-    //=================================================================================================================
-
-    /// Set the options of the smart equilibrium solver
-    auto setOptions(SmartEquilibriumOptions const& opts) -> void
+    /// Share the learned data of another smart equilibrium solver.
+    auto shareLearningData(Impl const& other) -> void
     {
-        options = opts;
-        solver.setOptions(opts.learning);
+        errorif(conditions.inputNames() != other.conditions.inputNames(), "Cannot share the learned data of SmartEquilibriumSolver objects with different input variables.");
+        errorif(conditions.system().species().size() != other.conditions.system().species().size(), "Cannot share the learned data of SmartEquilibriumSolver objects with different chemical systems.");
+        errorif(conditions.initialComponentAmounts().size() != other.conditions.initialComponentAmounts().size(), "Cannot share the learned data of SmartEquilibriumSolver objects with different conservative components.");
+        database = other.database;
+        workers.clear(); // the workers must share the new learned data
     }
 };
 
@@ -427,8 +2218,7 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state) -> SmartEquilibriumResu
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
@@ -438,32 +2228,62 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions c
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, conditions, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions, restrictions);
+}
+
+auto SmartEquilibriumSolver::solve(Vec<ChemicalState>& states) -> Vec<SmartEquilibriumResult>
+{
+    return pimpl->solve(states);
+}
+
+auto SmartEquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartEquilibriumResult>
+{
+    return pimpl->solve(states, conditions);
+}
+
+auto SmartEquilibriumSolver::solveAsync(ChemicalState& state, EquilibriumConditions const& conditions) -> std::future<SmartEquilibriumResult>
+{
+    return std::async(std::launch::async, [impl = pimpl.get(), &state, conditions] { return impl->solve(state, conditions); });
+}
+
+auto SmartEquilibriumSolver::solveAsync(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> std::future<Vec<SmartEquilibriumResult>>
+{
+    return std::async(std::launch::async, [impl = pimpl.get(), &states, conditions] { return impl->solve(states, conditions); });
+}
+
+auto SmartEquilibriumSolver::train(Vec<ChemicalState> const& samples, Vec<EquilibriumConditions> const& conditions) -> Index
+{
+    return pimpl->train(samples, conditions);
+}
+
+auto SmartEquilibriumSolver::learnAsync(Vec<ChemicalState> const& candidates, Vec<EquilibriumConditions> const& conditions) -> std::future<Index>
+{
+    errorif(conditions.size() != candidates.size(), "Expecting in SmartEquilibriumSolver::learnAsync as many EquilibriumConditions objects as chemical states, but got ", conditions.size(), " and ", candidates.size(), " respectively.");
+
+    // The background learner is a copy of this solver sharing its learned data, which remains alive until the learning ends
+    auto learner = std::make_shared<Impl>(*pimpl, pimpl->database);
+
+    return std::async(std::launch::async, [learner, candidates, conditions] { return learner->learnSpeculatively(candidates, conditions); });
 }
 
 auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options) -> void
@@ -471,4 +2291,64 @@ auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options)
     pimpl->setOptions(options);
 }
 
+auto SmartEquilibriumSolver::setSurrogate(SmartEquilibriumSurrogate const& surrogate) -> void
+{
+    pimpl->setSurrogate(surrogate);
+}
+
+auto SmartEquilibriumSolver::saveLearningData(String const& filename) const -> void
+{
+    pimpl->saveLearningData(filename);
+}
+
+auto SmartEquilibriumSolver::loadLearningData(String const& filename) -> void
+{
+    pimpl->loadLearningData(filename);
+}
+
+auto SmartEquilibriumSolver::saveLearningData(std::ostream& out) const -> void
+{
+    pimpl->saveLearningData(out);
+}
+
+auto SmartEquilibriumSolver::loadLearningData(std::istream& in) -> void
+{
+    pimpl->loadLearningData(in, "the given stream");
+}
+
+auto SmartEquilibriumSolver::mergeLearningData(std::istream& in) -> void
+{
+    pimpl->mergeLearningData(in);
+}
+
+auto SmartEquilibriumSolver::pruneLearningData() -> Index
+{
+    return pimpl->pruneLearningData();
+}
+
+auto SmartEquilibriumSolver::shareLearningData(SmartEquilibriumSolver const& other) -> void
+{
+    pimpl->shareLearningData(*other.pimpl);
+}
+
+auto SmartEquilibriumSolver::statistics() const -> SmartEquilibriumStatistics
+{
+    return pimpl->collectStatistics();
+}
+
+auto SmartEquilibriumSolver::statisticsPerCell() const -> Table
+{
+    return pimpl->statisticsPerCell();
+}
+
+auto SmartEquilibriumSolver::memoryUsage() const -> MemoryUsage
+{
+    return pimpl->memoryUsage();
+}
+
+auto SmartEquilibriumSolver::resetStatistics() -> void
+{
+    pimpl->statistics = {};
+}
+
 } // namespace Reaktoro
@@ -17,15 +17,21 @@
 
 #pragma once
 
+// C++ includes
+#include <future>
+#include <iosfwd>
+
 // Reaktoro includes
 #include <Reaktoro/Common/HashUtils.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/MemoryUsage.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/ODML/ClusterConnectivity.hpp>
+#include <Reaktoro/ODML/KdTree.hpp>
 #include <Reaktoro/ODML/PriorityQueue.hpp>
 
 namespace Reaktoro {
@@ -36,8 +42,23 @@ class ChemicalState;
 class ChemicalSystem;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
+class Table;
 struct SmartEquilibriumOptions;
 struct SmartEquilibriumResult;
+struct SmartEquilibriumStatistics;
+
+/// The function type for surrogate models used to predict chemical equilibrium states in a SmartEquilibriumSolver.
+/// A surrogate model (e.g., a trained neural network or Gaussian process)
+/// predicts the species amounts at chemical equilibrium for a batch of
+/// calculations in a single call. Each column of `inputs` is the input vector
+/// of a calculation, consisting of the values of the *w* input variables (see
+/// EquilibriumSpecs::namesInputs) followed by the amounts of the conservative
+/// components *c*. The surrogate model returns a matrix with the predicted
+/// species amounts of each calculation (one column per calculation) and the
+/// flags indicating which calculations it has predicted (`false` for those
+/// outside its domain of validity, whose columns are ignored).
+/// @param inputs The input vectors (w, c) of the calculations (one per column)
+using SmartEquilibriumSurrogate = Fn<Pair<MatrixXd, Vec<bool>>(MatrixXdConstRef inputs)>;
 
 /// Used for calculating chemical equilibrium states using an on-demand machine learning (ODML) strategy.
 class SmartEquilibriumSolver
@@ -69,6 +90,12 @@ public:
     auto solve(ChemicalState& state) -> SmartEquilibriumResult;
 
     /// Equilibrate a chemical state respecting given reactivity restrictions.
+    /// Learned calculations are only used in predictions of calculations with
+    /// the same pattern of restrictions (i.e., the same species that cannot
+    /// increase or decrease, regardless of their bounds). A predicted state is
+    /// only accepted if its species amounts respect the bounds imposed by the
+    /// restrictions within the relative tolerance of the acceptance test, after
+    /// which they are set to these bounds if outside them.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult;
@@ -91,6 +118,11 @@ public:
     //=================================================================================================================
 
     /// Equilibrate a chemical state and compute sensitivity derivatives.
+    /// If a learning operation is performed, the sensitivity derivatives are
+    /// those computed in the full chemical equilibrium calculation. If the
+    /// equilibrium state is predicted, they are the sensitivity derivatives at
+    /// the reference state of the record used in the first-order Taylor
+    /// prediction, which is accurate to the same order as the acceptance test.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param[out] sensitivity The sensitivity derivatives of the equilibrium state with respect to given input conditions
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult;
@@ -114,6 +146,95 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR BATCHES OF CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a batch of chemical states.
+    /// The chemical states are first predicted in parallel using the learned
+    /// records. Those whose predictions are not accepted are then predicted
+    /// with the surrogate model (see @ref setSurrogate), in a single call for
+    /// the whole batch, and those still not accepted are finally learned with
+    /// full chemical equilibrium calculations. These are distributed among a
+    /// work-stealing pool of worker threads (see EquilibriumOptions::threads
+    /// in SmartEquilibriumOptions::learning), each using its own copy of this
+    /// solver sharing its learned data. Each new record is stored as soon as
+    /// it is learned, and the prediction of every remaining chemical state is
+    /// tried again before learning it.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    auto solve(Vec<ChemicalState>& states) -> Vec<SmartEquilibriumResult>;
+
+    /// Equilibrate a batch of chemical states respecting given constraint conditions (one per chemical state).
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium in each calculation
+    /// @see solve(Vec<ChemicalState>&)
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartEquilibriumResult>;
+
+    //=================================================================================================================
+    //
+    // ASYNCHRONOUS CHEMICAL EQUILIBRIUM METHODS
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a chemical state in a background thread respecting given constraint conditions.
+    /// The result, or any error of the calculation, is obtained from the
+    /// returned future. Until then, neither this solver nor `state` may be used.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium (copied)
+    auto solveAsync(ChemicalState& state, EquilibriumConditions const& conditions) -> std::future<SmartEquilibriumResult>;
+
+    /// Equilibrate a batch of chemical states in a background thread respecting given constraint conditions (one per chemical state).
+    /// The result, or any error of the calculations, is obtained from the
+    /// returned future. Until then, neither this solver nor `states` may be used.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium in each calculation (copied)
+    /// @see solve(Vec<ChemicalState>&)
+    auto solveAsync(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> std::future<Vec<SmartEquilibriumResult>>;
+
+    /// Learn in a background thread the chemical states likely to be needed in upcoming calculations.
+    /// This is meant to use otherwise idle cores (e.g., while transport
+    /// equations are solved, or in steps with few learning operations) to
+    /// turn future learning operations into predictions. The candidates could
+    /// be, for example, the states ahead of a reaction front extrapolated with
+    /// the sensitivity derivatives of recent calculations, or perturbations of
+    /// recently learned states. They are learned one after the other by a
+    /// copy of this solver sharing its learned data, skipping those already
+    /// predicted, and each successful full calculation is stored as soon as
+    /// it is performed. Unlike in @ref solveAsync, this solver can be used
+    /// concurrently, as in the solvers sharing learned data (see
+    /// @ref shareLearningData). The number of stored records is obtained from
+    /// the returned future, whose destructor waits for the learning to end.
+    /// @param candidates The initial guesses for the calculations at the candidate conditions (copied)
+    /// @param conditions The constraint conditions of the candidate calculations (copied, one per candidate)
+    auto learnAsync(Vec<ChemicalState> const& candidates, Vec<EquilibriumConditions> const& conditions) -> std::future<Index>;
+
+    //=================================================================================================================
+    //
+    // TRAINING METHODS
+    //
+    //=================================================================================================================
+
+    /// Pre-train the learned data with full chemical equilibrium calculations at given sample conditions.
+    /// This is meant to be used ahead of a simulation, with samples covering
+    /// the expected range of its conditions (e.g., Latin hypercube points in
+    /// temperature, pressure, and component amounts), so that its first
+    /// calculations are already predicted. The full calculations, with
+    /// sensitivity derivatives, are performed in parallel by the worker
+    /// threads used in batched calculations (see @ref solve(Vec<ChemicalState>&)).
+    /// Their records are then stored in the order of the samples, classified
+    /// in clusters as in any learning operation, except those whose chemical
+    /// states are already predicted by the records stored before them, which
+    /// are redundant. Failed calculations are not stored either. The trained
+    /// learned data can be persisted with @ref saveLearningData and loaded in
+    /// production runs with @ref loadLearningData. The samples themselves
+    /// are not changed, and the statistics of this solver are not affected.
+    /// @param samples The initial guesses for the calculations at the sample conditions
+    /// @param conditions The constraint conditions of the calculations at the sample conditions (one per sample)
+    /// @return The number of records stored in the learned data
+    auto train(Vec<ChemicalState> const& samples, Vec<EquilibriumConditions> const& conditions) -> Index;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -123,6 +244,116 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(SmartEquilibriumOptions const& options) -> void;
 
+    /// Set the surrogate model used to predict chemical equilibrium states when no learned record produces an accepted prediction.
+    /// A prediction of the surrogate model is accepted only if the predicted
+    /// species amounts pass the negative amount test (see
+    /// SmartEquilibriumOptions::reltol_negative_amounts) and satisfy the mass
+    /// balance constraints within SmartEquilibriumOptions::reltol, after their
+    /// correction if SmartEquilibriumOptions::mass_balance_iterations is
+    /// positive. Otherwise, a learning operation is performed as usual. The
+    /// chemical properties of an accepted state are evaluated at the predicted
+    /// species amounts. The surrogate model is not used in calculations with
+    /// sensitivity derivatives or reactivity restrictions, and it is only
+    /// supported for chemical equilibrium specifications without unknown
+    /// control variables *p* and *q* (e.g., unknown temperature or titrant
+    /// amounts). Pass an empty function to remove the surrogate model.
+    auto setSurrogate(SmartEquilibriumSurrogate const& surrogate) -> void;
+
+    /// Save the learned input-output data of this SmartEquilibriumSolver object in a binary file.
+    /// The file stores, for each learned calculation, the reference input
+    /// variables *w* and component amounts *c*, the species amounts and
+    /// serialized chemical properties, the indices of the primary and secondary
+    /// species, and the sensitivity matrices used by EquilibriumPredictor. The
+    /// usage counts of the records and clusters are stored as well, so that
+    /// their search order is preserved. All numbers are stored in native binary
+    /// representation, so files should only be loaded on machines with the same
+    /// endianness.
+    /// @param filename The path of the file.
+    auto saveLearningData(String const& filename) const -> void;
+
+    /// Load the learned input-output data of a SmartEquilibriumSolver object from a binary file.
+    /// The learned data currently stored in this solver (and in those sharing
+    /// it, see @ref shareLearningData) is replaced. The file must have been
+    /// produced with @ref saveLearningData by a SmartEquilibriumSolver object
+    /// constructed with the same chemical system and specifications.
+    /// @param filename The path of the file.
+    auto loadLearningData(String const& filename) -> void;
+
+    /// Save the learned input-output data of this SmartEquilibriumSolver object in a binary stream.
+    /// The data is written in the same format as in @ref saveLearningData(String const&) const,
+    /// so that it can be sent to other processes (e.g., via MPI) as a buffer of bytes.
+    auto saveLearningData(std::ostream& out) const -> void;
+
+    /// Load the learned input-output data of a SmartEquilibriumSolver object from a binary stream.
+    /// @see loadLearningData(String const&)
+    auto loadLearningData(std::istream& in) -> void;
+
+    /// Merge the learned input-output data of another SmartEquilibriumSolver object, read from a binary stream, into the learned data of this one.
+    /// Unlike @ref loadLearningData, the learned data currently stored in this
+    /// solver is kept, and each record read from the stream is stored as if it
+    /// had been learned by this solver, which may remove least used records
+    /// and split temperature-pressure cells according to the options. Records
+    /// with the same reference input values and primary species as existing
+    /// ones are skipped, so that the learned data of other solvers can be
+    /// merged repeatedly (e.g., after each time step of a distributed
+    /// reactive transport simulation) without duplicating records. The stream
+    /// must have been produced with @ref saveLearningData by a
+    /// SmartEquilibriumSolver object constructed with the same chemical system
+    /// and specifications.
+    auto mergeLearningData(std::istream& in) -> void;
+
+    /// Remove the learned records dominated by more used records in their clusters.
+    /// The records of each cluster are visited in decreasing order of usage
+    /// count, and a record is removed if its reference input vector (w, c)
+    /// passes the acceptance test of a more used record kept in the cluster,
+    /// which then inherits its usage count. This is also performed
+    /// periodically during learning operations if
+    /// SmartEquilibriumOptions::prune_interval is positive.
+    /// @return The number of removed records
+    auto pruneLearningData() -> Index;
+
+    /// Share the learned input-output data of another SmartEquilibriumSolver object with this one.
+    /// After this call, both solvers store and search their learned calculations
+    /// in the same knowledge database, so that a learning operation performed by
+    /// one of them can be used in the predictions of the other. The solvers can
+    /// be used concurrently in different threads: searches are performed under a
+    /// shared lock, whereas the storage of new records and the update of their
+    /// priorities are performed under an exclusive lock. The learned data
+    /// previously stored in this solver is discarded. Both solvers must have
+    /// been constructed with the same chemical system and specifications.
+    /// @note Copies of a SmartEquilibriumSolver object do not share their learned data.
+    auto shareLearningData(SmartEquilibriumSolver const& other) -> void;
+
+    /// Return the cumulative statistics of the smart chemical equilibrium calculations performed with this solver.
+    /// These comprise the number of accepted predictions and learning
+    /// operations, the number of records tested in them, and their timings,
+    /// accumulated since construction or the last call to @ref resetStatistics.
+    /// They also describe the current learned data (e.g., number of cells,
+    /// clusters and records, and its approximate memory), which is shared with
+    /// other solvers after @ref shareLearningData. Use
+    /// SmartEquilibriumStatistics::table to export them.
+    auto statistics() const -> SmartEquilibriumStatistics;
+
+    /// Return a table with the temperature-pressure bounds and the number of clusters and records of each cell in the learned data.
+    /// Only cells without subcells are listed, one per row, since these are
+    /// the cells that contain learned data.
+    auto statisticsPerCell() const -> Table;
+
+    /// Return the approximate memory used by this solver, with a breakdown into its components.
+    /// The breakdown comprises the underlying EquilibriumSolver object, the
+    /// learned data (whose total is also reported in
+    /// SmartEquilibriumStatistics::memory) split into stored states,
+    /// sensitivity derivatives, input vectors and acceptance test data, and
+    /// the copies of this solver used by worker threads in batched
+    /// calculations. The learned data is included even if shared with other
+    /// solvers (see @ref shareLearningData). Use MemoryUsageLogger to log it
+    /// periodically in long runs.
+    auto memoryUsage() const -> MemoryUsage;
+
+    /// Reset the cumulative statistics of the smart chemical equilibrium calculations performed with this solver.
+    /// The learned data is not affected.
+    auto resetStatistics() -> void;
+
     /// The record of the knowledge database containing input, output, and derivatives data.
     struct Record
     {
@@ -148,11 +379,35 @@ public:
         /// The hash of the indices of the primary species for this cluster.
         Index label = 0;
 
+        /// The hash of the pattern of reactivity restrictions under which the records in this cluster were learned (zero if none).
+        Index restrictionslabel = 0;
+
         /// The records stored in this cluster with learning data.
-        Deque<Record> records;
+        /// Records are not modified once stored, so that copies of the learned
+        /// data share them. They are removed by moving the last record into the
+        /// place of the removed one (see PriorityQueue::removeLast).
+        Deque<SharedPtr<Record>> records;
 
         /// The priority queue for the records based on their usage count.
         PriorityQueue priority;
+
+        /// The spatial index of the records in this cluster based on their scaled input vectors (w, c).
+        KdTree tree;
+
+        /// The scaling factors applied to the input vectors (w, c) of the records before their insertion in #tree.
+        VectorXd scaling;
+
+        /// The derivatives of the chemical potentials of the primary species with respect to (w, c) of all records, stacked in the order of the records.
+        MatrixXd dmudx;
+
+        /// The chemical potentials of the primary species at the reference states of all records, stacked in the order of the records.
+        VectorXd mu0;
+
+        /// The intercepts `mu0 - dmudx*x0` of the first-order Taylor approximations of the chemical potentials of all records, where `x0` is the input vector (w, c) of each record.
+        VectorXd intercepts;
+
+        /// The offsets of the rows (entries) of each record in #dmudx, #mu0 and #intercepts.
+        Indices offsets;
     };
 
     /// The collection of clusters containing learned input-output data associated to a temperature-pressure grid cell.
@@ -166,6 +421,28 @@ public:
 
         /// The priority queue for the clusters based on their usage counts.
         PriorityQueue priority;
+
+        /// The lower bound of the temperature interval covered by this cell (in K).
+        double Tmin = 0.0;
+
+        /// The upper bound of the temperature interval covered by this cell (in K).
+        double Tmax = 0.0;
+
+        /// The lower bound of the pressure interval covered by this cell (in Pa).
+        double Pmin = 0.0;
+
+        /// The upper bound of the pressure interval covered by this cell (in Pa).
+        double Pmax = 0.0;
+
+        /// The number of splits that produced this cell from a cell in Grid::cells.
+        Index level = 0;
+
+        /// The four cells covering the quadrants of this cell after it has been split (empty if not split).
+        /// The quadrants are ordered as (lower T, lower P), (upper T, lower P),
+        /// (lower T, upper P), (upper T, upper P). When a cell is split, its
+        /// clusters are distributed among its subcells, so that only cells without
+        /// subcells contain learned data.
+        Vec<Cell> subcells;
     };
 
     /// The temperature-pressure grid cells containing learned input-output data.
@@ -174,7 +451,8 @@ public:
         /// The hash table used to access a temperature-pressure grid cell containing learned computations.
         /// Note the use of `long` as number type for a temperature-pressure pairs. Temperatures and
         /// pressures are rounded to nearest checkpoints based on provided temperature/pressure step
-        /// lengths for discretization.
+        /// lengths for discretization. These cells may be further subdivided (see Cell::subcells)
+        /// when SmartEquilibriumOptions::max_cell_records is positive.
         Map<Pair<long, long>, Cell> cells;
     };
 
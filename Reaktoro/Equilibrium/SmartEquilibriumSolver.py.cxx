@@ -15,10 +15,15 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <sstream>
+
 // pybind11 includes
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -31,22 +36,67 @@
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
 using namespace Reaktoro;
 
+// Equilibrate one chemical state per cell with temperatures (in K), pressures (in Pa) and initial
+// amounts of conservative components given cell-wise in arrays, returning the species amounts in
+// each cell (one row per cell) and the result of each calculation. The cells are equilibrated as a
+// batch, so that the surrogate model of the solver (if any) is called once for all of them.
+auto solveCells(SmartEquilibriumSolver& solver, ChemicalState const& state, EquilibriumConditions const& conditions, ArrayXdConstRef const& T, ArrayXdConstRef const& P, ArrayXXdConstRef const& b) -> std::tuple<ArrayXXd, Vec<SmartEquilibriumResult>>
+{
+    const auto Ncells = T.size();
+    errorif(P.size() != Ncells, "Expecting as many pressure values as temperature values in batched SmartEquilibriumSolver::solve, but got ", P.size(), " and ", Ncells, " respectively.");
+    errorif(b.rows() != Ncells, "Expecting one row of initial component amounts per cell in batched SmartEquilibriumSolver::solve, but got ", b.rows(), " rows for ", Ncells, " cells.");
+
+    Vec<ChemicalState> cellstates(Ncells, state);
+    Vec<EquilibriumConditions> cellconditions(Ncells, conditions);
+    for(auto i = 0; i < Ncells; ++i)
+    {
+        cellstates[i].setTemperature(T[i]);
+        cellstates[i].setPressure(P[i]);
+        cellconditions[i].temperature(T[i]);
+        cellconditions[i].pressure(P[i]);
+        cellconditions[i].setInitialComponentAmounts(b.row(i).transpose().matrix());
+    }
+
+    const auto results = solver.solve(cellstates, cellconditions);
+
+    ArrayXXd n(Ncells, state.system().species().size());
+    for(auto i = 0; i < Ncells; ++i)
+        n.row(i) = cellstates[i].speciesAmounts().cast<double>().transpose();
+
+    return { n, results };
+}
+
 void exportSmartEquilibriumSolver(py::module& m)
 {
     py::class_<SmartEquilibriumSolver>(m, "SmartEquilibriumSolver")
         .def(py::init<ChemicalSystem const&>())
         .def(py::init<EquilibriumSpecs const&>())
 
-        .def("solve", py::overload_cast<ChemicalState&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state.", py::arg("state"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given reactivity restrictions.", py::arg("state"), py::arg("restrictions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state.", py::arg("state"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given reactivity restrictions.", py::arg("state"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), py::call_guard<py::gil_scoped_release>(), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("solve", solveCells, py::call_guard<py::gil_scoped_release>(), "Equilibrate one chemical state per cell with cell-wise temperatures (in K), pressures (in Pa) and initial component amounts (one row per cell), returning the species amounts in each cell (one row per cell) and the result of each calculation.", py::arg("state"), py::arg("conditions"), py::arg("T"), py::arg("P"), py::arg("b"))
 
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("restrictions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
-        .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
+        .def("train", &SmartEquilibriumSolver::train, py::call_guard<py::gil_scoped_release>(), "Pre-train the learned data with full chemical equilibrium calculations at given sample conditions, skipping those already predicted by the records stored before them, and return the number of stored records.", py::arg("samples"), py::arg("conditions"))
 
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
+        .def("setSurrogate", &SmartEquilibriumSolver::setSurrogate, "Set the surrogate model used to predict chemical equilibrium states when no learned record produces an accepted prediction. It is called with the input vectors (w, c) of a batch of calculations (one per column) and returns the predicted species amounts (one column per calculation) and a list of flags indicating which calculations were predicted.", py::arg("surrogate"))
+        .def("saveLearningData", py::overload_cast<String const&>(&SmartEquilibriumSolver::saveLearningData, py::const_))
+        .def("loadLearningData", py::overload_cast<String const&>(&SmartEquilibriumSolver::loadLearningData))
+        .def("learningDataBytes", [](SmartEquilibriumSolver const& self) { std::ostringstream out; self.saveLearningData(out); return py::bytes(out.str()); }, "Return the learned data of this solver as a buffer of bytes (e.g., to be sent to other processes).")
+        .def("mergeLearningData", [](SmartEquilibriumSolver& self, py::bytes const& data) { std::istringstream in(std::string(data)); self.mergeLearningData(in); }, "Merge the learned data in a buffer of bytes produced with learningDataBytes into the learned data of this solver.")
+        .def("pruneLearningData", &SmartEquilibriumSolver::pruneLearningData, "Remove the learned records dominated by more used records in their clusters, returning the number of removed records.")
+        .def("shareLearningData", &SmartEquilibriumSolver::shareLearningData)
+        .def("statistics", &SmartEquilibriumSolver::statistics, "Return the cumulative statistics of the smart chemical equilibrium calculations performed with this solver.")
+        .def("statisticsPerCell", &SmartEquilibriumSolver::statisticsPerCell, "Return a table with the temperature-pressure bounds and the number of clusters and records of each cell in the learned data.")
+        .def("memoryUsage", &SmartEquilibriumSolver::memoryUsage, "Return the approximate memory used by this solver, with a breakdown into its components.")
+        .def("resetStatistics", &SmartEquilibriumSolver::resetStatistics, "Reset the cumulative statistics of the smart chemical equilibrium calculations performed with this solver.")
         ;
 }
@@ -16,16 +16,20 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cstdio>
 #include <iostream>
+#include <sstream>
 
 // Catch includes
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
@@ -115,4 +119,953 @@ TEST_CASE("Testing SmartEquilibriumSolver", "[SmartEquilibriumSolver]")
         CHECK( result.learned() );
         CHECK( result.iterations() == 17 );
     }
+
+    WHEN("nearest neighbor searches are used to find records in the clusters")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.nearest_neighbors = 3;
+        options.packed_acceptance_test = true; // also test the acceptance tests of all records in a cluster at once
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.iterations() == 0 );
+    }
+
+    WHEN("the learned data is shared between smart equilibrium solvers")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver solver1(system);
+        SmartEquilibriumSolver solver2(system);
+
+        solver2.shareLearningData(solver1);
+
+        SmartEquilibriumSolver solver3(solver1); // a copy does not share the learned data
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver1.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        ChemicalState state3 = state;
+
+        result = solver2.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        result = solver3.solve(state3);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+    }
+
+    WHEN("the learned data is saved to and loaded from a file")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver solver1(system);
+        SmartEquilibriumSolver solver2(system);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver1.solve(state);
+
+        CHECK( result.learned() );
+
+        const auto filename = "SmartEquilibriumSolver.test.dat";
+
+        solver1.saveLearningData(filename);
+        solver2.loadLearningData(filename);
+
+        std::remove(filename);
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        ChemicalState state1 = state;
+
+        solver1.solve(state1);
+
+        result = solver2.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( result.iterations() == 0 );
+
+        CHECK( state.speciesAmounts().isApprox(state1.speciesAmounts()) );
+
+        CHECK_THROWS( solver2.loadLearningData("SmartEquilibriumSolver.test.missing.dat") );
+    }
+
+    WHEN("the learned data of other solvers is merged through binary streams")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver solver1(system);
+        SmartEquilibriumSolver solver2(system);
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        ChemicalState hotstate(system);
+        hotstate.temperature(150.0, "celsius");
+        hotstate.pressure(100.0, "bar");
+        hotstate.set("H2O(aq)", 1.0, "kg");
+        hotstate.set("Calcite", 1.0, "mol");
+
+        CHECK( solver1.solve(state).learned() );
+        CHECK( solver2.solve(hotstate).learned() );
+
+        auto merge = [](SmartEquilibriumSolver const& from, SmartEquilibriumSolver& to)
+        {
+            std::stringstream buffer;
+            from.saveLearningData(buffer);
+            to.mergeLearningData(buffer);
+        };
+
+        merge(solver1, solver2);
+
+        CHECK( solver2.statistics().records == 2 );
+
+        merge(solver1, solver2); // the records already merged are not duplicated
+
+        CHECK( solver2.statistics().records == 2 );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        auto result = solver2.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        std::stringstream buffer;
+        solver2.saveLearningData(buffer);
+        solver1.loadLearningData(buffer);
+
+        CHECK( solver1.statistics().records == 2 );
+
+        std::stringstream garbage("not learned data");
+        CHECK_THROWS( solver1.mergeLearningData(garbage) );
+    }
+
+    WHEN("compact records are used with a maximum number of records")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.compact_records = true;
+        options.max_records = 1;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() ); // the compact record is enough for the prediction
+
+        state = ChemicalState(system);
+        state.temperature(50.0, "celsius");
+        state.pressure(10.0, "bar");
+        state.set("H2O(aq)", 2.0, "kg");
+        state.set("Calcite", 2.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() ); // the first record is now removed
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() );
+    }
+
+    WHEN("the least used records are removed to keep the maximum number of records")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.max_records = 2;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        auto solve = [&](double T, double P, double water, double calcite)
+        {
+            ChemicalState state(system);
+            state.temperature(T, "celsius");
+            state.pressure(P, "bar");
+            state.set("H2O(aq)", water, "kg");
+            state.set("Calcite", calcite, "mol");
+            return solver.solve(state);
+        };
+
+        CHECK( solve(25.0, 1.0, 1.0, 1.0).learned() );
+        CHECK( solve(25.0, 1.0, 1.01, 1.01).predicted() ); // the first record is now used once
+        CHECK( solve(50.0, 10.0, 2.0, 2.0).learned() );
+        CHECK( solver.statistics().records == 2 );
+
+        CHECK( solve(90.0, 100.0, 0.5, 5.0).learned() ); // the second record, never used, is removed
+        CHECK( solver.statistics().records == 2 );
+
+        CHECK( solve(25.0, 1.0, 1.01, 1.01).predicted() ); // the most used record is kept
+        CHECK( solve(50.0, 10.0, 2.0, 2.0).learned() );
+        CHECK( solver.statistics().records == 2 );
+    }
+
+    WHEN("the Taylor matrices of the records are stored in single precision")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver dsolver(system);
+
+        SmartEquilibriumOptions options;
+        options.single_precision_records = true;
+
+        SmartEquilibriumSolver fsolver(system);
+        fsolver.setOptions(options);
+
+        ChemicalState state0(system);
+        state0.temperature(25.0, "celsius");
+        state0.pressure(1.0, "bar");
+        state0.set("H2O(aq)", 1.0, "kg");
+        state0.set("Calcite", 1.0, "mol");
+
+        ChemicalState dstate(state0);
+        ChemicalState fstate(state0);
+
+        CHECK( dsolver.solve(dstate).learned() );
+        CHECK( fsolver.solve(fstate).learned() );
+
+        CHECK( fsolver.statistics().memory < dsolver.statistics().memory );
+
+        state0.temperature(30.0, "celsius");
+        state0.pressure(2.0, "bar");
+        state0.set("H2O(aq)", 1.1, "kg");
+        state0.set("Calcite", 1.1, "mol");
+
+        dstate = state0;
+        fstate = state0;
+
+        EquilibriumSpecs specs = EquilibriumSpecs::TP(system);
+        EquilibriumSensitivity dsensitivity(specs);
+        EquilibriumSensitivity fsensitivity(specs);
+
+        CHECK( dsolver.solve(dstate, dsensitivity).predicted() );
+        CHECK( fsolver.solve(fstate, fsensitivity).predicted() );
+
+        const VectorXd dn = dstate.speciesAmounts();
+        const VectorXd fn = fstate.speciesAmounts();
+
+        CHECK( fn.isApprox(dn, 1e-6) );
+        CHECK( fsensitivity.dndc().isApprox(dsensitivity.dndc(), 1e-6) );
+
+        std::stringstream buffer;
+        fsolver.saveLearningData(buffer);
+        dsolver.loadLearningData(buffer);
+
+        CHECK( dsolver.statistics().records == 1 );
+    }
+
+    WHEN("temperature-pressure cells are split and neighbor cells are searched")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.temperature_step = 100.0; // the temperature interval of the initial cell containing 25 and 50 celsius is [250, 350] K
+        options.max_cell_records = 1;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() );
+
+        state = ChemicalState(system);
+        state.temperature(50.0, "celsius");
+        state.pressure(10.0, "bar");
+        state.set("H2O(aq)", 2.0, "kg");
+        state.set("Calcite", 2.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() ); // the cell now has two records and is split, the first record in subcell [250, 300] K and the second in [300, 350] K
+
+        state = ChemicalState(system);
+        state.temperature(26.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() ); // the record at 25 celsius is in the same subcell
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+
+        options.search_neighbor_cells = true;
+        solver.setOptions(options);
+
+        result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() ); // the record at 25 celsius is in the neighbor subcell [250, 300] K
+    }
+
+    WHEN("sensitivity derivatives are computed")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver solver(system);
+        EquilibriumSolver exactsolver(system);
+
+        EquilibriumSensitivity sensitivity(EquilibriumSpecs::TP(system));
+        EquilibriumSensitivity exactsensitivity(EquilibriumSpecs::TP(system));
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        ChemicalState exactstate = state;
+
+        exactsolver.solve(exactstate, exactsensitivity);
+
+        result = solver.solve(state, sensitivity);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        CHECK( sensitivity.dndw().isApprox(exactsensitivity.dndw()) );
+        CHECK( sensitivity.dndc().isApprox(exactsensitivity.dndc()) );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        sensitivity = EquilibriumSensitivity(EquilibriumSpecs::TP(system));
+
+        result = solver.solve(state, sensitivity);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        CHECK( sensitivity.dndw().isApprox(exactsensitivity.dndw()) ); // the sensitivity derivatives of the record used in the prediction
+        CHECK( sensitivity.dndc().isApprox(exactsensitivity.dndc()) );
+    }
+
+    WHEN("reactivity restrictions are imposed")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        EquilibriumRestrictions restrictions(system);
+        restrictions.cannotDecrease("Calcite");
+
+        SmartEquilibriumSolver solver(system);
+
+        SmartEquilibriumResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state, restrictions);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+        CHECK( state.speciesAmount("Calcite") >= 1.0 );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        ChemicalState unrestrictedstate = state;
+
+        result = solver.solve(state, restrictions);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+        CHECK( state.speciesAmount("Calcite") >= 1.1 ); // the predicted amount of calcite is not below its initial amount
+
+        result = solver.solve(unrestrictedstate);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() ); // the record learned with restrictions is not used without them
+    }
+
+    WHEN("statistics of the smart equilibrium calculations are collected")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        ChemicalState state(system);
+
+        SmartEquilibriumSolver solver(system);
+
+        SmartEquilibriumResult result;
+
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() );
+        CHECK( result.prediction.records_tested == 0 );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.predicted() );
+        CHECK( result.prediction.records_tested == 1 );
+
+        state = ChemicalState(system);
+        state.temperature(50.0, "celsius");
+        state.pressure(10.0, "bar");
+        state.set("H2O(aq)", 2.0, "kg");
+        state.set("Calcite", 2.0, "mol");
+
+        result = solver.solve(state);
+
+        CHECK( result.learned() );
+
+        auto stats = solver.statistics();
+
+        CHECK( stats.calculations == 3 );
+        CHECK( stats.predictions == 1 );
+        CHECK( stats.learnings == 2 );
+        CHECK( stats.records_tested_accepted == 1 );
+        CHECK( stats.records == 2 );
+        CHECK( stats.clusters >= 1 );
+        CHECK( stats.cells >= 1 );
+        CHECK( stats.max_records_per_cluster >= 1 );
+        CHECK( stats.memory > 0 );
+        CHECK( stats.hitRate() == Approx(1.0/3.0) );
+
+        const auto usage = solver.memoryUsage();
+
+        CHECK( usage.component("learned data").total() == stats.memory );
+        CHECK( usage.component("learned data").component("states").total() > 0 );
+        CHECK( usage.component("learned data").component("sensitivities").total() > 0 );
+        CHECK( usage.component("EquilibriumSolver").component("setup").total() > 0 );
+        CHECK( usage.total() > stats.memory );
+        CHECK( stats.missRate() == Approx(2.0/3.0) );
+        CHECK( stats.averageRecordsTestedBeforeAcceptance() == Approx(1.0) );
+        CHECK( stats.learningTimeShare() > 0.0 );
+        CHECK( stats.learningTimeShare() <= 1.0 );
+
+        const auto table = stats.table();
+
+        CHECK( table.rows() == 1 );
+        CHECK( table.column("Calculations").integers()[0] == 3 );
+        CHECK( table.column("HitRate").floats()[0] == Approx(1.0/3.0) );
+
+        const auto cells = solver.statisticsPerCell();
+
+        CHECK( cells.rows() == stats.cells );
+
+        solver.resetStatistics();
+
+        stats = solver.statistics();
+
+        CHECK( stats.calculations == 0 );
+        CHECK( stats.predictions == 0 );
+        CHECK( stats.records == 2 ); // the learned data is not affected by the reset
+    }
+
+    WHEN("a surrogate model is used to predict a batch of chemical states")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        EquilibriumSolver exactsolver(system);
+
+        Vec<ChemicalState> states;
+        Vec<ChemicalState> exactstates;
+
+        for(auto k = 0; k < 3; ++k)
+        {
+            ChemicalState state(system);
+            state.temperature(25.0 + 10.0*k, "celsius");
+            state.pressure(1.0 + k, "bar");
+            state.set("H2O(aq)", 1.0, "kg");
+            state.set("Calcite", 1.0 + k, "mol");
+            states.push_back(state);
+
+            exactsolver.solve(state);
+            exactstates.push_back(state);
+        }
+
+        // The surrogate model returns the exact species amounts, but refuses to predict the second calculation
+        Index numcalls = 0;
+        SmartEquilibriumSurrogate surrogate = [&](MatrixXdConstRef inputs) -> Pair<MatrixXd, Vec<bool>>
+        {
+            numcalls += 1;
+            MatrixXd n(system.species().size(), inputs.cols());
+            for(auto j = 0; j < inputs.cols(); ++j)
+                n.col(j) = exactstates[j].speciesAmounts().cast<double>().matrix();
+            return { n, { true, false, true } };
+        };
+
+        SmartEquilibriumSolver solver(system);
+        solver.setSurrogate(surrogate);
+
+        const auto results = solver.solve(states);
+
+        CHECK( numcalls == 1 ); // a single call for the whole batch
+
+        CHECK( results[0].predicted() );
+        CHECK( results[0].prediction.surrogate );
+        CHECK( results[1].learned() );
+        CHECK( results[1].succeeded() );
+        CHECK( results[2].predicted() );
+        CHECK( results[2].prediction.surrogate );
+
+        CHECK( largestRelativeDifference(states[0].speciesAmounts(), exactstates[0].speciesAmounts()) == Approx(0.0).margin(1e-12) );
+        CHECK( largestRelativeDifference(states[2].speciesAmounts(), exactstates[2].speciesAmounts()) == Approx(0.0).margin(1e-12) );
+        CHECK( states[2].temperature() == Approx(45.0 + 273.15) );
+
+        CHECK( solver.statistics().predictions == 2 );
+        CHECK( solver.statistics().learnings == 1 );
+
+        // A surrogate model whose predictions violate the mass balance constraints is rejected and the state is learned instead
+        solver.setSurrogate([&](MatrixXdConstRef inputs) -> Pair<MatrixXd, Vec<bool>>
+        {
+            MatrixXd n = 2.0 * exactstates[0].speciesAmounts().cast<double>().matrix().replicate(1, inputs.cols());
+            return { n, Vec<bool>(inputs.cols(), true) };
+        });
+
+        ChemicalState state(system);
+        state.temperature(80.0, "celsius");
+        state.pressure(50.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        const auto result = solver.solve(state);
+
+        CHECK( result.learned() );
+        CHECK( result.succeeded() );
+        CHECK_FALSE( result.prediction.surrogate );
+    }
+
+    WHEN("packed acceptance tests are performed for a batch of chemical states")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.packed_acceptance_test = true;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        SmartEquilibriumSolver unbatchedsolver(system);
+        unbatchedsolver.setOptions(options);
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        solver.solve(state);
+        unbatchedsolver.solve(state);
+
+        // Chemical states close to the learned one start their search in the same cluster and are tested together
+        Vec<ChemicalState> states(4, state);
+        for(auto k = 0; k < 4; ++k)
+        {
+            states[k].temperature(25.0 + 0.5*k, "celsius");
+            states[k].set("H2O(aq)", 1.0 + 0.02*k, "kg");
+            states[k].set("Calcite", 1.0 + 0.02*k, "mol");
+        }
+
+        Vec<ChemicalState> unbatchedstates = states;
+
+        const auto results = solver.solve(states);
+
+        for(auto k = 0; k < 4; ++k)
+        {
+            const auto result = unbatchedsolver.solve(unbatchedstates[k]);
+            CHECK( results[k].predicted() == result.predicted() );
+            CHECK( largestRelativeDifference(states[k].speciesAmounts(), unbatchedstates[k].speciesAmounts()) == Approx(0.0).margin(1e-12) );
+        }
+
+        CHECK( results[0].predicted() );
+    }
+
+    WHEN("a batch of similar chemical states is solved without learned data")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.learning.threads = 1; // the learning operations are then performed in the order of the chemical states
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        Vec<ChemicalState> states(4, ChemicalState(system));
+        for(auto k = 0; k < 4; ++k)
+        {
+            states[k].temperature(25.0 + 0.1*k, "celsius");
+            states[k].pressure(1.0, "bar");
+            states[k].set("H2O(aq)", 1.0 + 0.002*k, "kg");
+            states[k].set("Calcite", 1.0, "mol");
+        }
+
+        const auto results = solver.solve(states);
+
+        // The first chemical state is learned and the others are predicted when tried again with the newly learned record
+        CHECK( results[0].learned() );
+        CHECK( results[0].succeeded() );
+        for(auto k = 1; k < 4; ++k)
+            CHECK( results[k].predicted() );
+
+        CHECK( solver.statistics().learnings == 1 );
+        CHECK( solver.statistics().predictions == 3 );
+    }
+
+    WHEN("the learned data is pre-trained with sample conditions")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        SmartEquilibriumOptions options;
+        options.learning.threads = 2;
+
+        SmartEquilibriumSolver solver(specs);
+        solver.setOptions(options);
+
+        Vec<ChemicalState> samples(5, ChemicalState(system));
+        Vec<EquilibriumConditions> conditions(5, EquilibriumConditions(specs));
+        for(auto k = 0; k < 5; ++k)
+        {
+            const auto T = k < 4 ? 25.0 + 0.1*k : 80.0;
+            samples[k].temperature(T, "celsius");
+            samples[k].pressure(1.0, "bar");
+            samples[k].set("H2O(aq)", 1.0 + 0.002*k, "kg");
+            samples[k].set("Calcite", 1.0, "mol");
+            conditions[k].temperature(T, "celsius");
+            conditions[k].pressure(1.0, "bar");
+        }
+
+        // The similar samples at 25 celsius are predicted by the record of the first one, and only the one at 80 celsius needs another record
+        CHECK( solver.train(samples, conditions) == 2 );
+        CHECK( solver.statistics().calculations == 0 );
+        CHECK( solver.statistics().records == 2 );
+
+        ChemicalState state(system);
+        state.temperature(25.15, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.003, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        CHECK( solver.solve(state).predicted() );
+    }
+
+    WHEN("records dominated by others in their clusters are pruned")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumSolver solver1(system);
+        SmartEquilibriumSolver solver2(system);
+
+        ChemicalState state1(system);
+        state1.temperature(25.0, "celsius");
+        state1.pressure(1.0, "bar");
+        state1.set("H2O(aq)", 1.0, "kg");
+        state1.set("Calcite", 1.0, "mol");
+
+        ChemicalState state2(system);
+        state2.temperature(25.1, "celsius");
+        state2.pressure(1.0, "bar");
+        state2.set("H2O(aq)", 1.002, "kg");
+        state2.set("Calcite", 1.0, "mol");
+
+        CHECK( solver1.solve(state1).learned() );
+        CHECK( solver2.solve(state2).learned() );
+
+        // Merging the learned data of both solvers results in a near-duplicate record in the same cluster
+        std::stringstream buffer;
+        solver2.saveLearningData(buffer);
+        solver1.mergeLearningData(buffer);
+
+        CHECK( solver1.statistics().records == 2 );
+        CHECK( solver1.pruneLearningData() == 1 );
+        CHECK( solver1.statistics().records == 1 );
+        CHECK( solver1.pruneLearningData() == 0 );
+
+        CHECK( solver1.solve(state2).predicted() );
+    }
+
+    WHEN("chemical states likely to be needed next are learned in the background")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+
+        SmartEquilibriumSolver solver(specs);
+
+        Vec<ChemicalState> candidates(3, ChemicalState(system));
+        Vec<EquilibriumConditions> conditions(3, EquilibriumConditions(specs));
+        for(auto k = 0; k < 3; ++k)
+        {
+            const auto T = 25.0 + 30.0*k;
+            candidates[k].temperature(T, "celsius");
+            candidates[k].pressure(1.0, "bar");
+            candidates[k].set("H2O(aq)", 1.0, "kg");
+            candidates[k].set("Calcite", 1.0, "mol");
+            conditions[k].temperature(T, "celsius");
+            conditions[k].pressure(1.0, "bar");
+        }
+
+        auto learning = solver.learnAsync(candidates, conditions);
+
+        CHECK( learning.get() == 3 );
+        CHECK( solver.statistics().records == 3 );
+        CHECK( solver.statistics().calculations == 0 );
+
+        ChemicalState state(candidates[1]);
+        state.set("H2O(aq)", 1.001, "kg");
+
+        CHECK( solver.solve(state, conditions[1]).predicted() );
+
+        // The candidates already learned are skipped
+        CHECK( solver.learnAsync(candidates, conditions).get() == 0 );
+
+        Vec<EquilibriumConditions> fewer(2, EquilibriumConditions(specs));
+        CHECK_THROWS( solver.learnAsync(candidates, fewer) );
+    }
 }
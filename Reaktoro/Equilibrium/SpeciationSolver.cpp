@@ -0,0 +1,239 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "SpeciationSolver.hpp"
+
+// Eigen includes
+#include <Eigen/LU>
+#include <Eigen/QR>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+
+namespace Reaktoro {
+
+struct SpeciationSolver::Impl
+{
+    /// The number of elements in the chemical system.
+    const Index Ne;
+
+    /// The conservation matrix of the species with respect to elements and electric charge.
+    const MatrixXd A;
+
+    /// The rank of the conservation matrix (i.e., the number of primary species).
+    const Index rankA;
+
+    /// The options of the speciation calculations.
+    EquilibriumOptions options;
+
+    /// The maximum number of iterations.
+    Index maxiters = 100;
+
+    /// The tolerance of the mass balance residuals relative to the amounts of components.
+    double tolerance = 1e-10;
+
+    /// The chemical properties evaluated during the iterations.
+    ChemicalProps props;
+
+    /// The species amounts during the iterations (as real numbers for the evaluation of chemical properties).
+    ArrayXr nr;
+
+    Impl(EquilibriumSpecs const& specs)
+    : Ne(specs.system().elements().size()), A(specs.assembleConservationMatrixN()), rankA(Eigen::ColPivHouseholderQR<MatrixXd>(A).rank()), props(specs.system())
+    {}
+
+    /// Update the chemical properties at given species amounts and return the non-ideal part of the normalized chemical potentials, i.e., *μ/RT - ln(n)*.
+    auto updateTheta(real const& T, real const& P, ArrayXdConstRef const& n) -> ArrayXd
+    {
+        nr = n.cast<real>();
+        if(options.use_ideal_activity_models)
+            props.updateIdeal(T, P, nr);
+        else props.update(T, P, nr);
+
+        const auto RT = universalGasConstant * T;
+        const ArrayXd G0 = (props.speciesStandardGibbsEnergies() / RT).cast<double>();
+        const ArrayXd lna = props.speciesActivitiesLn().cast<double>();
+        return G0 + lna - n.log();
+    }
+
+    auto solve(ChemicalState& state, real const& T, real const& P, ArrayXdConstRef const& c) -> EquilibriumResult
+    {
+        const auto begin = time();
+
+        EquilibriumResult result;
+        result.optima.succeeded = false;
+        result.optima.iterations = 0;
+
+        const auto Nn = A.cols();
+
+        ArrayXd n = state.speciesAmounts().cast<double>();
+
+        if(n.sum() <= 0.0 || (c.head(Ne) <= 0.0).any())
+            return result;
+
+        n = n.max(options.epsilon);
+
+        // Choose the primary species among the most abundant ones with linearly independent columns in A
+        // (the weights are bounded below so that species with negligible amounts can still complete the basis)
+        const ArrayXd weights = n.max(1e-6 * n.maxCoeff());
+        const MatrixXd Aw = A * weights.matrix().asDiagonal();
+        const Eigen::ColPivHouseholderQR<MatrixXd> qr(Aw);
+        const auto Nb = qr.rank();
+
+        if(Nb != rankA)
+            return result;
+        const auto Ns = Nn - Nb;
+        const auto perm = qr.colsPermutation().indices();
+        const VectorXl ip = perm.head(Nb).cast<Eigen::Index>();
+        const VectorXl is = perm.tail(Ns).cast<Eigen::Index>();
+
+        // Use only the linearly independent combinations of the mass balance equations
+        const MatrixXd QtA = qr.householderQ().transpose() * A;
+        const VectorXd Qtc = qr.householderQ().transpose() * c.matrix();
+        const MatrixXd Ap = QtA.topRows(Nb)(Eigen::all, ip);
+        const MatrixXd As = QtA.topRows(Nb)(Eigen::all, is);
+        const VectorXd b = Qtc.head(Nb);
+
+        // The stoichiometric coefficients of the primary species in the formation reactions of the secondary species
+        const MatrixXd nu = Ap.partialPivLu().solve(As);
+
+        const auto bnorm = std::max(b.cwiseAbs().maxCoeff(), c.head(Ne).maxCoeff());
+
+        ArrayXd theta = updateTheta(T, P, n);
+        VectorXd x = n(ip).log().matrix();
+        VectorXd ns, F, dx;
+        MatrixXd J;
+
+        for(Index iter = 0; iter < maxiters; ++iter)
+        {
+            // The amounts of the secondary species from the mass-action law
+            ns = (nu.transpose() * (theta(ip).matrix() + x) - theta(is).matrix()).array().exp().matrix();
+
+            n(ip) = x.array().exp();
+            n(is) = ns.array();
+
+            if(!n.allFinite())
+                return result;
+
+            F = Ap * n(ip).matrix() + As * ns - b;
+
+            J = Ap * n(ip).matrix().asDiagonal();
+            J.noalias() += As * ns.asDiagonal() * nu.transpose();
+
+            dx = J.partialPivLu().solve(-F);
+
+            // Limit the Newton step so that no amount changes by more than a factor of exp(2)
+            const auto dxmax = dx.cwiseAbs().maxCoeff();
+            if(dxmax > 2.0)
+                dx *= 2.0 / dxmax;
+
+            x += dx;
+
+            n(ip) = x.array().exp();
+            n(is) = (nu.transpose() * (theta(ip).matrix() + x) - theta(is).matrix()).array().exp();
+
+            if(!n.allFinite())
+                return result;
+
+            const ArrayXd thetanew = updateTheta(T, P, n);
+            const auto dtheta = (thetanew - theta).abs().maxCoeff();
+            theta = thetanew;
+
+            result.optima.iterations = iter + 1;
+
+            if(F.cwiseAbs().maxCoeff() <= tolerance * bnorm && dxmax <= tolerance && dtheta <= tolerance)
+            {
+                result.optima.succeeded = true;
+                break;
+            }
+        }
+
+        if(!result.optima.succeeded)
+            return result;
+
+        state.setTemperature(T);
+        state.setPressure(P);
+        state.setSpeciesAmounts(n);
+        state.props() = props;
+
+        result.timing.solve = elapsed(begin);
+        result.timing.evaluations = result.optima.iterations + 1;
+
+        return result;
+    }
+};
+
+SpeciationSolver::SpeciationSolver(EquilibriumSpecs const& specs)
+: pimpl(new Impl(specs))
+{}
+
+SpeciationSolver::SpeciationSolver(SpeciationSolver const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+SpeciationSolver::~SpeciationSolver()
+{}
+
+auto SpeciationSolver::operator=(SpeciationSolver other) -> SpeciationSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto SpeciationSolver::applicable(EquilibriumSpecs const& specs) -> bool
+{
+    auto const& system = specs.system();
+    const EquilibriumDims dims(specs);
+
+    const auto aqueousonly = system.phases().size() == 1 && system.phase(0).aggregateState() == AggregateState::Aqueous;
+    const auto onlytp = specs.namesInputs() == Strings{ "T", "P" };
+    const auto noextras = dims.Np == 0 && dims.Nq == 0 && dims.Nr == 0 && dims.Nv == 0;
+
+    return aqueousonly && onlytp && noextras;
+}
+
+auto SpeciationSolver::setOptions(EquilibriumOptions const& options) -> void
+{
+    pimpl->options = options;
+}
+
+auto SpeciationSolver::setMaxIterations(Index value) -> void
+{
+    pimpl->maxiters = value;
+}
+
+auto SpeciationSolver::setTolerance(double value) -> void
+{
+    pimpl->tolerance = value;
+}
+
+auto SpeciationSolver::solve(ChemicalState& state, real const& T, real const& P, ArrayXdConstRef const& c) -> EquilibriumResult
+{
+    return pimpl->solve(state, T, P, c);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,93 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class EquilibriumSpecs;
+struct EquilibriumOptions;
+struct EquilibriumResult;
+
+/// Used for speciation calculations in chemical systems with a single aqueous phase using the mass-action law.
+/// The species are split into primary and secondary species, with the
+/// primary ones chosen among the most abundant species so that their
+/// columns in the conservation matrix are linearly independent. The amounts
+/// of the secondary species follow from the mass-action law of their
+/// formation reactions from the primary species, and Newton iterations are
+/// performed only on the logarithms of the amounts of the primary species
+/// to satisfy the mass balance constraints. The non-ideal part of the
+/// chemical potentials is lagged by one iteration. This is equivalent to
+/// the minimization of the Gibbs energy of the system, but much cheaper
+/// for small aqueous systems, such as those in PHREEQC-style speciation.
+/// @see EquilibriumOptions::use_mass_action_speciation
+class SpeciationSolver
+{
+public:
+    /// Construct a SpeciationSolver object with given chemical equilibrium specifications.
+    explicit SpeciationSolver(EquilibriumSpecs const& specs);
+
+    /// Construct a copy of a SpeciationSolver object.
+    SpeciationSolver(SpeciationSolver const& other);
+
+    /// Destroy this SpeciationSolver object.
+    ~SpeciationSolver();
+
+    /// Assign a copy of a SpeciationSolver object to this.
+    auto operator=(SpeciationSolver other) -> SpeciationSolver&;
+
+    /// Return true if the mass-action speciation can be used with given chemical equilibrium specifications.
+    /// This requires a chemical system with a single aqueous phase, and
+    /// specifications with only temperature and pressure as inputs and no
+    /// other constraints or control variables.
+    static auto applicable(EquilibriumSpecs const& specs) -> bool;
+
+    /// Set the options of the speciation calculations (only the lower bound of the species amounts and the use of ideal activity models are considered).
+    auto setOptions(EquilibriumOptions const& options) -> void;
+
+    /// Set the maximum number of iterations of the speciation calculations (default: 100).
+    auto setMaxIterations(Index value) -> void;
+
+    /// Set the tolerance of the mass balance residuals relative to the amounts of components (default: 1e-10).
+    auto setTolerance(double value) -> void;
+
+    /// Compute the speciation of a chemical state.
+    /// The species amounts in the given state are used as initial guess.
+    /// The state is only changed if the calculation succeeds, in which case
+    /// its temperature, pressure, species amounts and chemical properties
+    /// are updated. The calculation fails if the state has no positive
+    /// species amounts or if the amount of some element is not positive.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param T The temperature for the calculation (in K)
+    /// @param P The pressure for the calculation (in Pa)
+    /// @param c The amounts of the conservative components (elements and electric charge)
+    auto solve(ChemicalState& state, real const& T, real const& P, ArrayXdConstRef const& c) -> EquilibriumResult;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
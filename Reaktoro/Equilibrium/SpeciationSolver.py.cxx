@@ -0,0 +1,40 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SpeciationSolver.hpp>
+using namespace Reaktoro;
+
+void exportSpeciationSolver(py::module& m)
+{
+    py::class_<SpeciationSolver>(m, "SpeciationSolver")
+        .def(py::init<EquilibriumSpecs const&>())
+        .def_static("applicable", &SpeciationSolver::applicable)
+        .def("setOptions", &SpeciationSolver::setOptions)
+        .def("setMaxIterations", &SpeciationSolver::setMaxIterations)
+        .def("setTolerance", &SpeciationSolver::setTolerance)
+        .def("solve", &SpeciationSolver::solve, py::arg("state"), py::arg("T"), py::arg("P"), py::arg("c"))
+        ;
+}
@@ -0,0 +1,133 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SpeciationSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing SpeciationSolver", "[SpeciationSolver]")
+{
+    const auto db = Database({
+        Species("H2O"  ).withStandardGibbsEnergy(-237181.72),
+        Species("H+"   ).withStandardGibbsEnergy(      0.00),
+        Species("OH-"  ).withStandardGibbsEnergy(-157297.48),
+        Species("H2"   ).withStandardGibbsEnergy(  17723.42),
+        Species("O2"   ).withStandardGibbsEnergy(  16543.54),
+        Species("Na+"  ).withStandardGibbsEnergy(-261880.74),
+        Species("Cl-"  ).withStandardGibbsEnergy(-131289.74),
+        Species("NaCl" ).withStandardGibbsEnergy(-388735.44),
+        Species("HCl"  ).withStandardGibbsEnergy(-127235.44),
+        Species("NaOH" ).withStandardGibbsEnergy(-417981.60),
+        Species("H2(g)").withStandardGibbsEnergy(      0.00),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O Na Cl")) );
+
+    ChemicalSystem system(phases);
+
+    ChemicalState state0(system);
+    state0.temperature(60.0, "celsius");
+    state0.pressure(10.0, "bar");
+    state0.set("H2O", 55.0, "mol");
+    state0.set("NaCl", 0.5, "mol");
+
+    EquilibriumSolver solver(system);
+
+    // Compute the reference equilibrium state with Gibbs energy minimization
+    ChemicalState expected(state0);
+    REQUIRE( solver.solve(expected).succeeded() );
+
+    SECTION("Checking applicability of the mass-action speciation")
+    {
+        CHECK( SpeciationSolver::applicable(EquilibriumSpecs::TP(system)) );
+
+        EquilibriumSpecs specs(system);
+        specs.temperature();
+        specs.pressure();
+        specs.pH();
+        CHECK_FALSE( SpeciationSolver::applicable(specs) );
+
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl")) );
+        phases.add( GaseousPhase("H2(g)") );
+        CHECK_FALSE( SpeciationSolver::applicable(EquilibriumSpecs::TP(ChemicalSystem(phases))) );
+    }
+
+    SECTION("Using SpeciationSolver directly")
+    {
+        SpeciationSolver speciation(EquilibriumSpecs::TP(system));
+
+        ChemicalState state(expected);
+        state.set("Na+", 0.2, "mol"); // perturb the equilibrium state used as initial guess
+        state.set("NaCl", 0.3, "mol");
+
+        const ArrayXd c = expected.componentAmounts();
+        const auto result = speciation.solve(state, expected.temperature(), expected.pressure(), c);
+
+        CHECK( result.succeeded() );
+        CHECK( state.speciesAmounts().isApprox(expected.speciesAmounts(), 1e-6) );
+        CHECK( state.componentAmounts().cast<double>().isApprox(c, 1e-10) );
+    }
+
+    SECTION("Using EquilibriumOptions::use_mass_action_speciation")
+    {
+        EquilibriumOptions options;
+        options.use_mass_action_speciation = true;
+
+        solver.setOptions(options);
+
+        ChemicalState state(state0);
+        const auto result = solver.solve(state);
+
+        CHECK( result.succeeded() );
+        CHECK( state.speciesAmounts().isApprox(expected.speciesAmounts(), 1e-6) );
+
+        // Check the general solver is used when there are reactivity restrictions
+        EquilibriumRestrictions restrictions(system);
+        restrictions.cannotReact("NaCl");
+
+        state = state0;
+        CHECK( solver.solve(state, restrictions).succeeded() );
+        CHECK( state.speciesAmount("NaCl") == Approx(0.5) );
+    }
+
+    SECTION("Checking failure when an element has zero amount")
+    {
+        SpeciationSolver speciation(EquilibriumSpecs::TP(system));
+
+        ChemicalState state(system);
+        state.set("H2O", 55.0, "mol");
+
+        const ArrayXd c = state.componentAmounts();
+        CHECK( speciation.solve(state, 298.15, 1e5, c).failed() );
+    }
+}
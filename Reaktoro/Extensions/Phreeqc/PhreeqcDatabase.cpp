@@ -17,6 +17,11 @@
 
 #include "PhreeqcDatabase.hpp"
 
+// C++ includes
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -45,8 +50,8 @@ struct PhreeqcDatabaseHelper
     /// The symbols of the elements already in the database (needed for fast existence check)
     Set<String> inserted_elements_set;
 
-    /// The ids of the species already inserted in the database, with id = name + aggregate state (needed for fast existence check)
-    Set<String> inserted_species_set;
+    /// The indices of the species already inserted in the database, with keys id = name + aggregate state (needed for fast existence check and lookup)
+    Map<String, Index> inserted_species_map;
 
     /// Construct a default PhreeqcDatabaseHelper object.
     PhreeqcDatabaseHelper()
@@ -79,11 +84,16 @@ struct PhreeqcDatabaseHelper
         return inserted_elements_set.find(symbol) != inserted_elements_set.end();
     }
 
+    /// Return the id of a Species object with given name and aggregate state used in @ref inserted_species_map.
+    static auto speciesId(String const& name, AggregateState agstate) -> String
+    {
+        return name + std::to_string(static_cast<int>(agstate));
+    }
+
     /// Return true if a Species object with given name already exists in the database.
     auto containsSpecies(String name, AggregateState agstate) -> bool
     {
-        auto const id = name + std::to_string(static_cast<int>(agstate));
-        return inserted_species_set.find(id) != inserted_species_set.end();
+        return inserted_species_map.find(speciesId(name, agstate)) != inserted_species_map.end();
     }
 
     /// Append an Element object with given PhreeqcElement pointer.
@@ -108,14 +118,14 @@ struct PhreeqcDatabaseHelper
         // Skip if species with same name and same aggregate state has already been appended!
         const auto name = PhreeqcUtils::name(s);
         const auto agstate = PhreeqcUtils::aggregateState(s);
-        const auto idx = indexfn(species_list, RKT_LAMBDA(x, x.name() == name && x.aggregateState() == agstate));
-        if(idx < species_list.size())
-            return species_list[idx];
+        const auto it = inserted_species_map.find(speciesId(name, agstate));
+        if(it != inserted_species_map.end())
+            return species_list[it->second];
 
         const auto newspecies = PhreeqcUtils::isMasterSpecies(s) ? createMasterSpecies(s) : createProductSpecies(s);
 
         species_list.append(newspecies);
-        inserted_species_set.insert(name + std::to_string(static_cast<int>(agstate)));
+        inserted_species_map.emplace(speciesId(name, agstate), species_list.size() - 1);
 
         return species_list.back();
     }
@@ -242,6 +252,41 @@ auto createSpeciesWithDatabaseContentOrPath(String database)
     return helper.species_list;
 }
 
+/// Return the contents of a PHREEQC database given either as a path to a database file or as the contents themselves.
+auto databaseContents(String const& database) -> String
+{
+    if(database.find('\n') != String::npos) // same check in PhreeqcUtils::load
+        return database;
+    std::ifstream file(database);
+    if(!file) // let PhreeqcUtils::load report the invalid path
+        return database;
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+/// Return the PhreeqcDatabaseHelper object for given PHREEQC database, reusing the one created before for the same database contents.
+/// The parsed PHREEQC instance and the created Species objects are only read
+/// after their creation, and can thus be shared by all PhreeqcDatabase
+/// objects constructed with the same database (in the same way as copies of a
+/// PhreeqcDatabase object do). The cache is keyed by the contents of the
+/// database, not by its path, so that a modified database file is parsed again.
+auto phreeqcDatabaseHelper(String const& database) -> SharedPtr<const PhreeqcDatabaseHelper>
+{
+    static std::mutex mutex;
+    static Map<String, SharedPtr<const PhreeqcDatabaseHelper>> cache;
+
+    const auto key = databaseContents(database);
+
+    std::lock_guard<std::mutex> lock(mutex); // PHREEQC instances are also parsed one at a time, since its legacy interpreter is not meant to be used concurrently
+
+    auto it = cache.find(key);
+    if(it == cache.end())
+        it = cache.emplace(key, std::make_shared<const PhreeqcDatabaseHelper>(database)).first;
+
+    return it->second;
+}
+
 } // namespace detail
 
 PhreeqcDatabase::PhreeqcDatabase()
@@ -254,10 +299,11 @@ PhreeqcDatabase::PhreeqcDatabase(const String& name)
 
 auto PhreeqcDatabase::load(const String& filename) -> PhreeqcDatabase&
 {
-    detail::PhreeqcDatabaseHelper helper(filename);
+    const auto helper = detail::phreeqcDatabaseHelper(filename);
     Database::clear();
-    Database::addSpecies(helper.species_list);
-    Database::attachData(helper);
+    Database::addSpecies(helper->species_list);
+    Database::attachData(*helper);
+    m_ptr = helper->phreeqc;
     return *this;
 }
 
@@ -270,20 +316,20 @@ auto PhreeqcDatabase::withName(const String& name) -> PhreeqcDatabase
 {
     PhreeqcDatabase db;
     const auto content = detail::getPhreeqcDatabaseContent(name);
-    detail::PhreeqcDatabaseHelper helper(content);
-    db.addSpecies(helper.species_list);
-    db.attachData(helper);
-    db.m_ptr = helper.phreeqc;
+    const auto helper = detail::phreeqcDatabaseHelper(content);
+    db.addSpecies(helper->species_list);
+    db.attachData(*helper);
+    db.m_ptr = helper->phreeqc;
     return db;
 }
 
 auto PhreeqcDatabase::fromFile(const String& path) -> PhreeqcDatabase
 {
-    detail::PhreeqcDatabaseHelper helper(path);
+    const auto helper = detail::phreeqcDatabaseHelper(path);
     PhreeqcDatabase db;
-    db.addSpecies(helper.species_list);
-    db.attachData(helper);
-    db.m_ptr = helper.phreeqc;
+    db.addSpecies(helper->species_list);
+    db.attachData(*helper);
+    db.m_ptr = helper->phreeqc;
     return db;
 }
 
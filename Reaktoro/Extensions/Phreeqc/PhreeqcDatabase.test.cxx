@@ -159,6 +159,22 @@ TEST_CASE("Testing PhreeqcDatabase constructor and load method", "[PhreeqcDataba
         CHECK_NOTHROW( solids.getWithName("FeSO4") );
     }
 
+    //-------------------------------------------------------------------------
+    // Testing PhreeqcDatabase objects with same database contents reuse the same converted species
+    //-------------------------------------------------------------------------
+    {
+        PhreeqcDatabase db1("pitzer.dat");
+        PhreeqcDatabase db2 = PhreeqcDatabase::fromContents(PhreeqcDatabase::contents("pitzer.dat"));
+        PhreeqcDatabase db3("phreeqc.dat");
+
+        CHECK( db1.ptr() != nullptr );
+        CHECK( db1.ptr() == db2.ptr() );
+        CHECK( db1.ptr() == db.ptr() ); // db was loaded above with the contents of pitzer.dat
+        CHECK( db1.ptr() != db3.ptr() );
+
+        CHECK( db1.species().size() == db2.species().size() );
+    }
+
     // // // In this new load operation, complement the PhreeqcDatabase object with more contents
     // db.extend(getStringContentsPhreeqcDatabaseComplement()); // TODO Implement PhreeqcDatabase::extend method using PhreeqcUtis::execute for this.
 
@@ -17,4 +17,5 @@
 
 #pragma once
 
+#include <Reaktoro/Extensions/PorousMedia/PorousRockField.hpp>
 #include <Reaktoro/Extensions/PorousMedia/PorousRockState.hpp>
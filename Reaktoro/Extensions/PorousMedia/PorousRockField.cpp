@@ -0,0 +1,171 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "PorousRockField.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+auto porosities(ArrayXXdConstRef Vs, ArrayXdConstRef Vb, ArrayXdRef phi) -> void
+{
+    const auto ncells = Vb.size();
+    assert(Vs.rows() == ncells);
+    assert(phi.size() == ncells);
+
+    // Accumulate the solid volumes one phase at a time so each pass runs over contiguous memory
+    phi.setZero();
+    for(auto j = 0; j < Vs.cols(); ++j)
+        phi += Vs.col(j);
+
+    phi = (1.0 - phi / Vb).max(0.0);
+}
+
+auto permeabilitiesKozenyCarman(ArrayXdConstRef phi, ArrayXdConstRef phi0, ArrayXdConstRef k0, ArrayXdRef k) -> void
+{
+    assert(phi.size() == phi0.size());
+    assert(phi.size() == k0.size());
+    assert(phi.size() == k.size());
+    k = k0 * (phi / phi0).cube() * ((1.0 - phi0) / (1.0 - phi)).square();
+}
+
+auto permeabilitiesPowerLaw(ArrayXdConstRef phi, ArrayXdConstRef phi0, ArrayXdConstRef k0, double n, ArrayXdRef k) -> void
+{
+    assert(phi.size() == phi0.size());
+    assert(phi.size() == k0.size());
+    assert(phi.size() == k.size());
+    k = k0 * (phi / phi0).pow(n);
+}
+
+struct PorousRockField::Impl
+{
+    /// The reference porosities of the cells.
+    ArrayXd phi0;
+
+    /// The reference permeabilities of the cells (in m²).
+    ArrayXd k0;
+
+    /// The current porosities of the cells.
+    ArrayXd phi;
+
+    /// The current permeabilities of the cells (in m²).
+    ArrayXd k;
+
+    /// The model used to compute permeability from porosity.
+    PermeabilityModel model = PermeabilityModel::KozenyCarman;
+
+    /// The exponent used in the power-law permeability model.
+    double exponent = 3.0;
+
+    Impl(Index ncells)
+    : phi0(ArrayXd::Ones(ncells)), k0(ArrayXd::Ones(ncells)), phi(ArrayXd::Ones(ncells)), k(ArrayXd::Ones(ncells))
+    {}
+
+    auto update(ArrayXXdConstRef Vs, ArrayXdConstRef Vb) -> void
+    {
+        const auto ncells = phi.size();
+        errorif(Vs.rows() != ncells, "Expecting solid phase volumes for ", ncells, " cells in PorousRockField::update, but got ", Vs.rows(), ".");
+        errorif(Vb.size() != ncells, "Expecting bulk volumes for ", ncells, " cells in PorousRockField::update, but got ", Vb.size(), ".");
+
+        porosities(Vs, Vb, phi);
+
+        switch(model)
+        {
+        case PermeabilityModel::Constant: k = k0; break;
+        case PermeabilityModel::KozenyCarman: permeabilitiesKozenyCarman(phi, phi0, k0, k); break;
+        case PermeabilityModel::PowerLaw: permeabilitiesPowerLaw(phi, phi0, k0, exponent, k); break;
+        }
+    }
+};
+
+PorousRockField::PorousRockField(Index ncells)
+: pimpl(new Impl(ncells))
+{}
+
+PorousRockField::PorousRockField(const PorousRockField& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+PorousRockField::~PorousRockField()
+{}
+
+auto PorousRockField::operator=(PorousRockField other) -> PorousRockField&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto PorousRockField::numCells() const -> Index
+{
+    return pimpl->phi.size();
+}
+
+auto PorousRockField::setReferencePorosity(double value) -> void
+{
+    errorif(value <= 0.0 || value >= 1.0, "Expecting a reference porosity in (0, 1), but got ", value, ".");
+    pimpl->phi0.fill(value);
+    pimpl->phi.fill(value);
+}
+
+auto PorousRockField::setReferencePorosity(ArrayXdConstRef values) -> void
+{
+    errorif(values.size() != pimpl->phi0.size(), "Expecting ", pimpl->phi0.size(), " reference porosities, but got ", values.size(), ".");
+    pimpl->phi0 = values;
+    pimpl->phi = values;
+}
+
+auto PorousRockField::setReferencePermeability(double value) -> void
+{
+    pimpl->k0.fill(value);
+    pimpl->k.fill(value);
+}
+
+auto PorousRockField::setReferencePermeability(ArrayXdConstRef values) -> void
+{
+    errorif(values.size() != pimpl->k0.size(), "Expecting ", pimpl->k0.size(), " reference permeabilities, but got ", values.size(), ".");
+    pimpl->k0 = values;
+    pimpl->k = values;
+}
+
+auto PorousRockField::setPermeabilityModel(PermeabilityModel model) -> void
+{
+    pimpl->model = model;
+}
+
+auto PorousRockField::setPermeabilityExponent(double value) -> void
+{
+    pimpl->exponent = value;
+}
+
+auto PorousRockField::update(ArrayXXdConstRef Vs, ArrayXdConstRef Vb) -> void
+{
+    pimpl->update(Vs, Vb);
+}
+
+auto PorousRockField::porosity() const -> ArrayXdConstRef
+{
+    return pimpl->phi;
+}
+
+auto PorousRockField::permeability() const -> ArrayXdConstRef
+{
+    return pimpl->k;
+}
+
+} // namespace Reaktoro
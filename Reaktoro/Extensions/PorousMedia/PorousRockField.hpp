@@ -0,0 +1,107 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The models for the permeability of a porous rock as a function of its porosity.
+/// @ingroup PorousMediaExtension
+enum class PermeabilityModel
+{
+    Constant,     ///< The permeability model *k = k0*.
+    KozenyCarman, ///< The permeability model *k = k0 (φ/φ0)³ ((1 - φ0)/(1 - φ))²*.
+    PowerLaw,     ///< The permeability model *k = k0 (φ/φ0)ⁿ*.
+};
+
+/// Compute the porosities of many cells from their solid and bulk volumes.
+/// @param Vs The volumes of the solid phases in each cell, with one column per solid phase (ncells × nsolids)
+/// @param Vb The bulk volumes of the cells
+/// @param[out] phi The computed porosities of the cells
+auto porosities(ArrayXXdConstRef Vs, ArrayXdConstRef Vb, ArrayXdRef phi) -> void;
+
+/// Compute the permeabilities of many cells using the Kozeny-Carman model.
+auto permeabilitiesKozenyCarman(ArrayXdConstRef phi, ArrayXdConstRef phi0, ArrayXdConstRef k0, ArrayXdRef k) -> void;
+
+/// Compute the permeabilities of many cells using the power-law model with exponent `n`.
+auto permeabilitiesPowerLaw(ArrayXdConstRef phi, ArrayXdConstRef phi0, ArrayXdConstRef k0, double n, ArrayXdRef k) -> void;
+
+/// The porosity and permeability of all cells of a porous rock domain.
+/// This class updates the porosity and permeability of every cell at once
+/// from arrays of phase volumes stored contiguously per phase (one column
+/// per solid phase), so that the porosity feedback into transport at each
+/// time step does not require a ChemicalProps object per cell.
+/// @ingroup PorousMediaExtension
+class PorousRockField
+{
+public:
+    /// Construct a PorousRockField instance with given number of cells.
+    explicit PorousRockField(Index ncells);
+
+    /// Construct a copy of a PorousRockField instance.
+    PorousRockField(const PorousRockField& other);
+
+    /// Destroy this PorousRockField instance.
+    virtual ~PorousRockField();
+
+    /// Assign a PorousRockField instance to this instance.
+    auto operator=(PorousRockField other) -> PorousRockField&;
+
+    /// Return the number of cells in the field.
+    auto numCells() const -> Index;
+
+    /// Set the reference porosity of all cells.
+    auto setReferencePorosity(double value) -> void;
+
+    /// Set the reference porosities of the cells.
+    auto setReferencePorosity(ArrayXdConstRef values) -> void;
+
+    /// Set the reference permeability of all cells (in m²).
+    auto setReferencePermeability(double value) -> void;
+
+    /// Set the reference permeabilities of the cells (in m²).
+    auto setReferencePermeability(ArrayXdConstRef values) -> void;
+
+    /// Set the model used to compute permeability from porosity.
+    auto setPermeabilityModel(PermeabilityModel model) -> void;
+
+    /// Set the exponent used in the power-law permeability model (default: 3).
+    auto setPermeabilityExponent(double value) -> void;
+
+    /// Update the porosity and permeability of the cells.
+    /// @param Vs The volumes of the solid phases in each cell, with one column per solid phase (ncells × nsolids)
+    /// @param Vb The bulk volumes of the cells
+    auto update(ArrayXXdConstRef Vs, ArrayXdConstRef Vb) -> void;
+
+    /// Return the current porosities of the cells.
+    auto porosity() const -> ArrayXdConstRef;
+
+    /// Return the current permeabilities of the cells (in m²).
+    auto permeability() const -> ArrayXdConstRef;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,80 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Extensions/PorousMedia/PorousRockField.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing PorousRockField class", "[PorousRockField]")
+{
+    const Index ncells = 4;
+
+    PorousRockField field(ncells);
+    field.setReferencePorosity(0.3);
+    field.setReferencePermeability(1e-12);
+
+    const ArrayXd Vb = ArrayXd::Ones(ncells);
+
+    ArrayXXd Vs(ncells, 2); // two solid phases per cell
+    Vs.col(0) << 0.50, 0.40, 0.60, 0.70;
+    Vs.col(1) << 0.20, 0.20, 0.15, 0.10;
+
+    const ArrayXd phi = 1.0 - Vs.rowwise().sum();
+
+    SECTION("Using Kozeny-Carman permeability model")
+    {
+        field.setPermeabilityModel(PermeabilityModel::KozenyCarman);
+        field.update(Vs, Vb);
+
+        for(auto i = 0; i < ncells; ++i)
+        {
+            const auto expected = 1e-12 * std::pow(phi[i]/0.3, 3) * std::pow(0.7/(1.0 - phi[i]), 2);
+            CHECK( field.porosity()[i] == Approx(phi[i]) );
+            CHECK( field.permeability()[i] == Approx(expected) );
+        }
+
+        CHECK( field.permeability()[0] == Approx(1e-12) ); // cell 0 has reference porosity
+    }
+
+    SECTION("Using power-law permeability model")
+    {
+        field.setPermeabilityModel(PermeabilityModel::PowerLaw);
+        field.setPermeabilityExponent(2.0);
+        field.update(Vs, Vb);
+
+        for(auto i = 0; i < ncells; ++i)
+            CHECK( field.permeability()[i] == Approx(1e-12 * std::pow(phi[i]/0.3, 2)) );
+    }
+
+    SECTION("Using constant permeability model")
+    {
+        field.setPermeabilityModel(PermeabilityModel::Constant);
+        field.update(Vs, Vb);
+
+        CHECK( (field.permeability() == 1e-12).all() );
+    }
+
+    SECTION("Checking errors for mismatched sizes")
+    {
+        CHECK_THROWS( field.update(Vs.topRows(2), Vb) );
+        CHECK_THROWS( field.update(Vs, Vb.head(2)) );
+    }
+}
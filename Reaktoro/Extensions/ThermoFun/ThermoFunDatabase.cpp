@@ -23,6 +23,7 @@
 #include <Reaktoro/Core/Element.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Core/Species.hpp>
+#include <Reaktoro/Core/Support/DatabaseParser.hpp>
 #include <Reaktoro/Extensions/ThermoFun/ThermoFunEngine.hpp>
 
 // ThermoFun includes
@@ -35,16 +36,11 @@ namespace {
 /// Return the standard thermodynamic property function of a species with given name.
 auto createStandardThermoModel(const ThermoFunEngine& engine, const String& species) -> StandardThermoModel
 {
-    const auto& substances = engine.database().mapSubstances();
-    const auto it = substances.find(species);
-
-    errorif(it == substances.end(), "Expecting a species name that exists in the ThermoFun database, but got `", species, "` instead.");
-
-    const auto substance = it->second;
+    const auto ispecies = engine.index(species);
 
     return [=](real T, real P) -> StandardThermoProps
     {
-        return engine.props(T, P, substance);
+        return engine.props(T, P, ispecies); // memoized in engine per temperature and pressure for all species
     };
 }
 
@@ -61,7 +57,7 @@ auto createElement(const ThermoFun::Element& element) -> Element
 /// Return the elements and their coefficients in a species a ThermoFun::Substance object
 auto createElements(const ThermoFunEngine& engine, const ThermoFun::Substance& substance) -> Pairs<Element, double>
 {
-    auto db = engine.database();
+    auto const& db = engine.database();
     Pairs<Element, double> elements;
     for(auto&& [element, coeff] : db.parseSubstanceFormula(substance.formula()))
     {
@@ -126,8 +122,32 @@ ThermoFunDatabase::ThermoFunDatabase(const ThermoFun::Database& db)
 {
     ThermoFunEngine engine(db);
     attachData(engine);
-    for(auto [_, subs] : db.mapSubstances())
-        addSpecies(createSpecies(engine, subs));
+
+    // Index the substances with their names, aggregate states and elements
+    // only, so that the (costly) Species objects are created on demand.
+    ElementList elements;
+    Vec<DatabaseParser::SpeciesRecord> records;
+    records.reserve(db.mapSubstances().size());
+    for(auto const& [symbol, subs] : db.mapSubstances())
+    {
+        DatabaseParser::SpeciesRecord record;
+        record.name = symbol;
+        record.aggregate_state = convertAggregateState(subs.aggregateState());
+        for(auto const& [element, _] : createElements(engine, subs))
+        {
+            if(elements.find(element.symbol()) >= elements.size())
+                elements.append(element);
+            record.elements.push_back(element.symbol());
+        }
+        records.push_back(record);
+    }
+
+    auto createfn = [=](String const& name) -> Species
+    {
+        return createSpecies(engine, engine.database().mapSubstances().at(name));
+    };
+
+    initializeLazy(DatabaseParser(elements, records, createfn));
 }
 
 auto ThermoFunDatabase::withName(const String& name) -> ThermoFunDatabase
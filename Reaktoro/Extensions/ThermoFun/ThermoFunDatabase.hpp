@@ -27,6 +27,9 @@ namespace ThermoFun { class Database; }
 namespace Reaktoro {
 
 /// The class used to store and retrieve data of chemical species from ThermoFun databases.
+/// The Species objects are created on demand, when first requested (e.g., with
+/// @ref species or @ref speciesWithAggregateState), which avoids their
+/// creation for all substances in large ThermoFun databases.
 /// @ingroup ThermoFunExtension
 class ThermoFunDatabase : public Database
 {
@@ -155,6 +155,31 @@ TEST_CASE("Testing ThermoFunDatabase", "[ThermoFunDatabase]")
         }
     }
 
+    WHEN("Creating the species of a ThermoFunDatabase object on demand")
+    {
+        auto const db = ThermoFunDatabase("aq17");
+
+        CHECK( db.elements().find("Ca") < db.elements().size() ); // elements are known before species are created
+
+        auto const& calcite = db.species("Calcite");
+        CHECK( calcite.formula().equivalent("CaCO3") );
+        CHECK( calcite.aggregateState() == AggregateState::CrystallineSolid );
+
+        CHECK( &calcite == &db.species("Calcite") ); // references to species remain valid as other species are created
+
+        auto const aqueous = db.speciesWithAggregateState(AggregateState::Aqueous, {"H", "O", "C", "Ca"});
+
+        CHECK( aqueous.findWithName("H2O@") < aqueous.size() );
+        CHECK( aqueous.findWithName("CO3-2") < aqueous.size() );
+        CHECK( aqueous.findWithName("Ca+2") < aqueous.size() );
+        CHECK( aqueous.findWithName("Na+") >= aqueous.size() );
+
+        props = aqueous.get("CO3-2").standardThermoProps(T, P);
+        CHECK( props.G0 == Approx(-5.279830e+05) );
+
+        CHECK( db.species().size() == ThermoFun::Database(aq17path).mapSubstances().size() ); // all species are created when requested
+    }
+
     WHEN("Constructing ThermoFunDatabase using ThermoFunDatabase::fromFiles")
     {
         auto const db = ThermoFunDatabase::fromFiles({aq17path, cemdata18path});
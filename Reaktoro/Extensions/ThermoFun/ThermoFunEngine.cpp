@@ -17,7 +17,11 @@
 
 #include "ThermoFunEngine.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 
 // ThermoFun includes
@@ -51,33 +55,109 @@ struct ThermoFunEngine::Impl
     /// The ThermoFun::Database object.
     ThermoFun::Database database;
 
+    /// The ThermoFun::Substance objects in the database.
+    Vec<ThermoFun::Substance> substances;
+
+    /// The indices of the substances in `substances` by their symbols.
+    Map<String, Index> indices;
+
+    /// The temperature at which the properties in `cache` were computed (in K).
+    mutable double Tcache = NaN;
+
+    /// The pressure at which the properties in `cache` were computed (in Pa).
+    mutable double Pcache = NaN;
+
+    /// The standard thermodynamic properties of the substances at temperature `Tcache` and pressure `Pcache`.
+    mutable Vec<StandardThermoProps> cache;
+
+    /// The flags indicating which entries in `cache` have been computed at temperature `Tcache` and pressure `Pcache`.
+    mutable Vec<bool> cached;
+
+    /// The mutex that protects `engine` and `cache` when species are evaluated concurrently.
+    mutable std::mutex mutex;
+
     /// Costruct a Impl object with given ThermoFun::Database object.
     Impl(const ThermoFun::Database& database)
     : engine(database), database(database)
     {
         // Set solvent symbol, the HGK, JN water solvent model are defined in this record
         engine.setSolventSymbol("H2O@");
+
+        // Initialize the list of substances and their indices
+        for(auto const& [symbol, substance] : database.mapSubstances())
+        {
+            indices[symbol] = substances.size();
+            substances.push_back(substance);
+        }
+
+        cache.resize(substances.size());
+        cached.assign(substances.size(), false);
+    }
+
+    /// Return the index of a chemical species with given name.
+    auto index(const String& species) const -> Index
+    {
+        const auto it = indices.find(species);
+        errorif(it == indices.end(), "Expecting a species name that exists in the ThermoFun database, but got `", species, "` instead.");
+        return it->second;
     }
 
     /// Return the standard thermodynamic properties of a chemical species with given name.
     auto props(const real& T, const real& P, const String& species) const -> StandardThermoProps
     {
-        auto const& substances = database.mapSubstances();
-        const auto it = substances.find(species);
+        return props(T, P, index(species));
+    }
+
+    /// Return the standard thermodynamic properties of a chemical species with given ThermoFun::Substance object.
+    auto props(const real& T, const real& P, const ThermoFun::Substance& substance) const -> StandardThermoProps
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return compute(T.val(), P.val(), substance);
+    }
+
+    /// Return the standard thermodynamic properties of a chemical species with given index, memoized for the last temperature and pressure.
+    auto props(const real& T, const real& P, Index ispecies) const -> StandardThermoProps
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        update(T.val(), P.val());
+        return cachedProps(ispecies);
+    }
 
-        errorif(it == substances.end(), "Expecting a species name that exists in the ThermoFun database, but got `", species, "` instead.");
+    /// Return the standard thermodynamic properties of all chemical species, memoized for the last temperature and pressure.
+    auto props(const real& T, const real& P) const -> Vec<StandardThermoProps>
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        update(T.val(), P.val());
+        for(Index i = 0; i < substances.size(); ++i)
+            cachedProps(i);
+        return cache;
+    }
 
-        const auto substance = it->second;
+    /// Invalidate the memoized properties if the temperature or pressure has changed.
+    auto update(double T, double P) const -> void
+    {
+        if(T == Tcache && P == Pcache)
+            return;
+        Tcache = T;
+        Pcache = P;
+        std::fill(cached.begin(), cached.end(), false);
+    }
 
-        return props(T, P, substance);
+    /// Return the memoized properties of the substance with given index, computing them first if needed.
+    auto cachedProps(Index ispecies) const -> StandardThermoProps const&
+    {
+        if(!cached[ispecies])
+        {
+            cache[ispecies] = compute(Tcache, Pcache, substances[ispecies]);
+            cached[ispecies] = true;
+        }
+        return cache[ispecies];
     }
 
-    /// Return the standard thermodynamic properties of a chemical species with given ThermoFun::Substance object.
-    auto props(const real& T, const real& P, const ThermoFun::Substance& substance) const -> StandardThermoProps
+    /// Compute the standard thermodynamic properties of a substance with ThermoFun.
+    auto compute(double T, double P, const ThermoFun::Substance& substance) const -> StandardThermoProps
     {
-        double Tval = T.val();
-        double Pval = P.val();
-        const auto props = engine.thermoPropertiesSubstance(Tval, Pval, substance);
+        const auto props = engine.thermoPropertiesSubstance(T, P, substance);
         return convertProps(props, substance);
     }
 };
@@ -101,4 +181,19 @@ auto ThermoFunEngine::props(const real& T, const real& P, const ThermoFun::Subst
     return pimpl->props(T, P, substance);
 }
 
+auto ThermoFunEngine::props(const real& T, const real& P, Index ispecies) const -> StandardThermoProps
+{
+    return pimpl->props(T, P, ispecies);
+}
+
+auto ThermoFunEngine::props(const real& T, const real& P) const -> Vec<StandardThermoProps>
+{
+    return pimpl->props(T, P);
+}
+
+auto ThermoFunEngine::index(const String& species) const -> Index
+{
+    return pimpl->index(species);
+}
+
 } // namespace Reaktoro
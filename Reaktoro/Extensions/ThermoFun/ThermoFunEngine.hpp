@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/StandardThermoProps.hpp>
 
@@ -43,6 +44,20 @@ public:
     /// Return the standard thermodynamic properties of a chemical species with given ThermoFun::Substance object.
     auto props(const real& T, const real& P, const ThermoFun::Substance& substance) const -> StandardThermoProps;
 
+    /// Return the standard thermodynamic properties of a chemical species with given index in the database (see @ref index).
+    /// The properties of each substance are memoized for the last temperature
+    /// and pressure used, so that the chemical species of a system are
+    /// evaluated only once for each temperature and pressure.
+    auto props(const real& T, const real& P, Index ispecies) const -> StandardThermoProps;
+
+    /// Return the standard thermodynamic properties of all chemical species in the database, in the order of @ref index.
+    /// The substances are evaluated in one pass at given temperature and pressure (reusing the memoized ones).
+    auto props(const real& T, const real& P) const -> Vec<StandardThermoProps>;
+
+    /// Return the index of a chemical species with given name in the database.
+    /// An exception is thrown if the species does not exist in the database.
+    auto index(const String& species) const -> Index;
+
 private:
     struct Impl;
 
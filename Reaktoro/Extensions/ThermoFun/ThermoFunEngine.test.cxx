@@ -18,11 +18,49 @@
 // Catch includes
 #include <catch2/catch.hpp>
 
+// ThermoFun includes
+#include <ThermoFun/Database.h>
+
 // Reaktoro includes
 #include <Reaktoro/Extensions/ThermoFun/ThermoFunEngine.hpp>
 using namespace Reaktoro;
 
 TEST_CASE("Testing ThermoFunEngine", "[ThermoFunEngine]")
 {
-    // Note: This is currently tested indirectly through the tests for ThermoFunDatabase.
+    // Note: This is also tested indirectly through the tests for ThermoFunDatabase.
+
+    ThermoFun::Database database(REAKTORO_DATABASES_DIR"/thermofun/aq17-thermofun.json");
+
+    ThermoFunEngine engine(database);
+
+    const auto T = 350.0;
+    const auto P = 50.0e5;
+
+    const auto substance = [&](auto name) { return database.mapSubstances().at(name); };
+
+    const auto all = engine.props(T, P);
+
+    CHECK( all.size() == database.mapSubstances().size() );
+
+    for(auto const& name : { "H2O@", "Ca+2", "CO2@", "CO3-2" })
+    {
+        INFO("species = " << name);
+
+        const auto i = engine.index(name);
+        const auto expected = engine.props(T, P, substance(name));
+        const auto memoized = engine.props(T, P, i);
+
+        CHECK( memoized.G0 == Approx(expected.G0) );
+        CHECK( memoized.H0 == Approx(expected.H0) );
+        CHECK( memoized.V0 == Approx(expected.V0) );
+        CHECK( all[i].G0 == Approx(expected.G0) );
+        CHECK( engine.props(T, P, name).G0 == Approx(expected.G0) );
+    }
+
+    // Check memoized properties are recomputed when temperature changes
+    const auto i = engine.index("Ca+2");
+    CHECK( engine.props(T + 10.0, P, i).G0 == Approx(engine.props(T + 10.0, P, substance("Ca+2")).G0) );
+    CHECK( engine.props(T + 10.0, P, i).G0 != Approx(all[i].G0) );
+
+    CHECK_THROWS( engine.index("Xyz") );
 }
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 
 namespace Reaktoro {
@@ -56,6 +57,39 @@ struct KineticsOptions : EquilibriumOptions
 
     /// The time step used for preconditioning the chemical state when performing the very first chemical kinetics step.
     double dt0 = 1e-6;
+
+    /// The relative tolerance of the local error of the species amounts in each time step of KineticsSolver::integrate.
+    double integration_reltol = 1e-3;
+
+    /// The absolute tolerance of the local error of the species amounts in each time step of KineticsSolver::integrate (in mol).
+    double integration_abstol = 1e-10;
+
+    /// The first time step attempted in KineticsSolver::integrate (in s).
+    /// If zero, the size of the last time step accepted in a previous call of
+    /// KineticsSolver::integrate is used, or the entire time interval if none.
+    double integration_dt_initial = 0.0;
+
+    /// The smallest time step allowed in KineticsSolver::integrate (in s), below which the integration fails.
+    double integration_dt_min = 1e-12;
+
+    /// The largest time step allowed in KineticsSolver::integrate (in s).
+    double integration_dt_max = inf;
+
+    /// The maximum number of time steps, accepted or rejected, in KineticsSolver::integrate, after which the integration fails.
+    Index integration_max_steps = 10000;
+
+    /// The flag indicating if kinetics steps are performed as direct implicit integration of the rate equations, without an equilibrium problem.
+    /// This mode is intended for chemical systems in which all species are
+    /// kinetically controlled (e.g., pure reaction networks). Each step of
+    /// length *Δt* then solves the backward Euler equations *n = n0 + ΔtKr(n)*
+    /// with Newton's method, where *K* is the stoichiometric matrix of the
+    /// reactions and *r* their rates, and the Jacobian matrix is computed only
+    /// with respect to the species that participate in reactions. No
+    /// optimization problem is set up in this mode, and only the
+    /// KineticsSolver methods without equilibrium conditions, restrictions,
+    /// or sensitivity derivatives are supported. The convergence tolerance and
+    /// maximum number of iterations are those in EquilibriumOptions::optima.
+    bool ode = false;
 };
 
 } // namespace Reaktoro
@@ -29,5 +29,12 @@ void exportKineticsOptions(py::module& m)
         .def(py::init<>())
         .def(py::init<EquilibriumOptions const&>())
         .def_readwrite("dt0", &KineticsOptions::dt0, "The time step used for preconditioning the chemical state when performing the very first chemical kinetics step.")
+        .def_readwrite("integration_reltol", &KineticsOptions::integration_reltol, "The relative tolerance of the local error of the species amounts in each time step of KineticsSolver.integrate.")
+        .def_readwrite("integration_abstol", &KineticsOptions::integration_abstol, "The absolute tolerance of the local error of the species amounts in each time step of KineticsSolver.integrate (in mol).")
+        .def_readwrite("integration_dt_initial", &KineticsOptions::integration_dt_initial, "The first time step attempted in KineticsSolver.integrate (in s).")
+        .def_readwrite("integration_dt_min", &KineticsOptions::integration_dt_min, "The smallest time step allowed in KineticsSolver.integrate (in s), below which the integration fails.")
+        .def_readwrite("integration_dt_max", &KineticsOptions::integration_dt_max, "The largest time step allowed in KineticsSolver.integrate (in s).")
+        .def_readwrite("integration_max_steps", &KineticsOptions::integration_max_steps, "The maximum number of time steps, accepted or rejected, in KineticsSolver.integrate, after which the integration fails.")
+        .def_readwrite("ode", &KineticsOptions::ode, "The flag indicating if kinetics steps are performed as direct implicit integration of the rate equations, without an equilibrium problem.")
         ;
 }
@@ -31,6 +31,15 @@ struct KineticsResult : EquilibriumResult
     /// Construct a  KineticsResult object from a EquilibriumResult one.
     KineticsResult(EquilibriumResult const& other)
     : EquilibriumResult(other) {}
+
+    /// The number of time steps accepted in KineticsSolver::integrate.
+    Index steps = 0;
+
+    /// The number of time steps rejected in KineticsSolver::integrate because of a large error estimate or a failed calculation.
+    Index steps_rejected = 0;
+
+    /// The size of the last time step accepted in KineticsSolver::integrate (in s).
+    double dt = 0.0;
 };
 
 } // namespace Reaktoro
@@ -27,5 +27,10 @@ void exportKineticsResult(py::module& m)
 {
     py::class_<KineticsResult, EquilibriumResult>(m, "KineticsResult")
         .def(py::init<>())
+        .def_readwrite("steps", &KineticsResult::steps, "The number of time steps accepted in KineticsSolver.integrate.")
+        .def_readwrite("steps_rejected", &KineticsResult::steps_rejected, "The number of time steps rejected in KineticsSolver.integrate because of a large error estimate or a failed calculation.")
+        .def_readwrite("dt", &KineticsResult::dt, "The size of the last time step accepted in KineticsSolver.integrate (in s).")
         ;
+
+    m.def("summarizeFailures", summarizeFailures<Vec<KineticsResult>>, "Return a summary of the failures in a batch of chemical kinetics calculations.");
 }
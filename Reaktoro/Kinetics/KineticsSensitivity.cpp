@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Kinetics/KineticsUtils.hpp>
 
 namespace Reaktoro {
 
@@ -30,6 +31,12 @@ KineticsSensitivity::KineticsSensitivity(EquilibriumSpecs const& specs)
 : EquilibriumSensitivity(specs)
 {}
 
+KineticsSensitivity::KineticsSensitivity(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents)
+: EquilibriumSensitivity()
+{
+    initialize(specs, wids, icomponents);
+}
+
 KineticsSensitivity::KineticsSensitivity(EquilibriumSensitivity const& other)
 : EquilibriumSensitivity(other)
 {}
@@ -39,6 +46,11 @@ auto KineticsSensitivity::initialize(EquilibriumSpecs const& specs) -> void
     EquilibriumSensitivity::initialize(specs);
 }
 
+auto KineticsSensitivity::initialize(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents) -> void
+{
+    EquilibriumSensitivity::initialize(detail::createEquilibriumSpecsForKinetics(specs), wids, icomponents);
+}
+
 auto KineticsSensitivity::dnddt() const -> VectorXdConstRef
 {
     return VectorXd{};
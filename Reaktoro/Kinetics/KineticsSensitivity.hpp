@@ -40,12 +40,31 @@ public:
     /// Construct a KineticsSensitivity object with given equilibrium problem specifications.
     explicit KineticsSensitivity(EquilibriumSpecs const& specs);
 
+    /// Construct a KineticsSensitivity object that only computes derivatives with respect to selected inputs.
+    /// @param specs The equilibrium specifications to be attained during chemical kinetics (the same used to construct the KineticsSolver object).
+    /// @param wids The identifiers of the input variables in *w* for which derivatives are computed (e.g., "T", "dt").
+    /// @param icomponents The indices of the conservative components in *c* for which derivatives are computed.
+    KineticsSensitivity(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents);
+
     /// Construct a KineticsSensitivity object from an EquilibriumSensitivity object.
     KineticsSensitivity(EquilibriumSensitivity const& other);
 
     /// Initialize this KineticsSensitivity object with given equilibrium problem specifications.
     auto initialize(EquilibriumSpecs const& specs) -> void;
 
+    /// Initialize this KineticsSensitivity object so that only derivatives with respect to selected inputs are computed.
+    /// The given equilibrium specifications are those provided to the
+    /// KineticsSolver object, and they are extended here with the time step
+    /// input *Δt* and the extent of reaction variables used in chemical
+    /// kinetics calculations. Thus, `"dt"` can be given in @p wids, and the
+    /// conservative components in *c* are those of @p specs followed by one
+    /// for each reaction in the chemical system. Derivatives with respect to
+    /// the unselected inputs are not computed and remain zero.
+    /// @param specs The equilibrium specifications to be attained during chemical kinetics (the same used to construct the KineticsSolver object).
+    /// @param wids The identifiers of the input variables in *w* for which derivatives are computed (e.g., "T", "dt").
+    /// @param icomponents The indices of the conservative components in *c* for which derivatives are computed.
+    auto initialize(EquilibriumSpecs const& specs, Strings const& wids, Indices const& icomponents) -> void;
+
     /// Return the derivatives of the species amounts *n* with respect to time step *Δt*.
     auto dnddt() const -> VectorXdConstRef;
 
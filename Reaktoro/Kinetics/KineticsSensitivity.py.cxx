@@ -31,8 +31,10 @@ void exportKineticsSensitivity(py::module& m)
     py::class_<KineticsSensitivity, EquilibriumSensitivity>(m, "KineticsSensitivity")
         .def(py::init<>())
         .def(py::init<EquilibriumSpecs const&>())
+        .def(py::init<EquilibriumSpecs const&, Strings const&, Indices const&>())
         .def(py::init<EquilibriumSensitivity const&>())
-        .def("initialize", &KineticsSensitivity::initialize, "Initialize this KineticsSensitivity object with given equilibrium problem specifications.")
+        .def("initialize", py::overload_cast<EquilibriumSpecs const&>(&KineticsSensitivity::initialize), "Initialize this KineticsSensitivity object with given equilibrium problem specifications.")
+        .def("initialize", py::overload_cast<EquilibriumSpecs const&, Strings const&, Indices const&>(&KineticsSensitivity::initialize), "Initialize this KineticsSensitivity object so that only derivatives with respect to selected inputs are computed.")
         .def("dnddt", &KineticsSensitivity::dnddt, return_internal_ref, "Return the derivatives of the species amounts n with respect to time step dt.")
         .def("dpddt", &KineticsSensitivity::dpddt, return_internal_ref, "Return the derivatives of the p control variables with respect to time step dt.")
         .def("dqddt", &KineticsSensitivity::dqddt, return_internal_ref, "Return the derivatives of the q control variables with respect to time step dt.")
@@ -17,13 +17,25 @@
 
 #include "KineticsSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
+// Eigen includes
+#include <Eigen/LU>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
@@ -50,6 +62,11 @@ struct KineticsSolver::Impl
     VectorXd c0;                       ///< The auxiliary vector used to set the initial amounts c0 of the conservative components of the equilibrium conditions used for the kinetics calculations.
     VectorXd plower;                   ///< The auxiliary vector used to set the lower bounds of p variables of the equilibrium conditions used for the kinetics calculations.
     VectorXd pupper;                   ///< The auxiliary vector used to set the upper bounds of p variables of the equilibrium conditions used for the kinetics calculations.
+    double dtlast = 0.0;               ///< The size of the last time step accepted in an integration with adaptive time steps (zero if none yet).
+    SharedPtr<ThreadPool> pool;        ///< The pool of worker threads used in batched kinetics calculations (created on demand and shared among copies of this solver).
+    Vec<SharedPtr<Impl>> workers;      ///< The copies of this solver used by each worker thread in batched kinetics calculations (created on demand, each in the thread of its worker).
+    ChemicalProps odeprops;            ///< The chemical properties used in kinetics steps performed in ODE mode (see KineticsOptions::ode).
+    Indices odespecies;                ///< The indices of the species that participate in at least one reaction (the only ones whose amounts change in ODE mode).
 
     /// Construct a KineticsSolver::Impl object with given equilibrium specifications to be attained during chemical kinetics.
     Impl(EquilibriumSpecs const& especs)
@@ -64,8 +81,15 @@ struct KineticsSolver::Impl
       w(kdims.Nw),
       c0(kdims.Nc),
       plower(kdims.Np),
-      pupper(kdims.Np)
+      pupper(kdims.Np),
+      odeprops(system)
     {
+        // Determine the species whose amounts can change in ODE mode (those with non-zero stoichiometric coefficients)
+        auto const& K = system.stoichiometricMatrix();
+        for(auto i = 0; i < K.rows(); ++i)
+            if(!K.row(i).isZero())
+                odespecies.push_back(i);
+
         // Initialize the equilibrium solver with the default options
         setOptions(koptions);
     }
@@ -78,6 +102,11 @@ struct KineticsSolver::Impl
 
         // Update the options in the underlying equilibrium solver
         ksolver.setOptions(koptions);
+
+        // Ensure the worker solvers used in batched calculations are recreated with the new options
+        workers.clear();
+        if(pool && koptions.threads != 0 && pool->numThreads() != koptions.threads)
+            pool.reset();
     }
 
     /// Update the equilibrium conditions for kinetics with given state and time step.
@@ -91,6 +120,8 @@ struct KineticsSolver::Impl
     /// Perform a kinetics step with a short time step if `state` has not reacted previously.
     auto preconditionOnFirstStep(ChemicalState& state, real const& dt) -> KineticsResult
     {
+        if(koptions.ode)
+            return {};
         if(state.equilibrium().empty())
         {
             updateEquilibriumConditionsForKinetics(state, koptions.dt0);
@@ -102,7 +133,7 @@ struct KineticsSolver::Impl
     /// Update the equilibrium conditions for kinetics with given state, time step, and equilibrium conditions to be attained during chemical kinetics.
     auto updateEquilibriumConditionsForKinetics(ChemicalState& state, real const& dt, EquilibriumConditions const& econditions) -> void
     {
-        auto const& K = system.stoichiometricMatrix();
+        auto const& K = system.stoichiometricMatrixSparse();
         auto const& n0 = state.speciesAmounts();
 
         w << econditions.inputValues(), dt;
@@ -123,6 +154,7 @@ struct KineticsSolver::Impl
     /// Perform a kinetics step with a short time step if `state` has not reacted previously.
     auto preconditionOnFirstStep(ChemicalState& state, real const& dt, EquilibriumConditions const& econditions) -> KineticsResult
     {
+        errorif(koptions.ode, "KineticsSolver in ODE mode (see KineticsOptions::ode) does not support equilibrium conditions.");
         if(state.equilibrium().empty())
         {
             updateEquilibriumConditionsForKinetics(state, koptions.dt0, econditions);
@@ -159,32 +191,178 @@ struct KineticsSolver::Impl
     //
     //=================================================================================================================
 
+    /// Perform a kinetics calculation, reporting an error only through its result if the quiet option is enabled (see EquilibriumOptions::quiet).
+    template<typename Calculation>
+    auto guarded(Calculation const& calculation) -> KineticsResult
+    {
+        if(!koptions.quiet)
+            return calculation();
+
+        try
+        {
+            return calculation();
+        }
+        catch(std::exception const&)
+        {
+            KineticsResult result;
+            result.error = true;
+            return result;
+        }
+    }
+
     auto solve(ChemicalState& state, real const& dt) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt);
-        updateEquilibriumConditionsForKinetics(state, dt);
-        return result += ksolver.solve(state, kconditions);
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
+        return guarded([&]() -> KineticsResult
+        {
+            if(koptions.ode)
+                return solveODE(state, dt);
+            auto result = preconditionOnFirstStep(state, dt);
+            updateEquilibriumConditionsForKinetics(state, dt);
+            return result += ksolver.solve(state, kconditions);
+        });
     }
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt);
-        updateEquilibriumConditionsForKinetics(state, dt);
-        return result += ksolver.solve(state, kconditions, restrictions);
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
+        return guarded([&]
+        {
+            errorif(koptions.ode, "KineticsSolver in ODE mode (see KineticsOptions::ode) does not support reactivity restrictions.");
+            auto result = preconditionOnFirstStep(state, dt);
+            updateEquilibriumConditionsForKinetics(state, dt);
+            return result += ksolver.solve(state, kconditions, restrictions);
+        });
     }
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt, conditions);
-        updateEquilibriumConditionsForKinetics(state, dt, conditions);
-        return result += ksolver.solve(state, kconditions);
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
+        return guarded([&]
+        {
+            auto result = preconditionOnFirstStep(state, dt, conditions);
+            updateEquilibriumConditionsForKinetics(state, dt, conditions);
+            return result += ksolver.solve(state, kconditions);
+        });
     }
 
     auto solve(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
-        auto result = preconditionOnFirstStep(state, dt, conditions);
-        updateEquilibriumConditionsForKinetics(state, dt, conditions);
-        return result += ksolver.solve(state, kconditions, restrictions);
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
+        return guarded([&]
+        {
+            auto result = preconditionOnFirstStep(state, dt, conditions);
+            updateEquilibriumConditionsForKinetics(state, dt, conditions);
+            return result += ksolver.solve(state, kconditions, restrictions);
+        });
+    }
+
+    /// Perform a kinetics step in ODE mode as a backward Euler step of the rate equations *dn/dt = Kr(n)* solved with Newton's method.
+    auto solveODE(ChemicalState& state, real const& dt) -> KineticsResult
+    {
+        REAKTORO_PROFILE("KineticsSolver::solveODE");
+
+        const auto begin = time();
+
+        KineticsResult result;
+        result.optima.succeeded = false;
+        result.optima.iterations = 0;
+
+        auto const& K = system.stoichiometricMatrix();
+        auto const& iks = odespecies;
+
+        const auto Nk = iks.size();
+        const auto Nr = K.cols();
+
+        const auto tolerance = koptions.optima.convergence.tolerance;
+        const auto maxiters = koptions.optima.maxiters;
+        const auto epsilon = koptions.epsilon;
+        const auto tau = 0.99; // the fraction-to-the-boundary factor keeping species amounts positive in Newton steps
+
+        auto const& T = state.temperature();
+        auto const& P = state.pressure();
+        const auto h = double(dt);
+
+        if(Nk == 0)
+        {
+            result.optima.succeeded = true; // there are no species whose amounts change with time
+            return result;
+        }
+
+        ArrayXr n = state.speciesAmounts();
+
+        const MatrixXd Kk = K(iks, Eigen::all); // the rows of K corresponding to the species that participate in reactions
+        const ArrayXd nk0 = n(iks).cast<double>();
+        const auto scale = std::max(nk0.abs().maxCoeff(), epsilon);
+
+        ArrayXd nk = nk0.max(epsilon);
+        VectorXd r = zeros(Nr);
+        VectorXd F, dnk;
+        MatrixXd drdn(Nr, Nk), J;
+
+        for(Index iter = 0; iter < maxiters; ++iter)
+        {
+            n(iks) = nk.cast<real>();
+
+            // Compute the reaction rates and their derivatives with respect to the amounts of the species that participate in reactions
+            for(auto j = 0; j < Nk; ++j)
+            {
+                autodiff::seed(n[iks[j]]);
+                odeprops.update(T, P, n);
+                const VectorXr rates = odeprops.reactionRates().matrix();
+                autodiff::unseed(n[iks[j]]);
+                drdn.col(j) = grad(rates);
+                if(j == 0)
+                    r = rates.cast<double>();
+            }
+
+            result.timing.evaluations += Nk;
+
+            // The residual of the backward Euler equations for the species that participate in reactions
+            F = (nk - nk0).matrix() - h * Kk * r;
+
+            if(!F.allFinite())
+                return result;
+
+            if(F.cwiseAbs().maxCoeff() <= tolerance * scale)
+            {
+                result.optima.succeeded = true;
+                break;
+            }
+
+            J = identity(Nk, Nk) - h * Kk * drdn;
+
+            dnk = J.partialPivLu().solve(-F);
+
+            // Limit the Newton step so that the species amounts remain positive
+            auto alpha = 1.0;
+            for(auto i = 0; i < Nk; ++i)
+                if(dnk[i] < 0.0)
+                    alpha = std::min(alpha, -tau * nk[i] / dnk[i]);
+
+            nk = (nk + alpha * dnk.array()).max(epsilon);
+
+            result.optima.iterations = iter + 1;
+        }
+
+        if(!result.optima.succeeded)
+            return result;
+
+        n(iks) = nk.cast<real>();
+
+        odeprops.update(T, P, n);
+        result.timing.evaluations += 1;
+
+        state.setSpeciesAmounts(n);
+        state.props() = odeprops;
+
+        result.timing.solve = elapsed(begin);
+
+        return result;
     }
 
     //=================================================================================================================
@@ -195,6 +373,10 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt) -> KineticsResult
     {
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
+        errorif(koptions.ode, "KineticsSolver in ODE mode (see KineticsOptions::ode) does not support sensitivity derivatives.");
+
         auto result = preconditionOnFirstStep(state, dt);
         updateEquilibriumConditionsForKinetics(state, dt);
         return result += ksolver.solve(state, sensitivity, kconditions);
@@ -202,6 +384,10 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
+        errorif(koptions.ode, "KineticsSolver in ODE mode (see KineticsOptions::ode) does not support sensitivity derivatives.");
+
         auto result = preconditionOnFirstStep(state, dt);
         updateEquilibriumConditionsForKinetics(state, dt);
         return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
@@ -209,6 +395,8 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions) -> KineticsResult
     {
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
         auto result = preconditionOnFirstStep(state, dt, conditions);
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, sensitivity, kconditions);
@@ -216,10 +404,203 @@ struct KineticsSolver::Impl
 
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
     {
+        REAKTORO_PROFILE("KineticsSolver::solve");
+
         auto result = preconditionOnFirstStep(state, dt, conditions);
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return result += ksolver.solve(state, sensitivity, kconditions, restrictions);
     }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS INTEGRATION METHODS
+    //
+    //=================================================================================================================
+
+    auto integrate(ChemicalState& state, double t) -> KineticsResult
+    {
+        auto precondition = [&](ChemicalState& s) { return preconditionOnFirstStep(s, 0.0); };
+        auto step = [&](ChemicalState& s, double dt) { return solve(s, dt); };
+        return integrate(state, t, precondition, step);
+    }
+
+    auto integrate(ChemicalState& state, double t, EquilibriumRestrictions const& restrictions) -> KineticsResult
+    {
+        auto precondition = [&](ChemicalState& s) { return preconditionOnFirstStep(s, 0.0); };
+        auto step = [&](ChemicalState& s, double dt) { return solve(s, dt, restrictions); };
+        return integrate(state, t, precondition, step);
+    }
+
+    auto integrate(ChemicalState& state, double t, EquilibriumConditions const& conditions) -> KineticsResult
+    {
+        auto precondition = [&](ChemicalState& s) { return preconditionOnFirstStep(s, 0.0, conditions); };
+        auto step = [&](ChemicalState& s, double dt) { return solve(s, dt, conditions); };
+        return integrate(state, t, precondition, step);
+    }
+
+    auto integrate(ChemicalState& state, double t, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
+    {
+        auto precondition = [&](ChemicalState& s) { return preconditionOnFirstStep(s, 0.0, conditions); };
+        auto step = [&](ChemicalState& s, double dt) { return solve(s, dt, conditions, restrictions); };
+        return integrate(state, t, precondition, step);
+    }
+
+    /// React a chemical state over a time interval using adaptive time steps, each performed with the implicit kinetics step `step`.
+    /// The time steps are controlled with step doubling. Every step of length
+    /// *h* is also performed as two steps of length *h*/2, and the difference
+    /// between the species amounts from both is used as an estimate of the
+    /// local error of the latter, which is the one accepted if this error is
+    /// within tolerance. The next time step is then predicted from this error
+    /// estimate, considering the first-order accuracy of the implicit steps.
+    template<typename PreconditionFn, typename StepFn>
+    auto integrate(ChemicalState& state, double t, PreconditionFn const& precondition, StepFn const& step) -> KineticsResult
+    {
+        errorif(t < 0.0, "Expecting a non-negative time interval in KineticsSolver::integrate, but got ", t, " seconds.");
+
+        const auto reltol = koptions.integration_reltol;
+        const auto abstol = koptions.integration_abstol;
+        const auto dtmin = koptions.integration_dt_min;
+        const auto dtmax = koptions.integration_dt_max;
+
+        const auto safety = 0.9;    // the safety factor applied to the predicted optimal time step
+        const auto minfactor = 0.2; // the smallest factor by which a time step can be reduced
+        const auto maxfactor = 5.0; // the largest factor by which a time step can be increased
+
+        KineticsResult result = precondition(state);
+
+        if(t == 0.0)
+        {
+            result += step(state, 0.0);
+            return result;
+        }
+
+        ChemicalState full(state);
+        ChemicalState half(state);
+
+        auto h = koptions.integration_dt_initial > 0.0 ? koptions.integration_dt_initial : dtlast > 0.0 ? dtlast : t;
+        h = std::min(h, dtmax);
+
+        auto time = 0.0;
+
+        while(time < t)
+        {
+            if(result.steps + result.steps_rejected >= koptions.integration_max_steps || (h < dtmin && h < t - time))
+            {
+                result.optima.succeeded = false;
+                return result;
+            }
+
+            const auto last = h >= t - time; // true if this step reaches the end of the time interval
+            const auto dt = last ? t - time : h;
+
+            full.assign(state);
+            half.assign(state);
+
+            const auto rfull = step(full, dt);
+            const auto rhalf1 = rfull.succeeded() ? step(half, 0.5 * dt) : KineticsResult();
+            const auto rhalf2 = rhalf1.succeeded() ? step(half, 0.5 * dt) : KineticsResult();
+
+            // Halve the time step if any of the calculations failed
+            if(!rfull.succeeded() || !rhalf1.succeeded() || !rhalf2.succeeded())
+            {
+                result.steps_rejected += 1;
+                h = 0.5 * dt;
+                continue;
+            }
+
+            // The local error estimate of the species amounts relative to the error tolerances
+            const ArrayXd n1 = full.speciesAmounts().cast<double>();
+            const ArrayXd n2 = half.speciesAmounts().cast<double>();
+            const auto scale = abstol + reltol * n1.abs().max(n2.abs());
+            const auto error = ((n2 - n1).abs() / scale).maxCoeff();
+
+            if(error <= 1.0)
+            {
+                state.assign(half);
+                time = last ? t : time + dt;
+                result.steps += 1;
+                result.dt = dt;
+                result += rfull;
+                result += rhalf1;
+                result += rhalf2;
+            }
+            else result.steps_rejected += 1;
+
+            const auto factor = error > 0.0 ? safety / std::sqrt(error) : maxfactor;
+            h = std::min(dt * std::clamp(factor, minfactor, maxfactor), dtmax);
+        }
+
+        result.optima.succeeded = true;
+
+        dtlast = result.dt;
+
+        return result;
+    }
+
+    //=================================================================================================================
+    //
+    // BATCHED CHEMICAL KINETICS METHODS
+    //
+    //=================================================================================================================
+
+    /// Ensure the pool of worker threads and the worker solvers exist for a batched kinetics calculation.
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(koptions.threads);
+
+        const auto numworkers = pool->numThreads();
+
+        if(workers.size() == numworkers)
+            return;
+
+        workers.clear();
+
+        // Copy this solver in the thread of each worker, so that the memory of its copy is local to the worker on NUMA systems
+        const Impl prototype(*this); // copy of this solver without its own workers
+        Vec<SharedPtr<Impl>> copies(numworkers);
+        pool->forEachWorker([&](Index iworker)
+        {
+            copies[iworker] = std::make_shared<Impl>(prototype);
+        });
+        workers = std::move(copies);
+    }
+
+    auto solve(Vec<ChemicalState>& states, real const& dt) -> Vec<KineticsResult>
+    {
+        initializeWorkers();
+        Vec<KineticsResult> results(states.size());
+        pool->parallelFor(states.size(), [&](Index i, Index iworker)
+        {
+            results[i] = workers[iworker]->solve(states[i], dt);
+        });
+        return results;
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts) -> Vec<KineticsResult>
+    {
+        errorif(states.size() != dts.size(), "Expecting the same number of ChemicalState objects and time steps in batched KineticsSolver::solve, but got ", states.size(), " and ", dts.size(), " respectively.");
+        initializeWorkers();
+        Vec<KineticsResult> results(states.size());
+        pool->parallelFor(states.size(), [&](Index i, Index iworker)
+        {
+            results[i] = workers[iworker]->solve(states[i], dts[i]);
+        });
+        return results;
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> Vec<KineticsResult>
+    {
+        errorif(states.size() != dts.size(), "Expecting the same number of ChemicalState objects and time steps in batched KineticsSolver::solve, but got ", states.size(), " and ", dts.size(), " respectively.");
+        errorif(states.size() != conditions.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects in batched KineticsSolver::solve, but got ", states.size(), " and ", conditions.size(), " respectively.");
+        initializeWorkers();
+        Vec<KineticsResult> results(states.size());
+        pool->parallelFor(states.size(), [&](Index i, Index iworker)
+        {
+            results[i] = workers[iworker]->solve(states[i], dts[i], conditions[i]);
+        });
+        return results;
+    }
 };
 
 KineticsSolver::KineticsSolver(ChemicalSystem const& system)
@@ -232,7 +613,9 @@ KineticsSolver::KineticsSolver(EquilibriumSpecs const& specs)
 
 KineticsSolver::KineticsSolver(KineticsSolver const& other)
 : pimpl(new Impl(*other.pimpl))
-{}
+{
+    pimpl->workers.clear(); // the copy creates its own worker solvers when needed
+}
 
 KineticsSolver::~KineticsSolver()
 {}
@@ -303,6 +686,56 @@ auto KineticsSolver::solve(ChemicalState& state, KineticsSensitivity& sensitivit
     return pimpl->solve(state, sensitivity, dt, conditions, restrictions);
 }
 
+auto KineticsSolver::integrate(ChemicalState& state, double t) -> KineticsResult
+{
+    return pimpl->integrate(state, t);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, double t, EquilibriumRestrictions const& restrictions) -> KineticsResult
+{
+    return pimpl->integrate(state, t, restrictions);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, double t, EquilibriumConditions const& conditions) -> KineticsResult
+{
+    return pimpl->integrate(state, t, conditions);
+}
+
+auto KineticsSolver::integrate(ChemicalState& state, double t, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult
+{
+    return pimpl->integrate(state, t, conditions, restrictions);
+}
+
+auto KineticsSolver::solve(Vec<ChemicalState>& states, real const& dt) -> Vec<KineticsResult>
+{
+    return pimpl->solve(states, dt);
+}
+
+auto KineticsSolver::solve(Vec<ChemicalState>& states, Vec<real> const& dts) -> Vec<KineticsResult>
+{
+    return pimpl->solve(states, dts);
+}
+
+auto KineticsSolver::solve(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> Vec<KineticsResult>
+{
+    return pimpl->solve(states, dts, conditions);
+}
+
+auto KineticsSolver::solveAsync(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> std::future<KineticsResult>
+{
+    return std::async(std::launch::async, [impl = pimpl.get(), &state, dt, conditions] { return impl->solve(state, dt, conditions); });
+}
+
+auto KineticsSolver::solveAsync(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> std::future<Vec<KineticsResult>>
+{
+    return std::async(std::launch::async, [impl = pimpl.get(), &states, dts, conditions] { return impl->solve(states, dts, conditions); });
+}
+
+auto KineticsSolver::replay(ChemicalState& state, EquilibriumRecord const& record) -> KineticsResult
+{
+    return pimpl->ksolver.replay(state, record);
+}
+
 auto KineticsSolver::setOptions(KineticsOptions const& options) -> void
 {
     pimpl->setOptions(options);
@@ -17,6 +17,9 @@
 
 #pragma once
 
+// C++ includes
+#include <future>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
@@ -31,6 +34,7 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
 class KineticsSensitivity;
+struct EquilibriumRecord;
 struct KineticsOptions;
 struct KineticsResult;
 
@@ -149,6 +153,114 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS INTEGRATION METHODS
+    //
+    //=================================================================================================================
+
+    /// React a chemical state for a given time interval using adaptive time steps.
+    /// The time interval is divided into time steps whose sizes are chosen
+    /// automatically, each performed as the implicit kinetics step in @ref
+    /// solve. The local error of each step is estimated with step doubling
+    /// (i.e., by comparing the species amounts from one step with those from
+    /// two steps of half its size), and the step is accepted only if this
+    /// error is within the tolerances KineticsOptions::integration_reltol and
+    /// KineticsOptions::integration_abstol. Otherwise, or if the calculation
+    /// fails, the step is repeated with a smaller size. Each attempted step
+    /// thus costs three kinetics calculations. The size of the last accepted
+    /// step is used as the first one in the next integration, unless
+    /// KineticsOptions::integration_dt_initial is positive.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed reacted state (out)
+    /// @param t The time interval in the kinetics calculation (in s).
+    /// @note The computed state is not changed by the failed or rejected steps, only by the accepted ones (see KineticsResult::steps).
+    auto integrate(ChemicalState& state, double t) -> KineticsResult;
+
+    /// React a chemical state for a given time interval using adaptive time steps respecting given reactivity restrictions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, double)
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto integrate(ChemicalState& state, double t, EquilibriumRestrictions const& restrictions) -> KineticsResult;
+
+    /// React a chemical state for a given time interval using adaptive time steps respecting given constraint conditions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, double)
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics
+    auto integrate(ChemicalState& state, double t, EquilibriumConditions const& conditions) -> KineticsResult;
+
+    /// React a chemical state for a given time interval using adaptive time steps respecting given constraint conditions and reactivity restrictions.
+    /// \copydetails KineticsSolver::integrate(ChemicalState&, double)
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto integrate(ChemicalState& state, double t, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> KineticsResult;
+
+    //=================================================================================================================
+    //
+    // BATCHED CHEMICAL KINETICS METHODS
+    //
+    //=================================================================================================================
+
+    /// React many chemical states in parallel for a given time interval.
+    /// The calculations are distributed among a pool of worker threads
+    /// (see EquilibriumOptions::threads), each using its own copy of this
+    /// solver. The chemical system, including its reactions and their rate
+    /// models, is shared among these copies rather than duplicated.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed reacted states (out)
+    /// @param dt The time step in the kinetics calculation of every state (in s).
+    /// @return The result of the kinetics calculation of each state
+    auto solve(Vec<ChemicalState>& states, real const& dt) -> Vec<KineticsResult>;
+
+    /// React many chemical states in parallel, each for its own time interval.
+    /// \copydetails KineticsSolver::solve(Vec<ChemicalState>&, real const&)
+    /// @param dts The time step in the kinetics calculation of each state (in s).
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts) -> Vec<KineticsResult>;
+
+    /// React many chemical states in parallel, each for its own time interval and respecting its own constraint conditions.
+    /// \copydetails KineticsSolver::solve(Vec<ChemicalState>&, real const&)
+    /// @param dts The time step in the kinetics calculation of each state (in s).
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics for each state
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> Vec<KineticsResult>;
+
+    //=================================================================================================================
+    //
+    // ASYNCHRONOUS CHEMICAL KINETICS METHODS
+    //
+    //=================================================================================================================
+
+    /// React a chemical state for a given time interval in a background thread respecting given constraint conditions.
+    /// The calculation overlaps with the work of the calling thread (e.g.,
+    /// transport, I/O or communication) until the result is requested from
+    /// the returned future, which also rethrows any error of the calculation.
+    /// Until then, neither this solver nor `state` may be used.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed reacted state (out)
+    /// @param dt The time step in the kinetics calculation (in s).
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics (copied)
+    auto solveAsync(ChemicalState& state, real const& dt, EquilibriumConditions const& conditions) -> std::future<KineticsResult>;
+
+    /// React many chemical states in a background thread, each for its own time interval and respecting its own constraint conditions.
+    /// The calculations are distributed among the pool of worker threads used
+    /// in batched calculations (see EquilibriumOptions::threads and
+    /// ThreadPool::setDefaultExecutor). Until the result is requested from
+    /// the returned future, neither this solver nor `states` may be used.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed reacted states (out)
+    /// @param dts The time step in the kinetics calculation of each state (in s).
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics for each state (copied)
+    auto solveAsync(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> std::future<Vec<KineticsResult>>;
+
+    //=================================================================================================================
+    //
+    // REPLAY METHODS
+    //
+    //=================================================================================================================
+
+    /// Repeat a recorded time step of a chemical kinetics calculation in isolation (e.g., to profile it with Profiler).
+    /// The time steps of chemical kinetics calculations are recorded as
+    /// equilibrium calculations of the underlying equilibrium solver (see
+    /// EquilibriumOptions::record_file and EquilibriumSolver::replay). This
+    /// solver must have the same equilibrium specifications and options as
+    /// the one that recorded the time step.
+    /// @param[out] state The chemical state computed at the end of the time step
+    /// @param record The recorded time step (see readEquilibriumRecords)
+    auto replay(ChemicalState& state, EquilibriumRecord const& record) -> KineticsResult;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -19,9 +19,11 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumRecord.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Kinetics/KineticsOptions.hpp>
 #include <Reaktoro/Kinetics/KineticsResult.hpp>
@@ -29,27 +31,81 @@
 #include <Reaktoro/Kinetics/KineticsSolver.hpp>
 using namespace Reaktoro;
 
+// React copies of the given chemical states in parallel and assign the results back to them.
+// The states are received as pointers so that Python sees the updated ChemicalState objects.
+auto solveBatch(KineticsSolver& solver, std::vector<ChemicalState*> const& states, Vec<real> const& dts, Vec<EquilibriumConditions> const* conditions) -> Vec<KineticsResult>
+{
+    Vec<ChemicalState> copies;
+    copies.reserve(states.size());
+    for(auto const* state : states)
+        copies.push_back(*state);
+    auto results = conditions ? solver.solve(copies, dts, *conditions) : solver.solve(copies, dts);
+    for(auto i = 0; i < states.size(); ++i)
+        states[i]->assign(copies[i]);
+    return results;
+}
+
+// React one chemical state per cell for a time interval with temperatures (in K), pressures (in Pa)
+// and initial amounts of conservative components given cell-wise in arrays, returning the species
+// amounts in each cell (one row per cell) and the result of each calculation.
+auto solveCells(KineticsSolver& solver, ChemicalState const& state, real const& dt, EquilibriumConditions const& conditions, ArrayXdConstRef const& T, ArrayXdConstRef const& P, ArrayXXdConstRef const& b) -> std::tuple<ArrayXXd, Vec<KineticsResult>>
+{
+    const auto Ncells = T.size();
+    errorif(P.size() != Ncells, "Expecting as many pressure values as temperature values in batched KineticsSolver::solve, but got ", P.size(), " and ", Ncells, " respectively.");
+    errorif(b.rows() != Ncells, "Expecting one row of initial component amounts per cell in batched KineticsSolver::solve, but got ", b.rows(), " rows for ", Ncells, " cells.");
+
+    Vec<ChemicalState> states(Ncells, state);
+    Vec<EquilibriumConditions> conds(Ncells, conditions);
+    for(auto i = 0; i < Ncells; ++i)
+    {
+        states[i].setTemperature(T[i]);
+        states[i].setPressure(P[i]);
+        conds[i].temperature(T[i]);
+        conds[i].pressure(P[i]);
+        conds[i].setInitialComponentAmounts(b.row(i).transpose().matrix());
+    }
+
+    auto results = solver.solve(states, Vec<real>(Ncells, dt), conds);
+
+    ArrayXXd n(Ncells, state.system().species().size());
+    for(auto i = 0; i < Ncells; ++i)
+        n.row(i) = states[i].speciesAmounts().cast<double>().transpose();
+
+    return { n, results };
+}
+
 void exportKineticsSolver(py::module& m)
 {
     py::class_<KineticsSolver>(m, "KineticsSolver")
         .def(py::init<ChemicalSystem const&>())
         .def(py::init<EquilibriumSpecs const&>())
 
-        .def("precondition", py::overload_cast<ChemicalState&>(&KineticsSolver::precondition), "React a chemical state for zero seconds to precondition it.", py::arg("state"))
-        .def("precondition", py::overload_cast<ChemicalState&, EquilibriumRestrictions const&>(&KineticsSolver::precondition), "React a chemical state for zero seconds to precondition it respecting given reactivity restrictions.", py::arg("state"), py::arg("restrictions"))
-        .def("precondition", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&KineticsSolver::precondition), "React a chemical state for zero seconds to precondition it respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
-        .def("precondition", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::precondition), "React a chemical state for zero seconds to precondition it respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+        .def("precondition", py::overload_cast<ChemicalState&>(&KineticsSolver::precondition), py::call_guard<py::gil_scoped_release>(), "React a chemical state for zero seconds to precondition it.", py::arg("state"))
+        .def("precondition", py::overload_cast<ChemicalState&, EquilibriumRestrictions const&>(&KineticsSolver::precondition), py::call_guard<py::gil_scoped_release>(), "React a chemical state for zero seconds to precondition it respecting given reactivity restrictions.", py::arg("state"), py::arg("restrictions"))
+        .def("precondition", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&KineticsSolver::precondition), py::call_guard<py::gil_scoped_release>(), "React a chemical state for zero seconds to precondition it respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
+        .def("precondition", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::precondition), py::call_guard<py::gil_scoped_release>(), "React a chemical state for zero seconds to precondition it respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("solve", py::overload_cast<ChemicalState&, real const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval.", py::arg("state"), py::arg("dt"))
+        .def("solve", py::overload_cast<ChemicalState&, real const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval respecting given reactivity restrictions.", py::arg("state"), py::arg("dt"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, real const&, EquilibriumConditions const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval respecting given constraint conditions.", py::arg("state"), py::arg("dt"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
+
+        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"))
+        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
 
-        .def("solve", py::overload_cast<ChemicalState&, real const&>(&KineticsSolver::solve), "React a chemical state for a given time interval.", py::arg("state"), py::arg("dt"))
-        .def("solve", py::overload_cast<ChemicalState&, real const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given reactivity restrictions.", py::arg("state"), py::arg("dt"), py::arg("restrictions"))
-        .def("solve", py::overload_cast<ChemicalState&, real const&, EquilibriumConditions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions.", py::arg("state"), py::arg("dt"), py::arg("conditions"))
-        .def("solve", py::overload_cast<ChemicalState&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
+        .def("solve", [](KineticsSolver& self, std::vector<ChemicalState*> const& states, real const& dt) { return solveBatch(self, states, Vec<real>(states.size(), dt), nullptr); }, py::call_guard<py::gil_scoped_release>(), "React multiple chemical states in parallel for a given time interval.", py::arg("states"), py::arg("dt"))
+        .def("solve", [](KineticsSolver& self, std::vector<ChemicalState*> const& states, Vec<real> const& dts) { return solveBatch(self, states, dts, nullptr); }, py::call_guard<py::gil_scoped_release>(), "React multiple chemical states in parallel, each for its own time interval.", py::arg("states"), py::arg("dts"))
+        .def("solve", [](KineticsSolver& self, std::vector<ChemicalState*> const& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) { return solveBatch(self, states, dts, &conditions); }, py::call_guard<py::gil_scoped_release>(), "React multiple chemical states in parallel, each for its own time interval and respecting its own constraint conditions.", py::arg("states"), py::arg("dts"), py::arg("conditions"))
+        .def("solve", solveCells, py::call_guard<py::gil_scoped_release>(), "React one chemical state per cell in parallel for a given time interval with cell-wise temperatures (in K), pressures (in Pa) and initial component amounts (one row per cell), returning the species amounts in each cell (one row per cell) and the result of each calculation.", py::arg("state"), py::arg("dt"), py::arg("conditions"), py::arg("T"), py::arg("P"), py::arg("b"))
 
-        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&>(&KineticsSolver::solve), "React a chemical state for a given time interval and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"))
-        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("restrictions"))
-        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"))
-        .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
+        .def("integrate", py::overload_cast<ChemicalState&, double>(&KineticsSolver::integrate), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval using adaptive time steps.", py::arg("state"), py::arg("t"))
+        .def("integrate", py::overload_cast<ChemicalState&, double, EquilibriumRestrictions const&>(&KineticsSolver::integrate), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval using adaptive time steps respecting given reactivity restrictions.", py::arg("state"), py::arg("t"), py::arg("restrictions"))
+        .def("integrate", py::overload_cast<ChemicalState&, double, EquilibriumConditions const&>(&KineticsSolver::integrate), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval using adaptive time steps respecting given constraint conditions.", py::arg("state"), py::arg("t"), py::arg("conditions"))
+        .def("integrate", py::overload_cast<ChemicalState&, double, EquilibriumConditions const&, EquilibriumRestrictions const&>(&KineticsSolver::integrate), py::call_guard<py::gil_scoped_release>(), "React a chemical state for a given time interval using adaptive time steps respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("t"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("replay", &KineticsSolver::replay, py::call_guard<py::gil_scoped_release>(), "Repeat a recorded time step of a chemical kinetics calculation in isolation.", py::arg("state"), py::arg("record"))
         .def("setOptions", &KineticsSolver::setOptions)
         ;
 }
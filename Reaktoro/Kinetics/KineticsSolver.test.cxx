@@ -16,6 +16,7 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cmath>
 #include <iomanip>
 
 // Catch includes
@@ -128,4 +129,139 @@ TEST_CASE("Testing KineticsSolver", "[KineticsSolver]")
 
         REQUIRE_NOTHROW( solver.solve(state, dt) ); // state was previously used in an equilibrium calculation can the underlying Optima:State does not have p variables (which exist in the kinetic calculations)
     }
+
+    SECTION("When the rate equations are integrated directly in ODE mode")
+    {
+        KineticsOptions options;
+        options.ode = true;
+
+        KineticsSolver solver(system);
+        solver.setOptions(options);
+
+        const auto dt = 1.0;
+
+        auto res = solver.solve(state, dt);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( state.speciesAmount("C(gr)") == Approx(0.990099) ); // the same backward Euler step as in the equilibrium-based kinetics calculation
+        CHECK( state.speciesAmount("O2")    == Approx(0.990099) );
+        CHECK( state.speciesAmount("CO2")   == Approx(0.009901) );
+
+        EquilibriumRestrictions restrictions(system);
+
+        CHECK_THROWS( solver.solve(state, dt, restrictions) );
+
+        res = solver.integrate(state, 10.0);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( state.speciesAmount("C(gr)") == Approx(0.990099 * std::exp(-0.1)).epsilon(1e-2) );
+    }
+
+    SECTION("When only selected sensitivity derivatives are computed")
+    {
+        EquilibriumSpecs specs = EquilibriumSpecs::TP(system);
+
+        KineticsSolver solver(specs);
+
+        ChemicalState fullstate(state);
+        ChemicalState selectedstate(state);
+
+        KineticsSensitivity full;
+        REQUIRE( solver.solve(fullstate, full, 1.0).succeeded() );
+
+        KineticsSensitivity selected(specs, {"dt"}, {0});
+
+        CHECK( selected.selective() );
+
+        REQUIRE( solver.solve(selectedstate, selected, 1.0).succeeded() );
+
+        CHECK( selectedstate.speciesAmounts().isApprox(fullstate.speciesAmounts()) );
+
+        CHECK( selected.dndw("dt").isApprox(full.dndw("dt")) );
+        CHECK( selected.dndw("T").isZero() );
+        CHECK( selected.dndc().col(0).isApprox(full.dndc().col(0)) );
+        CHECK( selected.dndc().rightCols(full.dndc().cols() - 1).isZero() );
+
+        CHECK_THROWS( KineticsSensitivity(specs, {"V"}, {}) );
+    }
+
+    SECTION("When derivatives are reused across kinetics steps")
+    {
+        KineticsSolver solver(system);
+        KineticsSolver reusingsolver(system);
+
+        KineticsOptions options;
+        options.jacobian_reuse = 10;
+        reusingsolver.setOptions(options);
+
+        ChemicalState reusingstate(state);
+
+        for(auto i = 0; i < 10; ++i)
+        {
+            REQUIRE( solver.solve(state, 1.0).succeeded() );
+            REQUIRE( reusingsolver.solve(reusingstate, 1.0).succeeded() );
+        }
+
+        CHECK( reusingstate.speciesAmount("C(gr)") == Approx(state.speciesAmount("C(gr)")) );
+        CHECK( reusingstate.speciesAmount("CO2") == Approx(state.speciesAmount("CO2")) );
+    }
+
+    SECTION("When the kinetics equations are integrated with adaptive time steps")
+    {
+        KineticsSolver solver(system);
+
+        KineticsOptions options;
+        options.integration_reltol = 1e-4;
+        solver.setOptions(options);
+
+        auto res = solver.integrate(state, 100.0);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( res.steps > 1 );
+        CHECK( res.dt > 0.0 );
+        CHECK( state.speciesAmount("C(gr)") == Approx(std::exp(-1.0)).epsilon(0.01) ); // the exact solution is n(t) = exp(-k0*t)
+
+        res = solver.integrate(state, 0.0);
+
+        REQUIRE( res.succeeded() );
+
+        CHECK( res.steps == 0 );
+    }
+
+    SECTION("When many states are reacted in parallel with batched calculations")
+    {
+        KineticsSolver solver(system);
+
+        KineticsOptions options;
+        options.threads = 3;
+        solver.setOptions(options);
+
+        const Vec<real> dts = { 0.5, 1.0, 2.0, 4.0, 8.0 };
+
+        Vec<ChemicalState> states(dts.size(), state);
+
+        auto results = solver.solve(states, dts);
+
+        REQUIRE( results.size() == dts.size() );
+
+        KineticsSolver sequential(system);
+
+        for(auto i = 0; i < dts.size(); ++i)
+        {
+            ChemicalState expected(state);
+            sequential.solve(expected, dts[i]);
+
+            REQUIRE( results[i].succeeded() );
+            CHECK( states[i].speciesAmount("C(gr)") == Approx(expected.speciesAmount("C(gr)")) );
+            CHECK( states[i].speciesAmount("CO2") == Approx(expected.speciesAmount("CO2")) );
+        }
+
+        CHECK( states[1].speciesAmount("C(gr)") == Approx(0.990099) );
+
+        Vec<ChemicalState> twostates(2, state);
+        CHECK_THROWS( solver.solve(twostates, dts) );
+    }
 }
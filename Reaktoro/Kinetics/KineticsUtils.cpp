@@ -63,8 +63,9 @@ auto createEquilibriumSpecsForKinetics(EquilibriumSpecs specs) -> EquilibriumSpe
     // Add Δt as input to the calculation (idt is the index of dt := Δt input in the w argument vector when defining equation constraints)
     const auto idt = specs.addInput("dt");
 
-    // Compute matrix M = tr(K)*K
-    const MatrixXd M = K.transpose() * K;
+    // The stoichiometric matrix K and its transpose in compressed sparse storage (each reaction involves only a few species)
+    const SparseMatrixXd Ks = system.stoichiometricMatrixSparse();
+    const SparseMatrixXd KsT = Ks.transpose();
 
     // Add equation constraints to `specs` to model the kinetic rates of the reactions in the equilibrium problem
     EquationConstraints econstraints;
@@ -74,7 +75,8 @@ auto createEquilibriumSpecsForKinetics(EquilibriumSpecs specs) -> EquilibriumSpe
         auto const& dt = w[idt]; // Δt can be found at the input vector w
         auto const& dxi = p.tail(Nr); // Δξ = the last Nr added entries in p
         const VectorXr r = props.reactionRates();
-        return dxi - dt * M * r; // Δξ - ΔtMr = 0
+        const VectorXr Kr = Ks * r;
+        return dxi - dt * (KsT * Kr); // Δξ - ΔtMr = 0, where M = tr(K)*K is applied as tr(K)*(K*r) to avoid the dense Nr x Nr product
     };
 
     specs.addConstraints(econstraints);
@@ -161,6 +161,51 @@ struct SmartKineticsSolver::Impl
         updateEquilibriumConditionsForKinetics(state, dt, conditions);
         return ksolver.solve(state, sensitivity, kconditions, restrictions);
     }
+
+    //=================================================================================================================
+    //
+    // BATCHED CHEMICAL KINETICS METHODS
+    //
+    //=================================================================================================================
+
+    auto solve(Vec<ChemicalState>& states, real const& dt) -> Vec<SmartKineticsResult>
+    {
+        return solve(states, Vec<real>(states.size(), dt));
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts) -> Vec<SmartKineticsResult>
+    {
+        errorif(states.size() != dts.size(), "Expecting the same number of ChemicalState objects and time steps in batched SmartKineticsSolver::solve, but got ", states.size(), " and ", dts.size(), " respectively.");
+        Vec<EquilibriumConditions> kconds;
+        kconds.reserve(states.size());
+        for(auto i = 0; i < states.size(); ++i)
+        {
+            updateEquilibriumConditionsForKinetics(states[i], dts[i]);
+            kconds.push_back(kconditions);
+        }
+        return solveBatch(states, kconds);
+    }
+
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartKineticsResult>
+    {
+        errorif(states.size() != dts.size(), "Expecting the same number of ChemicalState objects and time steps in batched SmartKineticsSolver::solve, but got ", states.size(), " and ", dts.size(), " respectively.");
+        errorif(states.size() != conditions.size(), "Expecting the same number of ChemicalState and EquilibriumConditions objects in batched SmartKineticsSolver::solve, but got ", states.size(), " and ", conditions.size(), " respectively.");
+        Vec<EquilibriumConditions> kconds;
+        kconds.reserve(states.size());
+        for(auto i = 0; i < states.size(); ++i)
+        {
+            updateEquilibriumConditionsForKinetics(states[i], dts[i], conditions[i]);
+            kconds.push_back(kconditions);
+        }
+        return solveBatch(states, kconds);
+    }
+
+    /// React a batch of chemical states with given equilibrium conditions for kinetics (one per chemical state).
+    auto solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& kconds) -> Vec<SmartKineticsResult>
+    {
+        const auto eresults = ksolver.solve(states, kconds);
+        return Vec<SmartKineticsResult>(eresults.begin(), eresults.end());
+    }
 };
 
 SmartKineticsSolver::SmartKineticsSolver(ChemicalSystem const& system)
@@ -224,9 +269,39 @@ auto SmartKineticsSolver::solve(ChemicalState& state, KineticsSensitivity& sensi
     return pimpl->solve(state, sensitivity, dt, conditions, restrictions);
 }
 
+auto SmartKineticsSolver::solve(Vec<ChemicalState>& states, real const& dt) -> Vec<SmartKineticsResult>
+{
+    return pimpl->solve(states, dt);
+}
+
+auto SmartKineticsSolver::solve(Vec<ChemicalState>& states, Vec<real> const& dts) -> Vec<SmartKineticsResult>
+{
+    return pimpl->solve(states, dts);
+}
+
+auto SmartKineticsSolver::solve(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartKineticsResult>
+{
+    return pimpl->solve(states, dts, conditions);
+}
+
 auto SmartKineticsSolver::setOptions(SmartKineticsOptions const& options) -> void
 {
     pimpl->setOptions(options);
 }
 
+auto SmartKineticsSolver::saveLearningData(String const& filename) const -> void
+{
+    pimpl->ksolver.saveLearningData(filename);
+}
+
+auto SmartKineticsSolver::loadLearningData(String const& filename) -> void
+{
+    pimpl->ksolver.loadLearningData(filename);
+}
+
+auto SmartKineticsSolver::shareLearningData(SmartKineticsSolver const& other) -> void
+{
+    pimpl->ksolver.shareLearningData(other.pimpl->ksolver);
+}
+
 } // namespace Reaktoro
@@ -117,6 +117,36 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartKineticsResult;
 
+    //=================================================================================================================
+    //
+    // BATCHED CHEMICAL KINETICS METHODS
+    //
+    //=================================================================================================================
+
+    /// React a batch of chemical states for a given time interval.
+    /// The calculations are performed with the batched method
+    /// SmartEquilibriumSolver::solve(Vec<ChemicalState>&, Vec<EquilibriumConditions> const&),
+    /// so that the states are first predicted in parallel with the learned
+    /// records (with the packed acceptance tests and compact records of the
+    /// options, if enabled), and only those not accepted are learned by the
+    /// pool of worker threads (see EquilibriumOptions::threads in
+    /// SmartEquilibriumOptions::learning).
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed reacted states (out)
+    /// @param dt The time step in the kinetics calculation of every state (in s).
+    /// @return The result of the kinetics calculation of each state
+    auto solve(Vec<ChemicalState>& states, real const& dt) -> Vec<SmartKineticsResult>;
+
+    /// React a batch of chemical states, each for its own time interval.
+    /// \copydetails SmartKineticsSolver::solve(Vec<ChemicalState>&, real const&)
+    /// @param dts The time step in the kinetics calculation of each state (in s).
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts) -> Vec<SmartKineticsResult>;
+
+    /// React a batch of chemical states, each for its own time interval and respecting its own constraint conditions.
+    /// \copydetails SmartKineticsSolver::solve(Vec<ChemicalState>&, real const&)
+    /// @param dts The time step in the kinetics calculation of each state (in s).
+    /// @param conditions The specified constraint conditions to be attained during chemical kinetics for each state
+    auto solve(Vec<ChemicalState>& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartKineticsResult>;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -126,6 +156,31 @@ public:
     /// Set the options of the kinetics solver.
     auto setOptions(SmartKineticsOptions const& options) -> void;
 
+    /// Save the learned input-output data of this SmartKineticsSolver object in a binary file.
+    /// The learned kinetics calculations are stored in the same format used
+    /// by SmartEquilibriumSolver::saveLearningData, with the time step as one
+    /// of the input variables *w* of each record.
+    /// @param filename The path of the file.
+    auto saveLearningData(String const& filename) const -> void;
+
+    /// Load the learned input-output data of a SmartKineticsSolver object from a binary file.
+    /// The learned data currently stored in this solver (and in those sharing
+    /// it, see @ref shareLearningData) is replaced. The file must have been
+    /// produced with @ref saveLearningData by a SmartKineticsSolver object
+    /// constructed with the same chemical system and specifications.
+    /// @param filename The path of the file.
+    auto loadLearningData(String const& filename) -> void;
+
+    /// Share the learned input-output data of another SmartKineticsSolver object with this one.
+    /// After this call, both solvers store and search their learned kinetics
+    /// calculations in the same knowledge database, and they can be used
+    /// concurrently in different threads (see
+    /// SmartEquilibriumSolver::shareLearningData). The learned data previously
+    /// stored in this solver is discarded. Both solvers must have been
+    /// constructed with the same chemical system and specifications.
+    /// @note Copies of a SmartKineticsSolver object do not share their learned data.
+    auto shareLearningData(SmartKineticsSolver const& other) -> void;
+
 private:
     struct Impl;
 
@@ -29,6 +29,20 @@
 #include <Reaktoro/Kinetics/SmartKineticsSolver.hpp>
 using namespace Reaktoro;
 
+// React copies of the given chemical states in a batch and assign the results back to them.
+// The states are received as pointers so that Python sees the updated ChemicalState objects.
+auto solveBatch(SmartKineticsSolver& solver, std::vector<ChemicalState*> const& states, Vec<real> const& dts, Vec<EquilibriumConditions> const* conditions) -> Vec<SmartKineticsResult>
+{
+    Vec<ChemicalState> copies;
+    copies.reserve(states.size());
+    for(auto const* state : states)
+        copies.push_back(*state);
+    auto results = conditions ? solver.solve(copies, dts, *conditions) : solver.solve(copies, dts);
+    for(auto i = 0; i < states.size(); ++i)
+        states[i]->assign(copies[i]);
+    return results;
+}
+
 void exportSmartKineticsSolver(py::module& m)
 {
     py::class_<SmartKineticsSolver>(m, "SmartKineticsSolver")
@@ -45,6 +59,13 @@ void exportSmartKineticsSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&>(&SmartKineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"))
         .def("solve", py::overload_cast<ChemicalState&, KineticsSensitivity&, real const&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartKineticsSolver::solve), "React a chemical state for a given time interval respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("dt"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("solve", [](SmartKineticsSolver& self, std::vector<ChemicalState*> const& states, real const& dt) { return solveBatch(self, states, Vec<real>(states.size(), dt), nullptr); }, py::call_guard<py::gil_scoped_release>(), "React a batch of chemical states for a given time interval.", py::arg("states"), py::arg("dt"))
+        .def("solve", [](SmartKineticsSolver& self, std::vector<ChemicalState*> const& states, Vec<real> const& dts) { return solveBatch(self, states, dts, nullptr); }, py::call_guard<py::gil_scoped_release>(), "React a batch of chemical states, each for its own time interval.", py::arg("states"), py::arg("dts"))
+        .def("solve", [](SmartKineticsSolver& self, std::vector<ChemicalState*> const& states, Vec<real> const& dts, Vec<EquilibriumConditions> const& conditions) { return solveBatch(self, states, dts, &conditions); }, py::call_guard<py::gil_scoped_release>(), "React a batch of chemical states, each for its own time interval and respecting its own constraint conditions.", py::arg("states"), py::arg("dts"), py::arg("conditions"))
+
         .def("setOptions", &SmartKineticsSolver::setOptions)
+        .def("saveLearningData", &SmartKineticsSolver::saveLearningData)
+        .def("loadLearningData", &SmartKineticsSolver::loadLearningData)
+        .def("shareLearningData", &SmartKineticsSolver::shareLearningData)
         ;
 }
@@ -16,6 +16,7 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cstdio>
 #include <iostream>
 
 // Catch includes
@@ -128,4 +129,129 @@ TEST_CASE("Testing SmartKineticsSolver", "[SmartKineticsSolver]")
         CHECK( result.learned() );
         CHECK( result.iterations() == 16 );
     }
+
+    WHEN("learned data is shared among solvers and saved to and loaded from a file")
+    {
+        Params params = Params::embedded("PalandriKharaka.yaml");
+
+        SupcrtDatabase db("supcrtbl");
+
+        ChemicalSystem system(db,
+            AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)").setActivityModel(ActivityModelDavies()),
+            MineralPhase("Calcite"),
+            GeneralReaction("Calcite").setRateModel(ReactionRateModelPalandriKharaka(params)),
+            Surface("Calcite").withAreaModel([](ChemicalProps const&) { return 1.0; })
+        );
+
+        SmartKineticsSolver solver1(system);
+        SmartKineticsSolver solver2(system);
+
+        solver2.shareLearningData(solver1);
+
+        SmartKineticsSolver solver3(solver1); // a copy does not share the learned data
+
+        SmartKineticsResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver1.solve(state, 0.1);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        auto perturbed = [&]()
+        {
+            ChemicalState s(system);
+            s.temperature(30.0, "celsius");
+            s.pressure(2.0, "bar");
+            s.set("H2O(aq)", 1.1, "kg");
+            s.set("Calcite", 1.1, "mol");
+            return s;
+        };
+
+        state = perturbed();
+
+        result = solver2.solve(state, 0.12); // prediction with the data learned by solver1
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        ChemicalState state1 = state;
+
+        const auto filename = "SmartKineticsSolver.test.dat";
+
+        solver1.saveLearningData(filename);
+        solver3.loadLearningData(filename);
+
+        std::remove(filename);
+
+        state = perturbed();
+
+        result = solver3.solve(state, 0.12); // prediction with the data loaded from file
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+
+        CHECK( state.speciesAmounts().isApprox(state1.speciesAmounts()) );
+
+        CHECK_THROWS( solver3.loadLearningData("SmartKineticsSolver.test.missing.dat") );
+    }
+
+    WHEN("a batch of chemical states is reacted")
+    {
+        Params params = Params::embedded("PalandriKharaka.yaml");
+
+        SupcrtDatabase db("supcrtbl");
+
+        ChemicalSystem system(db,
+            AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)").setActivityModel(ActivityModelDavies()),
+            MineralPhase("Calcite"),
+            GeneralReaction("Calcite").setRateModel(ReactionRateModelPalandriKharaka(params)),
+            Surface("Calcite").withAreaModel([](ChemicalProps const&) { return 1.0; })
+        );
+
+        SmartKineticsOptions options;
+        options.learning.threads = 1; // the learning operations are then performed in the order of the chemical states
+        options.packed_acceptance_test = true;
+        options.compact_records = true;
+
+        SmartKineticsSolver solver(system);
+        solver.setOptions(options);
+
+        Vec<ChemicalState> states(3, ChemicalState(system));
+        Vec<real> dts(3);
+        for(auto k = 0; k < 3; ++k)
+        {
+            states[k].temperature(25.0 + 0.1*k, "celsius");
+            states[k].pressure(1.0, "bar");
+            states[k].set("H2O(aq)", 1.0 + 0.002*k, "kg");
+            states[k].set("Calcite", 1.0, "mol");
+            dts[k] = 0.1 + 0.001*k;
+        }
+
+        Vec<ChemicalState> expected = states;
+        SmartKineticsSolver reference(system);
+        for(auto k = 0; k < 3; ++k)
+            reference.solve(expected[k], dts[k]);
+
+        const auto results = solver.solve(states, dts);
+
+        // The first chemical state is learned and the others are predicted with its record
+        CHECK( results[0].learned() );
+        CHECK( results[1].predicted() );
+        CHECK( results[2].predicted() );
+
+        for(auto k = 0; k < 3; ++k)
+        {
+            CHECK( results[k].succeeded() );
+            CHECK( states[k].speciesAmount("Calcite") == Approx(expected[k].speciesAmount("Calcite")) );
+        }
+
+        Vec<real> fewer(2, 0.1);
+        CHECK_THROWS( solver.solve(states, fewer) );
+    }
 }
@@ -47,6 +47,34 @@ auto binarySearch(double p, const Vec<double>& coordinates) -> Index
     return binarySearchHelper(p, coordinates, 0, coordinates.size());
 }
 
+/// Return true if the given coordinates are evenly spaced.
+auto isUniform(const Vec<double>& coordinates) -> bool
+{
+    const auto size = coordinates.size();
+    if(size < 3)
+        return true;
+    const auto first = coordinates.front();
+    const auto step = (coordinates.back() - first)/(size - 1);
+    const auto tolerance = 1e-12 * std::abs(coordinates.back() - first);
+    for(Index i = 1; i < size - 1; ++i)
+        if(std::abs(coordinates[i] - (first + i*step)) > tolerance)
+            return false;
+    return true;
+}
+
+/// Return the index of the lower coordinate of the interval containing @p p, which is assumed within the coordinates range.
+/// The index is computed in constant time when the coordinates are evenly spaced and with a binary search otherwise.
+auto lowerIndex(double p, const Vec<double>& coordinates, bool uniform) -> Index
+{
+    const auto size = coordinates.size();
+    if(size == 1)
+        return 0;
+    const auto index = uniform ?
+        static_cast<Index>((p - coordinates.front())/(coordinates.back() - coordinates.front()) * (size - 1)) :
+        binarySearch(p, coordinates);
+    return std::min<Index>(index, size - 2);
+}
+
 auto linearize(const Vec<Vec<double>>& data) -> Vec<double>
 {
     if(data.empty())
@@ -69,7 +97,9 @@ BilinearInterpolator::BilinearInterpolator(
     const Vec<double>& data)
 : m_xcoordinates(xcoordinates),
   m_ycoordinates(ycoordinates),
-  m_data(data)
+  m_data(data),
+  m_xuniform(isUniform(xcoordinates)),
+  m_yuniform(isUniform(ycoordinates))
 {}
 
 BilinearInterpolator::BilinearInterpolator(
@@ -78,7 +108,9 @@ BilinearInterpolator::BilinearInterpolator(
     const Vec<Vec<double>>& data)
 : m_xcoordinates(xcoordinates),
   m_ycoordinates(ycoordinates),
-  m_data(linearize(data))
+  m_data(linearize(data)),
+  m_xuniform(isUniform(xcoordinates)),
+  m_yuniform(isUniform(ycoordinates))
 {}
 
 BilinearInterpolator::BilinearInterpolator(
@@ -87,7 +119,9 @@ BilinearInterpolator::BilinearInterpolator(
     const std::function<double(double, double)>& function)
 : m_xcoordinates(xcoordinates),
   m_ycoordinates(ycoordinates),
-  m_data(xcoordinates.size() * ycoordinates.size())
+  m_data(xcoordinates.size() * ycoordinates.size()),
+  m_xuniform(isUniform(xcoordinates)),
+  m_yuniform(isUniform(ycoordinates))
 {
     unsigned k = 0;
     for(unsigned j = 0; j < ycoordinates.size(); ++j)
@@ -98,11 +132,13 @@ BilinearInterpolator::BilinearInterpolator(
 auto BilinearInterpolator::setCoordinatesX(const Vec<double>& xcoordinates) -> void
 {
     m_xcoordinates = xcoordinates;
+    m_xuniform = isUniform(xcoordinates);
 }
 
 auto BilinearInterpolator::setCoordinatesY(const Vec<double>& ycoordinates) -> void
 {
     m_ycoordinates = ycoordinates;
+    m_yuniform = isUniform(ycoordinates);
 }
 
 auto BilinearInterpolator::setData(const Vec<double>& data) -> void
@@ -135,10 +171,12 @@ auto BilinearInterpolator::empty() const -> bool
     return m_data.empty();
 }
 
-auto BilinearInterpolator::operator()(real x, real y) const -> real
+auto BilinearInterpolator::cell(real x, real y) const -> Cell
 {
+    Cell res;
+
     // Check if the interpolation data contains only one point
-    if(m_data.size() == 1) return m_data[0];
+    if(m_data.size() == 1) return res;
 
     const auto xA = m_xcoordinates.front();
     const auto xB = m_xcoordinates.back();
@@ -156,63 +194,52 @@ auto BilinearInterpolator::operator()(real x, real y) const -> real
     const auto size_x = m_xcoordinates.size();
     const auto size_y = m_ycoordinates.size();
 
-    const auto index_x = binarySearch(x, m_xcoordinates);
-    const auto index_y = binarySearch(y, m_ycoordinates);
-
-    const auto i1 = (size_x == 1) ? 0 : (index_x == size_x - 1) ? index_x - 1 : index_x;
+    const auto i1 = lowerIndex(x.val(), m_xcoordinates, m_xuniform);
     const auto i2 = (size_x == 1) ? 0 : i1 + 1;
 
-    const auto j1 = (size_y == 1) ? 0 : (index_y == size_y - 1) ? index_y - 1 : index_y;
+    const auto j1 = lowerIndex(y.val(), m_ycoordinates, m_yuniform);
     const auto j2 = (size_y == 1) ? 0 : j1 + 1;
 
-    const auto k = [=](Index i, Index j) { return i + j*size_x; };
-
     const auto x1 = m_xcoordinates[i1];
     const auto x2 = m_xcoordinates[i2];
 
     const auto y1 = m_ycoordinates[j1];
     const auto y2 = m_ycoordinates[j2];
 
-    if(x1 != x2 && y1 != y2)
-    {
-        const auto z11 = m_data[k(i1, j1)]; // z at (x1, y1)
-        const auto z21 = m_data[k(i2, j1)]; // z at (x2, y1)
-        const auto z12 = m_data[k(i1, j2)]; // z at (x1, y2)
-        const auto z22 = m_data[k(i2, j2)]; // z at (x2, y2)
+    // The relative position of (x, y) in the cell, which is zero along a degenerate direction
+    const real ax = (x1 != x2) ? real((x - x1)/(x2 - x1)) : real(0.0);
+    const real ay = (y1 != y2) ? real((y - y1)/(y2 - y1)) : real(0.0);
 
-        const auto f11 =  z11*(x2 - x)*(y2 - y);
-        const auto f12 = -z12*(x2 - x)*(y1 - y);
-        const auto f21 = -z21*(x1 - x)*(y2 - y);
-        const auto f22 =  z22*(x1 - x)*(y1 - y);
+    res.k11 = i1 + j1*size_x;
+    res.k21 = i2 + j1*size_x;
+    res.k12 = i1 + j2*size_x;
+    res.k22 = i2 + j2*size_x;
 
-        return (f11 + f12 + f21 + f22)/((x2 - x1)*(y2 - y1));
-    }
-
-    if(x1 == x2 && y1 != y2)
-    {
-        const auto z11 = m_data[k(i1, j1)]; // z at (x1, y1)
-        const auto z12 = m_data[k(i1, j2)]; // z at (x1, y2)
+    res.w11 = (1.0 - ax)*(1.0 - ay);
+    res.w21 = ax*(1.0 - ay);
+    res.w12 = (1.0 - ax)*ay;
+    res.w22 = ax*ay;
 
-        const auto f11 =  z11*(y2 - y);
-        const auto f12 = -z12*(y1 - y);
-
-        return (f11 + f12)/(y2 - y1);
-    }
-
-    if(x1 != x2 && y1 == y2)
-    {
-        const auto z11 = m_data[k(i1, j1)]; // z at (x1, y1)
-        const auto z21 = m_data[k(i2, j1)]; // z at (x2, y1)
-
-        const auto f11 =  z11*(x2 - x);
-        const auto f21 = -z21*(x1 - x);
+    return res;
+}
 
-        return (f11 + f21)/(x2 - x1);
-    }
+auto BilinearInterpolator::operator()(const Cell& cell) const -> real
+{
+    return cell.w11*m_data[cell.k11] + cell.w21*m_data[cell.k21] + cell.w12*m_data[cell.k12] + cell.w22*m_data[cell.k22];
+}
 
-    assert(m_data.size() == 1);
+auto BilinearInterpolator::operator()(real x, real y) const -> real
+{
+    return (*this)(cell(x, y));
+}
 
-    return m_data[0];
+auto BilinearInterpolator::operator()(ArrayXrConstRef x, ArrayXrConstRef y) const -> ArrayXr
+{
+    assert(x.size() == y.size());
+    ArrayXr res(x.size());
+    for(auto i = 0; i < x.size(); ++i)
+        res[i] = (*this)(cell(x[i], y[i]));
+    return res;
 }
 
 auto operator<<(std::ostream& out, const BilinearInterpolator& interpolator) -> std::ostream&
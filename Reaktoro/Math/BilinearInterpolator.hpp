@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
 
 namespace Reaktoro {
@@ -26,6 +27,14 @@ namespace Reaktoro {
 class BilinearInterpolator
 {
 public:
+    /// The interpolation cell containing a point, given by the indices of its corners in the data and their interpolation weights.
+    /// A cell depends only on the coordinates, so it can be shared among interpolators with the same coordinates but different data.
+    struct Cell
+    {
+        Index k11 = 0, k21 = 0, k12 = 0, k22 = 0;
+        real w11 = 1.0, w21 = 0.0, w12 = 0.0, w22 = 0.0;
+    };
+
     /// Construct a default BilinearInterpolator instance
     BilinearInterpolator();
 
@@ -86,12 +95,28 @@ public:
     /// @return The interpolation of the data at (x, y) point
     auto operator()(real x, real y) const -> real;
 
+    /// Calculate the interpolation at the provided (x, y) points.
+    /// @param x The x-coordinates of the points
+    /// @param y The y-coordinates of the points
+    /// @return The interpolation of the data at every (x, y) point
+    auto operator()(ArrayXrConstRef x, ArrayXrConstRef y) const -> ArrayXr;
+
+    /// Return the interpolation cell containing the provided (x, y) point.
+    /// The cell index is computed in constant time along coordinates that are evenly spaced.
+    auto cell(real x, real y) const -> Cell;
+
+    /// Calculate the interpolation on a cell computed with this or another interpolator with the same coordinates.
+    auto operator()(const Cell& cell) const -> real;
+
 private:
     /// The coordinates of the x and y points
     Vec<double> m_xcoordinates, m_ycoordinates;
 
     /// The interpolated data on every (x, y) point
     Vec<double> m_data;
+
+    /// The flags indicating whether the x and y coordinates are evenly spaced
+    bool m_xuniform = false, m_yuniform = false;
 };
 
 /// Output a BilinearInterpolator instance
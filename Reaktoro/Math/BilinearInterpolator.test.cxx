@@ -59,3 +59,43 @@ TEST_CASE("Testing BilinearInterpolator", "[BilinearInterpolator]")
         CHECK( f(xi, yj) == Approx(1 + 3*xi + 5*yj + 7*xi*yj) );
     }
 }
+
+TEST_CASE("Testing BilinearInterpolator with cells and batches of points", "[BilinearInterpolator]")
+{
+    const Vec<double> x = { 0.0, 1.0, 2.0, 3.0 };     // evenly spaced coordinates
+    const Vec<double> y = { 0.0, 1.0, 4.0, 9.0, 16.0 }; // unevenly spaced coordinates
+
+    const auto nx = x.size();
+    const auto ny = y.size();
+
+    Vec<double> z1(nx * ny);
+    Vec<double> z2(nx * ny);
+
+    for(auto i = 0; i < nx; ++i) for(auto j = 0; j < ny; ++j)
+    {
+        z1[i + nx*j] = 1 + 3*x[i] + 5*y[j] + 7*x[i]*y[j];
+        z2[i + nx*j] = 2 - 4*x[i] + 6*y[j] - 8*x[i]*y[j];
+    }
+
+    BilinearInterpolator f1(x, y, z1);
+    BilinearInterpolator f2(x, y, z2);
+
+    ArrayXr xs(4), ys(4);
+    xs << 0.0, 0.5, 2.25, 3.0;
+    ys << 0.0, 2.5, 10.0, 16.0;
+
+    const ArrayXr zs = f1(xs, ys);
+
+    for(auto k = 0; k < xs.size(); ++k)
+    {
+        const auto xk = xs[k];
+        const auto yk = ys[k];
+
+        CHECK( zs[k] == Approx(1 + 3*xk + 5*yk + 7*xk*yk) );
+
+        const auto cell = f1.cell(xk, yk);
+
+        CHECK( f1(cell) == Approx(1 + 3*xk + 5*yk + 7*xk*yk) );
+        CHECK( f2(cell) == Approx(2 - 4*xk + 6*yk - 8*xk*yk) );
+    }
+}
@@ -47,7 +47,7 @@ LU::LU(MatrixXdConstRef A, VectorXdConstRef W)
 
 auto LU::empty() const -> bool
 {
-    return L.size();
+    return L.size() == 0;
 }
 
 auto LU::compute(MatrixXdConstRef A) -> void
@@ -114,9 +114,26 @@ auto LU::compute(MatrixXdConstRef A, VectorXdConstRef W) -> void
 
 auto LU::solve(MatrixXdConstRef B) -> MatrixXd
 {
-    const Index n = U.cols();
+    MatrixXd X(U.cols(), B.cols());
+    solve(B, X);
+    return X;
+}
+
+auto LU::trsolve(MatrixXdConstRef B) -> MatrixXd
+{
+    MatrixXd X(L.rows(), B.cols());
+    trsolve(B, X);
+    return X;
+}
+
+auto LU::solve(MatrixXdConstRef B, MatrixXdRef X) const -> void
+{
     const Index k = B.cols();
-    MatrixXd X = zeros(n, k);
+
+    assert(X.rows() == U.cols());
+    assert(X.cols() == k);
+
+    X.fill(0.0);
 
     auto solve_column = [&](Index icol)
     {
@@ -129,15 +146,16 @@ auto LU::solve(MatrixXdConstRef B) -> MatrixXd
 
     for(Index i = 0; i < k; ++i)
         solve_column(i);
-
-    return X;
 }
 
-auto LU::trsolve(MatrixXdConstRef B) -> MatrixXd
+auto LU::trsolve(MatrixXdConstRef B, MatrixXdRef X) const -> void
 {
-    const Index m = L.rows();
     const Index k = B.cols();
-    MatrixXd X = zeros(m, k);
+
+    assert(X.rows() == L.rows());
+    assert(X.cols() == k);
+
+    X.fill(0.0);
 
     auto trsolve_column = [&](Index icol)
     {
@@ -152,8 +170,111 @@ auto LU::trsolve(MatrixXdConstRef B) -> MatrixXd
 
     for(Index i = 0; i < k; ++i)
         trsolve_column(i);
+}
 
-    return X;
+auto LU::addColumn(VectorXdConstRef a, double w) -> void
+{
+    const Index m = A_last.rows();
+    const Index n = A_last.cols();
+    const bool weighted = W_last.size();
+
+    assert(a.rows() == m);
+
+    // The extended matrix A and weights W after the column has been appended
+    MatrixXd Anew(m, n + 1);
+    Anew << A_last, a;
+
+    VectorXd Wnew;
+    if(weighted)
+    {
+        Wnew.resize(n + 1);
+        Wnew << W_last, w;
+    }
+
+    // Recompute the decomposition if there is none yet or if U has no room for the new column
+    if(empty() || U.rows() != std::min(m, n + 1))
+    {
+        A_last.resize(0, 0); // ensure the decomposition is not skipped in compute
+        weighted ? compute(Anew, Wnew) : compute(Anew);
+        return;
+    }
+
+    // Compute the new column u of U in P*[A a]*[Q 0; 0 1] = L*[U u] using the existing pivots
+    const VectorXd Pa = P * a;
+    VectorXd u = zeros(U.rows());
+    u.head(rank) = L.topLeftCorner(rank, rank).triangularView<Eigen::Lower>().solve(Pa.head(rank));
+
+    // Recompute the decomposition if the new column is not in the range of the current pivot columns (i.e., it increases the rank)
+    const double residual = (L.leftCols(rank) * u.head(rank) - Pa).norm();
+    const double scale = std::max(1.0, a.norm());
+    if(residual > 1e-12 * scale)
+    {
+        A_last.resize(0, 0); // ensure the decomposition is not skipped in compute
+        weighted ? compute(Anew, Wnew) : compute(Anew);
+        return;
+    }
+
+    // Append the new column to U and extend Q with the identity at the new position
+    U.conservativeResize(Eigen::NoChange, n + 1);
+    U.col(n) = u;
+
+    Eigen::VectorXi indices(n + 1);
+    indices << Q.indices(), static_cast<int>(n);
+    Q = PermutationMatrix(indices);
+
+    A_last = std::move(Anew);
+    W_last = std::move(Wnew);
+}
+
+auto LU::removeColumn(Index j) -> void
+{
+    const Index m = A_last.rows();
+    const Index n = A_last.cols();
+    const bool weighted = W_last.size();
+
+    assert(j < n);
+
+    // The reduced matrix A and weights W after the column has been removed
+    MatrixXd Anew(m, n - 1);
+    Anew << A_last.leftCols(j), A_last.rightCols(n - j - 1);
+
+    VectorXd Wnew;
+    if(weighted)
+    {
+        Wnew.resize(n - 1);
+        Wnew << W_last.head(j), W_last.tail(n - j - 1);
+    }
+
+    // The position k of the removed column in the column-permuted matrix A*Q
+    const auto& indices = Q.indices();
+    Index k = 0;
+    while(indices[k] != static_cast<int>(j))
+        ++k;
+
+    // Recompute the decomposition if the removed column is a pivot column or if U would have too many rows
+    if(k < rank || U.rows() != std::min(m, n - 1))
+    {
+        A_last.resize(0, 0); // ensure the decomposition is not skipped in compute
+        weighted ? compute(Anew, Wnew) : compute(Anew);
+        return;
+    }
+
+    // Remove the k-th column of U, which keeps the leading rank-by-rank block of U upper triangular
+    MatrixXd Unew(U.rows(), n - 1);
+    Unew << U.leftCols(k), U.rightCols(n - k - 1);
+    U = std::move(Unew);
+
+    // Remove the k-th entry in Q and shift the column indices after j
+    Eigen::VectorXi indicesnew(n - 1);
+    for(Index i = 0, inew = 0; i < n; ++i)
+    {
+        if(i == k) continue;
+        indicesnew[inew++] = indices[i] > static_cast<int>(j) ? indices[i] - 1 : indices[i];
+    }
+    Q = PermutationMatrix(indicesnew);
+
+    A_last = std::move(Anew);
+    W_last = std::move(Wnew);
 }
 
 } // namespace Reaktoro
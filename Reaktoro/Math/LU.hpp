@@ -50,6 +50,28 @@ struct LU
     /// Solve the linear system `tr(A)X = B` using the calculated LU decomposition.
     auto trsolve(MatrixXdConstRef B) -> MatrixXd;
 
+    /// Solve the linear system `AX = B` using the calculated LU decomposition into the given buffer `X`.
+    /// @param B The right-hand side matrix with as many rows as `A`.
+    /// @param[out] X The solution matrix with as many rows as columns in `A` and as many columns as `B`.
+    auto solve(MatrixXdConstRef B, MatrixXdRef X) const -> void;
+
+    /// Solve the linear system `tr(A)X = B` using the calculated LU decomposition into the given buffer `X`.
+    /// @param B The right-hand side matrix with as many rows as columns in `A`.
+    /// @param[out] X The solution matrix with as many rows as `A` and as many columns as `B`.
+    auto trsolve(MatrixXdConstRef B, MatrixXdRef X) const -> void;
+
+    /// Update the LU decomposition after appending a column to the last decomposed matrix.
+    /// The new column is factorized against the existing pivots in O(rank²) operations. The
+    /// decomposition is recomputed from scratch only if the new column increases the rank.
+    /// @param a The new column of matrix `A` (e.g., the formula vector of a new species).
+    /// @param w The scaling weight of the new column (used only if the decomposition is weighted).
+    auto addColumn(VectorXdConstRef a, double w = 1.0) -> void;
+
+    /// Update the LU decomposition after removing a column from the last decomposed matrix.
+    /// The decomposition is only recomputed if the removed column is one of the pivot columns.
+    /// @param j The index of the column to be removed from matrix `A`.
+    auto removeColumn(Index j) -> void;
+
     /// The last decomposed matrix A
     MatrixXd A_last;
 
@@ -0,0 +1,139 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Math/LU.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing LU class", "[LU]")
+{
+    // A formula-like matrix with a linearly dependent row (row 3 = row 1 + row 2)
+    MatrixXd A(4, 6);
+    A << 2, 0, 1, 1, 0, 3,
+         1, 1, 0, 2, 1, 0,
+         3, 1, 1, 3, 1, 3,
+         0, 1,-1, 0,-1, 1;
+
+    const VectorXd x = VectorXd::LinSpaced(6, 1.0, 2.0);
+    const VectorXd b = A * x;
+
+    auto checkSolve = [](LU const& lu, MatrixXdConstRef A, VectorXdConstRef b)
+    {
+        VectorXd X(A.cols());
+        lu.solve(b, X);
+        CHECK( (A*X).isApprox(b) );
+
+        const VectorXd y = VectorXd::LinSpaced(A.rows(), 1.0, 3.0);
+        const VectorXd z = tr(A) * y;
+        VectorXd Y(A.rows());
+        lu.trsolve(z, Y);
+        CHECK( (tr(A)*Y).isApprox(z) );
+    };
+
+    SECTION("Solving into caller buffers")
+    {
+        LU lu(A);
+
+        CHECK_FALSE( lu.empty() );
+        CHECK( lu.rank == 3 );
+
+        checkSolve(lu, A, b);
+
+        CHECK( lu.solve(b).isApprox(VectorXd([&] { VectorXd X(6); lu.solve(b, X); return X; }())) );
+    }
+
+    SECTION("Appending columns that keep the rank")
+    {
+        LU lu(A);
+
+        VectorXd a(4);
+        a << 1, 2, 3, 1;
+
+        lu.addColumn(a);
+
+        MatrixXd Anew(4, 7);
+        Anew << A, a;
+
+        CHECK( lu.A_last == Anew );
+        CHECK( lu.rank == 3 );
+        checkSolve(lu, Anew, Anew * VectorXd::Ones(7));
+    }
+
+    SECTION("Appending columns that increase the rank")
+    {
+        LU lu(A);
+
+        VectorXd a(4);
+        a << 0, 0, 1, 0; // breaks the dependency row 3 = row 1 + row 2
+
+        lu.addColumn(a);
+
+        MatrixXd Anew(4, 7);
+        Anew << A, a;
+
+        CHECK( lu.A_last == Anew );
+        CHECK( lu.rank == 4 );
+        checkSolve(lu, Anew, Anew * VectorXd::Ones(7));
+    }
+
+    SECTION("Removing every column one at a time")
+    {
+        for(Index j = 0; j < A.cols(); ++j)
+        {
+            LU lu(A);
+            lu.removeColumn(j);
+
+            MatrixXd Anew(4, 5);
+            Anew << A.leftCols(j), A.rightCols(A.cols() - j - 1);
+
+            CHECK( lu.A_last == Anew );
+            CHECK( lu.rank == 3 );
+            checkSolve(lu, Anew, Anew * VectorXd::Ones(5));
+        }
+    }
+
+    SECTION("Updating a weighted decomposition")
+    {
+        const VectorXd W = VectorXd::LinSpaced(6, 1.0, 10.0);
+
+        LU lu(A, W);
+        checkSolve(lu, A, b);
+
+        VectorXd a(4);
+        a << 1, 2, 3, 1;
+
+        lu.addColumn(a, 5.0);
+
+        MatrixXd Anew(4, 7);
+        Anew << A, a;
+
+        CHECK( lu.W_last.size() == 7 );
+        checkSolve(lu, Anew, Anew * VectorXd::Ones(7));
+
+        lu.removeColumn(2);
+
+        MatrixXd Anew2(4, 6);
+        Anew2 << Anew.leftCols(2), Anew.rightCols(4);
+
+        CHECK( lu.W_last.size() == 6 );
+        checkSolve(lu, Anew2, Anew2 * VectorXd::Ones(6));
+    }
+}
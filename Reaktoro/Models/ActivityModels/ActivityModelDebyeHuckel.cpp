@@ -302,30 +302,45 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
     // The index of the water species
     const auto iwater = mixture.indexWater();
 
-    // The electrical charges of the charged species only
-    const ArrayXd charges = mixture.charges()(icharged_species);
+    // The squares of the electrical charges of the charged species only
+    const ArrayXr z2 = mixture.charges()(icharged_species).square().cast<real>();
 
     // The Debye-Huckel parameters a and b of the charged species
-    Vec<real> aions, bions;
+    ArrayXr aions(num_charged_species), bions(num_charged_species);
 
     // The Debye-Huckel parameter b of the neutral species
-    Vec<real> bneutral;
+    ArrayXr bneutral(num_neutral_species);
+
+    // The indices of the charged species (among them only) with non-zero Debye-Huckel parameter a
+    Indices inonzero_aions;
 
     // Collect the Debye-Huckel parameters a and b of the charged species
-    for(Index i : icharged_species)
+    for(Index i = 0; i < num_charged_species; ++i)
     {
-        const auto species = mixture.species(i);
-        aions.push_back(params.aion(species.formula()));
-        bions.push_back(params.bion(species.formula()));
+        const auto species = mixture.species(icharged_species[i]);
+        aions[i] = params.aion(species.formula());
+        bions[i] = params.bion(species.formula());
+        if(aions[i] != 0.0)
+            inonzero_aions.push_back(i);
     }
 
     // Collect the Debye-Huckel parameter b of the neutral species
-    for(Index i : ineutral_species)
+    for(Index i = 0; i < num_neutral_species; ++i)
     {
-        const auto species = mixture.species(i);
-        bneutral.push_back(params.bneutral(species.formula()));
+        const auto species = mixture.species(ineutral_species[i]);
+        bneutral[i] = params.bneutral(species.formula());
     }
 
+    // The sum of the Debye-Huckel parameters b of the charged species divided by the squares of their charges
+    const real bions_z2_sum = (bions/z2).sum();
+
+    // The Debye-Huckel parameters A and B at the temperature and pressure of the last evaluation
+    real A, B, lastT = NaN, lastP = NaN;
+
+    // The auxiliary arrays with the Lambda and sigma parameters of the charged species
+    ArrayXr Lambda(num_charged_species);
+    ArrayXr sigma = ArrayXr::Constant(num_charged_species, 2.0);
+
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
     auto stateptr = std::make_shared<AqueousMixtureState>();
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
@@ -337,7 +352,8 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        mixture.updateState(*stateptr, T, P, x);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -350,76 +366,57 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         const auto& m = state.m;             // the molalities of all species
         const auto& ms = state.ms;           // the stoichiometric molalities of the charged species
         const auto& I = state.Is;            // the stoichiometric ionic strength
-        const auto& rho = state.rho/1000;    // the density of water (in g/cm3)
-        const auto& epsilon = state.epsilon; // the dielectric constant of water
 
         // Auxiliary references
         auto& ln_g = props.ln_g;
         auto& ln_a = props.ln_a;
 
+        // Update the Debye-Huckel parameters A and B only if temperature or pressure have changed since the last evaluation
+        if(!identical(T, lastT) || !identical(P, lastP))
+        {
+            const auto rho = state.rho/1000;    // the density of water (in g/cm3)
+            const auto epsilon = state.epsilon; // the dielectric constant of water
+            const auto sqrt_rho = sqrt(rho);
+            const auto T_epsilon = T * epsilon;
+            const auto sqrt_T_epsilon = sqrt(T_epsilon);
+            A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
+            B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
+            lastT = T;
+            lastP = P;
+        }
+
         // Auxiliary variables
-        const auto ln_m = m.log();
         const auto xw = x[iwater];
         const auto ln_xw = log(xw);
         const auto mSigma = nwo * (1 - xw)/xw;
         const auto I2 = I*I;
         const auto sqrtI = sqrt(I);
-        const auto sqrt_rho = sqrt(rho);
-        const auto T_epsilon = T * epsilon;
-        const auto sqrt_T_epsilon = sqrt(T_epsilon);
-        const auto A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
-        const auto B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
         const auto sigmacoeff = (2.0/3.0)*A*I*sqrtI;
 
-        // Set the first contribution to the activity of water
-        ln_a[iwater] = mSigma;
-
-        // Loop over all charged species in the aqueous mixture
-        for(Index i = 0; i < num_charged_species; ++i)
-        {
-            // The index of the current charged species
-            const auto ispecies = icharged_species[i];
+        // Update the Lambda parameters of the Debye-Huckel activity coefficient model
+        Lambda = 1.0 + aions*(B*sqrtI);
 
-            // The stoichiometric molality of the charged species
-            const auto msi = ms[i];
+        // Update the sigma parameters of the charged species (those with zero Debye-Huckel parameter a have constant sigma = 2)
+        for(auto i : inonzero_aions)
+            sigma[i] = 3.0*pow(Lambda[i] - 1, -3) * ((Lambda[i] - 1)*(Lambda[i] - 3) + 2*log(Lambda[i]));
 
-            // The electrical charge of the charged species
-            const auto z = charges[i];
+        // Calculate the ln activity coefficients of the charged species
+        ln_g(icharged_species) = ln10 * (-A*sqrtI*z2/Lambda + bions*I);
 
-            // Update the Lambda parameter of the Debye-Huckel activity coefficient model
-            const auto Lambda = 1.0 + aions[i]*B*sqrtI;
+        // Calculate the ln activity coefficients of the neutral species
+        ln_g(ineutral_species) = ln10 * I * bneutral;
 
-            // Update the sigma parameter of the current ion
-            const real sigma = (aions[i] != 0.0) ? 3.0*pow(Lambda - 1, -3) * ((Lambda - 1)*(Lambda - 3) + 2*log(Lambda)) : real(2.0);
+        // Calculate the ln activity of water (in mole fraction scale)
+        const real ln_aw = -1.0/nwo * (mSigma + (ms*ln_g(icharged_species)).sum() + ln10*(sigmacoeff*sigma.sum() - I2*bions_z2_sum));
 
-            // Calculate the ln activity coefficient of the current charged species
-            ln_g[ispecies] = ln10 * (-A*z*z*sqrtI/Lambda + bions[i]*I);
+        // Calculate the ln activities of the solutes
+        ln_a = ln_g + m.log();
 
-            // Calculate the ln activity of the current charged species
-            ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
-
-            // Calculate the contribution of current ion to the ln activity of water
-            ln_a[iwater] += msi*ln_g[ispecies] + sigmacoeff*sigma*ln10 - I2*bions[i]/(z*z)*ln10;
-        }
-
-        // Finalize the computation of the activity of water (in mole fraction scale)
-        ln_a[iwater] *= -1.0/nwo;
+        // Set the ln activity of water
+        ln_a[iwater] = ln_aw;
 
         // Set the activity coefficient of water (mole fraction scale)
-        ln_g[iwater] = ln_a[iwater] - ln_xw;
-
-        // Loop over all neutral species in the aqueous mixture
-        for(Index i = 0; i < num_neutral_species; ++i)
-        {
-            // The index of the current neutral species
-            const auto ispecies = ineutral_species[i];
-
-            // Calculate the ln activity coefficient of the current neutral species
-            ln_g[ispecies] = ln10 * bneutral[i] * I;
-
-            // Calculate the ln activity coefficient of the current neutral species
-            ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
-        }
+        ln_g[iwater] = ln_aw - ln_xw;
     };
 
     return fn;
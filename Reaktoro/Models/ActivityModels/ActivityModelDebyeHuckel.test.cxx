@@ -401,4 +401,29 @@ TEST_CASE("Testing ActivityModelDebyeHuckel", "[ActivityModelDebyeHuckel]")
 
         checkActivities(x, props);
     }
+
+    SECTION("Checking the activity coefficients when temperature changes between evaluations")
+    {
+        // Construct the activity props function with the given aqueous species.
+        ActivityModel fn = ActivityModelDebyeHuckel()(species);
+
+        // Create the ActivityProps objects with the results.
+        ActivityProps props = ActivityProps::create(species.size());
+        ActivityProps expected = ActivityProps::create(species.size());
+
+        // Evaluate the activity props function at two different temperatures and then back at the first
+        for(auto Ti : { T, 350.0, T })
+        {
+            fn(props, {Ti, P, x});
+
+            ActivityModelDebyeHuckel()(species)(expected, {Ti, P, x});
+
+            for(auto i = 0; i < x.size(); ++i)
+            {
+                INFO("i = " << i << ", T = " << Ti);
+                CHECK( props.ln_g[i] == Approx(expected.ln_g[i]) );
+                CHECK( props.ln_a[i] == Approx(expected.ln_a[i]) );
+            }
+        }
+    }
 }
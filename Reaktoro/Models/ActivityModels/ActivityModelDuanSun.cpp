@@ -18,6 +18,7 @@
 #include "ActivityModelDuanSun.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 
 namespace Reaktoro {
@@ -97,7 +98,10 @@ auto ActivityModelDuanSun(String gas) -> ActivityModelGenerator
         const auto iCl  = aqmix.charged().findWithFormula("Cl-");
         const auto iSO4 = aqmix.charged().findWithFormula("SO4--");
 
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        // The parameters lambda and zeta at the temperature and pressure of the last evaluation
+        real lambda, zeta, lastT = NaN, lastP = NaN;
+
+        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
         {
             // Check AqueousMixture and AqueousMixtureState are available in props.extra
             auto mixtureit = props.extra.find("AqueousMixture");
@@ -114,8 +118,14 @@ auto ActivityModelDuanSun(String gas) -> ActivityModelGenerator
             const auto& P  = state.P;
             const auto& ms = state.ms;
 
-            const auto lambda = paramDuanSun(T, P, lambda_coeffs);
-            const auto zeta   = paramDuanSun(T, P, zeta_coeffs);
+            // Update the parameters lambda and zeta only if temperature or pressure have changed since the last evaluation
+            if(!identical(T, lastT) || !identical(P, lastP))
+            {
+                lambda = paramDuanSun(T, P, lambda_coeffs);
+                zeta   = paramDuanSun(T, P, zeta_coeffs);
+                lastT = T;
+                lastP = P;
+            }
 
             const auto nions = mixture.charged().size();
 
@@ -31,9 +31,12 @@ namespace Reaktoro {
 
 auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityModelParamsExtendedUNIQUAC const& params) -> ActivityModel
 {
-    // Create the aqueous solution and its state object
+    // Create the aqueous solution
     AqueousMixture solution(species);
-    AqueousMixtureState aqstate;
+
+    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
+    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     // The electrical charges of the species
     const ArrayXd z = solution.charges();
@@ -146,6 +149,8 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
     ArrayXr xr;
     ArrayXr xq;
 
+    real lastT = NaN; // The temperature at which the matrix ψ and the residual activity coefficients at infinite dilution were last computed
+
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
@@ -156,7 +161,12 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         auto const RT = universalGasConstant*T;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = solution.state(T, P, x);
+        solution.updateState(*aqstateptr, T, P, x);
+        auto const& aqstate = *aqstateptr;
+
+        // Export the aqueous solution and its state via the `extra` data member
+        props.extra["AqueousMixtureState"] = aqstateptr;
+        props.extra["AqueousMixture"] = aqsolutionptr;
 
         // The ionic strength of the solution and its square root
         auto const& I = aqstate.Ie;
@@ -184,22 +194,32 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         phi = (xr * r) / sum(xr * r);
         theta = (xq * q) / sum(xq * q);
 
-        for(auto j = 0; j < iQ.size(); ++j)
-            for(auto i = j; i < iQ.size(); ++i)
-                u(j, i) = u(i, j) = u0(j, i) + uT(j, i)*(T - Tr);
+        // Update the matrix ψ and the residual activity coefficients at infinite dilution, which depend only on temperature, if it has changed since the last evaluation
+        if(!identical(T, lastT))
+        {
+            for(auto j = 0; j < iQ.size(); ++j)
+                for(auto i = j; i < iQ.size(); ++i)
+                    u(j, i) = u(i, j) = u0(j, i) + uT(j, i)*(T - Tr);
+
+            for(auto j = 0; j < iQ.size(); ++j)
+                for(auto i = 0; i < iQ.size(); ++i)
+                    psi(j, i) = exp(-(u(j, i) - u(i, i))/T);
 
-        for(auto j = 0; j < iQ.size(); ++j)
-            for(auto i = 0; i < iQ.size(); ++i)
-                psi(j, i) = exp(-(u(j, i) - u(i, i))/T);
+            // Calculate the UNIQUAC residual activity coefficients at infinite dilution -- Note: Thomsen (2005) always assume ψ(w,w) = 1, but here we don't necessarily; that's why psi(iqw, iqw) is used here.
+            ln_gRinf = 0.0;
+            for(auto const& [i, ispecies] : enumerate(iQ))
+                ln_gRinf[ispecies] = q[i]*(1 - log(psi(iqw, i)) - psi(i, iqw)/psi(iqw, iqw));
+
+            lastT = T;
+        }
 
         thetapsi = tr(psi) * theta.matrix();
 
-        // Reset the values of all activity coefficient contributions
+        // Reset the values of the composition-dependent activity coefficient contributions
         ln_gDH = 0.0;
         ln_gC = 0.0;
         ln_gR = 0.0;
         ln_gCinf = 0.0;
-        ln_gRinf = 0.0;
 
         // Calculate the Debye-Huckel activity coefficients for charged species -- see equation (8) of Thomsen (2005) or equation (4-12) of Thomsen (1997)
         ln_gDH(iDH) = -z2(iDH)*alpha;
@@ -221,11 +241,8 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         }
 
         // Calculate the UNIQUAC residual activity coefficients for the species -- see equation (16) of Thomsen (2005) and equation (13) of Hingerl et al. (2014)
-        for(auto const& [i, ispecies] : enumerate(iQ)) {
-            ln_gR[ispecies] = q[i]*(1 - log(thetapsi[i]) - (theta * ArrayXr(psi.row(i))/thetapsi).sum());
-            ln_gRinf[ispecies] = q[i]*(1 - log(psi(iqw, i)) - psi(i, iqw)/psi(iqw, iqw)); // Note: Thomsen (2005) always assume ψ(w,w) = 1, but here we don't necessarily; that's why psi(iqw, iqw) is used here.
-            GRTxUNIQUAC -= xq[i] * q[i] * log(thetapsi[i]);
-        }
+        ln_gR(iQ) = q*(1 - log(thetapsi) - (psi * (theta/thetapsi).matrix()).array());
+        GRTxUNIQUAC -= (xq * q * log(thetapsi)).sum();
 
         // Set the activity coefficients of the species in the unsymmetrical convention and molal scale -- see equation (4-14) of Thomsen (1997) -- note extra ln(xw) here to convert to molal scale
         props.ln_g = ln_gDH + (ln_gC - ln_gCinf) + (ln_gR - ln_gRinf) + ln_xw;
@@ -22,6 +22,7 @@
 #include <vector>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
@@ -310,12 +311,6 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
     // The index of the water species
     const auto iwater = mixture.indexWater();
 
-    // The effective electrostatic radii of the charged species
-    Vec<real> effective_radii;
-
-    // The electrical charges of the charged species only
-    Vec<double> charges;
-
     // The Born coefficient of the ion H+
     const auto omegaH = 0.5387e+05;
 
@@ -325,14 +320,40 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
     // The molar mass of water
     const auto Mw = mixture.water().molarMass();
 
-    // Collect the effective radii of the ions
-    for(Index idx_ion : icharged_species)
+    // The squares of the electrical charges of the charged species
+    ArrayXr z2(num_charged_species);
+
+    // The absolute and relative Born coefficients of the charged species
+    ArrayXr omega_abs(num_charged_species), omega(num_charged_species);
+
+    // The Debye-Huckel ion size parameters of the charged species as computed by Reed (1982) and also in TOUGHREACT
+    ArrayXr a(num_charged_species);
+
+    // The charge-dependent correction terms 0.19*(|z| - 1) of the charged species
+    ArrayXr zcorr(num_charged_species);
+
+    // Collect the per-ion coefficients of the charged species from their effective electrostatic radii and charges
+    for(Index i = 0; i < num_charged_species; ++i)
     {
-        const Species& species = mixture.species(idx_ion);
-        effective_radii.push_back(effectiveIonicRadius(species));
-        charges.push_back(species.charge());
+        const Species& species = mixture.species(icharged_species[i]);
+        const auto eff_radius = effectiveIonicRadius(species);
+        const auto z = species.charge();
+        z2[i] = z*z;
+        omega_abs[i] = eta*z*z/eff_radius;
+        omega[i] = omega_abs[i] - z*omegaH;
+        a[i] = (z < 0) ?
+            2.0*(eff_radius + 1.91*abs(z))/(abs(z) + 1.0) :
+            2.0*(eff_radius + 1.81*abs(z))/(abs(z) + 1.0);
+        zcorr[i] = 0.19*(abs(z) - 1.0);
     }
 
+    // The parameters A, B, bNaCl and bNa+Cl- of the HKF model at the temperature and pressure of the last evaluation
+    real A, B, bNaCl, bNapClm, lastT = NaN, lastP = NaN;
+
+    // The auxiliary arrays with the Lambda and sigma parameters of the charged species
+    ArrayXr lambda(num_charged_species);
+    ArrayXr sigma(num_charged_species);
+
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
     auto stateptr = std::make_shared<AqueousMixtureState>();
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
@@ -344,7 +365,8 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        mixture.updateState(*stateptr, T, P, x);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -371,81 +393,41 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         // The alpha parameter
         const auto alpha = xw/(1.0 - xw) * log10_xw;
 
-        // The parameters for the HKF model
-        const auto A = debyeHuckelParamA(T, P);
-        const auto B = debyeHuckelParamB(T, P);
-        const auto bNaCl = solventParamNaCl(T, P);
-        const auto bNapClm = shortRangeInteractionParamNaCl(T, P);
+        // Update the parameters of the HKF model only if temperature or pressure have changed since the last evaluation
+        if(!identical(T, lastT) || !identical(P, lastP))
+        {
+            A = debyeHuckelParamA(T, P);
+            B = debyeHuckelParamB(T, P);
+            bNaCl = solventParamNaCl(T, P);
+            bNapClm = shortRangeInteractionParamNaCl(T, P);
+            lastT = T;
+            lastP = P;
+        }
 
         // The osmotic coefficient of the aqueous phase
         real phi = {};
 
-        // Loop over all neutral species in the mixture
-        for(auto i = 0; i < num_neutral_species; ++i)
-        {
-            // The index of the current neutral species
-            const auto ispecies = ineutral_species[i];
-
-            // The b coefficient in lg(gammai) = b*I (0.1 as in PHREEQC)
-            const auto b = 0.1;
+        // Calculate the ln activity coefficients of the neutral species (with b = 0.1 in lg(gammai) = b*I as in PHREEQC)
+        props.ln_g(ineutral_species).fill(ln10 * 0.1 * I);
 
-            // Calculate the ln activity coefficient of the current neutral species
-            props.ln_g[ispecies] = ln10 * b * I;
-        }
-
-
-        // Loop over all charged species in the mixture
-        for(auto i = 0; i < num_charged_species; ++i)
+        // Calculate the ln activity coefficients of the charged species (skipped if there are no ions in the solution)
+        if(I != 0.0)
         {
-            // The index of the charged species in the mixture
-            const auto ispecies = icharged_species[i];
-
-            // The stoichiometric molality of the charged species
-            const auto msi = ms[i];
-
-            // Check if the molality of the charged species is zero
-            if(msi == 0.0)
-                continue;
-
-            // The electrical charge of the charged species
-            const auto z = charges[i];
-            const auto z2 = z*z;
-
-            // The effective radius of the charged species
-            const auto eff_radius = effective_radii[i];
+            // The \Lamba parameters of the HKF activity coefficient model
+            lambda = 1.0 + a*(B*sqrtI);
 
-            // The Born coefficient of the current charged species
-            const auto omega = eta*z2/eff_radius - z*omegaH;
-
-            // The absolute Born coefficient of the current charged species
-            const auto omega_abs = eta*z2/eff_radius;
-
-            // The Debye-Huckel ion size parameter of the current ion as computed by Reed (1982) and also in TOUGHREACT
-            const auto a = (z < 0) ?
-                2.0*(eff_radius + 1.91*abs(z))/(abs(z) + 1.0) :
-                2.0*(eff_radius + 1.81*abs(z))/(abs(z) + 1.0);
-
-            // The \Lamba parameter of the HKF activity coefficient model
-            const auto lambda = 1.0 + a*B*sqrtI;
-
-            // The log10 of the activity coefficient of the charged species (in mole fraction scale)
+            // The ln activity coefficients of the charged species (in mole fraction scale)
             // This is the equation (298) in Helgeson et a. (1981) paper, page 230.
-            const auto log10_gi = -(A*z2*sqrtI)/lambda + log10_xw + (omega_abs * bNaCl + bNapClm - 0.19*(abs(z) - 1.0)) * I;
-
-            // Set the activity coefficient of the current charged species
-            props.ln_g[ispecies] = log10_gi * ln10;
+            props.ln_g(icharged_species) = ln10 * (-(A*sqrtI)*z2/lambda + log10_xw + (omega_abs*bNaCl + bNapClm - zcorr)*I);
 
             // Check if the mole fraction of water is one
             if(xw != 1.0)
             {
-                // The sigma parameter of the current ion
-                const auto sigma = 3.0/pow(a*B*sqrtI, 3) * (lambda - 1.0/lambda - 2.0*log(lambda));
-
-                // The psi contribution of the current ion
-                const auto psi = A*z2*sqrtI*sigma/3.0 + alpha - 0.5*(omega*bNaCl + bNapClm - 0.19*(abs(z) - 1.0)) * I;
+                // The sigma parameters of the charged species
+                sigma = 3.0/(lambda - 1.0).cube() * (lambda - 1.0/lambda - 2.0*lambda.log());
 
-                // Update the osmotic coefficient with the contribution of the current charged species
-                phi += msi * psi;
+                // Calculate the osmotic coefficient from the psi contributions of all charged species
+                phi = (A*sqrtI/3.0)*(ms*z2*sigma).sum() + alpha*ms.sum() - 0.5*I*(ms*(omega*bNaCl + bNapClm - zcorr)).sum();
             }
         }
 
@@ -86,4 +86,20 @@ TEST_CASE("Testing ActivityModelHKF", "[ActivityModelHKF]")
     CHECK( exp(props.ln_g[11]) == Approx(1.2735100000) ); // NaOH
 
     checkActivities(x, props);
+
+    // Evaluate the activity props function at another temperature and then again at the original one
+    ActivityProps other = ActivityProps::create(species.size());
+
+    fn(other, {T + 50.0, P, x});
+
+    CHECK( (other.ln_g - props.ln_g).abs().maxCoeff() > 0.0 );
+
+    fn(other, {T, P, x});
+
+    for(auto i = 0; i < x.size(); ++i)
+    {
+        INFO("i = " << i);
+        CHECK( other.ln_g[i] == Approx(props.ln_g[i]) );
+        CHECK( other.ln_a[i] == Approx(props.ln_a[i]) );
+    }
 }
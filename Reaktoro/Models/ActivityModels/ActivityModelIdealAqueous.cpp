@@ -51,4 +51,32 @@ auto ActivityModelIdealAqueous() -> ActivityModelGenerator
     return model;
 }
 
+auto ActivityModelJacobianIdealAqueous() -> ActivityModelJacobianGenerator
+{
+    ActivityModelJacobianGenerator jacobian = [](const SpeciesList& species)
+    {
+        const auto iw = species.indexWithFormula("H2O");
+
+        ActivityModelJacobian fn = [=](MatrixXdRef J, ActivityModelArgs args, double nsum)
+        {
+            const auto x = args.x;
+            const auto nw = double(x[iw]) * nsum;
+
+            // From ln(a[i]) = ln(n[i]) - ln(nw) - ln(Mw) for the solutes, J(i, j) = δij/n[i] - δjw/nw
+            J.fill(0.0);
+            for(auto i = 0; i < x.size(); ++i)
+                J(i, i) = 1.0/(double(x[i]) * nsum);
+            J.col(iw).fill(-1.0/nw);
+
+            // From ln(a[w]) = 1 - nsum/nw for water, J(w, j) = -1/nw + δjw*nsum/nw^2
+            J.row(iw).fill(-1.0/nw);
+            J(iw, iw) += nsum/(nw*nw);
+        };
+
+        return fn;
+    };
+
+    return jacobian;
+}
+
 } // namespace Reaktoro
@@ -25,4 +25,8 @@ namespace Reaktoro {
 /// Return the activity model for an ideal aqueous solution.
 auto ActivityModelIdealAqueous() -> ActivityModelGenerator;
 
+/// Return the analytic derivatives of the ln activities of the species in an ideal aqueous solution with respect to their amounts.
+/// @see ActivityModelIdealAqueous, ActivityModelJacobian
+auto ActivityModelJacobianIdealAqueous() -> ActivityModelJacobianGenerator;
+
 } // namespace Reaktoro
@@ -25,4 +25,5 @@ using namespace Reaktoro;
 void exportActivityModelIdealAqueous(py::module& m)
 {
     m.def("ActivityModelIdealAqueous", ActivityModelIdealAqueous);
+    m.def("ActivityModelJacobianIdealAqueous", ActivityModelJacobianIdealAqueous);
 }
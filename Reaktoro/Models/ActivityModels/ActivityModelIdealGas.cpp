@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealSolution.hpp>
 
 namespace Reaktoro {
 
@@ -52,4 +53,10 @@ auto ActivityModelIdealGas() -> ActivityModelGenerator
     return model;
 }
 
+auto ActivityModelJacobianIdealGas() -> ActivityModelJacobianGenerator
+{
+    // The pressure term ln(P) in ln(a[i]) does not depend on the species amounts
+    return ActivityModelJacobianIdealSolution();
+}
+
 } // namespace Reaktoro
@@ -25,4 +25,8 @@ namespace Reaktoro {
 /// Return the activity model for an ideal gaseous solution.
 auto ActivityModelIdealGas() -> ActivityModelGenerator;
 
+/// Return the analytic derivatives of the ln activities of the species in an ideal gaseous solution with respect to their amounts.
+/// @see ActivityModelIdealGas, ActivityModelJacobian
+auto ActivityModelJacobianIdealGas() -> ActivityModelJacobianGenerator;
+
 } // namespace Reaktoro
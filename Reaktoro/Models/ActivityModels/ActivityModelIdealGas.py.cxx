@@ -25,4 +25,5 @@ using namespace Reaktoro;
 void exportActivityModelIdealGas(py::module& m)
 {
     m.def("ActivityModelIdealGas", ActivityModelIdealGas);
+    m.def("ActivityModelJacobianIdealGas", ActivityModelJacobianIdealGas);
 }
@@ -38,4 +38,24 @@ auto ActivityModelIdealSolution(StateOfMatter stateofmatter) -> ActivityModelGen
     return model;
 }
 
+auto ActivityModelJacobianIdealSolution() -> ActivityModelJacobianGenerator
+{
+    ActivityModelJacobianGenerator jacobian = [](const SpeciesList& species)
+    {
+        ActivityModelJacobian fn = [](MatrixXdRef J, ActivityModelArgs args, double nsum)
+        {
+            const auto x = args.x;
+
+            // From ln(a[i]) = ln(n[i]) - ln(nsum), J(i, j) = δij/n[i] - 1/nsum
+            J.fill(-1.0/nsum);
+            for(auto i = 0; i < x.size(); ++i)
+                J(i, i) += 1.0/(double(x[i]) * nsum);
+        };
+
+        return fn;
+    };
+
+    return jacobian;
+}
+
 } // namespace Reaktoro
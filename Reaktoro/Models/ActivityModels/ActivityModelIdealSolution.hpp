@@ -26,4 +26,8 @@ namespace Reaktoro {
 /// @param stateofmatter The state of matter of the solution
 auto ActivityModelIdealSolution(StateOfMatter stateofmatter) -> ActivityModelGenerator;
 
+/// Return the analytic derivatives of the ln activities of the species in an ideal solution with respect to their amounts.
+/// @see ActivityModelIdealSolution, ActivityModelJacobian
+auto ActivityModelJacobianIdealSolution() -> ActivityModelJacobianGenerator;
+
 } // namespace Reaktoro
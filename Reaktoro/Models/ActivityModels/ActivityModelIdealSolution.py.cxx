@@ -25,4 +25,5 @@ using namespace Reaktoro;
 void exportActivityModelIdealSolution(py::module& m)
 {
     m.def("ActivityModelIdealSolution", ActivityModelIdealSolution);
+    m.def("ActivityModelJacobianIdealSolution", ActivityModelJacobianIdealSolution);
 }
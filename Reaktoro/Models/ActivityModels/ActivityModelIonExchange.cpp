@@ -18,6 +18,7 @@
 #include "ActivityModelIonExchange.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Singletons/Elements.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/IonExchangeSurface.hpp>
@@ -30,159 +31,165 @@ using std::log;
 
 namespace detail {
 
+/// The parameters of the Davies and Debye--Huckel activity coefficients of the ion exchange species, fetched once from their attached PHREEQC data.
+struct IonExchangeActivityCoefficientParams
+{
+    /// The squares of the numbers of exchanger's equivalents of the ion exchange species.
+    ArrayXd ze2;
+
+    /// The Debye--Huckel parameters *a* of the ion exchange species.
+    ArrayXd a;
+
+    /// The Debye--Huckel parameters *b* of the ion exchange species.
+    ArrayXd b;
+
+    /// The flags indicating which ion exchange species use the Davies activity model (`b == 99.9` in the PHREEQC database).
+    Vec<bool> davies;
+
+    /// The flag indicating whether all ion exchange species have attached PHREEQC data from which the parameters above were fetched.
+    bool available = true;
+};
+
+/// Return the parameters of the activity coefficients of the given ion exchange species.
+auto ionExchangeActivityCoefficientParams(const SpeciesList& species, ArrayXdConstRef ze) -> IonExchangeActivityCoefficientParams
+{
+    const auto num_species = species.size();
+
+    IonExchangeActivityCoefficientParams params;
+    params.ze2 = ze * ze;
+    params.a = ArrayXd::Zero(num_species);
+    params.b = ArrayXd::Zero(num_species);
+    params.davies.assign(num_species, false);
+
+    for(auto i = 0; i < num_species; i++)
+    {
+        // Fetch phreeqc species from the `attachedData` field of the species
+        const auto phreeqc_species = std::any_cast<const PhreeqcSpecies*>(&species[i].attachedData());
+        if(!phreeqc_species)
+        {
+            params.available = false;
+            continue;
+        }
+
+        // Fetch Debye--Huckel activity model parameters a and b
+        params.a[i] = (*phreeqc_species)->dha;
+        params.b[i] = (*phreeqc_species)->dhb;
+        params.davies[i] = params.b[i] == 99.9; // the Phreeqc hack used while reading the dat-file, which indicate to use Davies activity model
+    }
+
+    return params;
+}
+
+/// Compute the ln activity coefficients of the ion exchange species, if the aqueous phase has already been evaluated.
+auto ionExchangeActivityCoefficientsLn(IonExchangeActivityCoefficientParams const& params, ActivityPropsRef props, real const& T) -> void
+{
+    const auto num_species = params.ze2.size();
+
+    // Initialized the ln of activity coefficients of the ion exchange species on the surface
+    auto& ln_g = props.ln_g;
+    ln_g = ArrayXr::Zero(num_species);
+
+    // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
+    if(!props.extra["AqueousMixtureState"].has_value())
+        return;
+
+    errorif(!params.available, "Expecting ion exchange species with attached PHREEQC data (e.g., from a PhreeqcDatabase) "
+        "for the calculation of their Davies and Debye--Huckel activity coefficients.");
+
+    // Export aqueous mixture state via `extra` data member
+    const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+
+    // Auxiliary constant references properties
+    const auto& I = aqstate.Is;            // the stoichiometric ionic strength
+    const auto& rho = aqstate.rho/1000;    // the density of water (in g/cm3)
+    const auto& epsilon = aqstate.epsilon; // the dielectric constant of water
+
+    // Auxiliary variables
+    const auto sqrtI = sqrt(I);
+    const auto sqrt_rho = sqrt(rho);
+    const auto T_epsilon = T * epsilon;
+    const auto sqrt_T_epsilon = sqrt(T_epsilon);
+    const auto A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
+    const auto B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
+    const auto ln10 = log(10);
+    const auto Agamma = 0.5095; // the Debye-Huckel parameter
+
+    // The terms of the Davies activity model common to all ion exchange species
+    const real davies_term = -Agamma*sqrtI/(1 + sqrtI);
+    const real davies_shift = -0.3*I;
+
+    // The terms of the Debye--Huckel activity model common to all ion exchange species
+    const real A_sqrtI = -A*sqrtI;
+    const real B_sqrtI = B*sqrtI;
+
+    for(auto i = 0; i < num_species; i++)
+    {
+        if(params.davies[i])
+            ln_g[i] = ln10*(params.ze2[i]*davies_term + davies_shift); // the Davies activity model
+        else
+            ln_g[i] = ln10*(params.ze2[i]*A_sqrtI/(1.0 + params.a[i]*B_sqrtI) + params.b[i]*I); // the Debye--Huckel activity model
+    }
+}
+
 /// Return the IonExchangeActivityModel object based on the Gaines--Thomas model.
 auto activityModelIonExchangeGainesThomas(const SpeciesList& species) -> ActivityModel
 {
     // Create the ion exchange surface
     IonExchangeSurface surface(species);
 
-    // The number of all species and ion exchange species in the current exchange phase only
-    const auto num_species = species.size();
-
     // The numbers of exchanger's equivalents for exchange species
     ArrayXd ze = surface.ze();
 
+    // The parameters of the activity coefficients of the exchange species
+    const auto params = ionExchangeActivityCoefficientParams(species, ze);
+
     // Define the activity model function of the ion exchange phase
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
         const auto& [T, P, x] = args;
 
-        // Auxiliary references
-        auto& ln_g = props.ln_g;
-        auto& ln_a = props.ln_a;
-
         // Calculate ln of activities of ion exchange species as the ln of equivalent fractions
-        ln_a = (x*ze/(x*ze).sum()).log();
+        props.ln_a = (x*ze/(x*ze).sum()).log();
 
-        // Initialized the ln of activity coefficients of the ion exchange species on the surface
-        ln_g = ArrayXr::Zero(num_species);
+        // Calculate the ln of activity coefficients of the ion exchange species on the surface
+        ionExchangeActivityCoefficientsLn(params, props, T);
 
-        // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-        if(props.extra["AqueousMixtureState"].has_value())
-        {
-            // Export aqueous mixture state via `extra` data member
-            const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
-
-            // Auxiliary constant references properties
-            const auto& I = aqstate.Is;            // the stoichiometric ionic strength
-            const auto& rho = aqstate.rho/1000;    // the density of water (in g/cm3)
-            const auto& epsilon = aqstate.epsilon; // the dielectric constant of water
-
-            // Auxiliary variables
-            const auto sqrtI = sqrt(I);
-            const auto sqrt_rho = sqrt(rho);
-            const auto T_epsilon = T * epsilon;
-            const auto sqrt_T_epsilon = sqrt(T_epsilon);
-            const auto A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
-            const auto B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
-            const auto ln10 = log(10);
-            const auto Agamma = 0.5095; // the Debye-Huckel parameter
-
-            // Loop over all ion exchange species in composition
-            for(auto i = 0; i < num_species; i++)
-            {
-                // Fetch phreeqc species from the `attachedData` field of the species
-                const auto phreeqc_species = std::any_cast<const PhreeqcSpecies*>(species[i].attachedData());
-
-                // Fetch Debye--Huckel activity model parameters a and b
-                const auto a = phreeqc_species->dha;
-                const auto b = phreeqc_species->dhb;
-
-                if(b == 99.9) // the Phreeqc hack used while reading the dat-file, which indicate to use Davies activity model
-                {
-                    // Calculate the ln activity coefficient of the exchange species using the Davies activity model
-                    ln_g[i] = ln10*(-Agamma*ze[i]*ze[i]*sqrtI/(1 + sqrtI) - 0.3*I);
-                }
-                else // otherwise, the Debye--Huckel activity model is preferred
-                {
-                    // Calculate the ln activity coefficient of the exchange species using the Debye--Huckel model
-                    ln_g[i] = ln10*(-A*ze[i]*ze[i]*sqrtI/(1.0 + a*B*sqrtI) + b*I);
-                }
-            }
-        }
         // Add the correction introduced by the activity coefficients
-        ln_a += ln_g;
+        props.ln_a += props.ln_g;
     };
     return fn;
 }
 
 /// Return the IonExchangeVanselow object based on the Vanselow model.
 auto activityModelIonExchangeVanselow(const SpeciesList& species) -> ActivityModel
+{
+    // Create the ion exchange surface
+    IonExchangeSurface surface(species);
+
+    // The numbers of exchanger's equivalents for exchange species
+    ArrayXd ze = surface.ze();
+
+    // The parameters of the activity coefficients of the exchange species
+    const auto params = ionExchangeActivityCoefficientParams(species, ze);
+
+    // Define the activity model function of the ion exchange phase
+    ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
-        // Create the ion exchange surface
-        IonExchangeSurface surface(species);
+        // The arguments for the activity model evaluation
+        const auto& [T, P, x] = args;
 
-        // The number of all species and ion exchange species in the current exchange phase only
-        const auto num_species = species.size();
+        // Calculate ln of activities of ion exchange species as the ln of mole fractions
+        props.ln_a = (x/x.sum()).log();
 
-        // The numbers of exchanger's equivalents for exchange species
-        ArrayXd ze = surface.ze();
+        // Calculate the ln of activity coefficients of the ion exchange species on the surface
+        ionExchangeActivityCoefficientsLn(params, props, T);
 
-        // Define the activity model function of the ion exchange phase
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
-        {
-            // The arguments for the activity model evaluation
-            const auto& [T, P, x] = args;
-
-            // Auxiliary references
-            auto& ln_g = props.ln_g;
-            auto& ln_a = props.ln_a;
-
-            // Calculate ln of activities of ion exchange species as the ln of equivalent fractions
-            ln_a = (x/x.sum()).log();
-
-            // Initialized the ln of activity coefficients of the ion exchange species on the surface
-            ln_g = ArrayXr::Zero(num_species);
-
-            // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-            if(props.extra["AqueousMixtureState"].has_value())
-            {
-                // Export aqueous mixture state via `extra` data member
-                const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
-
-                // Auxiliary constant references properties
-                const auto& I = aqstate.Is;            // the stoichiometric ionic strength
-                const auto& rho = aqstate.rho/1000;    // the density of water (in g/cm3)
-                const auto& epsilon = aqstate.epsilon; // the dielectric constant of water
-
-                // Auxiliary variables
-                const auto sqrtI = sqrt(I);
-                const auto sqrt_rho = sqrt(rho);
-                const auto T_epsilon = T * epsilon;
-                const auto sqrt_T_epsilon = sqrt(T_epsilon);
-                const auto A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
-                const auto B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
-                const auto ln10 = log(10);
-                const auto Agamma = 0.5095; // the Debye-Huckel parameter
-
-                // Loop over all ion exchange species in composition
-                for(auto i = 0; i < num_species; i++)
-                {
-                    // Fetch phreeqc species from the `attachedData` field of the species
-                    const auto phreeqc_species = std::any_cast<const PhreeqcSpecies*>(species[i].attachedData());
-
-                    // Fetch Debye--Huckel activity model parameters a and b
-                    const auto a = phreeqc_species->dha;
-                    const auto b = phreeqc_species->dhb;
-
-                    if(b == 99.9) // the Phreeqc hack used while reading the dat-file, which indicate to use Davies activity model
-                    {
-                        // Calculate the ln activity coefficient of the exchange species using the Davies activity model
-                        ln_g[i] = ln10*(-Agamma*ze[i]*ze[i]*sqrtI/(1 + sqrtI) - 0.3*I);
-                    }
-                    else // otherwise, the Debye--Huckel activity model is preferred
-                    {
-                        // Calculate the ln activity coefficient of the exchange species using the Debye--Huckel model
-                        ln_g[i] = ln10*(-A*ze[i]*ze[i]*sqrtI/(1.0 + a*B*sqrtI) + b*I);
-                    }
-                }
-            }
-            // Add the correction introduced by the activity coefficients
-            ln_a += ln_g;
-        };
-        return fn;
-    }
+        // Add the correction introduced by the activity coefficients
+        props.ln_a += props.ln_g;
+    };
+    return fn;
+}
 
 } // namespace detail
 
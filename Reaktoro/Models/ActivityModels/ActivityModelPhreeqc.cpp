@@ -25,6 +25,7 @@
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcLegacy.hpp>
@@ -60,6 +61,68 @@ auto const ACTIVITY_MODEL_PHREEQC_NEGATIVE_ACTIVITY_ERROR_MESSAGE =
 
 auto const LOG_10 = ln10;
 
+/// The temperature-dependent terms of the LLNL aqueous model of PHREEQC.
+struct ActivityModelPhreeqcTermsLLNL
+{
+    /// The Debye-Hückel parameter *A* interpolated from the LLNL tables.
+    real a = {};
+
+    /// The Debye-Hückel parameter *B* interpolated from the LLNL tables.
+    real b = {};
+
+    /// The *b-dot* parameter interpolated from the LLNL tables.
+    real bdot = {};
+
+    /// The coefficient of the linear term in ionic strength of the CO2 activity coefficient.
+    real co2a = {};
+
+    /// The coefficient of the term *I/(I + 1)* of the CO2 activity coefficient.
+    real co2b = {};
+};
+
+/// Return a memoized function that computes the temperature-dependent terms of the LLNL aqueous model of PHREEQC.
+auto createMemoizedTermsLLNLFn(Vec<double> const& llnl_temp, Vec<double> const& llnl_adh, Vec<double> const& llnl_bdh, Vec<double> const& llnl_bdot, Vec<double> const& llnl_co2_coefs)
+{
+    Fn<ActivityModelPhreeqcTermsLLNL(real const&)> fn = [=](real const& T)
+    {
+        ActivityModelPhreeqcTermsLLNL res;
+
+        if(llnl_temp.empty())
+            return res;
+
+        real const tc_x = T - 273.15; // temperature from K to °C
+
+        errorif(tc_x < llnl_temp.front() || tc_x > llnl_temp.back(), "Temperature out of range of LLNL_AQUEOUS_MODEL parameters");
+
+        int ifirst = 0;
+        int ilast = (int)llnl_temp.size();
+
+        for(int i = 0; i < (int)llnl_temp.size(); i++)
+        {
+            if(tc_x >= llnl_temp[i])
+                ifirst = i;
+            if(tc_x <= llnl_temp[i])
+            {
+                ilast = i;
+                break;
+            }
+        }
+
+        real const f = (ilast == ifirst) ? real(1.0) : (tc_x - llnl_temp[ifirst]) / (llnl_temp[ilast] - llnl_temp[ifirst]);
+
+        res.a = (1 - f) * llnl_adh[ifirst] + f * llnl_adh[ilast];
+        res.b = (1 - f) * llnl_bdh[ifirst] + f * llnl_bdh[ilast];
+        res.bdot = (1 - f) * llnl_bdot[ifirst] + f * llnl_bdot[ilast];
+
+        // The coefficients of the CO2 activity coefficient, log_g_co2 = co2a * mu - co2b * mu/(mu + 1)
+        res.co2a = llnl_co2_coefs[0] + llnl_co2_coefs[1] * T + llnl_co2_coefs[2] / T;
+        res.co2b = llnl_co2_coefs[3] + llnl_co2_coefs[4] * T;
+
+        return res;
+    };
+    return memoizeLast(fn);
+}
+
 auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase const& db) -> ActivityModel
 {
     // Create the aqueous solution
@@ -74,9 +137,6 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
     // The PHREEQC pointer that gives us access to the internal state of PHREEQC after parsing the database.
     auto const phq = db.ptr();
 
-    // The PHREEQC pointer to H2O species
-    PhreeqcSpecies const* s_h2o = phq->s_h2o;
-
     // The llnl arrays in PHREEQC. These arrays are used to compute the activity coefficients of the species when using LLNL activity model.
     Vec<double> llnl_temp(phq->llnl_temp, phq->llnl_temp + phq->llnl_count_temp);
     Vec<double> llnl_adh(phq->llnl_adh, phq->llnl_adh + phq->llnl_count_adh);
@@ -84,15 +144,62 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
     Vec<double> llnl_bdot(phq->llnl_bdot, phq->llnl_bdot + phq->llnl_count_bdot);
     Vec<double> llnl_co2_coefs(phq->llnl_co2_coefs, phq->llnl_co2_coefs + phq->llnl_count_co2_coefs);
 
-    // The PHREEQC species pointers for all species in the aqueous solution.
-    Vec<PhreeqcSpecies const*> s_x;
-    for(auto const& species : solution.species())
+    // The indices of the species grouped by the activity coefficient equation used for them in PHREEQC (species with unit activity coefficients are not listed)
+    Indices iuncharged; // uncharged species (gflag 0)
+    Indices idavies;    // Davies equation (gflag 1)
+    Indices iwateq;     // extended or WATEQ Debye-Hückel equation (gflag 2)
+    Indices illnl;      // charged species in the LLNL aqueous model (gflag 7)
+    Indices ico2;       // CO2 in the LLNL aqueous model (gflag 8)
+
+    // Collect the species of the aqueous solution in each group, extracting their parameters from the PHREEQC species once here
+    Vec<double> z2uncharged, dhbuncharged, z2davies, z2wateq, dhawateq, dhbwateq, z2llnl, dhallnl;
+
+    for(auto [i, sp] : enumerate(solution.species()))
     {
-        PhreeqcSpecies const* s = PhreeqcUtils::findSpecies(*phq, species.name());
-        errorif(s == nullptr, "The species " + species.name() + " was not found in the PHREEQC database. Make sure you are assigning ActivityModelPhreeqc to an aqueous phase whose all species can be found in your chosen PHREEQC database.");
-        s_x.push_back(s);
+        PhreeqcSpecies const* s = PhreeqcUtils::findSpecies(*phq, sp.name());
+        errorif(s == nullptr, "The species " + sp.name() + " was not found in the PHREEQC database. Make sure you are assigning ActivityModelPhreeqc to an aqueous phase whose all species can be found in your chosen PHREEQC database.");
+
+        switch(s->gflag)
+        {
+        // uncharged
+        case 0: iuncharged.push_back(i); dhbuncharged.push_back(s->dhb); break;
+        // Davies
+        case 1: idavies.push_back(i); z2davies.push_back(s->z * s->z); break;
+        // Extended D-H, WATEQ D-H
+        case 2: iwateq.push_back(i); z2wateq.push_back(s->z * s->z); dhawateq.push_back(s->dha); dhbwateq.push_back(s->dhb); break;
+        // Exchange
+        case 4: errorif(true, "Exchange species should not exist in the aqueous phase."); break;
+        // Surface
+        case 6: errorif(true, "Surface species should not exist in the aqueous phase."); break;
+        // LLNL
+        case 7:
+            errorif(llnl_temp.empty(), "LLNL_AQUEOUS_MODEL_PARAMETERS not defined.");
+            if(s->z != 0) { illnl.push_back(i); z2llnl.push_back(s->z * s->z); dhallnl.push_back(s->dha); }
+            break;
+        // LLNL CO2
+        case 8:
+            errorif(llnl_temp.empty(), "LLNL_AQUEOUS_MODEL_PARAMETERS not defined.");
+            ico2.push_back(i);
+            break;
+        // Always 1.0 (gflag 3 and 5) and activity coefficient of water (gflag 9), computed below
+        default: break;
+        }
     }
 
+    // Convert the per-species coefficients into arrays for the vectorized evaluation of the activity coefficients
+    auto toArray = [](Vec<double> const& v) -> ArrayXr { return ArrayXd::Map(v.data(), v.size()).cast<real>(); };
+
+    ArrayXr const DHB_uncharged = toArray(dhbuncharged);
+    ArrayXr const Z2_davies     = toArray(z2davies);
+    ArrayXr const Z2_wateq      = toArray(z2wateq);
+    ArrayXr const DHA_wateq     = toArray(dhawateq);
+    ArrayXr const DHB_wateq     = toArray(dhbwateq);
+    ArrayXr const Z2_llnl       = toArray(z2llnl);
+    ArrayXr const DHA_llnl      = toArray(dhallnl);
+
+    // The temperature-dependent terms of the LLNL aqueous model, computed again only when temperature changes
+    auto llnlterms = createMemoizedTermsLLNLFn(llnl_temp, llnl_adh, llnl_bdh, llnl_bdot, llnl_co2_coefs);
+
     // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
     auto aqstateptr = std::make_shared<AqueousMixtureState>();
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
@@ -106,7 +213,8 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         assert(x.minCoeff() > 0.0 && x.maxCoeff() <= 1.0);
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        solution.updateState(*aqstateptr, T, P, x);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -115,152 +223,33 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         props.extra["AqueousMixtureState"] = aqstateptr;
         props.extra["AqueousMixture"] = aqsolutionptr;
 
-        // Calculates gammas and [moles * d(ln gamma)/d mu] for all aqueous species.
-        int i, j;
-        int ifirst, ilast;
-        real f, log_g_co2, dln_g_co2, c2_llnl;
-
-        real c1, c2, a, b;
-        real muhalf, equiv;
-        real a_llnl, b_llnl, bdot_llnl;
-
         real mu = aqstate.Ie;
-        real tk_x = T; // temperature in K
-        real tc_x = T - 273.15; // temperature from K to °C
-        real patm_x = P / 101325.0; // pressure from Pa to atm
 
         warningif(mu > 6.0 && Warnings::isEnabled(548), ACTIVITY_MODEL_PHREEQC_IONIC_STRENGTH_WARNING_MESSAGE);
 
-        ArrayXr lg(s_x.size());
-
-        // Initialize
         if(mu <= 0)
             mu = 1e-10;
 
-        a_llnl = b_llnl = bdot_llnl = log_g_co2 = dln_g_co2 = c2_llnl = 0;
-
-        // Compute temperature dependence of a and b for debye-huckel
-        PhreeqcUtils::PhreeqcWaterProps wprops = PhreeqcUtils::waterPropsMemoized(T, P);
-        a = wprops.wep.DH_A;
-        b = wprops.wep.DH_B;
-
-        // LLNL temperature dependence
-
-        if(llnl_temp.size() > 0)
-        {
-            ifirst = 0;
-            ilast = (int)llnl_temp.size();
-
-            if(tc_x < llnl_temp[0] || tc_x > llnl_temp[llnl_temp.size() - 1])
-                errorif(true, "Temperature out of range of LLNL_AQUEOUS_MODEL parameters");
-
-            for(i = 0; i < (int)llnl_temp.size(); i++)
-            {
-                if(tc_x >= llnl_temp[i])
-                    ifirst = i;
-                if(tc_x <= llnl_temp[i])
-                {
-                    ilast = i;
-                    break;
-                }
-            }
-            if(ilast == ifirst)
-            {
-                f = 1;
-            }
-            else
-            {
-                f = (tc_x - llnl_temp[ifirst]) / (llnl_temp[ilast] - llnl_temp[ifirst]);
-            }
-            a_llnl = (1 - f) * llnl_adh[ifirst] + f * llnl_adh[ilast];
-            b_llnl = (1 - f) * llnl_bdh[ifirst] + f * llnl_bdh[ilast];
-            bdot_llnl = (1 - f) * llnl_bdot[ifirst] + f * llnl_bdot[ilast];
-
-            // CO2 activity coefficient
-            log_g_co2 = (llnl_co2_coefs[0] + llnl_co2_coefs[1] * tk_x + llnl_co2_coefs[2] / tk_x) * mu - (llnl_co2_coefs[3] + llnl_co2_coefs[4] * tk_x) * (mu / (mu + 1));
-            log_g_co2 /= LOG_10;
-            dln_g_co2 = (llnl_co2_coefs[0] + llnl_co2_coefs[1] * tk_x + llnl_co2_coefs[2] / tk_x) - (llnl_co2_coefs[3] + llnl_co2_coefs[4] * tk_x) * (1 / ((mu + 1) * (mu + 1)));
-        }
+        real const muhalf = sqrt(mu);
 
-        // constants for equations
+        // The temperature and pressure dependence of a and b for Debye-Hückel (memoized in PhreeqcUtils::waterPropsMemoized)
+        PhreeqcUtils::PhreeqcWaterProps const wprops = PhreeqcUtils::waterPropsMemoized(T, P);
+        real const a = wprops.wep.DH_A;
+        real const b = wprops.wep.DH_B;
 
-        muhalf = sqrt(mu);
-        c1 = (-a) * LOG_10 * (1.0 / (2 * muhalf * (muhalf + 1.0) * (muhalf + 1.0)) - 0.3);
-        c2 = -a / (2 * muhalf);
+        // Calculate the log10 activity coefficients of the species in each group at once
+        auto& lg = props.ln_g;
 
-        if(llnl_temp.size() > 0)
-        {
-            c2_llnl = -a_llnl / (2 * muhalf);
-        }
+        lg.setZero();
+        lg(iuncharged) = DHB_uncharged * mu;
+        lg(idavies) = -a * Z2_davies * (muhalf / (1.0 + muhalf) - 0.3 * mu);
+        lg(iwateq) = -a * muhalf * Z2_wateq / (1.0 + b * muhalf * DHA_wateq) + DHB_wateq * mu;
 
-        // Calculate activity coefficients
-        for(i = 0; i < (int)s_x.size(); i++)
+        if(!illnl.empty() || !ico2.empty())
         {
-            switch(s_x[i]->gflag)
-            {
-            // uncharged
-            case 0:
-                lg[i] = s_x[i]->dhb * mu;
-                break;
-            // Davies
-            case 1:
-                lg[i] = -s_x[i]->z * s_x[i]->z * a * (muhalf / (1.0 + muhalf) - 0.3 * mu);
-                break;
-            // Extended D-H, WATEQ D-H
-            case 2:
-                lg[i] = -a * muhalf * s_x[i]->z * s_x[i]->z / (1.0 + s_x[i]->dha * b * muhalf) + s_x[i]->dhb * mu;
-                break;
-            // Always 1.0
-            case 3:
-                lg[i] = 0.0;
-                break;
-            // Exchange
-            case 4:
-                errorif(true, "Exchange species should not exist in the aqueous phase.");
-                break;
-            // Always 1.0
-            case 5:
-                lg[i] = 0.0;
-                break;
-            // Surface
-            case 6:
-                errorif(true, "Surface species should not exist in the aqueous phase.");
-                break;
-            // LLNL
-            case 7:
-                if(llnl_temp.size() > 0)
-                {
-                    if(s_x[i]->z == 0)
-                    {
-                        lg[i] = 0.0;
-                    }
-                    else
-                    {
-                        lg[i] = -a_llnl * muhalf * s_x[i]->z * s_x[i]->z / (1.0 + s_x[i]->dha * b_llnl * muhalf) + bdot_llnl * mu;
-                        break;
-                    }
-                }
-                else
-                {
-                    errorif(true, "LLNL_AQUEOUS_MODEL_PARAMETERS not defined.");
-                }
-                break;
-            // LLNL CO2
-            case 8:
-                if(llnl_temp.size() > 0)
-                {
-                    lg[i] = log_g_co2;
-                }
-                else
-                {
-                    errorif(true, "LLNL_AQUEOUS_MODEL_PARAMETERS not defined.");
-                }
-                break;
-            // Activity coefficient of water
-            case 9:
-                lg[i] = 0.0; // Computed below
-                break;
-            }
+            auto const& llnl = llnlterms(T);
+            lg(illnl) = -llnl.a * muhalf * Z2_llnl / (1.0 + llnl.b * muhalf * DHA_llnl) + llnl.bdot * mu;
+            lg(ico2).fill((llnl.co2a * mu - llnl.co2b * (mu / (mu + 1))) / LOG_10);
         }
 
         // The mole fraction of water
@@ -272,13 +261,13 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         errorif(aw < 0.0, ACTIVITY_MODEL_PHREEQC_NEGATIVE_ACTIVITY_ERROR_MESSAGE)
 
         // Set the activity coefficients of the species
-        props.ln_g = lg * ln10;
+        props.ln_g *= ln10;
 
         // Set the activities of the species
         props.ln_a = props.ln_g + log(aqstate.m);
 
         // Set the activitiy of water
-        props.ln_a[iw] = log(1.0 - 0.017/Mw * (1.0 - xw)/xw);
+        props.ln_a[iw] = log(aw);
 
         // Set the activity coefficient of water (mole fraction scale)
         props.ln_g[iw] = props.ln_a[iw] - log(xw);
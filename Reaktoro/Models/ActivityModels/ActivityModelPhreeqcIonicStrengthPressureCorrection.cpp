@@ -20,8 +20,10 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcLegacy.hpp>
-#include <Reaktoro/Extensions/Phreeqc/PhreeqcThermo.hpp>
+#include <Reaktoro/Extensions/Phreeqc/PhreeqcUtils.hpp>
+#include <Reaktoro/Extensions/Phreeqc/PhreeqcWater.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 
 namespace Reaktoro {
@@ -30,16 +32,78 @@ auto ActivityModelPhreeqcIonicStrengthPressureCorrection() -> ActivityModelGener
 {
     ActivityModelGenerator model = [=](const SpeciesList& specieslist)
     {
-        // Collect the PhreeqcSpecies pointers attached to each Species object
-        Vec<const PhreeqcSpecies*> phspecies;
-        for(auto species : specieslist)
+        //--------------------------------------------------------------------------------
+        // The ionic strength correction of the standard molar volumes below is
+        // the same as in PhreeqcUtils::standardVolumeIonicStrengthCorrection,
+        // based on PHREEQC method `Phreeqc::calc_vm`, with the parameters of the
+        // species extracted once here. For each species, it is written as:
+        //
+        //   Vcorr = 0.5*z^2*DH_Av*sqrt(mu)/(1 + bAv*DH_B*sqrt(mu)) + coef(T)*mu^e,
+        //   coef(T) = k0 + k1/TK_s + k2*TK_s + k3*tc + k4*tc^2,
+        //
+        // with coefficients set to zero for terms not used by the species.
+        //--------------------------------------------------------------------------------
+
+        const auto N = specieslist.size();
+
+        ArrayXr halfz2 = ArrayXr::Zero(N);
+        ArrayXr bAv    = ArrayXr::Zero(N);
+        ArrayXd k0     = ArrayXd::Zero(N);
+        ArrayXd k1     = ArrayXd::Zero(N);
+        ArrayXd k2     = ArrayXd::Zero(N);
+        ArrayXd k3     = ArrayXd::Zero(N);
+        ArrayXd k4     = ArrayXd::Zero(N);
+        ArrayXd e      = ArrayXd::Ones(N);
+
+        for(auto [i, species] : enumerate(specieslist))
         {
+            // Skip the species without an attached PhreeqcSpecies pointer
             const auto has_phreeqc_species = std::any_cast<const PhreeqcSpecies*>(&species.attachedData());
-            if(has_phreeqc_species)
-                phspecies.push_back(std::any_cast<const PhreeqcSpecies*>(species.attachedData()));
-            else phspecies.push_back(nullptr); // if PhreeqcSpecies pointer not attached, consider null pointer
+            if(!has_phreeqc_species)
+                continue;
+
+            const auto s = std::any_cast<const PhreeqcSpecies*>(species.attachedData());
+            const auto z = PhreeqcUtils::charge(s);
+
+            if(z == 0.0)
+                continue;
+
+            if(s->logk[vma1])
+            {
+                halfz2[i] = 0.5 * z * z;
+                bAv[i] = s->logk[b_Av] < 1e-5 ? 0.0 : s->logk[b_Av];
+                if(s->logk[vmi1] != 0.0 || s->logk[vmi2] != 0.0 || s->logk[vmi3] != 0.0)
+                {
+                    k0[i] = s->logk[vmi1];
+                    k1[i] = s->logk[vmi2];
+                    k2[i] = s->logk[vmi3];
+                    e[i]  = s->logk[vmi4];
+                }
+            }
+            else if(s->millero[0])
+            {
+                halfz2[i] = 0.5 * z * z;
+                k0[i] = s->millero[3];
+                k3[i] = s->millero[4];
+                k4[i] = s->millero[5];
+            }
         }
 
+        // The indices of the species whose last term is not linear in ionic strength
+        Indices inonlinear;
+        for(Index i = 0; i < N; ++i)
+            if(e[i] != 1.0)
+                inonlinear.push_back(i);
+
+        // The temperature-dependent coefficients coef(T) of all species, computed again only when temperature changes
+        Fn<ArrayXr(const real&)> coeffn = [=](const real& T)
+        {
+            const real tc = T - 273.15;
+            const real TK_s = tc + 45.15;
+            return ArrayXr(k0.cast<real>() + k1.cast<real>()/TK_s + k2.cast<real>()*TK_s + tc*(k3.cast<real>() + k4.cast<real>()*tc));
+        };
+        coeffn = memoizeLast(coeffn);
+
         const auto Pref = 1.0e5; // reference pressure at 1 bar (in Pa)
 
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
@@ -57,19 +121,22 @@ auto ActivityModelPhreeqcIonicStrengthPressureCorrection() -> ActivityModelGener
             const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
 
             const auto mu = state.Ie;
+            const auto sqrt_mu = sqrt(mu);
             const auto RT = universalGasConstant * T;
 
+            // The properties of water at (T, P) (memoized in PhreeqcUtils::waterPropsMemoized)
             const auto wprops = PhreeqcUtils::waterPropsMemoized(T, P);
+            const auto& DH_B = wprops.wep.DH_B;
+            const auto& DH_Av = wprops.wep.DH_Av;
 
-            for(auto [i, species] : enumerate(specieslist))
-            {
-                if(phspecies[i] == nullptr)
-                    continue;
+            const auto coef = coeffn(T);
 
-                const auto Vcorr = standardVolumeIonicStrengthCorrection(phspecies[i], T, P, mu, wprops) * cubicCentimeterToCubicMeter; // in m3/mol
+            const real factor = cubicCentimeterToCubicMeter * (P - Pref)/RT; // from cm3/mol to m3/mol
 
-                props.ln_a[i] += Vcorr * (P - Pref)/RT;
-            }
+            props.ln_a += factor * (halfz2 * (DH_Av * sqrt_mu) / (1.0 + bAv * (DH_B * sqrt_mu)) + coef * mu);
+
+            for(auto i : inonlinear)
+                props.ln_a[i] += factor * coef[i] * (pow(mu, e[i]) - mu);
         };
 
         return fn;
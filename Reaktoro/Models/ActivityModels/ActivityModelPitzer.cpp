@@ -18,6 +18,7 @@
 #include "ActivityModelPitzer.hpp"
 
 // C++ includes
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <set>
@@ -26,15 +27,16 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
-#include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Core/ParamArena.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcWater.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
@@ -160,48 +162,91 @@ const Vec<double> J1region5 =
     2.49958395e+02, 4.99971193e+02, 7.49977057e+02, 9.99980578e+02, 1.24998298e+03, 1.49998474e+03, 1.74998611e+03, 1.99998720e+03, 2.24998810e+03, 2.49998886e+03
 };
 
-auto interpolate(real x, double x0, double x1, Vec<double> const& ypoints) -> real
+/// Used to evaluate the Pitzer functions \eq{J_0(x)} and \eq{J_1(x) = xJ_0^{\prime}(x)} with a precomputed table of cubic splines.
+/// The splines are piecewise cubic Hermite polynomials that interpolate the
+/// tabulated values of \eq{J_0(x)} above with slopes \eq{J_0^{\prime}(x) =
+/// J_1(x)/x} at the tabulated points. The function \eq{J_1(x)} is then
+/// evaluated from the analytic derivative of the spline of \eq{J_0(x)}, so
+/// that both functions and their derivatives are continuous in \eq{x}.
+class PitzerJTable
 {
-    auto const N = ypoints.size();
-    auto const dx = (x1 - x0)/(N - 1);
+public:
+    /// Construct the PitzerJTable object using the tabulated values of \eq{J_0(x)} and \eq{J_1(x)}.
+    PitzerJTable()
+    {
+        append(0.0, 1.0, J0region1, J1region1);
+        append(1.0, 10.0, J0region2, J1region2);
+        append(10.0, 100.0, J0region3, J1region3);
+        append(100.0, 1000.0, J0region4, J1region4);
+        append(1000.0, 10000.0, J0region5, J1region5);
+
+        // Compute the coefficients of the cubic polynomial in each interval in terms of t = (x - x[i])/(x[i + 1] - x[i])
+        for(auto i = 0; i + 1 < xpoints.size(); ++i)
+        {
+            auto const h = xpoints[i + 1] - xpoints[i];
+            auto const y0 = ypoints[i];
+            auto const y1 = ypoints[i + 1];
+            auto const m0 = h * slopes[i];
+            auto const m1 = h * slopes[i + 1];
+            coeffs.push_back({ y0, m0, 3.0*(y1 - y0) - 2.0*m0 - m1, 2.0*(y0 - y1) + m0 + m1 });
+        }
+    }
 
-    auto const k = floor((x.val() - x0)/dx);
-    auto const i = k + 2 < N ? k : N - 3;
+    /// Return the values of \eq{J_0(x)} and \eq{J_1(x)} at given \eq{x}.
+    auto evaluate(real const& x) const -> Pair<real, real>
+    {
+        errorif(x < 0.0, "Expecting non-negative x when evaluating the Pitzer functions J0(x) and J1(x), but got x = ", x, ".");
 
-    const auto xi0 = x0 + dx*i;
-    const auto xi1 = xi0 + dx;
-    const auto xi2 = xi1 + dx;
-    const auto yi0 = ypoints[i];
-    const auto yi1 = ypoints[i + 1];
-    const auto yi2 = ypoints[i + 2];
+        if(x > xpoints.back())
+            return { 0.25 * x, 0.25 * x }; // for very large values of x, J0 -> x/4 and J1 -> x/4
 
-    return interpolateQuadratic(x, xi0, xi1, xi2, yi0, yi1, yi2);
-}
+        auto const k = std::upper_bound(xpoints.begin(), xpoints.end(), x.val()) - xpoints.begin();
+        auto const i = std::min<Index>(k > 0 ? k - 1 : 0, coeffs.size() - 1);
 
-auto J0(real x) -> real
-{
-    errorif(x < 0.0, "Expecting non-negative x when evaluating the Pitzer function J0(x), but got x = ", x, ".");
+        auto const h = xpoints[i + 1] - xpoints[i];
+        auto const t = (x - xpoints[i])/h;
 
-    if(0.0 <= x && x <= 1.0) return interpolate(x, 0.0, 1.0, J0region1);
-    if(1.0 <= x && x <= 10.0) return interpolate(x, 1.0, 10.0, J0region2);
-    if(10.0 <= x && x <= 100.0) return interpolate(x, 10.0, 100.0, J0region3);
-    if(100.0 <= x && x <= 1000.0) return interpolate(x, 100.0, 1000.0, J0region4);
-    if(1000.0 <= x && x <= 10000.0) return interpolate(x, 1000.0, 10000.0, J0region5);
+        auto const& [a, b, c, d] = coeffs[i];
 
-    return 0.25 * x; // for very large values of x, J0 -> x/4
-}
+        auto const J0 = a + t*(b + t*(c + t*d));
+        auto const J1 = x/h * (b + t*(2.0*c + t*3.0*d));
 
-auto J1(real x) -> real
-{
-    errorif(x < 0.0, "Expecting non-negative x when evaluating the Pitzer function J1(x), but got x = ", x, ".");
+        return { J0, J1 };
+    }
+
+private:
+    /// Append the points of a region where \eq{J_0(x)} and \eq{J_1(x)} have been tabulated.
+    auto append(double x0, double x1, Vec<double> const& J0points, Vec<double> const& J1points) -> void
+    {
+        auto const N = J0points.size();
+        auto const dx = (x1 - x0)/(N - 1);
+        for(auto i = xpoints.empty() ? 0 : 1; i < N; ++i) // the first point of a region is skipped if it is also the last point of the previous region
+        {
+            auto const x = x0 + dx*i;
+            xpoints.push_back(x);
+            ypoints.push_back(J0points[i]);
+            slopes.push_back(x == 0.0 ? 0.0 : J1points[i]/x);
+        }
+    }
+
+    /// The points where \eq{J_0(x)} and \eq{J_1(x)} have been tabulated.
+    Vec<double> xpoints;
+
+    /// The values of \eq{J_0(x)} at the tabulated points.
+    Vec<double> ypoints;
 
-    if(0.0 <= x && x <= 1.0) return interpolate(x, 0.0, 1.0, J1region1);
-    if(1.0 <= x && x <= 10.0) return interpolate(x, 1.0, 10.0, J1region2);
-    if(10.0 <= x && x <= 100.0) return interpolate(x, 10.0, 100.0, J1region3);
-    if(100.0 <= x && x <= 1000.0) return interpolate(x, 100.0, 1000.0, J1region4);
-    if(1000.0 <= x && x <= 10000.0) return interpolate(x, 1000.0, 10000.0, J1region5);
+    /// The values of \eq{J_0^{\prime}(x)} at the tabulated points.
+    Vec<double> slopes;
 
-    return 0.25 * x; // for very large values of x, J1 -> x/4
+    /// The coefficients of the cubic polynomial in each interval between two consecutive tabulated points.
+    Vec<Array<double, 4>> coeffs;
+};
+
+/// Return the values of the Pitzer functions \eq{J_0(x)} and \eq{J_1(x)} at given \eq{x} using the precomputed table of cubic splines.
+auto computeJ0J1(real const& x) -> Pair<real, real>
+{
+    static const PitzerJTable table;
+    return table.evaluate(x);
 }
 
 /// Auxiliary alias for ActivityModelParamsPitzer::CorrectionModel.
@@ -210,22 +255,23 @@ using PitzerParamCorrectionModel = ActivityModelParamsPitzer::CorrectionModel;
 /// Return the Pitzer temperature-pressure correction model based on constant expression.
 auto createParamCorrectionModelConstant(Vec<Param> const& coefficients) -> Fn<real(real const&, real const&)>
 {
-    auto const& c = coefficients;
+    errorif(coefficients.size() == 0, "Cannot create the Constant temperature-dependent Pitzer parameter function with empty coefficients");
 
-    errorif(c.size() == 0, "Cannot create the Constant temperature-dependent Pitzer parameter function with empty coefficients");
+    const ParamArena c(coefficients); // the coefficients are read from contiguous memory in the evaluations below
 
     return [=](real const& T, real const& Pbar) { return c[0]; };
 
-    errorif(true, "Cannot create the Constant temperature-dependent Pitzer parameter function with given coefficients (which should be only one): ", str(c));
+    errorif(true, "Cannot create the Constant temperature-dependent Pitzer parameter function with given coefficients (which should be only one): ", str(coefficients));
 }
 
 /// Return the Pitzer temperature-pressure correction model based on expression provided by PHREEQC v3.
 auto createParamCorrectionModelPhreeqc(Vec<Param> const& coefficients) -> Fn<real(real const&, real const&)>
 {
-    auto const& c = coefficients;
     auto const Tr = 298.15;
 
-    errorif(c.size() == 0, "Cannot create the Phreeqc temperature-dependent Pitzer parameter function with empty coefficients");
+    errorif(coefficients.size() == 0, "Cannot create the Phreeqc temperature-dependent Pitzer parameter function with empty coefficients");
+
+    const ParamArena c(coefficients); // the coefficients are read from contiguous memory in the evaluations below
 
     if(c.size() == 1) return [=](real const& T, real const& Pbar) { return c[0]; };
     if(c.size() == 2) return [=](real const& T, real const& Pbar) { return c[0] + c[1]*(1.0/T - 1.0/Tr); };
@@ -234,7 +280,7 @@ auto createParamCorrectionModelPhreeqc(Vec<Param> const& coefficients) -> Fn<rea
     if(c.size() == 5) return [=](real const& T, real const& Pbar) { return c[0] + c[1]*(1.0/T - 1.0/Tr) + c[2]*log(T/Tr) + c[3]*(T - Tr) + c[4]*(T*T - Tr*Tr); };
     if(c.size() == 6) return [=](real const& T, real const& Pbar) { return c[0] + c[1]*(1.0/T - 1.0/Tr) + c[2]*log(T/Tr) + c[3]*(T - Tr) + c[4]*(T*T - Tr*Tr) + c[5]*(1.0/(T*T) - 1.0/(Tr*Tr)); };
 
-    errorif(true, "Cannot create the Phreeqc temperature-dependent Pitzer parameter function with given coefficients: ", str(c));
+    errorif(true, "Cannot create the Phreeqc temperature-dependent Pitzer parameter function with given coefficients: ", str(coefficients));
 }
 
 /// Return the Pitzer temperature-pressure correction model based on expression provided by He and Morse (1993) (doi: 10.1016/0016-7037(93)90137-L).
@@ -319,15 +365,6 @@ struct PitzerParam
 
     /// The temperature-pressure correction model for the interaction parameter.
     const Fn<real(real const&, real const&)> model;
-
-    /// The current value of the interaction parameter since last update.
-    real value;
-
-    /// Update the current value of the interaction parameter.
-    auto update(real const& T, real const& P)
-    {
-        value = model(T, P);
-    }
 };
 
 /// Auxiliary alias for ActivityModelParamsPitzer::InteractionParamAttribs.
@@ -586,22 +623,11 @@ auto computeJ0J1PHREEQC(real const& X) -> Tuple<real, real>
 }
 
 /// The function that computes electrostatic mixing effects of unsymmetrical cation-cation and anion-anion pairs \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)}.
-auto computeThetaValuesInterpolation(real const& I, real const& sqrtI, real const& Aphi, double zi, double zj) -> Pair<real, real>
+/// The values of \eq{J_0(x)} and \eq{J_1(x)} given here are evaluated at
+/// \eq{x_{ij}}, \eq{x_{ii}} and \eq{x_{jj}}, where \eq{x_{ij} =
+/// 6z_iz_jA^{\phi}\sqrt{I}}.
+auto computeThetaValues(real const& I, double zi, double zj, real const& J0ij, real const& J0ii, real const& J0jj, real const& J1ij, real const& J1ii, real const& J1jj) -> Pair<real, real>
 {
-    auto const aux = 6.0*Aphi*sqrtI;
-
-    auto const xij = zi*zj*aux;
-    auto const xii = zi*zi*aux;
-    auto const xjj = zj*zj*aux;
-
-    auto const J0ij = J0(xij);
-    auto const J0ii = J0(xii);
-    auto const J0jj = J0(xjj);
-
-    auto const J1ij = J1(xij);
-    auto const J1ii = J1(xii);
-    auto const J1jj = J1(xjj);
-
     auto const thetaE = zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
     auto const thetaEP = zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaE/I;
 
@@ -621,10 +647,7 @@ auto computeThetaValuesPHREEQC(real const& I, real const& sqrtI, real const& Aph
     auto const [J0ii, J1ii] = computeJ0J1PHREEQC(xii);
     auto const [J0jj, J1jj] = computeJ0J1PHREEQC(xjj);
 
-    auto const thetaE = zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
-    auto const thetaEP = zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaE/I;
-
-    return { thetaE, thetaEP };
+    return computeThetaValues(I, zi, zj, J0ij, J0ii, J0jj, J1ij, J1ii, J1jj);
 }
 
 /// The auxiliary type used to store computed values from the Pitzer activity model implemented by @ref Pitzer.
@@ -635,35 +658,83 @@ struct PitzerState
     ArrayXr ln_gamma; ///< The activity coefficients of the aqueous species (natural log).
 };
 
-/// The auxiliary type used to implement the Pitzer activity model.
-struct PitzerModel
+/// Used to store the interaction parameters of a same kind in the Pitzer activity model in a contiguous layout.
+/// The indices of the species in the interactions and the current values of
+/// the interaction parameters are stored in separate contiguous arrays, so
+/// that the sums over all interactions of this kind in the Pitzer model can
+/// be performed in tight loops.
+template<Index N>
+struct PitzerParamGroup
 {
-    AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
+    /// The indices of the species in the interactions, with `ispecies[k][i]` being the `k`-th species in the `i`-th interaction.
+    Array<Indices, N> ispecies;
 
-    Vec<PitzerParam> beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
-    Vec<PitzerParam> psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
-    Vec<PitzerParam> lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
-    Vec<PitzerParam> zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
-    Vec<PitzerParam> mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
-    Vec<PitzerParam> eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+    /// The temperature-pressure correction models of the interaction parameters.
+    Vec<Fn<real(real const&, real const&)>> models;
 
-    Vec<Param> alpha1; ///< The parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
-    Vec<Param> alpha2; ///< The parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    /// The current values of the interaction parameters since last update.
+    ArrayXr values;
 
-    using Tuples2i = Tuples<Index, Index>;                   ///< Auxiliary type for a tuple of 2 index values.
-    using Tuples3d = Tuples<double, double, double>;         ///< Auxiliary type for a tuple of 3 double values.
-    using Tuples4d = Tuples<double, double, double, double>; ///< Auxiliary type for a tuple of 4 double values.
+    /// Return the number of interactions in this group.
+    auto size() const -> Index
+    {
+        return models.size();
+    }
 
-    Tuples3d lambda_coeffs; ///< The coefficients multiplying the terms where the lambda Pitzer parameter is involved.
-    Tuples4d mu_coeffs;     ///< The coefficients multiplying the terms where the mu Pitzer parameter is involved.
+    /// Append an interaction parameter to this group.
+    auto add(PitzerParam const& param)
+    {
+        for(auto k = 0; k < N; ++k)
+            ispecies[k].push_back(param.ispecies[k]);
+        models.push_back(param.model);
+    }
 
-    Tuples2i thetaij; ///< The indices (i, j) of the cation-cation and anion-anion species pairs used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
-    ArrayXr thetaE;   ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} associated to the \eq{\theta_{ij}} parameters.
-    ArrayXr thetaEP;  ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} associated to the \eq{\theta_{ij}} parameters.
+    /// Update the current values of the interaction parameters.
+    auto update(real const& T, real const& Pbar)
+    {
+        values.resize(models.size());
+        for(auto i = 0; i < models.size(); ++i)
+            values[i] = models[i](T, Pbar);
+    }
+};
+
+/// The auxiliary type used to implement the Pitzer activity model.
+struct PitzerModel
+{
+    AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
+
+    PitzerParamGroup<2> beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup<2> beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup<2> beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup<2> Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup<2> theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
+    PitzerParamGroup<3> psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
+    PitzerParamGroup<2> lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
+    PitzerParamGroup<3> zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
+    PitzerParamGroup<3> mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
+    PitzerParamGroup<3> eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+
+    ParamArena alpha1; ///< The parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    ParamArena alpha2; ///< The parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(2)}_{ij}}.
+
+    ArrayXd Cphi_factors;   ///< The factors \eq{1/(2\sqrt{|z_iz_j|})} multiplying the parameters \eq{C^{\phi}_{ij}}.
+    ArrayXXd lambda_coeffs; ///< The coefficients multiplying the terms where the lambda Pitzer parameter is involved (one column per lambda parameter).
+    ArrayXXd mu_coeffs;     ///< The coefficients multiplying the terms where the mu Pitzer parameter is involved (one column per mu parameter).
+
+    Array<Indices, 2> thetaij; ///< The indices (i, j) of the cation-cation and anion-anion species pairs used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
+    Indices thetaij_charges;   ///< The indices in #thetaE_charges of the charges of the species in each pair in #thetaij.
+    Pairs<double, double> thetaE_charges; ///< The unique pairs of species charges among the species pairs in #thetaij, for which \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} are evaluated.
+    Vec<double> thetaE_zproducts; ///< The unique products of charges \eq{z_iz_j}, \eq{z_iz_i} and \eq{z_jz_j} among the pairs of charges in #thetaE_charges, for which \eq{J_0(x)} and \eq{J_1(x)} are evaluated.
+    Vec<Array<Index, 3>> thetaE_zproducts_indices; ///< The indices in #thetaE_zproducts of the products \eq{z_iz_j}, \eq{z_iz_i} and \eq{z_jz_j} for each pair of charges in #thetaE_charges.
+    ArrayXr J0values; ///< The current values of \eq{J_0(x)} for each product of charges in #thetaE_zproducts.
+    ArrayXr J1values; ///< The current values of \eq{J_1(x)} for each product of charges in #thetaE_zproducts.
+    ArrayXr thetaE;  ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} for each pair of charges in #thetaE_charges.
+    ArrayXr thetaEP; ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} for each pair of charges in #thetaE_charges.
+
+    ParamArena coefficients; ///< The coefficients in the temperature-pressure correction models of all interaction parameters above.
+    Vec<real> lastcoeffs;    ///< The values of the coefficients in the correction models used in the last update of the interaction parameters.
+    real lastT = NaN;        ///< The temperature used in the last update of the interaction parameters.
+    real lastP = NaN;        ///< The pressure used in the last update of the interaction parameters.
 
     Fn<real(real const&, real const&)> Aphi; ///< The function that computes the Debye-huckel parameter \eq{A^\phi(T, P)} in the Pitzer model.
 
@@ -676,78 +747,98 @@ struct PitzerModel
     PitzerModel(AqueousMixture const& solution, ActivityModelParamsPitzer const& params)
     : solution(solution)
     {
-        for(auto const& entry : params.beta0)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta0.push_back(param);
-
-        for(auto const& entry : params.beta1)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta1.push_back(param);
-
-        for(auto const& entry : params.beta2)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta2.push_back(param);
+        Vec<Param> coeffs;
+        Vec<Param> alpha1params;
+        Vec<Param> alpha2params;
 
-        for(auto const& entry : params.Cphi)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                Cphi.push_back(param);
-
-        for(auto const& entry : params.theta)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                theta.push_back(param);
+        auto addParams = [&](auto& group, auto const& entries, auto const& createfn, auto const& onaddfn)
+        {
+            for(auto const& entry : entries)
+                if(PitzerParam param = createfn(solution.species(), entry); !param.ispecies.empty())
+                {
+                    group.add(param);
+                    coeffs.insert(coeffs.end(), entry.parameters.begin(), entry.parameters.end());
+                    onaddfn(entry);
+                }
+        };
 
-        for(auto const& entry : params.psi)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                psi.push_back(param);
+        auto const noop = [](auto const&) {};
 
-        for(auto const& entry : params.lambda)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                lambda.push_back(param);
+        addParams(beta0, params.beta0, createPitzerParamBinary, noop);
+        addParams(beta1, params.beta1, createPitzerParamBinary, [&](auto const& entry) { alpha1params.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1)); });
+        addParams(beta2, params.beta2, createPitzerParamBinary, [&](auto const& entry) { alpha2params.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2)); });
+        addParams(Cphi, params.Cphi, createPitzerParamBinary, noop);
+        addParams(theta, params.theta, createPitzerParamBinary, noop);
+        addParams(psi, params.psi, createPitzerParamTernary, noop);
+        addParams(lambda, params.lambda, createPitzerParamBinary, noop);
+        addParams(zeta, params.zeta, createPitzerParamTernary, noop);
+        addParams(mu, params.mu, createPitzerParamTernary, noop);
+        addParams(eta, params.eta, createPitzerParamTernary, noop);
 
-        for(auto const& entry : params.zeta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                zeta.push_back(param);
+        alpha1 = ParamArena(alpha1params);
+        alpha2 = ParamArena(alpha2params);
 
-        for(auto const& entry : params.mu)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                mu.push_back(param);
+        coeffs.insert(coeffs.end(), alpha1params.begin(), alpha1params.end());
+        coeffs.insert(coeffs.end(), alpha2params.begin(), alpha2params.end());
 
-        for(auto const& entry : params.eta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                eta.push_back(param);
+        coefficients = ParamArena(coeffs);
 
-        for(auto const& entry : params.beta1)
-            alpha1.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1));
+        auto const& z = solution.charges();
 
-        for(auto const& entry : params.beta2)
-            alpha2.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2));
+        Cphi_factors.resize(Cphi.size());
+        for(auto i = 0; i < Cphi.size(); ++i)
+            Cphi_factors[i] = 1.0 / (2.0 * std::sqrt(std::abs(z[Cphi.ispecies[0][i]] * z[Cphi.ispecies[1][i]])));
 
         auto const& ications = solution.indicesCations();
         auto const& ianions = solution.indicesAnions();
 
+        auto addThetaPair = [&](Index i, Index j)
+        {
+            thetaij[0].push_back(i);
+            thetaij[1].push_back(j);
+            auto const charges = std::make_pair(z[i], z[j]);
+            auto const k = index(thetaE_charges, charges);
+            if(k == thetaE_charges.size())
+                thetaE_charges.push_back(charges);
+            thetaij_charges.push_back(k);
+        };
+
         for(auto i = 0; i < ications.size() - 1; ++i)
             for(auto j = i + 1; j < ications.size(); ++j)
-                thetaij.emplace_back(ications[i], ications[j]);
+                addThetaPair(ications[i], ications[j]);
 
         for(auto i = 0; i < ianions.size() - 1; ++i)
             for(auto j = i + 1; j < ianions.size(); ++j)
-                thetaij.emplace_back(ianions[i], ianions[j]);
+                addThetaPair(ianions[i], ianions[j]);
 
-        auto const& z = solution.charges();
+        auto indexZProduct = [&](double zproduct) -> Index
+        {
+            auto const k = index(thetaE_zproducts, zproduct);
+            if(k == thetaE_zproducts.size())
+                thetaE_zproducts.push_back(zproduct);
+            return k;
+        };
+
+        for(auto const& [zi, zj] : thetaE_charges)
+            thetaE_zproducts_indices.push_back({ indexZProduct(zi*zj), indexZProduct(zi*zi), indexZProduct(zj*zj) });
 
-        for(auto const& entry : lambda)
+        lambda_coeffs.resize(3, lambda.size());
+        for(auto i = 0; i < lambda.size(); ++i)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            lambda_coeffs.push_back(determineLambdaCoeffs(z[i1], z[i2], i1, i2));
+            auto const i1 = lambda.ispecies[0][i];
+            auto const i2 = lambda.ispecies[1][i];
+            auto const [clng0, clng1, cosm] = determineLambdaCoeffs(z[i1], z[i2], i1, i2);
+            lambda_coeffs.col(i) << clng0, clng1, cosm;
         }
 
-        for(auto const& entry : mu)
+        mu_coeffs.resize(4, mu.size());
+        for(auto i = 0; i < mu.size(); ++i)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            auto const i3 = entry.ispecies[2];
-            mu_coeffs.push_back(determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3));
+            auto const i1 = mu.ispecies[0][i];
+            auto const i2 = mu.ispecies[1][i];
+            auto const i3 = mu.ispecies[2][i];
+            auto const [clng0, clng1, clng2, cosm] = determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3);
+            mu_coeffs.col(i) << clng0, clng1, clng2, cosm;
         }
 
         // Define the function Aphi(T, P) according to PHREEQC (see method calc_dielectrics at utilities.cpp for computing A0)
@@ -766,44 +857,93 @@ struct PitzerModel
         Aphi = memoizeLast(Aphi); // memoize so that subsequent repeated calls with same (T, P) return cached result.
     }
 
+    /// Return true if temperature, pressure or the coefficients in the correction models have changed since the last update of the interaction parameters.
+    auto changed(real const& T, real const& P) -> bool
+    {
+        if(!identical(T, lastT) || !identical(P, lastP))
+            return true;
+        for(auto i = 0; i < lastcoeffs.size(); ++i)
+            if(!identical(coefficients[i], lastcoeffs[i]))
+                return true;
+        return false;
+    }
+
     /// Update all Pitzer interaction parameters according to current temperature and pressure.
     auto updateParams(real const& T, real const& P)
     {
-        // Note: Do not try to avoid the calculations before in case T and P is
-        // the same as last time because T and P could be the same but the Param
-        // objects in these models could be changing!
+        // Note: The interaction parameters are only evaluated again if T or P
+        // have changed, or if the Param objects in the correction models have
+        // changed (e.g., in a parameter fitting calculation) since last time.
+        if(!changed(T, P))
+            return;
 
         auto const Pbar = P * 1e-5; // from Pa to bar
 
-        for(auto& param : beta0)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta1)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta2)
-            param.value = param.model(T, Pbar);
+        beta0.update(T, Pbar);
+        beta1.update(T, Pbar);
+        beta2.update(T, Pbar);
+        Cphi.update(T, Pbar);
+        theta.update(T, Pbar);
+        psi.update(T, Pbar);
+        lambda.update(T, Pbar);
+        zeta.update(T, Pbar);
+        mu.update(T, Pbar);
+        eta.update(T, Pbar);
+
+        lastT = T;
+        lastP = P;
+        lastcoeffs = coefficients.values();
+    }
 
-        for(auto& param : Cphi)
-            param.value = param.model(T, Pbar);
+    /// Add the contributions of a group of binary interaction parameters whose terms are \eq{2m_j\beta_{ij}} and \eq{m_im_j\beta_{ij}} in the activity coefficients and osmotic coefficient respectively.
+    static auto addBinaryTerms(PitzerParamGroup<2> const& group, ArrayXrConstRef M, ArrayXrRef LGAMMA, real& OSMOT)
+    {
+        auto const& i0 = group.ispecies[0];
+        auto const& i1 = group.ispecies[1];
+        auto const& v = group.values;
 
-        for(auto& param : theta)
-            param.value = param.model(T, Pbar);
+        for(auto i = 0; i < group.size(); ++i)
+        {
+            LGAMMA[i0[i]] += 2.0 * M[i1[i]] * v[i];
+            LGAMMA[i1[i]] += 2.0 * M[i0[i]] * v[i];
+            OSMOT += M[i0[i]] * M[i1[i]] * v[i];
+        }
+    }
 
-        for(auto& param : psi)
-            param.value = param.model(T, Pbar);
+    /// Add the contributions of a group of binary interaction parameters whose terms depend on the ionic strength via the parameters `alpha`.
+    static auto addBinaryTermsWithAlpha(PitzerParamGroup<2> const& group, ParamArena const& alpha, real const& I, real const& DI, ArrayXrConstRef M, ArrayXrRef LGAMMA, real& OSMOT, real& F)
+    {
+        auto const& i0 = group.ispecies[0];
+        auto const& i1 = group.ispecies[1];
+        auto const& v = group.values;
 
-        for(auto& param : lambda)
-            param.value = param.model(T, Pbar);
+        for(auto i = 0; i < group.size(); ++i)
+        {
+            auto const x = alpha[i] * DI;
+            auto const g = G(x);
 
-        for(auto& param : zeta)
-            param.value = param.model(T, Pbar);
+            F += M[i0[i]] * M[i1[i]] * v[i] * GP(x)/I;
+            LGAMMA[i0[i]] += M[i1[i]] * 2.0 * v[i] * g;
+            LGAMMA[i1[i]] += M[i0[i]] * 2.0 * v[i] * g;
+            OSMOT += M[i0[i]] * M[i1[i]] * v[i] * exp(-x);
+        }
+    }
 
-        for(auto& param : mu)
-            param.value = param.model(T, Pbar);
+    /// Add the contributions of a group of ternary interaction parameters whose terms are \eq{m_jm_k\psi_{ijk}} and \eq{m_im_jm_k\psi_{ijk}} in the activity coefficients and osmotic coefficient respectively.
+    static auto addTernaryTerms(PitzerParamGroup<3> const& group, ArrayXrConstRef M, ArrayXrRef LGAMMA, real& OSMOT)
+    {
+        auto const& i0 = group.ispecies[0];
+        auto const& i1 = group.ispecies[1];
+        auto const& i2 = group.ispecies[2];
+        auto const& v = group.values;
 
-        for(auto& param : eta)
-            param.value = param.model(T, Pbar);
+        for(auto i = 0; i < group.size(); ++i)
+        {
+            LGAMMA[i0[i]] += M[i1[i]] * M[i2[i]] * v[i];
+            LGAMMA[i1[i]] += M[i0[i]] * M[i2[i]] * v[i];
+            LGAMMA[i2[i]] += M[i0[i]] * M[i1[i]] * v[i];
+            OSMOT += M[i0[i]] * M[i1[i]] * M[i2[i]] * v[i];
+        }
     }
 
     /// Evaluate the Pitzer model and compute the properties of the aqueous solution.
@@ -850,64 +990,50 @@ struct PitzerModel
         // The osmotic coefficient of water in the Pitzer model
         OSMOT = -Aphi0*I*DI/(1 + B*DI);
 
-        for(auto const& param : beta0)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += M[i1] * 2.0 * param.value;
-            LGAMMA[i1] += M[i0] * 2.0 * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
-        }
+        addBinaryTerms(beta0, M, LGAMMA, OSMOT);
 
-        for(auto const& [i, param] : enumerate(beta1))
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+        addBinaryTermsWithAlpha(beta1, alpha1, I, DI, M, LGAMMA, OSMOT, F);
 
-            F += M[i0] * M[i1] * param.value * GP(alpha1[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha1[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha1[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha1[i] * DI);
-        }
+        addBinaryTermsWithAlpha(beta2, alpha2, I, DI, M, LGAMMA, OSMOT, F);
 
-        for(auto const& [i, param] : enumerate(beta2))
+        for(auto i = 0; i < Cphi.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = Cphi.ispecies[0][i];
+            auto const i1 = Cphi.ispecies[1][i];
 
-            F += M[i0] * M[i1] * param.value * GP(alpha2[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha2[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha2[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha2[i] * DI);
-        }
+            auto const value = Cphi.values[i] * Cphi_factors[i];
 
-        for(auto const& param : Cphi)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            CSUM += M[i0] * M[i1] * value;
+            LGAMMA[i0] += M[i1] * BIGZ * value;
+            LGAMMA[i1] += M[i0] * BIGZ * value;
+            OSMOT += M[i0] * M[i1] * BIGZ * value;
+        }
 
-            auto const aux = 2.0 * sqrt(abs(z[i0] * z[i1]));
+        addBinaryTerms(theta, M, LGAMMA, OSMOT);
 
-            CSUM += M[i0] * M[i1] * param.value/aux;
-            LGAMMA[i0] += M[i1] * BIGZ * param.value/aux;
-            LGAMMA[i1] += M[i0] * BIGZ * param.value/aux;
-            OSMOT += M[i0] * M[i1] * BIGZ * param.value/aux;
-        }
+        // Evaluate J0(x) and J1(x) only once for each unique product of charges, where x = 6*zi*zj*Aphi*sqrt(I)
+        J0values.resize(thetaE_zproducts.size());
+        J1values.resize(thetaE_zproducts.size());
+        for(auto k = 0; k < thetaE_zproducts.size(); ++k)
+            std::tie(J0values[k], J1values[k]) = computeJ0J1(6.0 * thetaE_zproducts[k] * Aphi0 * DI);
 
-        for(auto const& param : theta)
+        // Evaluate the E-theta terms only once for each unique pair of charges among the pairs of species in thetaij
+        thetaE.resize(thetaE_charges.size());
+        thetaEP.resize(thetaE_charges.size());
+        for(auto k = 0; k < thetaE_charges.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += 2.0 * M[i1] * param.value;
-            LGAMMA[i1] += 2.0 * M[i0] * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            auto const [zi, zj] = thetaE_charges[k];
+            auto const [ij, ii, jj] = thetaE_zproducts_indices[k];
+            std::tie(thetaE[k], thetaEP[k]) = computeThetaValues(I, zi, zj, J0values[ij], J0values[ii], J0values[jj], J1values[ij], J1values[ii], J1values[jj]);
         }
 
-        for(auto const& [i0, i1] : thetaij)
+        for(auto i = 0; i < thetaij_charges.size(); ++i)
         {
-            auto const [etheta, ethetap] = computeThetaValuesInterpolation(I, DI, Aphi0, z[i0], z[i1]);
+            auto const i0 = thetaij[0][i];
+            auto const i1 = thetaij[1][i];
+
+            auto const& etheta = thetaE[thetaij_charges[i]];
+            auto const& ethetap = thetaEP[thetaij_charges[i]];
 
             F += M[i0] * M[i1] * ethetap;
             LGAMMA[i0] += 2.0 * M[i1] * etheta;
@@ -915,67 +1041,37 @@ struct PitzerModel
             OSMOT += M[i0] * M[i1] * (etheta + I*ethetap);
         }
 
-        for(auto const& param : psi)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
-        }
+        addTernaryTerms(psi, M, LGAMMA, OSMOT);
 
-        for(auto const& [i, param] : enumerate(lambda))
+        for(auto i = 0; i < lambda.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = lambda.ispecies[0][i];
+            auto const i1 = lambda.ispecies[1][i];
 
-            auto const [clng0, clng1, cosm] = lambda_coeffs[i];
+            auto const& value = lambda.values[i];
 
-            LGAMMA[i0] += M[i1] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * param.value * clng1;
-            OSMOT += M[i0] * M[i1] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * value * lambda_coeffs(0, i);
+            LGAMMA[i1] += M[i0] * value * lambda_coeffs(1, i);
+            OSMOT += M[i0] * M[i1] * value * lambda_coeffs(2, i);
         }
 
-        for(auto const& param : zeta)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
-        }
+        addTernaryTerms(zeta, M, LGAMMA, OSMOT);
 
-        for(auto const& [i, param] : enumerate(mu))
+        for(auto i = 0; i < mu.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
+            auto const i0 = mu.ispecies[0][i];
+            auto const i1 = mu.ispecies[1][i];
+            auto const i2 = mu.ispecies[2][i];
 
-            auto const [clng0, clng1, clng2, cosm] = mu_coeffs[i];
+            auto const& value = mu.values[i];
 
-            LGAMMA[i0] += M[i1] * M[i2] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value * clng1;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value * clng2;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * M[i2] * value * mu_coeffs(0, i);
+            LGAMMA[i1] += M[i0] * M[i2] * value * mu_coeffs(1, i);
+            LGAMMA[i2] += M[i0] * M[i1] * value * mu_coeffs(2, i);
+            OSMOT += M[i0] * M[i1] * M[i2] * value * mu_coeffs(3, i);
         }
 
-        for(auto const& param : eta)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
-        }
+        addTernaryTerms(eta, M, LGAMMA, OSMOT);
 
         // Finalise the calculation of the activity coefficient by adding the missing F and CSUM contributions
         for(auto i : icharged)
@@ -1015,7 +1111,8 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
         auto const& [T, P, x] = args;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        solution.updateState(*aqstateptr, T, P, x);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
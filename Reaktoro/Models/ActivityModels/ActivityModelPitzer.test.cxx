@@ -19,9 +19,11 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPitzer.hpp>
+#include <Reaktoro/Serialization/Models/ActivityModels.hpp>
 #include <Reaktoro/Singletons/Elements.hpp>
 using namespace Reaktoro;
 
@@ -652,7 +654,7 @@ TEST_CASE("Testing ActivityModelPitzer", "[ActivityModelPitzer]")
         CHECK( props.ln_g[14]/ln10 == Approx(-0.179597000) ); // Cl- (PHREEQC: -0.17953, difference: 3.73e-02 %)
         CHECK( props.ln_g[15]/ln10 == Approx(-1.625790000) ); // Fe+2 (PHREEQC: -1.62439, difference: 8.62e-02 %)
         CHECK( props.ln_g[16]/ln10 == Approx( 0.317079000) ); // K+ (PHREEQC:  0.31740, difference: 1.01e-01 %)
-        CHECK( props.ln_g[17]/ln10 == Approx( 0.007083930) ); // Li+ (PHREEQC:  0.00742, difference: 4.52e+00 %)
+        CHECK( props.ln_g[17]/ln10 == Approx( 0.007084410) ); // Li+ (PHREEQC:  0.00742, difference: 4.52e+00 %)
         CHECK( props.ln_g[18]/ln10 == Approx(-1.064450000) ); // MgOH+ (PHREEQC: -1.06406, difference: 3.67e-02 %)
         CHECK( props.ln_g[19]/ln10 == Approx(-1.087900000) ); // Mg+2 (PHREEQC: -1.08652, difference: 1.27e-01 %)
         CHECK( props.ln_g[20]/ln10 == Approx( 0.000000000) ); // MgCO3 (PHREEQC:  0.00000, difference: -- %)
@@ -792,4 +794,61 @@ TEST_CASE("Testing ActivityModelPitzer", "[ActivityModelPitzer]")
         CHECK( props.ln_g[31]/ln10 == Approx( 0.239383000) ); // H4SiO4 (PHREEQC:  0.23937, difference: 5.43e-03 %)
         CHECK( props.ln_g[32]/ln10 == Approx(-1.906930000) ); // Sr+2 (PHREEQC: -1.90518, difference: 9.19e-02 %)
     }
+    WHEN("temperature and interaction parameters change between evaluations")
+    {
+        const auto species = SpeciesList("OH- H+ H2O Cl- Na+");
+
+        const auto T1 = 25.0 + 273.15;
+        const auto T2 = 60.0 + 273.15;
+        const auto P = 1.0e+5;
+
+        const auto n = ArrayXr{{
+            1.38935e-07, // OH-
+            1.38935e-07, // H+
+            5.55062e+01, // H2O
+            4.00000e+00, // Cl-
+            4.00000e+00, // Na+
+        }};
+
+        const auto x = n / n.sum();
+
+        auto pzparams = Params::embedded("Pitzer.json").data()["ActivityModelParams"]["Pitzer"].as<ActivityModelParamsPitzer>();
+
+        // Construct the activity props function that is evaluated repeatedly below.
+        ActivityModel fn = ActivityModelPitzer(pzparams)(species);
+
+        // Return the activity coefficients computed with an activity props function created anew.
+        auto expected = [&](real const& T) -> ArrayXr
+        {
+            ActivityModel fresh = ActivityModelPitzer(pzparams)(species);
+            ActivityProps props = ActivityProps::create(species.size());
+            fresh(props, {T, P, x});
+            return props.ln_g;
+        };
+
+        ActivityProps props = ActivityProps::create(species.size());
+
+        fn(props, {T1, P, x});
+        const ArrayXr ln_g1 = props.ln_g;
+
+        fn(props, {T2, P, x});
+        CHECK( props.ln_g.isApprox(expected(T2)) );
+
+        fn(props, {T1, P, x});
+        CHECK( props.ln_g.isApprox(ln_g1) );
+
+        // Change the first beta0 parameter (at 25 °C) of the Na+ and Cl- interaction
+        auto const ibeta0 = indexfn(pzparams.beta0, RKT_LAMBDA(entry,
+            contains(entry.formulas, ChemicalFormula("Na+")) &&
+            contains(entry.formulas, ChemicalFormula("Cl-"))));
+
+        REQUIRE( ibeta0 < pzparams.beta0.size() );
+
+        auto& param = pzparams.beta0[ibeta0].parameters[0];
+        param = param.value() + 0.1;
+
+        fn(props, {T1, P, x});
+        CHECK( !props.ln_g.isApprox(ln_g1) );
+        CHECK( props.ln_g.isApprox(expected(T1)) );
+    }
 }
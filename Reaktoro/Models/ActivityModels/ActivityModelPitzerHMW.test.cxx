@@ -23,71 +23,67 @@
 #include <Reaktoro/Water/WaterConstants.hpp>
 using namespace Reaktoro;
 
-// /// Return mole fractions for the species.
-// inline auto moleFractions(const SpeciesList& species) -> ArrayXr
-// {
-//     auto idx = [&](auto formula) { return species.indexWithFormula(formula); };
-
-//     ArrayXr n(species.size());
-//     n = 0.1;
-//     n[idx("H2O")] = 55.508;
-//     n[idx("H+" )] = 1e-7;
-//     n[idx("OH-")] = 1e-7;
-//     n[idx("Na+")] = 0.3;
-//     n[idx("Cl-")] = 0.3;
-
-//     return n / n.sum();
-// }
-
-// // Check if the activities of the aqueous species are correct assuming activity coefficients are.
-// inline auto checkActivities(ArrayXrConstRef x, ActivityPropsConstRef props)
-// {
-//     const auto iH2O = 0;
-
-//     // The concentrations of the species (molalities for solutes, mole fraction for solvent water)
-//     ArrayXr c = x/(x[iH2O] * waterMolarMass);
-//     c[iH2O] = x[iH2O];
-
-//     for(auto i = 0; i < x.size(); ++i)
-//     {
-//         INFO("i = " << i);
-//         CHECK( exp(props.ln_a[i] - props.ln_g[i]) == Approx(c[i]) );
-//     }
-// }
-
 TEST_CASE("Testing ActivityModelPitzerHMW", "[ActivityModelPitzerHMW]")
 {
-    //-------------------------------------------------------------------
-    // ActivityModelPitzerHMW has been deprecated!
-    //-------------------------------------------------------------------
-
-    // const auto species = SpeciesList("H2O H+ OH- Na+ Cl- Ca++ HCO3- CO3-- CO2 NaCl HCl NaOH");
-
-    // const auto T = 300.0;
-    // const auto P = 12.3e5;
-    // const auto x = moleFractions(species);
-
-    // // Construct the activity props function with the given aqueous species.
-    // ActivityModel fn = ActivityModelPitzerHMW()(species);
-
-    // // Create the ActivityProps object with the results.
-    // ActivityProps props = ActivityProps::create(species.size());
-
-    // // Evaluate the activity props function
-    // fn(props, {T, P, x});
-
-    // CHECK( exp(props.ln_g[0])  == Approx(1.0024963429) ); // H2O
-    // CHECK( exp(props.ln_g[1])  == Approx(0.6153629865) ); // H+
-    // CHECK( exp(props.ln_g[2])  == Approx(0.5225985571) ); // OH-
-    // CHECK( exp(props.ln_g[3])  == Approx(0.6404881090) ); // Na+
-    // CHECK( exp(props.ln_g[4])  == Approx(0.6607357243) ); // Cl-
-    // CHECK( exp(props.ln_g[5])  == Approx(0.1577661672) ); // Ca++
-    // CHECK( exp(props.ln_g[6])  == Approx(0.6896785630) ); // HCO3-
-    // CHECK( exp(props.ln_g[7])  == Approx(0.0843383222) ); // CO3--
-    // CHECK( exp(props.ln_g[8])  == Approx(1.0882824499) ); // CO2
-    // CHECK( exp(props.ln_g[9])  == Approx(1.0000000000) ); // NaCl
-    // CHECK( exp(props.ln_g[10]) == Approx(1.0000000000) ); // HCl
-    // CHECK( exp(props.ln_g[11]) == Approx(1.0000000000) ); // NaOH
-
-    // checkActivities(x, props);
+    // An NaCl-CaSO4 brine with dissolved CO2 at 25 °C and 1 bar (1 molal NaCl, 0.02 molal CaSO4, 0.01 molal CO2)
+    const auto species = SpeciesList("H2O Na+ Cl- Ca++ SO4-- CO2");
+
+    const auto T = 25.0 + 273.15;
+    const auto P = 1.0e+5;
+
+    const auto n = ArrayXr{{
+        55.508, // H2O
+        1.0000, // Na+
+        1.0000, // Cl-
+        0.0200, // Ca++
+        0.0200, // SO4--
+        0.0100, // CO2
+    }};
+
+    const auto x = n / n.sum();
+
+    // Construct the activity props function with the given aqueous species.
+    ActivityModel fn = ActivityModelPitzerHMW()(species);
+
+    // Create the ActivityProps object with the results.
+    ActivityProps props = ActivityProps::create(species.size());
+
+    // Evaluate the activity props function
+    fn(props, {T, P, x});
+
+    // The osmotic coefficient of the brine, since ln(aw) = -phi*Mw*sum(mi) and Mw*sum(mi) = (1 - xw)/xw
+    const auto phi = -props.ln_a[0] * x[0]/(1.0 - x[0]);
+
+    // The values below are the activity coefficients and osmotic coefficient
+    // computed with the implementation of the HMW model before it was ported
+    // to ActivityModelPitzer. The current values differ from them because:
+    //  * Aphi is computed from the water density and dielectric constant
+    //    used in PHREEQC (0.3914587) instead of the bilinear table of the
+    //    former implementation (0.3914728), a relative change of -3.6e-5
+    //    that changes ln(gamma) of the ions by about 1e-4 at most;
+    //  * J0(x) and J1(x) in the unsymmetrical mixing terms of Na+-Ca++ and
+    //    Cl--SO4-- are interpolated with cubic splines instead of taking the
+    //    tabulated value at the point below x, which accounts for most of the
+    //    difference in the divalent ions (about 0.6%) and about 7e-5 in the
+    //    monovalent ions;
+    //  * zeta(CO2, Na+, SO4--) now also contributes to ln(gamma) of Na+ and
+    //    SO4-- (by -3e-6 and -1.5e-4 here), and not only to that of CO2;
+    //  * ln(aw) is computed with the molar mass of water instead of the
+    //    molality of water, which made the former water activity wrong, so
+    //    the osmotic coefficient is compared here instead.
+    // These differences are within 2e-4 for Na+, Cl-, CO2 and phi, and within 1e-2 for Ca++ and SO4--.
+    CHECK( exp(props.ln_g[1]) == Approx(0.6471004113).epsilon(2e-4) ); // Na+
+    CHECK( exp(props.ln_g[2]) == Approx(0.6560225587).epsilon(2e-4) ); // Cl-
+    CHECK( exp(props.ln_g[3]) == Approx(0.2057084258).epsilon(1e-2) ); // Ca++
+    CHECK( exp(props.ln_g[4]) == Approx(0.0781939805).epsilon(1e-2) ); // SO4--
+    CHECK( exp(props.ln_g[5]) == Approx(1.1863736922).epsilon(2e-4) ); // CO2
+    CHECK( phi                == Approx(0.9308925267).epsilon(2e-4) ); // H2O
+
+    // The activities of the solutes are their molalities times their activity coefficients
+    const auto m = x/(x[0] * waterMolarMass);
+    for(auto i = 1; i < species.size(); ++i)
+    {
+        INFO("i = " << i);
+        CHECK( exp(props.ln_a[i] - props.ln_g[i]) == Approx(m[i]) );
+    }
 }
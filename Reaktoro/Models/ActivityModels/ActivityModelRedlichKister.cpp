@@ -62,6 +62,47 @@ auto ActivityModelRedlichKister(real a0, real a1, real a2) -> ActivityModelGener
     return model;
 }
 
+auto ActivityModelJacobianRedlichKister(real a0, real a1, real a2) -> ActivityModelJacobianGenerator
+{
+    const auto b0 = double(a0);
+    const auto b1 = double(a1);
+    const auto b2 = double(a2);
+
+    ActivityModelJacobianGenerator jacobian = [=](const SpeciesList& species)
+    {
+        error(species.size() != 2, "Cannot create the analytic derivatives of the Redlich-Kister model for the mineral phase. "
+            "The Redlich-Kister model requires a solid solution phase with exactly two species.");
+
+        ActivityModelJacobian fn = [=](MatrixXdRef J, ActivityModelArgs args, double nsum)
+        {
+            const auto x1 = double(args.x[0]);
+            const auto x2 = double(args.x[1]);
+
+            const auto h1 = b0 + b1*(3*x1 - x2) + b2*(x1 - x2)*(5*x1 - x2);
+            const auto h2 = b0 - b1*(3*x2 - x1) + b2*(x2 - x1)*(5*x2 - x1);
+
+            // The derivatives Dik = ∂(ln a[i])/∂x[k] taking x1 and x2 as independent variables
+            const auto D11 = x2*x2*(3*b1 + b2*(10*x1 - 6*x2)) + 1/x1;
+            const auto D12 = 2*x2*h1 + x2*x2*(-b1 + b2*(2*x2 - 6*x1));
+            const auto D21 = 2*x1*h2 + x1*x1*(b1 + b2*(2*x1 - 6*x2));
+            const auto D22 = x1*x1*(-3*b1 + b2*(10*x2 - 6*x1)) + 1/x2;
+
+            // From ∂x[k]/∂n[j] = (δkj - x[k])/nsum, J(i, j) = (Dij - Σk Dik*x[k])/nsum
+            const auto s1 = D11*x1 + D12*x2;
+            const auto s2 = D21*x1 + D22*x2;
+
+            J(0, 0) = (D11 - s1)/nsum;
+            J(0, 1) = (D12 - s1)/nsum;
+            J(1, 0) = (D21 - s2)/nsum;
+            J(1, 1) = (D22 - s2)/nsum;
+        };
+
+        return fn;
+    };
+
+    return jacobian;
+}
+
 
 } // namespace Reaktoro
 
@@ -37,4 +37,10 @@ namespace Reaktoro {
 /// @see ActivityModel
 auto ActivityModelRedlichKister(real a0, real a1, real a2) -> ActivityModelGenerator;
 
+/// Return the analytic derivatives of the ln activities of the end-members in the Redlich-Kister model with respect to their amounts.
+/// Use it together with @ref ActivityModelRedlichKister and the same parameters, e.g.,
+/// via GeneralPhase::setActivityModelJacobian after GeneralPhase::setActivityModel.
+/// @see ActivityModelRedlichKister, ActivityModelJacobian
+auto ActivityModelJacobianRedlichKister(real a0, real a1, real a2) -> ActivityModelJacobianGenerator;
+
 } // namespace Reaktoro
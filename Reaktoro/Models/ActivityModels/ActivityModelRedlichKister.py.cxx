@@ -25,4 +25,5 @@ using namespace Reaktoro;
 void exportActivityModelRedlichKister(py::module& m)
 {
     m.def("ActivityModelRedlichKister", ActivityModelRedlichKister);
+    m.def("ActivityModelJacobianRedlichKister", ActivityModelJacobianRedlichKister);
 }
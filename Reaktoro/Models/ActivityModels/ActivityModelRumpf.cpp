@@ -18,6 +18,7 @@
 #include "ActivityModelRumpf.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 
 namespace Reaktoro {
@@ -39,7 +40,10 @@ auto ActivityModelRumpf(String gas) -> ActivityModelGenerator
         const auto iMg  = aqmix.charged().findWithFormula("Mg++");
         const auto iCl  = aqmix.charged().findWithFormula("Cl-");
 
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        // The Pitzer's parameter B of the Rumpf et al. (1994) model at the temperature of the last evaluation
+        real B, lastT = NaN;
+
+        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
         {
             // Check AqueousMixture and AqueousMixtureState are available in props.extra
             auto mixtureit = props.extra.find("AqueousMixture");
@@ -56,7 +60,7 @@ auto ActivityModelRumpf(String gas) -> ActivityModelGenerator
             const auto nions = mixture.charged().size();
 
             // Extract temperature from the parameters
-            const auto T = state.T;
+            const auto& T = state.T;
 
             // The stoichiometric molalities of the ions in the aqueous mixture and their molar derivatives
             const auto& ms = state.ms;
@@ -68,8 +72,12 @@ auto ActivityModelRumpf(String gas) -> ActivityModelGenerator
             const auto mMg = (iMg < nions) ? ms[iMg] : real(0.0);
             const auto mCl = (iCl < nions) ? ms[iCl] : real(0.0);
 
-            // The Pitzer's parameters of the Rumpf et al. (1994) model
-            const auto B = 0.254 - 76.82/T - 10656.0/(T*T) + 6312.0e+3/(T*T*T);
+            // The Pitzer's parameters of the Rumpf et al. (1994) model (B is updated only if temperature has changed since the last evaluation)
+            if(!identical(T, lastT))
+            {
+                B = 0.254 - 76.82/T - 10656.0/(T*T) + 6312.0e+3/(T*T*T);
+                lastT = T;
+            }
             const auto Gamma = -0.0028;
 
             props.ln_g[igas] = 2*B*(mNa + mK + 2*mCa + 2*mMg) + 3*Gamma*(mNa + mK + mCa + mMg)*mCl;
@@ -18,6 +18,7 @@
 #include "ActivityModelSpycherPruessEnnis.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Math/Roots.hpp>
 
@@ -90,54 +91,64 @@ auto activityModelSpycherPruessEnnis(const SpeciesList& species) -> ActivityMode
     // The number of species
     const auto nspecies = species.size();
 
+    // The ln of pressure (in bar), the ln fugacity coefficients of H2O(g) and CO2(g) and the molar volume of the phase at the temperature and pressure of the last evaluation
+    real ln_Pb, ln_phiH2O, ln_phiCO2, V, lastT = NaN, lastP = NaN;
+
     // Define the activity model function of the gaseous phase
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
         // The arguments for the activity model evaluation
         const auto& [T, P, x] = args;
 
-        // Calculate the pressure in bar
-        const auto Pb = convertPascalToBar(P);
-        const auto ln_Pb = log(Pb);
+        // Update the fugacity coefficients and molar volume only if temperature or pressure have changed since the last evaluation (they do not depend on x)
+        if(!identical(T, lastT) || !identical(P, lastP))
+        {
+            // Calculate the pressure in bar
+            const auto Pb = convertPascalToBar(P);
+
+            // Check valid ranges for temperature and pressure
+            warning(Pb > 600.0, "ActivityModelSpycherPruessEnnis is only valid "
+                "for pressures up to 600 bar, but given pressure is ", Pb, " bar!");
+            warning(T > 373.15, "ActivityModelSpycherPruessEnnis is only valid for "
+                "temperatures up to 100 degC, but given temperature is ", T - 273.15, "degC!");
+            warning(T < 285.15, "ActivityModelSpycherPruessEnnis is not valid for "
+                "temperatures below 12 degC, but given temperature is ", T - 273.15, "degC!");
 
-        // Check valid ranges for temperature and pressure
-        warning(Pb > 600.0, "ActivityModelSpycherPruessEnnis is only valid "
-            "for pressures up to 600 bar, but given pressure is ", Pb, " bar!");
-        warning(T > 373.15, "ActivityModelSpycherPruessEnnis is only valid for "
-            "temperatures up to 100 degC, but given temperature is ", T - 273.15, "degC!");
-        warning(T < 285.15, "ActivityModelSpycherPruessEnnis is not valid for "
-            "temperatures below 12 degC, but given temperature is ", T - 273.15, "degC!");
+            // Auxiliary variables
+            const auto T05 = sqrt(T);
+            const auto T15 = T * T05;
 
-        // Auxiliary variables
-        const auto T05 = sqrt(T);
-        const auto T15 = T * T05;
+            // Calculate the mixing parameters
+            const auto amix = aCO2(T);
+            const auto bmix = bCO2;
 
-        // Calculate the mixing parameters
-        const auto amix = aCO2(T);
-        const auto bmix = bCO2;
+            // Calculate the molar volume of the CO2-rich phase (in units of cm3/mol)
+            const auto v = volumeCO2(T, Pb, T05);
 
-        // Calculate the molar volume of the CO2-rich phase (in units of cm3/mol)
-        const auto v = volumeCO2(T, Pb, T05);
+            // Auxiliary values for the fugacity coefficients
+            const auto aux1 = log(v / (v - bmix));
+            const auto aux2 = log((v + bmix) / v) * 2.0 / (R*T15*bmix);
+            const auto aux3 = amix / (R*T15*bmix*bmix);
+            const auto aux4 = log(Pb*v / (R*T));
 
-        // Auxiliary values for the fugacity coefficients
-        const auto aux1 = log(v / (v - bmix));
-        const auto aux2 = log((v + bmix) / v) * 2.0 / (R*T15*bmix);
-        const auto aux3 = amix / (R*T15*bmix*bmix);
-        const auto aux4 = log(Pb*v / (R*T));
+            // Calculate the fugacity coefficients of H2O(g) and CO2(g) (in natural log scale)
+            ln_phiH2O = aux1 + bH2O / (v - bmix) - aH2OCO2 * aux2 +
+                bH2O * aux3*(log((v + bmix) / v) - bmix / (v + bmix)) - aux4;
 
-        // Calculate the fugacity coefficients of H2O(g) and CO2(g) (in natural log scale)
-        const auto ln_phiH2O = aux1 + bH2O / (v - bmix) - aH2OCO2 * aux2 +
-            bH2O * aux3*(log((v + bmix) / v) - bmix / (v + bmix)) - aux4;
+            ln_phiCO2 = aux1 + bCO2 / (v - bmix) - amix * aux2 +
+                bCO2 * aux3*(log((v + bmix) / v) - bmix / (v + bmix)) - aux4;
 
-        const auto ln_phiCO2 = aux1 + bCO2 / (v - bmix) - amix * aux2 +
-            bCO2 * aux3*(log((v + bmix) / v) - bmix / (v + bmix)) - aux4;
+            // The molar volume of the phase (in m3/mol)
+            V = convertCubicCentimeterToCubicMeter(v);
+
+            ln_Pb = log(Pb);
+            lastT = T;
+            lastP = P;
+        }
 
         // The ln mole fractions of all gaseous species
         const auto ln_x = x.log();
 
-        // The molar volume of the phase (in m3/mol)
-        const auto V = convertCubicCentimeterToCubicMeter(v);
-
         // Set the corrective molar volume of the phase (in m3/mol)
         props.Vx = V;
 
@@ -98,4 +98,37 @@ TEST_CASE("Testing ActivityModelSpycherPruessEnnis", "[ActivityModelSpycherPrues
 
         checkActivities(x, P, props);
     }
+
+    WHEN("The model is evaluated repeatedly with changing conditions.")
+    {
+        const auto species = SpeciesList("H2O CO2");
+        const ArrayXr x0 = ArrayXr{{0.1, 0.9}};
+        const ArrayXr x1 = ArrayXr{{0.3, 0.7}};
+        const auto P1 = 45.6e5;
+
+        ActivityModel fn = ActivityModelSpycherPruessEnnis()(species);
+
+        ActivityProps props = ActivityProps::create(species.size());
+
+        // The fugacity coefficients are reused for the same temperature and pressure, while the activities follow the mole fractions
+        fn(props, {T, P, x0});
+        fn(props, {T, P, x1});
+
+        CHECK( exp(props.ln_g[0]) == Approx(0.9020896733) ); // H2O
+        CHECK( exp(props.ln_g[1]) == Approx(0.9423386345) ); // CO2
+
+        checkActivities(x1, P, props);
+
+        // The fugacity coefficients are recomputed when pressure changes
+        fn(props, {T, P1, x1});
+
+        ActivityProps expected = ActivityProps::create(species.size());
+        ActivityModelSpycherPruessEnnis()(species)(expected, {T, P1, x1});
+
+        CHECK( props.ln_g[0] == Approx(expected.ln_g[0]) ); // H2O
+        CHECK( props.ln_g[1] == Approx(expected.ln_g[1]) ); // CO2
+        CHECK( props.Vx == Approx(expected.Vx) );
+
+        checkActivities(x1, P1, props);
+    }
 }
@@ -218,6 +218,15 @@ auto activityModelSpycherReed(const SpeciesList& species) -> ActivityModel
     // The universal gas constant of the phase (in units of J/(mol*K))
     const auto R = universalGasConstant;
 
+    // The Bij, BijT, BijTT, Cijk, CijkT, CijkTT coefficients at the temperature of the last evaluation
+    real B[3][3] = {};
+    real BT[3][3] = {};
+    real BTT[3][3] = {};
+    real C[3][3][3] = {};
+    real CT[3][3][3] = {};
+    real CTT[3][3][3] = {};
+    real lastT = NaN;
+
     // Define the activity model function of the gaseous phase
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
     {
@@ -239,26 +248,24 @@ auto activityModelSpycherReed(const SpeciesList& species) -> ActivityModel
         if(iCO2 < nspecies) y[1] = x[iCO2]; else y[1] = 0.0;
         if(iCH4 < nspecies) y[2] = x[iCH4]; else y[2] = 0.0;
 
-        // Calculate the Bij, BijT, BijTT coefficients
-        real B[3][3] = {};
-        real BT[3][3] = {};
-        real BTT[3][3] = {};
-        for(auto i = 0; i < 3; ++i) for(auto k = 0; k < 3; ++k)
+        // Update the Bij, BijT, BijTT, Cijk, CijkT, CijkTT coefficients only if temperature has changed since the last evaluation
+        if(!identical(T, lastT))
         {
-            B[i][k] = computeB(T, i, k);
-            BT[i][k] = computeBT(T, i, k);
-            BTT[i][k] = computeBTT(T, i, k);
-        }
+            for(auto i = 0; i < 3; ++i) for(auto k = 0; k < 3; ++k)
+            {
+                B[i][k] = computeB(T, i, k);
+                BT[i][k] = computeBT(T, i, k);
+                BTT[i][k] = computeBTT(T, i, k);
+            }
 
-        // Calculate the Cijk, CijkT, CijkTT coefficients
-        real C[3][3][3] = {};
-        real CT[3][3][3] = {};
-        real CTT[3][3][3] = {};
-        for(auto i = 0; i < 3; ++i) for(auto k = 0; k < 3; ++k) for(auto l = 0; l < 3; ++l)
-        {
-            C[i][k][l] = computeC(T, i, k, l);
-            CT[i][k][l] = computeCT(T, i, k, l);
-            CTT[i][k][l] = computeCTT(T, i, k, l);
+            for(auto i = 0; i < 3; ++i) for(auto k = 0; k < 3; ++k) for(auto l = 0; l < 3; ++l)
+            {
+                C[i][k][l] = computeC(T, i, k, l);
+                CT[i][k][l] = computeCT(T, i, k, l);
+                CTT[i][k][l] = computeCTT(T, i, k, l);
+            }
+
+            lastT = T;
         }
 
         // Calculate the coefficient Bmix, BmixT, and BmixTT
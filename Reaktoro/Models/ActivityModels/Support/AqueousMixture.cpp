@@ -223,15 +223,31 @@ struct AqueousMixture::Impl
     auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState
     {
         AqueousMixtureState state;
+        updateState(state, T, P, x);
+        return state;
+    }
+
+    /// Update the state of the aqueous mixture reusing the memory already allocated in it.
+    auto updateState(AqueousMixtureState& state, real const& T, real const& P, ArrayXrConstRef x) const -> void
+    {
+        const auto xw = x[idx_water];
+        const auto Mw = water.molarMass();
+
         state.T = T;
         state.P = P;
         state.rho = rho(T, P);
         state.epsilon = epsilon(T, P);
-        state.m  = molalities(x);
-        state.ms = stoichiometricMolalities(state.m);
+
+        // The molalities of the species (see method molalities)
+        if(xw == 0.0) state.m.setZero(x.size());
+        else state.m = x/(Mw * xw);
+
+        // The stoichiometric molalities of the charged species (see method stoichiometricMolalities)
+        state.ms = state.m(idx_charged_species);
+        state.ms.matrix().noalias() += dissociation_matrix.transpose() * state.m(idx_neutral_species).matrix();
+
         state.Ie = effectiveIonicStrength(state.m);
         state.Is = stoichiometricIonicStrength(state.ms);
-        return state;
     }
 };
 
@@ -264,6 +280,14 @@ auto AqueousMixture::withWaterDielectricConstantFn(Fn<real(real,real)> epsilon)
     return copy;
 }
 
+auto AqueousMixture::withWaterThermoPropsModel(WaterThermoPropsModel model) const -> AqueousMixture
+{
+    AqueousMixture copy = clone();
+    copy.pimpl->rho = [=](real T, real P) { return waterThermoPropsMemoized(T, P, StateOfMatter::Liquid, model).D; };
+    copy.pimpl->epsilon = [=](real T, real P) { return waterElectroPropsJohnsonNorton(T, P, waterThermoPropsMemoized(T, P, StateOfMatter::Liquid, model)).epsilon; };
+    return copy;
+}
+
 auto AqueousMixture::species(Index idx) const -> Species const&
 {
     return pimpl->species[idx];
@@ -339,4 +363,9 @@ auto AqueousMixture::state(real T, real P, ArrayXrConstRef x) const -> AqueousMi
     return pimpl->state(T, P, x);
 }
 
+auto AqueousMixture::updateState(AqueousMixtureState& state, real const& T, real const& P, ArrayXrConstRef x) const -> void
+{
+    pimpl->updateState(state, T, P, x);
+}
+
 } // namespace Reaktoro
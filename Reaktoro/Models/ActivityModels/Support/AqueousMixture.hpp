@@ -21,6 +21,7 @@
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
 namespace Reaktoro {
 
@@ -80,6 +81,11 @@ public:
     /// Return a copy of this AqueousMixture object with replaced function for water dielectric constant calculation.
     auto withWaterDielectricConstantFn(Fn<real(real,real)> epsilon) const -> AqueousMixture;
 
+    /// Return a copy of this AqueousMixture object with water density and dielectric constant calculated with a chosen equation of state for water.
+    /// The dielectric constant is calculated with the Johnson and Norton (1991) model
+    /// from the thermodynamic properties of water computed with the given equation of state.
+    auto withWaterThermoPropsModel(WaterThermoPropsModel model) const -> AqueousMixture;
+
     /// Return the aqueous species in the mixture with given index.
     auto species(Index idx) const -> Species const&;
 
@@ -133,6 +139,18 @@ public:
     /// @param x The mole fractions of the species in the mixture
     auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState;
 
+    /// Update the state of the aqueous mixture.
+    /// This method is equivalent to @ref state, but it reuses the memory
+    /// already allocated in the given state object, which is convenient in
+    /// activity models evaluated very often. These models export this state via
+    /// `ActivityProps::extra` so that activity models chained after them (e.g.,
+    /// Setschenow, Drummond, Duan-Sun) use it instead of computing it again.
+    /// @param[in,out] state The state of the aqueous mixture to be updated
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param x The mole fractions of the species in the mixture
+    auto updateState(AqueousMixtureState& state, real const& T, real const& P, ArrayXrConstRef x) const -> void;
+
 private:
     struct Impl;
 
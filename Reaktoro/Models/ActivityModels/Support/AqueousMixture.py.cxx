@@ -41,6 +41,7 @@ void exportAqueousMixture(py::module& m)
         .def("clone", &AqueousMixture::clone, "Return a deep copy of this AqueousMixture object.")
         .def("withWaterDensityFn", &AqueousMixture::withWaterDensityFn, "Return a copy of this AqueousMixture object with replaced function for water density calculation.")
         .def("withWaterDielectricConstantFn", &AqueousMixture::withWaterDielectricConstantFn, "Return a copy of this AqueousMixture object with replaced function for water dielectric constant calculation.")
+        .def("withWaterThermoPropsModel", &AqueousMixture::withWaterThermoPropsModel, "Return a copy of this AqueousMixture object with water density and dielectric constant calculated with a chosen equation of state for water.")
         .def("species", py::overload_cast<Index>(&AqueousMixture::species, py::const_), "Return the aqueous species in the mixture with given index.")
         .def("species", py::overload_cast<>(&AqueousMixture::species, py::const_), "Return the aqueous species in the mixture.")
         .def("neutral", &AqueousMixture::neutral, "Return the neutral aqueous solutes in the mixture.")
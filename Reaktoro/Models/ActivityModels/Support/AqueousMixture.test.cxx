@@ -121,5 +121,18 @@ TEST_CASE("Testing AqueousMixture class", "[AqueousMixture]")
 
         REQUIRE( state.m.isApprox(m)   );
         REQUIRE( state.ms.isApprox(ms) );
+
+        AqueousMixtureState updated;
+        mixture.updateState(updated, T, P, x);
+
+        REQUIRE( updated.T       == T                  );
+        REQUIRE( updated.P       == P                  );
+        REQUIRE( updated.Ie      == Approx(Ie)         );
+        REQUIRE( updated.Is      == Approx(Is)         );
+        REQUIRE( updated.rho     == Approx(state.rho)  );
+        REQUIRE( updated.epsilon == Approx(state.epsilon) );
+
+        REQUIRE( updated.m.isApprox(m)   );
+        REQUIRE( updated.ms.isApprox(ms) );
     }
 }
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <algorithm>
+#include <array>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
@@ -283,6 +284,98 @@ auto determinePhysicalStateOneRealRoot(double a, double b, double e, double s, d
     return (Pmin != Pmin) ? StateOfMatter::Supercritical : (P < Pmin) ? StateOfMatter::Gas : StateOfMatter::Liquid;
 }
 
+/// The compressibility factor and the identified state of matter of a fluid phase in its last evaluation.
+/// This is used to continue the root of the cubic equation of state from the
+/// last evaluation, since in consecutive evaluations (e.g., while computing
+/// derivatives, or along a transport path) the root branch rarely changes.
+struct RootCache
+{
+    /// The compressibility factor in the last evaluation (NaN if none).
+    double Z = NaN;
+
+    /// The number of real roots of the cubic equation in the last evaluation.
+    Index numroots = 0;
+
+    /// The identified state of matter of the fluid in the last evaluation.
+    StateOfMatter som = StateOfMatter::Gas;
+
+    /// The values of *(amix, bmix, epsilon, sigma, T)* in the last computation of the local minimum pressure along the isotherm.
+    std::array<double, 5> isotherm = { NaN, NaN, NaN, NaN, NaN };
+
+    /// The local minimum pressure along the isotherm computed with the values in `isotherm` (NaN if supercritical).
+    double Pmin = NaN;
+};
+
+/// Refine the compressibility factor in the last evaluation of the fluid with Newton iterations on the cubic polynomial \eq{Z^3 + AZ^2 + BZ + C}.
+/// The refined root is accepted only if it remains in the basin of the last
+/// one, i.e., the cubic has the same number of real roots and the refined
+/// root is still the largest (gas) or smallest (liquid) one among them.
+/// @param A, B, C The coefficients of the cubic polynomial
+/// @param cache The compressibility factor and root branch in the last evaluation
+/// @param[out] roots The real roots of the cubic polynomial, with the refined root first
+/// @return true if the refined root is accepted, false if the full Cardano's method and phase identification are needed.
+auto refineCompressibilityFactor(double A, double B, double C, RootCache const& cache, std::array<double, 3>& roots) -> bool
+{
+    if(cache.numroots == 0)
+        return false;
+
+    auto Z = cache.Z;
+    auto converged = false;
+    for(auto i = 0; i < 8 && !converged; ++i)
+    {
+        const auto f = ((Z + A)*Z + B)*Z + C;
+        const auto fZ = (3*Z + 2*A)*Z + B;
+        if(fZ == 0.0)
+            return false;
+        const auto dZ = f/fZ;
+        Z -= dZ;
+        converged = abs(dZ) <= 1e-14 * abs(Z);
+    }
+
+    if(!converged)
+        return false;
+
+    // Deflate the cubic polynomial into the quadratic Z'^2 + c1*Z' + c0 whose roots are the other roots of the cubic
+    const auto c1 = A + Z;
+    const auto c0 = B + c1*Z;
+    const auto discr = c1*c1 - 4*c0;
+
+    // Use the full calculation if the other two roots are about to coalesce (Cardano's method decides then whether they are real)
+    if(abs(discr) <= 1e-10 * (c1*c1 + abs(c0)))
+        return false;
+
+    const auto numroots = discr > 0.0 ? 3 : 1;
+
+    if(numroots != cache.numroots)
+        return false;
+
+    roots[0] = Z;
+
+    if(numroots == 1)
+        return true;
+
+    roots[1] = 0.5*(-c1 - sqrt(discr));
+    roots[2] = 0.5*(-c1 + sqrt(discr));
+
+    return (cache.som == StateOfMatter::Gas) ?
+        Z > roots[2] : // the refined root is still the largest one
+        Z < roots[1];  // the refined root is still the smallest one
+}
+
+/// Determine the state of matter of the fluid when only one real root is available, reusing the last local minimum pressure along the isotherm if possible.
+/// @see determinePhysicalStateOneRealRoot
+auto determinePhysicalStateOneRealRoot(RootCache& cache, double a, double b, double e, double s, double T, double P) -> StateOfMatter
+{
+    const std::array<double, 5> isotherm = { a, b, e, s, T };
+    if(isotherm != cache.isotherm)
+    {
+        cache.Pmin = computeLocalMinimumPressureAlongIsotherm(a, b, e, s, T);
+        cache.isotherm = isotherm;
+    }
+    const auto Pmin = cache.Pmin;
+    return (Pmin != Pmin) ? StateOfMatter::Supercritical : (P < Pmin) ? StateOfMatter::Gas : StateOfMatter::Liquid;
+}
+
 /// Return the critical temperatures of the substances as an array, checking if their values are valid.
 auto getCriticalTemperatures(Vec<Substance> const& substances) -> ArrayXr
 {
@@ -360,6 +453,27 @@ struct Equation::Impl
     ArrayXr bbar;
     Bip bip;
 
+    /// The parameters \eq{a_{ij}=(1-k_{ij})(a_{i}a_{j})^{1/2}} of the cubic equation of state and their first and second order temperature derivatives.
+    MatrixXr aij, aijT, aijTT;
+
+    /// The products of the matrices of parameters \eq{a_{ij}} above and the mole fractions of the species.
+    VectorXr aijx, aijTx, aijTTx;
+
+    /// The parameters in the equation model and the binary interaction parameter model on which the temperature-dependent terms above depend.
+    Vec<Param> tparams;
+
+    /// The temperature at which the temperature-dependent terms above were last computed.
+    real lastT = NaN;
+
+    /// The values of the parameters in `tparams` when the temperature-dependent terms above were last computed.
+    ArrayXr lasttparams;
+
+    /// The compressibility factor and root branch of the phase in the last evaluation.
+    detail::RootCache rootcache;
+
+    /// The compressibility factors and root branches of the phase in the last evaluation for many compositions.
+    Vec<detail::RootCache> rootcaches;
+
     /// Construct an Equation::Impl object.
     Impl(EquationSpecs const& eqspecs)
     : eqspecs(eqspecs),
@@ -384,17 +498,41 @@ struct Equation::Impl
         bip.k   = zeros(nspecies, nspecies);
         bip.kT  = zeros(nspecies, nspecies);
         bip.kTT = zeros(nspecies, nspecies);
+        aij     = zeros(nspecies, nspecies);
+        aijT    = zeros(nspecies, nspecies);
+        aijTT   = zeros(nspecies, nspecies);
+
+        tparams = { eqspecs.eqmodel.Omega, eqspecs.eqmodel.Psi };
+        auto const& alphaparams = eqspecs.eqmodel.alphafn.params();
+        tparams.insert(tparams.end(), alphaparams.begin(), alphaparams.end());
+        if(eqspecs.bipmodel.initialized())
+        {
+            auto const& bipparams = eqspecs.bipmodel.params();
+            tparams.insert(tparams.end(), bipparams.begin(), bipparams.end());
+        }
     }
 
-    auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
+    /// Return true if temperature or the parameters on which the temperature-dependent terms depend have changed since their last computation.
+    auto changed(real const& T) const -> bool
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.size() == 0 || x.maxCoeff() <= 0.0)
+        if(!identical(T, lastT))
+            return true;
+        for(auto i = 0; i < tparams.size(); ++i)
+            if(!identical(tparams[i].value(), lasttparams[i]))
+                return true;
+        return false;
+    }
+
+    /// Update the temperature-dependent parameters of the substances and of their binary interactions.
+    /// Note: These terms do not depend on pressure and composition, and so they
+    /// are only computed again if temperature or any of the parameters on which
+    /// they depend have changed since the last call.
+    auto updateTemperatureTerms(real const& T) -> void
+    {
+        if(!changed(T))
             return;
 
         // Auxiliary references
-        auto const& sigma   = eqspecs.eqmodel.sigma.value();
-        auto const& epsilon = eqspecs.eqmodel.epsilon.value();
         auto const& Omega   = eqspecs.eqmodel.Omega.value();
         auto const& Psi     = eqspecs.eqmodel.Psi.value();
         auto const& alphafn = eqspecs.eqmodel.alphafn;
@@ -415,16 +553,14 @@ struct Equation::Impl
             b[k]       = Omega*R*Tcr[k]/Pcr[k]; // Eq. (3.44)
         }
 
+        // Calculate the partial molar parameters bbar[i] = Omega*R*Tc[i]/Pc[i] as shown in Eq. (3.44), see also Eq. (13.95) and unnumbered equation before Eq. (13.99)
+        bbar = b;
+
         // Calculate the binary interaction parameters and its temperature derivatives
         if(eqspecs.bipmodel.initialized())
             eqspecs.bipmodel(bip, { substances, T, Tcr, Pcr, omega, a, aT, aTT, alpha, alphaT, alphaTT, b });
 
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        real amix = {};
-        real amixT = {};
-        real amixTT = {};
-        abar.fill(0.0);
-        abarT.fill(0.0);
+        // Calculate the parameters `aij` and their temperature derivatives
         for(auto i = 0; i < nspecies; ++i)
         {
             for(auto j = 0; j < nspecies; ++j)
@@ -437,35 +573,81 @@ struct Equation::Impl
                 auto const sT  = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
                 auto const sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
 
-                auto const aij   = r*s;
-                auto const aijT  = rT*s + r*sT;
-                auto const aijTT = rTT*s + 2.0*rT*sT + r*sTT;
-
-                amix   += x[i] * x[j] * aij; // Eq. (13.92) of Smith et al. (2017)
-                amixT  += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
-
-                abar[i]  += 2 * x[j] * aij;  // see Eq. (13.94)
-                abarT[i] += 2 * x[j] * aijT;
+                aij(i, j)   = r*s;
+                aijT(i, j)  = rT*s + r*sT;
+                aijTT(i, j) = rTT*s + 2.0*rT*sT + r*sTT;
             }
         }
 
-        // Finalize the calculation of `abar` and `abarT`
-        for(auto i = 0; i < nspecies; ++i)
-        {
-            abar[i] -= amix;
-            abarT[i] -= amixT;
-        }
+        lastT = T;
+        lasttparams = ArrayXr(tparams.size());
+        for(auto i = 0; i < tparams.size(); ++i)
+            lasttparams[i] = tparams[i].value();
+    }
 
-        // Calculate the parameters bba[i] and bmix of the cubic equation of state
-        //     bbar[i] = Omega*R*Tc[i]/Pc[i] as shown in Eq. (3.44)
-        //     bmix = sum(x[i] * bbar[i])
-        real bmix = {};
-        for(auto i = 0; i < nspecies; ++i)
+    auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
+    {
+        // Check if the mole fractions are zero or non-initialized
+        if(x.size() == 0 || x.maxCoeff() <= 0.0)
+            return;
+
+        // Update the temperature-dependent terms of the cubic equation of state, if needed
+        updateTemperatureTerms(T);
+
+        // Calculate the products of the matrices of parameters `aij` and the mole fractions of the species
+        aijx.noalias()   = aij * x.matrix();
+        aijTx.noalias()  = aijT * x.matrix();
+        aijTTx.noalias() = aijTT * x.matrix();
+
+        computeWithMixingTerms(props, rootcache, T, P, x, aijx, aijTx, aijTTx);
+    }
+
+    auto compute(Vec<Props>& props, real const& T, real const& P, ArrayXXrConstRef const& X) -> void
+    {
+        props.resize(X.cols());
+        rootcaches.resize(X.cols());
+
+        if(X.rows() == 0 || X.cols() == 0)
+            return;
+
+        // Update the temperature-dependent terms of the cubic equation of state, if needed
+        updateTemperatureTerms(T);
+
+        // Calculate the products of the matrices of parameters `aij` and the mole fractions of the species for all compositions at once
+        const MatrixXr aijX   = aij * X.matrix();
+        const MatrixXr aijTX  = aijT * X.matrix();
+        const MatrixXr aijTTX = aijTT * X.matrix();
+
+        for(auto j = 0; j < X.cols(); ++j)
         {
-            bbar[i] = Omega*R*Tcr[i]/Pcr[i]; // see Eq. (13.95) and unnumbered equation before Eq. (13.99)
-            bmix += x[i] * bbar[i];  // Eq. (13.91) of Smith et al. (2017)
+            // Skip compositions with zero or non-initialized mole fractions
+            if(X.col(j).maxCoeff() <= 0.0)
+                continue;
+
+            computeWithMixingTerms(props[j], rootcaches[j], T, P, X.col(j), aijX.col(j), aijTX.col(j), aijTTX.col(j));
         }
+    }
+
+    /// Compute the thermodynamic properties of the phase with given products of the matrices of parameters \eq{a_{ij}} and the mole fractions of the species.
+    /// The compressibility factor is continued from the one in @p cache if it
+    /// remains on the same root branch, and is otherwise computed from scratch
+    /// with Cardano's method. In both cases, @p cache is updated afterwards.
+    auto computeWithMixingTerms(Props& props, detail::RootCache& cache, real const& T, real const& P, ArrayXrConstRef x, VectorXrConstRef ax, VectorXrConstRef axT, VectorXrConstRef axTT) -> void
+    {
+        // Auxiliary references
+        auto const& sigma   = eqspecs.eqmodel.sigma.value();
+        auto const& epsilon = eqspecs.eqmodel.epsilon.value();
+
+        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
+        const real amix   = (x * ax.array()).sum();   // Eq. (13.92) of Smith et al. (2017)
+        const real amixT  = (x * axT.array()).sum();
+        const real amixTT = (x * axTT.array()).sum();
+
+        abar  = 2.0*ax.array() - amix;  // see Eq. (13.94)
+        abarT = 2.0*axT.array() - amixT;
+
+        // Calculate the parameter bmix of the cubic equation of state
+        const real bmix = (x * bbar).sum();  // Eq. (13.91) of Smith et al. (2017)
 
         // Calculate the temperature and pressure derivatives of bmix
         const auto bmixT = 0.0; // no temperature dependence!
@@ -497,28 +679,65 @@ struct Equation::Impl
         const real BP = (epsilon*sigma - epsilon - sigma)*(2*beta*betaP) + qP*beta - (epsilon + sigma - q)*betaP;
         const real CP = -epsilon*sigma*(3*beta*beta*betaP) - qP*beta*beta - (epsilon*sigma + q)*(2*beta*betaP);
 
-        // Calculate cubic roots using cardano's method
-        auto roots = realRoots(cardano(A, B, C));
-
-        // Ensure there are either 1 or 3 real roots!
-        assert(roots.size() == 1 || roots.size() == 3);
-
         // Determine the physical state of the fluid phase for given TPx conditions and its compressibility factor
         real Z = {};
 
-        if(roots.size() == 3)
+        // The real roots of the cubic equation (kept on the stack, since this is evaluated very often)
+        std::array<double, 3> zroots;
+        Index numroots = 0;
+
+        if(detail::refineCompressibilityFactor(A.val(), B.val(), C.val(), cache, zroots))
         {
-            const auto Zmax = std::max({roots[0], roots[1], roots[2]});
-            const auto Zmin = std::min({roots[0], roots[1], roots[2]});
-            props.som = detail::determinePhysicalStateThreeRealRoots(Zmin, Zmax, beta, q, epsilon, sigma, T);
-            Z = (props.som == StateOfMatter::Gas) ? Zmax : Zmin;
+            // The root branch is unchanged since the last evaluation, so Cardano's method is not needed
+            numroots = cache.numroots;
+
+            double Zval = zroots[0];
+
+            if(numroots == 3)
+            {
+                const auto Zmax = std::max({zroots[0], zroots[1], zroots[2]});
+                const auto Zmin = std::min({zroots[0], zroots[1], zroots[2]});
+                props.som = detail::determinePhysicalStateThreeRealRoots(Zmin, Zmax, beta, q, epsilon, sigma, T);
+                Zval = (props.som == StateOfMatter::Gas) ? Zmax : Zmin;
+            }
+            else props.som = detail::determinePhysicalStateOneRealRoot(cache, amix, bmix, epsilon, sigma, T, P);
+
+            // Perform a Newton step with the converged root so that Z carries the derivatives of the coefficients A, B, C
+            Z = Zval - (((Zval + A)*Zval + B)*Zval + C)/((3*Zval + 2*A)*Zval + B);
         }
         else
         {
-            props.som = detail::determinePhysicalStateOneRealRoot(amix, bmix, epsilon, sigma, T, P);
-            Z = roots[0];
+            // Calculate cubic roots using cardano's method
+            const auto croots = cardano(A, B, C);
+
+            // Collect the real roots (kept on the stack, since this is evaluated very often)
+            std::array<real, 3> roots;
+            for(auto const& root : croots)
+                if(root.imag() == 0.0)
+                    roots[numroots++] = root.real();
+
+            // Ensure there are either 1 or 3 real roots!
+            assert(numroots == 1 || numroots == 3);
+
+            if(numroots == 3)
+            {
+                const auto Zmax = std::max({roots[0], roots[1], roots[2]});
+                const auto Zmin = std::min({roots[0], roots[1], roots[2]});
+                props.som = detail::determinePhysicalStateThreeRealRoots(Zmin, Zmax, beta, q, epsilon, sigma, T);
+                Z = (props.som == StateOfMatter::Gas) ? Zmax : Zmin;
+            }
+            else
+            {
+                props.som = detail::determinePhysicalStateOneRealRoot(cache, amix, bmix, epsilon, sigma, T, P);
+                Z = roots[0];
+            }
         }
 
+        // Store the root branch so that the next evaluation can continue from it
+        cache.Z = Z.val();
+        cache.numroots = numroots;
+        cache.som = props.som;
+
         // Calculate ZT := (dZ/dT)_P and ZP := (dZ/dP)_T
         const real ZT = -(AT*Z*Z + BT*Z + CT)/(3*Z*Z + 2*A*Z + B); // === (ZZZ + A*ZZ + B*Z + C)_T = 3*ZZ*ZT + AT*ZZ + 2*A*Z*ZT + BT*Z + B*ZT + CT = 0 => (3*ZZ + 2*A*Z + B)*ZT = -(AT*ZZ + BT*Z + CT)
         const real ZP = -(AP*Z*Z + BP*Z + CP)/(3*Z*Z + 2*A*Z + B); // === (ZZZ + A*ZZ + B*Z + C)_P = 3*ZZ*ZP + AP*ZZ + 2*A*Z*ZP + BP*Z + B*ZP + CP = 0 => (3*ZZ + 2*A*Z + B)*ZP = -(AP*ZZ + BP*Z + CP)
@@ -616,6 +835,11 @@ auto Equation::compute(Props& props, real const& T, real const& P, ArrayXrConstR
     return pimpl->compute(props, T, P, x);
 }
 
+auto Equation::compute(Vec<Props>& props, real const& T, real const& P, ArrayXXrConstRef const& X) -> void
+{
+    return pimpl->compute(props, T, P, X);
+}
+
 auto BipModelPhreeqc(Strings const& substances, BipModelParamsPhreeqc const& params) -> BipModel
 {
     auto isubstance = [&](auto... substrs)
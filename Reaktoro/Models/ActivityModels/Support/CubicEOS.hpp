@@ -187,6 +187,16 @@ public:
     /// @param x The mole fractions of the species in the phase (in mol/mol)
     auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void;
 
+    /// Compute the thermodynamic properties of the phase for many compositions at the same temperature and pressure.
+    /// The terms of the cubic equation of state that depend only on
+    /// temperature are computed once for all compositions, and the mixing
+    /// terms of all compositions are computed with matrix-matrix products.
+    /// @param[in] props The evaluated thermodynamic properties of the phase for each composition.
+    /// @param T The temperature of the phase (in K)
+    /// @param P The pressure of the phase (in Pa)
+    /// @param X The mole fractions of the species in the phase (in mol/mol), with each column corresponding to a composition
+    auto compute(Vec<Props>& props, real const& T, real const& P, ArrayXXrConstRef const& X) -> void;
+
 private:
     struct Impl;
 
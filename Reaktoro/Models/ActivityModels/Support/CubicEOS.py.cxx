@@ -110,7 +110,8 @@ void exportCubicEOS(py::module& m)
     py::class_<CubicEOS::Equation>(ceos, "Equation")
         .def(py::init<CubicEOS::EquationSpecs>())
         .def("equationSpecs", &CubicEOS::Equation::equationSpecs, "Return the underlying EquationSpecs object used to create this Equation object.")
-        .def("compute", &CubicEOS::Equation::compute, "Compute the thermodynamic properties of the phase.")
+        .def("compute", py::overload_cast<CubicEOS::Props&, real const&, real const&, ArrayXrConstRef const&>(&CubicEOS::Equation::compute), "Compute the thermodynamic properties of the phase.")
+        .def("compute", [](CubicEOS::Equation& self, real const& T, real const& P, ArrayXXrConstRef X) { Vec<CubicEOS::Props> props; self.compute(props, T, P, X); return props; }, "Compute the thermodynamic properties of the phase for many compositions (the columns of X) at the same temperature and pressure.")
         ;
 
     py::class_<CubicEOS::BipModelParamsPhreeqc>(ceos, "BipModelParamsPhreeqc")
@@ -89,6 +89,80 @@ TEST_CASE("Testing CubicEOS::Equation class", "[CubicEOS]")
 
             CHECK( props.som == StateOfMatter::Supercritical );
         }
+
+        WHEN("Many compositions are computed at once and temperature changes between evaluations")
+        {
+            const auto P = 100.0 * 1e5; // 100 bar
+
+            ArrayXXr X(3, 3);
+            X.col(0) = x;
+            X.col(1) << 0.50, 0.40, 0.10;
+            X.col(2) << 0.10, 0.10, 0.80;
+
+            for(auto T : { 10.0 + 273.15, 60.0 + 273.15, 10.0 + 273.15 })
+            {
+                Vec<CubicEOS::Props> batch;
+                equation.compute(batch, T, P, X);
+
+                REQUIRE( batch.size() == 3 );
+
+                for(auto j = 0; j < X.cols(); ++j)
+                {
+                    CubicEOS::Equation fresh(eqspecs);
+                    fresh.compute(props, T, P, X.col(j));
+
+                    INFO("T = " << T << ", j = " << j);
+                    CHECK( batch[j].V == Approx(props.V) );
+                    CHECK( batch[j].Gres == Approx(props.Gres) );
+                    CHECK( batch[j].Hres == Approx(props.Hres) );
+                    CHECK( batch[j].Cpres == Approx(props.Cpres) );
+                    CHECK( batch[j].som == props.som );
+                    for(auto i = 0; i < x.size(); ++i)
+                        CHECK( batch[j].ln_phi[i] == Approx(props.ln_phi[i]) );
+                }
+            }
+        }
+
+        WHEN("Consecutive evaluations continue the compressibility factor from the last one")
+        {
+            // Small steps along each state (where the root is continued) and jumps between states (where the root is computed from scratch)
+            const Vec<Pair<double, double>> conditions = {
+                { 25.0 + 273.15,   1.0e5 }, { 25.1 + 273.15,   1.0e5 }, { 25.1 + 273.15,   1.1e5 },
+                { 10.0 + 273.15, 100.0e5 }, { 10.1 + 273.15, 100.0e5 }, { 10.1 + 273.15, 101.0e5 },
+                { 60.0 + 273.15, 100.0e5 }, { 60.1 + 273.15, 100.0e5 }, { 60.1 + 273.15, 101.0e5 },
+                { 25.0 + 273.15,   1.0e5 },
+            };
+
+            CubicEOS::Props expected;
+
+            for(auto const& [Tval, Pval] : conditions)
+            {
+                real T = Tval;
+                real P = Pval;
+
+                autodiff::seed(P);
+                equation.compute(props, T, P, x);
+                autodiff::unseed(P);
+
+                CubicEOS::Equation fresh(eqspecs);
+
+                autodiff::seed(P);
+                fresh.compute(expected, T, P, x);
+                autodiff::unseed(P);
+
+                INFO("T = " << Tval << ", P = " << Pval);
+                CHECK( props.V == Approx(expected.V) );
+                CHECK( grad(props.V) == Approx(grad(expected.V)) );
+                CHECK( props.VP == Approx(expected.VP) );
+                CHECK( props.Gres == Approx(expected.Gres) );
+                CHECK( props.som == expected.som );
+                for(auto i = 0; i < x.size(); ++i)
+                {
+                    CHECK( props.ln_phi[i] == Approx(expected.ln_phi[i]) );
+                    CHECK( grad(props.ln_phi[i]) == Approx(grad(expected.ln_phi[i])) );
+                }
+            }
+        }
     }
 
     //=============================================
@@ -17,6 +17,9 @@
 
 #include "ReactionRateModelPalandriKharaka.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
@@ -37,11 +40,10 @@ namespace detail {
 using Catalyst = ReactionRateModelParamsPalandriKharaka::Catalyst;
 using Mechanism = ReactionRateModelParamsPalandriKharaka::Mechanism;
 
-/// Construct a function that computes the activity-based contribution of a catalyst in the mineral reaction rate.
-auto mineralCatalystFnActivity(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+/// Construct a function that computes the activity of a catalyst species in the mineral reaction rate (or one if the species does not exist).
+auto mineralCatalystPropertyFnActivity(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
 {
     auto const& formula = catalyst.formula;
-    auto const& power = catalyst.power;
     auto const& species = args.species;
 
     auto const aqspecies = species.withAggregateState(AggregateState::Aqueous);
@@ -58,18 +60,16 @@ auto mineralCatalystFnActivity(Catalyst const& catalyst, ReactionRateModelGenera
 
     auto fn = [=](ChemicalProps const& props)
     {
-        auto const& ai = props.speciesActivity(ispecies);
-        return pow(ai, power);
+        return props.speciesActivity(ispecies);
     };
 
     return fn;
 }
 
-/// Construct a function that computes the partial-pressure-based contribution of a catalyst in the mineral reaction rate.
-auto mineralCatalystFnPartialPressure(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+/// Construct a function that computes the partial pressure of a catalyst gas in the mineral reaction rate (or one if the gas does not exist).
+auto mineralCatalystPropertyFnPartialPressure(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
 {
     auto const& formula = catalyst.formula;
-    auto const& power = catalyst.power;
     auto const& species = args.species;
 
     auto const gases = species.withAggregateState(AggregateState::Gas);
@@ -89,58 +89,345 @@ auto mineralCatalystFnPartialPressure(Catalyst const& catalyst, ReactionRateMode
         auto const P  = props.pressure(); // pressure in Pa
         auto const xi = props.speciesMoleFraction(ispecies);
         auto const Pi = xi * P * 1e-5; // partial pressure in bar!
-        return pow(Pi, power);
+        return Pi;
     };
 
     return fn;
 }
 
-/// Construct a function that computes the contribution of a catalyst in the mineral reaction rate.
-auto mineralCatalystFn(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+/// Construct a function that computes the property of a catalyst (activity or partial pressure) in the mineral reaction rate.
+auto mineralCatalystPropertyFn(Catalyst const& catalyst, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
 {
     if(catalyst.property == "a")
-        return mineralCatalystFnActivity(catalyst, args);
+        return mineralCatalystPropertyFnActivity(catalyst, args);
     if(catalyst.property == "P")
-        return mineralCatalystFnPartialPressure(catalyst, args);
+        return mineralCatalystPropertyFnPartialPressure(catalyst, args);
     errorif(true, "Expecting mineral catalyst property symbol to be either `a` or `P`, but got `", catalyst.property, "` instead.");
 }
 
-auto mineralMechanismFn(Mechanism const& mechanism, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+/// The temperature-dependent rate constants of the mechanisms in a mineral reaction rate, cached for the temperature and parameters used in their last evaluation.
+struct MineralRateConstants
+{
+    /// The lock that protects the cached values when the rate is evaluated concurrently.
+    std::mutex mutex;
+
+    /// The temperature used in the last evaluation of the rate constants (in K).
+    real T = NaN;
+
+    /// The parameters *lgk* of the mechanisms used in the last evaluation of the rate constants.
+    ArrayXr lgk;
+
+    /// The parameters *E* of the mechanisms used in the last evaluation of the rate constants (in kJ/mol).
+    ArrayXr E;
+
+    /// The rate constants of the mechanisms at temperature #T (in mol/(m2*s)).
+    ArrayXr k;
+};
+
+/// Compute the rate constants of the mechanisms in a mineral reaction rate at given temperature.
+auto mineralRateConstants(Vec<Mechanism> const& mechanisms, real const& T, ArrayXrRef k) -> void
 {
     // The universal gas constant (in J/(mol*K))
     const auto R = universalGasConstant;
 
-    // Create the mineral catalyst functions
+    for(auto i = 0; i < mechanisms.size(); ++i)
+    {
+        const auto& lgk = mechanisms[i].lgk.value();
+        const auto& E = mechanisms[i].E.value() * 1e3; // from kJ to J
+        const auto k0 = pow(10, lgk);
+        k[i] = k0 * exp(-E/R * (1.0/T - 1.0/298.15));
+    }
+}
+
+/// Construct a function that computes the sum of the contributions of all mechanisms in a mineral reaction rate (per unit of surface area).
+/// The rate constants of the mechanisms are only computed again when
+/// temperature or the parameters *lgk* and *E* change. The saturation ratio of
+/// the mineral and the property of each distinct catalyst are computed once,
+/// even if they are needed in several mechanisms.
+auto mineralMechanismsFn(Vec<Mechanism> const& mechanisms, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+{
+    const auto nummechanisms = mechanisms.size();
+
+    // Create the functions that compute the properties of the distinct catalysts
     Vec<Fn<real(ChemicalProps const&)>> catalyst_fns;
-    for(auto&& catalyst : mechanism.catalysts)
-        catalyst_fns.push_back(mineralCatalystFn(catalyst, args));
+
+    // The formulas and property symbols of the distinct catalysts
+    Vec<Pair<String, String>> catalyst_keys;
+
+    // The indices of the distinct catalysts of each mechanism
+    Vec<Indices> icatalysts(nummechanisms);
+
+    for(auto i = 0; i < nummechanisms; ++i)
+    {
+        for(auto const& catalyst : mechanisms[i].catalysts)
+        {
+            const auto key = Pair<String, String>{ catalyst.formula, catalyst.property };
+            const auto j = indexfn(catalyst_keys, RKT_LAMBDA(x, x == key));
+            if(j == catalyst_keys.size())
+            {
+                catalyst_keys.push_back(key);
+                catalyst_fns.push_back(mineralCatalystPropertyFn(catalyst, args));
+            }
+            icatalysts[i].push_back(j);
+        }
+    }
 
     // The name of the mineral from the name of the reaction
     const auto mineral = args.name;
 
-    // Define the mineral mechanism function
+    // The rate constants of the mechanisms shared among the copies of the function below
+    const auto constants = std::make_shared<MineralRateConstants>();
+
+    // Define the mineral mechanisms function
     auto fn = [=](ChemicalProps const& props)
     {
         const auto& aprops = AqueousProps::compute(props);
 
-        const auto& lgk = mechanism.lgk.value();
-        const auto& E = mechanism.E.value() * 1e3; // from kJ to J
+        const auto T = props.temperature();
+
+        // Update the rate constants of the mechanisms, unless they have already been computed with the same temperature and parameters
+        ArrayXr k(nummechanisms);
+        {
+            std::lock_guard<std::mutex> lock(constants->mutex);
+
+            auto uptodate = constants->k.size() == nummechanisms && identical(constants->T, T);
+            for(auto i = 0; uptodate && i < nummechanisms; ++i)
+                uptodate = identical(constants->lgk[i], mechanisms[i].lgk.value()) && identical(constants->E[i], mechanisms[i].E.value());
+
+            if(!uptodate)
+            {
+                constants->T = T;
+                constants->lgk.resize(nummechanisms);
+                constants->E.resize(nummechanisms);
+                constants->k.resize(nummechanisms);
+                for(auto i = 0; i < nummechanisms; ++i)
+                {
+                    constants->lgk[i] = mechanisms[i].lgk.value();
+                    constants->E[i] = mechanisms[i].E.value();
+                }
+                mineralRateConstants(mechanisms, T, constants->k);
+            }
+
+            k = constants->k;
+        }
+
+        const auto Omega = aprops.saturationRatio(mineral); // TODO: Find a way to determine the index of the mineral once in aprops.saturationSpecies to avoid index search in every call of Palandri-Kharaka model (overhead here should be minimal though compared to other operations).
+
+        // Compute the properties of the distinct catalysts once for all mechanisms
+        ArrayXr gvals(catalyst_fns.size());
+        for(auto j = 0; j < catalyst_fns.size(); ++j)
+            gvals[j] = catalyst_fns[j](props);
+
+        real sum = 0.0;
+        for(auto i = 0; i < nummechanisms; ++i)
+        {
+            const auto& p = mechanisms[i].p.value();
+            const auto& q = mechanisms[i].q.value();
+
+            const auto pOmega = p != 1.0 ? pow(Omega, p) : Omega;
+            const auto qOmega = q != 1.0 ? pow(1 - pOmega, q) : 1 - pOmega;
+
+            real g = 1.0;
+            for(auto j = 0; j < icatalysts[i].size(); ++j)
+                g *= pow(gvals[icatalysts[i][j]], mechanisms[i].catalysts[j].power.value());
+
+            sum += k[i] * qOmega * g;
+        }
+
+        return sum;
+    };
+
+    return fn;
+}
+
+/// The mechanisms of the mineral reactions whose rates are generated for chemical systems with the same species and surfaces, stored as arrays for their evaluation in a single pass.
+struct MineralRateTable
+{
+    /// The names of the species and surfaces in the chemical systems for which the mineral rates in this table are generated.
+    Strings signature;
+
+    /// The names of the minerals in this table.
+    Strings minerals;
+
+    /// The mechanisms of all minerals in this table.
+    Vec<Mechanism> mechanisms;
+
+    /// The index of the mineral (in this table) of each mechanism.
+    Indices imineral;
+
+    /// The functions that compute the properties of the distinct catalysts of all minerals in this table.
+    Vec<Fn<real(ChemicalProps const&)>> catalyst_fns;
+
+    /// The formulas and property symbols of the distinct catalysts of all minerals in this table.
+    Vec<Pair<String, String>> catalyst_keys;
+
+    /// The indices of the distinct catalysts of each mechanism.
+    Vec<Indices> icatalysts;
+
+    /// The temperature used in the last evaluation of the rate constants (in K).
+    real T = NaN;
+
+    /// The parameters *lgk* of the mechanisms used in the last evaluation of the rate constants.
+    ArrayXr lgk;
+
+    /// The parameters *E* of the mechanisms used in the last evaluation of the rate constants (in kJ/mol).
+    ArrayXr E;
+
+    /// The rate constants of the mechanisms at temperature #T (in mol/(m2*s)).
+    ArrayXr k;
+
+    /// The address of the ChemicalProps object used in the last evaluation of the mineral rates.
+    ChemicalProps const* props = nullptr;
+
+    /// The state identifier of the ChemicalProps object used in the last evaluation of the mineral rates.
+    Index stateid = -1;
+
+    /// The sum of the contributions of all mechanisms of each mineral (per unit of surface area) computed in the last evaluation.
+    ArrayXr sums;
+};
+
+/// The minerals whose rate models are produced by the same Palandri-Kharaka rate model generator.
+struct MineralRateGroup
+{
+    /// The lock that protects the tables when they are modified or evaluated concurrently.
+    std::mutex mutex;
+
+    /// The tables of mineral mechanisms, one for each distinct set of species and surfaces in the chemical systems.
+    Vec<MineralRateTable> tables;
+};
+
+/// Register the mechanisms of a mineral in a group of mineral rates and return the indices of its table and its position in this table.
+auto mineralRateGroupRegister(MineralRateGroup& group, Vec<Mechanism> const& mechanisms, ReactionRateModelGeneratorArgs args) -> Pair<Index, Index>
+{
+    std::lock_guard<std::mutex> lock(group.mutex);
+
+    Strings signature;
+    signature.reserve(args.species.size() + args.surfaces.size() + 1);
+    for(auto const& species : args.species)
+        signature.push_back(species.name());
+    signature.push_back("|"); // separate the names of species from the names of surfaces
+    for(auto const& surface : args.surfaces)
+        signature.push_back(surface.name());
+
+    const auto itable = indexfn(group.tables, RKT_LAMBDA(x, x.signature == signature));
+    if(itable == group.tables.size())
+        group.tables.push_back(MineralRateTable{ signature });
+
+    auto& table = group.tables[itable];
+
+    const auto imineral = table.minerals.size();
+
+    table.minerals.push_back(args.name);
+
+    for(auto const& mechanism : mechanisms)
+    {
+        Indices icatalysts;
+        for(auto const& catalyst : mechanism.catalysts)
+        {
+            const auto key = Pair<String, String>{ catalyst.formula, catalyst.property };
+            const auto j = indexfn(table.catalyst_keys, RKT_LAMBDA(x, x == key));
+            if(j == table.catalyst_keys.size())
+            {
+                table.catalyst_keys.push_back(key);
+                table.catalyst_fns.push_back(mineralCatalystPropertyFn(catalyst, args));
+            }
+            icatalysts.push_back(j);
+        }
+        table.mechanisms.push_back(mechanism);
+        table.imineral.push_back(imineral);
+        table.icatalysts.push_back(icatalysts);
+    }
+
+    table.props = nullptr; // force the evaluation of all minerals in the table, including the new one, in the next call
+
+    return { itable, imineral };
+}
+
+/// Evaluate the sum of the contributions of all mechanisms of every mineral in a table (per unit of surface area).
+/// The rate constants of all mechanisms are computed in a vectorized pass, and
+/// only again when temperature or the parameters *lgk* and *E* change. The
+/// saturation ratio of each mineral and the property of each distinct catalyst
+/// are computed once, even if they are needed in several mechanisms.
+auto mineralRateTableEvaluate(MineralRateTable& table, ChemicalProps const& props) -> void
+{
+    const auto& aprops = AqueousProps::compute(props);
+
+    const auto T = props.temperature();
+    const auto R = universalGasConstant;
+
+    const auto nummechanisms = table.mechanisms.size();
+
+    auto uptodate = table.k.size() == nummechanisms && identical(table.T, T);
+    for(auto i = 0; uptodate && i < nummechanisms; ++i)
+        uptodate = identical(table.lgk[i], table.mechanisms[i].lgk.value()) && identical(table.E[i], table.mechanisms[i].E.value());
+
+    if(!uptodate)
+    {
+        table.T = T;
+        table.lgk.resize(nummechanisms);
+        table.E.resize(nummechanisms);
+        for(auto i = 0; i < nummechanisms; ++i)
+        {
+            table.lgk[i] = table.mechanisms[i].lgk.value();
+            table.E[i] = table.mechanisms[i].E.value();
+        }
+        const real dinvT = 1.0/T - 1.0/298.15;
+        table.k = exp(ln10*table.lgk - table.E*(1e3/R)*dinvT); // E from kJ to J
+    }
+
+    // The saturation ratio of each mineral in the table
+    const auto numminerals = table.minerals.size();
+    ArrayXr Omega(numminerals);
+    for(auto j = 0; j < numminerals; ++j)
+        Omega[j] = aprops.saturationRatio(table.minerals[j]);
+
+    // The properties of the distinct catalysts, computed once for all mechanisms
+    ArrayXr gvals(table.catalyst_fns.size());
+    for(auto j = 0; j < table.catalyst_fns.size(); ++j)
+        gvals[j] = table.catalyst_fns[j](props);
+
+    table.sums.setZero(numminerals);
+    for(auto i = 0; i < nummechanisms; ++i)
+    {
+        const auto& mechanism = table.mechanisms[i];
         const auto& p = mechanism.p.value();
         const auto& q = mechanism.q.value();
+        const auto& Omegai = Omega[table.imineral[i]];
 
-        const auto T = props.temperature();
-        const auto k0 = pow(10, lgk);
-        const auto k = k0 * exp(-E/R * (1.0/T - 1.0/298.15));
-
-        const auto Omega  = aprops.saturationRatio(mineral); // TODO: Find a way to determine the index of the mineral once in aprops.saturationSpecies to avoid index search in every call of Palandri-Kharaka model (overhead here should be minimal though compared to other operations).
-        const auto pOmega = p != 1.0 ? pow(Omega, p) : Omega;
+        const auto pOmega = p != 1.0 ? pow(Omegai, p) : Omegai;
         const auto qOmega = q != 1.0 ? pow(1 - pOmega, q) : 1 - pOmega;
 
         real g = 1.0;
-        for(auto const& catalystfn : catalyst_fns)
-            g *= catalystfn(props);
+        for(auto j = 0; j < table.icatalysts[i].size(); ++j)
+            g *= pow(gvals[table.icatalysts[i][j]], mechanism.catalysts[j].power.value());
+
+        table.sums[table.imineral[i]] += table.k[i] * qOmega * g;
+    }
+
+    table.props = &props;
+    table.stateid = props.stateid();
+}
+
+/// Construct a function that computes the sum of the contributions of all mechanisms in a mineral reaction rate (per unit of surface area).
+/// The mechanisms of all minerals registered in the same table of the given
+/// group are evaluated together, once for every new state in `props`, and the
+/// result of this mineral is read from the table.
+auto mineralMechanismsFnGrouped(SharedPtr<MineralRateGroup> const& group, Vec<Mechanism> const& mechanisms, ReactionRateModelGeneratorArgs args) -> Fn<real(ChemicalProps const&)>
+{
+    const auto position = mineralRateGroupRegister(*group, mechanisms, args);
+    const auto itable = position.first;
+    const auto imineral = position.second;
+
+    auto fn = [=](ChemicalProps const& props) -> real
+    {
+        std::lock_guard<std::mutex> lock(group->mutex);
 
-        return k * qOmega * g;
+        auto& table = group->tables[itable];
+
+        if(table.props != &props || table.stateid != props.stateid())
+            mineralRateTableEvaluate(table, props);
+
+        return table.sums[imineral];
     };
 
     return fn;
@@ -172,19 +459,14 @@ auto ReactionRateModelPalandriKharaka(ReactionRateModelParamsPalandriKharaka con
 {
     ReactionRateModelGenerator model = [=](ReactionRateModelGeneratorArgs args)
     {
-        Vec<Fn<real(ChemicalProps const&)>> mechanism_fns;
-        for(auto const& mechanism : params.mechanisms)
-            mechanism_fns.push_back(detail::mineralMechanismFn(mechanism, args));
+        const auto mechanismsfn = detail::mineralMechanismsFn(params.mechanisms, args);
 
         const auto imineralsurface = args.surfaces.indexWithName(args.name);
 
         ReactionRateModel fn = [=](ChemicalProps const& props) -> ReactionRate
         {
             const auto area = props.surfaceArea(imineralsurface);
-            real sum = 0.0;
-            for(auto const& mechanismfn : mechanism_fns)
-                sum += mechanismfn(props);
-            return area * sum;
+            return area * mechanismsfn(props);
         };
 
         return fn;
@@ -195,13 +477,26 @@ auto ReactionRateModelPalandriKharaka(ReactionRateModelParamsPalandriKharaka con
 
 auto ReactionRateModelPalandriKharaka(Vec<ReactionRateModelParamsPalandriKharaka> const& paramsvec) -> ReactionRateModelGenerator
 {
+    // The minerals whose rate models are produced by this generator, evaluated together for a same chemical state
+    const auto group = std::make_shared<detail::MineralRateGroup>();
+
     ReactionRateModelGenerator model = [=](ReactionRateModelGeneratorArgs args) -> ReactionRateModel
     {
         const auto mineral = args.name;
         const auto idx = indexfn(paramsvec, RKT_LAMBDA(x, x.mineral == mineral || contains(x.othernames, mineral)));
         errorif(idx >= paramsvec.size(), "Could not find a mineral with name `", mineral, "` in the provided set of Palandri-Kharaka parameters.");
-        const auto params = paramsvec[idx];
-        return ReactionRateModelPalandriKharaka(params)(args);
+
+        const auto mechanismsfn = detail::mineralMechanismsFnGrouped(group, paramsvec[idx].mechanisms, args);
+
+        const auto imineralsurface = args.surfaces.indexWithName(args.name);
+
+        ReactionRateModel fn = [=](ChemicalProps const& props) -> ReactionRate
+        {
+            const auto area = props.surfaceArea(imineralsurface);
+            return area * mechanismsfn(props);
+        };
+
+        return fn;
     };
 
     return model;
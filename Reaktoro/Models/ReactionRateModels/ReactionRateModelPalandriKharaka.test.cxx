@@ -126,4 +126,91 @@ TEST_CASE("Testing ReactionRateModelPalandriKharaka class", "[ReactionRateModelP
     const auto rate_actual = system.reaction(0).rate(props);
 
     CHECK( rate_actual == rate_expected );
+
+    // Check the rate constants cached for the last temperature are refreshed when temperature changes
+    ChemicalState warmstate(state);
+    warmstate.temperature(conditions.temperature + 30.0, "celsius");
+
+    ChemicalProps warmprops(warmstate);
+
+    const auto rate_warm = system.reaction(0).rate(warmprops);
+
+    CHECK( rate_warm != rate_actual );
+    CHECK( system.reaction(0).rate(props) == rate_expected );
+}
+
+TEST_CASE("Testing ReactionRateModelPalandriKharaka with several minerals evaluated together", "[ReactionRateModelPalandriKharaka]")
+{
+    ReactionRateModelParamsPalandriKharaka calcite;
+    calcite.mineral = "Calcite";
+    calcite.mechanisms = {{
+        { "Acid", -0.30, 14.4, 1.0, 1.0, {{"H+", "a", 1.0}} },
+        { "Neutral", -5.81, 23.5, 1.0, 1.0 },
+        { "Carbonate", -3.48, 35.4, 1.0, 1.0, {{"CO2", "P", 1.0}} }
+    }};
+
+    ReactionRateModelParamsPalandriKharaka magnesite;
+    magnesite.mineral = "Magnesite";
+    magnesite.mechanisms = {{
+        { "Acid", -6.38, 14.4, 1.0, 1.0, {{"H+", "a", 1.0}} },
+        { "Neutral", -9.34, 23.5, 1.0, 1.0 },
+        { "Carbonate", -5.22, 62.8, 1.0, 1.0, {{"CO2", "P", 1.0}} }
+    }};
+
+    SupcrtDatabase db("supcrtbl");
+
+    auto createSystem = [&](ReactionRateModelGenerator const& calcitemodel, ReactionRateModelGenerator const& magnesitemodel)
+    {
+        return ChemicalSystem(db,
+            AqueousPhase("H2O(aq) H+ OH- Ca+2 Mg+2 HCO3- CO3-2 CO2(aq)"),
+            GaseousPhase("CO2(g) N2(g)"),
+            MineralPhases("Calcite Magnesite"),
+            GeneralReaction("Calcite").setRateModel(calcitemodel),
+            GeneralReaction("Magnesite").setRateModel(magnesitemodel),
+            Surface("Calcite").withAreaModel([](ChemicalProps const&) { return 0.4; }),
+            Surface("Magnesite").withAreaModel([](ChemicalProps const&) { return 1.2; })
+        );
+    };
+
+    const auto grouped = ReactionRateModelPalandriKharaka(Vec<ReactionRateModelParamsPalandriKharaka>{ calcite, magnesite });
+
+    ChemicalSystem system = createSystem(grouped, grouped);
+    ChemicalSystem expectedsystem = createSystem(ReactionRateModelPalandriKharaka(calcite), ReactionRateModelPalandriKharaka(magnesite));
+
+    auto checkRates = [&](ChemicalState const& state)
+    {
+        ChemicalProps props(state);
+
+        ChemicalState expectedstate(expectedsystem);
+        expectedstate.setTemperature(state.temperature());
+        expectedstate.setPressure(state.pressure());
+        expectedstate.setSpeciesAmounts(state.speciesAmounts());
+
+        ChemicalProps expectedprops(expectedstate);
+
+        CHECK( system.reaction(0).rate(props) == Approx(expectedsystem.reaction(0).rate(expectedprops)) );
+        CHECK( system.reaction(1).rate(props) == Approx(expectedsystem.reaction(1).rate(expectedprops)) );
+    };
+
+    ChemicalState state(system);
+    state.temperature(50.0, "celsius");
+    state.pressure(10.0, "bar");
+    state.set("H2O(aq)", 1.0, "kg");
+    state.set("H+", 1e-5, "mol");
+    state.set("OH-", 1e-9, "mol");
+    state.set("Ca+2", 1e-3, "mol");
+    state.set("Mg+2", 1e-3, "mol");
+    state.set("CO3-2", 2e-3, "mol");
+    state.set("CO2(g)", 0.5, "mol");
+    state.set("N2(g)", 0.5, "mol");
+    state.set("Calcite", 1.0, "mol");
+    state.set("Magnesite", 1.0, "mol");
+
+    checkRates(state);
+
+    // Check the rates evaluated together are refreshed when the state changes
+    state.temperature(80.0, "celsius");
+    state.set("H+", 1e-3, "mol");
+
+    checkRates(state);
 }
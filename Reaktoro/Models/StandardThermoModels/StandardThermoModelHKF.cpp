@@ -23,15 +23,11 @@ using std::log;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
-#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroProps.hpp>
 #include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroPropsHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/WaterContext.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
-#include <Reaktoro/Water/WaterElectroProps.hpp>
-#include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
 #include <Reaktoro/Water/WaterInterpolation.hpp>
-#include <Reaktoro/Water/WaterThermoProps.hpp>
-#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
 namespace Reaktoro {
 namespace {
@@ -54,24 +50,6 @@ const auto theta = 228.0;
 /// The constant characteristics @eq{\Psi} of the solvent (in units of Pa)
 const auto psi = 2600.0e+05;
 
-/// Return a memoized function that computes thermodynamic properties of water using Wagner & Pruss (1999) model.
-auto createMemoizedWaterElectroPropsFnJohnsonNorton()
-{
-    Fn<WaterElectroProps(const real&, const real&)> fn = [](const real& T, const real& P)
-    {
-        const auto wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
-        return Reaktoro::waterElectroPropsJohnsonNorton(T, P, wtp);
-    };
-    return memoizeLast(fn);
-}
-
-/// Return the computed electrostatic properties of water at @p T and @p P using Johnson and Norton (1991) model.
-auto memoizedWaterElectroPropsJohnsonNorton(const real& T, const real& P) -> WaterElectroProps
-{
-    static thread_local auto fn = createMemoizedWaterElectroPropsFnJohnsonNorton();
-    return fn(T, P);
-}
-
 } // namespace
 
 /// Return a Vec<Param> object containing all Param objects in @p params.
@@ -93,6 +71,11 @@ auto createModelSerializer(const StandardThermoModelParamsHKF& params) -> ModelS
 }
 
 auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel
+{
+    return StandardThermoModelHKF(params, WaterThermoPropsModel::WagnerPruss);
+}
+
+auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params, WaterThermoPropsModel model) -> StandardThermoModel
 {
     waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid); // this call exists to force an initialization operation so that when waterThermoPropsWagnerPrussInterp is called for the first time, this initialization has been performed already.
 
@@ -101,10 +84,9 @@ auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> Stand
         auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
         const auto& [Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wr, charge, Tmax] = params;
 
-        const auto wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
-        const auto wep = memoizedWaterElectroPropsJohnsonNorton(T, P);
-        const auto gstate = gHKF::compute(T, P, wtp);
-        const auto aep = speciesElectroPropsHKF(gstate, params);
+        const auto wctx = waterContextMemoized(T, P, model);
+        const auto& wep = wctx.wep;
+        const auto aep = speciesElectroPropsHKF(wctx.gstate, params);
 
         const auto& w   = aep.w;
         const auto& wT  = aep.wT;
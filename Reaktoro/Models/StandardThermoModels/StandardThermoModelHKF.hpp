@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
 namespace Reaktoro {
 
@@ -65,4 +66,11 @@ struct StandardThermoModelParamsHKF
 /// Return a function that calculates thermodynamic properties of an aqueous solute using the HKF model.
 auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel;
 
+/// Return a function that calculates thermodynamic properties of an aqueous solute using the HKF model with a chosen equation of state for water.
+/// The thermodynamic properties of water, on which the model depends, are calculated with the
+/// Wagner and Pruss (1995) equation of state in @ref StandardThermoModelHKF(const StandardThermoModelParamsHKF&).
+/// Use WaterThermoPropsModel::IAPWSIF97 for a much faster evaluation with accuracy sufficient for most
+/// engineering applications. The same equation of state should be used for all aqueous species in a system.
+auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params, WaterThermoPropsModel model) -> StandardThermoModel;
+
 } // namespace Reaktoro
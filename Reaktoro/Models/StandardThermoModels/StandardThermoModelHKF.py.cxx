@@ -40,5 +40,6 @@ void exportStandardThermoModelHKF(py::module& m)
         .def_readwrite("Tmax",   &StandardThermoModelParamsHKF::Tmax)
         ;
 
-    m.def("StandardThermoModelHKF", StandardThermoModelHKF);
+    m.def("StandardThermoModelHKF", py::overload_cast<const StandardThermoModelParamsHKF&>(StandardThermoModelHKF));
+    m.def("StandardThermoModelHKF", py::overload_cast<const StandardThermoModelParamsHKF&, WaterThermoPropsModel>(StandardThermoModelHKF));
 }
@@ -21,14 +21,13 @@
 #include <cmath>
 
 // Reaktoro includes
+#include <Reaktoro/Models/StandardThermoModels/Support/MineralTemperatureTerms.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
 namespace Reaktoro {
 
 using std::exp;
-using std::log;
 using std::pow;
-using std::sqrt;
 
 /// Return a Vec<Param> object containing all Param objects in @p params.
 auto extractParams(const StandardThermoModelParamsHollandPowell& params) -> Vec<Param>
@@ -61,17 +60,14 @@ auto StandardThermoModelHollandPowell(const StandardThermoModelParamsHollandPowe
         // Auxiliary variables related to reference pressure Pr and reference temperature Tr
         const auto Pr   = 1.0e5;
         const auto Tr   = 298.15;
-        const auto Tr2  = Tr*Tr;
-        const auto Tr05 = sqrt(Tr);
 
-        // Auxiliary variables related to given temperature T
-        const auto T2  = T*T;
-        const auto T05 = sqrt(T);
+        // The temperature terms shared among all minerals at T (relative to reference temperature Tr)
+        const auto tt = mineralTemperatureTermsMemoized(T);
 
         // Compute the heat capacity and the integrals Cp*dT and Cp*d(lnT) according to equations in Fig. 4 of SUPCRTBL (2016)
-        const auto Cp     = MKa + MKb*T + MKc/T2 + MKd/T05;
-        const auto CpdT   = MKa*(T - Tr) + 0.5*MKb*(T2 - Tr2) - MKc*(1.0/T - 1.0/Tr) + 2.0*MKd*(T05 - Tr05);
-        const auto CpdlnT = MKa*log(T/Tr) + MKb*(T - Tr) - 0.5*MKc*(1/T2 - 1/Tr2) - 2.0*MKd*(1/T05 - 1/Tr05);
+        const auto Cp     = MKa + MKb*T + MKc*tt.invT2 + MKd*tt.invsqrtT;
+        const auto CpdT   = MKa*tt.dT + MKb*tt.dT2 - MKc*tt.dinvT + MKd*tt.dsqrtT;
+        const auto CpdlnT = MKa*tt.dlnT + MKb*tt.dT - MKc*tt.dinvT2 - MKd*tt.dinvsqrtT;
 
         // The volume of the substance to be calculated below
         real V = 0.0;
@@ -99,7 +95,7 @@ auto StandardThermoModelHollandPowell(const StandardThermoModelParamsHollandPowe
             const auto theta  = 10636.0/(Sr/numatoms + 6.44);
 
             // Define u = θ/T and u0 = θ/Tr (see equation below Fig 1 in Holland and Powell 2011)
-            const auto u  = theta/T;
+            const auto u  = theta*tt.invT;
             const auto u0 = theta/Tr;
 
             // Compute exp(u) and exp(u0) as they are used often
@@ -140,7 +136,7 @@ auto StandardThermoModelHollandPowell(const StandardThermoModelParamsHollandPowe
         }
 
         // Compute the standard properties unpacked from props
-        G0 = Gf - Sr*(T - Tr) + CpdT - T*CpdlnT + VdP; // see equation (2) of SUPCRTBL (2016)
+        G0 = Gf - Sr*tt.dT + CpdT - T*CpdlnT + VdP; // see equation (2) of SUPCRTBL (2016)
         H0 = Hf + CpdT + VdP; // similar to Maier-Kelley
         V0 = V;
         Cp0 = Cp;
@@ -18,6 +18,7 @@
 #include "StandardThermoModelInterpolation.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
@@ -53,14 +54,19 @@ auto StandardThermoModelInterpolation(const StandardThermoModelParamsInterpolati
     BilinearInterpolator iVP0(temperatures, pressures, params.VP0);
     BilinearInterpolator iCp0(temperatures, pressures, params.Cp0);
 
+    const auto nogrid = temperatures.empty() || pressures.empty();
+
     auto evalfn = [=](StandardThermoProps& props, real T, real P)
     {
-        if(!iG0.empty()) props.G0 = iG0(T, P);
-        if(!iH0.empty()) props.H0 = iH0(T, P);
-        if(!iV0.empty()) props.V0 = iV0(T, P);
-        if(!iVT0.empty()) props.VT0 = iVT0(T, P);
-        if(!iVP0.empty()) props.VP0 = iVP0(T, P);
-        if(!iCp0.empty()) props.Cp0 = iCp0(T, P);
+        // The interpolation cell is found once and shared by all properties, since they have the same coordinates
+        const auto cell = nogrid ? BilinearInterpolator::Cell{} : iG0.cell(T, P);
+
+        if(!iG0.empty()) props.G0 = iG0(cell);
+        if(!iH0.empty()) props.H0 = iH0(cell);
+        if(!iV0.empty()) props.V0 = iV0(cell);
+        if(!iVT0.empty()) props.VT0 = iVT0(cell);
+        if(!iVP0.empty()) props.VP0 = iVP0(cell);
+        if(!iCp0.empty()) props.Cp0 = iCp0(cell);
 
         props.G0 += props.V0 * (P - Pref);
     };
@@ -68,4 +74,50 @@ auto StandardThermoModelInterpolation(const StandardThermoModelParamsInterpolati
     return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params));
 }
 
+auto tabulateStandardThermoModel(const StandardThermoModel& model, const Vec<double>& temperatures, const Vec<double>& pressures) -> StandardThermoModelParamsInterpolation
+{
+    StandardThermoModelParamsInterpolation params;
+    params.temperatures = temperatures;
+    params.pressures = pressures;
+
+    const auto numT = temperatures.size();
+    const auto numP = pressures.size();
+
+    // The data rows correspond to pressures and the columns to temperatures, as expected by BilinearInterpolator
+    for(auto table : { &params.G0, &params.H0, &params.V0, &params.VT0, &params.VP0, &params.Cp0 })
+        table->assign(numP, Vec<double>(numT));
+
+    for(Index j = 0; j < numP; ++j)
+    {
+        const auto P = pressures[j];
+        for(Index i = 0; i < numT; ++i)
+        {
+            const auto T = temperatures[i];
+            const StandardThermoProps props = model(T, P);
+            params.G0[j][i]  = props.G0.val() - props.V0.val() * (P - params.Pref); // remove the volume correction added back in StandardThermoModelInterpolation
+            params.H0[j][i]  = props.H0.val();
+            params.V0[j][i]  = props.V0.val();
+            params.VT0[j][i] = props.VT0.val();
+            params.VP0[j][i] = props.VP0.val();
+            params.Cp0[j][i] = props.Cp0.val();
+        }
+    }
+
+    return params;
+}
+
+auto tabulateStandardThermoModels(const Database& db, const Vec<double>& temperatures, const Vec<double>& pressures) -> Database
+{
+    Vec<Species> species;
+    species.reserve(db.species().size());
+
+    for(const auto& s : db.species())
+    {
+        const auto params = tabulateStandardThermoModel(s.standardThermoModel(), temperatures, pressures);
+        species.push_back(s.withStandardThermoModel(StandardThermoModelInterpolation(params)));
+    }
+
+    return Database(db.elements().data(), species);
+}
+
 } // namespace Reaktoro
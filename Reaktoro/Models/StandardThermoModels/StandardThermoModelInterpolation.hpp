@@ -23,6 +23,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class Database;
+
 /// The parameters in the Maier-Kelley model for calculating standard thermodynamic properties of fluid and solid species.
 struct StandardThermoModelParamsInterpolation
 {
@@ -57,4 +60,22 @@ struct StandardThermoModelParamsInterpolation
 /// Return a function that calculates thermodynamic properties of a species using the Maier-Kelley model.
 auto StandardThermoModelInterpolation(const StandardThermoModelParamsInterpolation& params) -> StandardThermoModel;
 
+/// Return the parameters of an interpolation model tabulating the standard thermodynamic properties calculated with another model.
+/// The tabulated values of @f$G^{\circ}@f$ exclude the volume correction applied in
+/// StandardThermoModelInterpolation, so that the resulting model reproduces @p model
+/// on the grid points. The accuracy between grid points is controlled by the grid resolution.
+/// @param model The standard thermodynamic model to be tabulated
+/// @param temperatures The temperatures of the tabulation grid (in K)
+/// @param pressures The pressures of the tabulation grid (in Pa)
+auto tabulateStandardThermoModel(const StandardThermoModel& model, const Vec<double>& temperatures, const Vec<double>& pressures) -> StandardThermoModelParamsInterpolation;
+
+/// Return a copy of a database in which the standard thermodynamic model of every species is replaced by an interpolation over a temperature and pressure grid.
+/// This is useful for repeated calculations within a fixed temperature and pressure
+/// envelope, in which the evaluation of the original standard thermodynamic models
+/// (e.g., HKF, Holland-Powell, Maier-Kelley) is replaced by a bilinear interpolation.
+/// @param db The database whose species are tabulated
+/// @param temperatures The temperatures of the tabulation grid (in K)
+/// @param pressures The pressures of the tabulation grid (in Pa)
+auto tabulateStandardThermoModels(const Database& db, const Vec<double>& temperatures, const Vec<double>& pressures) -> Database;
+
 } // namespace Reaktoro
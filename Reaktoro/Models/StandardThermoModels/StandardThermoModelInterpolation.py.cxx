@@ -19,6 +19,7 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelInterpolation.hpp>
 using namespace Reaktoro;
 
@@ -37,4 +38,6 @@ void exportStandardThermoModelInterpolation(py::module& m)
         ;
 
     m.def("StandardThermoModelInterpolation", StandardThermoModelInterpolation);
+    m.def("tabulateStandardThermoModel", tabulateStandardThermoModel);
+    m.def("tabulateStandardThermoModels", tabulateStandardThermoModels);
 }
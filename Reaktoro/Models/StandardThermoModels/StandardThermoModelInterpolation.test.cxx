@@ -20,6 +20,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelInterpolation.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
 using namespace Reaktoro;
 
 TEST_CASE("Testing StandardThermoModelInterpolation class", "[StandardThermoModelInterpolation]")
@@ -71,3 +72,48 @@ TEST_CASE("Testing StandardThermoModelInterpolation class", "[StandardThermoMode
     CHECK( props.VP0 == 0.0 );
     CHECK( props.Cp0 == 0.0 );
 }
+
+TEST_CASE("Testing tabulateStandardThermoModel function", "[StandardThermoModelInterpolation]")
+{
+    // Parameters for CO2(g) from slop98.dat (converted to SI units)
+    StandardThermoModelParamsMaierKelley mkparams;
+    mkparams.Gf   = -394358.74;
+    mkparams.Hf   = -393509.38;
+    mkparams.Sr   =  213.73964;
+    mkparams.Vr   =  0.0;
+    mkparams.a    =  44.22488;
+    mkparams.b    =  0.0087864;
+    mkparams.c    = -861904.0;
+    mkparams.Tmax =  2500.0;
+
+    StandardThermoModel original = StandardThermoModelMaierKelley(mkparams);
+
+    const Vec<double> temperatures = { 300.0, 350.0, 400.0 };
+    const Vec<double> pressures = { 1.0e5, 1.0e7 };
+
+    const auto params = tabulateStandardThermoModel(original, temperatures, pressures);
+
+    CHECK( params.G0.size() == pressures.size() );
+    CHECK( params.G0.front().size() == temperatures.size() );
+
+    StandardThermoModel model = StandardThermoModelInterpolation(params);
+
+    StandardThermoProps expected, actual;
+
+    // CHECK THE INTERPOLATION REPRODUCES THE ORIGINAL MODEL ON THE GRID POINTS
+    expected = original(350.0, 1.0e7);
+    actual = model(350.0, 1.0e7);
+
+    CHECK( actual.G0  == Approx(expected.G0)  );
+    CHECK( actual.H0  == Approx(expected.H0)  );
+    CHECK( actual.V0  == Approx(expected.V0)  );
+    CHECK( actual.Cp0 == Approx(expected.Cp0) );
+
+    // CHECK THE INTERPOLATION IS CLOSE TO THE ORIGINAL MODEL BETWEEN THE GRID POINTS
+    expected = original(325.0, 5.0e6);
+    actual = model(325.0, 5.0e6);
+
+    CHECK( actual.G0  == Approx(expected.G0).epsilon(1e-3)  );
+    CHECK( actual.H0  == Approx(expected.H0).epsilon(1e-4)  );
+    CHECK( actual.Cp0 == Approx(expected.Cp0).epsilon(1e-2) );
+}
@@ -17,12 +17,8 @@
 
 #include "StandardThermoModelMaierKelley.hpp"
 
-// C++ includes
-#include <cmath>
-using std::log;
-
 // Reaktoro includes
-#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/MineralTemperatureTerms.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
 namespace Reaktoro {
@@ -54,18 +50,19 @@ auto StandardThermoModelMaierKelley(const StandardThermoModelParamsMaierKelley&
         auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
         const auto& [Gf, Hf, Sr, Vr, a, b, c, Tmax] = params;
 
-        const auto Tr = 298.15; // the reference temperature of 25 C (in K)
         const auto Pr = 1.0e5;  // the reference pressure of 1 bar (in Pa)
-        const auto R  = universalGasConstant;
 
-        const auto CpdT   = a*(T - Tr) + 0.5*b*(T*T - Tr*Tr) - c*(1.0/T - 1.0/Tr);
-        const auto CpdlnT = a*log(T/Tr) + b*(T - Tr) - 0.5*c*(1.0/(T*T) - 1.0/(Tr*Tr));
+        // The temperature terms shared among all minerals at T (relative to reference temperature Tr = 298.15 K)
+        const auto tt = mineralTemperatureTermsMemoized(T);
+
+        const auto CpdT   = a*tt.dT + b*tt.dT2 - c*tt.dinvT;
+        const auto CpdlnT = a*tt.dlnT + b*tt.dT - c*tt.dinvT2;
         const auto VdP    = Vr*(P - Pr);
 
         V0  = Vr;
-        G0  = Gf - Sr*(T - Tr) + CpdT - T*CpdlnT + VdP;
+        G0  = Gf - Sr*tt.dT + CpdT - T*CpdlnT + VdP;
         H0  = Hf + CpdT + VdP;
-        Cp0 = a + b*T + c/(T*T);
+        Cp0 = a + b*T + c*tt.invT2;
         VT0 = 0.0;
         VP0 = 0.0;
         // S0  = Sr + CpdlnT;
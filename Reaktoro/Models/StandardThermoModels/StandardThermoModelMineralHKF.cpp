@@ -22,7 +22,7 @@
 using std::log;
 
 // Reaktoro includes
-#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/MineralTemperatureTerms.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
 namespace Reaktoro {
@@ -64,67 +64,67 @@ auto StandardThermoModelMineralHKF(const StandardThermoModelParamsMineralHKF& pa
         const auto Tr = 298.15;  // The reference temperature (in K)
         const auto Pr = 1.0e+05; // The reference pressure (in Pa)
 
-        // Collect the temperature points used for the integrals along the pressure line P = Pr
-        Vec<real> Ti;
-        Ti.push_back(Tr);
-        for(int i = 0; i < ntr; ++i)
-            if(T > Ttr[i]) Ti.push_back(Ttr[i]);
-        Ti.push_back(T);
-
-        // Collect the pressure intercepts along the temperature line T for every phase transition boundary
-        Vec<real> Ptr;
-        for(int i = 0; i < ntr; ++i)
-        {
-            if(dPdTtr[i] != 0.0)
-                Ptr.push_back(Pr + dPdTtr[i]*(T - Ttr[i]));
-        }
+        // The temperature terms shared among all minerals at T (relative to reference temperature Tr)
+        const auto tt = mineralTemperatureTermsMemoized(T);
 
-        // Calculate the heat capacity of the mineral at T
-        real Cp = 0.0;
-        for(auto i = 0; i+1 < Ti.size(); ++i)
-            if(Ti[i] <= T && T <= Ti[i+1])
-                Cp = a[i] + b[i]*T + c[i]/(T*T); // Cp evaluated using coefficients of the appropriate interval (see `SUBROUTINE Cptrms` in supcrt92/reac92d.f)
-
-        // Calculate the integrals of the heat capacity function of the mineral from Tr to T at constant pressure Pr
+        // Calculate the integrals of the heat capacity function of the mineral from Tr to T at constant pressure Pr.
+        // The intervals between Tr and the crossed phase transition temperatures are integrated first, and then
+        // the last interval ending at T, which uses the temperature terms shared among all minerals.
         real CpdT = 0.0;
         real CpdlnT = 0.0;
-        for(auto i = 0; i+1 < Ti.size(); ++i)
-        {
-            const auto T0 = Ti[i];
-            const auto T1 = Ti[i+1];
-
-            CpdT += a[i]*(T1 - T0) + 0.5*b[i]*(T1*T1 - T0*T0) - c[i]*(1.0/T1 - 1.0/T0); // see `FUNCTION CpdT` in supcrt92/reac92d.f
-            CpdlnT += a[i]*log(T1/T0) + b[i]*(T1 - T0) - 0.5*c[i]*(1.0/(T1*T1) - 1.0/(T0*T0)); // see `FUNCTION CpdlnT` in supcrt92/reac92d.f
-        }
-
-        // Calculate the volume and other auxiliary quantities for the thermodynamic properties of the mineral
         real V = Vr;
         real GdH = 0.0; // last term in equation (82) of SUPCRT92 paper
         real HdH = 0.0; // last term in equation (79) of SUPCRT92 paper
         real SdH = 0.0; // last term in equation (80) of SUPCRT92 paper
-        for(unsigned i = 1; i+1 < Ti.size(); ++i)
+        real T0 = Tr;   // the temperature at the start of the current interval
+        auto k = 0;     // the index of the current interval
+        for(int i = 0; i < ntr; ++i)
         {
-            GdH += Htr[i-1]*(T - Ti[i])/Ti[i]; // see `SUBROUTINE pttrms` in supcrt92/reac92d.f
-            HdH += Htr[i-1];
-            SdH += Htr[i-1]/Ti[i];
+            if(!(T > Ttr[i]))
+                continue;
+
+            const real T1 = Ttr[i];
+
+            CpdT += a[k]*(T1 - T0) + 0.5*b[k]*(T1*T1 - T0*T0) - c[k]*(1.0/T1 - 1.0/T0); // see `FUNCTION CpdT` in supcrt92/reac92d.f
+            CpdlnT += a[k]*log(T1/T0) + b[k]*(T1 - T0) - 0.5*c[k]*(1.0/(T1*T1) - 1.0/(T0*T0)); // see `FUNCTION CpdlnT` in supcrt92/reac92d.f
+
+            GdH += Htr[k]*(T - T1)/T1; // see `SUBROUTINE pttrms` in supcrt92/reac92d.f
+            HdH += Htr[k];
+            SdH += Htr[k]/T1;
+
+            V += Vtr[k];
 
-            V += Vtr[i-1];
+            T0 = T1;
+            ++k;
         }
 
+        CpdT += a[k]*(T - T0) + 0.5*b[k]*(tt.T2 - T0*T0) - c[k]*(tt.invT - 1.0/T0);
+        CpdlnT += a[k]*(tt.lnT - log(T0)) + b[k]*(T - T0) - 0.5*c[k]*(tt.invT2 - 1.0/(T0*T0));
+
+        // Calculate the heat capacity of the mineral at T using the coefficients of the last interval (see `SUBROUTINE Cptrms` in supcrt92/reac92d.f)
+        const auto Cp = a[k] + b[k]*T + c[k]*tt.invT2;
+
         // Calculate the volume integral from Pr to P at constant temperature T
         real VdP = V*(P - Pr); // start with full VdP and decrease accordingly below due to phase transitions
-        for(unsigned i = 0; i < Ptr.size(); ++i)
+        auto j = 0; // the index of the current phase transition boundary with non-zero slope dP/dT
+        for(int i = 0; i < ntr; ++i)
         {
-            if(0.0 < Ptr[i] && Ptr[i] < P)
+            if(dPdTtr[i] == 0.0)
+                continue;
+
+            const auto Ptr = Pr + dPdTtr[i]*(T - Ttr[i]); // the pressure intercept along the temperature line T for the phase transition boundary
+
+            if(0.0 < Ptr && Ptr < P)
             {
-                V   -= Vtr[i];
-                VdP -= Vtr[i]*(P - Ptr[i]);
+                V   -= Vtr[j];
+                VdP -= Vtr[j]*(P - Ptr);
             }
+            ++j;
         }
 
         // Calculate the standard molal thermodynamic properties of the mineral
         V0 = V;
-        G0 = Gf - Sr*(T - Tr) + CpdT - T*CpdlnT + VdP - GdH;
+        G0 = Gf - Sr*tt.dT + CpdT - T*CpdlnT + VdP - GdH;
         H0 = Hf + CpdT + VdP + HdH;
         Cp0 = Cp;
         VT0 = 0.0;
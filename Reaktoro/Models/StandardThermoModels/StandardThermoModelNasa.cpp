@@ -19,9 +19,48 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The powers and logarithm of temperature in the NASA polynomials, which are the same for all species at a given temperature.
+struct NasaTemperatureBasis
+{
+    real T, T2, T3, T4, invT, invT2, lnT;
+};
+
+/// Return a memoized function that computes the powers and logarithm of temperature in the NASA polynomials.
+auto createMemoizedNasaTemperatureBasisFn()
+{
+    Fn<NasaTemperatureBasis(const real&)> fn = [](const real& T)
+    {
+        NasaTemperatureBasis res;
+        res.T     = T;
+        res.T2    = T*T;
+        res.T3    = T*res.T2;
+        res.T4    = T*res.T3;
+        res.invT  = 1.0/T;
+        res.invT2 = res.invT*res.invT;
+        res.lnT   = log(T);
+        return res;
+    };
+    return memoizeLast(fn);
+}
+
+/// Return the powers and logarithm of temperature in the NASA polynomials at @p T.
+/// Gaseous species using NASA polynomials are evaluated one after another at the
+/// same temperature, so memoizing this basis avoids recomputing the logarithm and
+/// divisions by temperature for every species in the phase.
+auto memoizedNasaTemperatureBasis(const real& T) -> NasaTemperatureBasis
+{
+    static thread_local auto fn = createMemoizedNasaTemperatureBasisFn();
+    return fn(T);
+}
+
+} // namespace
+
 namespace detail {
 
 auto indexTemperatureInterval(const Vec<StandardThermoModelParamsNasa::Polynomial>& polynomials, const real& T) -> Index
@@ -55,16 +94,20 @@ auto computeStandardThermoProps(const StandardThermoModelParamsNasa::Polynomial&
     const auto& b1 = polynomial.b1.value();
     const auto& b2 = polynomial.b2.value();
 
-    const auto T2 = T*T;
-    const auto T3 = T*T2;
-    const auto T4 = T*T3;
-    const auto lnT = log(T);
+    const auto basis = memoizedNasaTemperatureBasis(T);
+
+    const auto& T2    = basis.T2;
+    const auto& T3    = basis.T3;
+    const auto& T4    = basis.T4;
+    const auto& invT  = basis.invT;
+    const auto& invT2 = basis.invT2;
+    const auto& lnT   = basis.lnT;
 
     const auto R = universalGasConstant;
 
-    const auto Cp0 = ( a1/T2 + a2/T + a3 + a4*T + a5*T2 + a6*T3 + a7*T4) * R;
-    const auto H0  = (-a1/T2 + a2*lnT/T + a3 + a4*T/2.0 + a5*T2/3.0 + a6*T3/4.0 + a7*T4/5.0 + b1/T) * R*T;
-    const auto S0  = (-a1/T2*0.5 - a2/T + a3*lnT + a4*T + a5*T2/2.0 + a6*T3/3.0 + a7*T4/4.0 + b2) * R;
+    const auto Cp0 = ( a1*invT2 + a2*invT + a3 + a4*T + a5*T2 + a6*T3 + a7*T4) * R;
+    const auto H0  = (-a1*invT2 + a2*lnT*invT + a3 + a4*T/2.0 + a5*T2/3.0 + a6*T3/4.0 + a7*T4/5.0 + b1*invT) * R*T;
+    const auto S0  = (-a1*invT2*0.5 - a2*invT + a3*lnT + a4*T + a5*T2/2.0 + a6*T3/3.0 + a7*T4/4.0 + b2) * R;
 
     props.G0  = H0 - T*S0;
     props.H0  = H0;
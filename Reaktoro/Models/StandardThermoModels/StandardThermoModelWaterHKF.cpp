@@ -18,11 +18,11 @@
 #include "StandardThermoModelWaterHKF.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Models/StandardThermoModels/Support/WaterContext.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 #include <Reaktoro/Water/WaterInterpolation.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
-#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
 namespace Reaktoro {
 
@@ -44,6 +44,11 @@ auto createModelSerializer(const StandardThermoModelParamsWaterHKF& params) -> M
 }
 
 auto StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF& params) -> StandardThermoModel
+{
+    return StandardThermoModelWaterHKF(params, WaterThermoPropsModel::WagnerPruss);
+}
+
+auto StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF& params, WaterThermoPropsModel model) -> StandardThermoModel
 {
     waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid); // this call exists to force an initialization operation so that when waterThermoPropsWagnerPrussInterp is called for the first time, this initialization has been performed already.
 
@@ -52,7 +57,8 @@ auto StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF& params
         auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
         const auto& [Ttr, Str, Gtr, Htr] = params;
 
-        const auto wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
+        const auto wctx = waterContextMemoized(T, P, model);
+        const auto& wtp = wctx.wtp;
 
         // Convert from specific properties to molar properties
         const auto Sw = waterMolarMass * wtp.S; // from J/(kg*K) to J/(mol*K)
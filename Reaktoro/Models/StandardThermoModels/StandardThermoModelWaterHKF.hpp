@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
 namespace Reaktoro {
 
@@ -42,4 +43,11 @@ struct StandardThermoModelParamsWaterHKF
 /// Return a function that calculates thermodynamic properties of the aqueous solvent (water) using the HKF model.
 auto StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF& params) -> StandardThermoModel;
 
+/// Return a function that calculates thermodynamic properties of the aqueous solvent (water) using the HKF model with a chosen equation of state for water.
+/// The thermodynamic properties of water, on which the model depends, are calculated with the
+/// Wagner and Pruss (1995) equation of state in @ref StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF&).
+/// Use WaterThermoPropsModel::IAPWSIF97 for a much faster evaluation with accuracy sufficient for most
+/// engineering applications. The same equation of state should be used for all aqueous species in a system.
+auto StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF& params, WaterThermoPropsModel model) -> StandardThermoModel;
+
 } // namespace Reaktoro
@@ -32,5 +32,6 @@ void exportStandardThermoModelWaterHKF(py::module& m)
         .def_readwrite("Htr", &StandardThermoModelParamsWaterHKF::Htr)
         ;
 
-    m.def("StandardThermoModelWaterHKF", StandardThermoModelWaterHKF);
+    m.def("StandardThermoModelWaterHKF", py::overload_cast<const StandardThermoModelParamsWaterHKF&>(StandardThermoModelWaterHKF));
+    m.def("StandardThermoModelWaterHKF", py::overload_cast<const StandardThermoModelParamsWaterHKF&, WaterThermoPropsModel>(StandardThermoModelWaterHKF));
 }
@@ -0,0 +1,78 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MineralTemperatureTerms.hpp"
+
+// C++ includes
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+
+namespace Reaktoro {
+namespace {
+
+using std::log;
+using std::sqrt;
+
+/// Return a memoized function that computes the mineral temperature terms at given temperature.
+auto createMemoizedMineralTemperatureTermsFn()
+{
+    Fn<MineralTemperatureTerms(const real&)> fn = [](const real& T)
+    {
+        return MineralTemperatureTerms::compute(T);
+    };
+    return memoizeLast(fn);
+}
+
+} // namespace
+
+auto MineralTemperatureTerms::compute(real const& T) -> MineralTemperatureTerms
+{
+    const auto Tr         = 298.15; // the reference temperature of 25 C (in K)
+    const auto invTr      = 1.0/Tr;
+    const auto invTr2     = invTr*invTr;
+    const auto lnTr       = log(Tr);
+    const auto sqrtTr     = sqrt(Tr);
+    const auto invsqrtTr  = 1.0/sqrtTr;
+
+    MineralTemperatureTerms res;
+    res.T         = T;
+    res.T2        = T*T;
+    res.invT      = 1.0/T;
+    res.invT2     = res.invT*res.invT;
+    res.lnT       = log(T);
+    res.sqrtT     = sqrt(T);
+    res.invsqrtT  = 1.0/res.sqrtT;
+    res.dT        = T - Tr;
+    res.dT2       = 0.5*(res.T2 - Tr*Tr);
+    res.dinvT     = res.invT - invTr;
+    res.dinvT2    = 0.5*(res.invT2 - invTr2);
+    res.dlnT      = res.lnT - lnTr;
+    res.dsqrtT    = 2.0*(res.sqrtT - sqrtTr);
+    res.dinvsqrtT = 2.0*(res.invsqrtT - invsqrtTr);
+    return res;
+}
+
+auto mineralTemperatureTermsMemoized(real const& T) -> MineralTemperatureTerms
+{
+    static thread_local auto fn = createMemoizedMineralTemperatureTermsFn();
+    return fn(T);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,82 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Real.hpp>
+
+namespace Reaktoro {
+
+/// The temperature terms shared by the heat capacity integrals of the mineral standard thermodynamic models.
+/// These are the terms of the Maier-Kelley heat capacity function and its
+/// extensions (e.g., HKF minerals and Holland-Powell) that depend only on
+/// temperature, which are the same for all minerals in a system at a given
+/// temperature. The reference temperature used is Tr = 298.15 K.
+struct MineralTemperatureTerms
+{
+    /// The temperature *T* (in K).
+    real T;
+
+    /// The term *T²*.
+    real T2;
+
+    /// The term *1/T*.
+    real invT;
+
+    /// The term *1/T²*.
+    real invT2;
+
+    /// The term *ln(T)*.
+    real lnT;
+
+    /// The term *√T*.
+    real sqrtT;
+
+    /// The term *1/√T*.
+    real invsqrtT;
+
+    /// The term *T - Tr* in the integrals of *Cp*dT* and *Cp*d(lnT)*.
+    real dT;
+
+    /// The term *(T² - Tr²)/2* in the integral of *Cp*dT*.
+    real dT2;
+
+    /// The term *1/T - 1/Tr* in the integral of *Cp*dT*.
+    real dinvT;
+
+    /// The term *(1/T² - 1/Tr²)/2* in the integral of *Cp*d(lnT)*.
+    real dinvT2;
+
+    /// The term *ln(T/Tr)* in the integral of *Cp*d(lnT)*.
+    real dlnT;
+
+    /// The term *2(√T - √Tr)* in the integral of *Cp*dT*.
+    real dsqrtT;
+
+    /// The term *2(1/√T - 1/√Tr)* in the integral of *Cp*d(lnT)*.
+    real dinvsqrtT;
+
+    /// Compute the mineral temperature terms at given temperature.
+    static auto compute(real const& T) -> MineralTemperatureTerms;
+};
+
+/// Return the mineral temperature terms at given temperature, reusing them when they have been computed last at the same temperature.
+auto mineralTemperatureTermsMemoized(real const& T) -> MineralTemperatureTerms;
+
+} // namespace Reaktoro
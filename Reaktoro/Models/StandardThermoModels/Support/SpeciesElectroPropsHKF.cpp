@@ -20,6 +20,7 @@
 // C++ includes
 #include <cmath>
 using std::abs;
+using std::exp;
 using std::log;
 using std::pow;
 
@@ -80,12 +81,17 @@ auto gHKF::compute(real T, real P, const WaterThermoProps& wtp) -> gHKF
     const auto alphaP = -wtp.DTP/wtp.D - alpha*beta;
     const auto betaP  =  wtp.DPP/wtp.D - beta*beta;
 
-    g   =  ag * pow(1 - r, bg);
-    gT  =   g * (agT/ag + bgT*log(1 - r) + r*alpha*bg/(1 - r));
-    gP  =  -g * r*beta*bg/(1 - r);
-    gTT =   g * (agTT/ag - pow(agT/ag, 2) + bgTT*log(1 - r) + r*alpha*bg/(1 - r) * (2*bgT/bg + alphaT/alpha - alpha - r*alpha/(1 - r))) + gT*gT/g;
-    gTP =  gP * (bgT/bg - alpha - alphaP/beta - r*alpha/(1 - r)) + gP*gT/g;
-    gPP =  gP * (gP/g + beta + betaP/beta + r*beta/(1 - r));
+    // The subexpressions shared among g and its derivatives
+    const auto ln1r  = log(1 - r);
+    const auto r1r   = r/(1 - r);
+    const auto agTag = agT/ag;
+
+    g   =  ag * exp(bg*ln1r); // ag * (1 - r)^bg
+    gT  =   g * (agTag + bgT*ln1r + r1r*alpha*bg);
+    gP  =  -g * r1r*beta*bg;
+    gTT =   g * (agTT/ag - agTag*agTag + bgTT*ln1r + r1r*alpha*bg * (2*bgT/bg + alphaT/alpha - alpha - r1r*alpha)) + gT*gT/g;
+    gTP =  gP * (bgT/bg - alpha - alphaP/beta - r1r*alpha) + gP*gT/g;
+    gPP =  gP * (gP/g + beta + betaP/beta + r1r*beta);
 
     // Check if the point (T,P) is inside region II, as depicted in Fig. 6 of Shock and others (1992), on page 809
     if(TdegC > 155.0 && TdegC < 355.0 && Pbar < 1000.0)
@@ -151,13 +157,16 @@ auto speciesElectroPropsHKF(const gHKF& gstate, const StandardThermoModelParamsH
 
         const auto reref = z*z/(wref/eta + z/3.082);
         const auto re    = reref + abs(z) * g;
+        const auto z2    = z*z;
+        const auto ire   = 1.0/re;          // 1/re
+        const auto ig    = 1.0/(3.082 + g); // 1/(3.082 + g)
 
-        const auto X1 =  -eta * (abs(z*z*z)/(re*re) - z/pow(3.082 + g, 2));
-        const auto X2 = 2*eta * (z*z*z*z/(re*re*re) - z/pow(3.082 + g, 3));
+        const auto X1 =  -eta * (abs(z2*z)*ire*ire - z*ig*ig);
+        const auto X2 = 2*eta * (z2*z2*ire*ire*ire - z*ig*ig*ig);
 
         se.re    = re;
         se.reref = reref;
-        se.w     = eta * (z*z/re - z/(3.082 + g));
+        se.w     = eta * (z2*ire - z*ig);
         se.wT    = X1 * gT;
         se.wP    = X1 * gP;
         se.wTT   = X1 * gTT + X2 * gT * gT;
@@ -0,0 +1,58 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "WaterContext.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The number of distinct temperature and pressure conditions whose water context is cached in each thread.
+const auto cachesize = 4;
+
+/// Return a memoized function that computes the water context at given temperature and pressure.
+auto createMemoizedWaterContextFn()
+{
+    Fn<WaterContext(const real&, const real&, WaterThermoPropsModel)> fn = [](const real& T, const real& P, WaterThermoPropsModel model)
+    {
+        return WaterContext::compute(T, P, model);
+    };
+    return memoizeLRU(fn, cachesize);
+}
+
+} // namespace
+
+auto WaterContext::compute(real const& T, real const& P, WaterThermoPropsModel model) -> WaterContext
+{
+    WaterContext res;
+    res.wtp = waterThermoPropsMemoized(T, P, StateOfMatter::Liquid, model);
+    res.wep = waterElectroPropsJohnsonNorton(T, P, res.wtp);
+    res.gstate = gHKF::compute(T, P, res.wtp);
+    return res;
+}
+
+auto waterContextMemoized(real const& T, real const& P, WaterThermoPropsModel model) -> WaterContext
+{
+    static thread_local auto fn = createMemoizedWaterContextFn();
+    return fn(T, P, model);
+}
+
+} // namespace Reaktoro
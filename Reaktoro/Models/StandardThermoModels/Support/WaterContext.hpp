@@ -0,0 +1,56 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroPropsHKF.hpp>
+#include <Reaktoro/Water/WaterElectroProps.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+
+namespace Reaktoro {
+
+/// The state of liquid water at a given temperature and pressure shared by the HKF family of standard thermodynamic models.
+/// This gathers the thermodynamic and electrostatic properties of water and the
+/// HKF *g* function state, which are the same for all aqueous species in a
+/// system at given temperature and pressure.
+struct WaterContext
+{
+    /// The thermodynamic properties of liquid water computed with Wagner and Pruss (2002) model or another chosen equation of state.
+    WaterThermoProps wtp;
+
+    /// The electrostatic properties of liquid water computed with Johnson and Norton (1991) model.
+    WaterElectroProps wep;
+
+    /// The *g* function state of the HKF model.
+    gHKF gstate;
+
+    /// Compute the water context at given temperature and pressure.
+    /// The electrostatic properties and the *g* function state are both derived
+    /// from the same water thermodynamic properties, evaluated once in this call.
+    /// @param T The temperature of water (in K)
+    /// @param P The pressure of water (in Pa)
+    /// @param model The equation of state used for the thermodynamic properties of water
+    static auto compute(real const& T, real const& P, WaterThermoPropsModel model = WaterThermoPropsModel::WagnerPruss) -> WaterContext;
+};
+
+/// Return the water context at given temperature and pressure, reusing it when it has been recently computed at the same conditions.
+auto waterContextMemoized(real const& T, real const& P, WaterThermoPropsModel model = WaterThermoPropsModel::WagnerPruss) -> WaterContext;
+
+} // namespace Reaktoro
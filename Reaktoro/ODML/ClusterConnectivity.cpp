@@ -19,13 +19,37 @@
 
 // C++ includes
 #include <cassert>
-#include <limits>
+#include <numeric>
 
 namespace Reaktoro {
 
 ClusterConnectivity::ClusterConnectivity()
 {}
 
+auto ClusterConnectivity::withInitialTransitions(Vec<Pairs<Index, Index>> const& transitions, PriorityQueue const& queue) -> ClusterConnectivity
+{
+    assert(transitions.size() == queue.size());
+    ClusterConnectivity connectivity;
+    connectivity.queue = queue;
+    connectivity.rows.resize(transitions.size());
+    for(auto i = 0; i < transitions.size(); ++i)
+    {
+        auto& row = connectivity.rows[i];
+        Deque<Index> priorities;
+        for(auto const& [jcluster, count] : transitions[i])
+        {
+            assert(jcluster < queue.size() && jcluster != i);
+            row.local[jcluster] = row.clusters.size();
+            row.clusters.push_back(jcluster);
+            priorities.push_back(count);
+        }
+        Deque<Index> order(priorities.size());
+        std::iota(order.begin(), order.end(), 0);
+        row.queue = PriorityQueue::withInitialPrioritiesAndOrder(priorities, order);
+    }
+    return connectivity;
+}
+
 auto ClusterConnectivity::size() const -> Index
 {
     return queue.size();
@@ -33,26 +57,11 @@ auto ClusterConnectivity::size() const -> Index
 
 auto ClusterConnectivity::extend() -> void
 {
-    // Extend the priority queue in each row of the connectivity matrix of the clusters
-    for(auto& row : matrix)
-        row.extend();
+    // Create an empty row for the new cluster, which has not reached other clusters yet
+    rows.emplace_back();
 
     // Extend the priority queue that keeps track the most used clusters
     queue.extend();
-
-    // The ordering of the most used clusters that will be used for the new cluster
-    auto const& order = queue.order();
-
-    // Create priorities for the priority queue of the new cluster
-    Deque<Index> priorities(order.size(), 0);
-
-    // Set the priority of the new cluster (the last one) to infinity,
-    // to ensure it is always the first one to be visited as we
-    // go from cluster to cluster
-    priorities.back() = std::numeric_limits<Index>::infinity();
-
-    // Append the new priority queue for the new cluster
-    matrix.push_back(PriorityQueue::withInitialPrioritiesAndOrder(priorities, order));
 }
 
 auto ClusterConnectivity::increment(Index icluster, Index jcluster) -> void
@@ -60,17 +69,44 @@ auto ClusterConnectivity::increment(Index icluster, Index jcluster) -> void
     // Only jcluster needs to be bounded, because icluster >= size() has a specific logic
     assert(jcluster < size());
 
-    // Increment jcluster when starting from icluster (if icluster is below number of clusters!)
-    if(icluster < size())
-        matrix[icluster].increment(jcluster);
+    // Increment jcluster when starting from icluster (if icluster is below number of clusters and
+    // different from jcluster, since the starting cluster is always the first one to be visited)
+    if(icluster < size() && icluster != jcluster)
+    {
+        auto& row = rows[icluster];
+        auto [it, inserted] = row.local.try_emplace(jcluster, row.clusters.size());
+        if(inserted)
+        {
+            row.clusters.push_back(jcluster);
+            row.queue.extend();
+        }
+        row.queue.increment(it->second);
+    }
 
     // Increment usage count of jcluster
     queue.increment(jcluster);
 }
 
-auto ClusterConnectivity::order(Index icluster) const -> Deque<Index> const&
+auto ClusterConnectivity::order(Index icluster) const -> Deque<Index>
+{
+    Deque<Index> clusters;
+    visit(icluster, [&](Index jcluster) { clusters.push_back(jcluster); return false; });
+    return clusters;
+}
+
+auto ClusterConnectivity::transitions(Index icluster) const -> Pairs<Index, Index>
+{
+    assert(icluster < size());
+    auto const& row = rows[icluster];
+    Pairs<Index, Index> pairs;
+    for(auto k : row.queue.order())
+        pairs.emplace_back(row.clusters[k], row.queue.priorities()[k]);
+    return pairs;
+}
+
+auto ClusterConnectivity::usage() const -> PriorityQueue const&
 {
-    return icluster < size() ? matrix[icluster].order() : queue.order();
+    return queue;
 }
 
 } // namespace Reaktoro
@@ -24,12 +24,24 @@
 namespace Reaktoro {
 
 // The connectivity matrix of the clusters.
+// The connectivity is stored sparsely: for each starting cluster, only the
+// clusters actually reached from it (with their usage counts) are stored. The
+// order of visitation of the clusters from a starting cluster is the starting
+// cluster itself, followed by the clusters reached from it (the most used
+// first), and then the remaining clusters in the order of their usage counts.
+// Thus, the memory used and the cost of @ref extend grow with the number of
+// observed transitions between clusters instead of the number of clusters squared.
 class ClusterConnectivity
 {
 public:
     /// Construct a default instance of ClusterConnectivity.
     ClusterConnectivity();
 
+    /// Return a ClusterConnectivity instance with given transitions between clusters.
+    /// @param transitions The clusters reached from each starting cluster and their usage counts (see @ref transitions).
+    /// @param queue The priority queue of the clusters based on their usage counts.
+    static auto withInitialTransitions(Vec<Pairs<Index, Index>> const& transitions, PriorityQueue const& queue) -> ClusterConnectivity;
+
     /// Return number of currently tracked clusters.
     auto size() const -> Index;
 
@@ -45,15 +57,70 @@ public:
     /// ordering of clusters solely based on their usage counts is used instead.
     auto increment(Index icluster, Index jcluster) -> void;
 
+    /// Visit the clusters in their order for a given starting cluster until a given function returns true.
+    /// @param icluster The index of the starting cluster.
+    /// @param f The function called with the index of each visited cluster, returning true to stop the visitation.
+    /// @return True if the visitation was stopped by the given function.
+    /// @note If index `icluster` is equal or greater than number of clusters,
+    /// then the clusters are visited in the order based on their usage counts.
+    template<typename Function>
+    auto visit(Index icluster, Function const& f) const -> bool
+    {
+        if(icluster >= size())
+        {
+            for(auto jcluster : queue.order())
+                if(f(jcluster))
+                    return true;
+            return false;
+        }
+
+        auto const& row = rows[icluster];
+
+        if(f(icluster))
+            return true;
+
+        for(auto k : row.queue.order())
+            if(f(row.clusters[k]))
+                return true;
+
+        for(auto jcluster : queue.order())
+            if(jcluster != icluster && row.local.find(jcluster) == row.local.end())
+                if(f(jcluster))
+                    return true;
+
+        return false;
+    }
+
     /// Return the order of clusters for a given starting cluster.
     /// @param icluster The index of the starting cluster.
     /// @note If index `icluster` is equal or greater than number of clusters,
     /// then an ordering based on usage count of clusters is returned.
-    auto order(Index icluster) const -> Deque<Index> const&;
+    /// @note Prefer @ref visit, which does not assemble the order of all clusters.
+    auto order(Index icluster) const -> Deque<Index>;
+
+    /// Return the clusters reached from a starting cluster and their usage counts, in their order of visitation.
+    /// @param icluster The index of the starting cluster.
+    auto transitions(Index icluster) const -> Pairs<Index, Index>;
+
+    /// Return the priority queue of the clusters based on their usage counts.
+    auto usage() const -> PriorityQueue const&;
 
 private:
-    /// The connectivity of each cluster with others in terms of priority queue for visitation.
-    Deque<PriorityQueue> matrix;
+    /// The clusters reached from a starting cluster.
+    struct Row
+    {
+        /// The indices of the clusters reached from the starting cluster (in the order they were first reached).
+        Indices clusters;
+
+        /// The local index in #clusters of each cluster reached from the starting cluster.
+        Map<Index, Index> local;
+
+        /// The priority queue of the reached clusters (using their local indices) based on their usage counts.
+        PriorityQueue queue;
+    };
+
+    /// The clusters reached from each starting cluster.
+    Deque<Row> rows;
 
     /// The ordering of clusters based on their usage count.
     PriorityQueue queue;
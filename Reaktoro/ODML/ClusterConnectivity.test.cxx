@@ -0,0 +1,61 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/ClusterConnectivity.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ClusterConnectivity", "[ClusterConnectivity]")
+{
+    ClusterConnectivity connectivity;
+
+    connectivity.extend();
+    connectivity.extend();
+    connectivity.extend();
+    connectivity.extend();
+
+    CHECK( connectivity.size() == 4 );
+    CHECK( connectivity.order(2) == Deque<Index>{2, 0, 1, 3} );
+    CHECK( connectivity.transitions(2).empty() );
+
+    connectivity.increment(2, 3);
+    connectivity.increment(2, 1);
+    connectivity.increment(2, 1);
+    connectivity.increment(0, 0);
+
+    CHECK( connectivity.order(2) == Deque<Index>{2, 1, 3, 0} ); // the starting cluster first, then those reached from it (most used first), then the others
+    CHECK( connectivity.order(0) == Deque<Index>{0, 1, 3, 2} );
+    CHECK( connectivity.order(4) == Deque<Index>{1, 3, 0, 2} ); // the order based on the usage counts of the clusters
+    CHECK( connectivity.transitions(2) == Pairs<Index, Index>{{1, 2}, {3, 1}} );
+    CHECK( connectivity.transitions(0).empty() ); // the starting cluster is not stored among those reached from it
+
+    Index count = 0;
+    CHECK( connectivity.visit(2, [&](Index jcluster) { ++count; return jcluster == 3; }) );
+    CHECK( count == 3 );
+
+    Vec<Pairs<Index, Index>> transitions;
+    for(auto i = 0; i < connectivity.size(); ++i)
+        transitions.push_back(connectivity.transitions(i));
+
+    const auto copy = ClusterConnectivity::withInitialTransitions(transitions, connectivity.usage());
+
+    for(auto i = 0; i <= connectivity.size(); ++i)
+        CHECK( copy.order(i) == connectivity.order(i) );
+}
@@ -0,0 +1,172 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KdTree.hpp"
+
+// C++ includes
+#include <cassert>
+#include <queue>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+KdTree::KdTree()
+{}
+
+auto KdTree::size() const -> Index
+{
+    return _positions.size();
+}
+
+auto KdTree::dimension() const -> Index
+{
+    return _points.empty() ? 0 : _points.front().size();
+}
+
+auto KdTree::insert(VectorXdConstRef point) -> void
+{
+    errorif(!_points.empty() && point.size() != dimension(), "Expecting a point with dimension ", dimension(), " in KdTree::insert but got one with dimension ", point.size(), ".");
+
+    const auto identity = _positions.size();
+    const auto D = point.size();
+
+    _points.push_back(point);
+    _positions.push_back(_nodes.size());
+
+    if(_nodes.empty())
+    {
+        _nodes.push_back({ identity, 0 });
+        return;
+    }
+
+    // Descend the tree until an empty child position is found for the new point
+    Index inode = 0;
+    while(true)
+    {
+        auto& node = _nodes[inode];
+        auto const& x = _points[inode];
+        auto& child = point[node.axis] < x[node.axis] ? node.left : node.right;
+        if(child == Index(-1))
+        {
+            const auto axis = (node.axis + 1) % D;
+            child = _nodes.size();
+            _nodes.push_back({ identity, axis }); // note: node and child may be invalidated after this push_back
+            return;
+        }
+        inode = child;
+    }
+}
+
+auto KdTree::remove(Index identity) -> void
+{
+    assert(identity < size());
+
+    const auto last = size() - 1;
+
+    _nodes[_positions[identity]].identity = Index(-1);
+
+    // Let the point with the largest identity take the identity of the removed one
+    if(identity != last)
+    {
+        _positions[identity] = _positions[last];
+        _nodes[_positions[identity]].identity = identity;
+    }
+
+    _positions.pop_back();
+
+    // Rebuild the tree once most of its nodes belong to removed points, so that searches do not slow down
+    if(_nodes.size() > 2 * _positions.size())
+    {
+        Vec<VectorXd> points;
+        points.reserve(_positions.size());
+        for(auto inode : _positions)
+            points.push_back(std::move(_points[inode]));
+
+        _points.clear();
+        _nodes.clear();
+        _positions.clear();
+
+        for(auto const& point : points)
+            insert(point);
+    }
+}
+
+auto KdTree::nearest(VectorXdConstRef point, Index k) const -> Indices
+{
+    if(_nodes.empty() || k == 0)
+        return {};
+
+    errorif(point.size() != dimension(), "Expecting a point with dimension ", dimension(), " in KdTree::nearest but got one with dimension ", point.size(), ".");
+
+    // The max-heap with the k nearest points found so far as pairs (squared distance, identity)
+    std::priority_queue<Pair<double, Index>> best;
+
+    // The recursive search that visits first the side of the splitting plane containing the point
+    Fn<void(Index)> search = [&](Index inode)
+    {
+        if(inode == Index(-1))
+            return;
+
+        auto const& node = _nodes[inode];
+        auto const& x = _points[inode];
+
+        const auto dist2 = (x - point).squaredNorm();
+
+        // Skip the point if it has been removed (its node remains in the tree for its splitting plane)
+        if(node.identity != Index(-1))
+        {
+            if(best.size() < k)
+                best.push({ dist2, node.identity });
+            else if(dist2 < best.top().first)
+            {
+                best.pop();
+                best.push({ dist2, node.identity });
+            }
+        }
+
+        const auto delta = point[node.axis] - x[node.axis];
+        const auto near = delta < 0.0 ? node.left : node.right;
+        const auto far = delta < 0.0 ? node.right : node.left;
+
+        search(near);
+
+        // Visit the other side only if the splitting plane is closer than the farthest of the best points so far
+        if(best.size() < k || delta*delta < best.top().first)
+            search(far);
+    };
+
+    search(0);
+
+    Indices identities(best.size());
+    for(auto i = identities.size(); i > 0; --i)
+    {
+        identities[i - 1] = best.top().second;
+        best.pop();
+    }
+
+    return identities;
+}
+
+auto KdTree::point(Index identity) const -> VectorXdConstRef
+{
+    assert(identity < size());
+    return _points[_positions[identity]];
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,92 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// A k-dimensional tree for nearest neighbor searches among points inserted incrementally.
+/// The points are identified by the order in which they are inserted (i.e.,
+/// the first point has identity 0, the second 1, and so on), matching the
+/// indices of the records stored alongside in a container. When a point is
+/// removed, the point with the largest identity takes its identity, as in a
+/// container whose last element is moved into the place of a removed one.
+/// Points are compared using the Euclidean distance.
+class KdTree
+{
+public:
+    /// Construct a default instance of KdTree.
+    KdTree();
+
+    /// Return the number of points in the tree.
+    auto size() const -> Index;
+
+    /// Return the dimension of the points in the tree (zero if the tree is empty).
+    auto dimension() const -> Index;
+
+    /// Insert a new point in the tree with identity equal to the current size of the tree.
+    /// @param point The coordinates of the point (must have the same dimension of previously inserted points).
+    auto insert(VectorXdConstRef point) -> void;
+
+    /// Remove a point from the tree, with the point of largest identity taking its identity.
+    /// The node of the removed point is kept in the tree for its splitting
+    /// plane, but skipped in searches, until the tree is rebuilt once most of
+    /// its nodes belong to removed points.
+    /// @param identity The identity of the point in the tree.
+    auto remove(Index identity) -> void;
+
+    /// Return the identities of the `k` nearest points to a given point, from the nearest to the farthest.
+    /// @param point The coordinates of the point whose nearest neighbors are searched.
+    /// @param k The maximum number of nearest neighbors to be returned.
+    auto nearest(VectorXdConstRef point, Index k) const -> Indices;
+
+    /// Return the coordinates of a point in the tree.
+    /// @param identity The identity of the point in the tree.
+    auto point(Index identity) const -> VectorXdConstRef;
+
+private:
+    /// The node of the tree containing one point.
+    struct Node
+    {
+        /// The identity of the point stored in this node, or `Index(-1)` if the point has been removed.
+        Index identity;
+
+        /// The coordinate used to split the space at this node.
+        Index axis;
+
+        /// The index of the left child node (with smaller coordinate along #axis), or `Index(-1)` if none.
+        Index left = Index(-1);
+
+        /// The index of the right child node (with greater or equal coordinate along #axis), or `Index(-1)` if none.
+        Index right = Index(-1);
+    };
+
+    /// The coordinates of the points in the nodes of the tree, in the order of the nodes.
+    Vec<VectorXd> _points;
+
+    /// The nodes of the tree (the root node is the first).
+    Vec<Node> _nodes;
+
+    /// The index of the node of each point in the tree, with the identities of the points as indices.
+    Indices _positions;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,123 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/KdTree.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing KdTree", "[KdTree]")
+{
+    KdTree tree;
+
+    CHECK( tree.size() == 0 );
+    CHECK( tree.dimension() == 0 );
+    CHECK( tree.nearest(VectorXd::Zero(3), 5).empty() );
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    auto randompoint = [&]() -> VectorXd
+    {
+        VectorXd x(3);
+        for(auto i = 0; i < 3; ++i)
+            x[i] = distribution(generator);
+        return x;
+    };
+
+    const auto numpoints = 500;
+
+    for(auto i = 0; i < numpoints; ++i)
+        tree.insert(randompoint());
+
+    CHECK( tree.size() == numpoints );
+    CHECK( tree.dimension() == 3 );
+
+    // Compare the nearest neighbors found using the tree with those found by brute force
+    for(auto k : { 1, 4, 10 })
+    {
+        for(auto j = 0; j < 20; ++j)
+        {
+            const VectorXd x = randompoint();
+
+            Indices expected(numpoints);
+            std::iota(expected.begin(), expected.end(), 0);
+            std::sort(expected.begin(), expected.end(), [&](Index a, Index b) {
+                return (tree.point(a) - x).squaredNorm() < (tree.point(b) - x).squaredNorm(); });
+            expected.resize(k);
+
+            CHECK( tree.nearest(x, k) == expected );
+        }
+    }
+
+    // Check the nearest point to an inserted point is itself
+    CHECK( tree.nearest(tree.point(42), 1) == Indices{42} );
+
+    // Check at most the number of points in the tree are returned
+    CHECK( tree.nearest(VectorXd::Zero(3), 2 * numpoints).size() == numpoints );
+
+    // Remove points, with the last point taking the identity of each removed one, and compare the nearest neighbors with those found by brute force
+    std::uniform_int_distribution<Index> removal(0, numpoints - 1);
+
+    Vec<VectorXd> remaining;
+    for(auto i = 0; i < numpoints; ++i)
+        remaining.push_back(tree.point(i));
+
+    const VectorXd last = tree.point(numpoints - 1);
+    tree.remove(7);
+    remaining[7] = remaining.back();
+    remaining.pop_back();
+
+    CHECK( tree.size() == numpoints - 1 );
+    CHECK( tree.point(7) == last );
+    CHECK( tree.nearest(last, 1) == Indices{7} );
+
+    while(tree.size() > numpoints / 10) // removing most points also rebuilds the tree
+    {
+        const auto identity = removal(generator) % tree.size();
+        tree.remove(identity);
+        remaining[identity] = remaining.back();
+        remaining.pop_back();
+    }
+
+    for(auto j = 0; j < 20; ++j)
+    {
+        const VectorXd x = randompoint();
+
+        Indices expected(remaining.size());
+        std::iota(expected.begin(), expected.end(), 0);
+        std::sort(expected.begin(), expected.end(), [&](Index a, Index b) {
+            return (remaining[a] - x).squaredNorm() < (remaining[b] - x).squaredNorm(); });
+        expected.resize(4);
+
+        CHECK( tree.nearest(x, 4) == expected );
+    }
+
+    for(auto i = 0; i < remaining.size(); ++i)
+        CHECK( tree.point(i) == remaining[i] );
+
+    // Check points with wrong dimension are rejected
+    CHECK_THROWS( tree.insert(VectorXd::Zero(2)) );
+    CHECK_THROWS( tree.nearest(VectorXd::Zero(4), 1) );
+}
@@ -33,6 +33,7 @@ auto PriorityQueue::withInitialSize(Index size) -> PriorityQueue
     queue._priorities.resize(size, 0);
     queue._order.resize(size);
     std::iota(queue._order.begin(), queue._order.end(), 0);
+    queue.updatePositions();
     return queue;
 }
 
@@ -41,8 +42,9 @@ auto PriorityQueue::withInitialPriorities(Deque<Index> const& priorities) -> Pri
     const auto size = priorities.size();
     PriorityQueue queue = PriorityQueue::withInitialSize(size);
     queue._priorities = priorities;
-    std::sort(queue._order.begin(), queue._order.end(),
+    std::stable_sort(queue._order.begin(), queue._order.end(),
         [&](Index l, Index r) { return priorities[l] > priorities[r]; });
+    queue.updatePositions();
     return queue;
 }
 
@@ -52,6 +54,7 @@ auto PriorityQueue::withInitialOrder(Deque<Index> const& order) -> PriorityQueue
     PriorityQueue queue;
     queue._priorities.resize(size, 0);
     queue._order = order;
+    queue.updatePositions();
     return queue;
 }
 
@@ -63,6 +66,7 @@ auto PriorityQueue::withInitialPrioritiesAndOrder(Deque<Index> const& priorities
     queue._order = order;
     std::stable_sort(queue._order.begin(), queue._order.end(),
         [&](Index l, Index r) { return priorities[l] > priorities[r]; });
+    queue.updatePositions();
     return queue;
 }
 
@@ -75,42 +79,90 @@ auto PriorityQueue::reset() -> void
 {
     std::fill(_priorities.begin(), _priorities.end(), 0);
     std::iota(_order.begin(), _order.end(), 0);
+    updatePositions();
 }
 
 auto PriorityQueue::increment(Index identity) -> void
 {
     // == EXAMPLE OF WHAT HAPPENS IN THIS METHOD ==
-    // PRIORITIES BEFORE INCREMENTING: 13  5  3  2  2 (2) 1  --- incrementing from 2 to 3
-    //  PRIORITIES AFTER INCREMENTING: 13  5  3 [2] 2 (3) 1  --- (3) needs to be swapped with [2]
-    //       PRIORITIES AFTER SORTING: 13  5  3 (3) 2 [2] 1
-    _priorities[identity] += 1;
-
-    // == CORNER CASES:
-    // IF identity = 0 (the priority of the very first element is increased)
-    // NO SORTING IS APPLIED (THE CHANGE IN PRIORITIES DIDN'T AFFECT THE ORDER)
-    // PRIORITIES BEFORE INCREMENTING: (13)  5  3  2  2  2  1    --- incrementing from 13 to 14
-    //  PRIORITIES AFTER INCREMENTING: (14)  5  3  2  2  3  1  --- (14) does not need to be swapped with anyone
-
-    // == CORNER CASES:
-    // IF _priorities[identity - 1] >= _priorities[identity]
-    // NO SORTING IS APPLIED (THE CHANGE IN PRIORITIES DIDN'T AFFECT THE ORDER)
-    // PRIORITIES BEFORE INCREMENTING: 13  5 (3)  2  2  2  1    --- incrementing from 3 to 4
-    //  PRIORITIES AFTER INCREMENTING: 13  5 (4)  2  2  3  1  --- (4) is still smaller than 5, it does not need to be swapped with anyone
-
-    // Avoid sorting if the identity == 0 (the priority of the very first element is increased)
-    // or if the increase of priority does not ruin the order in _priorities
-    if(!((identity == 0) || (_priorities[identity - 1] >= _priorities[identity]))){
-        std::sort(_order.begin(), _order.begin() + identity + 1,
-                  [&](Index l, Index r) { return _priorities[l] > _priorities[r]; });
-    }
-    //std::sort(_order.begin(), _order.begin() + identity + 1,
-    //    [&](Index l, Index r) { return _priorities[l] > _priorities[r]; });
+    //   PRIORITIES BEFORE INCREMENTING: 13  5  3 [2] 2 (2) 1  --- incrementing (2) from 2 to 3, [2] is the first entity with priority 2
+    //   PRIORITIES AFTER SWAPPING (2) and [2]: 13  5  3 (2) 2 [2] 1
+    //   PRIORITIES AFTER INCREMENTING: 13  5  3 (3) 2 [2] 1  --- (3) is now the last entity with priority 3
+    // The first position of the entities with priority 2 is moved one position
+    // forward, and that of the entities with priority 3 is set to the position
+    // of (3) if there was no entity with priority 3 before.
+    assert(identity < size());
+
+    const auto priority = _priorities[identity];
+    const auto position = _positions[identity];
+
+    auto it = _starts.find(priority);
+    assert(it != _starts.end());
+
+    const auto first = it->second;
+    const auto other = _order[first];
+
+    // Swap the entity with the first one with the same priority
+    std::swap(_order[first], _order[position]);
+    _positions[other] = position;
+    _positions[identity] = first;
+
+    // Remove the entity from the group of entities with its current priority
+    if(first + 1 < _order.size() && _priorities[_order[first + 1]] == priority)
+        it->second = first + 1;
+    else _starts.erase(it);
+
+    // Add the entity at the end of the group of entities with the next priority
+    _priorities[identity] = priority + 1;
+    _starts.emplace(priority + 1, first); // no effect if there are entities with the next priority (they come before the entity)
 }
 
 auto PriorityQueue::extend() -> void
 {
+    const auto identity = _priorities.size();
     _priorities.push_back(0);
-    _order.push_back(_order.size());
+    _order.push_back(identity);
+    _positions.push_back(identity);
+    _starts.emplace(0, identity); // no effect if there are entities with zero priority (they come before the new one)
+}
+
+auto PriorityQueue::remove(Index identity) -> void
+{
+    assert(identity < size());
+    _priorities.erase(_priorities.begin() + identity);
+    _order.erase(_order.begin() + _positions[identity]);
+    for(auto& i : _order)
+        if(i > identity)
+            --i;
+    updatePositions();
+}
+
+auto PriorityQueue::removeLast() -> Index
+{
+    assert(size() > 0);
+
+    const auto identity = _order.back();
+    const auto last = size() - 1;
+
+    // Remove the entity from the end of the order, and its priority from the first positions if no other entity has it
+    _order.pop_back();
+    auto it = _starts.find(_priorities[identity]);
+    assert(it != _starts.end());
+    if(it->second == _order.size())
+        _starts.erase(it);
+
+    // Let the entity with the largest identity take the identity of the removed one
+    if(identity != last)
+    {
+        _priorities[identity] = _priorities[last];
+        _positions[identity] = _positions[last];
+        _order[_positions[identity]] = identity;
+    }
+
+    _priorities.pop_back();
+    _positions.pop_back();
+
+    return identity;
 }
 
 auto PriorityQueue::priorities() const -> Deque<Index> const&
@@ -123,4 +175,15 @@ auto PriorityQueue::order() const -> Deque<Index> const&
     return _order;
 }
 
+auto PriorityQueue::updatePositions() -> void
+{
+    _positions.resize(_order.size());
+    _starts.clear();
+    for(auto i = 0; i < _order.size(); ++i)
+    {
+        _positions[_order[i]] = i;
+        _starts.emplace(_priorities[_order[i]], i); // only the first position of each priority is inserted
+    }
+}
+
 } // namespace Reaktoro
@@ -23,6 +23,11 @@
 namespace Reaktoro {
 
 // A queue organized based on priorities that can change dynamically.
+// The tracked entities with equal priorities occupy contiguous positions in
+// the order of the queue, and the first position of each of these groups is
+// stored. This permits the priority of an entity to be incremented in
+// constant time, by swapping it with the first entity of its group, which
+// then becomes the last entity of the group with the next priority.
 class PriorityQueue
 {
 public:
@@ -50,12 +55,27 @@ public:
     auto reset() -> void;
 
     /// Increment the priority of a tracked entity.
+    /// This operation has constant complexity. Among the entities with equal
+    /// priorities, those that attained their priority earlier come first.
     /// @param identity The index of the tracked entity.
     auto increment(Index identity) -> void;
 
     /// Extend the queue with the introduction of a new tracked entity.
     auto extend() -> void;
 
+    /// Remove a tracked entity from the queue.
+    /// The identities of the tracked entities after the removed one are decremented by one.
+    /// @param identity The index of the tracked entity.
+    auto remove(Index identity) -> void;
+
+    /// Remove the last tracked entity in the order of the queue (one with the lowest priority).
+    /// The tracked entity with the largest identity takes the identity of the
+    /// removed one, so that the identities remain contiguous, as in a container
+    /// whose last element is moved into the place of a removed one. This
+    /// operation has constant complexity, unlike @ref remove.
+    /// @return The identity of the removed entity.
+    auto removeLast() -> Index;
+
     /// Return the current priorities of each tracked entity in the queue.
     auto priorities() const -> Deque<Index> const&;
 
@@ -68,6 +88,15 @@ private:
 
     /// The order of the tracked entities based on their current priorities.
     Deque<Index> _order;
+
+    /// The position of each tracked entity in the order of the queue.
+    Deque<Index> _positions;
+
+    /// The first position in the order of the queue of the tracked entities with a given priority.
+    Map<Index, Index> _starts;
+
+    /// Update the positions of the tracked entities and the first positions of each priority from their current order.
+    auto updatePositions() -> void;
 };
 
 } // namespace Reaktoro
@@ -0,0 +1,120 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <random>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/PriorityQueue.hpp>
+using namespace Reaktoro;
+
+/// Check if the order of the entities in a priority queue is consistent with their priorities.
+auto isConsistentPriorityQueue(PriorityQueue const& queue) -> bool
+{
+    auto const& priorities = queue.priorities();
+    auto const& order = queue.order();
+
+    if(order.size() != priorities.size())
+        return false;
+
+    Deque<bool> found(order.size(), false);
+    for(auto i : order)
+    {
+        if(i >= order.size() || found[i])
+            return false;
+        found[i] = true;
+    }
+
+    for(auto i = 1; i < order.size(); ++i)
+        if(priorities[order[i - 1]] < priorities[order[i]])
+            return false;
+
+    return true;
+}
+
+TEST_CASE("Testing PriorityQueue", "[PriorityQueue]")
+{
+    PriorityQueue queue = PriorityQueue::withInitialSize(5);
+
+    CHECK( queue.size() == 5 );
+    CHECK( queue.order() == Deque<Index>{0, 1, 2, 3, 4} );
+
+    queue.increment(3);
+
+    CHECK( queue.priorities() == Deque<Index>{0, 0, 0, 1, 0} );
+    CHECK( queue.order() == Deque<Index>{3, 1, 2, 0, 4} );
+
+    queue.increment(4);
+
+    CHECK( queue.priorities() == Deque<Index>{0, 0, 0, 1, 1} );
+    CHECK( queue.order() == Deque<Index>{3, 4, 2, 0, 1} ); // entity 4 attained priority 1 after entity 3
+
+    queue.increment(4);
+
+    CHECK( queue.order().front() == 4 );
+
+    queue.extend();
+
+    CHECK( queue.size() == 6 );
+    CHECK( queue.order().back() == 5 );
+
+    queue.remove(3);
+
+    CHECK( queue.size() == 5 );
+    CHECK( queue.priorities() == Deque<Index>{0, 0, 0, 2, 0} );
+    CHECK( queue.order().front() == 3 );
+    CHECK( isConsistentPriorityQueue(queue) );
+
+    queue.reset();
+
+    CHECK( queue.priorities() == Deque<Index>{0, 0, 0, 0, 0} );
+    CHECK( queue.order() == Deque<Index>{0, 1, 2, 3, 4} );
+
+    queue = PriorityQueue::withInitialPriorities({1, 3, 0, 3});
+
+    CHECK( queue.order() == Deque<Index>{1, 3, 0, 2} );
+
+    CHECK( queue.removeLast() == 2 ); // entity 3 takes the identity of the removed entity 2
+    CHECK( queue.priorities() == Deque<Index>{1, 3, 3} );
+    CHECK( queue.order() == Deque<Index>{1, 2, 0} );
+
+    queue.increment(0);
+
+    CHECK( queue.removeLast() == 0 ); // entity 2 takes the identity of the removed entity 0
+    CHECK( queue.priorities() == Deque<Index>{3, 3} );
+    CHECK( queue.order() == Deque<Index>{1, 0} );
+    CHECK( isConsistentPriorityQueue(queue) );
+
+    std::mt19937 generator(11);
+
+    for(auto i = 0; i < 1000; ++i)
+    {
+        if(i % 10 == 0)
+            queue.extend();
+        std::uniform_int_distribution<Index> distribution(0, queue.size() - 1);
+        queue.increment(distribution(generator));
+        if(i % 100 == 0)
+            queue.remove(distribution(generator));
+        if(i % 100 == 50)
+            queue.removeLast();
+    }
+
+    CHECK( isConsistentPriorityQueue(queue) );
+}
@@ -26,6 +26,7 @@ void exportKinetics(py::module& m);
 void exportModels(py::module& m);
 void exportSerialization(py::module& m);
 void exportSingletons(py::module& m);
+void exportTransport(py::module& m);
 void exportUtils(py::module& m);
 void exportWater(py::module& m);
 
@@ -39,6 +40,7 @@ PYBIND11_MODULE(reaktoro4py, m)
     exportModels(m);
     exportSerialization(m);
     exportSingletons(m);
+    exportTransport(m);
     exportUtils(m);
     exportWater(m);
 }
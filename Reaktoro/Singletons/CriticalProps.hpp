@@ -146,12 +146,21 @@ private:
     /// The default critical properties for substances not in the database.
     Optional<SubstanceCriticalProps> m_default_crprops;
 
+    /// The indices of the substances in the database with given names (or aliases).
+    Map<String, Index> m_index;
+
 private:
     /// Construct a default CriticalProps object [private].
     CriticalProps();
 
     /// Destroy this CriticalProps object [private].
     ~CriticalProps();
+
+    /// Return the index of the first substance in the database with one of the given corrected names or number of substances if not found [private].
+    auto findAny(Strings const& names) const -> Index;
+
+    /// Rebuild the indices of the substances in the database with given names [private].
+    auto reindex() -> void;
 };
 
 } // namespace Reaktoro
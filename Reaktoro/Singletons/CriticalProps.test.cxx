@@ -207,6 +207,9 @@ TEST_CASE("Testing CriticalProps", "[CriticalProps]")
     REQUIRE( withName::pressure("HCl")       == Approx(150.0e+5) );
     REQUIRE( withName::acentricFactor("HCl") == Approx(0.9999)   );
 
+    REQUIRE( withName::temperature("hydrochloric acid") == Approx(473.15) ); // the new alias is also found after the overwrite
+    REQUIRE( CriticalProps::find("HCl") == CriticalProps::find("HYDROCHLORIC-ACID") );
+
     REQUIRE_NOTHROW( CriticalProps::setMissingAs("H2") ); // set default properties for missing substances as that of H2
 
     REQUIRE( withName::temperature("InexistentSubstance") == withName::temperature("H2") );
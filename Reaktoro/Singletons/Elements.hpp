@@ -80,10 +80,19 @@ private:
     /// The elements stored in the periodic table.
     Vec<Element> m_elements;
 
+    /// The indices of the elements in the periodic table with given symbols.
+    Map<String, Index> m_index_symbol;
+
+    /// The indices of the elements in the periodic table with given names.
+    Map<String, Index> m_index_name;
+
 private:
     /// Construct a default Elements object [private].
     Elements();
 
+    /// Append a custom element to the periodic table of a given Elements object [private].
+    static auto append(Elements& obj, Element element) -> void;
+
     /// Destroy this Elements object [private].
     ~Elements();
 };
@@ -156,6 +156,9 @@ TEST_CASE("Testing Elements", "[Elements]")
     Elements::append(Element().withSymbol("Bb").withTags({"tag1", "tag3"}));
     Elements::append(Element().withSymbol("Cc").withTags({"tag1"}));
 
+    REQUIRE(Elements::withSymbol("Aa"));
+    REQUIRE(Elements::withSymbol("Cc").value().tags() == Strings{"tag1"});
+
     const auto elements_with_tag = Elements::withTag("tag1");
 
     REQUIRE(elements_with_tag.size() == 3);
@@ -17,4 +17,5 @@
 
 #pragma once
 
+#include <Reaktoro/Transport/FiniteVolumeTransportSolver.hpp>
 #include <Reaktoro/Transport/TransportSolver.hpp>
@@ -0,0 +1,233 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalField.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+
+struct ChemicalField::Impl
+{
+    /// The chemical system of the cells.
+    const ChemicalSystem system;
+
+    /// The temperatures of the cells (in K).
+    ArrayXd T;
+
+    /// The pressures of the cells (in Pa).
+    ArrayXd P;
+
+    /// The amounts of the species in the cells, one column per cell (in mol).
+    MatrixXd n;
+
+    /// The names of the chemical properties stored for each cell.
+    Strings propnames;
+
+    /// The functions evaluating the chemical properties stored for each cell.
+    Vec<PropertyFn> propfns;
+
+    /// The values of the chemical properties stored for each cell, one row per property.
+    MatrixXd props;
+
+    /// Construct a ChemicalField::Impl object.
+    Impl(ChemicalState const& state, Index size)
+    : system(state.system()), T(size), P(size), n(state.system().species().size(), size)
+    {
+        for(Index icell = 0; icell < size; ++icell)
+            set(icell, state);
+    }
+
+    /// Construct a ChemicalField::Impl object with its cells initialized by the workers of a thread pool.
+    Impl(ChemicalState const& state, Index size, ThreadPool& pool)
+    : system(state.system()), T(size), P(size), n(state.system().species().size(), size)
+    {
+        pool.forEachWorker([&](Index iworker)
+        {
+            const auto [begin, end] = pool.initialTasks(size, iworker);
+            for(Index icell = begin; icell < end; ++icell)
+                set(icell, state);
+        });
+    }
+
+    /// Set the chemical state of a cell.
+    auto set(Index icell, ChemicalState const& state) -> void
+    {
+        errorif(icell >= T.size(), "Expecting a cell index smaller than ", T.size(), " in ChemicalField::set, but got ", icell, ".");
+        T[icell] = state.temperature();
+        P[icell] = state.pressure();
+        n.col(icell) = state.speciesAmounts().matrix();
+        auto const& chemprops = state.props();
+        for(auto i = 0; i < propfns.size(); ++i)
+            props(i, icell) = propfns[i](chemprops);
+    }
+
+    /// Materialize the chemical state of a cell into a given ChemicalState object.
+    auto get(Index icell, ChemicalState& state) const -> void
+    {
+        errorif(icell >= T.size(), "Expecting a cell index smaller than ", T.size(), " in ChemicalField::get, but got ", icell, ".");
+        state.setTemperature(T[icell]);
+        state.setPressure(P[icell]);
+        state.setSpeciesAmounts(n.col(icell).array());
+    }
+
+    /// Add a chemical property to be stored for each cell.
+    auto addProperty(String const& name, PropertyFn const& fn) -> void
+    {
+        errorif(contains(propnames, name), "Could not add property `", name, "` to ChemicalField because a property with this name has already been added.");
+        errorif(!fn, "Could not add property `", name, "` to ChemicalField because its function is empty.");
+        propnames.push_back(name);
+        propfns.push_back(fn);
+        props.conservativeResize(propfns.size(), T.size());
+        props.row(propfns.size() - 1).fill(NaN);
+    }
+
+    /// Return the values of a chemical property stored for each cell.
+    auto property(String const& name) const -> ArrayXdConstRef
+    {
+        const auto i = index(propnames, name);
+        errorif(i >= propnames.size(), "There is no property `", name, "` in ChemicalField. Use ChemicalField::addProperty to add it first.");
+        return props.row(i).transpose().array();
+    }
+};
+
+ChemicalField::ChemicalField(ChemicalSystem const& system, Index size)
+: pimpl(new Impl(ChemicalState(system), size))
+{}
+
+ChemicalField::ChemicalField(ChemicalState const& state, Index size)
+: pimpl(new Impl(state, size))
+{}
+
+ChemicalField::ChemicalField(ChemicalState const& state, Index size, ThreadPool& pool)
+: pimpl(new Impl(state, size, pool))
+{}
+
+ChemicalField::ChemicalField(ChemicalField const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ChemicalField::~ChemicalField()
+{}
+
+auto ChemicalField::operator=(ChemicalField other) -> ChemicalField&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ChemicalField::system() const -> ChemicalSystem const&
+{
+    return pimpl->system;
+}
+
+auto ChemicalField::size() const -> Index
+{
+    return pimpl->T.size();
+}
+
+auto ChemicalField::set(ChemicalState const& state) -> void
+{
+    for(Index icell = 0; icell < size(); ++icell)
+        pimpl->set(icell, state);
+}
+
+auto ChemicalField::set(Index icell, ChemicalState const& state) -> void
+{
+    pimpl->set(icell, state);
+}
+
+auto ChemicalField::get(Index icell, ChemicalState& state) const -> void
+{
+    pimpl->get(icell, state);
+}
+
+auto ChemicalField::state(Index icell) const -> ChemicalState
+{
+    ChemicalState res(pimpl->system);
+    pimpl->get(icell, res);
+    return res;
+}
+
+auto ChemicalField::temperatures() -> ArrayXdRef
+{
+    return pimpl->T;
+}
+
+auto ChemicalField::temperatures() const -> ArrayXdConstRef
+{
+    return pimpl->T;
+}
+
+auto ChemicalField::pressures() -> ArrayXdRef
+{
+    return pimpl->P;
+}
+
+auto ChemicalField::pressures() const -> ArrayXdConstRef
+{
+    return pimpl->P;
+}
+
+auto ChemicalField::speciesAmounts() -> MatrixXdRef
+{
+    return pimpl->n;
+}
+
+auto ChemicalField::speciesAmounts() const -> MatrixXdConstRef
+{
+    return pimpl->n;
+}
+
+auto ChemicalField::addProperty(String const& name, PropertyFn const& fn) -> void
+{
+    pimpl->addProperty(name, fn);
+}
+
+auto ChemicalField::propertyNames() const -> Strings const&
+{
+    return pimpl->propnames;
+}
+
+auto ChemicalField::property(String const& name) const -> ArrayXdConstRef
+{
+    return pimpl->property(name);
+}
+
+auto ChemicalField::speciesAmountsSinglePrecision() const -> MatrixXf
+{
+    return pimpl->n.cast<float>();
+}
+
+auto ChemicalField::propertySinglePrecision(String const& name) const -> ArrayXf
+{
+    return pimpl->property(name).cast<float>();
+}
+
+auto ChemicalField::memory() const -> Index
+{
+    return sizeof(double) * (pimpl->T.size() + pimpl->P.size() + pimpl->n.size() + pimpl->props.size());
+}
+
+} // namespace Reaktoro
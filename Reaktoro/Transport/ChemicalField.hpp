@@ -0,0 +1,164 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+class ChemicalSystem;
+class ThreadPool;
+
+/// Used to store the chemical states of many cells as contiguous arrays.
+/// A ChemicalField object stores as structure of arrays over its cells the
+/// temperatures, pressures, and species amounts of their chemical states,
+/// and the values of selected chemical properties (see @ref addProperty).
+/// This requires much less memory than a ChemicalState object per cell,
+/// each with its own chemical properties and equilibrium data, and its
+/// arrays can be swept contiguously in transport calculations. The species
+/// amounts of each cell are stored in a column of @ref speciesAmounts, so
+/// that the amounts of all species in a cell are adjacent in memory.
+/// A ChemicalState object for a cell is only materialized when needed
+/// (e.g., to be handed to a chemical solver) with @ref get, which fills a
+/// reusable ChemicalState object, and the result is stored back with
+/// @ref set.
+/// @note The equilibrium data of the materialized chemical states (e.g.,
+/// the Lagrange multipliers used for warm-starting equilibrium
+/// calculations) is not stored, only the species amounts, which are used
+/// as initial guess in subsequent calculations.
+class ChemicalField
+{
+public:
+    /// The type of functions that evaluate a chemical property of a cell stored in a ChemicalField object.
+    using PropertyFn = Fn<real(ChemicalProps const&)>;
+
+    /// Construct a ChemicalField object with given chemical system and number of cells.
+    /// The cells are initialized with the default ChemicalState object of the system.
+    ChemicalField(ChemicalSystem const& system, Index size);
+
+    /// Construct a ChemicalField object with all its cells initialized with given chemical state.
+    ChemicalField(ChemicalState const& state, Index size);
+
+    /// Construct a ChemicalField object with all its cells initialized with given chemical state by the workers of a thread pool.
+    /// Each worker initializes the cells it is initially assigned in a
+    /// parallel loop over the cells (see ThreadPool::initialTasks), so that
+    /// its memory is first touched in the thread of that worker rather than
+    /// all in the calling thread. On NUMA systems with pinned worker threads
+    /// (see ThreadPool::setDefaultThreadPinning), the cells are then placed
+    /// in the memory of the socket whose workers mostly process them in the
+    /// batched calculations of solvers with the same number of threads
+    /// (e.g., ReactiveTransportSolver::step).
+    ChemicalField(ChemicalState const& state, Index size, ThreadPool& pool);
+
+    /// Construct a copy of a ChemicalField object.
+    ChemicalField(ChemicalField const& other);
+
+    /// Destroy this ChemicalField object.
+    ~ChemicalField();
+
+    /// Assign a copy of a ChemicalField object to this.
+    auto operator=(ChemicalField other) -> ChemicalField&;
+
+    /// Return the chemical system of the cells.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Return the number of cells.
+    auto size() const -> Index;
+
+    /// Set the chemical state of all cells.
+    auto set(ChemicalState const& state) -> void;
+
+    /// Set the chemical state of a cell.
+    /// The chemical properties of `state` are used to evaluate the properties
+    /// added with @ref addProperty, and thus need to be up-to-date (as after
+    /// an equilibrium or kinetics calculation).
+    /// @param icell The index of the cell
+    /// @param state The chemical state of the cell
+    auto set(Index icell, ChemicalState const& state) -> void;
+
+    /// Materialize the chemical state of a cell into a given ChemicalState object.
+    /// Only the temperature, pressure, and species amounts of `state` are
+    /// changed, so that it can be reused for many cells without memory
+    /// allocations. Its chemical properties are not updated.
+    /// @param icell The index of the cell
+    /// @param[out] state The chemical state of the cell
+    auto get(Index icell, ChemicalState& state) const -> void;
+
+    /// Return the chemical state of a cell.
+    /// @see get
+    auto state(Index icell) const -> ChemicalState;
+
+    /// Return the temperatures of the cells (in K).
+    auto temperatures() -> ArrayXdRef;
+
+    /// Return the temperatures of the cells (in K).
+    auto temperatures() const -> ArrayXdConstRef;
+
+    /// Return the pressures of the cells (in Pa).
+    auto pressures() -> ArrayXdRef;
+
+    /// Return the pressures of the cells (in Pa).
+    auto pressures() const -> ArrayXdConstRef;
+
+    /// Return the amounts of the species in the cells, one column per cell (in mol).
+    auto speciesAmounts() -> MatrixXdRef;
+
+    /// Return the amounts of the species in the cells, one column per cell (in mol).
+    auto speciesAmounts() const -> MatrixXdConstRef;
+
+    /// Add a chemical property to be stored for each cell whenever its chemical state is set.
+    /// The values of the property are initially NaN, until the chemical
+    /// states of the cells are set with @ref set.
+    /// @param name The name of the property
+    /// @param fn The function evaluating the property from the chemical properties of a cell
+    auto addProperty(String const& name, PropertyFn const& fn) -> void;
+
+    /// Return the names of the chemical properties stored for each cell.
+    auto propertyNames() const -> Strings const&;
+
+    /// Return the values of a chemical property stored for each cell.
+    /// @param name The name of the property added with @ref addProperty
+    auto property(String const& name) const -> ArrayXdConstRef;
+
+    /// Return the amounts of the species in the cells in single precision, one column per cell (in mol).
+    /// This halves the memory and bandwidth of exported arrays (e.g., when
+    /// writing output files) where double precision is not needed. The
+    /// species amounts stored in this object are kept in double precision,
+    /// since they are used as initial guess in subsequent calculations.
+    auto speciesAmountsSinglePrecision() const -> MatrixXf;
+
+    /// Return the values of a chemical property stored for each cell in single precision.
+    /// @param name The name of the property added with @ref addProperty
+    /// @see speciesAmountsSinglePrecision
+    auto propertySinglePrecision(String const& name) const -> ArrayXf;
+
+    /// Return the approximate memory used by the arrays of this ChemicalField object (in bytes).
+    auto memory() const -> Index;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
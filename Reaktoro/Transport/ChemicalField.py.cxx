@@ -0,0 +1,50 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+using namespace Reaktoro;
+
+void exportChemicalField(py::module& m)
+{
+    py::class_<ChemicalField>(m, "ChemicalField")
+        .def(py::init<ChemicalSystem const&, Index>())
+        .def(py::init<ChemicalState const&, Index>())
+        .def(py::init<ChemicalField const&>())
+        .def("system", &ChemicalField::system, return_internal_ref)
+        .def("size", &ChemicalField::size)
+        .def("set", py::overload_cast<ChemicalState const&>(&ChemicalField::set))
+        .def("set", py::overload_cast<Index, ChemicalState const&>(&ChemicalField::set))
+        .def("get", &ChemicalField::get)
+        .def("state", &ChemicalField::state)
+        .def("temperatures", py::overload_cast<>(&ChemicalField::temperatures), return_internal_ref)
+        .def("pressures", py::overload_cast<>(&ChemicalField::pressures), return_internal_ref)
+        .def("speciesAmounts", py::overload_cast<>(&ChemicalField::speciesAmounts), return_internal_ref)
+        .def("addProperty", &ChemicalField::addProperty)
+        .def("propertyNames", &ChemicalField::propertyNames, return_internal_ref)
+        .def("property", &ChemicalField::property, return_internal_ref)
+        .def("speciesAmountsSinglePrecision", &ChemicalField::speciesAmountsSinglePrecision)
+        .def("propertySinglePrecision", &ChemicalField::propertySinglePrecision)
+        .def("memory", &ChemicalField::memory)
+        ;
+}
@@ -0,0 +1,114 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Extensions/Nasa.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ChemicalField", "[ChemicalField]")
+{
+    NasaDatabase db("nasa-cea");
+
+    ChemicalSystem system(db,
+        CondensedPhase("C(gr)"),
+        GaseousPhase("O2 CO2")
+    );
+
+    ChemicalState state(system);
+    state.temperature(400.0);
+    state.pressure(2.0e5);
+    state.set("C(gr)", 1.0, "mol");
+    state.set("O2", 2.0, "mol");
+    state.props().update(state);
+
+    const auto num_cells = 5;
+
+    ChemicalField field(state, num_cells);
+
+    CHECK( field.size() == num_cells );
+    CHECK( field.system().species().size() == system.species().size() );
+
+    CHECK( field.speciesAmounts().rows() == system.species().size() );
+    CHECK( field.speciesAmounts().cols() == num_cells );
+    CHECK( (field.temperatures() == 400.0).all() );
+    CHECK( (field.pressures() == 2.0e5).all() );
+    CHECK( field.speciesAmounts()(system.species().index("O2"), 3) == 2.0 );
+
+    field.addProperty("volume", [](ChemicalProps const& props) { return props.volume(); });
+
+    CHECK( field.propertyNames() == Strings{"volume"} );
+    CHECK( std::isnan(field.property("volume")[0]) );
+    CHECK_THROWS( field.addProperty("volume", [](ChemicalProps const& props) { return props.volume(); }) );
+    CHECK_THROWS( field.property("enthalpy") );
+
+    ChemicalState other(state);
+    other.temperature(500.0);
+    other.set("O2", 3.0, "mol");
+    other.props().update(other);
+
+    field.set(2, other);
+
+    CHECK( field.temperatures()[2] == 500.0 );
+    CHECK( field.temperatures()[1] == 400.0 );
+    CHECK( field.property("volume")[2] == Approx(other.props().volume()) );
+    CHECK( std::isnan(field.property("volume")[1]) );
+
+    ChemicalState scratch(system);
+    field.get(2, scratch);
+
+    CHECK( scratch.temperature() == 500.0 );
+    CHECK( scratch.pressure() == 2.0e5 );
+    CHECK( scratch.speciesAmount("O2") == Approx(3.0) );
+    CHECK( field.state(4).speciesAmount("O2") == Approx(2.0) );
+
+    field.set(state);
+
+    CHECK( field.property("volume")[1] == Approx(state.props().volume()) );
+
+    const MatrixXf nf = field.speciesAmountsSinglePrecision();
+    const ArrayXf Vf = field.propertySinglePrecision("volume");
+
+    CHECK( nf.rows() == field.speciesAmounts().rows() );
+    CHECK( nf.cols() == num_cells );
+    CHECK( nf(system.species().index("O2"), 3) == 2.0f );
+    CHECK( Vf.size() == num_cells );
+    CHECK( Vf[1] == Approx(state.props().volume()).epsilon(1e-6) );
+    CHECK_THROWS( field.propertySinglePrecision("enthalpy") );
+
+    CHECK( field.memory() == sizeof(double) * num_cells * (3 + system.species().size()) );
+
+    CHECK_THROWS( field.set(num_cells, state) );
+    CHECK_THROWS( field.get(num_cells, scratch) );
+
+    ThreadPool pool(3);
+
+    ChemicalField touched(state, 7, pool);
+
+    CHECK( touched.size() == 7 );
+    CHECK( (touched.temperatures() == 400.0).all() );
+    CHECK( (touched.pressures() == 2.0e5).all() );
+    for(auto icell = 0; icell < 7; ++icell)
+        CHECK( touched.speciesAmounts().col(icell) == field.speciesAmounts().col(0) );
+}
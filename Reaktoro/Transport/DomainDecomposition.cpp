@@ -0,0 +1,127 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "DomainDecomposition.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+Communicator::Communicator()
+{
+    allgatherv = [](ArrayXdConstRef local, ArrayXdRef global, Indices const& counts)
+    {
+        global = local;
+    };
+
+    allgatherBytes = [](String const& local) -> Strings
+    {
+        return { local };
+    };
+}
+
+DomainDecomposition::DomainDecomposition()
+: DomainDecomposition(1, 1)
+{}
+
+DomainDecomposition::DomainDecomposition(Index num_cells, Index num_ranks)
+: m_offsets(num_ranks + 1, 0)
+{
+    errorif(num_ranks == 0, "Could not create a DomainDecomposition object: the number of processes must be positive.");
+    m_offsets.back() = num_cells;
+    partition();
+}
+
+auto DomainDecomposition::partition() -> void
+{
+    const auto num_cells = numCells();
+    const auto num_ranks = numRanks();
+
+    for(Index rank = 0; rank <= num_ranks; ++rank)
+        m_offsets[rank] = rank * num_cells / num_ranks;
+}
+
+auto DomainDecomposition::partition(ArrayXdConstRef costs) -> void
+{
+    const auto num_cells = numCells();
+    const auto num_ranks = numRanks();
+
+    errorif(costs.size() != num_cells, "Expecting the costs of ", num_cells, " cells in DomainDecomposition::partition, but got ", costs.size(), ".");
+    errorif((costs < 0.0).any(), "Expecting non-negative costs of the cells in DomainDecomposition::partition.");
+
+    const auto total = costs.sum();
+
+    if(total <= 0.0)
+        return partition();
+
+    // Place the end of the range of each process where the cumulative cost gets closest to its share of the total cost
+    Index icell = 0;
+    double cumulative = 0.0;
+
+    for(Index rank = 1; rank < num_ranks; ++rank)
+    {
+        const auto target = total * rank / num_ranks;
+
+        while(icell < num_cells && cumulative + costs[icell] <= target)
+            cumulative += costs[icell++];
+
+        // Include the cell crossing the target if this brings the cumulative cost closer to it
+        if(icell < num_cells && cumulative + costs[icell] - target < target - cumulative)
+            cumulative += costs[icell++];
+
+        m_offsets[rank] = icell;
+    }
+
+    m_offsets.back() = num_cells;
+}
+
+auto DomainDecomposition::counts() const -> Indices
+{
+    Indices res(numRanks());
+    for(Index rank = 0; rank < numRanks(); ++rank)
+        res[rank] = count(rank);
+    return res;
+}
+
+auto DomainDecomposition::owner(Index icell) const -> Index
+{
+    errorif(icell >= numCells(), "Expecting a cell index smaller than ", numCells(), " in DomainDecomposition::owner, but got ", icell, ".");
+    const auto it = std::upper_bound(m_offsets.begin(), m_offsets.end(), icell);
+    return it - m_offsets.begin() - 1;
+}
+
+auto DomainDecomposition::imbalance(ArrayXdConstRef costs) const -> double
+{
+    errorif(costs.size() != numCells(), "Expecting the costs of ", numCells(), " cells in DomainDecomposition::imbalance, but got ", costs.size(), ".");
+
+    const auto total = costs.sum();
+
+    if(total <= 0.0)
+        return 1.0;
+
+    double largest = 0.0;
+    for(Index rank = 0; rank < numRanks(); ++rank)
+        largest = std::max(largest, costs.segment(begin(rank), count(rank)).sum());
+
+    return largest / (total / numRanks());
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,124 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to describe the communication among the processes of a distributed-memory computation (e.g., the ranks of an MPI communicator).
+/// Reaktoro does not depend on MPI. Instead, applications running on
+/// clusters set the rank of the current process, the number of processes,
+/// and the functions below in terms of their own communication layer. With
+/// MPI, for example, @ref allgatherv can be implemented with
+/// `MPI_Allgatherv` on `MPI_DOUBLE` values (with `counts` converted to the
+/// receive counts and displacements), and @ref allgatherBytes with an
+/// `MPI_Allgather` of the buffer sizes followed by an `MPI_Allgatherv` of
+/// their bytes. A default-constructed Communicator object describes a single
+/// process, in which case these functions simply copy the local data.
+struct Communicator
+{
+    /// The function type for gathering the values of all processes in every process.
+    /// @param local The values of the current process
+    /// @param[out] global The values of all processes in rank order
+    /// @param counts The number of values of each process
+    using AllGatherVFn = Fn<void(ArrayXdConstRef local, ArrayXdRef global, Indices const& counts)>;
+
+    /// The function type for gathering a buffer of bytes of all processes in every process.
+    /// @param local The buffer of bytes of the current process
+    /// @return The buffers of bytes of all processes in rank order
+    using AllGatherBytesFn = Fn<Strings(String const& local)>;
+
+    /// Construct a default Communicator object describing a single process.
+    Communicator();
+
+    /// The rank of the current process.
+    Index rank = 0;
+
+    /// The number of processes.
+    Index size = 1;
+
+    /// The function that gathers the values of all processes in every process.
+    AllGatherVFn allgatherv;
+
+    /// The function that gathers a buffer of bytes of all processes in every process.
+    AllGatherBytesFn allgatherBytes;
+};
+
+/// Used to partition the cells of a mesh into contiguous ranges owned by the processes of a distributed-memory computation.
+/// The cells are partitioned so that the processes have approximately the
+/// same computing cost, given the cost of each cell (e.g., the measured
+/// time of its last chemical equilibrium calculation). This is important in
+/// reactive transport simulations, in which the cells near reaction fronts
+/// can be much more expensive than others, especially with smart chemical
+/// equilibrium calculations that fail to predict their states.
+class DomainDecomposition
+{
+public:
+    /// Construct a default DomainDecomposition object with one cell owned by one process.
+    DomainDecomposition();
+
+    /// Construct a DomainDecomposition object in which each process owns approximately the same number of cells.
+    /// @param num_cells The number of cells in the mesh
+    /// @param num_ranks The number of processes
+    DomainDecomposition(Index num_cells, Index num_ranks);
+
+    /// Partition the cells among the processes so that each process owns approximately the same number of cells.
+    auto partition() -> void;
+
+    /// Partition the cells among the processes so that each process has approximately the same total cost.
+    /// @param costs The non-negative cost of each cell
+    auto partition(ArrayXdConstRef costs) -> void;
+
+    /// Return the number of cells in the mesh.
+    auto numCells() const -> Index { return m_offsets.back(); }
+
+    /// Return the number of processes.
+    auto numRanks() const -> Index { return m_offsets.size() - 1; }
+
+    /// Return the index of the first cell owned by each process, followed by the number of cells.
+    auto offsets() const -> Indices const& { return m_offsets; }
+
+    /// Return the index of the first cell owned by a process.
+    auto begin(Index rank) const -> Index { return m_offsets[rank]; }
+
+    /// Return the index after the last cell owned by a process.
+    auto end(Index rank) const -> Index { return m_offsets[rank + 1]; }
+
+    /// Return the number of cells owned by a process.
+    auto count(Index rank) const -> Index { return end(rank) - begin(rank); }
+
+    /// Return the number of cells owned by each process.
+    auto counts() const -> Indices;
+
+    /// Return the rank of the process that owns a cell.
+    auto owner(Index icell) const -> Index;
+
+    /// Return the ratio between the largest total cost of a process and the average total cost of the processes.
+    /// A value of one indicates a perfectly balanced partition.
+    /// @param costs The non-negative cost of each cell
+    auto imbalance(ArrayXdConstRef costs) const -> double;
+
+private:
+    /// The index of the first cell owned by each process, followed by the number of cells.
+    Indices m_offsets;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,50 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/DomainDecomposition.hpp>
+using namespace Reaktoro;
+
+void exportDomainDecomposition(py::module& m)
+{
+    py::class_<Communicator>(m, "Communicator")
+        .def(py::init<>())
+        .def_readwrite("rank", &Communicator::rank)
+        .def_readwrite("size", &Communicator::size)
+        .def_readwrite("allgatherv", &Communicator::allgatherv)
+        .def_readwrite("allgatherBytes", &Communicator::allgatherBytes)
+        ;
+
+    py::class_<DomainDecomposition>(m, "DomainDecomposition")
+        .def(py::init<>())
+        .def(py::init<Index, Index>())
+        .def("partition", py::overload_cast<>(&DomainDecomposition::partition))
+        .def("partition", py::overload_cast<ArrayXdConstRef>(&DomainDecomposition::partition))
+        .def("numCells", &DomainDecomposition::numCells)
+        .def("numRanks", &DomainDecomposition::numRanks)
+        .def("offsets", &DomainDecomposition::offsets, return_internal_ref)
+        .def("begin", &DomainDecomposition::begin)
+        .def("end", &DomainDecomposition::end)
+        .def("count", &DomainDecomposition::count)
+        .def("counts", &DomainDecomposition::counts)
+        .def("owner", &DomainDecomposition::owner)
+        .def("imbalance", &DomainDecomposition::imbalance)
+        ;
+}
@@ -0,0 +1,98 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/DomainDecomposition.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing Communicator", "[DomainDecomposition]")
+{
+    Communicator comm;
+
+    CHECK( comm.rank == 0 );
+    CHECK( comm.size == 1 );
+
+    ArrayXd local(3);
+    local << 1.0, 2.0, 3.0;
+
+    ArrayXd global(3);
+    comm.allgatherv(local, global, {3});
+
+    CHECK( (global == local).all() );
+
+    CHECK( comm.allgatherBytes("abc") == Strings{"abc"} );
+}
+
+TEST_CASE("Testing DomainDecomposition", "[DomainDecomposition]")
+{
+    DomainDecomposition decomposition(10, 3);
+
+    CHECK( decomposition.numCells() == 10 );
+    CHECK( decomposition.numRanks() == 3 );
+    CHECK( decomposition.offsets() == Indices{0, 3, 6, 10} );
+    CHECK( decomposition.counts() == Indices{3, 3, 4} );
+
+    CHECK( decomposition.owner(0) == 0 );
+    CHECK( decomposition.owner(5) == 1 );
+    CHECK( decomposition.owner(6) == 2 );
+    CHECK( decomposition.owner(9) == 2 );
+    CHECK_THROWS( decomposition.owner(10) );
+
+    SECTION("When the costs of the cells are uniform")
+    {
+        const ArrayXd costs = ArrayXd::Ones(10);
+
+        decomposition.partition(costs);
+
+        CHECK( decomposition.counts() == Indices{3, 4, 3} );
+        CHECK( decomposition.imbalance(costs) == Approx(4.0/(10.0/3.0)) );
+    }
+
+    SECTION("When the cells near a reaction front are more expensive")
+    {
+        ArrayXd costs = ArrayXd::Ones(10);
+        costs.segment(6, 2) = 10.0; // the cells at the front cost ten times more
+
+        const auto before = decomposition.imbalance(costs);
+
+        decomposition.partition(costs);
+
+        CHECK( decomposition.begin(0) == 0 );
+        CHECK( decomposition.end(2) == 10 );
+        CHECK( decomposition.owner(6) != decomposition.owner(7) ); // the expensive cells are owned by different processes
+        CHECK( decomposition.count(decomposition.owner(6)) < decomposition.count(0) );
+        CHECK( decomposition.imbalance(costs) < before );
+    }
+
+    SECTION("When all cells have zero costs")
+    {
+        decomposition.partition(ArrayXd::Zero(10));
+
+        CHECK( decomposition.counts() == Indices{3, 3, 4} );
+    }
+
+    SECTION("When the costs are invalid")
+    {
+        CHECK_THROWS( decomposition.partition(ArrayXd::Ones(9)) );
+        CHECK_THROWS( decomposition.partition(-ArrayXd::Ones(10)) );
+    }
+
+    CHECK_THROWS( DomainDecomposition(10, 0) );
+}
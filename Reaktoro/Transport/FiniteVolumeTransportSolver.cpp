@@ -0,0 +1,360 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "FiniteVolumeTransportSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Eigen includes
+#include <Eigen/IterativeLinearSolvers>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return the indices of the species in the fluid phases of a chemical system.
+auto indicesFluidSpecies(ChemicalSystem const& system) -> Indices
+{
+    Indices ifs;
+    auto offset = 0;
+    for(auto const& phase : system.phases())
+    {
+        const auto size = phase.species().size();
+        if(phase.stateOfMatter() != StateOfMatter::Solid)
+            for(auto i = 0; i < size; ++i)
+                ifs.push_back(offset + i);
+        offset += size;
+    }
+    return ifs;
+}
+
+} // namespace
+
+UnstructuredMesh::UnstructuredMesh()
+{}
+
+UnstructuredMesh::UnstructuredMesh(ArrayXdConstRef volumes)
+: m_volumes(volumes)
+{
+    errorif((volumes <= 0.0).any(), "Could not create the unstructured mesh: the volumes of the cells must be positive.");
+}
+
+auto UnstructuredMesh::addFace(Index icell, Index jcell, double area, double distance) -> Index
+{
+    errorif(icell >= numCells() || jcell >= numCells(), "Could not add a face between cells ", icell, " and ", jcell, " to the unstructured mesh with ", numCells(), " cells.");
+    errorif(icell == jcell, "Could not add a face between cell ", icell, " and itself to the unstructured mesh.");
+    errorif(area <= 0.0 || distance <= 0.0, "Could not add a face between cells ", icell, " and ", jcell, " to the unstructured mesh: its area and distance must be positive.");
+    m_faces.push_back({ icell, jcell, area, distance });
+    return m_faces.size() - 1;
+}
+
+auto UnstructuredMesh::addBoundaryFace(Index icell, double area, double distance) -> Index
+{
+    errorif(icell >= numCells(), "Could not add a boundary face of cell ", icell, " to the unstructured mesh with ", numCells(), " cells.");
+    errorif(area <= 0.0 || distance < 0.0, "Could not add a boundary face of cell ", icell, " to the unstructured mesh: its area must be positive and its distance non-negative.");
+    m_boundary_faces.push_back({ icell, area, distance });
+    return m_boundary_faces.size() - 1;
+}
+
+struct FiniteVolumeTransportSolver::Impl
+{
+    /// The mesh describing the discretization of the domain.
+    UnstructuredMesh mesh;
+
+    /// The volumetric flow rates across the interior faces (in m3/s, empty if zero).
+    ArrayXd rates;
+
+    /// The volumetric flow rates across the boundary faces (in m3/s, empty if zero).
+    ArrayXd brates;
+
+    /// The diffusion coefficient of the transported quantities (in m2/s).
+    double diffusion = 0.0;
+
+    /// The time step used to solve the transport problem (in s).
+    double dt = 0.0;
+
+    /// The tolerance on the relative residual of the iterative solution of the linear systems.
+    double tolerance = 1e-12;
+
+    /// The maximum number of iterations in the iterative solution of the linear systems (zero for the default).
+    Index maxiters = 0;
+
+    /// The coefficient matrix of the linear systems for the concentrations at the end of a time step.
+    SparseMatrixXd A;
+
+    /// The coefficients of the concentrations on the boundary faces (columns) in the right-hand sides of the linear systems of the cells (rows).
+    SparseMatrixXd B;
+
+    /// The iterative solver of the linear systems with the incomplete LU preconditioner of the coefficient matrix.
+    Eigen::BiCGSTAB<SparseMatrixXd, Eigen::IncompleteLUT<double>> solver;
+
+    /// The flag indicating if the coefficient matrix has been assembled and its preconditioner computed.
+    bool initialized = false;
+
+    /// The largest number of iterations among the linear systems solved in the last time step.
+    Index iterations = 0;
+
+    /// The right-hand sides of the linear systems of the transported quantities (one column per quantity).
+    MatrixXd R;
+
+    /// The concentrations of the transported quantities (one column per quantity).
+    MatrixXd X;
+
+    /// The amounts of the fluid species in the cells transported in a ChemicalField object (one column per cell).
+    MatrixXd nf;
+
+    /// Construct a default FiniteVolumeTransportSolver::Impl object.
+    Impl()
+    {}
+
+    /// Construct a copy of a FiniteVolumeTransportSolver::Impl object (the iterative solver refers to the coefficient matrix, and is thus initialized again).
+    Impl(Impl const& other)
+    : mesh(other.mesh), rates(other.rates), brates(other.brates), diffusion(other.diffusion), dt(other.dt),
+      tolerance(other.tolerance), maxiters(other.maxiters)
+    {
+        if(other.initialized)
+            initialize();
+    }
+
+    /// Assemble the coefficient matrix and compute its preconditioner.
+    auto initialize() -> void
+    {
+        const auto num_cells = mesh.numCells();
+        const auto num_faces = mesh.numFaces();
+        const auto num_bfaces = mesh.numBoundaryFaces();
+
+        errorif(num_cells == 0, "Could not initialize FiniteVolumeTransportSolver: the mesh has no cells.");
+        errorif(dt <= 0.0, "Could not initialize FiniteVolumeTransportSolver: the time step must be positive.");
+        errorif(rates.size() != 0 && rates.size() != num_faces, "Expecting ", num_faces, " flow rates across the interior faces in FiniteVolumeTransportSolver, one for each face, but got ", rates.size(), ".");
+        errorif(brates.size() != 0 && brates.size() != num_bfaces, "Expecting ", num_bfaces, " flow rates across the boundary faces in FiniteVolumeTransportSolver, one for each face, but got ", brates.size(), ".");
+
+        const auto V = mesh.volumes();
+
+        Vec<Eigen::Triplet<double>> Atriplets;
+        Vec<Eigen::Triplet<double>> Btriplets;
+
+        // The accumulation terms of the cells
+        for(Index i = 0; i < num_cells; ++i)
+            Atriplets.emplace_back(i, i, V[i]/dt);
+
+        // The fluxes across the interior faces, with upwind advection and two-point diffusion (duplicate entries are summed)
+        for(Index f = 0; f < num_faces; ++f)
+        {
+            auto const& face = mesh.faces()[f];
+            const auto i = face.icell;
+            const auto j = face.jcell;
+            const auto q = rates.size() ? rates[f] : 0.0;
+            const auto T = diffusion * face.area / face.distance;
+
+            if(q >= 0.0)
+            {
+                Atriplets.emplace_back(i, i, q);
+                Atriplets.emplace_back(j, i, -q);
+            }
+            else
+            {
+                Atriplets.emplace_back(i, j, q);
+                Atriplets.emplace_back(j, j, -q);
+            }
+
+            Atriplets.emplace_back(i, i, T);
+            Atriplets.emplace_back(i, j, -T);
+            Atriplets.emplace_back(j, j, T);
+            Atriplets.emplace_back(j, i, -T);
+        }
+
+        // The fluxes across the boundary faces, whose concentrations are known and thus contribute to the right-hand sides
+        for(Index f = 0; f < num_bfaces; ++f)
+        {
+            auto const& face = mesh.boundaryFaces()[f];
+            const auto i = face.icell;
+            const auto q = brates.size() ? brates[f] : 0.0;
+            const auto T = face.distance > 0.0 ? diffusion * face.area / face.distance : 0.0;
+
+            if(q >= 0.0)
+                Atriplets.emplace_back(i, i, q);
+            else Btriplets.emplace_back(i, f, -q);
+
+            Atriplets.emplace_back(i, i, T);
+            Btriplets.emplace_back(i, f, T);
+        }
+
+        A.resize(num_cells, num_cells);
+        A.setFromTriplets(Atriplets.begin(), Atriplets.end());
+
+        B.resize(num_cells, num_bfaces);
+        B.setFromTriplets(Btriplets.begin(), Btriplets.end());
+
+        solver.setTolerance(tolerance);
+        solver.setMaxIterations(maxiters ? maxiters : 2 * num_cells);
+        solver.compute(A);
+
+        errorif(solver.info() != Eigen::Success, "Could not compute the incomplete LU preconditioner of the coefficient matrix in FiniteVolumeTransportSolver.");
+
+        initialized = true;
+    }
+
+    /// Perform a time step of the transport problem for many transported quantities at once.
+    auto step(MatrixXdRef U, MatrixXdConstRef Ub) -> void
+    {
+        const auto num_cells = mesh.numCells();
+        const auto num_bfaces = mesh.numBoundaryFaces();
+        const auto m = U.rows();
+
+        errorif(!initialized || A.rows() != num_cells, "FiniteVolumeTransportSolver::initialize needs to be called before FiniteVolumeTransportSolver::step, and again after the mesh changes.");
+        errorif(U.cols() != num_cells, "Expecting a matrix with ", num_cells, " columns in FiniteVolumeTransportSolver::step, one for each cell, but got ", U.cols(), ".");
+        errorif(Ub.rows() != m || Ub.cols() != num_bfaces, "Expecting a matrix of boundary concentrations with ", m, " rows and ", num_bfaces, " columns in FiniteVolumeTransportSolver::step, but got ", Ub.rows(), " rows and ", Ub.cols(), " columns.");
+
+        const auto V = mesh.volumes();
+
+        // The concentrations at the beginning of the time step, also used as initial guesses
+        X = (U.array().rowwise() / V.transpose()).matrix().transpose();
+
+        R = U.transpose() / dt;
+
+        if(num_bfaces)
+            R += B * Ub.transpose();
+
+        iterations = 0;
+
+        for(Index k = 0; k < m; ++k)
+        {
+            X.col(k) = solver.solveWithGuess(R.col(k), X.col(k));
+            errorif(solver.info() != Eigen::Success, "Could not solve the linear system of transported quantity ", k, " in FiniteVolumeTransportSolver::step after ", solver.iterations(), " iterations (relative residual ", solver.error(), ").");
+            iterations = std::max<Index>(iterations, solver.iterations());
+        }
+
+        U = (X.array().colwise() * V).matrix().transpose();
+    }
+
+    /// Perform a time step of the transport problem for the amounts of the fluid species stored in a ChemicalField object.
+    auto step(ChemicalField& field, MatrixXdConstRef nb) -> void
+    {
+        const auto ifluid = indicesFluidSpecies(field.system());
+        const auto num_fluid = ifluid.size();
+
+        errorif(field.size() != mesh.numCells(), "Expecting a ChemicalField object with ", mesh.numCells(), " cells in FiniteVolumeTransportSolver::step, one for each cell in the mesh, but got ", field.size(), ".");
+        errorif(nb.rows() != num_fluid, "Expecting the boundary concentrations of ", num_fluid, " fluid species in FiniteVolumeTransportSolver::step, but got ", nb.rows(), ".");
+
+        auto n = field.speciesAmounts();
+
+        nf.resize(num_fluid, n.cols());
+        for(Index k = 0; k < num_fluid; ++k)
+            nf.row(k) = n.row(ifluid[k]);
+
+        step(nf, nb);
+
+        for(Index k = 0; k < num_fluid; ++k)
+            n.row(ifluid[k]) = nf.row(k);
+    }
+};
+
+FiniteVolumeTransportSolver::FiniteVolumeTransportSolver()
+: pimpl(new Impl())
+{}
+
+FiniteVolumeTransportSolver::FiniteVolumeTransportSolver(FiniteVolumeTransportSolver const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+FiniteVolumeTransportSolver::~FiniteVolumeTransportSolver()
+{}
+
+auto FiniteVolumeTransportSolver::operator=(FiniteVolumeTransportSolver other) -> FiniteVolumeTransportSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto FiniteVolumeTransportSolver::setMesh(UnstructuredMesh const& mesh) -> void
+{
+    pimpl->mesh = mesh;
+}
+
+auto FiniteVolumeTransportSolver::setFlowRates(ArrayXdConstRef rates) -> void
+{
+    pimpl->rates = rates;
+}
+
+auto FiniteVolumeTransportSolver::setBoundaryFlowRates(ArrayXdConstRef rates) -> void
+{
+    pimpl->brates = rates;
+}
+
+auto FiniteVolumeTransportSolver::setDiffusionCoeff(double val) -> void
+{
+    errorif(val < 0.0, "Could not set the diffusion coefficient of FiniteVolumeTransportSolver: it must be non-negative.");
+    pimpl->diffusion = val;
+}
+
+auto FiniteVolumeTransportSolver::setTimeStep(double val) -> void
+{
+    pimpl->dt = val;
+}
+
+auto FiniteVolumeTransportSolver::setTolerance(double val) -> void
+{
+    pimpl->tolerance = val;
+}
+
+auto FiniteVolumeTransportSolver::setMaxIterations(Index val) -> void
+{
+    pimpl->maxiters = val;
+}
+
+auto FiniteVolumeTransportSolver::mesh() const -> UnstructuredMesh const&
+{
+    return pimpl->mesh;
+}
+
+auto FiniteVolumeTransportSolver::timeStep() const -> double
+{
+    return pimpl->dt;
+}
+
+auto FiniteVolumeTransportSolver::matrix() const -> SparseMatrixXd const&
+{
+    return pimpl->A;
+}
+
+auto FiniteVolumeTransportSolver::iterations() const -> Index
+{
+    return pimpl->iterations;
+}
+
+auto FiniteVolumeTransportSolver::initialize() -> void
+{
+    pimpl->initialize();
+}
+
+auto FiniteVolumeTransportSolver::step(MatrixXdRef U, MatrixXdConstRef Ub) -> void
+{
+    pimpl->step(U, Ub);
+}
+
+auto FiniteVolumeTransportSolver::step(ChemicalField& field, MatrixXdConstRef nb) -> void
+{
+    pimpl->step(field, nb);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,214 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalField;
+
+/// Used to describe an unstructured mesh of finite volumes as a graph of cells connected by faces.
+/// Only the volumes of the cells, and the areas of the faces and the
+/// distances across them, are needed in the two-point flux approximation of
+/// the finite volume method, so that the mesh can discretize two- or
+/// three-dimensional domains of any shape. An interior face connects two
+/// cells, and a boundary face connects a cell with the exterior of the
+/// domain, on which the values of the transported quantities are prescribed.
+class UnstructuredMesh
+{
+public:
+    /// Used to describe an interior face of an UnstructuredMesh object.
+    struct Face
+    {
+        /// The index of the first cell connected by the face.
+        Index icell = 0;
+
+        /// The index of the second cell connected by the face.
+        Index jcell = 0;
+
+        /// The area of the face (in m2).
+        double area = 0.0;
+
+        /// The distance between the centers of the cells (in m).
+        double distance = 0.0;
+    };
+
+    /// Used to describe a boundary face of an UnstructuredMesh object.
+    struct BoundaryFace
+    {
+        /// The index of the cell on the face.
+        Index icell = 0;
+
+        /// The area of the face (in m2).
+        double area = 0.0;
+
+        /// The distance between the center of the cell and the face (in m), or zero if there is no diffusion across the face.
+        double distance = 0.0;
+    };
+
+    /// Construct a default UnstructuredMesh object without cells.
+    UnstructuredMesh();
+
+    /// Construct an UnstructuredMesh object with given volumes of the cells (in m3).
+    /// These are the volumes available to the transported fluid (e.g., the pore volumes of the cells in a porous medium).
+    explicit UnstructuredMesh(ArrayXdConstRef volumes);
+
+    /// Add an interior face between two cells.
+    /// @param icell The index of the first cell
+    /// @param jcell The index of the second cell
+    /// @param area The area of the face (in m2)
+    /// @param distance The distance between the centers of the cells (in m)
+    /// @return The index of the added face
+    auto addFace(Index icell, Index jcell, double area, double distance) -> Index;
+
+    /// Add a boundary face of a cell.
+    /// @param icell The index of the cell
+    /// @param area The area of the face (in m2)
+    /// @param distance The distance between the center of the cell and the face (in m), or zero if there is no diffusion across the face
+    /// @return The index of the added boundary face
+    auto addBoundaryFace(Index icell, double area, double distance) -> Index;
+
+    /// Return the number of cells in the mesh.
+    auto numCells() const -> Index { return m_volumes.size(); }
+
+    /// Return the number of interior faces in the mesh.
+    auto numFaces() const -> Index { return m_faces.size(); }
+
+    /// Return the number of boundary faces in the mesh.
+    auto numBoundaryFaces() const -> Index { return m_boundary_faces.size(); }
+
+    /// Return the volumes of the cells (in m3).
+    auto volumes() const -> ArrayXdConstRef { return m_volumes; }
+
+    /// Return the interior faces of the mesh.
+    auto faces() const -> Vec<Face> const& { return m_faces; }
+
+    /// Return the boundary faces of the mesh.
+    auto boundaryFaces() const -> Vec<BoundaryFace> const& { return m_boundary_faces; }
+
+private:
+    /// The volumes of the cells (in m3).
+    ArrayXd m_volumes;
+
+    /// The interior faces of the mesh.
+    Vec<Face> m_faces;
+
+    /// The boundary faces of the mesh.
+    Vec<BoundaryFace> m_boundary_faces;
+};
+
+/// Used for solving advection-diffusion problems on unstructured meshes with an implicit finite volume method.
+/// The transported quantities are stored as amounts in each cell (e.g., in
+/// mol), and their concentrations are these amounts divided by the volumes
+/// of the cells. In each time step, the concentrations *c* at the end of
+/// the step satisfy @eq{V_i (c_i - c_i^0)/\Delta t + \sum_f F_f = 0} in each
+/// cell *i*, where the flux *F* across each face *f* of the cell consists of
+/// an upwind advective flux, given the volumetric flow rate across the
+/// face, and a diffusive flux with a two-point approximation of the gradient
+/// across the face. The scheme is implicit in both advection and diffusion,
+/// and thus unconditionally stable. The resulting sparse coefficient matrix
+/// is the same for all transported quantities. It is assembled, and its
+/// incomplete LU preconditioner computed, only once in @ref initialize.
+/// The linear systems of all transported quantities are then solved in
+/// each time step with the BiCGSTAB iterative method, reusing this
+/// preconditioner, and starting from their concentrations at the beginning
+/// of the time step.
+class FiniteVolumeTransportSolver
+{
+public:
+    /// Construct a default FiniteVolumeTransportSolver object.
+    FiniteVolumeTransportSolver();
+
+    /// Construct a copy of a FiniteVolumeTransportSolver object.
+    FiniteVolumeTransportSolver(FiniteVolumeTransportSolver const& other);
+
+    /// Destroy this FiniteVolumeTransportSolver object.
+    ~FiniteVolumeTransportSolver();
+
+    /// Assign a copy of a FiniteVolumeTransportSolver object to this.
+    auto operator=(FiniteVolumeTransportSolver other) -> FiniteVolumeTransportSolver&;
+
+    /// Set the mesh for the numerical solution of the transport problem.
+    auto setMesh(UnstructuredMesh const& mesh) -> void;
+
+    /// Set the volumetric flow rates across the interior faces of the mesh (in m3/s).
+    /// A positive flow rate is from the first to the second cell of the face.
+    /// The flow rates are zero if not set.
+    auto setFlowRates(ArrayXdConstRef rates) -> void;
+
+    /// Set the volumetric flow rates across the boundary faces of the mesh (in m3/s).
+    /// A positive flow rate is out of the domain, and a negative one into it.
+    /// The flow rates are zero if not set.
+    auto setBoundaryFlowRates(ArrayXdConstRef rates) -> void;
+
+    /// Set the diffusion coefficient of the transported quantities (in m2/s).
+    auto setDiffusionCoeff(double val) -> void;
+
+    /// Set the time step for the numerical solution of the transport problem (in s).
+    auto setTimeStep(double val) -> void;
+
+    /// Set the tolerance on the relative residual of the iterative solution of the linear systems (default is 1e-12).
+    auto setTolerance(double val) -> void;
+
+    /// Set the maximum number of iterations in the iterative solution of the linear systems (default is twice the number of cells).
+    auto setMaxIterations(Index val) -> void;
+
+    /// Return the mesh of the transport problem.
+    auto mesh() const -> UnstructuredMesh const&;
+
+    /// Return the time step of the transport problem (in s).
+    auto timeStep() const -> double;
+
+    /// Return the sparse coefficient matrix of the linear systems assembled in @ref initialize.
+    auto matrix() const -> SparseMatrixXd const&;
+
+    /// Return the largest number of iterations among the linear systems solved in the last time step.
+    auto iterations() const -> Index;
+
+    /// Initialize the transport solver before method @ref step is executed.
+    /// This assembles the sparse coefficient matrix and computes its
+    /// preconditioner, and thus needs to be called again whenever the mesh,
+    /// the flow rates, the diffusion coefficient, or the time step changes.
+    auto initialize() -> void;
+
+    /// Perform a time step of the transport problem for many transported quantities at once.
+    /// @param[in,out] U The amounts of the transported quantities in the cells, with one row per quantity and one column per cell
+    /// @param Ub The concentrations of the transported quantities on the boundary faces (i.e., amounts per m3), with one row per quantity and one column per boundary face
+    auto step(MatrixXdRef U, MatrixXdConstRef Ub) -> void;
+
+    /// Perform a time step of the transport problem for the amounts of the fluid species stored in a ChemicalField object.
+    /// The amounts of the species in the fluid phases of the cells (i.e., not
+    /// in solid phases) are transported and written back into the field, so
+    /// that they can be equilibrated right away, while the amounts of the
+    /// species in the solid phases remain unchanged.
+    /// @param[in,out] field The chemical states of the cells in the mesh
+    /// @param nb The concentrations of the fluid species on the boundary faces (in mol/m3), with one row per fluid species (in the order of the species in the chemical system) and one column per boundary face
+    auto step(ChemicalField& field, MatrixXdConstRef nb) -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
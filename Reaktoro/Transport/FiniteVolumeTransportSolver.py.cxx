@@ -0,0 +1,75 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/ChemicalField.hpp>
+#include <Reaktoro/Transport/FiniteVolumeTransportSolver.hpp>
+using namespace Reaktoro;
+
+void exportFiniteVolumeTransportSolver(py::module& m)
+{
+    py::class_<UnstructuredMesh::Face>(m, "UnstructuredMeshFace")
+        .def(py::init<>())
+        .def_readwrite("icell", &UnstructuredMesh::Face::icell)
+        .def_readwrite("jcell", &UnstructuredMesh::Face::jcell)
+        .def_readwrite("area", &UnstructuredMesh::Face::area)
+        .def_readwrite("distance", &UnstructuredMesh::Face::distance)
+        ;
+
+    py::class_<UnstructuredMesh::BoundaryFace>(m, "UnstructuredMeshBoundaryFace")
+        .def(py::init<>())
+        .def_readwrite("icell", &UnstructuredMesh::BoundaryFace::icell)
+        .def_readwrite("area", &UnstructuredMesh::BoundaryFace::area)
+        .def_readwrite("distance", &UnstructuredMesh::BoundaryFace::distance)
+        ;
+
+    py::class_<UnstructuredMesh>(m, "UnstructuredMesh")
+        .def(py::init<>())
+        .def(py::init<ArrayXdConstRef>())
+        .def("addFace", &UnstructuredMesh::addFace, py::arg("icell"), py::arg("jcell"), py::arg("area"), py::arg("distance"))
+        .def("addBoundaryFace", &UnstructuredMesh::addBoundaryFace, py::arg("icell"), py::arg("area"), py::arg("distance"))
+        .def("numCells", &UnstructuredMesh::numCells)
+        .def("numFaces", &UnstructuredMesh::numFaces)
+        .def("numBoundaryFaces", &UnstructuredMesh::numBoundaryFaces)
+        .def("volumes", &UnstructuredMesh::volumes, return_internal_ref)
+        .def("faces", &UnstructuredMesh::faces, return_internal_ref)
+        .def("boundaryFaces", &UnstructuredMesh::boundaryFaces, return_internal_ref)
+        ;
+
+    py::class_<FiniteVolumeTransportSolver>(m, "FiniteVolumeTransportSolver")
+        .def(py::init<>())
+        .def(py::init<FiniteVolumeTransportSolver const&>())
+        .def("setMesh", &FiniteVolumeTransportSolver::setMesh)
+        .def("setFlowRates", &FiniteVolumeTransportSolver::setFlowRates)
+        .def("setBoundaryFlowRates", &FiniteVolumeTransportSolver::setBoundaryFlowRates)
+        .def("setDiffusionCoeff", &FiniteVolumeTransportSolver::setDiffusionCoeff)
+        .def("setTimeStep", &FiniteVolumeTransportSolver::setTimeStep)
+        .def("setTolerance", &FiniteVolumeTransportSolver::setTolerance)
+        .def("setMaxIterations", &FiniteVolumeTransportSolver::setMaxIterations)
+        .def("mesh", &FiniteVolumeTransportSolver::mesh, return_internal_ref)
+        .def("timeStep", &FiniteVolumeTransportSolver::timeStep)
+        .def("matrix", &FiniteVolumeTransportSolver::matrix, return_internal_ref)
+        .def("iterations", &FiniteVolumeTransportSolver::iterations)
+        .def("initialize", &FiniteVolumeTransportSolver::initialize)
+        .def("step", py::overload_cast<MatrixXdRef, MatrixXdConstRef>(&FiniteVolumeTransportSolver::step))
+        .def("step", py::overload_cast<ChemicalField&, MatrixXdConstRef>(&FiniteVolumeTransportSolver::step))
+        ;
+}
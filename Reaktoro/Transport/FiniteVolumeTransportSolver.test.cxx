@@ -0,0 +1,186 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Extensions/Nasa.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+#include <Reaktoro/Transport/FiniteVolumeTransportSolver.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return an unstructured mesh of a two-dimensional grid of square cells with unit volumes, without boundary faces.
+auto createGrid(Index nx, Index ny) -> UnstructuredMesh
+{
+    UnstructuredMesh mesh(ArrayXd::Ones(nx * ny));
+    for(Index j = 0; j < ny; ++j)
+        for(Index i = 0; i < nx; ++i)
+        {
+            const auto icell = j*nx + i;
+            if(i + 1 < nx) mesh.addFace(icell, icell + 1, 1.0, 1.0);
+            if(j + 1 < ny) mesh.addFace(icell, icell + nx, 1.0, 1.0);
+        }
+    return mesh;
+}
+
+} // namespace
+
+TEST_CASE("Testing UnstructuredMesh", "[FiniteVolumeTransportSolver]")
+{
+    UnstructuredMesh mesh = createGrid(3, 2);
+
+    CHECK( mesh.numCells() == 6 );
+    CHECK( mesh.numFaces() == 7 );
+    CHECK( mesh.numBoundaryFaces() == 0 );
+
+    CHECK( mesh.addBoundaryFace(0, 1.0, 0.5) == 0 );
+    CHECK( mesh.numBoundaryFaces() == 1 );
+    CHECK( mesh.boundaryFaces()[0].distance == 0.5 );
+
+    CHECK_THROWS( mesh.addFace(0, 6, 1.0, 1.0) );
+    CHECK_THROWS( mesh.addFace(1, 1, 1.0, 1.0) );
+    CHECK_THROWS( mesh.addFace(0, 1, 0.0, 1.0) );
+    CHECK_THROWS( mesh.addBoundaryFace(6, 1.0, 0.5) );
+    CHECK_THROWS( UnstructuredMesh(ArrayXd::Zero(2)) );
+}
+
+TEST_CASE("Testing FiniteVolumeTransportSolver", "[FiniteVolumeTransportSolver]")
+{
+    FiniteVolumeTransportSolver transport;
+
+    SECTION("When the quantities diffuse in a closed domain")
+    {
+        const auto mesh = createGrid(3, 3);
+
+        transport.setMesh(mesh);
+        transport.setDiffusionCoeff(1.0);
+        transport.setTimeStep(0.5);
+
+        CHECK_THROWS( transport.step(MatrixXd::Zero(1, 9), MatrixXd::Zero(1, 0)) ); // not initialized yet
+
+        transport.initialize();
+
+        CHECK( transport.matrix().rows() == 9 );
+        CHECK( transport.matrix().nonZeros() == 9 + 2 * mesh.numFaces() );
+
+        MatrixXd U = zeros(2, 9);
+        U(0, 0) = 9.0; // all in a corner cell
+        U.row(1).fill(1.0); // already uniform
+
+        for(auto i = 0; i < 50; ++i)
+            transport.step(U, MatrixXd::Zero(2, 0));
+
+        CHECK( U.row(0).sum() == Approx(9.0) ); // the amounts are conserved
+        CHECK( U.row(0).isApprox(RowVectorXd::Ones(9), 1e-6) );
+        CHECK( U.row(1).isApprox(RowVectorXd::Ones(9), 1e-8) );
+        CHECK( transport.iterations() > 0 );
+
+        CHECK_THROWS( transport.step(MatrixXd::Zero(2, 8), MatrixXd::Zero(2, 0)) );
+        CHECK_THROWS( transport.step(U, MatrixXd::Zero(2, 1)) );
+    }
+
+    SECTION("When the quantities are injected through the boundary")
+    {
+        // A chain of cells with inflow into the first cell and outflow from the last one
+        const auto num_cells = 5;
+        const auto Q = 2.0;
+
+        UnstructuredMesh mesh(ArrayXd::Constant(num_cells, 2.0));
+        for(Index i = 0; i + 1 < num_cells; ++i)
+            mesh.addFace(i, i + 1, 1.0, 1.0);
+        mesh.addBoundaryFace(0, 1.0, 0.5);
+        mesh.addBoundaryFace(num_cells - 1, 1.0, 0.0);
+
+        ArrayXd brates(2);
+        brates << -Q, Q;
+
+        transport.setMesh(mesh);
+        transport.setFlowRates(ArrayXd::Constant(num_cells - 1, Q));
+        transport.setBoundaryFlowRates(brates);
+        transport.setDiffusionCoeff(0.1);
+        transport.setTimeStep(10.0); // the implicit scheme is not limited by the Courant number Q*dt/V = 10
+        transport.initialize();
+
+        MatrixXd Ub(2, 2);
+        Ub << 3.0, 0.0,
+              0.5, 0.0;
+
+        MatrixXd U = zeros(2, num_cells);
+
+        transport.step(U, Ub);
+
+        for(Index i = 1; i < num_cells; ++i)
+            CHECK( U(0, i) < U(0, i - 1) ); // the values decrease downstream
+
+        for(auto i = 0; i < 100; ++i)
+            transport.step(U, Ub);
+
+        CHECK( U.row(0).isApprox(RowVectorXd::Constant(num_cells, 3.0 * 2.0), 1e-8) ); // the concentration of the injected fluid fills the domain
+        CHECK( U.row(1).isApprox(RowVectorXd::Constant(num_cells, 0.5 * 2.0), 1e-8) );
+
+        FiniteVolumeTransportSolver copy(transport);
+        MatrixXd Ucopy = U;
+        copy.step(Ucopy, Ub);
+        transport.step(U, Ub);
+        CHECK( Ucopy.isApprox(U) );
+
+        transport.setFlowRates(ArrayXd::Constant(2, Q));
+        CHECK_THROWS( transport.initialize() );
+    }
+
+    SECTION("When the fluid species in a ChemicalField object are transported")
+    {
+        NasaDatabase db("nasa-cea");
+
+        ChemicalSystem system(db,
+            CondensedPhase("C(gr)"),
+            GaseousPhase("O2 CO2")
+        );
+
+        ChemicalState state(system);
+        state.set("C(gr)", 1.0, "mol");
+        state.set("O2", 1.0, "mol");
+
+        const auto mesh = createGrid(2, 2);
+
+        ChemicalField field(state, mesh.numCells());
+        field.speciesAmounts()(system.species().index("O2"), 0) = 5.0;
+
+        transport.setMesh(mesh);
+        transport.setDiffusionCoeff(1.0);
+        transport.setTimeStep(1.0);
+        transport.initialize();
+
+        const auto iO2 = system.species().index("O2");
+        const auto iC = system.species().index("C(gr)");
+
+        for(auto i = 0; i < 50; ++i)
+            transport.step(field, MatrixXd::Zero(2, 0));
+
+        CHECK( field.speciesAmounts().row(iO2).sum() == Approx(8.0) );
+        CHECK( field.speciesAmounts().row(iO2).isApprox(RowVectorXd::Constant(4, 2.0), 1e-6) );
+        CHECK( (field.speciesAmounts().row(iC).array() == 1.0).all() ); // the solid species are not transported
+
+        CHECK_THROWS( transport.step(field, MatrixXd::Zero(3, 0)) );
+    }
+}
@@ -1,432 +1,1228 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2022 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #include "TransportSolver.hpp"
-
-// // C++ includes
-// #include <iomanip>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/Exception.hpp>
-// #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
-
-// namespace Reaktoro {
-// namespace internal {
-
-// template<typename ReturnType, typename TridiagonalMatrixType>
-// auto row(TridiagonalMatrixType&& mat, Index index) -> ReturnType
-// {
-//     auto n = mat.size();
-//     auto data = mat.data();
-//     auto length = data.size();
-//     return (index == 0) ? data.segment(1, 2) : (index == n - 1) ?
-//         data.segment(length - 4, 2) : data.segment(3 * index, 3);
-// }
-
-// } // namespace internal
-
-// ChemicalField::ChemicalField(Index size, const ChemicalSystem& system)
-// : m_size(size),
-//   m_system(system),
-//   m_states(size, ChemicalState(system)),
-//   m_props(size, ChemicalProps(system))
-// {}
-
-// ChemicalField::ChemicalField(Index size, const ChemicalState& state)
-// : m_size(size),
-//   m_system(state.system()),
-//   m_states(size, state),
-//   m_props(size, state.props())
-// {}
-
-// auto ChemicalField::set(const ChemicalState& state) -> void
-// {
-//     for(auto& item : m_states)
-//         item = state;
-// }
-
-// auto ChemicalField::temperature(VectorXdRef values) -> void
-// {
-//     const Index len = size();
-//     for(Index i = 0; i < len; ++i)
-//         values[i] = m_states[i].temperature();
-// }
-
-// auto ChemicalField::pressure(VectorXdRef values) -> void
-// {
-//     const Index len = size();
-//     for(Index i = 0; i < len; ++i)
-//         values[i] = m_states[i].pressure();
-// }
-
-// auto ChemicalField::elementAmounts(VectorXdRef values) -> void
-// {
-//     const Index len = size();
-//     const Index num_elements = m_system.elements().size();
-//     Index offset = 0;
-//     for(Index i = 0; i < len; ++i, offset += num_elements)
-//         values.segment(offset, num_elements) = m_states[i].elementAmounts();
-// }
-
-// auto ChemicalField::output(std::string filename, StringList quantities) -> void
-// {
-//     ChemicalOutput out(m_system);
-//     out.filename(filename);
-//     for(auto quantity : quantities)
-//         out.add(quantity);
-
-// }
-
-// auto TridiagonalMatrix::resize(Index size) -> void
-// {
-//     m_size = size;
-//     m_data.conservativeResize(size * 3);
-// }
-
-// auto TridiagonalMatrix::factorize() -> void
-// {
-//     const Index n = size();
-
-//     auto prev = row(0).data(); // iterator to previous row
-//     auto curr = row(1).data(); // iterator to current row
-
-//     for(Index i = 1; i < n; ++i, prev = curr, curr += 3)
-//     {
-//         const auto& b_prev = prev[1]; // `b` value on the previous row
-//         const auto& c_prev = prev[2]; // `c` value on the previous row
-
-//         auto& a_curr = curr[0]; // `a` value on the current row
-//         auto& b_curr = curr[1]; // `b` value on the current row
-
-//         a_curr /= b_prev; // update the a-diagonal in the tridiagonal matrix
-//         b_curr -= a_curr * c_prev; // update the b-diagonal in the tridiagonal matrix
-//     }
-// }
-
-// auto TridiagonalMatrix::solve(VectorXdRef x, VectorXdConstRef d) const -> void
-// {
-//     const Index n = size();
-
-//     auto curr = row(1).data(); // iterator to current row
-
-//     //-------------------------------------------------------------------------
-//     // Perform the forward solve with the L factor of the LU factorization
-//     //-------------------------------------------------------------------------
-//     x[0] = d[0];
-
-//     for(Index i = 1; i < n; ++i, curr += 3)
-//     {
-//         const auto& a = curr[0]; // `a` value on the current row
-
-//         x[i] = d[i] - a * x[i - 1];
-//     }
-
-//     curr -= 3; // step back so that curr points to the last row
-//     const auto& bn = curr[1]; // `b` value on the last row
-//     curr -= 3; // step back so that curr points to the second to last row
-
-//     //-------------------------------------------------------------------------
-//     // Perform the backward solve with the U factor of the LU factorization
-//     //-------------------------------------------------------------------------
-//     x[n - 1] /= bn;
-
-//     for(Index i = 2; i <= n; ++i, curr -= 3)
-//     {
-//         const auto& k = n - i; // the index of the current row
-//         const auto& b = curr[1]; // `b` value on the current row
-//         const auto& c = curr[2]; // `c` value on the current row
-
-//         x[k] = (x[k] - c * x[k + 1])/b;
-//     }
-// }
-
-// auto TridiagonalMatrix::solve(VectorXdRef x) const -> void
-// {
-//     solve(x, x);
-// }
-
-// TridiagonalMatrix::operator MatrixXd() const
-// {
-//     const Index n = size();
-//     MatrixXd res = zeros(n, n);
-//     res.row(0).head(2) = row(0).tail(2);
-//     for(Index i = 1; i < n - 1; ++i)
-//         res.row(i).segment(i - 1, 3) = row(i);
-//     res.row(n - 1).tail(2) = row(n - 1).head(2);
-//     return res;
-// }
-
-// Mesh::Mesh()
-// {}
-
-// Mesh::Mesh(Index num_cells, double xl, double xr)
-// {
-//     setDiscretization(num_cells, xl, xr);
-// }
-
-// auto Mesh::setDiscretization(Index num_cells, double xl, double xr) -> void
-// {
-//     Assert(xr > xl, "Could not set the discretization.",
-//         "The x-coordinate of the right boundary needs to be "
-//         "larger than that of the left boundary.");
-
-//     m_num_cells = num_cells;
-//     m_xl = xl;
-//     m_xr = xr;
-//     m_dx = (xr - xl) / num_cells;
-//     m_xcells = linspace(xl + 0.5*m_dx, xr - 0.5*m_dx, num_cells);
-// }
-
-// TransportSolver::TransportSolver()
-// {
-// }
-
-// //auto TransportSolver::step(VectorXdRef u, VectorXdConstRef q) -> void
-// //{
-// //    // TODO: Implement Kurganov-Tadmor method as detailed in their 2000 paper (not as in Wikipedia)
-// //    const double dx = mmesh.dx();
-// //    const double num_cells = mmesh.numCells();
-// //    const double alpha = velocity*dt/dx;
-// //    const double beta = diffusion*dt/(dx * dx);
-// //
-// //    u0 = u;
-// //    A.resize(num_cells);
-// //    phi.resize(num_cells);
-// //
-// //    // Calculate the flux limiters in the interior cells
-// //    for(Index i = 1; i < num_cells - 1; ++i)
-// //    {
-// //        // Calculate the variation index `r = (uP - uW)/(uE - uP)` on current cell
-// //        const double r = (u[i] - u[i - 1])/(u[i + 1] - u[i]);
-// //
-// //        // Calculate the flux limiter phi based on the superbee limiter (https://en.wikipedia.org/wiki/Flux_limiter)
-// //        phi[i] = std::max(0.0, std::max(std::min(2 * r, 1.0), std::min(r, 2.0)));
-// //    }
-// //
-// //    // Assemble the coefficient matrix A for the interior cells
-// //    for(Index icell = 1; icell < num_cells - 1; ++icell)
-// //    {
-// //        const double phiW = phi[icell - 1];
-// //        const double phiP = phi[icell];
-// //        const double aux = 1.0 + 0.5 * (phiP - phiW);
-// //        const double a = -beta;
-// //        const double b = 1 + 2*beta;
-// //        const double c = -beta;
-// //        A.row(icell) << a, b, c;
-// //
-// //        const double uW = u0[icell - 1];
-// //        const double uP = u0[icell];
-// //        u[icell] += aux*alpha * (uW - uP);
-// //    }
-// //
-// //    // Assemble the coefficient matrix A for the boundary cells
-// //    A.row(0) << 0.0, 1.0 + beta, -beta;
-// //    A.row(num_cells - 1) << -beta, 1.0 + beta, 0.0;
-// //
-// //    u[0] += alpha * (ul - u0[0]);
-// //    u[num_cells - 1] += alpha * (u0[num_cells - 2] - u0[num_cells - 1]);
-// //
-// //    u += dt * q;
-// //
-// //    A.factorize();
-// //    A.solve(u);
-// //}
-
-// auto TransportSolver::initialize() -> void
-// {
-//     const auto dx = mesh_.dx();
-//     const auto beta = diffusion*dt/(dx * dx);
-//     const auto num_cells = mesh_.numCells();
-//     const auto icell0 = 0;
-//     const auto icelln = num_cells - 1;
-
-//     A.resize(num_cells);
-//     phi.resize(num_cells);
-
-//     // Assemble the coefficient matrix A for the interior cells
-//     for(Index icell = 1; icell < icelln; ++icell)
-//     {
-//         const double a = -beta;
-//         const double b = 1 + 2*beta;
-//         const double c = -beta;
-//         A.row(icell) << a, b, c;
-//     }
-
-//     // Assemble the coefficient matrix A for the boundary cells
-//     A.row(icell0) << 0.0, 1.0 + 4.5*beta, -1.5*beta; // prescribed amount on the wall and approximatin deriveted by forward diference approximation with second order error
-//     A.row(icelln) << -beta, 1.0 + beta, 0.0;   // du/dx = 0 at the right boundary
-
-//     // Factorize A into LU factors for future uses in method step
-//     A.factorize();
-// }
-
-// auto TransportSolver::step(VectorXdRef u, VectorXdConstRef q) -> void
-// {
-//     // TODO: Implement Kurganov-Tadmor method as detailed in their 2000 paper (not as in Wikipedia)
-//     // Solving advection problem with time explicit approach
-//     const auto dx = mesh_.dx();
-//     const auto num_cells = mesh_.numCells();
-//     const auto alpha = velocity*dt/dx;
-//     const auto icell0 = 0;
-//     const auto icelln = num_cells - 1;
-
-//     Assert(alpha <= 1, "Could not solve the advection problem explicitly.",
-//         "alpha > 1, try to decrease time step ");
-
-//     u0 = u;
-
-//     phi[0] = 2.0; //  this is very important to ensure correct flux limiting behavior for boundary cell.
-
-//     // Calculate the flux limiters in the interior cells
-//     for(Index icell = 1; icell < icelln; ++icell)
-//     {
-//         // Calculate the variation index `r = (uP - uW)/(uE - uP)` on current cell
-//         const double r = (u[icell] - u[icell - 1])/(u[icell + 1] - u[icell]);
-
-//         // Calculate the flux limiter phi based on the superbee limiter (https://en.wikipedia.org/wiki/Flux_limiter)
-//         phi[icell] = std::max(0.0, std::max(std::min(2 * r, 1.0), std::min(r, 2.0)));
-//     }
-
-//     // Compute advection contributions to u for the interior cells
-//     for(Index icell = 1; icell < icelln; ++icell)
-//     {
-//         const double phiW = phi[icell - 1];
-//         const double phiP = phi[icell];
-//         const double aux = 1.0 + 0.5 * (phiP - phiW);
-
-//         const double uW = u0[icell - 1];
-//         const double uP = u0[icell];
-//         u[icell] += aux*alpha * (uW - uP);
-//     }
-
-//     // Handle the left boundary cell
-//     const double aux = 1 + 0.5 * phi[0];
-//     u[icell0] += aux * alpha * (ul - u0[0]) + (3.0*diffusion*ul*dt/(dx*dx)); // prescribed amount on the wall and approximatin deriveted by forward diference approximation with second order error
-
-//     // Handle the right boundary cell
-//     u[icelln] += alpha * (u0[icelln - 1] - u0[icelln]); // du/dx = 0 at the right boundary
-
-//     // Add the source contribution
-//     u += dt * q;
-
-//     // Solving the diffusion problem with time implicit approach
-//     A.solve(u);
-// }
-
-// auto TransportSolver::step(VectorXdRef u) -> void
-// {
-//     step(u, zeros(u.size()));
-// }
-
-// ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
-// : system_(system), equilibriumsolver(system)
-// {
-//     setBoundaryState(ChemicalState(system));
-// }
-
-// auto ReactiveTransportSolver::setMesh(const Mesh& mesh) -> void
-// {
-//     transportsolver.setMesh(mesh);
-// }
-
-// auto ReactiveTransportSolver::setVelocity(double val) -> void
-// {
-//     transportsolver.setVelocity(val);
-// }
-
-// auto ReactiveTransportSolver::setDiffusionCoeff(double val) -> void
-// {
-//     transportsolver.setDiffusionCoeff(val);
-// }
-
-// auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> void
-// {
-//     bbc = state.elementAmounts();
-// }
-
-// auto ReactiveTransportSolver::setTimeStep(double val) -> void
-// {
-//     transportsolver.setTimeStep(val);
-// }
-
-// auto ReactiveTransportSolver::output() -> ChemicalOutput
-// {
-//     outputs.push_back(ChemicalOutput(system_));
-//     return outputs.back();
-// }
-
-// auto ReactiveTransportSolver::initialize(const ChemicalField& field) -> void
-// {
-//     const Mesh& mesh = transportsolver.mesh();
-//     const Index num_elements = system_.numElements();
-//     const Index num_cells = mesh.numCells();
-
-//     bf.resize(num_cells, num_elements);
-//     bs.resize(num_cells, num_elements);
-//     b.resize(num_cells, num_elements);
-
-//     transportsolver.initialize();
-// }
-
-// auto ReactiveTransportSolver::step(ChemicalField& field) -> void
-// {
-//     const auto& mesh = transportsolver.mesh();
-//     const auto& num_elements = system_.numElements();
-//     const auto& num_cells = mesh.numCells();
-//     const auto& ifs = system_.indicesFluidSpecies();
-//     const auto& iss = system_.indicesSolidSpecies();
-
-//     // Collect the amounts of elements in the solid and fluid species
-//     for(Index icell = 0; icell < num_cells; ++icell)
-//     {
-//         bf.row(icell) = field[icell].elementAmountsInSpecies(ifs);
-//         bs.row(icell) = field[icell].elementAmountsInSpecies(iss);
-//     }
-
-//     // Transport the elements in the fluid species
-//     for(Index ielement = 0; ielement < num_elements; ++ielement)
-//     {
-//         transportsolver.setBoundaryValue(bbc[ielement]);
-//         transportsolver.step(bf.col(ielement));
-//     }
-
-//     // Sum the amounts of elements distributed among fluid and solid species
-//     b.noalias() = bf + bs;
-
-//     for(auto output : outputs)
-//     {
-//         output.suffix("-" + std::to_string(steps));
-//         output.open();
-//     }
-
-//     for(Index icell = 0; icell < num_cells; ++icell)
-//     {
-//         const double T = field[icell].temperature();
-//         const double P = field[icell].pressure();
-//         equilibriumsolver.solve(field[icell], T, P, b.row(icell));
-
-//         for(auto output : outputs)
-//             output.update(field[icell], icell);
-//     }
-
-//     for(auto output : outputs)
-//         output.close();
-
-//     ++steps;
-// }
-
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "TransportSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/HashUtils.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+#include <Reaktoro/Transport/DomainDecomposition.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return the superbee flux limiter for given differences `uP - uW` (`num`) and `uE - uP` (`den`) on a cell.
+inline auto superbee(double num, double den) -> double
+{
+    // Calculate the variation index `r = (uP - uW)/(uE - uP)` on the cell
+    const auto r = den != 0.0 ? num/den : (num != 0.0 ? 2.0 : 0.0);
+    return std::max(0.0, std::max(std::min(2.0*r, 1.0), std::min(r, 2.0)));
+}
+
+} // namespace
+
+auto TridiagonalMatrix::resize(Index size) -> void
+{
+    m_size = size;
+    m_data.conservativeResize(3 * size);
+}
+
+auto TridiagonalMatrix::factorize() -> void
+{
+    const auto n = size();
+
+    for(Index i = 1; i < n; ++i)
+    {
+        const auto b_prev = m_data[3*i - 2]; // `b` value on the previous row
+        const auto c_prev = m_data[3*i - 1]; // `c` value on the previous row
+
+        auto& a_curr = m_data[3*i];     // `a` value on the current row
+        auto& b_curr = m_data[3*i + 1]; // `b` value on the current row
+
+        a_curr /= b_prev; // update the a-diagonal in the tridiagonal matrix
+        b_curr -= a_curr * c_prev; // update the b-diagonal in the tridiagonal matrix
+    }
+}
+
+auto TridiagonalMatrix::solve(VectorXdRef x, VectorXdConstRef d) const -> void
+{
+    const auto n = size();
+
+    if(n == 0)
+        return;
+
+    //-------------------------------------------------------------------------
+    // Perform the forward solve with the L factor of the LU factorization
+    //-------------------------------------------------------------------------
+    x[0] = d[0];
+
+    for(Index i = 1; i < n; ++i)
+        x[i] = d[i] - m_data[3*i] * x[i - 1];
+
+    //-------------------------------------------------------------------------
+    // Perform the backward solve with the U factor of the LU factorization
+    //-------------------------------------------------------------------------
+    x[n - 1] /= m_data[3*n - 2];
+
+    for(Index k = n - 1; k > 0; --k)
+    {
+        const auto i = k - 1; // the index of the current row
+        x[i] = (x[i] - m_data[3*i + 2] * x[i + 1]) / m_data[3*i + 1];
+    }
+}
+
+auto TridiagonalMatrix::solve(VectorXdRef x) const -> void
+{
+    solve(x, x);
+}
+
+auto TridiagonalMatrix::solveBatched(MatrixXdRef X) const -> void
+{
+    const auto n = size();
+    const auto m = X.rows();
+
+    errorif(X.cols() != n, "Expecting a matrix with ", n, " columns in TridiagonalMatrix::solveBatched, one for each row of the tridiagonal matrix, but got ", X.cols(), ".");
+
+    if(n == 0)
+        return;
+
+    //-------------------------------------------------------------------------
+    // Perform the forward solve with the L factor of the LU factorization
+    //-------------------------------------------------------------------------
+    for(Index i = 1; i < n; ++i)
+    {
+        const auto a = m_data[3*i];
+        const auto xprev = X.col(i - 1).data();
+        const auto xcurr = X.col(i).data();
+        for(Index j = 0; j < m; ++j)
+            xcurr[j] -= a * xprev[j];
+    }
+
+    //-------------------------------------------------------------------------
+    // Perform the backward solve with the U factor of the LU factorization
+    //-------------------------------------------------------------------------
+    const auto bn = m_data[3*n - 2];
+    const auto xlast = X.col(n - 1).data();
+    for(Index j = 0; j < m; ++j)
+        xlast[j] /= bn;
+
+    for(Index k = n - 1; k > 0; --k)
+    {
+        const auto i = k - 1; // the index of the current row
+        const auto b = m_data[3*i + 1];
+        const auto c = m_data[3*i + 2];
+        const auto xnext = X.col(i + 1).data();
+        const auto xcurr = X.col(i).data();
+        for(Index j = 0; j < m; ++j)
+            xcurr[j] = (xcurr[j] - c * xnext[j]) / b;
+    }
+}
+
+TridiagonalMatrix::operator MatrixXd() const
+{
+    const auto n = size();
+    MatrixXd res = zeros(n, n);
+    for(Index i = 0; i < n; ++i)
+    {
+        if(i > 0) res(i, i - 1) = m_data[3*i];
+        res(i, i) = m_data[3*i + 1];
+        if(i + 1 < n) res(i, i + 1) = m_data[3*i + 2];
+    }
+    return res;
+}
+
+Mesh::Mesh()
+{
+    setDiscretization(m_num_cells, m_xl, m_xr);
+}
+
+Mesh::Mesh(Index num_cells, double xl, double xr)
+{
+    setDiscretization(num_cells, xl, xr);
+}
+
+auto Mesh::setDiscretization(Index num_cells, double xl, double xr) -> void
+{
+    errorif(num_cells == 0, "Could not set the discretization of the mesh: the number of cells must be positive.");
+    errorif(xr <= xl, "Could not set the discretization of the mesh: the x-coordinate of the right boundary (", xr, ") needs to be larger than that of the left boundary (", xl, ").");
+
+    m_num_cells = num_cells;
+    m_xl = xl;
+    m_xr = xr;
+    m_dx = (xr - xl) / num_cells;
+    m_xcells = linspace(xl + 0.5*m_dx, xr - 0.5*m_dx, num_cells);
+}
+
+TransportSolver::TransportSolver()
+{}
+
+auto TransportSolver::initialize() -> void
+{
+    const auto dx = m_mesh.dx();
+    const auto beta = m_diffusion*m_dt/(dx*dx);
+    const auto num_cells = m_mesh.numCells();
+    const auto icell0 = 0;
+    const auto icelln = num_cells - 1;
+
+    errorif(num_cells < 2, "Expecting at least two cells in the mesh of TransportSolver, but got ", num_cells, ".");
+
+    m_A.resize(num_cells);
+    m_phi.resize(num_cells);
+
+    // Assemble the coefficient matrix A for the interior cells
+    for(Index icell = 1; icell < icelln; ++icell)
+        m_A.row(icell) << -beta, 1.0 + 2.0*beta, -beta;
+
+    // Assemble the coefficient matrix A for the boundary cells
+    m_A.row(icell0) << 0.0, 1.0 + 4.5*beta, -1.5*beta; // prescribed value on the wall with a second order approximation of the gradient there
+    m_A.row(icelln) << -beta, 1.0 + beta, 0.0; // du/dx = 0 at the right boundary
+
+    // Factorize A into LU factors for future uses in method step
+    m_A.factorize();
+}
+
+auto TransportSolver::step(VectorXdRef u, VectorXdConstRef q) -> void
+{
+    const auto dx = m_mesh.dx();
+    const auto num_cells = m_mesh.numCells();
+    const auto alpha = m_velocity*m_dt/dx;
+    const auto icell0 = 0;
+    const auto icelln = num_cells - 1;
+
+    errorif(m_A.size() != num_cells, "TransportSolver::initialize needs to be called before TransportSolver::step, and again after the mesh changes.");
+    errorif(u.size() != num_cells, "Expecting ", num_cells, " values of the transported quantity in TransportSolver::step, one for each cell, but got ", u.size(), ".");
+    errorif(alpha > 1.0, "Could not solve the advection problem explicitly because the Courant number v*dt/dx = ", alpha, " is larger than one. Try to decrease the time step.");
+
+    //-------------------------------------------------------------------------
+    // Solve the advection problem with an explicit flux-limited upwind scheme
+    //-------------------------------------------------------------------------
+    m_u0 = u;
+
+    m_phi[icell0] = 2.0; // this ensures the correct flux limiting behavior on the left boundary cell
+
+    // Calculate the flux limiters in the interior cells
+    for(Index icell = 1; icell < icelln; ++icell)
+    {
+        m_phi[icell] = superbee(m_u0[icell] - m_u0[icell - 1], m_u0[icell + 1] - m_u0[icell]);
+    }
+
+    // Compute the advection contributions to u for the interior cells
+    for(Index icell = 1; icell < icelln; ++icell)
+    {
+        const auto aux = 1.0 + 0.5*(m_phi[icell] - m_phi[icell - 1]);
+        u[icell] += aux*alpha*(m_u0[icell - 1] - m_u0[icell]);
+    }
+
+    // Handle the left boundary cell, whose value on the wall is prescribed
+    const auto aux = 1.0 + 0.5*m_phi[icell0];
+    u[icell0] += aux*alpha*(m_ul - m_u0[icell0]) + 3.0*m_diffusion*m_ul*m_dt/(dx*dx);
+
+    // Handle the right boundary cell, where du/dx = 0
+    u[icelln] += alpha*(m_u0[icelln - 1] - m_u0[icelln]);
+
+    // Add the source contribution
+    u += m_dt * q;
+
+    //-------------------------------------------------------------------------
+    // Solve the diffusion problem with an implicit scheme
+    //-------------------------------------------------------------------------
+    m_A.solve(u);
+}
+
+auto TransportSolver::step(VectorXdRef u) -> void
+{
+    step(u, VectorXd::Zero(u.size()));
+}
+
+auto TransportSolver::stepBatched(MatrixXdRef U, VectorXdConstRef ul) -> void
+{
+    const auto num_cells = m_mesh.numCells();
+
+    errorif(m_A.size() != num_cells, "TransportSolver::initialize needs to be called before TransportSolver::stepBatched, and again after the mesh changes.");
+    errorif(U.cols() != num_cells, "Expecting a matrix with ", num_cells, " columns in TransportSolver::stepBatched, one for each cell, but got ", U.cols(), ".");
+
+    //-------------------------------------------------------------------------
+    // Solve the advection problem with an explicit flux-limited upwind scheme
+    //-------------------------------------------------------------------------
+    m_u0_batch = U;
+
+    advectBatched(U, m_u0_batch, ul, 0, num_cells);
+
+    //-------------------------------------------------------------------------
+    // Solve the diffusion problem with an implicit scheme
+    //-------------------------------------------------------------------------
+    m_A.solveBatched(U);
+}
+
+auto TransportSolver::advectBatched(MatrixXdRef U, MatrixXdConstRef U0, VectorXdConstRef ul, Index ibegin, Index iend) const -> void
+{
+    const auto dx = m_mesh.dx();
+    const auto num_cells = m_mesh.numCells();
+    const auto alpha = m_velocity*m_dt/dx;
+    const auto icell0 = 0;
+    const auto icelln = num_cells - 1;
+    const auto m = U.rows();
+
+    errorif(U.cols() != num_cells || U0.cols() != num_cells, "Expecting matrices with ", num_cells, " columns in TransportSolver::advectBatched, one for each cell, but got ", U.cols(), " and ", U0.cols(), ".");
+    errorif(U0.rows() != m, "Expecting matrices with the same number of rows in TransportSolver::advectBatched, but got ", m, " and ", U0.rows(), ".");
+    errorif(ul.size() != m, "Expecting ", m, " boundary values in TransportSolver::advectBatched, one for each transported quantity, but got ", ul.size(), ".");
+    errorif(ibegin > iend || iend > num_cells, "Expecting a range of cells within [0, ", num_cells, ") in TransportSolver::advectBatched, but got [", ibegin, ", ", iend, ").");
+    errorif(alpha > 1.0, "Could not solve the advection problem explicitly because the Courant number v*dt/dx = ", alpha, " is larger than one. Try to decrease the time step.");
+
+    if(ibegin == iend)
+        return;
+
+    // The flux limiter of a transported quantity on a cell (2 on the left boundary cell, which ensures the correct flux limiting behavior there)
+    auto phi = [&](Index j, Index icell)
+    {
+        return icell == icell0 ? 2.0 : superbee(U0(j, icell) - U0(j, icell - 1), U0(j, icell + 1) - U0(j, icell));
+    };
+
+    // The flux limiters on the previous and current cells, swept from the cell before the first interior cell in the range
+    VectorXd phiW(m), phiP(m);
+
+    const auto ifirst = std::max<Index>(ibegin, 1);
+
+    for(Index j = 0; j < m; ++j)
+        phiW[j] = phi(j, ifirst - 1);
+
+    for(Index icell = ibegin; icell < iend; ++icell)
+    {
+        // Handle the left boundary cell, whose value on the wall is prescribed
+        if(icell == icell0)
+        {
+            for(Index j = 0; j < m; ++j)
+            {
+                const auto aux = 1.0 + 0.5*phi(j, icell0);
+                U(j, icell0) += aux*alpha*(ul[j] - U0(j, icell0)) + 3.0*m_diffusion*ul[j]*m_dt/(dx*dx);
+            }
+            continue;
+        }
+
+        // Handle the right boundary cell, where du/dx = 0
+        if(icell == icelln)
+        {
+            for(Index j = 0; j < m; ++j)
+                U(j, icelln) += alpha*(U0(j, icelln - 1) - U0(j, icelln));
+            continue;
+        }
+
+        // Compute the advection contributions to U for the interior cells
+        const auto uW = U0.col(icell - 1).data();
+        const auto uP = U0.col(icell).data();
+        const auto u = U.col(icell).data();
+        for(Index j = 0; j < m; ++j)
+        {
+            phiP[j] = phi(j, icell);
+            const auto aux = 1.0 + 0.5*(phiP[j] - phiW[j]);
+            u[j] += aux*alpha*(uW[j] - uP[j]);
+        }
+
+        std::swap(phiW, phiP);
+    }
+}
+
+namespace detail {
+
+/// Return the indices of the species in the fluid phases of a chemical system.
+auto indicesFluidSpecies(ChemicalSystem const& system) -> Indices
+{
+    Indices ifs;
+    auto offset = 0;
+    for(auto const& phase : system.phases())
+    {
+        const auto size = phase.species().size();
+        if(phase.stateOfMatter() != StateOfMatter::Solid)
+            for(auto i = 0; i < size; ++i)
+                ifs.push_back(offset + i);
+        offset += size;
+    }
+    return ifs;
+}
+
+} // namespace detail
+
+struct ReactiveTransportSolver::Impl
+{
+    /// The chemical system common to all cells.
+    const ChemicalSystem system;
+
+    /// The solver for the transport equations of the components in the fluid species.
+    TransportSolver transportsolver;
+
+    /// The options of the conventional chemical equilibrium calculations.
+    EquilibriumOptions eoptions;
+
+    /// The options of the smart chemical equilibrium calculations.
+    SmartEquilibriumOptions soptions;
+
+    /// The flag indicating if smart chemical equilibrium calculations are performed.
+    bool smart = false;
+
+    /// The formula matrix of the system restricted to its fluid species (in compressed sparse storage, with no entries in the columns of the solid species).
+    SparseMatrixXd Af;
+
+    /// The formula matrix of the system restricted to its solid species (in compressed sparse storage, with no entries in the columns of the fluid species).
+    SparseMatrixXd As;
+
+    /// The amounts of the components in the fluid species on the boundary.
+    VectorXd bbc;
+
+    /// The amounts of the species on each cell of the mesh (one column per cell).
+    MatrixXd n;
+
+    /// The amounts of the components in the fluid species on each cell of the mesh (one column per cell, contiguous over the components).
+    MatrixXd bf;
+
+    /// The amounts of the components in the solid species on each cell of the mesh (one column per cell, contiguous over the components).
+    MatrixXd bs;
+
+    /// The amounts of the components on each cell of the mesh (one column per cell, contiguous over the components).
+    MatrixXd b;
+
+    /// The amounts of the components in the fluid species on each cell of the mesh at the beginning of the time step (only used with pipelining).
+    MatrixXd bf0;
+
+    /// The current number of steps in the solution of the reactive transport equations.
+    Index steps = 0;
+
+    /// The communication among the processes sharing the chemical equilibrium calculations of the cells.
+    Communicator comm;
+
+    /// The partition of the cells among the processes, updated after each time step according to the costs of the cells.
+    DomainDecomposition decomposition;
+
+    /// The computing time of the last chemical equilibrium calculation in each cell (in s).
+    ArrayXd costs;
+
+    /// The auxiliary buffer with the values owned by the current process sent to the other processes.
+    ArrayXd sendbuffer;
+
+    /// The pool of worker threads used in the chemical equilibrium calculations (created on demand).
+    SharedPtr<ThreadPool> pool;
+
+    /// The conventional equilibrium solvers of the worker threads (created on demand).
+    Vec<EquilibriumSolver> esolvers;
+
+    /// The smart equilibrium solvers of the worker threads sharing their learned data (created on demand).
+    Vec<SmartEquilibriumSolver> ssolvers;
+
+    /// The equilibrium conditions of the worker threads (created on demand).
+    Vec<EquilibriumConditions> conditions;
+
+    /// The chemical states of the worker threads into which the cells of a ChemicalField object are materialized (created on demand).
+    Vec<ChemicalState> scratch;
+
+    /// The equilibrium states of the last cells computed by the worker threads, used as initial guesses for their next cells in a ChemicalField object (created on demand).
+    Vec<ChemicalState> neighbours;
+
+    /// The sensitivity derivatives of the last chemical equilibrium calculations of the worker threads (only used with warm starts from predictions).
+    Vec<EquilibriumSensitivity> sensitivities;
+
+    /// The index of the last cell successfully equilibrated by each worker thread in the current time step.
+    Indices lastcells;
+
+    /// The relative tolerance on the changes in the inputs of a cell below which its chemical equilibrium calculation is skipped (negative if disabled).
+    double inputtol = -1.0;
+
+    /// The convergence tolerances of the chemical equilibrium calculations in the cells (empty if those in the options are used).
+    ArrayXd tolerances;
+
+    /// The temperatures of the cells in the current time step (in K).
+    ArrayXd T;
+
+    /// The pressures of the cells in the current time step (in Pa).
+    ArrayXd P;
+
+    /// The temperature, pressure, and amounts of components of each cell in its last chemical equilibrium calculation (one column per cell, NaN if unknown).
+    MatrixXd inputs;
+
+    /// The cells owned by the current process whose chemical equilibrium calculations are performed in the current time step.
+    Indices targets;
+
+    /// The next cell with the same inputs as a cell in the current time step, which takes its equilibrium state (`Index(-1)` if none).
+    Indices duplicates;
+
+    /// The first cell in the current time step with the inputs of a given hash.
+    std::unordered_map<std::size_t, Index> uniques;
+
+    /// The number of blocks of owned cells whose transport, chemical equilibrium calculations, and output are pipelined (disabled if smaller than two).
+    Index numblocks = 0;
+
+    /// The function called with each range of owned cells after their chemical equilibrium calculations (empty if none).
+    OutputFn output;
+
+    /// Construct a ReactiveTransportSolver::Impl object with given chemical system.
+    Impl(ChemicalSystem const& system)
+    : system(system)
+    {
+        auto const& A = system.formulaMatrix();
+        MatrixXd Afdense = zeros(A.rows(), A.cols());
+        for(auto i : detail::indicesFluidSpecies(system))
+            Afdense.col(i) = A.col(i);
+        Af = Afdense.sparseView();
+        As = (A - Afdense).sparseView();
+        bbc = zeros(A.rows());
+    }
+
+    /// Construct a copy of a ReactiveTransportSolver::Impl object (the worker solvers are not copied, and thus nor their learned data).
+    Impl(Impl const& other)
+    : system(other.system), transportsolver(other.transportsolver), eoptions(other.eoptions), soptions(other.soptions), smart(other.smart),
+      Af(other.Af), As(other.As), bbc(other.bbc), n(other.n), bf(other.bf), bs(other.bs), b(other.b), steps(other.steps),
+      comm(other.comm), decomposition(other.decomposition), costs(other.costs),
+      inputtol(other.inputtol), tolerances(other.tolerances), T(other.T), P(other.P), inputs(other.inputs), duplicates(other.duplicates),
+      numblocks(other.numblocks), output(other.output)
+    {}
+
+    /// Return the number of worker threads requested in the options.
+    auto numThreadsOption() const -> unsigned
+    {
+        return smart ? soptions.learning.threads : eoptions.threads;
+    }
+
+    /// Ensure the workers need to be recreated the next time they are needed.
+    auto resetWorkers() -> void
+    {
+        esolvers.clear();
+        ssolvers.clear();
+        conditions.clear();
+        scratch.clear();
+        neighbours.clear();
+        sensitivities.clear();
+        const auto numthreads = numThreadsOption();
+        if(pool && numthreads != 0 && pool->numThreads() != numthreads)
+            pool.reset();
+    }
+
+    /// Ensure the pool of worker threads and their solvers exist.
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(numThreadsOption());
+
+        const auto numworkers = pool->numThreads();
+
+        if(conditions.size() == numworkers)
+            return;
+
+        resetWorkers();
+
+        const auto specs = EquilibriumSpecs::TP(system);
+
+        for(Index i = 0; i < numworkers; ++i)
+        {
+            conditions.emplace_back(specs);
+            scratch.emplace_back(system);
+            neighbours.emplace_back(system);
+            sensitivities.emplace_back(specs);
+            if(smart)
+            {
+                ssolvers.emplace_back(specs);
+                ssolvers.back().setOptions(soptions);
+                if(i > 0)
+                    ssolvers.back().shareLearningData(ssolvers.front());
+            }
+            else
+            {
+                esolvers.emplace_back(specs);
+                esolvers.back().setOptions(eoptions);
+            }
+        }
+
+        // With pinned worker threads, recreate the objects of each worker in its own thread, so that their memory is local to its socket on NUMA systems (worker 0 is the calling thread)
+        if(pool->pinned())
+        {
+            pool->forEachWorker([&](Index iworker)
+            {
+                if(iworker == 0)
+                    return;
+                scratch[iworker] = ChemicalState(system);
+                neighbours[iworker] = ChemicalState(system);
+                sensitivities[iworker] = EquilibriumSensitivity(specs);
+                if(smart)
+                {
+                    ssolvers[iworker] = SmartEquilibriumSolver(specs);
+                    ssolvers[iworker].setOptions(soptions);
+                    ssolvers[iworker].shareLearningData(ssolvers.front());
+                }
+                else
+                {
+                    esolvers[iworker] = EquilibriumSolver(specs);
+                    esolvers[iworker].setOptions(eoptions);
+                }
+            });
+        }
+    }
+
+    /// Initialize the reactive transport solver before the time steps.
+    auto initialize() -> void
+    {
+        const auto num_cells = transportsolver.mesh().numCells();
+        const auto num_components = Af.rows();
+
+        n.resize(Af.cols(), num_cells);
+        bf.resize(num_components, num_cells);
+        bs.resize(num_components, num_cells);
+        b.resize(num_components, num_cells);
+
+        decomposition = DomainDecomposition(num_cells, comm.size);
+        costs = zeros(num_cells);
+
+        T.resize(num_cells);
+        P.resize(num_cells);
+        inputs.setConstant(2 + num_components, num_cells, NaN);
+        duplicates.resize(num_cells);
+
+        transportsolver.initialize();
+    }
+
+    /// Transport the components in the fluid species of each cell given the amounts of the species in the cells (one column per cell).
+    auto transport(MatrixXdConstRef nspecies) -> void
+    {
+        // Compute the amounts of the components in the fluid and solid species on each cell
+        bf.noalias() = Af * nspecies;
+        bs.noalias() = As * nspecies;
+
+        // Transport all components in the fluid species at once (the amounts of the components on each cell are interleaved)
+        transportsolver.stepBatched(bf, bbc);
+
+        // Sum the amounts of components distributed among fluid and solid species
+        b.noalias() = bf + bs;
+    }
+
+    /// Return true if the transport step is explicit, so that the cells can be transported in independent blocks.
+    auto explicitTransport() const -> bool
+    {
+        return transportsolver.diffusionCoeff() == 0.0;
+    }
+
+    /// Prepare the transport of the components in the fluid species of each cell in blocks given the amounts of the species in the cells (one column per cell).
+    /// The cells not owned by the current process are transported here, and
+    /// the owned ones later with @ref transportBlock, unless the transport
+    /// step is implicit, in which case all cells are transported here.
+    auto transportPrepare(MatrixXdConstRef nspecies) -> void
+    {
+        if(!explicitTransport())
+        {
+            transport(nspecies);
+            return;
+        }
+
+        bf0.noalias() = Af * nspecies;
+        bs.noalias() = As * nspecies;
+        bf = bf0;
+
+        const auto num_cells = nspecies.cols();
+
+        transportBlock(0, decomposition.begin(comm.rank));
+        transportBlock(decomposition.end(comm.rank), num_cells);
+    }
+
+    /// Transport the components in the fluid species of a block of cells explicitly, from their amounts at the beginning of the time step.
+    /// Only the columns of the cells in the block are changed, so that blocks can be transported while others are equilibrated.
+    auto transportBlock(Index ibegin, Index iend) -> void
+    {
+        const auto size = iend - ibegin;
+        transportsolver.advectBatched(bf, bf0, bbc, ibegin, iend);
+        b.middleCols(ibegin, size).noalias() = bf.middleCols(ibegin, size) + bs.middleCols(ibegin, size);
+    }
+
+    /// Return the source of the initial guesses of the chemical equilibrium calculations in the cells.
+    auto warmStart() const -> EquilibriumWarmStart
+    {
+        return smart ? soptions.learning.warm_start : eoptions.warm_start;
+    }
+
+    /// Return true if the equilibrium state of the previous cell, just computed by a worker thread, is the initial guess of a cell (see EquilibriumOptions::warm_start).
+    auto warmStartedFromNeighbour(Index icell, Index iworker) const -> bool
+    {
+        return warmStart() != EquilibriumWarmStart::PreviousStep && icell > 0 && lastcells[iworker] == icell - 1;
+    }
+
+    /// Equilibrate a chemical state with the amounts of components in a cell using the solver of a worker thread.
+    /// @param state The chemical state of the cell
+    /// @param neighbour The equilibrium state of the previous cell used as initial guess (`nullptr` if the state of the cell is used)
+    auto equilibrate(ChemicalState& state, ChemicalState const* neighbour, Index icell, Index iworker) -> bool
+    {
+        auto& cond = conditions[iworker];
+        cond.temperature(state.temperature());
+        cond.pressure(state.pressure());
+        cond.setInitialComponentAmounts(b.col(icell));
+        cond.setTolerance(tolerances.size() ? tolerances[icell] : 0.0);
+
+        // The smart equilibrium solvers predict with their learned data, so the predictions from the previous cell are only used by the conventional ones
+        const auto predicted = !smart && warmStart() == EquilibriumWarmStart::Predicted;
+
+        auto solve = [&]()
+        {
+            return smart ?
+                ssolvers[iworker].solve(state, cond).succeeded() :
+                predicted ?
+                    esolvers[iworker].solve(state, sensitivities[iworker], cond).succeeded() :
+                    esolvers[iworker].solve(state, cond).succeeded();
+        };
+
+        if(neighbour == nullptr)
+            return solve();
+
+        const ChemicalState own(state); // the initial guess used if the calculation from the previous cell fails
+
+        if(predicted)
+        {
+            EquilibriumPredictor predictor(*neighbour, sensitivities[iworker], true);
+            predictor.predict(state, cond);
+
+            // Ensure the predicted species amounts are positive
+            const ArrayXd npred = state.speciesAmounts().cast<double>().max(eoptions.epsilon);
+            state.setSpeciesAmounts(npred);
+        }
+        else
+        {
+            state.setSpeciesAmounts(neighbour->speciesAmounts());
+            state.equilibrium().assign(neighbour->equilibrium());
+        }
+
+        if(solve())
+            return true;
+
+        state = own;
+
+        return solve();
+    }
+
+    /// Return true if the inputs of a cell changed less than the input tolerance since its last chemical equilibrium calculation.
+    auto unchanged(Index icell) const -> bool
+    {
+        const auto last = inputs.col(icell).array();
+        const auto nb = b.rows();
+
+        // Comparisons with NaN are false, and thus cells never equilibrated are not unchanged
+        return std::abs(T[icell] - last[0]) <= inputtol * std::abs(last[0])
+            && std::abs(P[icell] - last[1]) <= inputtol * std::abs(last[1])
+            && ((b.col(icell).array() - last.tail(nb)).abs() <= inputtol * last.tail(nb).abs()).all();
+    }
+
+    /// Return true if two cells have exactly the same inputs in the current time step.
+    auto identical(Index icell, Index jcell) const -> bool
+    {
+        return T[icell] == T[jcell] && P[icell] == P[jcell] && b.col(icell) == b.col(jcell);
+    }
+
+    /// Return the hash of the inputs of a cell in the current time step.
+    auto hashInputs(Index icell) const -> std::size_t
+    {
+        auto seed = hashCombine(0, T[icell], P[icell]);
+        for(Index i = 0; i < b.rows(); ++i)
+            seed = hashCombine(seed, b(i, icell));
+        return seed;
+    }
+
+    /// Append the cells in a range that need chemical equilibrium calculations in the current time step to @ref targets.
+    /// Without an input tolerance, these are all cells in the range. Otherwise,
+    /// the cells whose inputs barely changed since their last calculation are
+    /// skipped, and among the cells with identical inputs, only the first is
+    /// equilibrated, with the others linked to it in @ref duplicates.
+    auto determineTargetCells(Index ibegin, Index iend) -> void
+    {
+        if(inputtol < 0.0)
+        {
+            for(Index icell = ibegin; icell < iend; ++icell)
+                targets.push_back(icell);
+            return;
+        }
+
+        uniques.clear();
+
+        for(Index icell = ibegin; icell < iend; ++icell)
+        {
+            if(unchanged(icell))
+                continue;
+
+            auto [it, inserted] = uniques.emplace(hashInputs(icell), icell);
+
+            // Cells with colliding hashes but different inputs are equilibrated on their own
+            if(inserted || !identical(it->second, icell))
+            {
+                targets.push_back(icell);
+                continue;
+            }
+
+            // Push the cell to the front of the list of cells sharing the equilibrium state of the first one
+            duplicates[icell] = duplicates[it->second];
+            duplicates[it->second] = icell;
+        }
+    }
+
+    /// Store the inputs of a cell used in its chemical equilibrium calculation in the current time step.
+    auto storeInputs(Index icell, Index jcell) -> void
+    {
+        const auto nb = b.rows();
+        inputs(0, icell) = T[jcell];
+        inputs(1, icell) = P[jcell];
+        inputs.col(icell).tail(nb) = b.col(jcell);
+    }
+
+    /// Prepare the equilibration of the cells owned by the current process in the current time step.
+    auto equilibratePrepare(Vec<char>& succeeded) -> void
+    {
+        initializeWorkers();
+
+        const auto ibegin = decomposition.begin(comm.rank);
+        const auto num_owned = decomposition.count(comm.rank);
+
+        targets.clear();
+
+        std::fill(duplicates.begin(), duplicates.end(), Index(-1));
+
+        succeeded.assign(num_owned, 0);
+
+        lastcells.assign(pool->numThreads(), Index(-1));
+
+        costs.segment(ibegin, num_owned).setZero();
+    }
+
+    /// Equilibrate a target cell using the solver of a worker thread, measuring its cost and copying its equilibrium state into the cells with identical inputs.
+    template<typename Function, typename CopyFunction>
+    auto equilibrateTarget(Index i, Index iworker, Vec<char>& succeeded, Function const& fn, CopyFunction const& copy) -> void
+    {
+        const auto icell = targets[i];
+        const auto start = time();
+        succeeded[i] = fn(icell, iworker);
+        costs[icell] = elapsed(start);
+        lastcells[iworker] = succeeded[i] ? icell : Index(-1);
+
+        if(!succeeded[i] || inputtol < 0.0)
+            return;
+
+        storeInputs(icell, icell);
+
+        for(auto idup = duplicates[icell]; idup != Index(-1); idup = duplicates[idup])
+        {
+            copy(icell, idup, iworker);
+            storeInputs(idup, icell);
+        }
+    }
+
+    /// Ensure the chemical equilibrium calculations of all target cells succeeded.
+    auto equilibrateCheck(Vec<char> const& succeeded) const -> void
+    {
+        for(Index i = 0; i < targets.size(); ++i)
+            errorif(!succeeded[i], "The chemical equilibrium calculation in cell ", targets[i], " failed in time step ", steps, " of ReactiveTransportSolver::step.");
+    }
+
+    /// Equilibrate the cells owned by the current process among the worker threads, measuring the cost of each cell.
+    /// The cells skipped or sharing the equilibrium state of another cell have zero cost (see @ref determineTargetCells).
+    /// @param fn The function that equilibrates a cell using the solver of a worker thread, and returns true if successful
+    /// @param copy The function that copies the equilibrium state of a cell, just computed by a worker thread, into another cell with identical inputs
+    template<typename Function, typename CopyFunction>
+    auto equilibrateOwnedCells(Function const& fn, CopyFunction const& copy) -> void
+    {
+        Vec<char> succeeded;
+
+        equilibratePrepare(succeeded);
+
+        const auto ibegin = decomposition.begin(comm.rank);
+        const auto iend = decomposition.end(comm.rank);
+
+        determineTargetCells(ibegin, iend);
+
+        pool->parallelFor(targets.size(), [&](Index i, Index iworker)
+        {
+            equilibrateTarget(i, iworker, succeeded, fn, copy);
+        });
+
+        equilibrateCheck(succeeded);
+
+        if(output)
+            output(ibegin, iend);
+    }
+
+    /// Transport, equilibrate, and output the cells owned by the current process in pipelined blocks.
+    /// In each stage of the pipeline, the tasks executed by the worker threads
+    /// are the output of the previous block, the transport of the next block
+    /// (if the transport step is explicit), and the chemical equilibrium
+    /// calculations of the current block. The first two tasks come first, so
+    /// that they start immediately while the other workers equilibrate cells.
+    /// @param nspecies The amounts of the species in the cells at the beginning of the time step (one column per cell)
+    /// @param fn The function that equilibrates a cell using the solver of a worker thread, and returns true if successful
+    /// @param copy The function that copies the equilibrium state of a cell, just computed by a worker thread, into another cell with identical inputs
+    template<typename Function, typename CopyFunction>
+    auto pipelineOwnedCells(MatrixXdConstRef nspecies, Function const& fn, CopyFunction const& copy) -> void
+    {
+        Vec<char> succeeded;
+
+        equilibratePrepare(succeeded);
+
+        transportPrepare(nspecies);
+
+        const auto ibegin = decomposition.begin(comm.rank);
+        const auto num_owned = decomposition.count(comm.rank);
+        const auto num_blocks = std::min(numblocks, num_owned);
+        const auto blockwise = explicitTransport();
+
+        // The index of the first cell in a block (or the index after the last owned cell if the block is past the last one)
+        auto first = [&](Index k) { return ibegin + std::min(k, num_blocks) * num_owned / num_blocks; };
+
+        if(blockwise)
+            transportBlock(first(0), first(1));
+
+        for(Index k = 0; k <= num_blocks; ++k)
+        {
+            const auto offset = targets.size();
+
+            if(k < num_blocks)
+                determineTargetCells(first(k), first(k + 1));
+
+            const auto outputting = output && k > 0;
+            const auto transporting = blockwise && k + 1 < num_blocks;
+            const auto num_extra = Index(outputting) + Index(transporting);
+            const auto num_targets = targets.size() - offset;
+
+            pool->parallelFor(num_extra + num_targets, [&](Index i, Index iworker)
+            {
+                if(outputting && i == 0)
+                    output(first(k - 1), first(k));
+                else if(transporting && i + 1 == num_extra)
+                    transportBlock(first(k + 1), first(k + 2));
+                else equilibrateTarget(offset + i - num_extra, iworker, succeeded, fn, copy);
+            });
+        }
+
+        equilibrateCheck(succeeded);
+    }
+
+    /// Return true if the transport, chemical equilibrium calculations, and output of the owned cells are pipelined.
+    auto pipelined() const -> bool
+    {
+        return numblocks > 1 && decomposition.count(comm.rank) > 1;
+    }
+
+    /// Gather the species amounts (one column per cell) and the costs of the cells owned by each process in all processes, and rebalance the cells among them.
+    auto exchange(MatrixXdRef nspecies) -> void
+    {
+        if(comm.size == 1)
+            return;
+
+        const auto Nn = nspecies.rows();
+        const auto num_cells = nspecies.cols();
+        const auto ibegin = decomposition.begin(comm.rank);
+        const auto num_owned = decomposition.count(comm.rank);
+
+        Indices counts = decomposition.counts();
+
+        sendbuffer = costs.segment(ibegin, num_owned);
+        comm.allgatherv(sendbuffer, costs, counts);
+
+        for(auto& count : counts)
+            count *= Nn;
+
+        // The species amounts of the cells are contiguous in memory, one column per cell
+        sendbuffer = ArrayXd::Map(nspecies.data() + ibegin*Nn, num_owned*Nn);
+        comm.allgatherv(sendbuffer, ArrayXd::Map(nspecies.data(), num_cells*Nn), counts);
+
+        // The cells equilibrated by other processes cannot be skipped in the next time step if they become owned by the current process
+        inputs.leftCols(ibegin).setConstant(NaN);
+        inputs.rightCols(num_cells - ibegin - num_owned).setConstant(NaN);
+
+        decomposition.partition(costs);
+    }
+
+    /// Share the learned data of the smart equilibrium solvers among all processes.
+    auto shareLearningDataAmongRanks() -> void
+    {
+        errorif(!smart, "ReactiveTransportSolver::shareLearningDataAmongRanks can only be used with smart chemical equilibrium calculations (see ReactiveTransportSolver::setOptions).");
+
+        initializeWorkers();
+
+        // The solvers of the worker threads share their learned data, so that merging into the first one is enough
+        auto& ssolver = ssolvers.front();
+
+        std::ostringstream out;
+        ssolver.saveLearningData(out);
+
+        const auto buffers = comm.allgatherBytes(out.str());
+
+        errorif(buffers.size() != comm.size, "Expecting the learned data of ", comm.size, " processes in ReactiveTransportSolver::shareLearningDataAmongRanks, but got ", buffers.size(), ".");
+
+        for(Index rank = 0; rank < comm.size; ++rank)
+        {
+            if(rank == comm.rank)
+                continue;
+            std::istringstream in(buffers[rank]);
+            ssolver.mergeLearningData(in);
+        }
+    }
+
+    /// Perform a time step of the reactive transport problem.
+    auto step(Vec<ChemicalState>& states) -> void
+    {
+        const auto num_cells = transportsolver.mesh().numCells();
+
+        errorif(b.cols() != num_cells, "ReactiveTransportSolver::initialize needs to be called before ReactiveTransportSolver::step, and again after the mesh changes.");
+        errorif(states.size() != num_cells, "Expecting ", num_cells, " ChemicalState objects in ReactiveTransportSolver::step, one for each cell, but got ", states.size(), ".");
+        errorif(tolerances.size() && tolerances.size() != num_cells, "Expecting ", num_cells, " convergence tolerances in ReactiveTransportSolver::setEquilibriumTolerances, one for each cell, but got ", tolerances.size(), ".");
+
+        // Collect the temperature, pressure, and amounts of the species on each cell
+        for(Index icell = 0; icell < num_cells; ++icell)
+        {
+            T[icell] = states[icell].temperature();
+            P[icell] = states[icell].pressure();
+            n.col(icell) = states[icell].speciesAmounts().matrix();
+        }
+
+        auto fn = [&](Index icell, Index iworker)
+        {
+            auto const* neighbour = warmStartedFromNeighbour(icell, iworker) ? &states[icell - 1] : nullptr;
+            return equilibrate(states[icell], neighbour, icell, iworker);
+        };
+
+        auto copy = [&](Index icell, Index idup, Index iworker)
+        {
+            states[idup].assign(states[icell]);
+        };
+
+        // Transport the components and equilibrate the chemical state of each cell owned by the current process with its new amounts of components
+        if(pipelined())
+            pipelineOwnedCells(n, fn, copy);
+        else
+        {
+            transport(n);
+            equilibrateOwnedCells(fn, copy);
+        }
+
+        // Update the chemical states of the cells owned by other processes with the species amounts computed by them
+        if(comm.size > 1)
+        {
+            const auto ibegin = decomposition.begin(comm.rank);
+            const auto iend = decomposition.end(comm.rank);
+
+            for(Index icell = ibegin; icell < iend; ++icell)
+                n.col(icell) = states[icell].speciesAmounts().matrix();
+
+            exchange(n);
+
+            for(Index icell = 0; icell < num_cells; ++icell)
+                if(icell < ibegin || icell >= iend)
+                    states[icell].setSpeciesAmounts(n.col(icell).array());
+        }
+
+        ++steps;
+    }
+
+    /// Perform a time step of the reactive transport problem with the chemical states of the cells stored in a ChemicalField object.
+    auto step(ChemicalField& field) -> void
+    {
+        const auto num_cells = transportsolver.mesh().numCells();
+
+        errorif(b.cols() != num_cells, "ReactiveTransportSolver::initialize needs to be called before ReactiveTransportSolver::step, and again after the mesh changes.");
+        errorif(field.size() != num_cells, "Expecting a ChemicalField object with ", num_cells, " cells in ReactiveTransportSolver::step, one for each cell in the mesh, but got ", field.size(), ".");
+        errorif(tolerances.size() && tolerances.size() != num_cells, "Expecting ", num_cells, " convergence tolerances in ReactiveTransportSolver::setEquilibriumTolerances, one for each cell, but got ", tolerances.size(), ".");
+
+        T = field.temperatures();
+        P = field.pressures();
+
+        // Equilibrate each cell owned by the current process materialized into the chemical state of the worker thread, and store the result back in the field
+        auto fn = [&](Index icell, Index iworker)
+        {
+            auto& state = scratch[iworker];
+            auto const* neighbour = warmStartedFromNeighbour(icell, iworker) ? &neighbours[iworker] : nullptr;
+            if(neighbour)
+                neighbours[iworker] = state; // the equilibrium state of the previous cell, still in the chemical state of the worker
+            field.get(icell, state);
+            const auto succeeded = equilibrate(state, neighbour, icell, iworker);
+            field.set(icell, state);
+            return succeeded;
+        };
+
+        auto copy = [&](Index icell, Index idup, Index iworker)
+        {
+            field.set(idup, scratch[iworker]);
+        };
+
+        // The amounts of the species on each cell are already stored contiguously in the field
+        if(pipelined())
+            pipelineOwnedCells(field.speciesAmounts(), fn, copy);
+        else
+        {
+            transport(field.speciesAmounts());
+            equilibrateOwnedCells(fn, copy);
+        }
+
+        exchange(field.speciesAmounts());
+
+        ++steps;
+    }
+};
+
+ReactiveTransportSolver::ReactiveTransportSolver(ChemicalSystem const& system)
+: pimpl(new Impl(system))
+{}
+
+ReactiveTransportSolver::ReactiveTransportSolver(ReactiveTransportSolver const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ReactiveTransportSolver::~ReactiveTransportSolver()
+{}
+
+auto ReactiveTransportSolver::operator=(ReactiveTransportSolver other) -> ReactiveTransportSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ReactiveTransportSolver::setMesh(Mesh const& mesh) -> void
+{
+    pimpl->transportsolver.setMesh(mesh);
+}
+
+auto ReactiveTransportSolver::setVelocity(double val) -> void
+{
+    pimpl->transportsolver.setVelocity(val);
+}
+
+auto ReactiveTransportSolver::setDiffusionCoeff(double val) -> void
+{
+    pimpl->transportsolver.setDiffusionCoeff(val);
+}
+
+auto ReactiveTransportSolver::setBoundaryState(ChemicalState const& state) -> void
+{
+    pimpl->bbc = pimpl->Af * state.speciesAmounts().matrix().cast<double>();
+}
+
+auto ReactiveTransportSolver::setTimeStep(double val) -> void
+{
+    pimpl->transportsolver.setTimeStep(val);
+}
+
+auto ReactiveTransportSolver::setOptions(EquilibriumOptions const& options) -> void
+{
+    pimpl->eoptions = options;
+    pimpl->smart = false;
+    pimpl->resetWorkers();
+}
+
+auto ReactiveTransportSolver::setOptions(SmartEquilibriumOptions const& options) -> void
+{
+    pimpl->soptions = options;
+    pimpl->smart = true;
+    pimpl->resetWorkers();
+}
+
+auto ReactiveTransportSolver::setInputTolerance(double reltol) -> void
+{
+    // The inputs of the cells are not stored while disabled, and thus become unknown
+    pimpl->inputtol = reltol;
+    if(reltol < 0.0)
+        pimpl->inputs.setConstant(NaN);
+}
+
+auto ReactiveTransportSolver::setEquilibriumTolerances(ArrayXdConstRef tolerances) -> void
+{
+    errorif((tolerances < 0.0).any(), "Expecting non-negative convergence tolerances in ReactiveTransportSolver::setEquilibriumTolerances.");
+    pimpl->tolerances = tolerances;
+}
+
+auto ReactiveTransportSolver::setPipelineBlocks(Index num_blocks) -> void
+{
+    pimpl->numblocks = num_blocks;
+}
+
+auto ReactiveTransportSolver::setOutput(OutputFn const& fn) -> void
+{
+    pimpl->output = fn;
+}
+
+auto ReactiveTransportSolver::setCommunicator(Communicator const& comm) -> void
+{
+    errorif(comm.size == 0 || comm.rank >= comm.size, "Could not set the communicator of ReactiveTransportSolver: expecting a rank smaller than the number of processes (", comm.size, "), but got ", comm.rank, ".");
+    pimpl->comm = comm;
+}
+
+auto ReactiveTransportSolver::system() const -> ChemicalSystem const&
+{
+    return pimpl->system;
+}
+
+auto ReactiveTransportSolver::componentAmountsInFluid() const -> MatrixXdConstRef
+{
+    return pimpl->bf;
+}
+
+auto ReactiveTransportSolver::componentAmountsInSolid() const -> MatrixXdConstRef
+{
+    return pimpl->bs;
+}
+
+auto ReactiveTransportSolver::decomposition() const -> DomainDecomposition const&
+{
+    return pimpl->decomposition;
+}
+
+auto ReactiveTransportSolver::cellCosts() const -> ArrayXdConstRef
+{
+    return pimpl->costs;
+}
+
+auto ReactiveTransportSolver::steps() const -> Index
+{
+    return pimpl->steps;
+}
+
+auto ReactiveTransportSolver::initialize() -> void
+{
+    pimpl->initialize();
+}
+
+auto ReactiveTransportSolver::step(Vec<ChemicalState>& states) -> void
+{
+    pimpl->step(states);
+}
+
+auto ReactiveTransportSolver::step(ChemicalField& field) -> void
+{
+    pimpl->step(field);
+}
+
+auto ReactiveTransportSolver::shareLearningDataAmongRanks() -> void
+{
+    pimpl->shareLearningDataAmongRanks();
+}
+
+} // namespace Reaktoro
@@ -1,334 +1,465 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2022 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalField;
+class ChemicalState;
+class ChemicalSystem;
+class DomainDecomposition;
+struct Communicator;
+struct EquilibriumOptions;
+struct SmartEquilibriumOptions;
+
+/// Used to represent a tridiagonal matrix in the discretized transport equations.
+/// The coefficients are stored row by row in a single vector, so that
+/// the *i*-th row occupies the entries `3i`, `3i + 1`, and `3i + 2`,
+/// corresponding to the sub-diagonal *a*, diagonal *b*, and super-diagonal
+/// *c* coefficients of that row. The entries *a* of the first row and *c*
+/// of the last row are not used.
+class TridiagonalMatrix
+{
+public:
+    /// Construct a default TridiagonalMatrix object.
+    TridiagonalMatrix() : TridiagonalMatrix(0) {}
+
+    /// Construct a TridiagonalMatrix object with given number of rows.
+    explicit TridiagonalMatrix(Index size) : m_size(size), m_data(VectorXd::Zero(3 * size)) {}
+
+    /// Return the number of rows of the matrix.
+    auto size() const -> Index { return m_size; }
+
+    /// Return the coefficients of the matrix stored row by row.
+    auto data() -> VectorXdRef { return m_data; }
+
+    /// Return the coefficients of the matrix stored row by row.
+    auto data() const -> VectorXdConstRef { return m_data; }
+
+    /// Return the coefficients *a*, *b*, and *c* on a row of the matrix.
+    auto row(Index index) -> VectorXdRef { return m_data.segment(3 * index, 3); }
+
+    /// Return the coefficients *a*, *b*, and *c* on a row of the matrix.
+    auto row(Index index) const -> VectorXdConstRef { return m_data.segment(3 * index, 3); }
+
+    /// Return the sub-diagonal coefficients of the matrix.
+    auto a() -> VectorXdStridedRef { return VectorXd::Map(m_data.data() + 3, size() - 1, Eigen::InnerStride<3>()); }
+
+    /// Return the sub-diagonal coefficients of the matrix.
+    auto a() const -> VectorXdStridedConstRef { return VectorXd::Map(m_data.data() + 3, size() - 1, Eigen::InnerStride<3>()); }
+
+    /// Return the diagonal coefficients of the matrix.
+    auto b() -> VectorXdStridedRef { return VectorXd::Map(m_data.data() + 1, size(), Eigen::InnerStride<3>()); }
+
+    /// Return the diagonal coefficients of the matrix.
+    auto b() const -> VectorXdStridedConstRef { return VectorXd::Map(m_data.data() + 1, size(), Eigen::InnerStride<3>()); }
+
+    /// Return the super-diagonal coefficients of the matrix.
+    auto c() -> VectorXdStridedRef { return VectorXd::Map(m_data.data() + 2, size() - 1, Eigen::InnerStride<3>()); }
+
+    /// Return the super-diagonal coefficients of the matrix.
+    auto c() const -> VectorXdStridedConstRef { return VectorXd::Map(m_data.data() + 2, size() - 1, Eigen::InnerStride<3>()); }
+
+    /// Resize the matrix to a given number of rows, keeping the coefficients of the remaining rows.
+    auto resize(Index size) -> void;
+
+    /// Factorize the matrix in place into its LU factors to solve linear systems *Ax = d*.
+    /// After this call, the coefficients *a* and *b* store the sub-diagonal of
+    /// *L* (whose diagonal is unit) and the diagonal of *U*, respectively, and
+    /// the coefficients *c* remain the super-diagonal of *U*.
+    auto factorize() -> void;
+
+    /// Solve a linear system *Ax = d* with the LU factors computed in @ref factorize.
+    /// Vectors `x` and `d` can be the same.
+    auto solve(VectorXdRef x, VectorXdConstRef d) const -> void;
+
+    /// Solve a linear system *Ax = d* with the LU factors computed in @ref factorize, where `x` is *d* on input and the solution on output.
+    auto solve(VectorXdRef x) const -> void;
+
+    /// Solve many linear systems *Ax = d* with the LU factors computed in @ref factorize.
+    /// The right-hand sides are interleaved, so that the *i*-th column of `X`
+    /// contains the *i*-th entries of all right-hand sides on input, and of
+    /// their solutions on output. The forward and backward sweeps thus operate
+    /// on whole contiguous columns, and vectorize across the right-hand sides.
+    /// @param[in,out] X The right-hand sides (in) and the solutions (out), with one row per linear system
+    auto solveBatched(MatrixXdRef X) const -> void;
+
+    /// Convert this TridiagonalMatrix object into a dense matrix.
+    operator MatrixXd() const;
+
+private:
+    /// The number of rows of the matrix.
+    Index m_size;
+
+    /// The coefficients of the matrix stored row by row.
+    VectorXd m_data;
+};
 
-// #pragma once
-
-// // C++ includes
-// #include <memory>
-// #include <vector>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/Index.hpp>
-// #include <Reaktoro/Common/Matrix.hpp>
-// #include <Reaktoro/Common/StringList.hpp>
-// #include <Reaktoro/Core/ChemicalOutput.hpp>
-// #include <Reaktoro/Core/ChemicalProps.hpp>
-// #include <Reaktoro/Core/ChemicalState.hpp>
-// #include <Reaktoro/Core/ChemicalSystem.hpp>
-// #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
-
-// namespace Reaktoro {
-
-// // Forward declarations
-// //class ChemicalProps;
-// //class ChemicalState;
-// //class ChemicalSystem;
-
-// //class BoundaryState
-// //{
-// //public:
-// //    BoundaryState(const ChemicalState& state);
-// //
-// //private:
-// //};
-// //
-// //class BoundaryFlux
-// //{
-// //public:
-// //    BoundaryFlux(const ChemicalState& state);
-// //
-// //private:
-// //};
-
-
-// class ChemicalField
-// {
-// public:
-//     using Iterator = std::vector<ChemicalState>::iterator;
-
-//     using ConstIterator = std::vector<ChemicalState>::const_iterator;
-
-//     ChemicalField(Index size, const ChemicalSystem& system);
-
-//     ChemicalField(Index size, const ChemicalState& state);
-
-//     auto size() const -> Index { return m_size; }
-
-//     auto begin() const -> ConstIterator { return m_states.cbegin(); }
-
-//     auto begin() -> Iterator { return m_states.begin(); }
-
-//     auto end() const -> ConstIterator { return m_states.cend(); }
-
-//     auto end() -> Iterator { return m_states.end(); }
-
-//     auto operator[](Index index) const -> const ChemicalState& { return m_states[index]; }
-
-//     auto operator[](Index index) -> ChemicalState& { return m_states[index]; }
-
-//     auto set(const ChemicalState& state) -> void;
-
-//     auto temperature(VectorXdRef values) -> void;
-
-//     auto pressure(VectorXdRef values) -> void;
-
-//     auto elementAmounts(VectorXdRef values) -> void;
-
-//     auto output(std::string filename, StringList quantities) -> void;
-
-// private:
-//     /// The number of degrees of freedom in the chemical field.
-//     Index m_size;
-
-// //    VectorXd temperatures;
-// //
-// //    VectorXd pressures;
-// //
-// //    /// The matrix of amounts for every element (
-// //    Matrix element_amounts;
-
-//     /// The chemical system common to all degrees of freedom in the chemical field.
-//     ChemicalSystem m_system;
-
-//     /// The chemical states in the chemical field
-//     std::vector<ChemicalState> m_states;
-
-//     /// The chemical states in the chemical field
-//     std::vector<ChemicalProps> m_props;
-// };
-
-// /// A class that defines a Tridiagonal Matrix used on TransportSolver.
-// /// it stores data in a Eigen::VectorXd like, M = {a[0][0], a[0][1], a[0][2],
-// ///                                                a[1][0], a[1][1], a[1][2],
-// ///                                                a[2][0], a[2][1], a[2][2]}
-// class TridiagonalMatrix
-// {
-// public:
-//     TridiagonalMatrix() : TridiagonalMatrix(0) {}
-
-//     TridiagonalMatrix(Index size) : m_size(size), m_data(size * 3) {}
-
-//     auto size() const -> Index { return m_size; }
-
-//     auto data() -> VectorXdRef { return m_data; }
-
-//     auto data() const -> VectorXdConstRef { return m_data; }
-
-//     auto row(Index index) -> VectorXdRef { return m_data.segment(3 * index, 3); }
-
-//     auto row(Index index) const -> VectorXdConstRef { return m_data.segment(3 * index, 3); }
-
-//     auto a() -> VectorXdStridedRef { return VectorXd::Map(m_data.data() + 3, size() - 1, Eigen::InnerStride<3>()); }
-
-//     auto a() const -> VectorXdConstRef { return VectorXd::Map(m_data.data() + 3, size() - 1, Eigen::InnerStride<3>()); }
-
-//     auto b() -> VectorXdStridedRef { return VectorXd::Map(m_data.data() + 1, size(), Eigen::InnerStride<3>()); }
-
-//     auto b() const -> VectorXdConstRef { return VectorXd::Map(m_data.data() + 1, size(), Eigen::InnerStride<3>()); }
-
-//     auto c() -> VectorXdStridedRef { return VectorXd::Map(m_data.data() + 2, size() - 1, Eigen::InnerStride<3>()); }
-
-//     auto c() const -> VectorXdConstRef { return VectorXd::Map(m_data.data() + 2, size() - 1, Eigen::InnerStride<3>()); }
-
-//     auto resize(Index size) -> void;
-
-//     /// Factorize the tridiagonal matrix to help with linear system A x = b.
-//     auto factorize() -> void;
-
-//     /// Solve a linear system Ax = b with LU decomposition.
-//     auto solve(VectorXdRef x, VectorXdConstRef b) const -> void;
-
-//     /// Solve a linear system Ax = b with LU decomposition, using x as the unknown and it's.
-//     /// old values as the vector b.
-//     auto solve(VectorXdRef x) const -> void;
-
-//     operator MatrixXd() const;
-
-// private:
-//     /// The size of the tridiagonal matrix
-//     Index m_size;
-
-//     /// The coefficients
-//     VectorXd m_data;
-// };
-
-// /// A class that defines the mesh for TransportSolver.
-// class Mesh
-// {
-// public:
-//     Mesh();
-
-//     Mesh(Index num_cells, double xl = 0.0, double xr = 1.0);
-
-//     auto setDiscretization(Index num_cells, double xl = 0.0, double xr = 1.0) -> void;
-
-//     auto numCells() const -> Index { return m_num_cells; }
-
-//     auto xl() const -> double { return m_xl; }
-
-//     auto xr() const -> double { return m_xr; }
-
-//     auto dx() const -> double { return m_dx; }
-
-//     auto xcells() const -> VectorXdConstRef { return m_xcells; }
-
-// private:
-//     /// The number of cells in the discretization.
-//     Index m_num_cells = 10;
-
-//     /// The x-coordinate of the left boundary (in m).
-//     double m_xl = 0.0;
-
-//     /// The x-coordinate of the right boundary (in m).
-//     double m_xr = 1.0;
-
-//     /// The length of the cells (in m).
-//     double m_dx = 0.1;
-
-//     /// The x-coordinate of the center of the cells.
-//     VectorXd m_xcells;
-// };
-
-// /// A class for solving advection-diffusion problem.
-// /// Eq: du/dt + v*du/dx = D*d�u/dx�
-// ///     u - amount
-// ///     v - velocity
-// ///     D - diffusion coefficient
-// class TransportSolver
-// {
-// public:
-//     /// Construct a default TransportSolver instance.
-//     TransportSolver();
-
-//     /// Set the mesh for the numerical solution of the transport problem.
-//     auto setMesh(const Mesh& mesh) -> void { mesh_ = mesh; }
-
-//     /// Set the velocity for the transport problem.
-//     /// @param val The velocity (in m/s)
-//     auto setVelocity(double val) -> void { velocity = val; }
-
-//     /// Set the diffusion coefficient for the transport problem.
-//     /// @param val The diffusion coefficient (in m^2/s)
-//     auto setDiffusionCoeff(double val) -> void { diffusion = val; }
-
-//     /// Set the value of the variable on the boundary.
-//     /// @param val The boundary value for the variable (same unit considered for u).
-//     auto setBoundaryValue(double val) -> void { ul = val; };
-
-//     /// Set the time step for the numerical solution of the transport problem.
-//     auto setTimeStep(double val) -> void { dt = val; }
-
-//     /// Return the mesh.
-//     auto mesh() const -> const Mesh& { return mesh_; }
-
-//     /// Initialize the transport solver before method @ref step is executed.
-//     /// Setup coefficient matrix of the diffusion problem and factorize.
-//     auto initialize() -> void;
-
-//     /// Step the transport solver.
-//     /// This method solve one step of the transport solver equation, using an explicit approach for
-//     /// advection and total implicit for diffusion. The amount resulted from the advection it is
-//     /// passed to diffusion problem as a "source".
-//     /// @param[in,out] u The solution vector
-//     /// @param q The source rates vector ([same unit considered for u]/m)
-//     auto step(VectorXdRef u, VectorXdConstRef q) -> void;
-
-//     /// Step the transport solver.
-//     /// @param[in,out] u The solution vector
-//     auto step(VectorXdRef u) -> void;
-
-// private:
-//     /// The mesh describing the discretization of the domain.
-//     Mesh mesh_;
-
-//     /// The time step used to solve the transport problem (in s).
-//     double dt = 0.0;
-
-//     /// The velocity in the transport problem (in m/s).
-//     double velocity = 0.0;
-
-//     /// The diffusion coefficient in the transport problem (in m^2/s).
-//     double diffusion = 0.0;
-
-//     /// The value of the variable on the left boundary.
-//     double ul;
-
-//     /// The coefficient matrix from the discretized transport equation
-//     TridiagonalMatrix A;
-
-//     /// The flux limiters at each cell.
-//     VectorXd phi;
-
-//     /// The previous state of the variables.
-//     VectorXd u0;
-// };
-
-// /// Use this class for solving reactive transport problems.
-// class ReactiveTransportSolver
-// {
-// public:
-//     /// Construct a default ReactiveTransportSolver instance.
-//     ReactiveTransportSolver(const ChemicalSystem& system);
-
-//     auto setMesh(const Mesh& mesh) -> void;
-
-//     auto setVelocity(double val) -> void;
-
-//     auto setDiffusionCoeff(double val) -> void;
-
-//     auto setBoundaryState(const ChemicalState& state) -> void;
-
-//     auto setTimeStep(double val) -> void;
-
-//     auto system() const -> const ChemicalSystem& { return system_; }
-
-//     auto output() -> ChemicalOutput;
-
-//     auto initialize(const ChemicalField& field) -> void;
-
-//     auto step(ChemicalField& field) -> void;
-
-// private:
-//     /// The chemical system common to all degrees of freedom in the chemical field.
-//     ChemicalSystem system_;
-
-//     /// The solver for solving the transport equations
-//     TransportSolver transportsolver;
-
-//     /// The solver for solving the equilibrium equations
-//     EquilibriumSolver equilibriumsolver;
-
-//     /// The list of chemical output objects
-//     std::vector<ChemicalOutput> outputs;
-
-//     /// The amounts of fluid elements on the boundary.
-//     VectorXd bbc;
-
-//     /// The amounts of a fluid element on each cell of the mesh.
-//     MatrixXd bf;
-
-//     /// The amounts of a solid element on each cell of the mesh.
-//     MatrixXd bs;
-
-//     /// The amounts of an element on each cell of the mesh.
-//     MatrixXd b;
-
-//     /// The current number of steps in the solution of the reactive transport equations.
-//     Index steps = 0;
-// };
-
-// } // namespace Reaktoro
+/// Used to describe the uniform one-dimensional discretization of the domain in a TransportSolver object.
+class Mesh
+{
+public:
+    /// Construct a default Mesh object with 10 cells in the interval [0, 1] (in m).
+    Mesh();
+
+    /// Construct a Mesh object with given number of cells and coordinates of the boundaries (in m).
+    Mesh(Index num_cells, double xl = 0.0, double xr = 1.0);
+
+    /// Set the number of cells and the coordinates of the boundaries (in m).
+    auto setDiscretization(Index num_cells, double xl = 0.0, double xr = 1.0) -> void;
+
+    /// Return the number of cells in the discretization.
+    auto numCells() const -> Index { return m_num_cells; }
+
+    /// Return the x-coordinate of the left boundary (in m).
+    auto xl() const -> double { return m_xl; }
+
+    /// Return the x-coordinate of the right boundary (in m).
+    auto xr() const -> double { return m_xr; }
+
+    /// Return the length of the cells (in m).
+    auto dx() const -> double { return m_dx; }
+
+    /// Return the x-coordinates of the centers of the cells (in m).
+    auto xcells() const -> VectorXdConstRef { return m_xcells; }
+
+private:
+    /// The number of cells in the discretization.
+    Index m_num_cells = 10;
+
+    /// The x-coordinate of the left boundary (in m).
+    double m_xl = 0.0;
+
+    /// The x-coordinate of the right boundary (in m).
+    double m_xr = 1.0;
+
+    /// The length of the cells (in m).
+    double m_dx = 0.1;
+
+    /// The x-coordinates of the centers of the cells.
+    VectorXd m_xcells;
+};
+
+/// Used for solving one-dimensional advection-diffusion problems.
+/// The solved equation is @eq{\partial u/\partial t + v\partial u/\partial x = D\partial^2 u/\partial x^2 + q},
+/// where *u* is the transported quantity, *v* the velocity, *D* the
+/// diffusion coefficient, and *q* a source term. The value of *u* is
+/// prescribed at the left boundary, and its gradient is zero at the right
+/// boundary. Each time step is performed with an explicit, flux-limited
+/// upwind scheme for advection followed by an implicit scheme for
+/// diffusion, whose tridiagonal coefficient matrix is factorized once in
+/// @ref initialize.
+class TransportSolver
+{
+public:
+    /// Construct a default TransportSolver object.
+    TransportSolver();
+
+    /// Set the mesh for the numerical solution of the transport problem.
+    auto setMesh(Mesh const& mesh) -> void { m_mesh = mesh; }
+
+    /// Set the velocity for the transport problem.
+    /// @param val The velocity (in m/s)
+    auto setVelocity(double val) -> void { m_velocity = val; }
+
+    /// Set the diffusion coefficient for the transport problem.
+    /// @param val The diffusion coefficient (in m2/s)
+    auto setDiffusionCoeff(double val) -> void { m_diffusion = val; }
+
+    /// Set the value of the transported quantity on the left boundary.
+    /// @param val The boundary value (in the same unit of the transported quantity)
+    auto setBoundaryValue(double val) -> void { m_ul = val; }
+
+    /// Set the time step for the numerical solution of the transport problem.
+    /// @param val The time step (in s)
+    auto setTimeStep(double val) -> void { m_dt = val; }
+
+    /// Return the mesh of the transport problem.
+    auto mesh() const -> Mesh const& { return m_mesh; }
+
+    /// Return the time step of the transport problem (in s).
+    auto timeStep() const -> double { return m_dt; }
+
+    /// Return the diffusion coefficient of the transport problem (in m2/s).
+    auto diffusionCoeff() const -> double { return m_diffusion; }
+
+    /// Initialize the transport solver before method @ref step is executed.
+    /// This assembles and factorizes the coefficient matrix of the diffusion
+    /// problem, and thus needs to be called again whenever the mesh, the
+    /// diffusion coefficient, or the time step changes.
+    auto initialize() -> void;
+
+    /// Perform a time step of the transport problem with a source term.
+    /// @param[in,out] u The values of the transported quantity on each cell
+    /// @param q The source rates on each cell (in the same unit of the transported quantity per second)
+    auto step(VectorXdRef u, VectorXdConstRef q) -> void;
+
+    /// Perform a time step of the transport problem.
+    /// @param[in,out] u The values of the transported quantity on each cell
+    auto step(VectorXdRef u) -> void;
+
+    /// Perform a time step of the transport problem for many transported quantities at once.
+    /// This produces the same result as calling @ref step for each transported
+    /// quantity, with its own boundary value, but the values of all quantities
+    /// on a cell are interleaved (i.e., adjacent in memory), so that the
+    /// advection scheme and the tridiagonal solves vectorize across them (see
+    /// TridiagonalMatrix::solveBatched). The boundary value set with @ref
+    /// setBoundaryValue is not used.
+    /// @param[in,out] U The values of the transported quantities, with one row per quantity and one column per cell
+    /// @param ul The values of the transported quantities on the left boundary
+    auto stepBatched(MatrixXdRef U, VectorXdConstRef ul) -> void;
+
+    /// Perform the explicit part of a time step of @ref stepBatched on a range of cells.
+    /// The explicit part of a time step is the advection of the transported
+    /// quantities and the contribution of their boundary values to the
+    /// diffusion problem. It is the complete time step when the diffusion
+    /// coefficient is zero. Since the new values on a cell only depend on the
+    /// values on its neighbour cells at the beginning of the time step, the
+    /// cells can be advanced in independent ranges (e.g., concurrently with
+    /// other calculations on the cells of other ranges). This method does not
+    /// change the state of this object and can be called from many threads
+    /// on disjoint ranges of cells.
+    /// @param[in,out] U The values of the transported quantities, with one row per quantity and one column per cell (only the columns in the range are changed)
+    /// @param U0 The values of the transported quantities at the beginning of the time step (equal to `U` on input in the range of cells)
+    /// @param ul The values of the transported quantities on the left boundary
+    /// @param ibegin The index of the first cell in the range
+    /// @param iend The index after the last cell in the range
+    auto advectBatched(MatrixXdRef U, MatrixXdConstRef U0, VectorXdConstRef ul, Index ibegin, Index iend) const -> void;
+
+private:
+    /// The mesh describing the discretization of the domain.
+    Mesh m_mesh;
+
+    /// The time step used to solve the transport problem (in s).
+    double m_dt = 0.0;
+
+    /// The velocity in the transport problem (in m/s).
+    double m_velocity = 0.0;
+
+    /// The diffusion coefficient in the transport problem (in m2/s).
+    double m_diffusion = 0.0;
+
+    /// The value of the transported quantity on the left boundary.
+    double m_ul = 0.0;
+
+    /// The coefficient matrix of the discretized diffusion problem in factorized form.
+    TridiagonalMatrix m_A;
+
+    /// The flux limiters at each cell.
+    VectorXd m_phi;
+
+    /// The values of the transported quantity at the beginning of the time step.
+    VectorXd m_u0;
+
+    /// The values of the transported quantities (rows) at each cell (columns) at the beginning of the time step in @ref stepBatched.
+    MatrixXd m_u0_batch;
+};
+
+/// Used for solving one-dimensional reactive transport problems with chemical equilibrium.
+/// Each time step is performed with a sequential operator splitting
+/// approach. First, the amounts of the conservative components (i.e., the
+/// chemical elements and electric charge) in the fluid species of each
+/// cell are transported with a TransportSolver object, while those in
+/// the solid species remain immobile. Then, the chemical state of each
+/// cell is equilibrated with its new amounts of components. The amounts
+/// of all components on each cell are kept contiguously in memory, so that
+/// all components are transported at once with vectorized sweeps over the
+/// cells (see TransportSolver::stepBatched). The chemical
+/// equilibrium calculations are distributed among a pool of worker
+/// threads (see EquilibriumOptions::threads), each with its own
+/// EquilibriumSolver object, or SmartEquilibriumSolver object if the
+/// options of the smart equilibrium solver are set with @ref setOptions.
+/// The smart equilibrium solvers of the workers share their learned data.
+/// The initial guess of the calculation in each cell is either its own
+/// chemical state or the equilibrium state just computed in the previous
+/// cell (see EquilibriumOptions::warm_start).
+/// In distributed-memory computations (see @ref setCommunicator), the
+/// transport step is performed redundantly by every process, since it is
+/// much cheaper than the chemical equilibrium calculations, which are
+/// distributed among the processes by partitioning the cells into
+/// contiguous ranges (see DomainDecomposition). After each time step, the
+/// species amounts of the cells are gathered in every process, and the
+/// cells are partitioned again according to the measured computing costs
+/// of their chemical equilibrium calculations, so that the processes with
+/// cells near reaction fronts own fewer cells.
+/// With pipelining (see @ref setPipelineBlocks), the cells owned by the
+/// current process are split into contiguous blocks, and the chemical
+/// equilibrium calculations of block *k* are performed by the worker threads
+/// while one of them transports block *k + 1* and another one calls the
+/// output function of block *k - 1* (see @ref setOutput), instead of
+/// transporting all cells, then equilibrating all cells, and then writing
+/// the output of all cells. Without diffusion, the transport step is fully
+/// explicit, and each block is transported on its own from the amounts of
+/// the components at the beginning of the time step (see
+/// TransportSolver::advectBatched). With diffusion, the implicit diffusion
+/// problem couples all cells, so that the transport step of the sequential
+/// non-iterative scheme is performed for all cells before the pipeline, in
+/// which the chemical equilibrium calculations then overlap with the output.
+/// In both cases, the results are the same as without pipelining.
+class ReactiveTransportSolver
+{
+public:
+    /// The function type for the output of the chemical states of a range of cells after their chemical equilibrium calculations in a time step.
+    /// @param ibegin The index of the first cell in the range
+    /// @param iend The index after the last cell in the range
+    using OutputFn = Fn<void(Index ibegin, Index iend)>;
+
+    /// Construct a ReactiveTransportSolver object with given chemical system.
+    explicit ReactiveTransportSolver(ChemicalSystem const& system);
+
+    /// Construct a copy of a ReactiveTransportSolver object.
+    ReactiveTransportSolver(ReactiveTransportSolver const& other);
+
+    /// Destroy this ReactiveTransportSolver object.
+    ~ReactiveTransportSolver();
+
+    /// Assign a copy of a ReactiveTransportSolver object to this.
+    auto operator=(ReactiveTransportSolver other) -> ReactiveTransportSolver&;
+
+    /// Set the mesh for the numerical solution of the transport problem.
+    auto setMesh(Mesh const& mesh) -> void;
+
+    /// Set the velocity of the fluid (in m/s).
+    auto setVelocity(double val) -> void;
+
+    /// Set the diffusion coefficient of the fluid species (in m2/s).
+    auto setDiffusionCoeff(double val) -> void;
+
+    /// Set the chemical state of the fluid injected at the left boundary.
+    /// Only the amounts of the components in the fluid species of this state are used.
+    auto setBoundaryState(ChemicalState const& state) -> void;
+
+    /// Set the time step for the numerical solution of the reactive transport problem (in s).
+    auto setTimeStep(double val) -> void;
+
+    /// Set the options of the conventional chemical equilibrium calculations in each cell.
+    auto setOptions(EquilibriumOptions const& options) -> void;
+
+    /// Set the options of the smart chemical equilibrium calculations in each cell.
+    /// After this call, the chemical equilibrium calculations are performed with SmartEquilibriumSolver objects.
+    /// @note This discards the learned data of previous smart equilibrium calculations.
+    auto setOptions(SmartEquilibriumOptions const& options) -> void;
+
+    /// Set the relative tolerance on the changes in the inputs of a cell below which its chemical equilibrium calculation is skipped.
+    /// The inputs of a cell are its temperature, pressure, and amounts of
+    /// components. If none of them changed by more than `reltol` relative to
+    /// their values in the last chemical equilibrium calculation of the cell,
+    /// its chemical state is kept unchanged in the time step. Otherwise, the
+    /// cells with identical inputs are equilibrated only once, and the
+    /// resulting chemical state is copied to the others. With `reltol = 0`,
+    /// only cells with exactly the same inputs are skipped or deduplicated,
+    /// and the results are unchanged. With `reltol > 0`, the amounts of the
+    /// components in a skipped cell are those of its last calculation, and
+    /// thus can deviate by up to `reltol` relative from the transported ones.
+    /// Since the comparison is always against the last calculation, this
+    /// deviation does not accumulate over the time steps. A negative value
+    /// (the default) disables both skipping and deduplication.
+    auto setInputTolerance(double reltol) -> void;
+
+    /// Set the convergence tolerances of the chemical equilibrium calculations in the cells.
+    /// Each cell is then equilibrated only as accurately as its tolerance
+    /// requires (see EquilibriumConditions::setTolerance), e.g., loosely in
+    /// quiet regions and tightly near reaction fronts, with tolerances derived
+    /// by the caller from an estimate of the splitting error of the time step.
+    /// A tolerance of zero in a cell, or an empty array (the default), uses
+    /// the tolerance in the options of the equilibrium solvers.
+    /// @param tolerances The convergence tolerance of each cell in the mesh, or an empty array
+    auto setEquilibriumTolerances(ArrayXdConstRef tolerances) -> void;
+
+    /// Set the number of blocks of cells whose transport, chemical equilibrium calculations, and output are pipelined in each time step.
+    /// The cells owned by the current process are split into this many
+    /// contiguous blocks of approximately the same number of cells. The
+    /// skipping and deduplication of chemical equilibrium calculations (see
+    /// @ref setInputTolerance) is then performed within each block, since the
+    /// inputs of the next blocks are still being transported. A value of zero
+    /// or one (the default) disables pipelining.
+    auto setPipelineBlocks(Index num_blocks) -> void;
+
+    /// Set the function called with each range of cells owned by the current process after their chemical equilibrium calculations in a time step.
+    /// Without pipelining, this is called once per time step with all owned
+    /// cells, before the species amounts are exchanged with the other
+    /// processes. With pipelining (see @ref setPipelineBlocks), it is called
+    /// once per block, from a worker thread, while the chemical equilibrium
+    /// calculations of the next block are performed by the other worker
+    /// threads. It must then only access the chemical states of the cells in
+    /// the given range (e.g., to write their properties to a file).
+    auto setOutput(OutputFn const& fn) -> void;
+
+    /// Set the communication among the processes sharing the chemical equilibrium calculations of the cells.
+    /// Each process owns a range of cells, for which it performs the chemical
+    /// equilibrium calculations. The chemical states of the cells owned by
+    /// other processes are updated only with the species amounts computed by
+    /// them, and the properties stored in a ChemicalField object are only
+    /// updated for the owned cells. This needs to be called before @ref initialize.
+    auto setCommunicator(Communicator const& comm) -> void;
+
+    /// Return the chemical system of the reactive transport problem.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Return the amounts of the conservative components in the fluid species of each cell (one column per cell) after the last transport step.
+    auto componentAmountsInFluid() const -> MatrixXdConstRef;
+
+    /// Return the amounts of the conservative components in the solid species of each cell (one column per cell) after the last transport step.
+    auto componentAmountsInSolid() const -> MatrixXdConstRef;
+
+    /// Return the current partition of the cells among the processes.
+    auto decomposition() const -> DomainDecomposition const&;
+
+    /// Return the computing time of the last chemical equilibrium calculation in each cell (in s).
+    /// In distributed-memory computations, these are gathered from all processes after each time step.
+    auto cellCosts() const -> ArrayXdConstRef;
+
+    /// Return the number of time steps performed so far.
+    auto steps() const -> Index;
+
+    /// Initialize the reactive transport solver before method @ref step is executed.
+    /// This needs to be called again whenever the mesh, the diffusion
+    /// coefficient, or the time step changes.
+    auto initialize() -> void;
+
+    /// Perform a time step of the reactive transport problem.
+    /// @param[in,out] states The chemical states of the cells in the mesh
+    auto step(Vec<ChemicalState>& states) -> void;
+
+    /// Perform a time step of the reactive transport problem with the chemical states of the cells stored in a ChemicalField object.
+    /// The chemical state of each cell is materialized into a ChemicalState
+    /// object reused by each worker thread, which is then equilibrated and
+    /// stored back in the field (see ChemicalField::get and ChemicalField::set).
+    /// @param[in,out] field The chemical states of the cells in the mesh
+    auto step(ChemicalField& field) -> void;
+
+    /// Share the learned data of the smart chemical equilibrium calculations among all processes.
+    /// The learned data of each process is gathered in all processes, and
+    /// merged into their own (see SmartEquilibriumSolver::mergeLearningData),
+    /// so that a chemical state learned in one process can be predicted in
+    /// others. This is a collective operation that needs to be called by all
+    /// processes, and only when smart equilibrium calculations are used.
+    auto shareLearningDataAmongRanks() -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
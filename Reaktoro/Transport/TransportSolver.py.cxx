@@ -0,0 +1,117 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+#include <Reaktoro/Transport/DomainDecomposition.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+void exportTransportSolver(py::module& m)
+{
+    py::class_<TridiagonalMatrix>(m, "TridiagonalMatrix")
+        .def(py::init<>())
+        .def(py::init<Index>())
+        .def("size", &TridiagonalMatrix::size)
+        .def("data", py::overload_cast<>(&TridiagonalMatrix::data), return_internal_ref)
+        .def("row", py::overload_cast<Index>(&TridiagonalMatrix::row), return_internal_ref)
+        .def("a", py::overload_cast<>(&TridiagonalMatrix::a), return_internal_ref)
+        .def("b", py::overload_cast<>(&TridiagonalMatrix::b), return_internal_ref)
+        .def("c", py::overload_cast<>(&TridiagonalMatrix::c), return_internal_ref)
+        .def("resize", &TridiagonalMatrix::resize)
+        .def("factorize", &TridiagonalMatrix::factorize)
+        .def("solve", py::overload_cast<VectorXdRef, VectorXdConstRef>(&TridiagonalMatrix::solve, py::const_))
+        .def("solve", py::overload_cast<VectorXdRef>(&TridiagonalMatrix::solve, py::const_))
+        .def("solveBatched", &TridiagonalMatrix::solveBatched)
+        .def("matrix", [](TridiagonalMatrix const& self) { return MatrixXd(self); })
+        ;
+
+    py::class_<Mesh>(m, "Mesh")
+        .def(py::init<>())
+        .def(py::init<Index, double, double>(), py::arg("num_cells"), py::arg("xl") = 0.0, py::arg("xr") = 1.0)
+        .def("setDiscretization", &Mesh::setDiscretization, py::arg("num_cells"), py::arg("xl") = 0.0, py::arg("xr") = 1.0)
+        .def("numCells", &Mesh::numCells)
+        .def("xl", &Mesh::xl)
+        .def("xr", &Mesh::xr)
+        .def("dx", &Mesh::dx)
+        .def("xcells", &Mesh::xcells, return_internal_ref)
+        ;
+
+    py::class_<TransportSolver>(m, "TransportSolver")
+        .def(py::init<>())
+        .def("setMesh", &TransportSolver::setMesh)
+        .def("setVelocity", &TransportSolver::setVelocity)
+        .def("setDiffusionCoeff", &TransportSolver::setDiffusionCoeff)
+        .def("setBoundaryValue", &TransportSolver::setBoundaryValue)
+        .def("setTimeStep", &TransportSolver::setTimeStep)
+        .def("mesh", &TransportSolver::mesh, return_internal_ref)
+        .def("timeStep", &TransportSolver::timeStep)
+        .def("initialize", &TransportSolver::initialize)
+        .def("step", py::overload_cast<VectorXdRef, VectorXdConstRef>(&TransportSolver::step))
+        .def("step", py::overload_cast<VectorXdRef>(&TransportSolver::step))
+        .def("stepBatched", &TransportSolver::stepBatched)
+        .def("advectBatched", &TransportSolver::advectBatched)
+        .def("diffusionCoeff", &TransportSolver::diffusionCoeff)
+        ;
+
+    auto step = [](ReactiveTransportSolver& self, py::list states)
+    {
+        Vec<ChemicalState> aux;
+        aux.reserve(states.size());
+        for(auto const& state : states)
+            aux.push_back(state.cast<ChemicalState const&>());
+        {
+            py::gil_scoped_release release; // the output function may be called from worker threads
+            self.step(aux);
+        }
+        for(auto i = 0; i < aux.size(); ++i)
+            states[i].cast<ChemicalState&>() = aux[i];
+    };
+
+    py::class_<ReactiveTransportSolver>(m, "ReactiveTransportSolver")
+        .def(py::init<ChemicalSystem const&>())
+        .def("setMesh", &ReactiveTransportSolver::setMesh)
+        .def("setVelocity", &ReactiveTransportSolver::setVelocity)
+        .def("setDiffusionCoeff", &ReactiveTransportSolver::setDiffusionCoeff)
+        .def("setBoundaryState", &ReactiveTransportSolver::setBoundaryState)
+        .def("setTimeStep", &ReactiveTransportSolver::setTimeStep)
+        .def("setOptions", py::overload_cast<EquilibriumOptions const&>(&ReactiveTransportSolver::setOptions))
+        .def("setOptions", py::overload_cast<SmartEquilibriumOptions const&>(&ReactiveTransportSolver::setOptions))
+        .def("setInputTolerance", &ReactiveTransportSolver::setInputTolerance)
+        .def("setEquilibriumTolerances", &ReactiveTransportSolver::setEquilibriumTolerances)
+        .def("setPipelineBlocks", &ReactiveTransportSolver::setPipelineBlocks)
+        .def("setOutput", &ReactiveTransportSolver::setOutput)
+        .def("setCommunicator", &ReactiveTransportSolver::setCommunicator)
+        .def("system", &ReactiveTransportSolver::system, return_internal_ref)
+        .def("componentAmountsInFluid", &ReactiveTransportSolver::componentAmountsInFluid, return_internal_ref)
+        .def("componentAmountsInSolid", &ReactiveTransportSolver::componentAmountsInSolid, return_internal_ref)
+        .def("decomposition", &ReactiveTransportSolver::decomposition, return_internal_ref)
+        .def("cellCosts", &ReactiveTransportSolver::cellCosts, return_internal_ref)
+        .def("steps", &ReactiveTransportSolver::steps)
+        .def("initialize", &ReactiveTransportSolver::initialize)
+        .def("step", step, "Perform a time step of the reactive transport problem.", py::arg("states"))
+        .def("step", py::overload_cast<ChemicalField&>(&ReactiveTransportSolver::step), py::call_guard<py::gil_scoped_release>())
+        .def("shareLearningDataAmongRanks", &ReactiveTransportSolver::shareLearningDataAmongRanks)
+        ;
+}
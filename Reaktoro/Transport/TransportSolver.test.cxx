@@ -0,0 +1,461 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <algorithm>
+#include <mutex>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
+#include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDavies.hpp>
+#include <Reaktoro/Transport/ChemicalField.hpp>
+#include <Reaktoro/Transport/DomainDecomposition.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing TridiagonalMatrix", "[TransportSolver]")
+{
+    const auto n = 6;
+
+    TridiagonalMatrix A(n);
+
+    for(auto i = 0; i < n; ++i)
+        A.row(i) << -1.0 - 0.1*i, 4.0 + 0.2*i, -2.0 + 0.1*i;
+
+    const MatrixXd Adense = A;
+
+    CHECK( Adense(0, 0) == 4.0 );
+    CHECK( Adense(0, 1) == -2.0 );
+    CHECK( Adense(n - 1, n - 2) == Approx(-1.0 - 0.1*(n - 1)) );
+    CHECK( Adense.diagonal().isApprox(A.b()) );
+    CHECK( Adense.diagonal(1).isApprox(A.c()) );
+    CHECK( Adense.diagonal(-1).isApprox(A.a()) );
+
+    const VectorXd d = linspace(1.0, 2.0, n);
+
+    A.factorize();
+
+    VectorXd x(n);
+    A.solve(x, d);
+
+    CHECK( (Adense * x).isApprox(d) );
+
+    x = d;
+    A.solve(x); // x is used as both d and the solution
+
+    CHECK( (Adense * x).isApprox(d) );
+
+    MatrixXd D(5, n); // five right-hand sides interleaved, one per row
+    for(auto j = 0; j < D.rows(); ++j)
+        D.row(j) = (j + 1.0) * d.transpose() + linspace(0.0, 0.1*j, n).transpose();
+
+    MatrixXd X = D;
+    A.solveBatched(X);
+
+    CHECK( (Adense * X.transpose()).isApprox(D.transpose()) );
+
+    for(auto j = 0; j < D.rows(); ++j)
+    {
+        x = D.row(j).transpose();
+        A.solve(x);
+        CHECK( X.row(j).transpose().isApprox(x, 1e-14) ); // the same operations are performed in both solve methods
+    }
+
+    MatrixXd Xwrong(3, n + 1);
+    CHECK_THROWS( A.solveBatched(Xwrong) );
+}
+
+TEST_CASE("Testing TransportSolver", "[TransportSolver]")
+{
+    Mesh mesh(20, 0.0, 1.0);
+
+    CHECK( mesh.dx() == Approx(0.05) );
+    CHECK( mesh.xcells()[0] == Approx(0.025) );
+    CHECK( mesh.xcells()[19] == Approx(0.975) );
+
+    CHECK_THROWS( Mesh(10, 1.0, 0.0) );
+
+    TransportSolver transport;
+    transport.setMesh(mesh);
+    transport.setVelocity(1.0e-5);
+    transport.setDiffusionCoeff(1.0e-9);
+    transport.setBoundaryValue(1.0);
+    transport.setTimeStep(2500.0); // Courant number v*dt/dx = 0.5
+    transport.initialize();
+
+    VectorXd u = zeros(mesh.numCells());
+
+    SECTION("When the injected quantity advances through the domain")
+    {
+        for(auto i = 0; i < 10; ++i)
+            transport.step(u);
+
+        CHECK( u.minCoeff() >= -1e-12 ); // no undershoots
+        CHECK( u.maxCoeff() <= 1.0 + 1e-12 ); // no overshoots
+        CHECK( u[0] == Approx(1.0).epsilon(1e-3) );
+        CHECK( u[19] == Approx(0.0).margin(1e-3) ); // the front has not reached the end of the domain
+
+        for(auto i = 1; i < mesh.numCells(); ++i)
+            CHECK( u[i] <= u[i - 1] + 1e-12 ); // the values decrease towards the front
+    }
+
+    SECTION("When the injected quantity fills the domain")
+    {
+        for(auto i = 0; i < 200; ++i)
+            transport.step(u);
+
+        CHECK( u.isApprox(VectorXd::Ones(mesh.numCells()), 1e-6) );
+    }
+
+    SECTION("When many quantities are transported at once")
+    {
+        VectorXd ul(3);
+        ul << 1.0, 0.5, 2.0;
+
+        MatrixXd U = zeros(ul.size(), mesh.numCells());
+        U.row(1).fill(0.5); // a uniform field equal to its boundary value
+        U.row(2) = linspace(0.0, 1.0, mesh.numCells());
+
+        MatrixXd Useparate = U;
+
+        for(auto i = 0; i < 10; ++i)
+        {
+            transport.stepBatched(U, ul);
+
+            for(auto j = 0; j < ul.size(); ++j)
+            {
+                VectorXd uj = Useparate.row(j).transpose();
+                transport.setBoundaryValue(ul[j]);
+                transport.step(uj);
+                Useparate.row(j) = uj.transpose();
+            }
+        }
+
+        CHECK( U.isApprox(Useparate, 1e-14) ); // the same operations are performed in both step methods
+        CHECK( U.row(1).isApprox(VectorXd::Constant(mesh.numCells(), 0.5).transpose()) );
+
+        CHECK_THROWS( transport.stepBatched(U, VectorXd::Ones(2)) );
+    }
+
+    SECTION("When the cells are advanced explicitly in independent ranges")
+    {
+        transport.setDiffusionCoeff(0.0);
+        transport.initialize();
+
+        VectorXd ul(2);
+        ul << 1.0, 2.0;
+
+        MatrixXd U = zeros(ul.size(), mesh.numCells());
+        U.row(1) = linspace(0.0, 1.0, mesh.numCells());
+
+        MatrixXd Uranges = U;
+
+        for(auto i = 0; i < 10; ++i)
+        {
+            transport.stepBatched(U, ul);
+
+            const MatrixXd U0 = Uranges;
+            transport.advectBatched(Uranges, U0, ul, 0, 7);
+            transport.advectBatched(Uranges, U0, ul, 7, 8);
+            transport.advectBatched(Uranges, U0, ul, 8, mesh.numCells());
+        }
+
+        CHECK( Uranges.isApprox(U, 1e-14) ); // without diffusion, the explicit part is the complete time step
+
+        CHECK_THROWS( transport.advectBatched(Uranges, U, ul, 8, 7) );
+        CHECK_THROWS( transport.advectBatched(Uranges, U, ul, 0, mesh.numCells() + 1) );
+    }
+
+    SECTION("When the Courant number is larger than one")
+    {
+        transport.setTimeStep(10000.0);
+        transport.initialize();
+        CHECK_THROWS( transport.step(u) );
+    }
+}
+
+TEST_CASE("Testing ReactiveTransportSolver", "[TransportSolver]")
+{
+    SupcrtDatabase db("supcrtbl");
+
+    ChemicalSystem system(db,
+        AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)").setActivityModel(ActivityModelDavies()),
+        MineralPhase("Calcite")
+    );
+
+    EquilibriumSolver solver(system);
+
+    ChemicalState initial(system);
+    initial.temperature(60.0, "celsius");
+    initial.pressure(100.0, "bar");
+    initial.set("H2O(aq)", 1.0, "kg");
+    initial.set("Calcite", 0.1, "mol");
+    REQUIRE( solver.solve(initial).succeeded() );
+
+    ChemicalState injected(system);
+    injected.temperature(60.0, "celsius");
+    injected.pressure(100.0, "bar");
+    injected.set("H2O(aq)", 1.0, "kg");
+    injected.set("CO2(aq)", 0.5, "mol");
+    REQUIRE( solver.solve(injected).succeeded() );
+
+    Mesh mesh(10, 0.0, 1.0);
+
+    ReactiveTransportSolver rtsolver(system);
+    rtsolver.setMesh(mesh);
+    rtsolver.setVelocity(1.0e-5);
+    rtsolver.setDiffusionCoeff(0.0);
+    rtsolver.setBoundaryState(injected);
+    rtsolver.setTimeStep(5000.0); // Courant number v*dt/dx = 0.5
+
+    const auto calcite0 = initial.speciesAmount("Calcite");
+
+    auto check = [&](Vec<ChemicalState> const& states)
+    {
+        CHECK( rtsolver.steps() == 4 );
+        CHECK( states[0].speciesAmount("Calcite") < calcite0 ); // calcite dissolves where the CO2-rich water is injected
+        CHECK( states[9].speciesAmount("Calcite") == Approx(calcite0) ); // the injected water has not reached the end of the domain
+        CHECK( rtsolver.componentAmountsInFluid().cols() == mesh.numCells() );
+        CHECK( rtsolver.componentAmountsInSolid().rows() == system.elements().size() + 1 );
+        CHECK( rtsolver.decomposition().numRanks() == 1 );
+        CHECK( rtsolver.decomposition().numCells() == mesh.numCells() );
+        CHECK( rtsolver.cellCosts().size() == mesh.numCells() );
+        CHECK( (rtsolver.cellCosts() > 0.0).all() );
+    };
+
+    SECTION("When conventional equilibrium calculations are used")
+    {
+        EquilibriumOptions options;
+        options.threads = 2;
+        rtsolver.setOptions(options);
+        rtsolver.initialize();
+
+        Vec<ChemicalState> states(mesh.numCells(), initial);
+
+        for(auto i = 0; i < 4; ++i)
+            rtsolver.step(states);
+
+        check(states);
+
+        Vec<ChemicalState> fewer(3, initial);
+        CHECK_THROWS( rtsolver.step(fewer) );
+
+        CHECK_THROWS( rtsolver.shareLearningDataAmongRanks() );
+
+        Communicator comm;
+        comm.rank = 2;
+        comm.size = 2;
+        CHECK_THROWS( rtsolver.setCommunicator(comm) );
+    }
+
+    SECTION("When smart equilibrium calculations are used")
+    {
+        SmartEquilibriumOptions options;
+        options.learning.threads = 2;
+        rtsolver.setOptions(options);
+        rtsolver.initialize();
+
+        Vec<ChemicalState> states(mesh.numCells(), initial);
+
+        for(auto i = 0; i < 4; ++i)
+            rtsolver.step(states);
+
+        check(states);
+
+        CHECK_NOTHROW( rtsolver.shareLearningDataAmongRanks() );
+    }
+
+    SECTION("When the chemical states of the cells are stored in a ChemicalField object")
+    {
+        EquilibriumOptions options;
+        options.threads = 2;
+        rtsolver.setOptions(options);
+        rtsolver.initialize();
+
+        Vec<ChemicalState> states(mesh.numCells(), initial);
+
+        ChemicalField field(initial, mesh.numCells());
+
+        for(auto i = 0; i < 4; ++i)
+        {
+            rtsolver.step(states);
+            rtsolver.step(field);
+        }
+
+        for(auto i = 0; i < mesh.numCells(); ++i)
+            CHECK( field.state(i).speciesAmount("Calcite") == Approx(states[i].speciesAmount("Calcite")) );
+
+        ChemicalField fewer(initial, 3);
+        CHECK_THROWS( rtsolver.step(fewer) );
+    }
+
+    SECTION("When the chemical equilibrium calculations of unchanged or identical cells are skipped")
+    {
+        EquilibriumOptions options;
+        options.threads = 2;
+        rtsolver.setOptions(options);
+        rtsolver.initialize();
+
+        Vec<ChemicalState> expected(mesh.numCells(), initial);
+
+        for(auto i = 0; i < 4; ++i)
+            rtsolver.step(expected);
+
+        ReactiveTransportSolver skipsolver(rtsolver);
+        skipsolver.setInputTolerance(0.0);
+        skipsolver.initialize();
+
+        ReactiveTransportSolver fieldsolver(skipsolver);
+
+        Vec<ChemicalState> states(mesh.numCells(), initial);
+        ChemicalField field(initial, mesh.numCells());
+
+        for(auto i = 0; i < 4; ++i)
+        {
+            skipsolver.step(states);
+            fieldsolver.step(field);
+        }
+
+        for(auto i = 0; i < mesh.numCells(); ++i)
+        {
+            CHECK( states[i].speciesAmount("Calcite") == Approx(expected[i].speciesAmount("Calcite")) );
+            CHECK( field.state(i).speciesAmount("Calcite") == Approx(expected[i].speciesAmount("Calcite")) );
+        }
+
+        // With a large tolerance, every cell is skipped after its first calculation
+        const auto previous = states;
+
+        skipsolver.setInputTolerance(1.0e+10);
+        skipsolver.step(states);
+
+        CHECK( (skipsolver.cellCosts() == 0.0).all() );
+
+        for(auto i = 0; i < mesh.numCells(); ++i)
+            CHECK( states[i].speciesAmount("Calcite") == previous[i].speciesAmount("Calcite") );
+    }
+
+    SECTION("When the chemical equilibrium calculations are warm-started from the previous cell")
+    {
+        EquilibriumOptions options;
+        options.threads = 2;
+        rtsolver.setOptions(options);
+        rtsolver.initialize();
+
+        Vec<ChemicalState> expected(mesh.numCells(), initial);
+
+        for(auto i = 0; i < 4; ++i)
+            rtsolver.step(expected);
+
+        for(auto warmstart : { EquilibriumWarmStart::Neighbour, EquilibriumWarmStart::Predicted })
+        {
+            options.warm_start = warmstart;
+
+            ReactiveTransportSolver warmsolver(rtsolver);
+            warmsolver.setOptions(options);
+            warmsolver.initialize();
+
+            Vec<ChemicalState> states(mesh.numCells(), initial);
+            ChemicalField field(initial, mesh.numCells());
+
+            for(auto i = 0; i < 4; ++i)
+                warmsolver.step(states);
+
+            ReactiveTransportSolver fieldsolver(warmsolver);
+            fieldsolver.initialize();
+
+            for(auto i = 0; i < 4; ++i)
+                fieldsolver.step(field);
+
+            for(auto i = 0; i < mesh.numCells(); ++i)
+            {
+                CHECK( states[i].speciesAmount("Calcite") == Approx(expected[i].speciesAmount("Calcite")) );
+                CHECK( field.state(i).speciesAmount("Calcite") == Approx(expected[i].speciesAmount("Calcite")) );
+            }
+        }
+    }
+
+    SECTION("When the transport, chemical equilibrium calculations, and output are pipelined in blocks")
+    {
+        EquilibriumOptions options;
+        options.threads = 3;
+
+        for(auto diffusion : { 0.0, 1.0e-9 })
+        {
+            rtsolver.setDiffusionCoeff(diffusion);
+            rtsolver.setOptions(options);
+            rtsolver.setPipelineBlocks(0);
+            rtsolver.initialize();
+
+            Vec<ChemicalState> expected(mesh.numCells(), initial);
+
+            for(auto i = 0; i < 4; ++i)
+                rtsolver.step(expected);
+
+            const MatrixXd bf = rtsolver.componentAmountsInFluid();
+
+            ReactiveTransportSolver pipesolver(rtsolver);
+            pipesolver.setPipelineBlocks(4);
+            pipesolver.initialize();
+
+            Vec<ChemicalState> states(mesh.numCells(), initial);
+            ChemicalField field(initial, mesh.numCells());
+
+            std::mutex mutex;
+            Vec<Pair<Index, Index>> ranges;
+
+            pipesolver.setOutput([&](Index ibegin, Index iend)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ranges.emplace_back(ibegin, iend);
+            });
+
+            for(auto i = 0; i < 4; ++i)
+                pipesolver.step(states);
+
+            CHECK( pipesolver.componentAmountsInFluid().isApprox(bf) );
+
+            // The output function is called once per block and time step, and the blocks cover all cells
+            REQUIRE( ranges.size() == 4 * 4 );
+            std::sort(ranges.begin(), ranges.end());
+            CHECK( ranges.front().first == 0 );
+            CHECK( ranges.back().second == mesh.numCells() );
+            for(auto i = 1; i < ranges.size(); ++i)
+                CHECK( (ranges[i] == ranges[i - 1] || ranges[i].first == ranges[i - 1].second) );
+
+            pipesolver.setOutput({});
+            pipesolver.initialize();
+
+            for(auto i = 0; i < 4; ++i)
+                pipesolver.step(field);
+
+            for(auto i = 0; i < mesh.numCells(); ++i)
+            {
+                CHECK( states[i].speciesAmount("Calcite") == Approx(expected[i].speciesAmount("Calcite")) );
+                CHECK( field.state(i).speciesAmount("Calcite") == Approx(expected[i].speciesAmount("Calcite")) );
+            }
+        }
+    }
+}
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <Reaktoro/Utils/AqueousProps.hpp>
+#include <Reaktoro/Utils/ChemicalPropsExtractor.hpp>
 #include <Reaktoro/Utils/IonExchangeProps.hpp>
 #include <Reaktoro/Utils/Material.hpp>
 #include <Reaktoro/Utils/MineralReaction.hpp>
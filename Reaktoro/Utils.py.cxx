@@ -19,6 +19,7 @@
 #include <Reaktoro/pybind11.hxx>
 
 void exportAqueousProps(py::module& m);
+void exportChemicalPropsExtractor(py::module& m);
 void exportIonExchangeProps(py::module& m);
 void exportMaterial(py::module& m);
 void exportMineralReaction(py::module& m);
@@ -28,6 +29,7 @@ void exportMineralSurface(py::module& m);
 void exportUtils(py::module& m)
 {
     exportAqueousProps(m);
+    exportChemicalPropsExtractor(m);
     exportIonExchangeProps(m);
     exportMaterial(m);
     exportMineralReaction(m);
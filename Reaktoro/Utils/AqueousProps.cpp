@@ -61,11 +61,37 @@ auto indexAqueousPhase(ChemicalSystem const& system) -> Index
     return idx;
 }
 
-// Return a chemical potential function for a non-aqueous species using a given
-// activity model. Note: this method is relevant for computation of saturation indices.
-auto chemicalPotentialModel(Species const& species, ActivityModelGenerator const& generator) -> Fn<real(ChemicalProps const&)>
+/// Return the echelon form of the given formula matrix, reusing the one computed last for an equal matrix in the calling thread.
+/// AqueousProps objects are frequently created for the same chemical system (e.g., once per cell or per output step), and this
+/// avoids echelonizing the same formula matrix of the aqueous species every time.
+auto echelonizerFor(MatrixXd const& A) -> Optima::Echelonizer
 {
-    const auto activitymodel = generator({species}); // TODO: Use .withMemoization() here to avoid full recomputations when same T and P are given.
+    thread_local Pairs<MatrixXd, Optima::Echelonizer> cache;
+
+    for(auto const& [Ai, echelonizer] : cache)
+        if(Ai.rows() == A.rows() && Ai.cols() == A.cols() && Ai == A)
+            return echelonizer;
+
+    const std::size_t maxsize = 8; // the number of distinct formula matrices kept per thread
+
+    if(cache.size() == maxsize)
+        cache.erase(cache.begin());
+
+    Optima::Echelonizer echelonizer;
+    echelonizer.compute(A);
+    cache.emplace_back(A, echelonizer);
+
+    return echelonizer;
+}
+
+// Return a function that computes the term `RT*ln(a)` in the chemical potential
+// of a non-aqueous species using a given activity model. The standard Gibbs
+// energy `G0` of the species is added by AqueousProps::Impl, which caches it
+// per temperature and pressure. Note: this method is relevant for computation
+// of saturation indices.
+auto activityTermModel(Species const& species, ActivityModelGenerator const& generator) -> Fn<real(ChemicalProps const&)>
+{
+    const auto activitymodel = generator({species}).withMemoization(); // the mole fraction is always 1, so only changes in T and P trigger a recomputation
     const auto R = universalGasConstant;
     const auto x = ArrayXr{{1.0}}; // the mole fraction of the single species in a pure phase
     auto actprops = ActivityProps::create(1);
@@ -75,18 +101,18 @@ auto chemicalPotentialModel(Species const& species, ActivityModelGenerator const
         const auto T = props.temperature();
         const auto P = props.pressure();
         activitymodel(actprops, {T, P, x}); // evaluate the activity model
-        const auto G0 = species.standardThermoProps(T, P).G0;
         const auto ln_a = actprops.ln_a[0];
-        return G0 + R*T*ln_a;
+        return R*T*ln_a;
     };
 }
 
 // Return a default chemical potential function for a non-aqueous species. If
 // the species exists in the given chemical system, then the chemical potential
 // model reuses the available chemical potential in the `ChemicalProps` object
-// provided as an argument to the model function. If not, the standard Gibbs
-// energy `G0` of the species is computed and used as chemical potential. If
-// the species is a gas, then `G0 + RT*ln(Pbar)` is used instead. This default
+// provided as an argument to the model function. If not, an empty function is
+// returned, and the chemical potential is computed in AqueousProps::Impl from
+// the standard Gibbs energy `G0` of the species, cached per temperature and
+// pressure (`G0 + RT*ln(Pbar)` if the species is a gas). This default
 // behavior implies that the species constitute a pure ideal gas or solid
 // phase. Note: this method is relevant for computation of saturation indices.
 auto defaultChemicalPotentialModel(Species const& species, ChemicalSystem const& system) -> Fn<real(ChemicalProps const&)>
@@ -100,26 +126,8 @@ auto defaultChemicalPotentialModel(Species const& species, ChemicalSystem const&
         {
             return props.speciesChemicalPotential(ispecies);
         };
-    // Case II: when species is a gas and it does not exist in the chemical system
-    else if(species.aggregateState() == AggregateState::Gas)
-        return [=](ChemicalProps const& props) -> real
-        {
-            const auto T = props.temperature();
-            const auto P = props.pressure();
-            const auto Pbar = P*1e-5; // from Pa to bar
-            const auto RT = universalGasConstant * T;
-            const auto G0 = species.standardThermoProps(T, P).G0;
-            return G0 + RT*log(Pbar);
-        };
-    // Case III: when species is not a gas and it does not exist in the chemical system
-    else
-        return [=](ChemicalProps const& props) -> real
-        {
-            const auto T = props.temperature();
-            const auto P = props.pressure();
-            const auto G0 = species.standardThermoProps(T, P).G0;
-            return G0;
-        };
+    // Case II: when species does not exist in the chemical system (pure ideal gas or pure condensed phase)
+    else return {};
 }
 
 // Return a vector with default chemical potential functions for every given chemical species.
@@ -162,14 +170,23 @@ struct AqueousProps::Impl
     /// The chemical properties of the system.
     ChemicalProps props;
 
-    /// The state of the aqueous solution.
-    AqueousMixtureState aqstate;
+    /// The state of the aqueous solution (computed on demand, see @ref aqueousState).
+    mutable AqueousMixtureState aqstate;
 
     /// The amounts of the species in the aqueous phase (to be used with echelonizer - not for any computation, since it does not have autodiff propagation!).
-    VectorXd naq;
+    mutable VectorXd naq;
+
+    /// The auxiliary vector used to check whether the amounts of the aqueous species have changed since the last echelonization.
+    mutable VectorXd naqnew;
+
+    /// The chemical potentials of the elements in the aqueous phase (computed on demand, see @ref elementChemicalPotentials).
+    mutable VectorXr lambda;
+
+    /// The flag indicating whether `aqstate` needs to be recomputed for the current `props`.
+    mutable bool aqstate_outdated = false;
 
-    /// The chemical potentials of the elements in the aqueous phase
-    VectorXr lambda;
+    /// The flag indicating whether `lambda` needs to be recomputed for the current `props`.
+    mutable bool lambda_outdated = false;
 
     /// The non-aqueous species in the database for which saturation indices are calculated.
     SpeciesList nonaqueous;
@@ -181,11 +198,34 @@ struct AqueousProps::Impl
     MatrixXd Anon;
 
     /// The echelon form of the formula matrix `Aaqs` of the aqueous species.
-    Optima::Echelonizer echelonizer;
+    mutable Optima::Echelonizer echelonizer;
 
     // The chemical potential models for the non-aqueous species (as if they were pure phases) for the computation of their saturation indices.
+    // An empty function means the chemical potential is computed from `G0non` and `activity_term_models` (see @ref nonaqueousChemicalPotential).
     Vec<Fn<real(ChemicalProps const&)>> chemical_potential_models;
 
+    // The models for the terms `RT*ln(a)` of the non-aqueous species set with @ref setActivityModel.
+    // An empty function means the species is treated as a pure ideal gas or pure condensed phase.
+    Vec<Fn<real(ChemicalProps const&)>> activity_term_models;
+
+    /// The standard Gibbs energies of the non-aqueous species cached for temperature `G0T` and pressure `G0P`.
+    mutable ArrayXr G0non;
+
+    /// The flags indicating which entries in `G0non` have been computed at temperature `G0T` and pressure `G0P`.
+    mutable Vec<bool> G0non_computed;
+
+    /// The temperature at which the entries in `G0non` were computed.
+    mutable real G0T = NaN;
+
+    /// The pressure at which the entries in `G0non` were computed.
+    mutable real G0P = NaN;
+
+    /// The saturation ratios (in natural log) of the non-aqueous species cached for the current `props`.
+    mutable ArrayXr lnOmega;
+
+    /// The flags indicating which entries in `lnOmega` have been computed for the current `props`.
+    mutable Vec<bool> lnOmega_computed;
+
     Impl(ChemicalSystem const& system)
     : system(system),
       iphase(indexAqueousPhase(system)),
@@ -223,6 +263,15 @@ struct AqueousProps::Impl
 
         // Initialize the chemical potential models for the non-aqueous species, as if they were pure phases
         chemical_potential_models = defaultChemicalPotentialModels(nonaqueous, system);
+        activity_term_models.resize(nonaqueous.size());
+
+        // Initialize the cache of standard Gibbs energies of the non-aqueous species
+        G0non.resize(nonaqueous.size());
+        G0non_computed.assign(nonaqueous.size(), false);
+
+        // Initialize the cache of saturation ratios of the non-aqueous species
+        lnOmega.resize(nonaqueous.size());
+        lnOmega_computed.assign(nonaqueous.size(), false);
 
         // Initialize the aqueous state properties
         aqstate.T = NaN;
@@ -234,8 +283,8 @@ struct AqueousProps::Impl
         aqstate.m.setConstant(Naq, NaN);
         aqstate.ms.setConstant(Naq, NaN);
 
-        // Compute the initial echelon form of formula matrix `Aaqs`
-        echelonizer.compute(Aaqs);
+        // Compute the initial echelon form of formula matrix `Aaqs` (or reuse the one already computed for the same matrix)
+        echelonizer = echelonizerFor(Aaqs);
     }
 
     Impl(ChemicalState const& state)
@@ -257,7 +306,9 @@ struct AqueousProps::Impl
             "This species must be non-aqueous and exist in the thermodynamic database. It must also be composed of chemical elements "
             "present in the aqueous phase. This error will occur, for example, if you are calculating the saturation ratio of Quartz (SiO2) "
             "but the aqueous phase has no species with element Si.");
-        chemical_potential_models[i] = chemicalPotentialModel(nonaqueous[i], generator);
+        chemical_potential_models[i] = {};
+        activity_term_models[i] = activityTermModel(nonaqueous[i], generator);
+        lnOmega_computed[i] = false;
     }
 
     auto update(ChemicalState const& state) -> void
@@ -268,31 +319,94 @@ struct AqueousProps::Impl
 
     auto update(ChemicalProps const& cprops) -> void
     {
-        // Auxiliary variables
-        auto const& aqprops = cprops.phaseProps(iphase);
-        auto const& T = aqprops.temperature();
-        auto const& P = aqprops.pressure();
-        auto const& x = aqprops.speciesMoleFractions();
-
         // Update the internal properties of the chemical system
         props = cprops;
 
-        // Update the internal aqueous state object
-        aqstate = aqsolution.state(T, P, x);
+        // The aqueous state, the chemical potentials of the elements, and the
+        // saturation ratios are computed only when a property that depends on
+        // them is requested
+        aqstate_outdated = true;
+        lambda_outdated = true;
+        std::fill(lnOmega_computed.begin(), lnOmega_computed.end(), false);
+    }
+
+    /// Return the state of the aqueous solution, computing it first if outdated.
+    auto aqueousState() const -> AqueousMixtureState const&
+    {
+        if(aqstate_outdated)
+        {
+            auto const& aqprops = props.phaseProps(iphase);
+            auto const& T = aqprops.temperature();
+            auto const& P = aqprops.pressure();
+            auto const& x = aqprops.speciesMoleFractions();
+            aqstate = aqsolution.state(T, P, x);
+            aqstate_outdated = false;
+        }
+        return aqstate;
+    }
 
-        // Update auxiliary vector naq to be used in the echelonization below
-        naq = aqprops.speciesAmounts();
+    /// Return the chemical potentials of the elements in the aqueous phase, computing them first if outdated.
+    auto elementChemicalPotentials() const -> VectorXr const&
+    {
+        if(lambda_outdated)
+        {
+            auto const& aqprops = props.phaseProps(iphase);
+
+            // Update auxiliary vector naqnew to be used in the echelonization below
+            naqnew = aqprops.speciesAmounts();
+
+            // Update the echelon form and also the list of basic species, but only if the priority weights have changed since the last update
+            if(naqnew.size() != naq.size() || naqnew != naq)
+            {
+                naq.swap(naqnew);
+                echelonizer.updateWithPriorityWeights(naq);
+            }
+
+            // Compute chemical potentials of the elements in the aqueous phase
+            const auto u = aqprops.speciesChemicalPotentials();
+            const auto ib = echelonizer.indicesBasicVariables();
+            const auto R = echelonizer.R();
+            const auto Rb = R.topRows(ib.size());
+            const VectorXr ub = u(ib);
+            lambda = Rb.transpose() * ub;
+            lambda_outdated = false;
+        }
+        return lambda;
+    }
 
-        // Update the echelon form and also the list of basic species
-        echelonizer.updateWithPriorityWeights(naq);
+    /// Return the standard Gibbs energy of the *i*-th non-aqueous species, reusing the value cached for the current temperature and pressure.
+    auto nonaqueousStandardGibbsEnergy(Index i) const -> real const&
+    {
+        const auto T = props.temperature();
+        const auto P = props.pressure();
+        if(T != G0T || P != G0P)
+        {
+            G0T = T;
+            G0P = P;
+            std::fill(G0non_computed.begin(), G0non_computed.end(), false);
+        }
+        if(!G0non_computed[i])
+        {
+            G0non[i] = nonaqueous[i].standardThermoProps(T, P).G0;
+            G0non_computed[i] = true;
+        }
+        return G0non[i];
+    }
 
-        // Compute chemical potentials of the elements in the aqueous phase
-        const auto u = aqprops.speciesChemicalPotentials();
-        const auto ib = echelonizer.indicesBasicVariables();
-        const auto R = echelonizer.R();
-        const auto Rb = R.topRows(ib.size());
-        const VectorXr ub = u(ib);
-        lambda = Rb.transpose() * ub;
+    /// Return the chemical potential of the *i*-th non-aqueous species for the computation of its saturation index.
+    auto nonaqueousChemicalPotential(Index i) const -> real
+    {
+        if(chemical_potential_models[i])
+            return chemical_potential_models[i](props);
+        const auto G0 = nonaqueousStandardGibbsEnergy(i);
+        if(activity_term_models[i])
+            return G0 + activity_term_models[i](props);
+        if(nonaqueous[i].aggregateState() != AggregateState::Gas)
+            return G0;
+        const auto T = props.temperature();
+        const auto Pbar = props.pressure() * 1e-5; // from Pa to bar
+        const auto RT = universalGasConstant * T;
+        return G0 + RT*log(Pbar);
     }
 
     auto temperature() const -> real
@@ -328,36 +442,36 @@ struct AqueousProps::Impl
     auto elementMolality(StringOrIndex const& symbol) const -> real
     {
         const auto idx = detail::resolveElementIndexOrRaiseError(phase, symbol);
-        auto const& m = aqstate.m.matrix();
+        auto const& m = aqueousState().m.matrix();
         return Aaqs.row(idx) * m;
     }
 
     auto elementMolalities() const -> ArrayXr
     {
         const auto E = phase.elements().size();
-        auto const& m = aqstate.m.matrix();
+        auto const& m = aqueousState().m.matrix();
         return Aaqs.topRows(E) * m;
     }
 
     auto speciesMolality(StringOrIndex const& name) const -> real
     {
         const auto idx = detail::resolveSpeciesIndexOrRaiseError(phase, name);
-        return aqstate.m[idx];
+        return aqueousState().m[idx];
     }
 
     auto speciesMolalities() const -> ArrayXr
     {
-        return aqstate.m;
+        return aqueousState().m;
     }
 
     auto ionicStrength() const -> real
     {
-        return aqstate.Ie;
+        return aqueousState().Ie;
     }
 
     auto ionicStrengthStoichiometric() const -> real
     {
-        return aqstate.Is;
+        return aqueousState().Is;
     }
 
     auto pH() const -> real
@@ -371,7 +485,7 @@ struct AqueousProps::Impl
     {
         const auto T = props.temperature();
         const auto E = phase.elements().size();
-        const auto lambdaZ = lambda[E];
+        const auto lambdaZ = elementChemicalPotentials()[E];
         const auto RT = universalGasConstant * T;
         const auto res = lambdaZ/(RT*ln10);
         return res;
@@ -400,24 +514,31 @@ struct AqueousProps::Impl
             "and exist in the thermodynamic database. It must also be composed of chemical elements "
             "present in the aqueous phase. This error will occur, for example, if you are calculating "
             "the saturation ratio of Quartz (SiO2) but the aqueous phase has no species with element Si.");
-        const auto RT = universalGasConstant * props.temperature();
-        const auto ui = chemical_potential_models[i](props);
-        const auto li = Anon.col(i).dot(lambda);
-        const auto lnOmegai = (li - ui)/RT;
-        return lnOmegai;
+        return nonaqueousSaturationRatioLn(i);
     }
 
     auto saturationRatiosLn() const -> ArrayXr
     {
-        const auto RT = universalGasConstant * props.temperature();
         const auto num_nonaqueous = nonaqueous.size();
-        ArrayXr lnOmega(num_nonaqueous);
-        lnOmega = Anon.transpose() * lambda;
         for(auto i = 0; i < num_nonaqueous; ++i)
-            lnOmega[i] -= chemical_potential_models[i](props);
-        lnOmega /= RT;
+            nonaqueousSaturationRatioLn(i);
         return lnOmega;
     }
+
+    /// Return the saturation ratio (in natural log) of the *i*-th non-aqueous species, reusing the value cached for the current `props`.
+    /// This ensures that rate models and saturation index queries sharing this object (e.g., via @ref AqueousProps::compute) evaluate each ratio once.
+    auto nonaqueousSaturationRatioLn(Index i) const -> real const&
+    {
+        if(!lnOmega_computed[i])
+        {
+            const auto RT = universalGasConstant * props.temperature();
+            const auto ui = nonaqueousChemicalPotential(i);
+            const auto li = Anon.col(i).dot(elementChemicalPotentials());
+            lnOmega[i] = (li - ui)/RT;
+            lnOmega_computed[i] = true;
+        }
+        return lnOmega[i];
+    }
 };
 
 AqueousProps::AqueousProps(ChemicalSystem const& system)
@@ -76,6 +76,8 @@ public:
     auto update(ChemicalState const& state) -> void;
 
     /// Update the aqueous properties with given chemical properties of the system.
+    /// Properties such as species molalities, ionic strength, pE, and saturation
+    /// indices are computed only when first requested after an update.
     auto update(ChemicalProps const& props) -> void;
 
     /// Return the temperature of the aqueous phase (in K).
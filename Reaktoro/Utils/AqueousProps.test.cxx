@@ -193,6 +193,45 @@ TEST_CASE("Testing AqueousProps class", "[AqueousProps]")
         CHECK( aqprops.saturationIndex("CO(g)") == Approx(0.000339846/ln10) );
     }
 
+    SECTION("Testing lazily computed properties after successive updates")
+    {
+        ChemicalState state(system);
+        state.temperature(300);
+        state.setPressure(3e5);
+        state.setSpeciesAmounts(1.0);
+
+        aqprops.update(state);
+
+        CHECK( aqprops.pH() == Approx(AqueousProps(state).pH()) ); // only pH requested, nothing else computed
+
+        aqprops.update(state); // same temperature and pressure, cached standard Gibbs energies reused
+
+        ArrayXr lgOmega = aqprops.saturationIndices();
+        ArrayXr expected = AqueousProps(state).saturationIndices();
+        for(auto i = 0; i < expected.size(); ++i)
+            CHECK( lgOmega[i] == Approx(expected[i]) );
+
+        state.temperature(350);
+        state.setSpeciesAmount(0, 2.0);
+
+        aqprops.update(state); // new temperature, cached standard Gibbs energies discarded
+
+        CHECK( aqprops.saturationIndex("CO2(g)") == Approx(AqueousProps(state).saturationIndex("CO2(g)")) );
+        lgOmega = aqprops.saturationIndices();
+        expected = AqueousProps(state).saturationIndices();
+        for(auto i = 0; i < expected.size(); ++i)
+            CHECK( lgOmega[i] == Approx(expected[i]) );
+        CHECK( aqprops.ionicStrength() == Approx(AqueousProps(state).ionicStrength()) );
+        CHECK( aqprops.pE() == Approx(AqueousProps(state).pE()) );
+
+        state.setSpeciesAmount(0, 3.0);
+
+        aqprops.update(state); // same temperature and pressure, but cached saturation ratios discarded
+
+        CHECK( aqprops.saturationRatio("CaCO3(s)") == Approx(AqueousProps(state).saturationRatio("CaCO3(s)")) );
+        CHECK( aqprops.saturationIndex("CaCO3(s)") == Approx(aqprops.saturationIndices()[7]) ); // reuses the cached saturation ratio
+    }
+
     SECTION("Testing static method AqueousProps::compute")
     {
         ChemicalState state(system);
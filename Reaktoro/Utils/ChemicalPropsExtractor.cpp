@@ -0,0 +1,306 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ChemicalPropsExtractor.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsPhase.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
+
+namespace Reaktoro {
+
+struct ChemicalPropsExtractor::Impl
+{
+    /// The chemical system of the states.
+    const ChemicalSystem system;
+
+    /// The number of worker threads requested (zero for the number of hardware threads).
+    Index numthreads = 1;
+
+    /// The flag indicating whether the chemical properties stored in the states are used.
+    bool usestateprops = false;
+
+    /// The names of the registered quantities.
+    Strings names;
+
+    /// The functions of the chemical properties of a state evaluating the registered quantities (empty for those evaluated with aqueous properties).
+    Vec<Fn<real(ChemicalProps const&)>> fns;
+
+    /// The functions of the aqueous properties of a state evaluating the registered quantities (empty for those evaluated with chemical properties).
+    Vec<Fn<real(AqueousProps const&)>> aqfns;
+
+    /// The aqueous properties used to resolve names of aqueous species and elements (created on demand).
+    Ptr<AqueousProps> aqprops0;
+
+    /// The pool of worker threads (created on demand).
+    SharedPtr<ThreadPool> pool;
+
+    /// The chemical properties of the worker threads (created on demand).
+    Vec<ChemicalProps> props;
+
+    /// The aqueous properties of the worker threads (created on demand if aqueous quantities are registered).
+    Vec<AqueousProps> aqprops;
+
+    /// Construct a ChemicalPropsExtractor::Impl object with given chemical system.
+    Impl(ChemicalSystem const& system)
+    : system(system)
+    {}
+
+    /// Construct a copy of a ChemicalPropsExtractor::Impl object (the workers are not copied).
+    Impl(Impl const& other)
+    : system(other.system), numthreads(other.numthreads), usestateprops(other.usestateprops), names(other.names), fns(other.fns), aqfns(other.aqfns)
+    {}
+
+    /// Return true if any registered quantity is evaluated with aqueous properties.
+    auto hasAqueousQuantities() const -> bool
+    {
+        for(auto const& fn : aqfns)
+            if(fn) return true;
+        return false;
+    }
+
+    /// Return the aqueous properties used to resolve names of aqueous species and elements.
+    auto aqueousProps() -> AqueousProps const&
+    {
+        if(!aqprops0)
+            aqprops0 = std::make_unique<AqueousProps>(system);
+        return *aqprops0;
+    }
+
+    /// Register a quantity evaluated with a function of the chemical properties of a state.
+    auto add(String const& name, Fn<real(ChemicalProps const&)> const& fn) -> void
+    {
+        errorif(!fn, "Expecting a non-empty function for quantity `", name, "` in ChemicalPropsExtractor.");
+        names.push_back(name);
+        fns.push_back(fn);
+        aqfns.push_back({});
+    }
+
+    /// Register a quantity evaluated with a function of the aqueous properties of a state.
+    auto addAqueous(String const& name, Fn<real(AqueousProps const&)> const& fn) -> void
+    {
+        errorif(!fn, "Expecting a non-empty function for quantity `", name, "` in ChemicalPropsExtractor.");
+        names.push_back(name);
+        fns.push_back({});
+        aqfns.push_back(fn);
+    }
+
+    /// Register a quantity given as a string.
+    auto add(String const& quantity) -> void
+    {
+        auto const lparen = quantity.find('(');
+        errorif(lparen != String::npos && quantity.back() != ')', "Expecting quantity `", quantity, "` in ChemicalPropsExtractor to terminate with `)`.");
+
+        auto const key = trim(quantity.substr(0, lparen));
+        auto const arg = lparen != String::npos ? trim(quantity.substr(lparen + 1, quantity.size() - lparen - 2)) : String();
+
+        auto const hasarg = !arg.empty();
+
+        auto expectarg = [&](bool expected)
+        {
+            errorif(expected && !hasarg, "Expecting an argument in quantity `", quantity, "` in ChemicalPropsExtractor (e.g., `", key, "(name)`).");
+            errorif(!expected && hasarg, "Expecting no argument in quantity `", quantity, "` in ChemicalPropsExtractor.");
+        };
+
+        auto element = [&]() { expectarg(true); return detail::resolveElementIndexOrRaiseError(system, arg); };
+        auto species = [&]() { expectarg(true); return detail::resolveSpeciesIndexOrRaiseError(system, arg); };
+        auto phase   = [&]() { expectarg(true); return detail::resolvePhaseIndexOrRaiseError(system, arg); };
+
+        if(key == "temperature")                { expectarg(false); add(quantity, [](ChemicalProps const& p) { return p.temperature(); }); return; }
+        if(key == "pressure")                   { expectarg(false); add(quantity, [](ChemicalProps const& p) { return p.pressure(); }); return; }
+        if(key == "amount")                     { expectarg(false); add(quantity, [](ChemicalProps const& p) { return p.amount(); }); return; }
+        if(key == "mass")                       { expectarg(false); add(quantity, [](ChemicalProps const& p) { return p.mass(); }); return; }
+        if(key == "volume")                     { expectarg(false); add(quantity, [](ChemicalProps const& p) { return p.volume(); }); return; }
+        if(key == "elementAmount")              { auto i = element(); add(quantity, [=](ChemicalProps const& p) { return p.elementAmount(i); }); return; }
+        if(key == "elementMass")                { auto i = element(); add(quantity, [=](ChemicalProps const& p) { return p.elementMass(i); }); return; }
+        if(key == "speciesAmount")              { auto i = species(); add(quantity, [=](ChemicalProps const& p) { return p.speciesAmount(i); }); return; }
+        if(key == "speciesMass")                { auto i = species(); add(quantity, [=](ChemicalProps const& p) { return p.speciesMass(i); }); return; }
+        if(key == "speciesMoleFraction")        { auto i = species(); add(quantity, [=](ChemicalProps const& p) { return p.speciesMoleFraction(i); }); return; }
+        if(key == "speciesActivityCoefficient") { auto i = species(); add(quantity, [=](ChemicalProps const& p) { return p.speciesActivityCoefficient(i); }); return; }
+        if(key == "speciesActivity")            { auto i = species(); add(quantity, [=](ChemicalProps const& p) { return p.speciesActivity(i); }); return; }
+        if(key == "speciesChemicalPotential")   { auto i = species(); add(quantity, [=](ChemicalProps const& p) { return p.speciesChemicalPotential(i); }); return; }
+        if(key == "phaseAmount")                { auto i = phase(); add(quantity, [=](ChemicalProps const& p) { return p.phaseProps(i).amount(); }); return; }
+        if(key == "phaseMass")                  { auto i = phase(); add(quantity, [=](ChemicalProps const& p) { return p.phaseProps(i).mass(); }); return; }
+        if(key == "phaseVolume")                { auto i = phase(); add(quantity, [=](ChemicalProps const& p) { return p.phaseProps(i).volume(); }); return; }
+
+        if(key == "pH")                         { expectarg(false); addAqueous(quantity, [](AqueousProps const& a) { return a.pH(); }); return; }
+        if(key == "pE")                         { expectarg(false); addAqueous(quantity, [](AqueousProps const& a) { return a.pE(); }); return; }
+        if(key == "Eh")                         { expectarg(false); addAqueous(quantity, [](AqueousProps const& a) { return a.Eh(); }); return; }
+        if(key == "ionicStrength")              { expectarg(false); addAqueous(quantity, [](AqueousProps const& a) { return a.ionicStrength(); }); return; }
+        if(key == "alkalinity")                 { expectarg(false); addAqueous(quantity, [](AqueousProps const& a) { return a.alkalinity(); }); return; }
+
+        if(key == "speciesMolality")
+        {
+            expectarg(true);
+            auto const i = detail::resolveSpeciesIndexOrRaiseError(aqueousProps().phase(), arg);
+            addAqueous(quantity, [=](AqueousProps const& a) { return a.speciesMolality(i); });
+            return;
+        }
+
+        if(key == "elementMolality")
+        {
+            expectarg(true);
+            auto const i = detail::resolveElementIndexOrRaiseError(aqueousProps().phase(), arg);
+            addAqueous(quantity, [=](AqueousProps const& a) { return a.elementMolality(i); });
+            return;
+        }
+
+        if(key == "saturationIndex")
+        {
+            expectarg(true);
+            auto const i = detail::resolveSpeciesIndexOrRaiseError(aqueousProps().saturationSpecies(), arg);
+            addAqueous(quantity, [=](AqueousProps const& a) { return a.saturationIndex(i); });
+            return;
+        }
+
+        errorif(true, "Quantity `", quantity, "` is not supported in ChemicalPropsExtractor. Register it with a function instead.");
+    }
+
+    /// Ensure the pool of worker threads and their chemical and aqueous properties exist.
+    auto initializeWorkers() -> void
+    {
+        if(!pool)
+            pool = std::make_shared<ThreadPool>(numthreads);
+
+        const auto numworkers = pool->numThreads();
+
+        if(props.size() != numworkers)
+        {
+            props.assign(numworkers, ChemicalProps(system));
+            for(auto& p : props)
+                p.reuseStandardThermoProps(true);
+        }
+
+        if(hasAqueousQuantities() && aqprops.size() != numworkers)
+            aqprops.assign(numworkers, AqueousProps(system));
+
+        // The model parameters may have changed since the last extraction
+        for(auto& p : props)
+            p.discardStandardThermoProps();
+    }
+
+    /// Evaluate the registered quantities for given chemical states.
+    auto extract(Vec<ChemicalState> const& states) -> MatrixXd
+    {
+        const auto Nn = system.species().size();
+        const auto numstates = states.size();
+        const auto numquantities = names.size();
+
+        for(auto const& state : states)
+            errorif(state.system().species().size() != Nn, "Expecting chemical states with the chemical system given to ChemicalPropsExtractor, which has ", Nn, " species, but got a state with ", state.system().species().size(), " species.");
+
+        MatrixXd res(numstates, numquantities);
+
+        if(numstates == 0 || numquantities == 0)
+            return res;
+
+        initializeWorkers();
+
+        const auto aqueous = hasAqueousQuantities();
+
+        pool->parallelFor(numstates, [&](Index i, Index iworker)
+        {
+            auto& chemprops = props[iworker];
+
+            if(!usestateprops)
+                chemprops.update(states[i]);
+
+            ChemicalProps const& p = usestateprops ? states[i].props() : chemprops;
+
+            if(aqueous)
+                aqprops[iworker].update(p);
+
+            for(Index j = 0; j < numquantities; ++j)
+                res(i, j) = fns[j] ? fns[j](p).val() : aqfns[j](aqprops[iworker]).val();
+        });
+
+        return res;
+    }
+};
+
+ChemicalPropsExtractor::ChemicalPropsExtractor(ChemicalSystem const& system)
+: pimpl(new Impl(system))
+{}
+
+ChemicalPropsExtractor::ChemicalPropsExtractor(ChemicalPropsExtractor const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ChemicalPropsExtractor::~ChemicalPropsExtractor()
+{}
+
+auto ChemicalPropsExtractor::operator=(ChemicalPropsExtractor other) -> ChemicalPropsExtractor&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ChemicalPropsExtractor::setNumThreads(Index numthreads) -> void
+{
+    if(pimpl->numthreads == numthreads)
+        return;
+    pimpl->numthreads = numthreads;
+    pimpl->pool.reset();
+    pimpl->props.clear();
+    pimpl->aqprops.clear();
+}
+
+auto ChemicalPropsExtractor::setUseStateProps(bool enable) -> void
+{
+    pimpl->usestateprops = enable;
+}
+
+auto ChemicalPropsExtractor::add(String const& quantity) -> void
+{
+    pimpl->add(quantity);
+}
+
+auto ChemicalPropsExtractor::add(Strings const& quantities) -> void
+{
+    for(auto const& quantity : quantities)
+        pimpl->add(quantity);
+}
+
+auto ChemicalPropsExtractor::add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void
+{
+    pimpl->add(name, quantity);
+}
+
+auto ChemicalPropsExtractor::addAqueous(String const& name, Fn<real(AqueousProps const&)> const& quantity) -> void
+{
+    pimpl->addAqueous(name, quantity);
+}
+
+auto ChemicalPropsExtractor::names() const -> Strings const&
+{
+    return pimpl->names;
+}
+
+auto ChemicalPropsExtractor::extract(Vec<ChemicalState> const& states) -> MatrixXd
+{
+    return pimpl->extract(states);
+}
+
+} // namespace Reaktoro
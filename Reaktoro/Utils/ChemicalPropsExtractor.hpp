@@ -0,0 +1,123 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class AqueousProps;
+class ChemicalProps;
+class ChemicalState;
+class ChemicalSystem;
+
+/// Used to extract chosen quantities from many chemical states of the same chemical system at once.
+/// The quantities are registered once with @ref add, either with a function
+/// or with a string such as `"pH"`, `"temperature"` or `"speciesAmount(Ca+2)"`,
+/// in which case the names of species, elements and phases are resolved to
+/// indices only once. A call to @ref extract then evaluates all quantities
+/// for all given states in a pool of worker threads and returns a matrix with
+/// one row per state and one column per quantity, ready to become a data
+/// frame. This avoids retrieving each quantity of each state one at a time,
+/// which is slow from Python.
+///
+/// The supported quantity strings are:
+///
+/// | Quantity                          | Units | Evaluated with |
+/// | --------                          | ----- | -------------- |
+/// | `temperature`                     | K     | ChemicalProps  |
+/// | `pressure`                        | Pa    | ChemicalProps  |
+/// | `amount`                          | mol   | ChemicalProps  |
+/// | `mass`                            | kg    | ChemicalProps  |
+/// | `volume`                          | m3    | ChemicalProps  |
+/// | `elementAmount(symbol)`           | mol   | ChemicalProps  |
+/// | `elementMass(symbol)`             | kg    | ChemicalProps  |
+/// | `speciesAmount(name)`             | mol   | ChemicalProps  |
+/// | `speciesMass(name)`               | kg    | ChemicalProps  |
+/// | `speciesMoleFraction(name)`       | ---   | ChemicalProps  |
+/// | `speciesActivityCoefficient(name)`| ---   | ChemicalProps  |
+/// | `speciesActivity(name)`           | ---   | ChemicalProps  |
+/// | `speciesChemicalPotential(name)`  | J/mol | ChemicalProps  |
+/// | `phaseAmount(name)`               | mol   | ChemicalProps  |
+/// | `phaseMass(name)`                 | kg    | ChemicalProps  |
+/// | `phaseVolume(name)`               | m3    | ChemicalProps  |
+/// | `pH`                              | ---   | AqueousProps   |
+/// | `pE`                              | ---   | AqueousProps   |
+/// | `Eh`                              | V     | AqueousProps   |
+/// | `ionicStrength`                   | molal | AqueousProps   |
+/// | `alkalinity`                      | eq/L  | AqueousProps   |
+/// | `speciesMolality(name)`           | molal | AqueousProps   |
+/// | `elementMolality(symbol)`         | molal | AqueousProps   |
+/// | `saturationIndex(name)`           | ---   | AqueousProps   |
+class ChemicalPropsExtractor
+{
+public:
+    /// Construct a ChemicalPropsExtractor object with given chemical system.
+    explicit ChemicalPropsExtractor(ChemicalSystem const& system);
+
+    /// Construct a copy of a ChemicalPropsExtractor object.
+    ChemicalPropsExtractor(ChemicalPropsExtractor const& other);
+
+    /// Destroy this ChemicalPropsExtractor object.
+    ~ChemicalPropsExtractor();
+
+    /// Assign a copy of a ChemicalPropsExtractor object to this.
+    auto operator=(ChemicalPropsExtractor other) -> ChemicalPropsExtractor&;
+
+    /// Set the number of worker threads used to evaluate the quantities of the states.
+    /// If zero, the number of hardware threads available is used. The default is one.
+    auto setNumThreads(Index numthreads) -> void;
+
+    /// Set whether the chemical properties already stored in the states are used instead of evaluated again.
+    /// Enable this only if the chemical properties of the states are up to
+    /// date (e.g., right after equilibrium or kinetics calculations). The
+    /// default is false.
+    auto setUseStateProps(bool enable) -> void;
+
+    /// Register a quantity given as a string (see the table in the class documentation), using this string as its name.
+    auto add(String const& quantity) -> void;
+
+    /// Register quantities given as strings (see the table in the class documentation), using these strings as their names.
+    auto add(Strings const& quantities) -> void;
+
+    /// Register a quantity with given name evaluated with a function of the chemical properties of a state.
+    auto add(String const& name, Fn<real(ChemicalProps const&)> const& quantity) -> void;
+
+    /// Register a quantity with given name evaluated with a function of the aqueous properties of a state.
+    auto addAqueous(String const& name, Fn<real(AqueousProps const&)> const& quantity) -> void;
+
+    /// Return the names of the registered quantities.
+    auto names() const -> Strings const&;
+
+    /// Evaluate the registered quantities for given chemical states.
+    /// @param states The chemical states, all with the same chemical system given at construction.
+    /// @return The values of the quantities, one row per state and one column per quantity.
+    auto extract(Vec<ChemicalState> const& states) -> MatrixXd;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,48 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
+#include <Reaktoro/Utils/ChemicalPropsExtractor.hpp>
+using namespace Reaktoro;
+
+void exportChemicalPropsExtractor(py::module& m)
+{
+    auto add1 = py::overload_cast<String const&>(&ChemicalPropsExtractor::add);
+    auto add2 = py::overload_cast<Strings const&>(&ChemicalPropsExtractor::add);
+    auto add3 = py::overload_cast<String const&, Fn<real(ChemicalProps const&)> const&>(&ChemicalPropsExtractor::add);
+
+    py::class_<ChemicalPropsExtractor>(m, "ChemicalPropsExtractor")
+        .def(py::init<ChemicalSystem const&>())
+        .def("clone", [](ChemicalPropsExtractor const& self) { return ChemicalPropsExtractor(self); }, "Return a deep copy of this ChemicalPropsExtractor object.")
+        .def("setNumThreads", &ChemicalPropsExtractor::setNumThreads, "Set the number of worker threads used to evaluate the quantities of the states.")
+        .def("setUseStateProps", &ChemicalPropsExtractor::setUseStateProps, "Set whether the chemical properties already stored in the states are used instead of evaluated again.")
+        .def("add", add1, "Register a quantity given as a string, using this string as its name.")
+        .def("add", add2, "Register quantities given as strings, using these strings as their names.")
+        .def("add", add3, "Register a quantity with given name evaluated with a function of the chemical properties of a state.")
+        .def("addAqueous", &ChemicalPropsExtractor::addAqueous, "Register a quantity with given name evaluated with a function of the aqueous properties of a state.")
+        .def("names", &ChemicalPropsExtractor::names, return_internal_ref, "Return the names of the registered quantities.")
+        .def("extract", &ChemicalPropsExtractor::extract, py::call_guard<py::gil_scoped_release>(), "Evaluate the registered quantities for given chemical states, returning one row per state and one column per quantity.")
+        ;
+}
@@ -0,0 +1,128 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
+#include <Reaktoro/Utils/ChemicalPropsExtractor.hpp>
+using namespace Reaktoro;
+
+namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
+
+TEST_CASE("Testing ChemicalPropsExtractor class", "[ChemicalPropsExtractor]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto numstates = 7;
+
+    Vec<ChemicalState> states;
+    for(auto i = 0; i < numstates; ++i)
+    {
+        ChemicalState state(system);
+        state.setTemperature(300.0 + 10.0*i);
+        state.setPressure(1e5 * (1.0 + i));
+        state.set("H2O(aq)", 55.0, "mol");
+        state.set("Na+(aq)", 0.1 * (i + 1), "mol");
+        state.set("Cl-(aq)", 0.1 * (i + 1), "mol");
+        state.set("H+(aq)", 1e-7, "mol");
+        state.set("CaCO3(s)", 1.0 + i, "mol");
+        states.push_back(state);
+    }
+
+    ChemicalPropsExtractor extractor(system);
+
+    extractor.add("temperature");
+    extractor.add({ "pressure", "speciesAmount(Na+(aq))", "phaseAmount(Calcite)", "elementAmount(Cl)" });
+    extractor.add("pH");
+    extractor.add("speciesMolality(Na+(aq))");
+    extractor.add("speciesChemicalPotential(H2O(aq))");
+    extractor.add("twice-volume", [](ChemicalProps const& props) { return 2.0 * props.volume(); });
+    extractor.addAqueous("ionicStrength", [](AqueousProps const& aprops) { return aprops.ionicStrength(); });
+
+    CHECK( extractor.names() == Strings{ "temperature", "pressure", "speciesAmount(Na+(aq))", "phaseAmount(Calcite)", "elementAmount(Cl)", "pH", "speciesMolality(Na+(aq))", "speciesChemicalPotential(H2O(aq))", "twice-volume", "ionicStrength" } );
+
+    auto check = [&](MatrixXd const& values)
+    {
+        REQUIRE( values.rows() == numstates );
+        REQUIRE( values.cols() == 10 );
+
+        for(auto i = 0; i < numstates; ++i)
+        {
+            ChemicalProps props(states[i]);
+            AqueousProps aprops(props);
+
+            CHECK( values(i, 0) == Approx(props.temperature()) );
+            CHECK( values(i, 1) == Approx(props.pressure()) );
+            CHECK( values(i, 2) == Approx(props.speciesAmount("Na+(aq)")) );
+            CHECK( values(i, 3) == Approx(props.phaseProps("Calcite").amount()) );
+            CHECK( values(i, 4) == Approx(props.elementAmount("Cl")) );
+            CHECK( values(i, 5) == Approx(aprops.pH()) );
+            CHECK( values(i, 6) == Approx(aprops.speciesMolality("Na+(aq)")) );
+            CHECK( values(i, 7) == Approx(props.speciesChemicalPotential("H2O(aq)")) );
+            CHECK( values(i, 8) == Approx(2.0 * props.volume()) );
+            CHECK( values(i, 9) == Approx(aprops.ionicStrength()) );
+        }
+    };
+
+    SECTION("Testing extraction with a single worker thread")
+    {
+        check(extractor.extract(states));
+    }
+
+    SECTION("Testing extraction with multiple worker threads")
+    {
+        extractor.setNumThreads(4);
+        check(extractor.extract(states));
+    }
+
+    SECTION("Testing extraction using the chemical properties stored in the states")
+    {
+        for(auto& state : states)
+            state.props().update(state);
+        extractor.setUseStateProps(true);
+        check(extractor.extract(states));
+    }
+
+    SECTION("Testing extraction with a copy of the extractor")
+    {
+        ChemicalPropsExtractor copy(extractor);
+        CHECK( copy.names() == extractor.names() );
+        check(copy.extract(states));
+    }
+
+    SECTION("Testing extraction from no states")
+    {
+        const auto values = extractor.extract({});
+        CHECK( values.rows() == 0 );
+        CHECK( values.cols() == 10 );
+    }
+
+    SECTION("Testing errors when registering quantities")
+    {
+        CHECK_THROWS( extractor.add("foo") );
+        CHECK_THROWS( extractor.add("speciesAmount") );
+        CHECK_THROWS( extractor.add("speciesAmount(Xyz)") );
+        CHECK_THROWS( extractor.add("temperature(H2O(aq))") );
+        CHECK_THROWS( extractor.add("phaseAmount(Calcite") );
+    }
+}
@@ -26,6 +26,7 @@ void exportWaterHelmholtzPropsHGK(py::module& m);
 void exportWaterHelmholtzPropsWagnerPruss(py::module& m);
 void exportWaterInterpolation(py::module& m);
 void exportWaterThermoProps(py::module& m);
+void exportWaterThermoPropsIAPWSIF97(py::module& m);
 void exportWaterThermoPropsUtils(py::module& m);
 void exportWaterUtils(py::module& m);
 
@@ -39,6 +40,7 @@ void exportWater(py::module& m)
     exportWaterHelmholtzPropsWagnerPruss(m);
     exportWaterInterpolation(m);
     exportWaterThermoProps(m);
+    exportWaterThermoPropsIAPWSIF97(m);
     exportWaterThermoPropsUtils(m);
     exportWaterUtils(m);
 }
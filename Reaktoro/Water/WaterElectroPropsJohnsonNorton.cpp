@@ -17,10 +17,6 @@
 
 #include "WaterElectroPropsJohnsonNorton.hpp"
 
-// C++ includes
-#include <cmath>
-using std::pow;
-
 // Reaktoro includes
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
@@ -56,28 +52,6 @@ const double a[] =
     -0.2729401652e+02
 };
 
-inline auto k0(real t)    -> real { return 1.0; }
-inline auto k1(real t)    -> real { return a[1]/t; }
-inline auto k2(real t)    -> real { return a[2]/t + a[3] + a[4]*t; }
-inline auto k3(real t)    -> real { return a[5]/t + a[6]*t + a[7]*t*t; }
-inline auto k4(real t)    -> real { return a[8]/t/t + a[9]/t + a[10]; }
-
-inline auto k0_t(real t)  -> real { return 0.0; }
-inline auto k1_t(real t)  -> real { return -a[1]/(t*t); }
-inline auto k2_t(real t)  -> real { return -a[2]/(t*t) + a[4]; }
-inline auto k3_t(real t)  -> real { return -a[5]/(t*t) + a[6] + 2*a[7]*t; }
-inline auto k4_t(real t)  -> real { return -2*a[8]/(t*t*t) - a[9]/(t*t); }
-
-inline auto k0_tt(real t) -> real { return 0.0; }
-inline auto k1_tt(real t) -> real { return 2*a[1]/(t*t*t); }
-inline auto k2_tt(real t) -> real { return 2*a[2]/(t*t*t); }
-inline auto k3_tt(real t) -> real { return 2*a[5]/(t*t*t) + 2*a[7]; }
-inline auto k4_tt(real t) -> real { return 6*a[8]/(t*t*t*t) + 2*a[9]/(t*t*t); }
-
-real (*k[5])(real)    = {k0, k1, k2, k3, k4};
-real (*k_t[5])(real)  = {k0_t, k1_t, k2_t, k3_t, k4_t};
-real (*k_tt[5])(real) = {k0_tt, k1_tt, k2_tt, k3_tt, k4_tt};
-
 } // namespace
 
 auto waterElectroPropsJohnsonNorton(real T, real P, const WaterThermoProps& wt) -> WaterElectroProps
@@ -96,19 +70,54 @@ auto waterElectroPropsJohnsonNorton(real T, real P, const WaterThermoProps& wt)
     const auto t = T/Tr;
     const auto r = wt.D/Dr;
 
-    for(int i = 0; i <= 4; ++i)
+    // The powers of 1/t shared among the coefficients k[i] and their derivatives
+    const auto it1 = 1.0/t;
+    const auto it2 = it1*it1;
+    const auto it3 = it2*it1;
+    const auto it4 = it3*it1;
+
+    // The coefficients k[i] and their derivatives with respect to T (not t, hence the division by Tr)
+    const real k[5] =
+    {
+        1.0,
+        a[1]*it1,
+        a[2]*it1 + a[3] + a[4]*t,
+        a[5]*it1 + a[6]*t + a[7]*t*t,
+        a[8]*it2 + a[9]*it1 + a[10]
+    };
+
+    const real k_T[5] =
+    {
+        0.0,
+        (-a[1]*it2)/Tr,
+        (-a[2]*it2 + a[4])/Tr,
+        (-a[5]*it2 + a[6] + 2*a[7]*t)/Tr,
+        (-2*a[8]*it3 - a[9]*it2)/Tr
+    };
+
+    const real k_TT[5] =
+    {
+        0.0,
+        (2*a[1]*it3)/(Tr*Tr),
+        (2*a[2]*it3)/(Tr*Tr),
+        (2*a[5]*it3 + 2*a[7])/(Tr*Tr),
+        (6*a[8]*it4 + 2*a[9]*it3)/(Tr*Tr)
+    };
+
+    real ri = 1.0; // the power r^i, updated by one multiplication per term
+
+    for(int i = 0; i <= 4; ++i, ri *= r)
     {
-        const auto ri    = pow(r, i);
-        const auto ki    = k[i](t);
-        const auto ki_t  = k_t[i](t)/Tr;
-        const auto ki_tt = k_tt[i](t)/Tr/Tr;
+        const auto& ki    = k[i];
+        const auto& ki_t  = k_T[i];
+        const auto& ki_tt = k_TT[i];
 
         we.epsilon   += ki*ri;
         we.epsilonT  += ri*(ki_t - i*alpha*ki);
         we.epsilonP  += ri*ki*i*beta;
         we.epsilonTT += ri*(ki_tt - i*(alpha*ki_t + ki*alphaT) - i*alpha*(ki_t - i*alpha*ki));
-        we.epsilonTP += ri*ki*i*beta*(ki_t/ki - i*alpha + betaT/beta);
-        we.epsilonPP += ri*ki*i*beta*(i*beta + betaP/beta);
+        we.epsilonTP += ri*i*(beta*ki_t - i*alpha*beta*ki + betaT*ki);
+        we.epsilonPP += ri*ki*i*(i*beta*beta + betaP);
     }
 
     const auto epsilon2 = we.epsilon * we.epsilon;
@@ -18,9 +18,9 @@
 #include "WaterHelmholtzPropsHGK.hpp"
 
 // C++ includes
+#include <array>
 #include <cmath>
 using std::log;
-using std::pow;
 
 // Reaktoro includes
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
@@ -191,25 +191,49 @@ const double A4[] =
     -0.13362857E+1
 };
 
+template<typename T> auto pow2(T const& x) { return x*x; }
+template<typename T> auto pow3(T const& x) { return x*x*x; }
+
+/// Return @p x raised to the non-negative integer power @p n using repeated multiplication.
+template<typename T> auto powi(T const& x, int n) -> T
+{
+    T res = 1.0;
+    for(int k = 0; k < n; ++k)
+        res *= x;
+    return res;
+}
+
+/// The largest exponent of 1/t in the terms of the HGK3 contribution.
+const int lmax = 6;
+
+/// The largest exponent of z in the terms of the HGK3 contribution.
+const int kmax = 9;
+
 auto calculateWaterHelmholtzPropsHGK0(real t, real d) -> WaterHelmholtzProps
 {
     WaterHelmholtzProps s;
 
     const auto ln_t = log(t);
+    const auto it1  = 1.0/t;
+    const auto it2  = it1*it1;
+    const auto it3  = it2*it1;
 
     s.helmholtz    = (A0[0] + A0[1] * t) * ln_t;
-    s.helmholtzT   =  A0[0]/t + A0[1]*(ln_t + 1);
-    s.helmholtzTT  = -A0[0]/(t*t) + A0[1]/t;
-    s.helmholtzTTT =  2*A0[0]/(t*t*t) - A0[1]/(t*t);
+    s.helmholtzT   =  A0[0]*it1 + A0[1]*(ln_t + 1);
+    s.helmholtzTT  = -A0[0]*it2 + A0[1]*it1;
+    s.helmholtzTTT =  2*A0[0]*it3 - A0[1]*it2;
+
+    // The power t^(i - 4), starting at i = 2 and updated by one multiplication per term
+    real tpow = it2;
 
-    for(int i = 2; i <= 17; ++i)
+    for(int i = 2; i <= 17; ++i, tpow *= t)
     {
-        const auto aux = A0[i] * pow(t, i - 4);
+        const auto aux = A0[i] * tpow;
 
         s.helmholtz    += aux;
-        s.helmholtzT   += aux * (i - 4)/t;
-        s.helmholtzTT  += aux * (i - 4)*(i - 5)/(t*t);
-        s.helmholtzTTT += aux * (i - 4)*(i - 5)*(i - 6)/(t*t*t);
+        s.helmholtzT   += aux * (i - 4)*it1;
+        s.helmholtzTT  += aux * (i - 4)*(i - 5)*it2;
+        s.helmholtzTTT += aux * (i - 4)*(i - 5)*(i - 6)*it3;
     }
 
     return s;
@@ -219,19 +243,28 @@ auto calculateWaterHelmholtzPropsHGK1(real t, real d) -> WaterHelmholtzProps
 {
     WaterHelmholtzProps s;
 
-    for(int i = 0; i <= 4; ++i)
+    const auto it1 = 1.0/t;
+    const auto it2 = it1*it1;
+    const auto it3 = it2*it1;
+
+    // The power t^(1 - i), starting at i = 0 and updated by one multiplication per term
+    real tpow = t;
+
+    for(int i = 0; i <= 4; ++i, tpow *= it1)
     {
-        const auto aux = d * A1[i] * pow(t, 1 - i);
+        const auto aux = d * A1[i] * tpow;
 
         s.helmholtz    += aux;
-        s.helmholtzT   -= aux * (i - 1)/t;
-        s.helmholtzTT  += aux * (i - 1)*i/(t*t);
-        s.helmholtzTTT -= aux * (i - 1)*i*(i + 1)/(t*t*t);
+        s.helmholtzT   -= aux * (i - 1)*it1;
+        s.helmholtzTT  += aux * (i - 1)*i*it2;
+        s.helmholtzTTT -= aux * (i - 1)*i*(i + 1)*it3;
     }
 
-    s.helmholtzD   = s.helmholtz/d;
-    s.helmholtzTD  = s.helmholtzT/d;
-    s.helmholtzTTD = s.helmholtzTT/d;
+    const auto id = 1.0/d;
+
+    s.helmholtzD   = s.helmholtz*id;
+    s.helmholtzTD  = s.helmholtzT*id;
+    s.helmholtzTTD = s.helmholtzTT*id;
 
     return s;
 }
@@ -240,8 +273,9 @@ auto calculateWaterHelmholtzPropsHGK2(real t, real d) -> WaterHelmholtzProps
 {
     WaterHelmholtzProps s;
 
-    const auto t3   = pow(t, -3);
-    const auto t5   = pow(t, -5);
+    const auto it1  = 1.0/t;
+    const auto t3   = it1*it1*it1;
+    const auto t5   = t3*it1*it1;
     const auto ln_t = log(t);
 
     const auto y     = d * (yc[0] + yc[1]*ln_t + yc[2]*t3 + yc[3]*t5);
@@ -305,18 +339,43 @@ auto calculateWaterHelmholtzPropsHGK3(real t, real d) -> WaterHelmholtzProps
     const auto z_rr  = -z0 * z_r;
     const auto z_rrr = -z0 * z_rr;
 
+    // The ratios of z and its derivatives shared among all terms
+    const auto it1     = 1.0/t;
+    const auto z_r_z   = z_r/z;
+    const auto z_rr_z  = z_rr/z;
+    const auto z_rr_zr = z_rr/z_r;
+    const auto z_rrrzr = z_rrr/z_r;
+
+    // The integer powers of 1/t and z shared among all terms
+    std::array<real, lmax + 1> itpow;
+    std::array<real, kmax + 1> zpow;
+
+    itpow[0] = 1.0;
+    for(int k = 1; k <= lmax; ++k)
+        itpow[k] = itpow[k - 1] * it1;
+
+    zpow[0] = 1.0;
+    for(int k = 1; k <= kmax; ++k)
+        zpow[k] = zpow[k - 1] * z;
+
     for(int i = 0; i <= 35; ++i)
     {
-        const auto lambda     =  A3[i] * pow(t, -li[i]) * pow(z, ki[i]);
-        const auto lambda_r   =  ki[i]*z_r*lambda/z;
-        const auto lambda_t   = -li[i]*lambda/t;
-        const auto lambda_rr  =  lambda_r*(z_rr/z_r + lambda_r/lambda - z_r/z);
-        const auto lambda_rt  =  lambda_r*lambda_t/lambda;
-        const auto lambda_tt  =  lambda_t*(lambda_t/lambda - 1.0/t);
-        const auto lambda_rrr =  lambda_rr*(z_rr/z_r + lambda_r/lambda - z_r/z) + lambda_r*(z_rrr/z_r - pow(z_rr/z_r, 2) + lambda_rr/lambda - pow(lambda_r/lambda, 2) - z_rr/z + pow(z_r/z, 2));
-        const auto lambda_rrt = -pow(lambda_r/lambda, 2)*lambda_t + (lambda_rr*lambda_t + lambda_rt*lambda_r)/lambda;
-        const auto lambda_rtt = -pow(lambda_t/lambda, 2)*lambda_r + (lambda_tt*lambda_r + lambda_rt*lambda_t)/lambda;
-        const auto lambda_ttt =  lambda_tt * (lambda_t/lambda - 1.0/t) + lambda_t*(lambda_tt/lambda - pow(lambda_t/lambda, 2) + 1.0/(t*t));
+        // The ratios lambda_r/lambda and lambda_t/lambda, which do not depend on A3[i]
+        const auto rr = ki[i]*z_r_z;
+        const auto rt = -li[i]*it1;
+
+        const auto lambda     =  A3[i] * itpow[li[i]] * zpow[ki[i]];
+        const auto lambda_r   =  rr*lambda;
+        const auto lambda_t   =  rt*lambda;
+        const auto lambda_rr  =  lambda_r*(z_rr_zr + rr - z_r_z);
+        const auto lambda_rt  =  lambda_r*rt;
+        const auto lambda_tt  =  lambda_t*(rt - it1);
+        const auto rrr        =  lambda_rr/lambda;
+        const auto rtt        =  lambda_tt/lambda;
+        const auto lambda_rrr =  lambda_rr*(z_rr_zr + rr - z_r_z) + lambda_r*(z_rrrzr - pow2(z_rr_zr) + rrr - pow2(rr) - z_rr_z + pow2(z_r_z));
+        const auto lambda_rrt = -pow2(rr)*lambda_t + lambda_rr*rt + lambda_rt*rr;
+        const auto lambda_rtt = -pow2(rt)*lambda_r + rtt*lambda_r + lambda_rt*rt;
+        const auto lambda_ttt =  lambda_tt * (rt - it1) + lambda_t*(rtt - pow2(rt) + it1*it1);
 
         s.helmholtz    += lambda;
         s.helmholtzD   += lambda_r;
@@ -344,12 +403,13 @@ auto calculateWaterHelmholtzPropsHGK4(real t, real d) -> WaterHelmholtzProps
         const auto delta_r = 1.0/ri[i];
         const auto tau_t   = 1.0/ti[i];
 
-        const auto delta_m = pow(delta, mi[i]);
-        const auto delta_n = pow(delta, ni[i]);
+        const auto delta_m = powi(delta, mi[i]);
+        const auto delta_n = powi(delta, ni[i]);
+        const auto ratio   = delta_r/delta;
 
-        const auto psi    = (ni[i] - alpha[i]*mi[i]*delta_m)*delta_r/delta;
-        const auto psi_r  = -(ni[i] + alpha[i]*mi[i]*(mi[i] - 1)*delta_m)*pow(delta_r/delta, 2);
-        const auto psi_rr = (2*ni[i] - alpha[i]*mi[i]*(mi[i] - 1)*(mi[i] - 2)*delta_m)*pow(delta_r/delta, 3);
+        const auto psi    = (ni[i] - alpha[i]*mi[i]*delta_m)*ratio;
+        const auto psi_r  = -(ni[i] + alpha[i]*mi[i]*(mi[i] - 1)*delta_m)*pow2(ratio);
+        const auto psi_rr = (2*ni[i] - alpha[i]*mi[i]*(mi[i] - 1)*(mi[i] - 2)*delta_m)*pow3(ratio);
 
         const auto theta     =  A4[i]*delta_n*exp(-alpha[i]*delta_m - beta[i]*tau*tau);
         const auto theta_r   =  psi*theta;
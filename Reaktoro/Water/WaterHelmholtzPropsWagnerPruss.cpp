@@ -18,6 +18,7 @@
 #include "WaterHelmholtzPropsWagnerPruss.hpp"
 
 // C++ includes
+#include <array>
 #include <cmath>
 using std::log;
 using std::pow;
@@ -147,6 +148,15 @@ const double E[] = { 0.3, 0.3 };
 template<typename T> auto pow2(T const& x) { return x*x; }
 template<typename T> auto pow3(T const& x) { return x*x*x; }
 
+/// The largest integer exponent of delta in the residual terms.
+const int dmax = 15;
+
+/// The largest integer exponent of tau in the residual terms.
+const int tmax = 50;
+
+/// The largest integer exponent of delta inside the exponentials of the residual terms.
+const int cmax = 6;
+
 } // namespace
 
 auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
@@ -177,6 +187,22 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
         phio_ttt += no[i] * ee * (1 + ee) * pow3((gammao[j]/(ee - 1)));
     }
 
+    // The integer powers of delta and tau, and the exponentials exp(-delta^c), shared among the residual terms
+    std::array<real, dmax + 1> deltapow;
+    std::array<real, tmax + 1> taupow;
+    std::array<real, cmax + 1> expdc;
+
+    deltapow[0] = 1.0;
+    for(int k = 1; k <= dmax; ++k)
+        deltapow[k] = deltapow[k - 1] * delta;
+
+    taupow[0] = 1.0;
+    for(int k = 1; k <= tmax; ++k)
+        taupow[k] = taupow[k - 1] * tau;
+
+    for(int k = 1; k <= cmax; ++k)
+        expdc[k] = exp(-deltapow[k]);
+
     real phir = {};
     real phir_d = {};
     real phir_t = {};
@@ -190,7 +216,7 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
 
     for(int i = 1; i <= 7; ++i)
     {
-        const auto A     = n[i]*pow(delta, d[i])*pow(tau, t[i]);
+        const auto A     = n[i]*deltapow[int(d[i])]*pow(tau, t[i]);
         const auto A_d   = d[i]/delta * A;
         const auto A_t   = t[i]/tau * A;
         const auto A_dd  = (d[i] - 1)/delta * A_d;
@@ -215,9 +241,9 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
 
     for(int i = 8; i <= 51; ++i)
     {
-        const auto dci = pow(delta, c[i]);
+        const auto dci = deltapow[int(c[i])];
 
-        const auto B     =  n[i]*pow(delta, d[i])*pow(tau, t[i])*exp(-dci);
+        const auto B     =  n[i]*deltapow[int(d[i])]*taupow[int(t[i])]*expdc[int(c[i])];
         const auto B_d   = (d[i] - c[i]*dci)/delta * B;
         const auto B_t   =  t[i]/tau * B;
         const auto B_dd  = (d[i] - c[i]*dci - 1)/delta * B_d - dci*pow2(c[i]/delta) * B;
@@ -250,7 +276,7 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
         const auto aux2d = (d[i]/pow2(delta) + 2*alpha[j]);
         const auto aux2t = (t[i]/pow2(tau) + 2*beta[j]);
 
-        const auto C     = n[i]*pow(delta, d[i])*pow(tau, t[i])*exp(-alpha[j]*pow2(delta - epsilon[j]) - beta[j]*pow2(tau - gamma[j]));
+        const auto C     = n[i]*deltapow[int(d[i])]*taupow[int(t[i])]*exp(-alpha[j]*pow2(delta - epsilon[j]) - beta[j]*pow2(tau - gamma[j]));
         const auto C_d   = aux1d * C;
         const auto C_t   = aux1t * C;
         const auto C_dd  = aux1d * C_d - aux2d * C;
@@ -18,7 +18,9 @@
 #include "WaterInterpolation.hpp"
 
 // C++ includes
-#include <sstream>
+#include <array>
+#include <cassert>
+#include <cstdlib>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
@@ -188,6 +190,53 @@ const Vec<Vec<double>> densities_vapor =
     { 1.237391e+03, 1.234940e+03, 1.232378e+03, 1.229829e+03, 1.227295e+03, 1.224773e+03, 1.222265e+03, 1.219768e+03, 1.217282e+03, 1.214806e+03, 1.212339e+03, 1.209879e+03, 1.207427e+03, 1.204981e+03, 1.202540e+03, 1.200104e+03, 1.197672e+03, 1.195242e+03, 1.192815e+03, 1.190390e+03, 1.187967e+03, 1.183123e+03, 1.178281e+03, 1.173440e+03, 1.168598e+03, 1.163755e+03, 1.158910e+03, 1.154064e+03, 1.149216e+03, 1.144368e+03, 1.139520e+03, 1.134673e+03, 1.129827e+03, 1.124984e+03, 1.120143e+03, 1.115307e+03, 1.110475e+03, 1.105649e+03, 1.100829e+03, 1.096017e+03, 1.091213e+03, 1.086416e+03, 1.081630e+03, 1.076854e+03, 1.072088e+03, 1.067334e+03, 1.055502e+03, 1.043755e+03, 1.032100e+03, 1.020544e+03, 1.009096e+03, 9.977622e+02, 9.865466e+02, 9.754563e+02, 9.536690e+02, 9.324319e+02, 9.117666e+02, 8.916878e+02, 8.722007e+02, 8.533039e+02, 8.349913e+02, 8.172513e+02, 8.092803e+02 },
 };
 
+namespace {
+
+/// Calculate the weights *w0*, *w1* and *w2* of a quadratic interpolation at *x* with given points *x0*, *x1* and *x2* so that *y = w0*y0 + w1*y1 + w2*y2*.
+/// This is consistent with @ref interpolateQuadratic, including its fallback to linear interpolation when *x0 == x1* or *x1 == x2*.
+auto interpolateQuadraticWeights(real const& x, double x0, double x1, double x2) -> std::array<real, 3>
+{
+    assert(x0 <= x1 && x1 <= x2);
+    if(x0 == x2) return { 1.0, 0.0, 0.0 };
+    if(x0 == x1 || x1 == x2)
+    {
+        const real w2 = (x - x0)/(x2 - x0);
+        return { 1.0 - w2, 0.0, w2 };
+    }
+    const real l0 = ((x - x1)*(x - x2))/((x0 - x1)*(x0 - x2));
+    const real l1 = ((x - x0)*(x - x2))/((x1 - x0)*(x1 - x2));
+    const real l2 = ((x - x0)*(x - x1))/((x2 - x0)*(x2 - x1));
+    return { l0, l1, l2 };
+}
+
+/// Add the thermodynamic properties of water in *y* scaled by *w* to those in *res*.
+auto addScaled(WaterThermoProps& res, real const& w, WaterThermoProps const& y) -> void
+{
+    res.T   += w * y.T;
+    res.V   += w * y.V;
+    res.S   += w * y.S;
+    res.A   += w * y.A;
+    res.U   += w * y.U;
+    res.H   += w * y.H;
+    res.G   += w * y.G;
+    res.Cv  += w * y.Cv;
+    res.Cp  += w * y.Cp;
+    res.D   += w * y.D;
+    res.DT  += w * y.DT;
+    res.DP  += w * y.DP;
+    res.DTT += w * y.DTT;
+    res.DTP += w * y.DTP;
+    res.DPP += w * y.DPP;
+    res.P   += w * y.P;
+    res.PT  += w * y.PT;
+    res.PD  += w * y.PD;
+    res.PTT += w * y.PTT;
+    res.PTD += w * y.PTD;
+    res.PDD += w * y.PDD;
+}
+
+} // namespace
+
 auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter som) -> real
 {
     errorif(T <= 0.0, "Unable to interpolate water density at ", T, " K and ", P, " Pa because of zero or negative temperature.");
@@ -242,46 +291,57 @@ auto parseWaterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<Wa
 {
     // TODO: Use som here to distinguish different data files to fetch interpolation data. This data must be regenerated for liquid and vapor states.
     const auto text = Embedded::get("interpolation/WaterThermoPropsWagnerPruss.txt");
-    std::istringstream file(text);
-    String line;
 
     Vec<Vec<WaterThermoProps>> data;
 
-    while(std::getline(file, line))
+    // Parse the numbers in the text directly with strtod instead of a string stream for each line
+    const char* ptr = text.c_str();
+    char* end = nullptr;
+
+    auto next = [&]() { const auto value = std::strtod(ptr, &end); ptr = end; return value; };
+
+    while(*ptr)
     {
-        if(line[0] == 'P')
+        if(*ptr == '\n' || *ptr == '\r' || *ptr == ' ' || *ptr == '\t')
+        {
+            ++ptr;
+        }
+        else if(*ptr == 'P')
         {
             data.push_back(Vec<WaterThermoProps>());
+            while(*ptr && *ptr != '\n')
+                ++ptr;
         }
         else
         {
-            std::istringstream ss(line);
-
             WaterThermoProps props;
 
-            ss >> props.T.val()
-               >> props.V.val()
-               >> props.S.val()
-               >> props.A.val()
-               >> props.U.val()
-               >> props.H.val()
-               >> props.G.val()
-               >> props.Cv.val()
-               >> props.Cp.val()
-               >> props.D.val()
-               >> props.DT.val()
-               >> props.DP.val()
-               >> props.DTT.val()
-               >> props.DTP.val()
-               >> props.DPP.val()
-               >> props.P.val()
-               >> props.PT.val()
-               >> props.PD.val()
-               >> props.PTT.val()
-               >> props.PTD.val()
-               >> props.PDD.val();
+            props.T.val()   = next();
+            props.V.val()   = next();
+            props.S.val()   = next();
+            props.A.val()   = next();
+            props.U.val()   = next();
+            props.H.val()   = next();
+            props.G.val()   = next();
+            props.Cv.val()  = next();
+            props.Cp.val()  = next();
+            props.D.val()   = next();
+            props.DT.val()  = next();
+            props.DP.val()  = next();
+            props.DTT.val() = next();
+            props.DTP.val() = next();
+            props.DPP.val() = next();
+            props.P.val()   = next();
+            props.PT.val()  = next();
+            props.PD.val()  = next();
+            props.PTT.val() = next();
+            props.PTD.val() = next();
+            props.PDD.val() = next();
 
             data.back().push_back(props);
+
+            while(*ptr && *ptr != '\n')
+                ++ptr;
         }
     }
 
@@ -290,7 +350,7 @@ auto parseWaterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<Wa
 
 auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&
 {
-    thread_local Vec<Vec<WaterThermoProps>> data = parseWaterThermoPropsWagnerPrussInterpData(som);
+    static const Vec<Vec<WaterThermoProps>> data = parseWaterThermoPropsWagnerPrussInterpData(som);
     return data;
 }
 
@@ -310,7 +370,17 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
 
     auto const& data = waterThermoPropsWagnerPrussInterpData(som);
 
-    auto interpolateAtT = [&](Index indexP)
+    const auto P0 = pressures[iP0];
+    const auto P1 = pressures[iP1];
+    const auto P2 = pressures[iP2];
+
+    // The weights of the quadratic interpolation along pressure
+    const auto wP = interpolateQuadraticWeights(PMPa, P0, P1, P2);
+
+    WaterThermoProps res;
+
+    // Add the contribution of the interpolation along temperature at given pressure row, scaled by its weight along pressure
+    auto addInterpolatedAtT = [&](Index indexP, real const& weightP)
     {
         auto const& Ts = temperatures[indexP];
         auto const& Ds = data[indexP];
@@ -325,18 +395,19 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
         const Index iT1 = iT0 + 1;
         const Index iT2 = iT0 + 2;
 
-        return interpolateQuadratic(T, Ts[iT0], Ts[iT1], Ts[iT2], Ds[iT0], Ds[iT1], Ds[iT2]);
-    };
+        const auto wT = interpolateQuadraticWeights(T, Ts[iT0], Ts[iT1], Ts[iT2]);
 
-    const auto P0 = pressures[iP0];
-    const auto P1 = pressures[iP1];
-    const auto P2 = pressures[iP2];
+        addScaled(res, weightP * wT[0], Ds[iT0]);
+        addScaled(res, weightP * wT[1], Ds[iT1]);
+        addScaled(res, weightP * wT[2], Ds[iT2]);
+    };
 
-    const auto D0 = interpolateAtT(iP0); // density at T and P=P0
-    const auto D1 = interpolateAtT(iP1); // density at T and P=P1
-    const auto D2 = interpolateAtT(iP2); // density at T and P=P2
+    // Accumulate all interpolated properties in one pass over the nine interpolation points
+    addInterpolatedAtT(iP0, wP[0]);
+    addInterpolatedAtT(iP1, wP[1]);
+    addInterpolatedAtT(iP2, wP[2]);
 
-    return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
+    return res;
 }
 
 } // namespace Reaktoro
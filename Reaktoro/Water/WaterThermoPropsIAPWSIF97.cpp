@@ -0,0 +1,388 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "WaterThermoPropsIAPWSIF97.hpp"
+
+// C++ includes
+#include <array>
+#include <cmath>
+using std::log;
+using std::pow;
+using std::sqrt;
+
+// Reaktoro includes
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// The specific gas constant of water in IAPWS-IF97 in units of J/(kg*K)
+const auto R = 461.526;
+
+// The reducing pressure of region 1 in units of Pa
+const auto referencePressureRegion1 = 16.53e+06;
+
+// The reducing temperature of region 1 in units of K
+const auto referenceTemperatureRegion1 = 1386.0;
+
+// The reducing pressure of region 2 in units of Pa
+const auto referencePressureRegion2 = 1.0e+06;
+
+// The reducing temperature of region 2 in units of K
+const auto referenceTemperatureRegion2 = 540.0;
+
+// The temperature above which regions 1 and 2 are separated by region 3 instead of the saturation line in units of K
+const auto temperatureBoundaryRegion13 = 623.15;
+
+// The maximum temperature of region 2 in units of K
+const auto temperatureMaxRegion2 = 1073.15;
+
+// The maximum pressure of regions 1 and 2 in units of Pa
+const auto pressureMax = 100.0e+06;
+
+// The coefficients of the dimensionless Gibbs free energy of region 1 (Table 2 of IAPWS-IF97)
+const int I1[] =
+{
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   1,   1,   1,   1,   1,   2,   2,
+      2,   2,   2,   3,   3,   3,   4,   4,
+      4,   5,   8,   8,  21,  23,  29,  30,
+     31,  32
+};
+
+const int J1[] =
+{
+     -2,  -1,   0,   1,   2,   3,   4,   5,
+     -9,  -7,  -1,   0,   1,   3,  -3,   0,
+      1,   3,  17,  -4,   0,   6,  -5,  -2,
+     10,  -8, -11,  -6, -29, -31, -38, -39,
+    -40, -41
+};
+
+const double n1[] =
+{
+     1.46329712131670E-01,
+    -8.45481871691140E-01,
+    -3.75636036720400E+00,
+     3.38551691683850E+00,
+    -9.57919633878720E-01,
+     1.57720385132280E-01,
+    -1.66164171995010E-02,
+     8.12146299835680E-04,
+     2.83190801238040E-04,
+    -6.07063015658740E-04,
+    -1.89900682184190E-02,
+    -3.25297487705050E-02,
+    -2.18417171754140E-02,
+    -5.28383579699300E-05,
+    -4.71843210732670E-04,
+    -3.00017807930260E-04,
+     4.76613939069870E-05,
+    -4.41418453308460E-06,
+    -7.26949962975940E-16,
+    -3.16796448450540E-05,
+    -2.82707979853120E-06,
+    -8.52051281201030E-10,
+    -2.24252819080000E-06,
+    -6.51712228956010E-07,
+    -1.43405298298300E-13,
+    -4.05169968601170E-07,
+    -1.27343017416410E-09,
+    -1.74248712306340E-10,
+    -6.87621312955310E-19,
+     1.44783078285210E-20,
+     2.63357816627950E-23,
+    -1.19476226400710E-23,
+     1.82280945814040E-24,
+    -9.35370872924580E-26
+};
+
+// The coefficients of the ideal-gas part of the dimensionless Gibbs free energy of region 2 (Table 10 of IAPWS-IF97)
+const int J0[] =
+{
+      0,   1,  -5,  -4,  -3,  -2,  -1,   2,
+      3
+};
+
+const double n0[] =
+{
+    -9.69276865002170E+00,
+     1.00866559680180E+01,
+    -5.60879112830200E-03,
+     7.14527380814550E-02,
+    -4.07104982239280E-01,
+     1.42408191714440E+00,
+    -4.38395113194500E+00,
+    -2.84086324607720E-01,
+     2.12684637533070E-02
+};
+
+// The coefficients of the residual part of the dimensionless Gibbs free energy of region 2 (Table 11 of IAPWS-IF97)
+const int Ir[] =
+{
+      1,   1,   1,   1,   1,   2,   2,   2,
+      2,   2,   3,   3,   3,   3,   3,   4,
+      4,   4,   5,   6,   6,   6,   7,   7,
+      7,   8,   8,   9,  10,  10,  10,  16,
+     16,  18,  20,  20,  20,  21,  22,  23,
+     24,  24,  24
+};
+
+const int Jr[] =
+{
+      0,   1,   2,   3,   6,   1,   2,   4,
+      7,  36,   0,   1,   3,   6,  35,   1,
+      2,   3,   7,   3,  16,  35,   0,  11,
+     25,   8,  36,  13,   4,  10,  14,  29,
+     50,  57,  20,  35,  48,  21,  53,  39,
+     26,  40,  58
+};
+
+const double nr[] =
+{
+    -1.77317424732130E-03,
+    -1.78348622923580E-02,
+    -4.59960136963650E-02,
+    -5.75812590834320E-02,
+    -5.03252787279300E-02,
+    -3.30326416702030E-05,
+    -1.89489875163150E-04,
+    -3.93927772433550E-03,
+    -4.37972956505730E-02,
+    -2.66745479140870E-05,
+     2.04817376923090E-08,
+     4.38706672844350E-07,
+    -3.22776772385700E-05,
+    -1.50339245421480E-03,
+    -4.06682535626490E-02,
+    -7.88473095593670E-10,
+     1.27907178522850E-08,
+     4.82253727185070E-07,
+     2.29220763376610E-06,
+    -1.67147664510610E-11,
+    -2.11714723213550E-03,
+    -2.38957419341040E+01,
+    -5.90595643242700E-18,
+    -1.26218088991010E-06,
+    -3.89468424357390E-02,
+     1.12562113604590E-11,
+    -8.23113408979980E+00,
+     1.98097128020880E-08,
+     1.04069652101740E-19,
+    -1.02347470959290E-13,
+    -1.00181793795110E-09,
+    -8.08829086469850E-11,
+     1.06930318794090E-01,
+    -3.36622505741710E-01,
+     8.91858453554210E-25,
+     3.06293168762320E-13,
+    -4.20024676982080E-06,
+    -5.90560296856390E-26,
+     3.78269476134570E-06,
+    -1.27686089346810E-15,
+     7.30876105950610E-29,
+     5.54147153507780E-17,
+    -9.43697072412100E-07
+};
+
+// The coefficients of the saturation-pressure equation (Table 34 of IAPWS-IF97)
+const double ns[] =
+{
+     1.16705214527670E+03,
+    -7.24213167032060E+05,
+    -1.70738469400920E+01,
+     1.20208247024700E+04,
+    -3.23255503223330E+06,
+     1.49151086135300E+01,
+    -4.82326573615910E+03,
+     4.05113405420570E+05,
+    -2.38555575678490E-01,
+     6.50175348447980E+02
+};
+
+// The coefficients of the boundary equation between regions 2 and 3 (Table 1 of IAPWS-IF97)
+const double nb[] =
+{
+     3.48051856289690E+02,
+    -1.16718598799750E+00,
+     1.01929700393260E-03
+};
+
+/// The dimensionless Gibbs free energy *γ(π, τ)* and its partial derivatives, with `gamma[k][m]` denoting the derivative of order *k* in *π* and order *m* in *τ*.
+using GibbsDerivatives = std::array<std::array<real, 3>, 4>;
+
+/// Return the falling factorial *n(n - 1)...(n - k + 1)* used in the derivatives of the power terms.
+auto fallingFactorial(int n, int k) -> double
+{
+    double res = 1.0;
+    for(auto i = 0; i < k; ++i)
+        res *= n - i;
+    return res;
+}
+
+/// Add to @p gamma the contribution of the power term *c·a^I·b^J*, where *a* and *b* are linear in *π* and *τ* with slopes @p sa and 1.
+auto addPowerTerm(GibbsDerivatives& gamma, double c, real const& a, int I, double sa, real const& b, int J) -> void
+{
+    for(auto k = 0; k < 4; ++k)
+    {
+        const auto ck = c * fallingFactorial(I, k) * (k % 2 == 1 ? sa : 1.0);
+        if(ck == 0.0) break;
+        const real ak = pow(a, I - k);
+        for(auto m = 0; m < 3 && k + m < 4; ++m)
+        {
+            const auto ckm = ck * fallingFactorial(J, m);
+            if(ckm == 0.0) break;
+            gamma[k][m] += ckm * ak * pow(b, J - m);
+        }
+    }
+}
+
+/// Compute the dimensionless Gibbs free energy of region 1 (compressed liquid) and its partial derivatives.
+auto gibbsDerivativesRegion1(real const& pi, real const& tau) -> GibbsDerivatives
+{
+    GibbsDerivatives gamma = {};
+    const real a = 7.1 - pi;
+    const real b = tau - 1.222;
+    for(auto i = 0; i < 34; ++i)
+        addPowerTerm(gamma, n1[i], a, I1[i], -1.0, b, J1[i]);
+    return gamma;
+}
+
+/// Compute the dimensionless Gibbs free energy of region 2 (superheated vapour) and its partial derivatives.
+auto gibbsDerivativesRegion2(real const& pi, real const& tau) -> GibbsDerivatives
+{
+    GibbsDerivatives gamma = {};
+
+    // The residual part
+    const real b = tau - 0.5;
+    for(auto i = 0; i < 43; ++i)
+        addPowerTerm(gamma, nr[i], pi, Ir[i], 1.0, b, Jr[i]);
+
+    // The ideal-gas part
+    gamma[0][0] += log(pi);
+    gamma[1][0] += 1.0/pi;
+    gamma[2][0] += -1.0/(pi*pi);
+    gamma[3][0] += 2.0/(pi*pi*pi);
+    for(auto i = 0; i < 9; ++i)
+        for(auto m = 0; m < 3; ++m)
+            gamma[0][m] += n0[i] * fallingFactorial(J0[i], m) * pow(tau, J0[i] - m);
+
+    return gamma;
+}
+
+/// Compute the thermodynamic properties of water from the dimensionless Gibbs free energy *γ(π, τ)* with *π = P/Pr* and *τ = Tr/T*.
+auto waterThermoPropsFromGibbs(real const& T, real const& P, double Pr, real const& tau, GibbsDerivatives const& gamma) -> WaterThermoProps
+{
+    const auto& g    = gamma[0][0];
+    const auto& gp   = gamma[1][0];
+    const auto& gpp  = gamma[2][0];
+    const auto& gppp = gamma[3][0];
+    const auto& gt   = gamma[0][1];
+    const auto& gtt  = gamma[0][2];
+    const auto& gpt  = gamma[1][1];
+    const auto& gppt = gamma[2][1];
+    const auto& gptt = gamma[1][2];
+
+    // The specific volume and its partial derivatives with respect to T and P
+    const real V   = R*T*gp/Pr;
+    const real VT  = R/Pr*(gp - tau*gpt);
+    const real VP  = R*T*gpp/(Pr*Pr);
+    const real VTT = R/Pr*tau*tau*gptt/T;
+    const real VTP = R/(Pr*Pr)*(gpp - tau*gppt);
+    const real VPP = R*T*gppp/(Pr*Pr*Pr);
+
+    WaterThermoProps wt;
+
+    wt.T = T;
+    wt.P = P;
+    wt.V = V;
+
+    // Set the density and its partial derivatives from those of the specific volume
+    wt.D   = 1.0/V;
+    wt.DT  = -VT/(V*V);
+    wt.DP  = -VP/(V*V);
+    wt.DTT = -VTT/(V*V) + 2.0*VT*VT/(V*V*V);
+    wt.DTP = -VTP/(V*V) + 2.0*VT*VP/(V*V*V);
+    wt.DPP = -VPP/(V*V) + 2.0*VP*VP/(V*V*V);
+
+    // Set the partial derivatives of pressure at constant density or temperature (inverting the relations used in waterThermoProps)
+    wt.PD  = 1.0/wt.DP;
+    wt.PT  = -wt.DT/wt.DP;
+    wt.PDD = -wt.DPP/(wt.DP*wt.DP*wt.DP);
+    wt.PTD = -wt.DTP/(wt.DP*wt.DP) - wt.DT*wt.PDD;
+    wt.PTT = -(wt.DTT + wt.DT*wt.DT*wt.DP*wt.PDD + 2.0*wt.DT*wt.DP*wt.PTD)/wt.DP;
+
+    // Set the specific energies, entropy and heat capacities
+    wt.G  = R*T*g;
+    wt.S  = R*(tau*gt - g);
+    wt.H  = R*T*tau*gt;
+    wt.U  = wt.H - P*V;
+    wt.A  = wt.U - T*wt.S;
+    wt.Cp = -R*tau*tau*gtt;
+    wt.Cv = wt.Cp + T*VT*VT/VP;
+
+    return wt;
+}
+
+} // namespace
+
+auto waterSaturationPressureIAPWSIF97(real const& T) -> real
+{
+    const real theta = T + ns[8]/(T - ns[9]);
+    const real A = theta*theta + ns[0]*theta + ns[1];
+    const real B = ns[2]*theta*theta + ns[3]*theta + ns[4];
+    const real C = ns[5]*theta*theta + ns[6]*theta + ns[7];
+    const real aux = 2.0*C/(-B + sqrt(B*B - 4.0*A*C));
+    return aux*aux*aux*aux * 1.0e+06;
+}
+
+auto waterThermoPropsIAPWSIF97(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
+{
+    // Use the Wagner and Pruss (1995) equation of state where neither region 1 nor region 2 applies (e.g., region 3 around the critical point)
+    if(T > temperatureMaxRegion2 || P > pressureMax)
+        return waterThermoPropsWagnerPruss(T, P, som);
+
+    auto liquid = false;
+
+    if(T <= temperatureBoundaryRegion13)
+    {
+        // The state of matter of water, when specified, selects the region, so that metastable states beyond the saturation line are allowed
+        if(som == StateOfMatter::Liquid) liquid = true;
+        else if(som == StateOfMatter::Gas) liquid = false;
+        else liquid = P >= waterSaturationPressureIAPWSIF97(T);
+    }
+    else
+    {
+        const real Pb23 = (nb[0] + nb[1]*T + nb[2]*T*T) * 1.0e+06;
+        if(P > Pb23)
+            return waterThermoPropsWagnerPruss(T, P, som);
+    }
+
+    if(liquid)
+    {
+        const real pi = P/referencePressureRegion1;
+        const real tau = referenceTemperatureRegion1/T;
+        return waterThermoPropsFromGibbs(T, P, referencePressureRegion1, tau, gibbsDerivativesRegion1(pi, tau));
+    }
+
+    const real pi = P/referencePressureRegion2;
+    const real tau = referenceTemperatureRegion2/T;
+    return waterThermoPropsFromGibbs(T, P, referencePressureRegion2, tau, gibbsDerivativesRegion2(pi, tau));
+}
+
+} // namespace Reaktoro
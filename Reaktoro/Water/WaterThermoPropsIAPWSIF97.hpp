@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Core/StateOfMatter.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+struct WaterThermoProps;
+
+/// Calculate the thermodynamic properties of water using the IAPWS Industrial Formulation 1997 (IAPWS-IF97).
+/// The properties are computed with the Gibbs free energy equations of
+/// regions 1 (liquid) and 2 (vapour) of IAPWS-IF97, which are explicit in
+/// temperature and pressure, so that no iterative calculation of density is
+/// needed as in @ref waterThermoPropsWagnerPruss and @ref waterThermoPropsHGK.
+/// Below 623.15 K, the region is selected with the given state of matter,
+/// or with the saturation pressure when this is neither liquid nor gas.
+/// In the conditions covered by neither of these two regions (e.g., region 3
+/// around the critical point), the properties are computed with @ref
+/// waterThermoPropsWagnerPruss instead.
+/// **References:**
+/// - Wagner, W. et al. (2000). The IAPWS Industrial Formulation 1997 for the
+///   Thermodynamic Properties of Water and Steam. Journal of Engineering for
+///   Gas Turbines and Power, 122(1), 150–184. [doi](https://doi.org/10.1115/1.483186)
+/// @param T The temperature of water (in units of K)
+/// @param P The pressure of water (in units of Pa)
+/// @param som The desired state of matter for water (the actual state of matter may end up being different!)
+/// @return The thermodynamic state of water
+/// @see WaterThermoProps
+auto waterThermoPropsIAPWSIF97(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
+
+/// Calculate the saturation pressure of water using the IAPWS Industrial Formulation 1997 (IAPWS-IF97).
+/// @param T The temperature of water (in K)
+/// @return The saturation pressure of water (in Pa)
+auto waterSaturationPressureIAPWSIF97(real const& T) -> real;
+
+} // namespace Reaktoro
@@ -0,0 +1,30 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsIAPWSIF97.hpp>
+using namespace Reaktoro;
+
+void exportWaterThermoPropsIAPWSIF97(py::module& m)
+{
+    m.def("waterThermoPropsIAPWSIF97", waterThermoPropsIAPWSIF97, "Calculate the thermodynamic properties of water using the IAPWS Industrial Formulation 1997.");
+    m.def("waterSaturationPressureIAPWSIF97", waterSaturationPressureIAPWSIF97, "Calculate the saturation pressure of water using the IAPWS Industrial Formulation 1997.");
+}
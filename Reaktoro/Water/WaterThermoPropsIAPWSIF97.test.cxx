@@ -0,0 +1,137 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsIAPWSIF97.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing waterThermoPropsIAPWSIF97", "[WaterThermoPropsIAPWSIF97]")
+{
+    // The values below are from the verification tables of the IAPWS-IF97 release (Tables 5, 15 and 35)
+
+    SECTION("Region 1")
+    {
+        auto wtp = waterThermoPropsIAPWSIF97(300.0, 3.0e+06, StateOfMatter::Liquid);
+
+        CHECK( wtp.V.val()  == Approx(0.100215168e-2) );
+        CHECK( wtp.H.val()  == Approx(0.115331273e+6) );
+        CHECK( wtp.S.val()  == Approx(0.392294792e+3) );
+        CHECK( wtp.Cp.val() == Approx(0.417301218e+4) );
+
+        wtp = waterThermoPropsIAPWSIF97(500.0, 3.0e+06, StateOfMatter::Liquid);
+
+        CHECK( wtp.V.val()  == Approx(0.120241800e-2) );
+        CHECK( wtp.H.val()  == Approx(0.975542239e+6) );
+        CHECK( wtp.S.val()  == Approx(0.258041912e+4) );
+        CHECK( wtp.Cp.val() == Approx(0.465580682e+4) );
+    }
+
+    SECTION("Region 2")
+    {
+        auto wtp = waterThermoPropsIAPWSIF97(300.0, 3.5e+03, StateOfMatter::Gas);
+
+        CHECK( wtp.V.val()  == Approx(0.394913866e+2) );
+        CHECK( wtp.H.val()  == Approx(0.254991145e+7) );
+        CHECK( wtp.S.val()  == Approx(0.852238967e+4) );
+        CHECK( wtp.Cp.val() == Approx(0.191300162e+4) );
+
+        wtp = waterThermoPropsIAPWSIF97(700.0, 30.0e+06, StateOfMatter::Gas);
+
+        CHECK( wtp.V.val()  == Approx(0.542946619e-2) );
+        CHECK( wtp.H.val()  == Approx(0.263149474e+7) );
+        CHECK( wtp.S.val()  == Approx(0.517540298e+4) );
+        CHECK( wtp.Cp.val() == Approx(0.103505092e+5) );
+    }
+
+    SECTION("Saturation pressure")
+    {
+        CHECK( waterSaturationPressureIAPWSIF97(300.0) == Approx(0.353658941e+4) );
+        CHECK( waterSaturationPressureIAPWSIF97(500.0) == Approx(0.263889776e+7) );
+        CHECK( waterSaturationPressureIAPWSIF97(600.0) == Approx(0.123443146e+8) );
+    }
+
+    SECTION("Region selected with the saturation pressure when the state of matter is unspecified")
+    {
+        const auto liquid = waterThermoPropsIAPWSIF97(300.0, 3.6e+03, StateOfMatter::Unspecified);
+        const auto vapour = waterThermoPropsIAPWSIF97(300.0, 3.5e+03, StateOfMatter::Unspecified);
+
+        CHECK( liquid.D.val() > 990.0 );
+        CHECK( vapour.D.val() < 1.0 );
+    }
+
+    SECTION("Agreement with the Wagner and Pruss (1995) equation of state")
+    {
+        for(auto T : { 298.15, 373.15, 473.15, 573.15 })
+        {
+            for(auto P : { 1.0e+05, 10.0e+06, 50.0e+06 })
+            {
+                if(P < waterSaturationPressureIAPWSIF97(T))
+                    continue;
+
+                const auto actual = waterThermoPropsIAPWSIF97(T, P, StateOfMatter::Liquid);
+                const auto expected = waterThermoPropsWagnerPruss(T, P, StateOfMatter::Liquid);
+
+                CHECK( actual.D.val()  == Approx(expected.D.val()).epsilon(1e-3) );
+                CHECK( actual.H.val()  == Approx(expected.H.val()).epsilon(1e-2) );
+                CHECK( actual.Cp.val() == Approx(expected.Cp.val()).epsilon(1e-2) );
+            }
+        }
+    }
+
+    SECTION("Consistency of the partial derivatives of density")
+    {
+        real T = 350.0;
+        real P = 5.0e+06;
+
+        autodiff::seed(T);
+        auto wtp = waterThermoPropsIAPWSIF97(T, P, StateOfMatter::Liquid);
+        autodiff::unseed(T);
+
+        CHECK( autodiff::grad(wtp.D) == Approx(wtp.DT.val()) );
+        CHECK( autodiff::grad(wtp.DT) == Approx(wtp.DTT.val()) );
+        CHECK( autodiff::grad(wtp.DP) == Approx(wtp.DTP.val()) );
+
+        autodiff::seed(P);
+        wtp = waterThermoPropsIAPWSIF97(T, P, StateOfMatter::Liquid);
+        autodiff::unseed(P);
+
+        CHECK( autodiff::grad(wtp.D) == Approx(wtp.DP.val()) );
+        CHECK( autodiff::grad(wtp.DP) == Approx(wtp.DPP.val()) );
+    }
+
+    SECTION("Fallback to the Wagner and Pruss (1995) equation of state outside regions 1 and 2")
+    {
+        const auto actual = waterThermoPropsIAPWSIF97(650.0, 30.0e+06, StateOfMatter::Liquid);
+        const auto expected = waterThermoPropsWagnerPruss(650.0, 30.0e+06, StateOfMatter::Liquid);
+
+        CHECK( actual.D.val() == Approx(expected.D.val()) );
+    }
+
+    SECTION("Selection of the equation of state with waterThermoPropsMemoized")
+    {
+        const auto actual = waterThermoPropsMemoized(298.15, 1.0e+05, StateOfMatter::Liquid, WaterThermoPropsModel::IAPWSIF97);
+        const auto expected = waterThermoPropsIAPWSIF97(298.15, 1.0e+05, StateOfMatter::Liquid);
+
+        CHECK( actual.D.val() == Approx(expected.D.val()) );
+        CHECK( actual.D.val() == Approx(997.047).epsilon(1e-6) );
+    }
+}
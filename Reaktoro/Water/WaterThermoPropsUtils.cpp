@@ -29,11 +29,15 @@ using std::sqrt;
 #include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
 #include <Reaktoro/Water/WaterInterpolation.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsIAPWSIF97.hpp>
 #include <Reaktoro/Water/WaterUtils.hpp>
 
 namespace Reaktoro {
 namespace {
 
+/// The number of distinct temperature and pressure conditions whose water properties are cached in each thread.
+const auto cachesize = 4;
+
 /// Return a memoized function that computes thermodynamic properties of water using HGK (1984) model.
 auto createMemoizedWaterThermoPropsFnHGK()
 {
@@ -41,7 +45,7 @@ auto createMemoizedWaterThermoPropsFnHGK()
     {
         return waterThermoPropsHGK(T, P, som);
     };
-    return memoizeLast(fn);
+    return memoizeLRU(fn, cachesize);
 }
 
 /// Return a memoized function that computes thermodynamic properties of water using Wagner & Pruss (1999) model.
@@ -51,7 +55,7 @@ auto createMemoizedWaterThermoPropsFnWagnerPruss()
     {
         return waterThermoPropsWagnerPruss(T, P, som);
     };
-    return memoizeLast(fn);
+    return memoizeLRU(fn, cachesize);
 }
 
 /// Return a memoized function that computes thermodynamic properties of water using interpolation on Wagner & Pruss (1999) pre-computed properties.
@@ -61,7 +65,17 @@ auto createMemoizedWaterThermoPropsFnWagnerPrussInterp()
     {
         return waterThermoPropsWagnerPrussInterp(T, P, som);
     };
-    return memoizeLast(fn);
+    return memoizeLRU(fn, cachesize);
+}
+
+/// Return a memoized function that computes thermodynamic properties of water using IAPWS-IF97 model.
+auto createMemoizedWaterThermoPropsFnIAPWSIF97()
+{
+    Fn<WaterThermoProps(real const&, real const&, StateOfMatter)> fn = [](real const& T, real const& P, StateOfMatter som)
+    {
+        return waterThermoPropsIAPWSIF97(T, P, som);
+    };
+    return memoizeLRU(fn, cachesize);
 }
 
 } // namespace
@@ -98,6 +112,23 @@ auto waterThermoPropsWagnerPrussInterpMemoized(real const& T, real const& P, Sta
     return fn(T, P, som);
 }
 
+auto waterThermoPropsIAPWSIF97Memoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
+{
+    static thread_local auto fn = createMemoizedWaterThermoPropsFnIAPWSIF97();
+    return fn(T, P, som);
+}
+
+auto waterThermoPropsMemoized(real const& T, real const& P, StateOfMatter som, WaterThermoPropsModel model) -> WaterThermoProps
+{
+    switch(model)
+    {
+    case WaterThermoPropsModel::WagnerPrussInterp: return waterThermoPropsWagnerPrussInterpMemoized(T, P, som);
+    case WaterThermoPropsModel::HGK:               return waterThermoPropsHGKMemoized(T, P, som);
+    case WaterThermoPropsModel::IAPWSIF97:         return waterThermoPropsIAPWSIF97Memoized(T, P, som);
+    default:                                       return waterThermoPropsWagnerPrussMemoized(T, P, som);
+    }
+}
+
 auto waterThermoProps(real const& T, real const& P, WaterHelmholtzProps const& whp) -> WaterThermoProps
 {
     WaterThermoProps wt;
@@ -27,6 +27,15 @@ namespace Reaktoro {
 struct WaterThermoProps;
 struct WaterHelmholtzProps;
 
+/// The equations of state available for calculating the thermodynamic properties of water.
+enum class WaterThermoPropsModel
+{
+    WagnerPruss,       ///< the Wagner and Pruss (1995) equation of state (IAPWS-95)
+    WagnerPrussInterp, ///< the interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state
+    HGK,               ///< the Haar-Gallagher-Kell (1984) equation of state
+    IAPWSIF97,         ///< the IAPWS Industrial Formulation 1997 (explicit in temperature and pressure)
+};
+
 /// Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.
 /// **References:**
 /// - Haar, L., Gallagher, J. S., Kell, G. S. (1984). NBS/NRC Steam Tables: Thermodynamic and
@@ -66,6 +75,20 @@ auto waterThermoPropsWagnerPrussMemoized(real const& T, real const& P, StateOfMa
 /// in its last invocation. The cached result will be returned, thus improving performance.
 auto waterThermoPropsWagnerPrussInterpMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
 
+/// Calculate the thermodynamic properties of water using the IAPWS Industrial Formulation 1997 (see @ref waterThermoPropsIAPWSIF97).
+/// @note This function will skip the computation if given arguments are the same as
+/// in its last invocation. The cached result will be returned, thus improving performance.
+auto waterThermoPropsIAPWSIF97Memoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
+
+/// Calculate the thermodynamic properties of water using a chosen equation of state.
+/// @note This function will skip the computation if given arguments are the same as
+/// in its last invocation. The cached result will be returned, thus improving performance.
+/// @param T The temperature of water (in units of K)
+/// @param P The pressure of water (in units of Pa)
+/// @param som The desired state of matter for water (the actual state of matter may end up being different!)
+/// @param model The equation of state used to calculate the properties of water
+auto waterThermoPropsMemoized(real const& T, real const& P, StateOfMatter som, WaterThermoPropsModel model) -> WaterThermoProps;
+
 /// Calculate the thermodynamic properties of water.
 /// This is a general method that uses the Helmholtz free energy state
 /// of water, as an instance of WaterHelmholtzProps, to completely
@@ -26,10 +26,19 @@ using namespace Reaktoro;
 
 void exportWaterThermoPropsUtils(py::module& m)
 {
+    py::enum_<WaterThermoPropsModel>(m, "WaterThermoPropsModel")
+        .value("WagnerPruss", WaterThermoPropsModel::WagnerPruss)
+        .value("WagnerPrussInterp", WaterThermoPropsModel::WagnerPrussInterp)
+        .value("HGK", WaterThermoPropsModel::HGK)
+        .value("IAPWSIF97", WaterThermoPropsModel::IAPWSIF97)
+        ;
+
     m.def("waterThermoPropsHGK", waterThermoPropsHGK, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
     m.def("waterThermoPropsWagnerPruss", waterThermoPropsWagnerPruss, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
     m.def("waterThermoPropsHGKMemoized", waterThermoPropsHGKMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussMemoized", waterThermoPropsWagnerPrussMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussInterpMemoized", waterThermoPropsWagnerPrussInterpMemoized, "Calculate the thermodynamic properties of water using interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state.");
+    m.def("waterThermoPropsIAPWSIF97Memoized", waterThermoPropsIAPWSIF97Memoized, "Calculate the thermodynamic properties of water using the IAPWS Industrial Formulation 1997.");
+    m.def("waterThermoPropsMemoized", waterThermoPropsMemoized, "Calculate the thermodynamic properties of water using a chosen equation of state.");
     m.def("waterThermoProps", waterThermoProps, "Calculate the thermodynamic properties of water.");
 }
@@ -34,16 +34,46 @@ using std::pow;
 
 namespace Reaktoro {
 
+namespace {
+
+/// The last converged density of water and the conditions at which it was calculated, used to warm-start the next density calculation.
+struct WaterDensityWarmStart
+{
+    /// The temperature of the last converged density calculation (in K).
+    double T = NaN;
+
+    /// The pressure of the last converged density calculation (in Pa).
+    double P = NaN;
+
+    /// The state of matter of water in the last converged density calculation.
+    StateOfMatter som = StateOfMatter::Liquid;
+
+    /// The last converged density of water (in kg/m3).
+    double D = NaN;
+};
+
+/// The largest temperature difference (in K) for which the last converged density of water is used as initial guess.
+const auto warmstart_max_delta_T = 1.0;
+
+/// The largest relative pressure difference for which the last converged density of water is used as initial guess.
+const auto warmstart_max_delta_P = 0.01;
+
+/// Return true if the last converged density of water can be used as initial guess at given temperature, pressure and state of matter.
+auto canWarmStart(WaterDensityWarmStart const& warmstart, real const& T, real const& P, StateOfMatter stateofmatter) -> bool
+{
+    return warmstart.som == stateofmatter &&
+        abs(T - warmstart.T) <= warmstart_max_delta_T &&
+        abs(P - warmstart.P) <= warmstart_max_delta_P * warmstart.P;
+}
+
+/// Perform Newton's iterations to calculate the density of water starting from given initial guess and return true if they converged.
 template<typename HelmholtsModel>
-auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, StateOfMatter stateofmatter) -> real
+auto waterDensityNewton(real const& T, real const& P, HelmholtsModel const& model, real& D) -> bool
 {
     // Auxiliary constants for the Newton's iterations
     const auto max_iters = 100;
     const auto tolerance = 1.0e-06;
 
-    // Determine an adequate initial guess for density based on the desired physical state of water
-    real D = waterDensityWagnerPrussInterp(T, P, stateofmatter);
-
     for(int i = 1; i <= max_iters; ++i)
     {
         WaterHelmholtzProps h = model(T, D);
@@ -67,17 +97,44 @@ auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, Sta
         else D *= 0.1;
 
         if(abs(F) < tolerance || abs(g) < tolerance)
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace
+
+template<typename HelmholtsModel>
+auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, StateOfMatter stateofmatter, WaterDensityWarmStart& warmstart) -> real
+{
+    real D;
+
+    // Start from the last converged density if temperature and pressure are close enough to those of the last calculation with the same state of matter
+    if(canWarmStart(warmstart, T, P, stateofmatter))
+    {
+        D = warmstart.D;
+        if(waterDensityNewton(T, P, model, D))
+        {
+            warmstart = { double(T), double(P), stateofmatter, double(D) };
             return D;
+        }
     }
 
-    errorif(true, "Unable to calculate the density of water because the calculations did not converge at temperature ", T, " K and pressure ", P, " Pa.");
+    // Determine an adequate initial guess for density based on the desired physical state of water
+    D = waterDensityWagnerPrussInterp(T, P, stateofmatter);
+
+    errorif(!waterDensityNewton(T, P, model, D), "Unable to calculate the density of water because the calculations did not converge at temperature ", T, " K and pressure ", P, " Pa.");
+
+    warmstart = { double(T), double(P), stateofmatter, double(D) };
 
-    return {};
+    return D;
 }
 
 auto waterDensityHGK(real const& T, real const& P, StateOfMatter stateofmatter) -> real
 {
-    return waterDensity(T, P, waterHelmholtzPropsHGK, stateofmatter);
+    static thread_local WaterDensityWarmStart warmstart;
+    return waterDensity(T, P, waterHelmholtzPropsHGK, stateofmatter, warmstart);
 }
 
 auto waterLiquidDensityHGK(real const& T, real const& P) -> real
@@ -92,7 +149,8 @@ auto waterVaporDensityHGK(real const& T, real const& P) -> real
 
 auto waterDensityWagnerPruss(real const& T, real const& P, StateOfMatter stateofmatter) -> real
 {
-    return waterDensity(T, P, waterHelmholtzPropsWagnerPruss, stateofmatter);
+    static thread_local WaterDensityWarmStart warmstart;
+    return waterDensity(T, P, waterHelmholtzPropsWagnerPruss, stateofmatter, warmstart);
 }
 
 auto waterLiquidDensityWagnerPruss(real const& T, real const& P) -> real
@@ -24,6 +24,9 @@
 namespace Reaktoro {
 
 /// Calculate the density of water using the Haar--Gallagher--Kell (1984) equation of state
+/// The Newton iterations start from the density last calculated in the current
+/// thread if it was for the same state of matter and at nearby temperature and
+/// pressure, and from an interpolated density otherwise.
 /// @param T The temperature of water (in K)
 /// @param P The pressure of water (in Pa)
 /// @param stateofmatter The state of matter of water
@@ -31,6 +34,9 @@ namespace Reaktoro {
 auto waterDensityHGK(real const& T, real const& P, StateOfMatter stateofmatter) -> real;
 
 /// Calculate the density of water using the Wagner and Pruss (1995) equation of state
+/// The Newton iterations start from the density last calculated in the current
+/// thread if it was for the same state of matter and at nearby temperature and
+/// pressure, and from an interpolated density otherwise.
 /// @param T The temperature of water (in K)
 /// @param P The pressure of water (in Pa)
 /// @param stateofmatter The state of matter of water
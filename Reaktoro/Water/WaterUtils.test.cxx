@@ -40,4 +40,17 @@ TEST_CASE("Testing water utility methods", "[WaterUtils]")
     CHECK( waterDensityWagnerPruss(T + 350, P, StateOfMatter::Liquid) == Approx(520.556) );
     CHECK( waterDensityWagnerPruss(T + 400, P, StateOfMatter::Liquid) == Approx(0.322301) );
     CHECK( waterDensityWagnerPruss(T + 500, P, StateOfMatter::Liquid) == Approx(0.280463) );
+
+    // Check densities calculated in sequence at nearby temperatures, which start from the previously calculated density
+    for(auto i = 1; i <= 400; ++i)
+        waterDensityWagnerPruss(T + 0.5*i, P, StateOfMatter::Liquid);
+
+    CHECK( waterDensityWagnerPruss(T + 200, P, StateOfMatter::Liquid) == Approx(863.542) );
+
+    // Check densities calculated alternately for liquid and gaseous water at nearby conditions
+    CHECK( waterDensityWagnerPruss(T + 400.5, P, StateOfMatter::Gas) == Approx(waterDensityWagnerPruss(T + 400, P, StateOfMatter::Gas)).epsilon(0.01) );
+    CHECK( waterDensityWagnerPruss(T + 0.5, P, StateOfMatter::Liquid) == Approx(999.842).epsilon(0.001) );
+    CHECK( waterDensityWagnerPruss(T, P, StateOfMatter::Gas) == Approx(0.0963975) );
+    CHECK( waterDensityWagnerPruss(T, P, StateOfMatter::Liquid) == Approx(999.842) );
+    CHECK( waterDensityWagnerPruss(T, P*1.001, StateOfMatter::Liquid) == Approx(999.842).epsilon(0.001) );
 }
@@ -42,6 +42,19 @@ using namespace py::literals;
 
 const auto return_internal_ref = py::return_value_policy::reference_internal;
 
+/// Return a NumPy array that views the values of an array of real numbers without copying them.
+/// The derivative lane of each autodiff number is skipped by using a stride of `sizeof(real)`.
+/// The view keeps @p base alive and is read-only unless @p writeable is true.
+inline auto realArrayView(Reaktoro::ArrayXrConstRef array, py::handle base, bool writeable = false) -> py::array
+{
+    static_assert(sizeof(Reaktoro::real) == 2 * sizeof(double), "Expecting real to be stored as a value followed by a single derivative.");
+    const auto data = reinterpret_cast<double const*>(array.data());
+    py::array view(py::dtype::of<double>(), { array.size() }, { static_cast<py::ssize_t>(sizeof(Reaktoro::real)) }, data, base);
+    if(!writeable)
+        py::detail::array_proxy(view.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return view;
+}
+
 PYBIND11_MAKE_OPAQUE(Reaktoro::ArrayXr);
 PYBIND11_MAKE_OPAQUE(Reaktoro::ArrayXrRef);
 PYBIND11_MAKE_OPAQUE(Reaktoro::ArrayXrConstRef);
@@ -0,0 +1,61 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Google Benchmark includes
+#include <benchmark/benchmark.h>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include "BenchmarkUtils.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+/// Benchmark the evaluation of an aqueous activity model for a number of species given by the benchmark argument.
+static void benchmarkActivityModel(benchmark::State& bench, Fn<ActivityModelGenerator()> const& createModel)
+{
+    const auto species = aqueousSpeciesSupcrt(bench.range(0));
+
+    const auto size = species.size();
+
+    ActivityModel model = createModel()(species);
+
+    ActivityProps props = ActivityProps::create(size);
+
+    // Mole fractions of 1 kg of water with 0.01 mol of each solute
+    ArrayXr n = ArrayXr::Constant(size, 0.01);
+    n[0] = 55.508;
+    const ArrayXr x = n / n.sum();
+
+    const real T = 333.15;
+    const real P = 100.0e5;
+
+    for(auto _ : bench)
+    {
+        model(props, {T, P, x});
+        benchmark::DoNotOptimize(props.ln_g.data());
+    }
+
+    bench.counters["species"] = size;
+}
+
+BENCHMARK_CAPTURE(benchmarkActivityModel, ideal, [] { return ActivityModelIdealAqueous(); })->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK_CAPTURE(benchmarkActivityModel, davies, [] { return ActivityModelDavies(); })->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK_CAPTURE(benchmarkActivityModel, debyehuckel, [] { return ActivityModelDebyeHuckel(); })->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK_CAPTURE(benchmarkActivityModel, hkf, [] { return ActivityModelHKF(); })->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK_CAPTURE(benchmarkActivityModel, pitzer, [] { return ActivityModelPitzer(); })->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK_CAPTURE(benchmarkActivityModel, extendeduniquac, [] { return ActivityModelExtendedUNIQUAC(); })->Arg(10)->Arg(50)->Arg(200);
@@ -0,0 +1,138 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+namespace Reaktoro {
+namespace benchmarks {
+
+/// Return a chemical state of a carbonate brine system using the PHREEQC database phreeqc.dat.
+inline auto stateBrinePhreeqc() -> ChemicalState
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca Mg"));
+    solution.setActivityModel(ActivityModelPhreeqc(db));
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+    gases.setActivityModel(ActivityModelPengRobinson());
+
+    MineralPhases minerals("Calcite Dolomite Halite");
+
+    ChemicalSystem system(db, solution, gases, minerals);
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.set("H2O"    , 1.0, "kg");
+    state.set("Na+"    , 1.0, "mol");
+    state.set("Cl-"    , 1.0, "mol");
+    state.set("CO2(g)" , 1.0, "mol");
+    state.set("Calcite", 1.0, "mol");
+    state.set("Dolomite", 0.5, "mol");
+
+    return state;
+}
+
+/// Return a chemical state of a carbonate brine system using the SUPCRTBL database.
+inline auto stateBrineSupcrt() -> ChemicalState
+{
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca Mg"));
+    solution.setActivityModel(chain(
+        ActivityModelHKF(),
+        ActivityModelDrummond("CO2")
+    ));
+
+    GaseousPhase gases("CO2(g) H2O(g)");
+    gases.setActivityModel(ActivityModelPengRobinson());
+
+    MineralPhases minerals("Calcite Dolomite Halite");
+
+    ChemicalSystem system(db, solution, gases, minerals);
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.set("H2O(aq)" , 1.0, "kg");
+    state.set("Na+"     , 1.0, "mol");
+    state.set("Cl-"     , 1.0, "mol");
+    state.set("CO2(g)"  , 1.0, "mol");
+    state.set("Calcite" , 1.0, "mol");
+    state.set("Dolomite", 0.5, "mol");
+
+    return state;
+}
+
+/// Return a chemical state of a carbonate brine system using the ThermoFun database aq17.
+inline auto stateBrineThermoFun() -> ChemicalState
+{
+    ThermoFunDatabase db("aq17");
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca Mg"));
+    solution.setActivityModel(chain(
+        ActivityModelHKF(),
+        ActivityModelDrummond("CO2")
+    ));
+
+    GaseousPhase gases("CO2 H2O");
+    gases.setActivityModel(ActivityModelPengRobinson());
+
+    ChemicalSystem system(db, solution, gases);
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(100.0, "bar");
+    state.set("H2O@", 1.0, "kg");
+    state.set("Na+" , 1.0, "mol");
+    state.set("Cl-" , 1.0, "mol");
+    state.set("CO2" , 1.0, "mol");
+    state.set("Ca+2", 0.1, "mol");
+    state.set("Mg+2", 0.1, "mol");
+
+    return state;
+}
+
+/// Return the first `size` aqueous species in the SUPCRTBL database, starting with H2O(aq), H+ and OH-.
+inline auto aqueousSpeciesSupcrt(Index size) -> SpeciesList
+{
+    SupcrtDatabase db("supcrtbl");
+
+    const auto aqueous = db.species().withAggregateState(AggregateState::Aqueous);
+
+    SpeciesList species;
+    species.append(aqueous.get("H2O(aq)"));
+    species.append(aqueous.get("H+"));
+    species.append(aqueous.get("OH-"));
+
+    for(auto const& s : aqueous)
+    {
+        if(species.size() >= size) break;
+        if(species.find(s.name()) < species.size()) continue;
+        species.append(s);
+    }
+
+    return species;
+}
+
+} // namespace benchmarks
+} // namespace Reaktoro
@@ -0,0 +1,46 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Google Benchmark includes
+#include <benchmark/benchmark.h>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+static void benchmarkPhreeqcDatabase(benchmark::State& bench)
+{
+    for(auto _ : bench)
+        benchmark::DoNotOptimize(PhreeqcDatabase("phreeqc.dat"));
+}
+
+static void benchmarkSupcrtDatabase(benchmark::State& bench)
+{
+    for(auto _ : bench)
+        benchmark::DoNotOptimize(SupcrtDatabase("supcrtbl"));
+}
+
+static void benchmarkThermoFunDatabase(benchmark::State& bench)
+{
+    for(auto _ : bench)
+        benchmark::DoNotOptimize(ThermoFunDatabase("aq17"));
+}
+
+BENCHMARK(benchmarkPhreeqcDatabase)->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkSupcrtDatabase)->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkThermoFunDatabase)->Unit(benchmark::kMillisecond);
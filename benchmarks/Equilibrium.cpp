@@ -0,0 +1,110 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Google Benchmark includes
+#include <benchmark/benchmark.h>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include "BenchmarkUtils.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+/// Benchmark equilibrium calculations with given temperature and pressure.
+static void benchmarkEquilibriumTP(benchmark::State& bench, Fn<ChemicalState()> const& createState)
+{
+    const ChemicalState state0 = createState();
+
+    EquilibriumSolver solver(state0.system());
+
+    ChemicalState state(state0);
+
+    for(auto _ : bench)
+    {
+        state = state0; // always start from the same initial state so that each iteration is reproducible
+        auto result = solver.solve(state);
+        errorif(result.failed(), "Equilibrium calculation with given temperature and pressure failed.");
+    }
+}
+
+/// Benchmark equilibrium calculations with given enthalpy and pressure.
+static void benchmarkEquilibriumHP(benchmark::State& bench, Fn<ChemicalState()> const& createState)
+{
+    ChemicalState state0 = createState();
+
+    EquilibriumSolver solverTP(state0.system());
+    solverTP.solve(state0);
+
+    ChemicalProps props0(state0);
+
+    const auto specs = EquilibriumSpecs::HP(state0.system());
+
+    EquilibriumSolver solver(specs);
+
+    EquilibriumConditions conditions(specs);
+    conditions.enthalpy(props0.enthalpy() * 1.01);
+    conditions.pressure(props0.pressure());
+
+    ChemicalState state(state0);
+
+    for(auto _ : bench)
+    {
+        state = state0;
+        auto result = solver.solve(state, conditions);
+        errorif(result.failed(), "Equilibrium calculation with given enthalpy and pressure failed.");
+    }
+}
+
+/// Benchmark equilibrium calculations with given temperature, pressure and pH.
+static void benchmarkEquilibriumPH(benchmark::State& bench, Fn<ChemicalState()> const& createState)
+{
+    const ChemicalState state0 = createState();
+
+    EquilibriumSpecs specs(state0.system());
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumSolver solver(specs);
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(state0.temperature());
+    conditions.pressure(state0.pressure());
+    conditions.pH(5.0);
+
+    ChemicalState state(state0);
+
+    for(auto _ : bench)
+    {
+        state = state0;
+        auto result = solver.solve(state, conditions);
+        errorif(result.failed(), "Equilibrium calculation with given temperature, pressure and pH failed.");
+    }
+}
+
+BENCHMARK_CAPTURE(benchmarkEquilibriumTP, phreeqc, stateBrinePhreeqc)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkEquilibriumTP, supcrt, stateBrineSupcrt)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkEquilibriumTP, thermofun, stateBrineThermoFun)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(benchmarkEquilibriumHP, phreeqc, stateBrinePhreeqc)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkEquilibriumHP, supcrt, stateBrineSupcrt)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkEquilibriumHP, thermofun, stateBrineThermoFun)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(benchmarkEquilibriumPH, phreeqc, stateBrinePhreeqc)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkEquilibriumPH, supcrt, stateBrineSupcrt)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkEquilibriumPH, thermofun, stateBrineThermoFun)->Unit(benchmark::kMicrosecond);
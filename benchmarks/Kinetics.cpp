@@ -0,0 +1,73 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Google Benchmark includes
+#include <benchmark/benchmark.h>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+/// Benchmark a kinetics step of calcite dissolution in a carbonate brine.
+static void benchmarkKineticsStep(benchmark::State& bench)
+{
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase solution(speciate("H O C Na Cl Ca"));
+    solution.setActivityModel(ActivityModelHKF());
+
+    // A simple first-order rate law for the dissolution of calcite (in mol/s)
+    auto ratefn = [](ChemicalProps const& props)
+    {
+        const auto k = 1e-6;
+        const auto ncal = props.speciesAmount("Calcite");
+        return k * ncal;
+    };
+
+    ChemicalSystem system(db,
+        solution,
+        MineralPhase("Calcite"),
+        GeneralReaction("Calcite = Ca+2 + CO3-2").setRateModel(ratefn)
+    );
+
+    ChemicalState state0(system);
+    state0.temperature(25.0, "celsius");
+    state0.pressure(1.0, "bar");
+    state0.set("H2O(aq)", 1.0, "kg");
+    state0.set("Na+"    , 0.1, "mol");
+    state0.set("Cl-"    , 0.1, "mol");
+    state0.set("Calcite", 1.0, "mol");
+
+    EquilibriumSolver esolver(system);
+    esolver.solve(state0); // initial equilibrium state excluding the kinetically controlled calcite dissolution
+
+    KineticsSolver solver(system);
+
+    ChemicalState state(state0);
+
+    const auto dt = 60.0; // the time step (in s)
+
+    for(auto _ : bench)
+    {
+        state = state0;
+        auto result = solver.solve(state, dt);
+        errorif(result.failed(), "Kinetics step failed.");
+    }
+}
+
+BENCHMARK(benchmarkKineticsStep)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,72 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Google Benchmark includes
+#include <benchmark/benchmark.h>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include "BenchmarkUtils.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+/// Benchmark smart equilibrium calculations that are successfully predicted from a previously learned state.
+static void benchmarkSmartEquilibriumHit(benchmark::State& bench, Fn<ChemicalState()> const& createState)
+{
+    const ChemicalState state0 = createState();
+
+    SmartEquilibriumSolver solver(state0.system());
+
+    ChemicalState state(state0);
+    solver.solve(state); // learn the initial state so that the calculations below are predictions
+
+    ChemicalState perturbed(state);
+    perturbed.temperature(state.temperature() + 0.1); // a small perturbation that should still be accepted
+
+    for(auto _ : bench)
+    {
+        state = perturbed;
+        auto result = solver.solve(state);
+        errorif(!result.prediction.accepted, "Smart equilibrium calculation expected to be predicted was not accepted.");
+    }
+}
+
+/// Benchmark smart equilibrium calculations that miss the learned states and require learning a new one.
+static void benchmarkSmartEquilibriumMiss(benchmark::State& bench, Fn<ChemicalState()> const& createState)
+{
+    const ChemicalState state0 = createState();
+
+    ChemicalState state(state0);
+
+    for(auto _ : bench)
+    {
+        bench.PauseTiming();
+        SmartEquilibriumSolver solver(state0.system()); // a new solver with no learned states, so that every calculation is a miss
+        state = state0;
+        bench.ResumeTiming();
+
+        auto result = solver.solve(state);
+        errorif(result.failed(), "Smart equilibrium calculation expected to be learned failed.");
+    }
+}
+
+BENCHMARK_CAPTURE(benchmarkSmartEquilibriumHit, phreeqc, stateBrinePhreeqc)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkSmartEquilibriumHit, supcrt, stateBrineSupcrt)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(benchmarkSmartEquilibriumMiss, phreeqc, stateBrinePhreeqc)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkSmartEquilibriumMiss, supcrt, stateBrineSupcrt)->Unit(benchmark::kMicrosecond);
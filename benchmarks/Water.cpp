@@ -0,0 +1,44 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// Google Benchmark includes
+#include <benchmark/benchmark.h>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+using namespace Reaktoro;
+
+/// Benchmark the evaluation of water thermodynamic properties with given function over a grid of temperatures and pressures.
+static void benchmarkWaterThermoProps(benchmark::State& bench, Fn<WaterThermoProps(real const&, real const&, StateOfMatter)> const& fn)
+{
+    // The temperatures (in K) and pressures (in Pa) covering liquid water conditions
+    const ArrayXd temperatures = ArrayXd::LinSpaced(10, 298.15, 573.15);
+    const ArrayXd pressures = ArrayXd::LinSpaced(10, 1.0e5, 500.0e5);
+
+    for(auto _ : bench)
+        for(auto T : temperatures)
+            for(auto P : pressures)
+                benchmark::DoNotOptimize(fn(T, P, StateOfMatter::Liquid));
+
+    bench.SetItemsProcessed(bench.iterations() * temperatures.size() * pressures.size());
+}
+
+BENCHMARK_CAPTURE(benchmarkWaterThermoProps, wagnerpruss, waterThermoPropsWagnerPruss)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkWaterThermoProps, hgk, waterThermoPropsHGK)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(benchmarkWaterThermoProps, wagnerprussinterp, waterThermoPropsWagnerPrussInterpMemoized)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,102 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright © 2014-2022 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+# ---------------------------------------------------------------------------------------------------------------------------
+# Compare the results of reaktoro-workloads against a stored baseline. Execute this script using:
+#
+# python /path/to/benchmarks/workloads/compare.py reaktoro-workloads.json /path/to/benchmarks/baselines/workloads-X.Y.Z.json
+#
+# A metric of a workload is reported as a regression only if it is worse than its baseline value by more than the relative
+# tolerance (see --tolerance) and, for the throughput, also by more than the given number of standard deviations (see
+# --sigmas) of the combined spread of both measurements, so that noisy measurements do not cause false alarms. The exit
+# status is 1 if any regression is found, so that this script can be used in continuous integration.
+# ---------------------------------------------------------------------------------------------------------------------------
+
+import argparse
+import json
+import math
+import sys
+
+
+# The metrics compared for each workload and whether larger values are better.
+METRICS = {
+    "throughput": True,
+    "latency_p50": False,
+    "latency_p90": False,
+    "latency_p99": False,
+    "iterations_mean": False,
+    "memory_peak_kb": False,
+}
+
+
+def compare(current, baseline, tolerance, sigmas):
+    """Return the rows of the comparison table and the number of regressions."""
+    baselines = {w["name"]: w for w in baseline["workloads"]}
+    rows = []
+    regressions = 0
+    for workload in current["workloads"]:
+        name = workload["name"]
+        if name not in baselines:
+            rows.append((name, "-", "-", "-", "-", "new workload"))
+            continue
+        base = baselines[name]
+        for metric, larger_is_better in METRICS.items():
+            cur, ref = workload.get(metric), base.get(metric)
+            if cur is None or ref is None or ref == 0.0:
+                continue
+            change = (cur - ref) / ref
+            worse = -change if larger_is_better else change
+            regressed = worse > tolerance
+            if regressed and metric == "throughput":
+                spread = math.hypot(workload.get("throughput_stddev", 0.0), base.get("throughput_stddev", 0.0))
+                regressed = abs(cur - ref) > sigmas * spread
+            regressions += regressed
+            status = "REGRESSION" if regressed else ("improved" if -worse > tolerance else "ok")
+            rows.append((name, metric, f"{ref:.6g}", f"{cur:.6g}", f"{100 * change:+.1f}%", status))
+    return rows, regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare reaktoro-workloads results against a baseline.")
+    parser.add_argument("current", help="the JSON file with the current results")
+    parser.add_argument("baseline", help="the JSON file with the baseline results")
+    parser.add_argument("--tolerance", type=float, default=0.05, help="the relative tolerance for a change to be significant (default: 0.05)")
+    parser.add_argument("--sigmas", type=float, default=3.0, help="the number of standard deviations for a throughput change to be significant (default: 3)")
+    args = parser.parse_args()
+
+    with open(args.current) as f:
+        current = json.load(f)
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    rows, regressions = compare(current, baseline, args.tolerance, args.sigmas)
+
+    print(f"Comparing Reaktoro {current.get('reaktoro_version')} against baseline Reaktoro {baseline.get('reaktoro_version')}")
+    header = ("workload", "metric", "baseline", "current", "change", "status")
+    widths = [max(len(str(row[i])) for row in rows + [header]) for i in range(len(header))]
+    for row in [header] + rows:
+        print("  ".join(str(x).ljust(w) for x, w in zip(row, widths)).rstrip())
+
+    if regressions:
+        print(f"Found {regressions} performance regression(s).")
+        sys.exit(1)
+
+    print("No performance regressions found.")
+
+
+if __name__ == "__main__":
+    main()
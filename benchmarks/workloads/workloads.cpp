@@ -0,0 +1,463 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+// -----------------------------------------------------------------------------
+// End-to-end workloads for tracking performance regressions across releases.
+//
+// Each workload is executed a number of times (see --repetitions), and the
+// throughput (solves per second), the latency percentiles of the individual
+// solves, the mean number of iterations per solve, and the peak memory usage
+// of the process are written to a JSON file (see --output). These results are
+// compared against stored baselines with benchmarks/workloads/compare.py.
+//
+// Usage: reaktoro-workloads [--quick] [--repetitions N] [--filter NAME] [--output FILE]
+// -----------------------------------------------------------------------------
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+
+// Platform includes
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// nlohmann/json includes
+#include <nlohmann/json.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+using json = nlohmann::json;
+
+#ifndef REAKTORO_VERSION
+#define REAKTORO_VERSION "unknown"
+#endif
+
+/// The measurements collected during a single execution of a workload.
+struct WorkloadRun
+{
+    /// The computing times of the individual solves (in s).
+    Vec<double> latencies;
+
+    /// The number of iterations of the individual solves (empty if not available).
+    Vec<double> iterations;
+
+    /// The wall-clock time of the whole workload (in s).
+    double seconds = 0.0;
+};
+
+/// The options controlling the size of the workloads.
+struct WorkloadOptions
+{
+    /// The number of cells in the reactive transport workloads.
+    Index cells = 1000;
+
+    /// The number of time steps in the reactive transport workloads.
+    Index steps = 1000;
+
+    /// The number of solves in the equilibrium sweep workloads.
+    Index solves = 1000;
+};
+
+/// Return the peak resident memory of the process so far (in KB).
+auto peakMemoryKB() -> double
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize / 1024.0;
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return usage.ru_maxrss / 1024.0; // ru_maxrss is in bytes on macOS
+#else
+    return usage.ru_maxrss; // ru_maxrss is in kilobytes on Linux
+#endif
+#endif
+}
+
+/// Return the given percentile (in [0, 100]) of a list of values using linear interpolation.
+auto percentile(Vec<double> values, double p) -> double
+{
+    if(values.empty())
+        return NaN;
+    std::sort(values.begin(), values.end());
+    const auto pos = p / 100.0 * (values.size() - 1);
+    const auto i = static_cast<Index>(std::floor(pos));
+    const auto j = std::min(i + 1, values.size() - 1);
+    return values[i] + (pos - i) * (values[j] - values[i]);
+}
+
+/// Return the mean of a list of values.
+auto mean(Vec<double> const& values) -> double
+{
+    if(values.empty())
+        return NaN;
+    double sum = 0.0;
+    for(auto x : values)
+        sum += x;
+    return sum / values.size();
+}
+
+/// Return the sample standard deviation of a list of values.
+auto stddev(Vec<double> const& values) -> double
+{
+    if(values.size() < 2)
+        return 0.0;
+    const auto m = mean(values);
+    double sum = 0.0;
+    for(auto x : values)
+        sum += (x - m) * (x - m);
+    return std::sqrt(sum / (values.size() - 1));
+}
+
+/// Return the wall-clock time elapsed since given time point (in s).
+auto elapsed(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//=================================================================================================
+// WORKLOADS
+//=================================================================================================
+
+/// Run a 1D reactive transport simulation of calcite dissolution by CO2-rich water (see ReactiveTransportSolver).
+auto workloadReactiveTransportCalcite(WorkloadOptions const& options, bool smart) -> WorkloadRun
+{
+    SupcrtDatabase db("supcrtbl");
+
+    ChemicalSystem system(db,
+        AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq) CaCO3(aq) CaHCO3+ CaOH+").setActivityModel(ActivityModelDavies()),
+        MineralPhase("Calcite")
+    );
+
+    EquilibriumSolver solver(system);
+
+    ChemicalState initial(system);
+    initial.temperature(60.0, "celsius");
+    initial.pressure(100.0, "bar");
+    initial.set("H2O(aq)", 1.0, "kg");
+    initial.set("Calcite", 10.0, "mol");
+    solver.solve(initial);
+
+    ChemicalState injected(system);
+    injected.temperature(60.0, "celsius");
+    injected.pressure(100.0, "bar");
+    injected.set("H2O(aq)", 1.0, "kg");
+    injected.set("CO2(aq)", 0.5, "mol");
+    solver.solve(injected);
+
+    Mesh mesh(options.cells, 0.0, 1.0);
+
+    ReactiveTransportSolver rtsolver(system);
+    rtsolver.setMesh(mesh);
+    rtsolver.setVelocity(1.0e-5);
+    rtsolver.setDiffusionCoeff(1.0e-9);
+    rtsolver.setBoundaryState(injected);
+    rtsolver.setTimeStep(0.5 * mesh.dx() / 1.0e-5); // Courant number v*dt/dx = 0.5
+
+    if(smart)
+        rtsolver.setOptions(SmartEquilibriumOptions());
+
+    rtsolver.initialize();
+
+    Vec<ChemicalState> states(options.cells, initial);
+
+    WorkloadRun run;
+    run.latencies.reserve(options.cells * options.steps);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(Index i = 0; i < options.steps; ++i)
+    {
+        rtsolver.step(states);
+        for(auto cost : rtsolver.cellCosts())
+            run.latencies.push_back(cost);
+    }
+
+    run.seconds = elapsed(start);
+
+    return run;
+}
+
+/// Run a sweep of calcite solubility calculations in rainwater over temperatures (see examples/cpp/ex-equilibrium-calcite-solubility-rainwater.cpp).
+auto workloadCalciteSolubilityRainwater(WorkloadOptions const& options) -> WorkloadRun
+{
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase aqueousphase(speciate("H O C Ca Mg K Cl Na S N"), exclude("organic"));
+    aqueousphase.setActivityModel(chain(
+        ActivityModelHKF(),
+        ActivityModelDrummond("CO2")
+    ));
+
+    GaseousPhase gaseousphase("CO2(g) H2O(g)");
+    gaseousphase.setActivityModel(ActivityModelPengRobinson());
+
+    MineralPhase mineralphase("Calcite");
+
+    ChemicalSystem system(db, aqueousphase, gaseousphase, mineralphase);
+
+    ChemicalState initial(system);
+    initial.pressure(1.0, "bar");
+    initial.set("H2O(aq)", 1.00, "kg");
+    initial.set("Na+"    , 2.05, "mg");
+    initial.set("K+"     , 0.35, "mg");
+    initial.set("Ca+2"   , 1.42, "mg");
+    initial.set("Mg+2"   , 0.39, "mg");
+    initial.set("Cl-"    , 3.47, "mg");
+    initial.set("S2O4-2" , 2.19, "mg");
+    initial.set("NO3-"   , 0.27, "mg");
+    initial.set("NH4+"   , 0.41, "mg");
+    initial.set("Calcite", 10.0, "mol");
+
+    EquilibriumSolver solver(system);
+
+    ChemicalState state(initial);
+
+    WorkloadRun run;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(Index i = 0; i < options.solves; ++i)
+    {
+        state = initial;
+        state.temperature(25.0 + 75.0 * i / options.solves, "celsius");
+
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto result = solver.solve(state);
+        run.latencies.push_back(elapsed(t0));
+        run.iterations.push_back(result.iterations());
+    }
+
+    run.seconds = elapsed(start);
+
+    return run;
+}
+
+/// Run a sweep of CO2 solubility calculations in NaCl brines at fixed pH (see examples/cpp/ex-equilibrium-co2-solubility-nacl-h2o-fixed-ph.cpp).
+auto workloadCO2SolubilityFixedPH(WorkloadOptions const& options) -> WorkloadRun
+{
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase aqueousphase("H2O(aq) CO2(aq) CO3-2 Cl- H+ H2(aq) HCO3- Na+ NaCl(aq) NaOH(aq) O2(aq) OH- HCl(aq)");
+    aqueousphase.setActivityModel(chain(
+        ActivityModelHKF(),
+        ActivityModelDrummond("CO2")
+    ));
+
+    GaseousPhase gaseousphase("CO2(g) H2O(g)");
+    gaseousphase.setActivityModel(ActivityModelPengRobinson());
+
+    ChemicalSystem system(db, aqueousphase, gaseousphase);
+
+    EquilibriumSpecs specs(system);
+    specs.temperature();
+    specs.pressure();
+    specs.pH();
+
+    EquilibriumSolver solver(specs);
+
+    EquilibriumConditions conditions(specs);
+    conditions.temperature(60.0, "celsius");
+    conditions.pressure(100.0, "bar");
+
+    ChemicalState initial(system);
+    initial.set("H2O(aq)", 1.0, "kg");
+    initial.set("Na+",     1.0, "mol");
+    initial.set("Cl-",     1.0, "mol");
+    initial.set("CO2(g)", 10.0, "mol");
+
+    ChemicalState state(initial);
+
+    WorkloadRun run;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(Index i = 0; i < options.solves; ++i)
+    {
+        state = initial;
+        conditions.pH(3.0 + 4.0 * i / options.solves);
+
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto result = solver.solve(state, conditions);
+        run.latencies.push_back(elapsed(t0));
+        run.iterations.push_back(result.iterations());
+    }
+
+    run.seconds = elapsed(start);
+
+    return run;
+}
+
+/// Run equilibrium calculations of brines whose number of species grows with the number of elements considered in the aqueous phase.
+auto workloadSpeciesScaling(WorkloadOptions const& options, String const& elements) -> WorkloadRun
+{
+    SupcrtDatabase db("supcrtbl");
+
+    AqueousPhase aqueousphase(speciate(elements), exclude("organic"));
+    aqueousphase.setActivityModel(ActivityModelHKF());
+
+    ChemicalSystem system(db, aqueousphase);
+
+    ChemicalState initial(system);
+    initial.temperature(60.0, "celsius");
+    initial.pressure(100.0, "bar");
+    initial.set("H2O(aq)", 1.0, "kg");
+    for(auto const& species : system.species())
+        if(species.name() != "H2O(aq)")
+            initial.set(species.name(), 1e-3, "mol");
+
+    EquilibriumSolver solver(system);
+
+    ChemicalState state(initial);
+
+    WorkloadRun run;
+
+    const auto solves = std::max<Index>(options.solves / 10, 1);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(Index i = 0; i < solves; ++i)
+    {
+        state = initial;
+        state.temperature(25.0 + 75.0 * i / solves, "celsius");
+
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto result = solver.solve(state);
+        run.latencies.push_back(elapsed(t0));
+        run.iterations.push_back(result.iterations());
+    }
+
+    run.seconds = elapsed(start);
+
+    return run;
+}
+
+//=================================================================================================
+// HARNESS
+//=================================================================================================
+
+/// Return the summary of a workload run in JSON format.
+auto summary(WorkloadRun const& run) -> json
+{
+    json j;
+    j["solves"] = run.latencies.size();
+    j["seconds"] = run.seconds;
+    j["throughput"] = run.latencies.size() / run.seconds;
+    j["latency_p50"] = percentile(run.latencies, 50.0);
+    j["latency_p90"] = percentile(run.latencies, 90.0);
+    j["latency_p99"] = percentile(run.latencies, 99.0);
+    j["iterations_mean"] = run.iterations.empty() ? json(nullptr) : json(mean(run.iterations));
+    j["memory_peak_kb"] = peakMemoryKB();
+    return j;
+}
+
+int main(int argc, char const* argv[])
+{
+    WorkloadOptions options;
+
+    Index repetitions = 5;
+    String filter;
+    String output = "reaktoro-workloads.json";
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const String arg = argv[i];
+        const auto next = [&]() -> String { errorif(i + 1 >= argc, "Missing value for command-line argument ", arg, "."); return argv[++i]; };
+        if(arg == "--quick") options = { 100, 100, 100 };
+        else if(arg == "--repetitions") repetitions = std::stoul(next());
+        else if(arg == "--filter") filter = next();
+        else if(arg == "--output") output = next();
+        else errorif(true, "Unknown command-line argument ", arg, ". Usage: reaktoro-workloads [--quick] [--repetitions N] [--filter NAME] [--output FILE]");
+    }
+
+    const Vec<Pair<String, Fn<WorkloadRun()>>> workloads = {
+        { "reactive-transport-calcite"          , [&] { return workloadReactiveTransportCalcite(options, false); } },
+        { "reactive-transport-calcite-smart"    , [&] { return workloadReactiveTransportCalcite(options, true); } },
+        { "calcite-solubility-rainwater"        , [&] { return workloadCalciteSolubilityRainwater(options); } },
+        { "co2-solubility-nacl-fixed-ph"        , [&] { return workloadCO2SolubilityFixedPH(options); } },
+        { "species-scaling-H-O-Na-Cl"           , [&] { return workloadSpeciesScaling(options, "H O Na Cl"); } },
+        { "species-scaling-H-O-Na-Cl-C-Ca"      , [&] { return workloadSpeciesScaling(options, "H O Na Cl C Ca"); } },
+        { "species-scaling-H-O-Na-Cl-C-Ca-Mg-K-S", [&] { return workloadSpeciesScaling(options, "H O Na Cl C Ca Mg K S"); } },
+        { "species-scaling-H-O-Na-Cl-C-Ca-Mg-K-S-Fe-Al-Si", [&] { return workloadSpeciesScaling(options, "H O Na Cl C Ca Mg K S Fe Al Si"); } },
+    };
+
+    json results;
+    results["reaktoro_version"] = REAKTORO_VERSION;
+    results["date"] = std::time(nullptr);
+    results["repetitions"] = repetitions;
+    results["cells"] = options.cells;
+    results["steps"] = options.steps;
+    results["solves"] = options.solves;
+    results["workloads"] = json::array();
+
+    for(auto const& [name, workload] : workloads)
+    {
+        if(!filter.empty() && name.find(filter) == String::npos)
+            continue;
+
+        std::cout << "Running workload " << name << "..." << std::flush;
+
+        json entry;
+        entry["name"] = name;
+        entry["runs"] = json::array();
+
+        Vec<double> throughputs;
+
+        for(Index k = 0; k < repetitions; ++k)
+        {
+            const auto run = workload();
+            const auto s = summary(run);
+            entry["runs"].push_back(s);
+            throughputs.push_back(s["throughput"].get<double>());
+        }
+
+        // Aggregate the metrics over the repetitions using the median of each metric (robust to outliers) and the spread of the throughput
+        for(auto const& key : { "throughput", "latency_p50", "latency_p90", "latency_p99", "iterations_mean", "memory_peak_kb" })
+        {
+            Vec<double> values;
+            for(auto const& r : entry["runs"])
+                if(!r[key].is_null())
+                    values.push_back(r[key].get<double>());
+            entry[key] = values.empty() ? json(nullptr) : json(percentile(values, 50.0));
+        }
+
+        entry["throughput_stddev"] = stddev(throughputs);
+
+        std::cout << " " << entry["throughput"].get<double>() << " solves/s" << std::endl;
+
+        results["workloads"].push_back(entry);
+    }
+
+    std::ofstream file(output);
+    errorif(!file, "Could not open file ", output, " for writing the results of the workloads.");
+    file << results.dump(4) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+# Compress a file using gzip (used to store the embedded resources in the library).
+#
+# Usage:
+#   cmake -DINPUT=<file> -DOUTPUT=<file.gz> -P CompressFile.cmake
+#
+# The compressed file is a plain gzip stream of the input file (no archive
+# headers), which can be decompressed with zlib's inflate (or with zcat).
+
+get_filename_component(OUTPUT_DIR "${OUTPUT}" DIRECTORY)
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+file(ARCHIVE_CREATE OUTPUT "${OUTPUT}" PATHS "${INPUT}" FORMAT raw COMPRESSION GZip)
@@ -3,6 +3,7 @@ if(REAKTORO_ENABLE_OPENLIBM)
 endif()
 
 set(REAKTORO_USE_autodiff        "" CACHE PATH "Specify this option in case a specific autodiff library should be used.")
+set(REAKTORO_USE_benchmark       "" CACHE PATH "Specify this option in case a specific benchmark library should be used.")
 set(REAKTORO_USE_Catch2          "" CACHE PATH "Specify this option in case a specific Catch2 library should be used.")
 set(REAKTORO_USE_Eigen3          "" CACHE PATH "Specify this option in case a specific Eigen3 library should be used.")
 set(REAKTORO_USE_nlohmann_json   "" CACHE PATH "Specify this option in case a specific nlohmann_json library should be used.")
@@ -37,17 +38,30 @@ ReaktoroFindPackage(Eigen3 3.4 REQUIRED)
 ReaktoroFindPackage(nlohmann_json 3.6.1 REQUIRED)
 ReaktoroFindPackage(Optima 0.4.0 REQUIRED)
 ReaktoroFindPackage(phreeqc4rkt 3.6.2.1 REQUIRED)
+ReaktoroFindPackage(Threads REQUIRED)
 ReaktoroFindPackage(tabulate 1.4.0 REQUIRED)
 ReaktoroFindPackage(ThermoFun 0.4.5 REQUIRED)
 ReaktoroFindPackage(tsl-ordered-map 1.0.0 REQUIRED)
 ReaktoroFindPackage(yaml-cpp 0.6.3 REQUIRED)
 
 # Optional dependencies
+ReaktoroFindPackage(benchmark 1.5.0)
 ReaktoroFindPackage(Catch2 2.6.2)
 ReaktoroFindPackage(Python COMPONENTS Interpreter Development)
 ReaktoroFindPackage(pybind11 2.10.0)
 ReaktoroFindPackage(reaktplot 0.4.1)
 
+if(REAKTORO_COMPRESS_EMBEDDED)
+    ReaktoroFindPackage(ZLIB)
+    if(NOT ZLIB_FOUND)
+        message(WARNING "Could not find zlib. The embedded resources of Reaktoro will not be compressed!")
+        set(REAKTORO_COMPRESS_EMBEDDED OFF)
+    elseif(CMAKE_VERSION VERSION_LESS 3.18)
+        message(WARNING "CMake 3.18 or newer is needed to compress files. The embedded resources of Reaktoro will not be compressed!")
+        set(REAKTORO_COMPRESS_EMBEDDED OFF)
+    endif()
+endif()
+
 if(REAKTORO_BUILD_TESTS)
     if(NOT Catch2_FOUND)
         message(WARNING "Could not find Catch2. The C++ tests of Reaktoro will not be built!")
@@ -55,6 +69,13 @@ if(REAKTORO_BUILD_TESTS)
     endif()
 endif()
 
+if(REAKTORO_BUILD_BENCHMARKS)
+    if(NOT benchmark_FOUND)
+        message(WARNING "Could not find benchmark (Google Benchmark). The C++ benchmarks of Reaktoro will not be built!")
+        set(REAKTORO_BUILD_BENCHMARKS OFF)
+    endif()
+endif()
+
 if(REAKTORO_BUILD_PYTHON)
     find_program(PYBIND11_STUBGEN pybind11-stubgen)
     if(NOT pybind11_FOUND)